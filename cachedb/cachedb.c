@@ -45,11 +45,15 @@
 #include "cachedb/cachedb.h"
 #include "cachedb/redis.h"
 #include "util/regional.h"
+#include "util/alloc.h"
 #include "util/net_help.h"
+#include "util/netevent.h"
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgencode.h"
 #include "services/cache/dns.h"
+#include "services/mesh.h"
+#include "services/modstack.h"
 #include "validator/val_neg.h"
 #include "validator/val_secalgo.h"
 #include "iterator/iter_utils.h"
@@ -85,6 +89,27 @@
 #  endif /* HAVE_LIBKERN_OSBYTEORDER_H */
 #endif /* HAVE_BE64TOH */
 
+/** an asynchronous lookup in the testframe, that waits for the timer */
+struct testframe_lookup {
+	/** next in list of waiting lookups */
+	struct testframe_lookup* next;
+	/** the lookup to complete */
+	struct cachedb_pending* pending;
+	/** key that is looked up, malloced */
+	char* key;
+};
+
+/** per thread state of the asynchronous testframe; the lookups complete
+ * from a timer on the thread's event base, like a reply from a server */
+struct testframe_async {
+	/** the testframe with the stored data */
+	struct testframe_moddata* moddata;
+	/** timer that completes the waiting lookups, NULL if not made yet */
+	struct comm_timer* timer;
+	/** list of waiting lookups */
+	struct testframe_lookup* list;
+};
+
 /** the unit test testframe for cachedb, its module state contains
  * a cache for a couple queries (in memory). */
 struct testframe_moddata {
@@ -96,13 +121,17 @@ struct testframe_moddata {
 	uint8_t* stored_data;
 	/** length of stored data */
 	size_t stored_datalen;
+	/** number of threads */
+	int numthreads;
+	/** per thread async state, array of numthreads, NULL if the
+	 * lookups are synchronous */
+	struct testframe_async* asyncs;
 };
 
 static int
 testframe_init(struct module_env* env, struct cachedb_env* cachedb_env)
 {
 	struct testframe_moddata* d;
-	(void)env;
 	verbose(VERB_ALGO, "testframe_init");
 	d = (struct testframe_moddata*)calloc(1,
 		sizeof(struct testframe_moddata));
@@ -113,6 +142,22 @@ testframe_init(struct module_env* env, struct cachedb_env* cachedb_env)
 	}
 	lock_basic_init(&d->lock);
 	lock_protect(&d->lock, d, sizeof(*d));
+	if(env->cfg->redis_async) {
+		int i;
+		d->numthreads = env->cfg->num_threads;
+		d->asyncs = (struct testframe_async*)calloc(
+			(size_t)d->numthreads, sizeof(struct testframe_async));
+		if(!d->asyncs) {
+			log_err("out of memory");
+			lock_basic_destroy(&d->lock);
+			free(d);
+			cachedb_env->backend_data = NULL;
+			return 0;
+		}
+		for(i = 0; i < d->numthreads; i++)
+			d->asyncs[i].moddata = d;
+		cachedb_env->async_lookup = 1;
+	}
 	return 1;
 }
 
@@ -128,6 +173,9 @@ testframe_deinit(struct module_env* env, struct cachedb_env* cachedb_env)
 	lock_basic_destroy(&d->lock);
 	free(d->stored_key);
 	free(d->stored_data);
+	/* the timers and waiting lookups are removed by
+	 * testframe_thread_close */
+	free(d->asyncs);
 	free(d);
 }
 
@@ -194,9 +242,105 @@ testframe_store(struct module_env* env, struct cachedb_env* cachedb_env,
 	/* (key,data) successfully stored */
 }
 
+void
+testframe_async_timer_cb(void* arg)
+{
+	struct testframe_async* a = (struct testframe_async*)arg;
+	struct testframe_moddata* d = a->moddata;
+	struct testframe_lookup* list = a->list, *l;
+	a->list = NULL;
+	while(list) {
+		uint8_t* data = NULL;
+		size_t datalen = 0;
+		l = list;
+		list = list->next;
+		lock_basic_lock(&d->lock);
+		if(d->stored_key && strcmp(d->stored_key, l->key) == 0) {
+			data = memdup(d->stored_data, d->stored_datalen);
+			datalen = d->stored_datalen;
+		}
+		lock_basic_unlock(&d->lock);
+		verbose(VERB_ALGO, "testframe async lookup of %s: %s", l->key,
+			data?"found":"not found");
+		/* the data is copied, because the query may store in the
+		 * testframe when it resumes */
+		cachedb_lookup_done(l->pending, data, datalen, 1);
+		free(data);
+		free(l->key);
+		free(l);
+	}
+}
+
+static int
+testframe_lookup_async(struct module_env* env,
+	struct cachedb_env* cachedb_env, char* key,
+	struct cachedb_pending* pending)
+{
+	struct testframe_moddata* d = (struct testframe_moddata*)
+		cachedb_env->backend_data;
+	struct testframe_async* a;
+	struct testframe_lookup* l;
+	struct timeval tv;
+	log_assert(env->alloc->thread_num < d->numthreads);
+	a = &d->asyncs[env->alloc->thread_num];
+	if(!a->timer) {
+		a->timer = comm_timer_create(env->worker_base,
+			testframe_async_timer_cb, a);
+		if(!a->timer) {
+			log_err("testframe: out of memory");
+			return 0;
+		}
+	}
+	l = (struct testframe_lookup*)calloc(1, sizeof(*l));
+	if(!l) {
+		log_err("testframe: out of memory");
+		return 0;
+	}
+	l->key = strdup(key);
+	if(!l->key) {
+		free(l);
+		log_err("testframe: out of memory");
+		return 0;
+	}
+	verbose(VERB_ALGO, "testframe async lookup of %s started", key);
+	l->pending = pending;
+	l->next = a->list;
+	a->list = l;
+	/* complete in a later event loop iteration */
+	tv.tv_sec = 0;
+	tv.tv_usec = 0;
+	comm_timer_set(a->timer, &tv);
+	return 1;
+}
+
+static void
+testframe_thread_close(struct module_env* env,
+	struct cachedb_env* cachedb_env)
+{
+	struct testframe_moddata* d = (struct testframe_moddata*)
+		cachedb_env->backend_data;
+	struct testframe_async* a;
+	struct testframe_lookup* l;
+	if(!d || !d->asyncs)
+		return;
+	log_assert(env->alloc->thread_num < d->numthreads);
+	a = &d->asyncs[env->alloc->thread_num];
+	/* the waiting queries are deleted by the caller */
+	while(a->list) {
+		l = a->list;
+		a->list = l->next;
+		cachedb_lookup_done(l->pending, NULL, 0, 0);
+		free(l->key);
+		free(l);
+	}
+	comm_timer_delete(a->timer);
+	a->timer = NULL;
+}
+
 /** The testframe backend is for unit tests */
 static struct cachedb_backend testframe_backend = { "testframe",
-	testframe_init, testframe_deinit, testframe_lookup, testframe_store
+	testframe_init, testframe_deinit, testframe_lookup, testframe_store,
+	testframe_lookup_async, testframe_thread_close
 };
 
 /** find a particular backend from possible backends */
@@ -563,6 +707,25 @@ parse_data(struct module_qstate* qstate, struct sldns_buffer* buf)
 	return 1;
 }
 
+/**
+ * Convert the data fetched from the backend in the scratch buffer to
+ * qstate.return_msg. return true if the data was usable.
+ */
+static int
+cachedb_extcache_parse(struct module_qstate* qstate)
+{
+	/* check expiry date and check if query-data matches */
+	if( !good_expiry_and_qinfo(qstate, qstate->env->scratch_buffer) ) {
+		return 0;
+	}
+
+	/* parse dns message into return_msg */
+	if( !parse_data(qstate, qstate->env->scratch_buffer) ) {
+		return 0;
+	}
+	return 1;
+}
+
 /**
  * Lookup the qstate.qinfo in extcache, store in qstate.return_msg.
  * return true if lookup was successful.
@@ -578,19 +741,86 @@ cachedb_extcache_lookup(struct module_qstate* qstate, struct cachedb_env* ie)
 		qstate->env->scratch_buffer)) {
 		return 0;
 	}
+	return cachedb_extcache_parse(qstate);
+}
 
-	/* check expiry date and check if query-data matches */
-	if( !good_expiry_and_qinfo(qstate, qstate->env->scratch_buffer) ) {
+/**
+ * Start an asynchronous lookup of qstate.qinfo in extcache.
+ * return true if the lookup is in progress and the query has to wait.
+ */
+static int
+cachedb_extcache_lookup_async(struct module_qstate* qstate,
+	struct cachedb_qstate* iq, struct cachedb_env* ie, int id)
+{
+	char key[(CACHEDB_HASHSIZE/8)*2+1];
+	struct cachedb_pending* p;
+	calc_hash(qstate, key, sizeof(key));
+
+	p = (struct cachedb_pending*)calloc(1, sizeof(*p));
+	if(!p) {
+		log_err("cachedb: out of memory");
 		return 0;
 	}
-
-	/* parse dns message into return_msg */
-	if( !parse_data(qstate, qstate->env->scratch_buffer) ) {
+	p->qstate = qstate;
+	p->id = id;
+	iq->pending = p;
+	iq->lookup_found = 0;
+	if(!(*ie->backend->lookup_async)(qstate->env, ie, key, p)) {
+		/* the backend did not take it */
+		iq->pending = NULL;
+		free(p);
 		return 0;
 	}
 	return 1;
 }
 
+void
+cachedb_lookup_done(struct cachedb_pending* pending, uint8_t* data,
+	size_t data_len, int resume)
+{
+	struct module_qstate* qstate = pending->qstate;
+	struct cachedb_qstate* iq;
+	int id = pending->id;
+	free(pending);
+	if(!qstate)
+		return; /* the query was deleted while the lookup was busy */
+	iq = (struct cachedb_qstate*)qstate->minfo[id];
+	iq->pending = NULL;
+	iq->lookup_found = 0;
+	if(data) {
+		struct sldns_buffer* buf = qstate->env->scratch_buffer;
+		if(data_len > sldns_buffer_capacity(buf)) {
+			log_err("cachedb: replied data too long: %d",
+				(int)data_len);
+		} else {
+			sldns_buffer_clear(buf);
+			sldns_buffer_write(buf, data, data_len);
+			sldns_buffer_flip(buf);
+			iq->lookup_found = 1;
+		}
+	}
+	if(!resume)
+		return;
+	mesh_run(qstate->env->mesh, qstate->mesh_info, module_event_reply,
+		NULL);
+}
+
+void
+cachedb_thread_close(struct module_env* env)
+{
+	struct cachedb_env* ie;
+	int id;
+	if(!env->mesh)
+		return;
+	id = modstack_find(&env->mesh->mods, "cachedb");
+	if(id == -1)
+		return;
+	ie = (struct cachedb_env*)env->modinfo[id];
+	if(!ie || !ie->enabled || !ie->backend->thread_close)
+		return;
+	(*ie->backend->thread_close)(env, ie);
+}
+
 /**
  * Store the qstate.return_msg in extcache for key qstate.info
  */
@@ -665,6 +895,39 @@ cachedb_intcache_store(struct module_qstate* qstate)
 		qstate->region, store_flags);
 }
 
+/**
+ * Use the message found in the backend cache as the answer to the query.
+ * @param qstate: query state with the return_msg from the backend.
+ * @param ie: environment specific for this module.  global.
+ * @param id: module id.
+ */
+static void
+cachedb_extcache_found(struct module_qstate* qstate, struct cachedb_env* ie,
+	int id)
+{
+	if(verbosity >= VERB_ALGO)
+		log_dns_msg(ie->backend->name,
+			&qstate->return_msg->qinfo,
+			qstate->return_msg->rep);
+	/* store this result in internal cache */
+	cachedb_intcache_store(qstate);
+	/* In case we have expired data but there is a client timer for expired
+	 * answers, pass execution to next module in order to try updating the
+	 * data first.
+	 * TODO: this needs revisit. The expired data stored from cachedb has
+	 * 0 TTL which is picked up by iterator later when looking in the cache.
+	 * Document that ext cachedb does not work properly with
+	 * serve_stale_reply_ttl yet. */
+	if(qstate->need_refetch && qstate->serve_expired_data &&
+		qstate->serve_expired_data->timer) {
+			qstate->return_msg = NULL;
+			qstate->ext_state[id] = module_wait_module;
+			return;
+	}
+	/* we are done with the query */
+	qstate->ext_state[id] = module_finished;
+}
+
 /**
  * Handle a cachedb module event with a query
  * @param qstate: query state (from the mesh), passed between modules.
@@ -675,8 +938,7 @@ cachedb_intcache_store(struct module_qstate* qstate)
  */
 static void
 cachedb_handle_query(struct module_qstate* qstate,
-	struct cachedb_qstate* ATTR_UNUSED(iq),
-	struct cachedb_env* ie, int id)
+	struct cachedb_qstate* iq, struct cachedb_env* ie, int id)
 {
 	/* check if we are enabled, and skip if so */
 	if(!ie->enabled) {
@@ -711,28 +973,14 @@ cachedb_handle_query(struct module_qstate* qstate,
 	}
 
 	/* ask backend cache to see if we have data */
-	if(cachedb_extcache_lookup(qstate, ie)) {
-		if(verbosity >= VERB_ALGO)
-			log_dns_msg(ie->backend->name,
-				&qstate->return_msg->qinfo,
-				qstate->return_msg->rep);
-		/* store this result in internal cache */
-		cachedb_intcache_store(qstate);
-		/* In case we have expired data but there is a client timer for expired
-		 * answers, pass execution to next module in order to try updating the
-		 * data first.
-		 * TODO: this needs revisit. The expired data stored from cachedb has
-		 * 0 TTL which is picked up by iterator later when looking in the cache.
-		 * Document that ext cachedb does not work properly with
-		 * serve_stale_reply_ttl yet. */
-		if(qstate->need_refetch && qstate->serve_expired_data &&
-			qstate->serve_expired_data->timer) {
-				qstate->return_msg = NULL;
-				qstate->ext_state[id] = module_wait_module;
-				return;
+	if(ie->async_lookup) {
+		/* the answer arrives later, as a reply event */
+		if(cachedb_extcache_lookup_async(qstate, iq, ie, id)) {
+			qstate->ext_state[id] = module_wait_reply;
+			return;
 		}
-		/* we are done with the query */
-		qstate->ext_state[id] = module_finished;
+	} else if(cachedb_extcache_lookup(qstate, ie)) {
+		cachedb_extcache_found(qstate, ie, id);
 		return;
 	}
 
@@ -741,6 +989,25 @@ cachedb_handle_query(struct module_qstate* qstate,
 	qstate->ext_state[id] = module_wait_module;
 }
 
+/**
+ * Handle the completion of an asynchronous lookup in the backend cache.
+ * @param qstate: query state (from the mesh), passed between modules.
+ * @param iq: query state specific for this module.  per-query.
+ * @param ie: environment specific for this module.  global.
+ * @param id: module id.
+ */
+static void
+cachedb_handle_lookup_reply(struct module_qstate* qstate,
+	struct cachedb_qstate* iq, struct cachedb_env* ie, int id)
+{
+	if(iq->lookup_found && cachedb_extcache_parse(qstate)) {
+		cachedb_extcache_found(qstate, ie, id);
+		return;
+	}
+	/* not found in the backend, pass request to next module */
+	qstate->ext_state[id] = module_wait_module;
+}
+
 /**
  * Handle a cachedb module event with a response from the iterator.
  * @param qstate: query state (from the mesh), passed between modules.
@@ -795,6 +1062,11 @@ cachedb_operate(struct module_qstate* qstate, enum module_ev event, int id,
 		cachedb_handle_response(qstate, iq, ie, id);
 		return;
 	}
+	if(iq && event == module_event_reply && !outbound) {
+		/* the backend has completed the asynchronous lookup */
+		cachedb_handle_lookup_reply(qstate, iq, ie, id);
+		return;
+	}
 	if(iq && outbound) {
 		/* cachedb does not need to process responses at this time
 		 * ignore it.
@@ -834,7 +1106,9 @@ cachedb_clear(struct module_qstate* qstate, int id)
 	iq = (struct cachedb_qstate*)qstate->minfo[id];
 	if(iq) {
 		/* free contents of iq */
-		/* TODO */
+		/* a lookup that is still busy must not resume this query */
+		if(iq->pending)
+			iq->pending->qstate = NULL;
 	}
 	qstate->minfo[id] = NULL;
 }
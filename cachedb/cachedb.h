@@ -41,6 +41,7 @@
  */
 #include "util/module.h"
 struct cachedb_backend;
+struct cachedb_pending;
 
 /**
  * The global variable environment contents for the cachedb
@@ -56,6 +57,10 @@ struct cachedb_env {
 
 	/** backend specific data here */
 	void* backend_data;
+
+	/** if lookups use the lookup_async routine of the backend, set
+	 * by the backend init */
+	int async_lookup;
 };
 
 /**
@@ -63,6 +68,24 @@ struct cachedb_env {
  */
 struct cachedb_qstate {
 	int todo;
+	/** the outstanding asynchronous backend lookup, or NULL */
+	struct cachedb_pending* pending;
+	/** if the asynchronous lookup has completed with data in the
+	 * scratch buffer */
+	int lookup_found;
+};
+
+/**
+ * An asynchronous lookup in the backend. Allocated by cachedb and
+ * handed to the backend, that has to call cachedb_lookup_done() exactly
+ * once for it. It is malloced, because the query state can be deleted
+ * while the backend is still waiting for the answer.
+ */
+struct cachedb_pending {
+	/** the query that waits for the lookup, NULL if it was deleted */
+	struct module_qstate* qstate;
+	/** module id of cachedb */
+	int id;
 };
 
 /**
@@ -85,6 +108,18 @@ struct cachedb_backend {
 	/** Store (env, cachedb_env, key, data, data_len) */
 	void (*store)(struct module_env*, struct cachedb_env*, char*,
 		uint8_t*, size_t, time_t);
+
+	/** Lookup_async (env, cachedb_env, key, pending): start a lookup
+	 * that completes later with cachedb_lookup_done(pending, ..).
+	 * false if it cannot be started, and the caller then continues
+	 * without the external cache. Used if the init has set
+	 * async_lookup, can be NULL for synchronous backends. */
+	int (*lookup_async)(struct module_env*, struct cachedb_env*, char*,
+		struct cachedb_pending*);
+
+	/** Thread_close (env, cachedb_env): release the resources of the
+	 * calling thread, that use its event base. Can be NULL. */
+	void (*thread_close)(struct module_env*, struct cachedb_env*);
 };
 
 #define CACHEDB_HASHSIZE 256 /* bit hash */
@@ -104,6 +139,29 @@ void cachedb_clear(struct module_qstate* qstate, int id);
 /** return memory estimate for cachedb module */
 size_t cachedb_get_mem(struct module_env* env, int id);
 
+/**
+ * Called by the backend when an asynchronous lookup has completed.
+ * Resumes the query, if it still exists, and frees the pending struct.
+ * @param pending: the lookup, as passed to lookup_async.
+ * @param data: the data found for the key, NULL if nothing was found
+ *	or on failure.
+ * @param data_len: length of the data.
+ * @param resume: if false, the query is not run, but left to be deleted
+ *	by the caller; this is used when the thread is shutting down.
+ */
+void cachedb_lookup_done(struct cachedb_pending* pending, uint8_t* data,
+	size_t data_len, int resume);
+
+/**
+ * Close the per-thread external cache resources of the calling thread.
+ * Call this before the thread's event base is deleted.
+ * @param env: module environment of the thread, with the mesh.
+ */
+void cachedb_thread_close(struct module_env* env);
+
+/** callback for the timer that completes the async testframe lookups */
+void testframe_async_timer_cb(void* arg);
+
 /**
  * Get the function block with pointers to the cachedb functions
  * @return the function block for "cachedb".
@@ -46,22 +46,77 @@
 #include "cachedb/cachedb.h"
 #include "util/alloc.h"
 #include "util/config_file.h"
+#include "util/netevent.h"
+#include "util/ub_event.h"
 #include "sldns/sbuffer.h"
 
 #ifdef USE_REDIS
 #include "hiredis/hiredis.h"
+#include "hiredis/async.h"
+
+/** the first wait, in seconds, before a failed connection is retried */
+#define REDIS_RECONNECT_BACKOFF_MIN 1
+/** the wait before a reconnect doubles for every failure, up to this */
+#define REDIS_RECONNECT_BACKOFF_MAX 64
+
+/**
+ * Per-thread asynchronous connection to the redis server. The commands
+ * of one event loop iteration are written to the server together, and
+ * the replies come back in order.
+ */
+struct redis_async_conn {
+	/** the hiredis context, NULL if not connected */
+	redisAsyncContext* ac;
+	/** event for the socket of the connection */
+	struct ub_event* ev;
+	/** the read and write interest of hiredis, UB_EV_READ|UB_EV_WRITE */
+	short ev_bits;
+	/** timer that closes the connection if the server stops answering */
+	struct comm_timer* timer;
+	/** number of lookups that wait for a reply */
+	size_t num_pending;
+	/** if the thread is shutting down, do not resume queries */
+	int closing;
+	/** the event base of the thread that owns the connection */
+	struct comm_base* base;
+	/** the module data */
+	struct redis_moddata* moddata;
+	/** the time of the thread */
+	time_t* now;
+	/** do not reconnect before this time */
+	time_t retry_time;
+	/** the wait before the next reconnect, in seconds */
+	time_t backoff;
+};
 
 struct redis_moddata {
 	redisContext** ctxs;	/* thread-specific redis contexts */
+	time_t* retry_times;	/* per thread: no reconnect before this */
+	time_t* backoffs;	/* per thread: the reconnect wait */
+	struct redis_async_conn* aconns; /* thread-specific async conns */
 	int numctxs;		/* number of ctx entries */
 	const char* server_host; /* server's IP address or host name */
 	int server_port;	 /* server's TCP port */
 	struct timeval timeout;	 /* timeout for connection setup and commands */
+	int async;		 /* if lookups use the async connections */
 };
 
 static redisReply* redis_command(struct module_env*, struct cachedb_env*,
 	const char*, const uint8_t*, size_t);
 
+/** a connection has failed, wait longer before the next attempt */
+static void
+redis_backoff(time_t now, time_t* retry_time, time_t* backoff)
+{
+	if(*backoff < REDIS_RECONNECT_BACKOFF_MIN)
+		*backoff = REDIS_RECONNECT_BACKOFF_MIN;
+	*retry_time = now + *backoff;
+	verbose(VERB_ALGO, "redis: reconnect in %d seconds", (int)*backoff);
+	*backoff *= 2;
+	if(*backoff > REDIS_RECONNECT_BACKOFF_MAX)
+		*backoff = REDIS_RECONNECT_BACKOFF_MAX;
+}
+
 static redisContext*
 redis_connect(const struct redis_moddata* moddata)
 {
@@ -103,20 +158,45 @@ redis_init(struct module_env* env, struct cachedb_env* cachedb_env)
 	}
 	moddata->numctxs = env->cfg->num_threads;
 	moddata->ctxs = calloc(env->cfg->num_threads, sizeof(redisContext*));
-	if(!moddata->ctxs) {
+	moddata->retry_times = calloc(env->cfg->num_threads, sizeof(time_t));
+	moddata->backoffs = calloc(env->cfg->num_threads, sizeof(time_t));
+	if(!moddata->ctxs || !moddata->retry_times || !moddata->backoffs) {
 		log_err("out of memory");
+		free(moddata->ctxs);
+		free(moddata->retry_times);
+		free(moddata->backoffs);
 		free(moddata);
 		return 0;
 	}
+	if(env->cfg->redis_async) {
+		moddata->aconns = calloc(env->cfg->num_threads,
+			sizeof(struct redis_async_conn));
+		if(!moddata->aconns) {
+			log_err("out of memory");
+			free(moddata->ctxs);
+			free(moddata->retry_times);
+			free(moddata->backoffs);
+			free(moddata);
+			return 0;
+		}
+		for(i = 0; i < moddata->numctxs; i++)
+			moddata->aconns[i].moddata = moddata;
+		moddata->async = 1;
+	}
 	/* note: server_host is a shallow reference to configured string.
 	 * we don't have to free it in this module. */
 	moddata->server_host = env->cfg->redis_server_host;
 	moddata->server_port = env->cfg->redis_server_port;
 	moddata->timeout.tv_sec = env->cfg->redis_timeout / 1000;
 	moddata->timeout.tv_usec = (env->cfg->redis_timeout % 1000) * 1000;
-	for(i = 0; i < moddata->numctxs; i++)
-		moddata->ctxs[i] = redis_connect(moddata);
+	/* with async lookups, the connections are made by the threads
+	 * themselves, on their event bases */
+	if(!moddata->async) {
+		for(i = 0; i < moddata->numctxs; i++)
+			moddata->ctxs[i] = redis_connect(moddata);
+	}
 	cachedb_env->backend_data = moddata;
+	cachedb_env->async_lookup = moddata->async;
 	if(env->cfg->redis_expire_records) {
 		redisReply* rep = NULL;
 		int redis_reply_type = 0;
@@ -143,6 +223,14 @@ redis_init(struct module_env* env, struct cachedb_env* cachedb_env)
 			return 0;
 		}
 	}
+	if(moddata->async) {
+		/* the synchronous connection was only needed for the check */
+		for(i = 0; i < moddata->numctxs; i++) {
+			if(moddata->ctxs[i])
+				redisFree(moddata->ctxs[i]);
+			moddata->ctxs[i] = NULL;
+		}
+	}
 
 	return 1;
 }
@@ -166,6 +254,11 @@ redis_deinit(struct module_env* env, struct cachedb_env* cachedb_env)
 		}
 		free(moddata->ctxs);
 	}
+	/* the async connections are closed by the threads, with
+	 * redis_thread_close, they are bound to the thread event bases */
+	free(moddata->aconns);
+	free(moddata->retry_times);
+	free(moddata->backoffs);
 	free(moddata);
 }
 
@@ -202,11 +295,19 @@ redis_command(struct module_env* env, struct cachedb_env* cachedb_env,
 	 * it on a failure, try to re-establish a new one.   Failures will be
 	 * logged in redis_connect(). */
 	if(!ctx) {
+		/* do not stall every query on a server that is down */
+		if(*env->now < d->retry_times[env->alloc->thread_num])
+			return NULL;
 		ctx = redis_connect(d);
 		d->ctxs[env->alloc->thread_num] = ctx;
+		if(!ctx) {
+			redis_backoff(*env->now,
+				&d->retry_times[env->alloc->thread_num],
+				&d->backoffs[env->alloc->thread_num]);
+			return NULL;
+		}
+		d->backoffs[env->alloc->thread_num] = 0;
 	}
-	if(!ctx)
-		return NULL;
 
 	/* Send the command and get a reply, synchronously. */
 	rep = (redisReply*)redisCommand(ctx, command, data, data_len);
@@ -217,6 +318,8 @@ redis_command(struct module_env* env, struct cachedb_env* cachedb_env,
 			"closing connection: %s", ctx->errstr);
 		redisFree(ctx);
 		d->ctxs[env->alloc->thread_num] = NULL;
+		redis_backoff(*env->now, &d->retry_times[env->alloc->thread_num],
+			&d->backoffs[env->alloc->thread_num]);
 		return NULL;
 	}
 
@@ -277,6 +380,308 @@ redis_lookup(struct module_env* env, struct cachedb_env* cachedb_env,
 	return ret;
 }
 
+/** set the event interest of the async connection to the given bits */
+static void
+redis_async_update_ev(struct redis_async_conn* conn, short bits)
+{
+	if(!conn->ev || bits == conn->ev_bits)
+		return;
+	ub_event_del(conn->ev);
+	ub_event_del_bits(conn->ev, UB_EV_READ|UB_EV_WRITE);
+	ub_event_add_bits(conn->ev, bits);
+	conn->ev_bits = bits;
+	if(bits && ub_event_add(conn->ev, NULL) != 0)
+		log_err("redis: could not ub_event_add");
+}
+
+/** hiredis event hook: wants to read */
+static void
+redis_async_add_read(void* arg)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)arg;
+	redis_async_update_ev(conn, conn->ev_bits | UB_EV_READ);
+}
+
+/** hiredis event hook: no longer wants to read */
+static void
+redis_async_del_read(void* arg)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)arg;
+	redis_async_update_ev(conn, conn->ev_bits & ~UB_EV_READ);
+}
+
+/** hiredis event hook: has data to write */
+static void
+redis_async_add_write(void* arg)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)arg;
+	redis_async_update_ev(conn, conn->ev_bits | UB_EV_WRITE);
+}
+
+/** hiredis event hook: has nothing to write */
+static void
+redis_async_del_write(void* arg)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)arg;
+	redis_async_update_ev(conn, conn->ev_bits & ~UB_EV_WRITE);
+}
+
+/** hiredis event hook: the context is freed */
+static void
+redis_async_cleanup(void* arg)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)arg;
+	if(conn->ev) {
+		ub_event_del(conn->ev);
+		ub_event_free(conn->ev);
+		conn->ev = NULL;
+	}
+	conn->ev_bits = 0;
+}
+
+void
+redis_async_event_cb(int ATTR_UNUSED(fd), short bits, void* arg)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)arg;
+	/* a handler can close the connection, check it again */
+	if((bits&UB_EV_READ) && conn->ac)
+		redisAsyncHandleRead(conn->ac);
+	if((bits&UB_EV_WRITE) && conn->ac)
+		redisAsyncHandleWrite(conn->ac);
+}
+
+/** start or stop the timer, for the lookups that wait on the server */
+static void
+redis_async_set_timer(struct redis_async_conn* conn)
+{
+	if(!conn->timer)
+		return;
+	if(conn->num_pending == 0) {
+		comm_timer_disable(conn->timer);
+		return;
+	}
+	comm_timer_set(conn->timer, &conn->moddata->timeout);
+}
+
+/** close the async connection, the waiting lookups fail */
+static void
+redis_async_close(struct redis_async_conn* conn)
+{
+	redisAsyncContext* ac = conn->ac;
+	if(!ac)
+		return;
+	/* detach first; the lookup callbacks resume queries that can
+	 * try to use the connection again */
+	conn->ac = NULL;
+	redisAsyncFree(ac);
+}
+
+void
+redis_async_timer_cb(void* arg)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)arg;
+	log_err("redis: timeout waiting for %d replies, closing connection",
+		(int)conn->num_pending);
+	redis_backoff(*conn->now, &conn->retry_time, &conn->backoff);
+	redis_async_close(conn);
+}
+
+/** attach the hiredis context to the event base of the thread */
+static int
+redis_async_attach(struct redis_async_conn* conn, redisAsyncContext* ac)
+{
+	conn->ev = ub_event_new(comm_base_internal(conn->base), ac->c.fd,
+		UB_EV_PERSIST, redis_async_event_cb, conn);
+	if(!conn->ev) {
+		log_err("redis: could not create event");
+		return 0;
+	}
+	conn->ev_bits = 0;
+	ac->ev.data = conn;
+	ac->ev.addRead = redis_async_add_read;
+	ac->ev.delRead = redis_async_del_read;
+	ac->ev.addWrite = redis_async_add_write;
+	ac->ev.delWrite = redis_async_del_write;
+	ac->ev.cleanup = redis_async_cleanup;
+	return 1;
+}
+
+/** hiredis callback: the connection is established, or failed */
+static void
+redis_async_connect_cb(const redisAsyncContext* ac, int status)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)ac->data;
+	if(status != REDIS_OK) {
+		/* hiredis frees the context after this callback */
+		log_err("failed to connect to redis server: %s", ac->errstr);
+		if(conn->ac == ac)
+			conn->ac = NULL;
+		redis_backoff(*conn->now, &conn->retry_time, &conn->backoff);
+		return;
+	}
+	verbose(VERB_ALGO, "redis: connected to server");
+	conn->backoff = 0;
+}
+
+/** hiredis callback: the connection is closed */
+static void
+redis_async_disconnect_cb(const redisAsyncContext* ac, int status)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)ac->data;
+	if(conn->ac == ac)
+		conn->ac = NULL;
+	if(status != REDIS_OK) {
+		log_err("redis: connection closed: %s", ac->errstr);
+		redis_backoff(*conn->now, &conn->retry_time, &conn->backoff);
+	}
+}
+
+/**
+ * Get the async connection of this thread, connects if needed.
+ * Returns NULL if there is no connection, and none can be made now.
+ */
+static struct redis_async_conn*
+redis_async_get(struct module_env* env, struct redis_moddata* d)
+{
+	struct redis_async_conn* conn;
+	redisAsyncContext* ac;
+
+	log_assert(env->alloc->thread_num < d->numctxs);
+	conn = &d->aconns[env->alloc->thread_num];
+	if(conn->ac)
+		return conn;
+	if(conn->closing || !env->worker_base)
+		return NULL;
+	if(*env->now < conn->retry_time)
+		return NULL;
+	conn->now = env->now;
+	conn->base = env->worker_base;
+	if(!conn->timer) {
+		conn->timer = comm_timer_create(conn->base,
+			redis_async_timer_cb, conn);
+		if(!conn->timer) {
+			log_err("redis: out of memory");
+			return NULL;
+		}
+	}
+
+	ac = redisAsyncConnect(d->server_host, d->server_port);
+	if(!ac || ac->err) {
+		log_err("failed to connect to redis server: %s",
+			ac?ac->errstr:"out of memory");
+		if(ac)
+			redisAsyncFree(ac);
+		redis_backoff(*env->now, &conn->retry_time, &conn->backoff);
+		return NULL;
+	}
+	ac->data = conn;
+	if(!redis_async_attach(conn, ac)) {
+		redisAsyncFree(ac);
+		redis_backoff(*env->now, &conn->retry_time, &conn->backoff);
+		return NULL;
+	}
+	redisAsyncSetConnectCallback(ac, redis_async_connect_cb);
+	redisAsyncSetDisconnectCallback(ac, redis_async_disconnect_cb);
+	conn->ac = ac;
+	return conn;
+}
+
+/** hiredis callback: the reply for a lookup, NULL if the connection
+ * closed before it arrived */
+static void
+redis_async_lookup_cb(redisAsyncContext* ac, void* r, void* privdata)
+{
+	struct redis_async_conn* conn = (struct redis_async_conn*)ac->data;
+	struct cachedb_pending* pending = (struct cachedb_pending*)privdata;
+	redisReply* rep = (redisReply*)r;
+	uint8_t* data = NULL;
+	size_t data_len = 0;
+
+	if(conn->num_pending > 0)
+		conn->num_pending--;
+	/* the server is making progress, restart the timeout */
+	redis_async_set_timer(conn);
+	if(!rep) {
+		verbose(VERB_ALGO, "redis_lookup: no reply, connection closed");
+	} else switch(rep->type) {
+	case REDIS_REPLY_NIL:
+		verbose(VERB_ALGO, "redis_lookup: no data cached");
+		break;
+	case REDIS_REPLY_STRING:
+		verbose(VERB_ALGO, "redis_lookup found %d bytes",
+			(int)rep->len);
+		data = (uint8_t*)rep->str;
+		data_len = (size_t)rep->len;
+		break;
+	case REDIS_REPLY_ERROR:
+		log_err("redis: get resulted in an error: %s", rep->str);
+		break;
+	default:
+		log_err("redis_lookup: unexpected type of reply for (%d)",
+			rep->type);
+		break;
+	}
+	/* hiredis frees the reply after the callback, the data is
+	 * copied for the query */
+	cachedb_lookup_done(pending, data, data_len, !conn->closing);
+}
+
+static int
+redis_lookup_async(struct module_env* env, struct cachedb_env* cachedb_env,
+	char* key, struct cachedb_pending* pending)
+{
+	struct redis_moddata* d = (struct redis_moddata*)
+		cachedb_env->backend_data;
+	struct redis_async_conn* conn;
+
+	verbose(VERB_ALGO, "redis_lookup_async of %s", key);
+	conn = redis_async_get(env, d);
+	if(!conn)
+		return 0;
+	/* this is written to the server together with the other commands
+	 * of this event loop iteration */
+	if(redisAsyncCommand(conn->ac, redis_async_lookup_cb, pending,
+		"GET %s", key) != REDIS_OK) {
+		log_err("redis_lookup_async: could not send command");
+		return 0;
+	}
+	if(conn->num_pending++ == 0)
+		redis_async_set_timer(conn);
+	return 1;
+}
+
+/** send a store command on the async connection, without a callback */
+static void
+redis_async_store(struct module_env* env, struct cachedb_env* cachedb_env,
+	const char* command, uint8_t* data, size_t data_len)
+{
+	struct redis_moddata* d = (struct redis_moddata*)
+		cachedb_env->backend_data;
+	struct redis_async_conn* conn = redis_async_get(env, d);
+	if(!conn)
+		return;
+	if(redisAsyncCommand(conn->ac, NULL, NULL, command, data,
+		data_len) != REDIS_OK)
+		log_err("redis_store: could not send command");
+}
+
+static void
+redis_thread_close(struct module_env* env, struct cachedb_env* cachedb_env)
+{
+	struct redis_moddata* d = (struct redis_moddata*)
+		cachedb_env->backend_data;
+	struct redis_async_conn* conn;
+	if(!d || !d->async)
+		return;
+	log_assert(env->alloc->thread_num < d->numctxs);
+	conn = &d->aconns[env->alloc->thread_num];
+	/* the waiting queries are deleted by the caller */
+	conn->closing = 1;
+	redis_async_close(conn);
+	comm_timer_delete(conn->timer);
+	conn->timer = NULL;
+}
+
 static void
 redis_store(struct module_env* env, struct cachedb_env* cachedb_env,
 	char* key, uint8_t* data, size_t data_len, time_t ttl)
@@ -311,6 +716,13 @@ redis_store(struct module_env* env, struct cachedb_env* cachedb_env,
 		return;
 	}
 
+	if(((struct redis_moddata*)cachedb_env->backend_data)->async) {
+		/* sent along with the other commands of this event loop
+		 * iteration, the reply is not waited for */
+		redis_async_store(env, cachedb_env, cmdbuf, data, data_len);
+		return;
+	}
+
 	rep = redis_command(env, cachedb_env, cmdbuf, data, data_len);
 	if(rep) {
 		verbose(VERB_ALGO, "redis_store set completed");
@@ -324,7 +736,8 @@ redis_store(struct module_env* env, struct cachedb_env* cachedb_env,
 }
 
 struct cachedb_backend redis_backend = { "redis",
-	redis_init, redis_deinit, redis_lookup, redis_store
+	redis_init, redis_deinit, redis_lookup, redis_store,
+	redis_lookup_async, redis_thread_close
 };
 #endif	/* USE_REDIS */
 #endif /* USE_CACHEDB */
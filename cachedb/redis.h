@@ -43,3 +43,9 @@
 /** the redis backend definition, contains callable functions
  * and name string */
 extern struct cachedb_backend redis_backend;
+
+/** callback for the socket events of an async redis connection */
+void redis_async_event_cb(int fd, short bits, void* arg);
+
+/** callback for the reply timeout of an async redis connection */
+void redis_async_timer_cb(void* arg);
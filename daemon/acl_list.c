@@ -83,6 +83,7 @@ acl_list_insert(struct acl_list* acl, struct sockaddr_storage* addr,
 	if(!node)
 		return NULL;
 	node->control = control;
+	node->pclass = -1;
 	if(!addr_tree_insert(&acl->tree, &node->node, addr, addrlen, net)) {
 		if(complain_duplicates)
 			verbose(VERB_QUERY, "duplicate acl address ignored.");
@@ -189,6 +190,22 @@ acl_list_view_cfg(struct acl_list* acl, const char* str, const char* str2,
 	return 1;
 }
 
+/** apply acl_priority_class string */
+static int
+acl_list_pclass_cfg(struct acl_list* acl, struct config_file* cfg,
+	const char* str, const char* str2)
+{
+	struct acl_addr* node;
+	if(!(node=acl_find_or_create(acl, str)))
+		return 0;
+	node->pclass = find_priority_class(cfg, str2);
+	if(node->pclass == -1) {
+		log_err("no priority class with name: %s", str2);
+		return 0;
+	}
+	return 1;
+}
+
 /** apply acl_tag_action string */
 static int
 acl_list_tag_action_cfg(struct acl_list* acl, struct config_file* cfg,
@@ -384,6 +401,28 @@ read_acl_view(struct acl_list* acl, struct config_file* cfg, struct views* v)
 	return 1;
 }
 
+/** read acl priority class config */
+static int
+read_acl_pclass(struct acl_list* acl, struct config_file* cfg)
+{
+	struct config_str2list* np, *p = cfg->acl_priority_class;
+	cfg->acl_priority_class = NULL;
+	while(p) {
+		log_assert(p->str && p->str2);
+		if(!acl_list_pclass_cfg(acl, cfg, p->str, p->str2)) {
+			config_deldblstrlist(p);
+			return 0;
+		}
+		/* free the items as we go to free up memory */
+		np = p->next;
+		free(p->str);
+		free(p->str2);
+		free(p);
+		p = np;
+	}
+	return 1;
+}
+
 /** read acl tag actions config */
 static int 
 read_acl_tag_actions(struct acl_list* acl, struct config_file* cfg)
@@ -443,6 +482,8 @@ acl_list_apply_cfg(struct acl_list* acl, struct config_file* cfg,
 		return 0;
 	if(!read_acl_view(acl, cfg, v))
 		return 0;
+	if(!read_acl_pclass(acl, cfg))
+		return 0;
 	if(!read_acl_tags(acl, cfg))
 		return 0;
 	if(!read_acl_tag_actions(acl, cfg))
@@ -105,6 +105,8 @@ struct acl_addr {
 	size_t tag_datas_size;
 	/* view element, NULL if none */
 	struct view* view;
+	/** priority class of the queries, -1 for the client class */
+	int pclass;
 };
 
 /**
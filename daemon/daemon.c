@@ -81,6 +81,7 @@
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
+#include "services/cache/snapshot.h"
 #include "services/localzone.h"
 #include "services/view.h"
 #include "services/modstack.h"
@@ -89,9 +90,19 @@
 #include "util/random.h"
 #include "util/tube.h"
 #include "util/net_help.h"
+#include "util/ub_event.h"
 #include "sldns/keyraw.h"
 #include "respip/respip.h"
+#include "validator/val_pool.h"
+#include "services/inflight.h"
+#include "services/outnet_pool.h"
 #include <signal.h>
+#ifdef HAVE_SCHED_SETAFFINITY
+#include <sched.h>
+#endif
+#ifdef HAVE_GLOB_H
+#include <glob.h>
+#endif
 
 #ifdef HAVE_SYSTEMD
 #include <systemd/sd-daemon.h>
@@ -191,6 +202,84 @@ signal_handling_playback(struct worker* wrk)
 	sig_record_reload = 0;
 }
 
+/** the highest NUMA node number that is used, entries store it in a byte */
+#define DAEMON_NODE_MAX 255
+
+/**
+ * Get the NUMA node of a CPU, from the node link in its sysfs directory.
+ * @param cpu: the CPU number.
+ * @return the node, 0 if not known.
+ */
+static int
+daemon_cpu_node(int cpu)
+{
+	int node = 0;
+#if defined(HAVE_GLOB) && defined(HAVE_GLOB_H)
+	char pat[128];
+	const char* nm;
+	glob_t g;
+	snprintf(pat, sizeof(pat), "/sys/devices/system/cpu/cpu%d/node[0-9]*",
+		cpu);
+	memset(&g, 0, sizeof(g));
+	if(glob(pat, 0, NULL, &g) != 0) {
+		globfree(&g);
+		return 0;
+	}
+	if(g.gl_pathc > 0 && (nm = strrchr(g.gl_pathv[0], '/')) != NULL)
+		node = atoi(nm + 5);
+	globfree(&g);
+	if(node < 0 || node > DAEMON_NODE_MAX)
+		node = 0;
+#else
+	(void)cpu;
+#endif
+	return node;
+}
+
+/**
+ * Get the CPUs that the daemon is allowed to run on, before the threads
+ * are pinned to them, and the NUMA nodes of the CPUs.
+ * @param daemon: the daemon.
+ */
+static void
+daemon_init_cpus(struct daemon* daemon)
+{
+#ifdef HAVE_SCHED_SETAFFINITY
+	cpu_set_t set;
+	int i, n;
+	CPU_ZERO(&set);
+	if(sched_getaffinity(0, sizeof(set), &set) < 0) {
+		log_err("sched_getaffinity: %s", strerror(errno));
+		return;
+	}
+	n = CPU_COUNT(&set);
+	if(n <= 0 || !(daemon->cpus = (int*)calloc((size_t)n, sizeof(int))))
+		return;
+	for(i=0; i<CPU_SETSIZE && daemon->num_cpus<n; i++)
+		if(CPU_ISSET(i, &set))
+			daemon->cpus[daemon->num_cpus++] = i;
+	if(!(daemon->cpu_nodes = (int*)calloc((size_t)daemon->num_cpus,
+		sizeof(int))))
+		return;
+	for(i=0; i<daemon->num_cpus; i++) {
+		daemon->cpu_nodes[i] = daemon_cpu_node(daemon->cpus[i]);
+		if(daemon->cpu_nodes[i] >= daemon->num_nodes)
+			daemon->num_nodes = daemon->cpu_nodes[i] + 1;
+	}
+	if(daemon->num_nodes < 2)
+		return;
+	if(!(daemon->nodealloc = (struct alloc_cache*)calloc((size_t)
+		daemon->num_nodes, sizeof(struct alloc_cache)))) {
+		daemon->num_nodes = 1;
+		return;
+	}
+	for(i=0; i<daemon->num_nodes; i++)
+		alloc_init(&daemon->nodealloc[i], NULL, 0);
+#else
+	(void)daemon;
+#endif
+}
+
 struct daemon* 
 daemon_init(void)
 {
@@ -300,9 +389,222 @@ daemon_init(void)
 		free(daemon);
 		return NULL;
 	}
+	daemon_init_cpus(daemon);
 	return daemon;	
 }
 
+/**
+ * Get the NUMA node for a thread, with numa-aware the threads are spread
+ * over the nodes that have CPUs.
+ * @param daemon: the daemon.
+ * @param thread_num: number of the thread.
+ * @return the node.
+ */
+static int
+daemon_thread_node(struct daemon* daemon, int thread_num)
+{
+	int i, k, m = 0, want;
+	if(!daemon->numa)
+		return 0;
+	for(k=0; k<daemon->num_nodes; k++) {
+		for(i=0; i<daemon->num_cpus; i++)
+			if(daemon->cpu_nodes[i] == k)
+				break;
+		if(i < daemon->num_cpus)
+			m++;
+	}
+	want = thread_num % m;
+	for(k=0; k<daemon->num_nodes; k++) {
+		for(i=0; i<daemon->num_cpus; i++)
+			if(daemon->cpu_nodes[i] == k)
+				break;
+		if(i == daemon->num_cpus)
+			continue;
+		if(want-- == 0)
+			return k;
+	}
+	return 0;
+}
+
+/**
+ * Get the CPU for a thread, the index in the cpus array.  With numa-aware,
+ * the threads of a node get the CPUs of that node in turn.
+ * @param daemon: the daemon, with CPUs.
+ * @param thread_num: number of the thread.
+ * @return the index of the CPU.
+ */
+static int
+daemon_thread_cpu(struct daemon* daemon, int thread_num)
+{
+	int i, k, node, m = 0, want, count = 0;
+	if(!daemon->numa)
+		return thread_num % daemon->num_cpus;
+	node = daemon_thread_node(daemon, thread_num);
+	/* the number of nodes with CPUs, the thread is the nth on its node */
+	for(k=0; k<daemon->num_nodes; k++) {
+		for(i=0; i<daemon->num_cpus; i++)
+			if(daemon->cpu_nodes[i] == k)
+				break;
+		if(i < daemon->num_cpus)
+			m++;
+	}
+	for(i=0; i<daemon->num_cpus; i++)
+		if(daemon->cpu_nodes[i] == node)
+			count++;
+	want = (thread_num / m) % count;
+	for(i=0; i<daemon->num_cpus; i++)
+		if(daemon->cpu_nodes[i] == node && want-- == 0)
+			return i;
+	return 0;
+}
+
+/**
+ * Pin the thread that calls it to its CPU, with worker-cpu-affinity, or
+ * bind it to the CPUs of its NUMA node, with numa-aware.
+ * The thread allocates its buffers and caches after this, so the memory
+ * is on the NUMA node of the CPU.
+ * @param daemon: the daemon.
+ * @param thread_num: number of the thread.
+ */
+static void
+daemon_pin_cpu(struct daemon* daemon, int thread_num)
+{
+#ifdef HAVE_SCHED_SETAFFINITY
+	cpu_set_t set;
+	int i, cpu = -1, node = 0;
+	if((!daemon->cfg->worker_cpu_affinity && !daemon->numa) ||
+		daemon->num_cpus == 0)
+		return;
+	CPU_ZERO(&set);
+	if(daemon->cfg->worker_cpu_affinity) {
+		cpu = daemon->cpus[daemon_thread_cpu(daemon, thread_num)];
+		CPU_SET(cpu, &set);
+	} else {
+		node = daemon_thread_node(daemon, thread_num);
+		for(i=0; i<daemon->num_cpus; i++)
+			if(daemon->cpu_nodes[i] == node)
+				CPU_SET(daemon->cpus[i], &set);
+	}
+	if(sched_setaffinity(0, sizeof(set), &set) < 0) {
+		log_err("sched_setaffinity: %s", strerror(errno));
+		return;
+	}
+	if(thread_num == 0)
+		daemon->cpu_pinned = 1;
+	if(cpu != -1)
+		verbose(VERB_ALGO, "thread %d is pinned to CPU %d",
+			thread_num, cpu);
+	else	verbose(VERB_ALGO, "thread %d is bound to NUMA node %d",
+			thread_num, node);
+#else
+	(void)daemon;
+	(void)thread_num;
+#endif
+}
+
+/**
+ * Set the NUMA node of the thread that calls it, for the cache entries
+ * that it stores, and bind it to the CPUs.
+ * @param daemon: the daemon.
+ * @param worker: the worker of the thread.
+ */
+static void
+daemon_thread_setup(struct daemon* daemon, struct worker* worker)
+{
+	worker->node = daemon_thread_node(daemon, worker->thread_num);
+	lruhash_thread_node_set(&worker->node);
+	daemon_pin_cpu(daemon, worker->thread_num);
+}
+
+/**
+ * Use the NUMA nodes for the threads, if numa-aware is enabled and
+ * there are nodes.  The released rrset keys go back to their node.
+ * @param daemon: the daemon.
+ */
+static void
+daemon_setup_numa(struct daemon* daemon)
+{
+	daemon->numa = 0;
+	if(daemon->cfg->numa_aware) {
+		if(daemon->num_nodes > 1 && daemon->nodealloc) {
+			daemon->numa = 1;
+			lruhash_thread_node_init();
+			verbose(VERB_OPS, "numa-aware: the threads are spread "
+				"over %d NUMA nodes", daemon->num_nodes);
+		} else {
+			verbose(VERB_OPS, "numa-aware: there is one NUMA node, "
+				"it is not used");
+		}
+	}
+	if(daemon->numa)
+		alloc_set_node(&daemon->superalloc, 0, daemon->nodealloc,
+			daemon->num_nodes);
+	else	alloc_set_node(&daemon->superalloc, 0, NULL, 0);
+}
+
+/**
+ * Have the main thread run on all the CPUs again, if it was pinned, so
+ * that the threads that it starts are not on its CPU.
+ * @param daemon: the daemon.
+ */
+static void
+daemon_unpin_cpu(struct daemon* daemon)
+{
+#ifdef HAVE_SCHED_SETAFFINITY
+	cpu_set_t set;
+	int i;
+	if(!daemon->cpu_pinned)
+		return;
+	CPU_ZERO(&set);
+	for(i=0; i<daemon->num_cpus; i++)
+		CPU_SET(daemon->cpus[i], &set);
+	if(sched_setaffinity(0, sizeof(set), &set) < 0)
+		log_err("sched_setaffinity: %s", strerror(errno));
+	daemon->cpu_pinned = 0;
+#else
+	(void)daemon;
+#endif
+}
+
+/**
+ * Steer the queries on the reuseport sockets to the thread on the CPU
+ * that received them, or remove that if worker-cpu-affinity is off.
+ * The sockets of a reuseport group are opened in the order of the threads.
+ * @param daemon: the daemon.
+ */
+static void
+daemon_steer_cpu(struct daemon* daemon)
+{
+	int* cpus;
+	size_t i;
+	if(!daemon->cfg->worker_cpu_affinity || daemon->num_cpus == 0) {
+		if(daemon->cpu_steered)
+			(void)listening_ports_steer_cpu(daemon->ports[0],
+				NULL, 0);
+		daemon->cpu_steered = 0;
+		return;
+	}
+	if(daemon->num_ports < 2) {
+		if(daemon->cfg->num_threads > 1)
+			log_warn("worker-cpu-affinity: so-reuseport is not in "
+				"use, the queries are not steered to the CPUs");
+		return;
+	}
+	if(!(cpus = (int*)calloc(daemon->num_ports, sizeof(int)))) {
+		log_err("worker-cpu-affinity: out of memory");
+		return;
+	}
+	for(i=0; i<daemon->num_ports; i++)
+		cpus[i] = daemon->cpus[daemon_thread_cpu(daemon, (int)i)];
+	if(listening_ports_steer_cpu(daemon->ports[0], cpus,
+		(int)daemon->num_ports)) {
+		daemon->cpu_steered = 1;
+		verbose(VERB_OPS, "the queries are steered to %d threads "
+			"on their CPUs", (int)daemon->num_ports);
+	}
+	free(cpus);
+}
+
 int 
 daemon_open_shared_ports(struct daemon* daemon)
 {
@@ -433,6 +735,23 @@ static int daemon_get_shufport(struct daemon* daemon, int* shufport)
 	return avail;
 }
 
+/**
+ * Create the daemon random generator if it does not exist yet, and seed
+ * the hash functions with it.  The hash seed has to be fixed before any
+ * element is hashed into the caches.
+ * @param daemon: the daemon.
+ */
+static void
+daemon_create_rand(struct daemon* daemon)
+{
+	if(daemon->rand)
+		return;
+	daemon->rand = ub_initstate(NULL);
+	if(!daemon->rand)
+		fatal_exit("could not init random generator");
+	hash_set_raninit((uint32_t)ub_random(daemon->rand));
+}
+
 /**
  * Allocate empty worker structures. With backptr and thread-number,
  * from 0..numthread initialised. Used as user arguments to new threads.
@@ -446,12 +765,7 @@ daemon_create_workers(struct daemon* daemon)
 	int i, numport;
 	int* shufport;
 	log_assert(daemon && daemon->cfg);
-	if(!daemon->rand) {
-		daemon->rand = ub_initstate(NULL);
-		if(!daemon->rand)
-			fatal_exit("could not init random generator");
-		hash_set_raninit((uint32_t)ub_random(daemon->rand));
-	}
+	daemon_create_rand(daemon);
 	shufport = (int*)calloc(65536, sizeof(int));
 	if(!shufport)
 		fatal_exit("out of memory during daemon init");
@@ -534,6 +848,7 @@ thread_start(void* arg)
 	else
 		port_num = 0;
 #endif
+	daemon_thread_setup(worker->daemon, worker);
 	if(!worker_init(worker, worker->daemon->cfg,
 			worker->daemon->ports[port_num], 0))
 		fatal_exit("Could not initialize thread");
@@ -587,6 +902,22 @@ daemon_stop_others(struct daemon* daemon)
 	}
 }
 
+/**
+ * See if there are auth zones that are transferred from a master, or
+ * downloaded from a URL.
+ * @param cfg: the config.
+ * @return true if so.
+ */
+static int
+daemon_has_xfr_zones(struct config_file* cfg)
+{
+	struct config_auth* p;
+	for(p = cfg->auths; p; p = p->next)
+		if(p->masters || p->urls)
+			return 1;
+	return 0;
+}
+
 void 
 daemon_fork(struct daemon* daemon)
 {
@@ -596,6 +927,14 @@ daemon_fork(struct daemon* daemon)
 #endif
 
 	log_assert(daemon);
+	/* the threads that are created here do not inherit the CPU of
+	 * the main thread */
+	daemon_unpin_cpu(daemon);
+	daemon_setup_numa(daemon);
+	/* the event bases of the threads are created after this */
+	if(!ub_event_use_io_uring(daemon->cfg->use_io_uring))
+		log_warn("use-io-uring: io_uring is not available, using "
+			"the compiled in event base");
 	if(!(daemon->views = views_create()))
 		fatal_exit("Could not create views: out of memory");
 	/* create individual views and their localzone/data trees */
@@ -606,6 +945,7 @@ daemon_fork(struct daemon* daemon)
 		fatal_exit("Could not setup access control list");
 	if(!tcl_list_apply_cfg(daemon->tcl, daemon->cfg))
 		fatal_exit("Could not setup TCP connection limits");
+	daemon_steer_cpu(daemon);
 	if(daemon->cfg->dnscrypt) {
 #ifdef USE_DNSCRYPT
 		daemon->dnscenv = dnsc_create();
@@ -620,6 +960,9 @@ daemon_fork(struct daemon* daemon)
 	/* create global local_zones */
 	if(!(daemon->local_zones = local_zones_create()))
 		fatal_exit("Could not create local zones: out of memory");
+	if(!local_zones_set_readers(daemon->local_zones,
+		daemon->cfg->num_threads))
+		fatal_exit("Could not create local zones: out of memory");
 	if(!local_zones_apply_cfg(daemon->local_zones, daemon->cfg))
 		fatal_exit("Could not set up local zones");
 
@@ -659,11 +1002,72 @@ daemon_fork(struct daemon* daemon)
 		modstack_find(&daemon->mods, "respip") < 0)
 		fatal_exit("RPZ requires the respip module");
 
+	/* the signature verify threads, that the workers connect to */
+	if(daemon->cfg->val_verify_threads > 0 &&
+		modstack_find(&daemon->mods, "validator") != -1) {
+#ifndef THREADS_DISABLED
+		daemon->valpool = val_pool_create(daemon->cfg,
+			daemon->cfg->val_verify_threads,
+			daemon->cfg->num_threads);
+		if(!daemon->valpool)
+			fatal_exit("Could not create signature verify threads");
+#else
+		log_warn("val-verify-threads: no threads available, "
+			"signatures are verified by the worker");
+#endif
+	}
+
+	/* the zone transfer parse threads, that the workers connect to.
+	 * The main thread is not pinned to a CPU here, so they run on all
+	 * the CPUs */
+	if(daemon_has_xfr_zones(daemon->cfg)) {
+#ifndef THREADS_DISABLED
+		daemon->authparse = auth_parse_pool_create(daemon->cfg,
+			daemon->cfg->num_threads, daemon->cfg->num_threads +
+			daemon->cfg->val_verify_threads + 1);
+		if(!daemon->authparse)
+			fatal_exit("Could not create zone transfer parse "
+				"threads");
+#endif
+	}
+
+	/* the table of queries in flight, that the workers connect to */
+	if(daemon->cfg->shared_inflight && daemon->cfg->num_threads > 1) {
+#ifndef THREADS_DISABLED
+		daemon->inflight = inflight_create(daemon->cfg->num_threads);
+		if(!daemon->inflight)
+			fatal_exit("Could not create shared inflight table");
+#else
+		log_warn("shared-inflight: no threads available, "
+			"it is not used");
+#endif
+	}
+
 	/* first create all the worker structures, so we can pass
 	 * them to the newly created threads. 
 	 */
 	daemon_create_workers(daemon);
 
+	/* the shared upstream streams, they use the ports of a worker for
+	 * the choice of outgoing interface */
+	if(daemon->cfg->tcp_upstream_pool) {
+#ifndef THREADS_DISABLED
+		daemon->outnetpool = outnet_pool_create(daemon->cfg,
+			daemon->cfg->num_threads +
+			daemon->cfg->val_verify_threads, daemon->rand,
+			daemon->env->infra_cache, daemon->connect_sslctx,
+			daemon->workers[0]->ports, daemon->workers[0]->numports);
+		if(!daemon->outnetpool)
+			fatal_exit("Could not create upstream stream pool");
+#else
+		log_warn("tcp-upstream-pool: no threads available, "
+			"the workers use their own streams");
+#endif
+	}
+
+	/* the other threads start on the CPU of the main thread, and
+	 * then move to their own */
+	daemon_thread_setup(daemon, daemon->workers[0]);
 #if defined(HAVE_EV_LOOP) || defined(HAVE_EV_DEFAULT_LOOP)
 	/* in libev the first inited base gets signals */
 	if(!worker_init(daemon->workers[0], daemon->cfg, daemon->ports[0], 1))
@@ -740,12 +1144,25 @@ daemon_cleanup(struct daemon* daemon)
 		auth_zones_cleanup(daemon->env->auth_zones);
 	/* key cache is cleared by module desetup during next daemon_fork() */
 	daemon_remote_clear(daemon->rc);
+	/* the node of this thread was in its worker */
+	lruhash_thread_node_set(NULL);
 	for(i=0; i<daemon->num; i++)
 		worker_delete(daemon->workers[i]);
 	free(daemon->workers);
 	daemon->workers = NULL;
 	daemon->num = 0;
+	/* after the workers, they hold connections to it */
+	val_pool_delete(daemon->valpool);
+	daemon->valpool = NULL;
+	auth_parse_pool_delete(daemon->authparse);
+	daemon->authparse = NULL;
+	inflight_delete(daemon->inflight);
+	daemon->inflight = NULL;
+	outnet_pool_delete(daemon->outnetpool);
+	daemon->outnetpool = NULL;
 	alloc_clear_special(&daemon->superalloc);
+	for(i=0; daemon->nodealloc && i<daemon->num_nodes; i++)
+		alloc_clear_special(&daemon->nodealloc[i]);
 #ifdef USE_DNSTAP
 	dt_delete(daemon->dtenv);
 	daemon->dtenv = NULL;
@@ -757,6 +1174,30 @@ daemon_cleanup(struct daemon* daemon)
 	daemon->cfg = NULL;
 }
 
+void
+daemon_read_cache_snapshot(struct daemon* daemon)
+{
+	struct alloc_cache alloc;
+	const char* fname = cache_snapshot_fname(daemon->cfg);
+	if(!fname)
+		return;
+	/* the entries are hashed with the seed the workers use later */
+	daemon_create_rand(daemon);
+	/* an id range of its own, apart from the worker threads */
+	alloc_init(&alloc, &daemon->superalloc, daemon->cfg->num_threads);
+	(void)cache_snapshot_read(daemon->env, &alloc, fname, time(NULL));
+	alloc_clear(&alloc);
+}
+
+void
+daemon_write_cache_snapshot(struct daemon* daemon)
+{
+	const char* fname = cache_snapshot_fname(daemon->cfg);
+	if(!fname)
+		return;
+	(void)cache_snapshot_write(daemon->env, fname, time(NULL));
+}
+
 void 
 daemon_delete(struct daemon* daemon)
 {
@@ -779,6 +1220,11 @@ daemon_delete(struct daemon* daemon)
 	}
 	ub_randfree(daemon->rand);
 	alloc_clear(&daemon->superalloc);
+	for(i=0; daemon->nodealloc && i<(size_t)daemon->num_nodes; i++)
+		alloc_clear(&daemon->nodealloc[i]);
+	free(daemon->nodealloc);
+	free(daemon->cpus);
+	free(daemon->cpu_nodes);
 	acl_list_delete(daemon->acl);
 	tcl_list_delete(daemon->tcl);
 	free(daemon->chroot);
@@ -853,6 +1299,8 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 			fatal_exit("malloc failure updating config settings");
 		}
 	}
+	slabhash_set_policy(daemon->env->msg_cache,
+		lruhash_policy_from_str(cfg->msg_cache_policy));
 	if((daemon->env->rrset_cache = rrset_cache_adjust(
 		daemon->env->rrset_cache, cfg, &daemon->superalloc)) == 0)
 		fatal_exit("malloc failure updating config settings");
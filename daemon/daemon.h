@@ -58,6 +58,10 @@ struct ub_randstate;
 struct daemon_remote;
 struct respip_set;
 struct shm_main_info;
+struct val_pool;
+struct auth_parse_pool;
+struct inflight_table;
+struct outnet_pool;
 
 #include "dnstap/dnstap_config.h"
 #ifdef USE_DNSTAP
@@ -89,6 +93,23 @@ struct daemon {
 	size_t num_ports;
 	/** reuseport is enabled if true */
 	int reuseport;
+	/** the CPUs that the daemon is allowed to run on, at the start,
+	 * or NULL if not known */
+	int* cpus;
+	/** number of CPUs in the cpus array */
+	int num_cpus;
+	/** the NUMA node of every CPU in the cpus array, or NULL */
+	int* cpu_nodes;
+	/** number of NUMA nodes, the highest node number plus one */
+	int num_nodes;
+	/** the threads are spread over the NUMA nodes, with numa-aware */
+	int numa;
+	/** the top allocs of the NUMA nodes, array of num_nodes, or NULL */
+	struct alloc_cache* nodealloc;
+	/** the main thread is pinned to a CPU */
+	int cpu_pinned;
+	/** the queries on the listening ports are steered to the CPUs */
+	int cpu_steered;
 	/** port number for remote that has ports opened. */
 	int rc_port;
 	/** listening ports for remote control */
@@ -134,6 +155,14 @@ struct daemon {
 	int use_response_ip;
 	/** some RPZ policies are configured */
 	int use_rpz;
+	/** the signature verify threads of the validator, or NULL */
+	struct val_pool* valpool;
+	/** the zone transfer parse threads, or NULL */
+	struct auth_parse_pool* authparse;
+	/** the client queries that the workers resolve, or NULL */
+	struct inflight_table* inflight;
+	/** the upstream TCP and TLS streams shared by the workers, or NULL */
+	struct outnet_pool* outnetpool;
 #ifdef USE_DNSCRYPT
 	/** the dnscrypt environment */
 	struct dnsc_env* dnscenv;
@@ -168,6 +197,20 @@ void daemon_fork(struct daemon* daemon);
  */
 void daemon_cleanup(struct daemon* daemon);
 
+/**
+ * Read the cache snapshot file, if configured, into the caches.
+ * Done on the first start, before the workers are started.
+ * @param daemon: the daemon.
+ */
+void daemon_read_cache_snapshot(struct daemon* daemon);
+
+/**
+ * Write the caches to the cache snapshot file, if configured.
+ * Done on exit, after the workers have stopped.
+ * @param daemon: the daemon.
+ */
+void daemon_write_cache_snapshot(struct daemon* daemon);
+
 /**
  * Delete workers, close listening ports.
  * @param daemon: the daemon.
@@ -59,6 +59,7 @@
 #include "daemon/daemon.h"
 #include "daemon/stats.h"
 #include "daemon/cachedump.h"
+#include "services/cache/snapshot.h"
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
@@ -722,6 +723,8 @@ print_stats(RES* ssl, const char* nm, struct ub_stats_info* s)
 		(unsigned long)s->svr.num_queries_prefetch)) return 0;
 	if(!ssl_printf(ssl, "%s.num.expired"SQ"%lu\n", nm,
 		(unsigned long)s->svr.ans_expired)) return 0;
+	if(!ssl_printf(ssl, "%s.num.joined"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_joined)) return 0;
 	if(!ssl_printf(ssl, "%s.num.recursivereplies"SQ"%lu\n", nm, 
 		(unsigned long)s->mesh_replies_sent)) return 0;
 #ifdef USE_DNSCRYPT
@@ -760,17 +763,73 @@ print_stats(RES* ssl, const char* nm, struct ub_stats_info* s)
 		s->mesh_time_median)) return 0;
 	if(!ssl_printf(ssl, "%s.tcpusage"SQ"%lu\n", nm,
 		(unsigned long)s->svr.tcp_accept_usage)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.recvmmsg"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_recvmmsg)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.recvmmsg.datagrams"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_recvmmsg_datagrams)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.sendmmsg"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_sendmmsg)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.sendmmsg.datagrams"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_sendmmsg_datagrams)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.out.sendmmsg"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_out_sendmmsg)) return 0;
+	if(!ssl_printf(ssl, "%s.udp.out.sendmmsg.datagrams"SQ"%lu\n", nm,
+		(unsigned long)s->svr.udp_out_sendmmsg_datagrams)) return 0;
+	if(!ssl_printf(ssl, "%s.cache.misses"SQ"%lu\n", nm,
+		(unsigned long)s->svr.cache_misses)) return 0;
+#ifdef USE_DNSTAP
+	if(!ssl_printf(ssl, "%s.dnstap.dropped"SQ"%lu\n", nm,
+		(unsigned long)s->svr.dnstap_dropped)) return 0;
+#endif /* USE_DNSTAP */
+	return 1;
+}
+
+/** print stats of the priority classes, if they are configured */
+static int
+print_pclass(RES* ssl, const char* nm, struct config_file* cfg,
+	struct ub_stats_info* s)
+{
+	const char* names[CFG_PRIORITY_CLASS_MAX];
+	int percent[CFG_PRIORITY_CLASS_MAX];
+	struct timeval sumwait, avg;
+	int i, num;
+	if(!cfg->priority_class)
+		return 1;
+	num = cfg_priority_classes(cfg, names, percent);
+	for(i=0; i<num; i++) {
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.current"SQ"%lu\n",
+			nm, names[i], (unsigned long)s->svr.pclass_states[i]))
+			return 0;
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.fetches"SQ"%lu\n",
+			nm, names[i], (unsigned long)s->svr.pclass_fetches[i]))
+			return 0;
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.exceeded"SQ"%lu\n",
+			nm, names[i], (unsigned long)s->svr.pclass_dropped[i]))
+			return 0;
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.replies"SQ"%lu\n",
+			nm, names[i], (unsigned long)s->svr.pclass_replies[i]))
+			return 0;
+#ifndef S_SPLINT_S
+		sumwait.tv_sec = s->svr.pclass_wait_usec[i] / 1000000;
+		sumwait.tv_usec = s->svr.pclass_wait_usec[i] % 1000000;
+#endif
+		timeval_divide(&avg, &sumwait, s->svr.pclass_replies[i]);
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.time.avg"SQ
+			ARG_LL "d.%6.6d\n", nm, names[i],
+			(long long)avg.tv_sec, (int)avg.tv_usec)) return 0;
+	}
 	return 1;
 }
 
 /** print stats for one thread */
 static int
-print_thread_stats(RES* ssl, int i, struct ub_stats_info* s)
+print_thread_stats(RES* ssl, int i, struct config_file* cfg,
+	struct ub_stats_info* s)
 {
 	char nm[32];
 	snprintf(nm, sizeof(nm), "thread%d", i);
 	nm[sizeof(nm)-1]=0;
-	return print_stats(ssl, nm, s);
+	return print_stats(ssl, nm, s) && print_pclass(ssl, nm, cfg, s);
 }
 
 /** print long number */
@@ -988,10 +1047,26 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.qtcp)) return 0;
 	if(!ssl_printf(ssl, "num.query.tcpout"SQ"%lu\n", 
 		(unsigned long)s->svr.qtcp_outgoing)) return 0;
+	if(!ssl_printf(ssl, "num.query.udpout"SQ"%lu\n",
+		(unsigned long)s->svr.qudp_outgoing)) return 0;
+	if(!ssl_printf(ssl, "num.query.udpout.hedged"SQ"%lu\n",
+		(unsigned long)s->svr.qudp_hedge)) return 0;
+	if(!ssl_printf(ssl, "num.query.udpout.hedge_won"SQ"%lu\n",
+		(unsigned long)s->svr.qudp_hedge_won)) return 0;
+	if(!ssl_printf(ssl, "num.query.udpout.sockreuse"SQ"%lu\n",
+		(unsigned long)s->svr.qudp_sock_reuse)) return 0;
+	if(!ssl_printf(ssl, "udpout.hedge.rate"SQ"%g\n",
+		s->svr.qudp_outgoing?(double)s->svr.qudp_hedge/
+		(double)s->svr.qudp_outgoing : 0.0)) return 0;
+	if(!ssl_printf(ssl, "udpout.hedge.won.rate"SQ"%g\n",
+		s->svr.qudp_hedge?(double)s->svr.qudp_hedge_won/
+		(double)s->svr.qudp_hedge : 0.0)) return 0;
 	if(!ssl_printf(ssl, "num.query.tls"SQ"%lu\n", 
 		(unsigned long)s->svr.qtls)) return 0;
 	if(!ssl_printf(ssl, "num.query.tls.resume"SQ"%lu\n", 
 		(unsigned long)s->svr.qtls_resume)) return 0;
+	if(!ssl_printf(ssl, "num.query.tls.ktls"SQ"%lu\n", 
+		(unsigned long)s->svr.qtls_ktls)) return 0;
 	if(!ssl_printf(ssl, "num.query.ipv6"SQ"%lu\n", 
 		(unsigned long)s->svr.qipv6)) return 0;
 	if(!ssl_printf(ssl, "num.query.https"SQ"%lu\n",
@@ -1064,6 +1139,39 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned)s->svr.infra_cache_count)) return 0;
 	if(!ssl_printf(ssl, "key.cache.count"SQ"%u\n",
 		(unsigned)s->svr.key_cache_count)) return 0;
+	/* cache lookups */
+	if(!ssl_printf(ssl, "msg.cache.hits"SQ"%lu\n",
+		(unsigned long)s->svr.msg_cache_hits)) return 0;
+	if(!ssl_printf(ssl, "msg.cache.misses"SQ"%lu\n",
+		(unsigned long)s->svr.msg_cache_misses)) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.hits"SQ"%lu\n",
+		(unsigned long)s->svr.rrset_cache_hits)) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.misses"SQ"%lu\n",
+		(unsigned long)s->svr.rrset_cache_misses)) return 0;
+	if(!ssl_printf(ssl, "infra.cache.hits"SQ"%lu\n",
+		(unsigned long)s->svr.infra_cache_hits)) return 0;
+	if(!ssl_printf(ssl, "infra.cache.misses"SQ"%lu\n",
+		(unsigned long)s->svr.infra_cache_misses)) return 0;
+	if(!ssl_printf(ssl, "key.cache.hits"SQ"%lu\n",
+		(unsigned long)s->svr.key_cache_hits)) return 0;
+	if(!ssl_printf(ssl, "key.cache.misses"SQ"%lu\n",
+		(unsigned long)s->svr.key_cache_misses)) return 0;
+	/* cache hits on the NUMA node of the thread, and on others */
+	if(!ssl_printf(ssl, "msg.cache.hits.local"SQ"%lu\n",
+		(unsigned long)(s->svr.msg_cache_hits -
+		s->svr.msg_cache_remote))) return 0;
+	if(!ssl_printf(ssl, "msg.cache.hits.remote"SQ"%lu\n",
+		(unsigned long)s->svr.msg_cache_remote)) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.hits.local"SQ"%lu\n",
+		(unsigned long)(s->svr.rrset_cache_hits -
+		s->svr.rrset_cache_remote))) return 0;
+	if(!ssl_printf(ssl, "rrset.cache.hits.remote"SQ"%lu\n",
+		(unsigned long)s->svr.rrset_cache_remote)) return 0;
+	if(!ssl_printf(ssl, "key.cache.hits.local"SQ"%lu\n",
+		(unsigned long)(s->svr.key_cache_hits -
+		s->svr.key_cache_remote))) return 0;
+	if(!ssl_printf(ssl, "key.cache.hits.remote"SQ"%lu\n",
+		(unsigned long)s->svr.key_cache_remote)) return 0;
 	/* applied RPZ actions */
 	for(i=0; i<UB_STATS_RPZ_ACTION_NUM; i++) {
 		if(i == RPZ_NO_OVERRIDE_ACTION)
@@ -1088,6 +1196,33 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.num_query_authzone_up)) return 0;
 	if(!ssl_printf(ssl, "num.query.authzone.down"SQ"%lu\n",
 		(unsigned long)s->svr.num_query_authzone_down)) return 0;
+	if(!ssl_printf(ssl, "tcpout.pool.streams"SQ"%lu\n",
+		(unsigned long)s->svr.tcp_pool_streams)) return 0;
+	if(!ssl_printf(ssl, "tcpout.pool.inflight"SQ"%lu\n",
+		(unsigned long)s->svr.tcp_pool_inflight)) return 0;
+	if(!ssl_printf(ssl, "tcpout.pool.queries"SQ"%lu\n",
+		(unsigned long)s->svr.tcp_pool_queries)) return 0;
+	if(!ssl_printf(ssl, "tcpout.pool.opened"SQ"%lu\n",
+		(unsigned long)s->svr.tcp_pool_opened)) return 0;
+	if(!ssl_printf(ssl, "tcpout.pool.queries_per_stream"SQ"%g\n",
+		s->svr.tcp_pool_opened?(double)s->svr.tcp_pool_queries/
+		(double)s->svr.tcp_pool_opened : 0.0)) return 0;
+	if(!ssl_printf(ssl, "num.tls.upstream.handshake"SQ"%lu\n",
+		(unsigned long)s->svr.tls_upstream_handshake)) return 0;
+	if(!ssl_printf(ssl, "num.tls.upstream.resumed"SQ"%lu\n",
+		(unsigned long)s->svr.tls_upstream_resumed)) return 0;
+	if(!ssl_printf(ssl, "num.tls.upstream.early_data"SQ"%lu\n",
+		(unsigned long)s->svr.tls_upstream_early_data)) return 0;
+	if(!ssl_printf(ssl, "num.tls.upstream.ktls"SQ"%lu\n",
+		(unsigned long)s->svr.tls_upstream_ktls)) return 0;
+	if(!ssl_printf(ssl, "tls.upstream.resume.rate"SQ"%g\n",
+		s->svr.tls_upstream_handshake?
+		(double)s->svr.tls_upstream_resumed/
+		(double)s->svr.tls_upstream_handshake : 0.0)) return 0;
+	if(!ssl_printf(ssl, "tls.upstream.handshake.time.avg"SQ"%g\n",
+		s->svr.tls_upstream_handshake?
+		(double)s->svr.tls_upstream_handshake_usec/1000000.0/
+		(double)s->svr.tls_upstream_handshake : 0.0)) return 0;
 #ifdef CLIENT_SUBNET
 	if(!ssl_printf(ssl, "num.query.subnet"SQ"%lu\n",
 		(unsigned long)s->svr.num_query_subnet)) return 0;
@@ -1110,7 +1245,7 @@ do_stats(RES* ssl, struct worker* worker, int reset)
 	/* gather all thread statistics in one place */
 	for(i=0; i<daemon->num; i++) {
 		server_stats_obtain(worker, daemon->workers[i], &s, reset);
-		if(!print_thread_stats(ssl, i, &s))
+		if(!print_thread_stats(ssl, i, daemon->cfg, &s))
 			return;
 		if(i == 0)
 			total = s;
@@ -1120,6 +1255,8 @@ do_stats(RES* ssl, struct worker* worker, int reset)
 	total.mesh_time_median /= (double)daemon->num;
 	if(!print_stats(ssl, "total", &total)) 
 		return;
+	if(!print_pclass(ssl, "total", daemon->cfg, &total))
+		return;
 	if(!print_uptime(ssl, worker, reset))
 		return;
 	if(daemon->cfg->stat_extended) {
@@ -1206,7 +1343,7 @@ perform_zone_add(RES* ssl, struct local_zones* zones, char* arg)
 		free(nm);
 		return 0;
 	}
-	lock_rw_wrlock(&zones->lock);
+	local_zones_wrlock(zones);
 	if((z=local_zones_find(zones, nm, nmlen, 
 		nmlabs, LDNS_RR_CLASS_IN))) {
 		/* already present in tree */
@@ -1214,16 +1351,16 @@ perform_zone_add(RES* ssl, struct local_zones* zones, char* arg)
 		z->type = t; /* update type anyway */
 		lock_rw_unlock(&z->lock);
 		free(nm);
-		lock_rw_unlock(&zones->lock);
+		local_zones_wrunlock(zones);
 		return 1;
 	}
 	if(!local_zones_add_zone(zones, nm, nmlen, 
 		nmlabs, LDNS_RR_CLASS_IN, t)) {
-		lock_rw_unlock(&zones->lock);
+		local_zones_wrunlock(zones);
 		ssl_printf(ssl, "error out of memory\n");
 		return 0;
 	}
-	lock_rw_unlock(&zones->lock);
+	local_zones_wrunlock(zones);
 	return 1;
 }
 
@@ -1265,13 +1402,13 @@ perform_zone_remove(RES* ssl, struct local_zones* zones, char* arg)
 	struct local_zone* z;
 	if(!parse_arg_name(ssl, arg, &nm, &nmlen, &nmlabs))
 		return 0;
-	lock_rw_wrlock(&zones->lock);
+	local_zones_wrlock(zones);
 	if((z=local_zones_find(zones, nm, nmlen, 
 		nmlabs, LDNS_RR_CLASS_IN))) {
 		/* present in tree */
 		local_zones_del_zone(zones, z);
 	}
-	lock_rw_unlock(&zones->lock);
+	local_zones_wrunlock(zones);
 	free(nm);
 	return 1;
 }
@@ -2448,6 +2585,33 @@ struct infra_arg {
 	int ssl_failed;
 };
 
+/** print the rtt histogram as 'msec:count,...', with the lower bound of
+ * every bucket that has observations and the number of observations,
+ * and 'lost:count' for queries that timed out */
+static char*
+infra_hist_str(struct rtt_hist* h, char* buf, size_t len)
+{
+	int i;
+	size_t at = 0;
+	buf[0] = 0;
+	for(i=0; i<RTT_HIST_BUCKETS; i++) {
+		if(h->bucket[i] == 0)
+			continue;
+		snprintf(buf+at, len-at, "%s%d:%d", (at?",":""),
+			rtt_hist_bucket_low(i),
+			(h->bucket[i]+RTT_HIST_ONE/2)/RTT_HIST_ONE);
+		at += strlen(buf+at);
+	}
+	if(h->lost) {
+		snprintf(buf+at, len-at, "%slost:%d", (at?",":""),
+			(h->lost+RTT_HIST_ONE/2)/RTT_HIST_ONE);
+		at += strlen(buf+at);
+	}
+	if(at == 0)
+		snprintf(buf, len, "-");
+	return buf;
+}
+
 /** callback for every host element in the infra cache */
 static void
 dump_infra_host(struct lruhash_entry* e, void* arg)
@@ -2457,6 +2621,7 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 	struct infra_data* d = (struct infra_data*)e->data;
 	char ip_str[1024];
 	char name[257];
+	char hist[512];
 	int port;
 	if(a->ssl_failed)
 		return;
@@ -2481,13 +2646,16 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 	if(!ssl_printf(a->ssl, "%s %s ttl %lu ping %d var %d rtt %d rto %d "
 		"tA %d tAAAA %d tother %d "
 		"ednsknown %d edns %d delay %d lame dnssec %d rec %d A %d "
-		"other %d\n", ip_str, name, (unsigned long)(d->ttl - a->now),
+		"other %d p50 %d p90 %d hist %s\n", ip_str, name,
+		(unsigned long)(d->ttl - a->now),
 		d->rtt.srtt, d->rtt.rttvar, rtt_notimeout(&d->rtt), d->rtt.rto,
 		d->timeout_A, d->timeout_AAAA, d->timeout_other,
 		(int)d->edns_lame_known, (int)d->edns_version,
 		(int)(a->now<d->probedelay?(d->probedelay - a->now):0),
 		(int)d->isdnsseclame, (int)d->rec_lame, (int)d->lame_type_A,
-		(int)d->lame_other)) {
+		(int)d->lame_other, rtt_percentile(&d->rtt, 50),
+		rtt_percentile(&d->rtt, 90),
+		infra_hist_str(&d->rtt.hist, hist, sizeof(hist)))) {
 		a->ssl_failed = 1;
 		return;
 	}
@@ -2989,6 +3157,23 @@ distribute_cmd(struct daemon_remote* rc, RES* ssl, char* cmd)
 	}
 }
 
+/** do the dump_cache_snapshot command */
+static void
+do_dump_cache_snapshot(RES* ssl, struct worker* worker)
+{
+	const char* fname = cache_snapshot_fname(worker->env.cfg);
+	if(!fname) {
+		(void)ssl_printf(ssl, "error no cache-snapshot-file "
+			"configured\n");
+		return;
+	}
+	if(!cache_snapshot_write(&worker->env, fname, *worker->env.now)) {
+		(void)ssl_printf(ssl, "error could not write %s\n", fname);
+		return;
+	}
+	send_ok(ssl);
+}
+
 /** check for name with end-of-string, space or tab after it */
 static int
 cmdcmp(char* p, const char* cmd, size_t len)
@@ -3024,6 +3209,9 @@ execute_cmd(struct daemon_remote* rc, RES* ssl, char* cmd,
 	} else if(cmdcmp(p, "load_cache", 10)) {
 		if(load_cache(ssl, worker)) send_ok(ssl);
 		return;
+	} else if(cmdcmp(p, "dump_cache_snapshot", 19)) {
+		do_dump_cache_snapshot(ssl, worker);
+		return;
 	} else if(cmdcmp(p, "list_forwards", 13)) {
 		do_list_forwards(ssl, worker);
 		return;
@@ -50,6 +50,7 @@
 #include "daemon/daemon.h"
 #include "services/mesh.h"
 #include "services/outside_network.h"
+#include "services/outnet_pool.h"
 #include "services/listen_dnsport.h"
 #include "util/config_file.h"
 #include "util/tube.h"
@@ -66,9 +67,17 @@
 #ifdef CLIENT_SUBNET
 #include "edns-subnet/subnetmod.h"
 #endif
+#ifdef USE_DNSTAP
+#include "dnstap/dtstream.h"
+#endif
 #ifdef HAVE_SSL
 #include <openssl/ssl.h>
 #endif
+#ifdef HAVE_LINUX_PERF_EVENT_H
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
 
 /** add timers and the values do not overflow or become negative */
 static void
@@ -171,14 +180,55 @@ set_neg_cache_stats(struct worker* worker, struct ub_server_stats* svr,
 	if(!ve->neg_cache)
 		return;
 	neg = ve->neg_cache;
-	lock_basic_lock(&neg->lock);
+	lock_basic_lock(&neg->lru_lock);
 	svr->num_neg_cache_noerror = (long long)neg->num_neg_cache_noerror;
 	svr->num_neg_cache_nxdomain = (long long)neg->num_neg_cache_nxdomain;
 	if(reset && !worker->env.cfg->stat_cumulative) {
 		neg->num_neg_cache_noerror = 0;
 		neg->num_neg_cache_nxdomain = 0;
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&neg->lru_lock);
+}
+
+/** get and reset the lookup hits and misses of the caches. The caches
+ * are shared by the threads, the first thread reports them. */
+static void
+get_cache_hits(struct worker* worker, struct ub_stats_info* s, int reset)
+{
+	size_t h = 0, m = 0, r = 0;
+	reset = reset && !worker->env.cfg->stat_cumulative;
+	if(worker->thread_num != 0) {
+		s->svr.msg_cache_hits = 0;
+		s->svr.msg_cache_misses = 0;
+		s->svr.rrset_cache_hits = 0;
+		s->svr.rrset_cache_misses = 0;
+		s->svr.infra_cache_hits = 0;
+		s->svr.infra_cache_misses = 0;
+		s->svr.key_cache_hits = 0;
+		s->svr.key_cache_misses = 0;
+		s->svr.msg_cache_remote = 0;
+		s->svr.rrset_cache_remote = 0;
+		s->svr.key_cache_remote = 0;
+		return;
+	}
+	slabhash_get_hits(worker->env.msg_cache, &h, &m, &r, reset);
+	s->svr.msg_cache_hits = (long long)h;
+	s->svr.msg_cache_misses = (long long)m;
+	s->svr.msg_cache_remote = (long long)r;
+	slabhash_get_hits(&worker->env.rrset_cache->table, &h, &m, &r, reset);
+	s->svr.rrset_cache_hits = (long long)h;
+	s->svr.rrset_cache_misses = (long long)m;
+	s->svr.rrset_cache_remote = (long long)r;
+	slabhash_get_hits(worker->env.infra_cache->hosts, &h, &m, &r, reset);
+	s->svr.infra_cache_hits = (long long)h;
+	s->svr.infra_cache_misses = (long long)m;
+	h = m = r = 0;
+	if(worker->env.key_cache)
+		slabhash_get_hits(worker->env.key_cache->slab, &h, &m, &r,
+			reset);
+	s->svr.key_cache_hits = (long long)h;
+	s->svr.key_cache_misses = (long long)m;
+	s->svr.key_cache_remote = (long long)r;
 }
 
 /** get rrsets bogus number from validator */
@@ -255,6 +305,7 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 {
 	int i;
 	struct listen_list* lp;
+	struct comm_udp_batch_stats* bst;
 
 	s->svr = worker->stats;
 	s->mesh_num_states = (long long)worker->env.mesh->all.count;
@@ -272,15 +323,56 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	s->svr.ans_bogus += (long long)worker->env.mesh->ans_bogus;
 	s->svr.ans_rcode_nodata += (long long)worker->env.mesh->ans_nodata;
 	s->svr.ans_expired += (long long)worker->env.mesh->ans_expired;
+	s->svr.num_joined += (long long)worker->env.mesh->num_joined;
 	for(i=0; i<UB_STATS_RCODE_NUM; i++)
 		s->svr.ans_rcode[i] += (long long)worker->env.mesh->ans_rcode[i];
 	for(i=0; i<UB_STATS_RPZ_ACTION_NUM; i++)
 		s->svr.rpz_action[i] += (long long)worker->env.mesh->rpz_action[i];
+	for(i=0; i<worker->env.mesh->num_pclass; i++) {
+		struct mesh_pclass* c = &worker->env.mesh->pclass[i];
+		s->svr.pclass_states[i] = (long long)c->num_states;
+		s->svr.pclass_fetches[i] = (long long)c->num_fetches;
+		s->svr.pclass_dropped[i] = (long long)c->stats_dropped;
+		s->svr.pclass_replies[i] = (long long)c->replies_sent;
+		s->svr.pclass_wait_usec[i] =
+			(long long)c->replies_sum_wait.tv_sec*1000000 +
+			(long long)c->replies_sum_wait.tv_usec;
+	}
 	timehist_export(worker->env.mesh->histogram, s->svr.hist, 
 		NUM_BUCKETS_HIST);
 	/* values from outside network */
 	s->svr.unwanted_replies = (long long)worker->back->unwanted_replies;
 	s->svr.qtcp_outgoing = (long long)worker->back->num_tcp_outgoing;
+	s->svr.tls_upstream_handshake =
+		(long long)worker->back->num_tls_handshake;
+	s->svr.tls_upstream_resumed = (long long)worker->back->num_tls_resumed;
+	s->svr.tls_upstream_early_data =
+		(long long)worker->back->num_tls_early_data;
+	s->svr.tls_upstream_ktls = (long long)worker->back->num_tls_ktls;
+	s->svr.tls_upstream_handshake_usec = worker->back->tls_handshake_usec;
+	s->svr.qudp_outgoing = (long long)worker->back->num_udp_outgoing;
+	s->svr.qudp_hedge = (long long)worker->back->num_udp_hedge;
+	s->svr.qudp_hedge_won = (long long)worker->back->num_udp_hedge_won;
+	s->svr.qudp_sock_reuse = (long long)worker->back->num_udp_sock_reuse;
+	/* values from the UDP batches */
+	bst = comm_base_udp_batch_stats(worker->base);
+	s->svr.udp_recvmmsg = (long long)bst->recv_calls;
+	s->svr.udp_recvmmsg_datagrams = (long long)bst->recv_pkts;
+	s->svr.udp_sendmmsg = (long long)bst->send_calls;
+	s->svr.udp_sendmmsg_datagrams = (long long)bst->send_pkts;
+	s->svr.udp_out_sendmmsg = (long long)bst->out_calls;
+	s->svr.udp_out_sendmmsg_datagrams = (long long)bst->out_pkts;
+	s->svr.cache_misses = server_stats_cache_misses(worker->cache_miss_fd,
+		0);
+#ifdef USE_DNSTAP
+	/* the queue drop counter is only written by this worker */
+	if(worker->dtenv.msgqueue) {
+		s->svr.dnstap_dropped =
+			(long long)worker->dtenv.msgqueue->dropped;
+		if(reset)
+			worker->dtenv.msgqueue->dropped = 0;
+	}
+#endif /* USE_DNSTAP */
 
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = (long long)get_rrset_bogus(worker, reset);
@@ -295,6 +387,7 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	if(worker->env.key_cache)
 		s->svr.key_cache_count = (long long)count_slabhash_entries(worker->env.key_cache->slab);
 	else	s->svr.key_cache_count = 0;
+	get_cache_hits(worker, s, reset);
 
 #ifdef USE_DNSCRYPT
 	if(worker->daemon->dnscenv) {
@@ -334,6 +427,15 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 		}
 		lock_rw_unlock(&worker->env.auth_zones->lock);
 	}
+	if(worker->daemon->outnetpool) {
+		struct outnet_pool_stats ps;
+		outnet_pool_get_stats(worker->daemon->outnetpool, &ps,
+			reset && !worker->env.cfg->stat_cumulative);
+		s->svr.tcp_pool_streams = (long long)ps.streams;
+		s->svr.tcp_pool_inflight = (long long)ps.inflight;
+		s->svr.tcp_pool_queries = (long long)ps.queries;
+		s->svr.tcp_pool_opened = (long long)ps.opened;
+	}
 	s->svr.mem_stream_wait =
 		(long long)tcp_req_info_get_stream_buffer_size();
 	s->svr.mem_http2_query_buffer =
@@ -400,12 +502,30 @@ void server_stats_reply(struct worker* worker, int reset)
 
 void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 {
+	int i;
 	total->svr.num_queries += a->svr.num_queries;
 	total->svr.num_queries_ip_ratelimited += a->svr.num_queries_ip_ratelimited;
 	total->svr.num_queries_missed_cache += a->svr.num_queries_missed_cache;
 	total->svr.num_queries_prefetch += a->svr.num_queries_prefetch;
 	total->svr.sum_query_list_size += a->svr.sum_query_list_size;
 	total->svr.ans_expired += a->svr.ans_expired;
+	total->svr.num_joined += a->svr.num_joined;
+	for(i=0; i<UB_STATS_PCLASS_NUM; i++) {
+		total->svr.pclass_states[i] += a->svr.pclass_states[i];
+		total->svr.pclass_fetches[i] += a->svr.pclass_fetches[i];
+		total->svr.pclass_dropped[i] += a->svr.pclass_dropped[i];
+		total->svr.pclass_replies[i] += a->svr.pclass_replies[i];
+		total->svr.pclass_wait_usec[i] += a->svr.pclass_wait_usec[i];
+	}
+	total->svr.udp_recvmmsg += a->svr.udp_recvmmsg;
+	total->svr.udp_recvmmsg_datagrams += a->svr.udp_recvmmsg_datagrams;
+	total->svr.udp_sendmmsg += a->svr.udp_sendmmsg;
+	total->svr.udp_sendmmsg_datagrams += a->svr.udp_sendmmsg_datagrams;
+	total->svr.udp_out_sendmmsg += a->svr.udp_out_sendmmsg;
+	total->svr.udp_out_sendmmsg_datagrams +=
+		a->svr.udp_out_sendmmsg_datagrams;
+	total->svr.dnstap_dropped += a->svr.dnstap_dropped;
+	total->svr.cache_misses += a->svr.cache_misses;
 #ifdef USE_DNSCRYPT
 	total->svr.num_query_dnscrypt_crypted += a->svr.num_query_dnscrypt_crypted;
 	total->svr.num_query_dnscrypt_cert += a->svr.num_query_dnscrypt_cert;
@@ -419,13 +539,25 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 		total->svr.max_query_list_size = a->svr.max_query_list_size;
 
 	if(a->svr.extended) {
-		int i;
 		total->svr.qtype_big += a->svr.qtype_big;
 		total->svr.qclass_big += a->svr.qclass_big;
 		total->svr.qtcp += a->svr.qtcp;
 		total->svr.qtcp_outgoing += a->svr.qtcp_outgoing;
+		total->svr.tls_upstream_handshake +=
+			a->svr.tls_upstream_handshake;
+		total->svr.tls_upstream_resumed += a->svr.tls_upstream_resumed;
+		total->svr.tls_upstream_early_data +=
+			a->svr.tls_upstream_early_data;
+		total->svr.tls_upstream_ktls += a->svr.tls_upstream_ktls;
+		total->svr.tls_upstream_handshake_usec +=
+			a->svr.tls_upstream_handshake_usec;
+		total->svr.qudp_outgoing += a->svr.qudp_outgoing;
+		total->svr.qudp_hedge += a->svr.qudp_hedge;
+		total->svr.qudp_hedge_won += a->svr.qudp_hedge_won;
+		total->svr.qudp_sock_reuse += a->svr.qudp_sock_reuse;
 		total->svr.qtls += a->svr.qtls;
 		total->svr.qtls_resume += a->svr.qtls_resume;
+		total->svr.qtls_ktls += a->svr.qtls_ktls;
 		total->svr.qhttps += a->svr.qhttps;
 		total->svr.qipv6 += a->svr.qipv6;
 		total->svr.qbit_QR += a->svr.qbit_QR;
@@ -490,6 +622,8 @@ void server_stats_insquery(struct ub_server_stats* stats, struct comm_point* c,
 			if(SSL_session_reused(c->ssl)) 
 				stats->qtls_resume++;
 #endif
+			if(c->ssl_ktls)
+				stats->qtls_ktls++;
 			if(c->type == comm_http)
 				stats->qhttps++;
 		}
@@ -519,6 +653,49 @@ void server_stats_insquery(struct ub_server_stats* stats, struct comm_point* c,
 	}
 }
 
+int server_stats_cache_misses_open(void)
+{
+#if defined(HAVE_LINUX_PERF_EVENT_H) && defined(__NR_perf_event_open)
+	struct perf_event_attr attr;
+	int fd;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CACHE_MISSES;
+	/* user space only, that is allowed for the unprivileged threads */
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1,
+		PERF_FLAG_FD_CLOEXEC);
+	if(fd == -1) {
+		verbose(VERB_OPS, "cache misses are not counted, "
+			"perf_event_open: %s", strerror(errno));
+		return -1;
+	}
+	return fd;
+#else
+	return -1;
+#endif
+}
+
+long long server_stats_cache_misses(int fd, int reset)
+{
+#if defined(HAVE_LINUX_PERF_EVENT_H) && defined(__NR_perf_event_open)
+	uint64_t v = 0;
+	if(fd == -1)
+		return 0;
+	if(read(fd, &v, sizeof(v)) != (ssize_t)sizeof(v))
+		v = 0;
+	if(reset)
+		(void)ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+	return (long long)v;
+#else
+	(void)fd;
+	(void)reset;
+	return 0;
+#endif
+}
+
 void server_stats_insrcode(struct ub_server_stats* stats, sldns_buffer* buf)
 {
 	if(stats->extended && sldns_buffer_limit(buf) != 0) {
@@ -119,6 +119,21 @@ void server_stats_insquery(struct ub_server_stats* stats, struct comm_point* c,
 	uint16_t qtype, uint16_t qclass, struct edns_data* edns, 
 	struct comm_reply* repinfo);
 
+/**
+ * Open the hardware counter of the cache misses of the thread that calls
+ * it.  Only the misses in user space are counted.
+ * @return file descriptor of the counter, or -1 if not available.
+ */
+int server_stats_cache_misses_open(void);
+
+/**
+ * Read the cache misses counter.
+ * @param fd: the counter, or -1.
+ * @param reset: if true the counter is set to 0 after it is read.
+ * @return number of cache misses, 0 if there is no counter.
+ */
+long long server_stats_cache_misses(int fd, int reset);
+
 /**
  * Add rcode for this query.
  * @param stats: the stats
@@ -516,6 +516,12 @@ perform_setup(struct daemon* daemon, struct config_file* cfg, int debug_mode,
 	if(!(daemon->connect_sslctx = connect_sslctx_create(NULL, NULL,
 		cfg->tls_cert_bundle, cfg->tls_win_cert)))
 		fatal_exit("could not set up connect SSL_CTX");
+	if(cfg->tls_use_ktls) {
+		if(!sslctx_enable_ktls(daemon->connect_sslctx) ||
+			(daemon->listen_sslctx &&
+			!sslctx_enable_ktls(daemon->listen_sslctx)))
+			log_warn("tls-use-ktls: the SSL library has no kTLS support");
+	}
 #endif
 
 	/* init syslog (as root) if needed, before daemonize, otherwise
@@ -727,6 +733,7 @@ run_daemon(const char* cfgfile, int cmdline_verbose, int debug_mode, int need_pi
 		if(!done_setup) { 
 			perform_setup(daemon, cfg, debug_mode, &cfgfile, need_pidfile);
 			done_setup = 1; 
+			daemon_read_cache_snapshot(daemon);
 		} else {
 			/* reopen log after HUP to facilitate log rotation */
 			if(!cfg->use_syslog)
@@ -734,6 +741,8 @@ run_daemon(const char* cfgfile, int cmdline_verbose, int debug_mode, int need_pi
 		}
 		/* work */
 		daemon_fork(daemon);
+		if(daemon->need_to_exit)
+			daemon_write_cache_snapshot(daemon);
 
 		/* clean up for restart */
 		verbose(VERB_ALGO, "cleanup.");
@@ -73,6 +73,9 @@
 #include "iterator/iter_utils.h"
 #include "validator/autotrust.h"
 #include "validator/val_anchor.h"
+#include "validator/val_pool.h"
+#include "services/inflight.h"
+#include "services/outnet_pool.h"
 #include "respip/respip.h"
 #include "libunbound/context.h"
 #include "libunbound/libworker.h"
@@ -81,6 +84,9 @@
 #include "util/shm_side/shm_main.h"
 #include "dnscrypt/dnscrypt.h"
 #include "dnstap/dtstream.h"
+#ifdef USE_CACHEDB
+#include "cachedb/cachedb.h"
+#endif
 
 #ifdef HAVE_SYS_TYPES_H
 #  include <sys/types.h>
@@ -135,6 +141,8 @@ worker_mem_report(struct worker* ATTR_UNUSED(worker),
 	mesh = mesh_get_mem(worker->env.mesh);
 	ac = alloc_get_mem(&worker->alloc);
 	superac = alloc_get_mem(&worker->daemon->superalloc);
+	for(i=0; worker->daemon->nodealloc && i<worker->daemon->num_nodes; i++)
+		superac += alloc_get_mem(&worker->daemon->nodealloc[i]);
 	anch = anchors_get_mem(worker->env.anchors);
 	iter = 0;
 	val = 0;
@@ -588,6 +596,84 @@ apply_respip_action(struct worker* worker, const struct query_info* qinfo,
 	return 1;
 }
 
+/** Encode the answer from the cache.  If wire images are enabled, the wire
+ * image of the reply is used, and if it has none, a new one is made and
+ * attached to the reply, its size is returned in wire_mem.  If the image
+ * is stale, the new one is returned in wirep, to replace it. */
+static int
+answer_cache_encode(struct worker* worker, struct query_info* qinfo,
+	struct reply_info* rep, struct reply_info* encode_rep, uint16_t id,
+	uint16_t flags, struct comm_reply* repinfo, time_t timenow,
+	uint16_t udpsize, struct edns_data* edns, int secure,
+	struct reply_wire** wirep, size_t* wire_mem)
+{
+	int dnssec = (int)(edns->bits & EDNS_DO);
+	if(worker->env.cfg->msg_cache_wire_image && encode_rep == rep) {
+		struct reply_wire* w = reply_info_get_wire(rep, dnssec);
+		int r = -1;
+		if(w)
+			r = reply_wire_answer_encode(w, qinfo, rep, id, flags,
+				repinfo->c->buffer, timenow, 1, udpsize, edns,
+				dnssec, secure);
+		if(r == 1)
+			return 1;
+		if(r == -1) {
+			if(!reply_info_answer_encode_wire(qinfo, rep, id,
+				flags, repinfo->c->buffer, timenow, 1,
+				worker->scratchpad, udpsize, edns, dnssec,
+				secure, wirep))
+				return 0;
+			/* the entry is read locked, an empty slot is
+			 * filled with a compare and swap */
+			if(*wirep && !w) {
+				size_t mem = (*wirep)->mem;
+				if(reply_info_attach_wire(rep, *wirep)) {
+					*wirep = NULL;
+	*wire_mem = 0;
+					*wire_mem = mem;
+				}
+			}
+			return 1;
+		}
+		/* the image does not fit, encode it with truncation */
+	}
+	return reply_info_answer_encode(qinfo, encode_rep, id, flags,
+		repinfo->c->buffer, timenow, 1, worker->scratchpad,
+		udpsize, edns, dnssec, secure);
+}
+
+/** Store a new wire image in the reply of the message cache entry, if the
+ * entry still holds that reply, and count the size of the images in the
+ * cache.  The entry must not be locked by the caller, the image w, if not
+ * NULL, replaces a stale image and is freed if it is not stored.  The
+ * attached size is that of an image that reply_info_attach_wire stored. */
+static void
+worker_store_wire(struct worker* worker, hashvalue_type h,
+	struct query_info* qinfo, struct reply_info* rep, struct reply_wire* w,
+	size_t attached)
+{
+	struct lruhash_entry* e;
+	int diff = (int)attached;
+	if(w && (e=slabhash_lookup(worker->env.msg_cache, h, qinfo, 1))) {
+		if((struct reply_info*)e->data == rep) {
+			/* replace a stale image, there are no readers
+			 * while the write lock is held */
+			struct reply_wire* old = reply_info_set_wire(rep, w);
+			diff += (int)w->mem;
+			if(old) {
+				diff -= (int)old->mem;
+				free(old);
+			}
+			w = NULL;
+		}
+		lock_rw_unlock(&e->lock);
+	}
+	free(w);
+	if(diff != 0)
+		slabhash_update_entry_size(worker->env.msg_cache, h, qinfo,
+			rep, &rep->wire_mem, diff, NULL);
+}
+
 /** answer query from the cache.
  * Normally, the answer message will be built in repinfo->c->buffer; if the
  * answer is supposed to be suppressed or the answer is supposed to be an
@@ -595,14 +681,17 @@ apply_respip_action(struct worker* worker, const struct query_info* qinfo,
  * caller as such.  In the latter case *partial_rep will point to the incomplete
  * reply, and this function is (possibly) supposed to be called again with that
  * *partial_rep value to complete the chain.  In addition, if the query should
- * be completely dropped, '*need_drop' will be set to 1. */
+ * be completely dropped, '*need_drop' will be set to 1.  If a new wire image
+ * of the reply is made, it is returned in '*wirep' or its attached size in
+ * '*wire_mem', for worker_store_wire(). */
 static int
 answer_from_cache(struct worker* worker, struct query_info* qinfo,
 	struct respip_client_info* cinfo, int* need_drop, int* is_expired_answer,
 	int* is_secure_answer, struct ub_packed_rrset_key** alias_rrset,
 	struct reply_info** partial_repp,
 	struct reply_info* rep, uint16_t id, uint16_t flags,
-	struct comm_reply* repinfo, struct edns_data* edns)
+	struct comm_reply* repinfo, struct edns_data* edns,
+	struct reply_wire** wirep, size_t* wire_mem)
 {
 	struct edns_data edns_bak;
 	time_t timenow = *worker->env.now;
@@ -612,6 +701,7 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 	int must_validate = (!(flags&BIT_CD) || worker->env.cfg->ignore_cd)
 		&& worker->env.need_to_validate;
 	*partial_repp = NULL;  /* avoid accidental further pass */
+	*wirep = NULL;
 
 	/* Check TTL */
 	if(rep->ttl < timenow) {
@@ -724,9 +814,9 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 		}
 	} else if(!apply_edns_options(edns, &edns_bak, worker->env.cfg,
 		repinfo->c, worker->scratchpad) ||
-		!reply_info_answer_encode(qinfo, encode_rep, id, flags,
-		repinfo->c->buffer, timenow, 1, worker->scratchpad,
-		udpsize, edns, (int)(edns->bits & EDNS_DO), *is_secure_answer)) {
+		!answer_cache_encode(worker, qinfo, rep, encode_rep, id, flags,
+		repinfo, timenow, udpsize, edns, *is_secure_answer, wirep,
+		wire_mem)) {
 		if(!inplace_cb_reply_servfail_call(&worker->env, qinfo, NULL, NULL,
 			LDNS_RCODE_SERVFAIL, edns, repinfo, worker->scratchpad,
 			worker->env.now_tv))
@@ -1083,6 +1173,10 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct query_info* lookup_qinfo = &qinfo;
 	struct query_info qinfo_tmp; /* placeholder for lookup_qinfo */
 	struct respip_client_info* cinfo = NULL, cinfo_tmp;
+	/* a new wire image for the reply in the cache entry */
+	struct reply_wire* wire = NULL;
+	size_t wire_mem = 0;
+	struct reply_info* wire_rep;
 	memset(&qinfo, 0, sizeof(qinfo));
 
 	if((error != NETEVENT_NOERROR && error != NETEVENT_DONE)|| !repinfo) {
@@ -1464,7 +1558,8 @@ lookup_cache:
 				&alias_rrset, &partial_rep, (struct reply_info*)e->data,
 				*(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
 				sldns_buffer_read_u16_at(c->buffer, 2), repinfo,
-				&edns)) {
+				&edns, &wire, &wire_mem)) {
+				wire_rep = (struct reply_info*)e->data;
 				/* prefetch it if the prefetch TTL expired.
 				 * Note that if there is more than one pass
 				 * its qname must be that used for cache
@@ -1480,6 +1575,10 @@ lookup_cache:
 						< *worker->env.now)
 						leeway = 0;
 					lock_rw_unlock(&e->lock);
+					if(wire || wire_mem)
+						worker_store_wire(worker, h,
+							lookup_qinfo, wire_rep,
+							wire, wire_mem);
 					reply_and_prefetch(worker, lookup_qinfo,
 						sldns_buffer_read_u16_at(c->buffer, 2),
 						repinfo, leeway,
@@ -1491,6 +1590,10 @@ lookup_cache:
 					}
 				} else if(!partial_rep) {
 					lock_rw_unlock(&e->lock);
+					if(wire || wire_mem)
+						worker_store_wire(worker, h,
+							lookup_qinfo, wire_rep,
+							wire, wire_mem);
 					regional_free_all(worker->scratchpad);
 					goto send_reply;
 				} else {
@@ -1546,7 +1649,8 @@ lookup_cache:
 	/* grab a work request structure for this new request */
 	mesh_new_client(worker->env.mesh, &qinfo, cinfo,
 		sldns_buffer_read_u16_at(c->buffer, 2),
-		&edns, repinfo, *(uint16_t*)(void *)sldns_buffer_begin(c->buffer));
+		&edns, repinfo, *(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
+		acladdr?acladdr->pclass:-1);
 	regional_free_all(worker->scratchpad);
 	worker_mem_report(worker, NULL);
 	return 0;
@@ -1690,6 +1794,7 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 	}
 	worker->daemon = daemon;
 	worker->thread_num = id;
+	worker->cache_miss_fd = -1;
 	if(!(worker->cmd = tube_create())) {
 		free(worker->ports);
 		free(worker);
@@ -1725,6 +1830,9 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	}
 	comm_base_set_slow_accept_handlers(worker->base, &worker_stop_accept,
 		&worker_start_accept, worker);
+	comm_base_set_udp_batch(worker->base, cfg->udp_batch_size);
+	if(cfg->stat_extended)
+		worker->cache_miss_fd = server_stats_cache_misses_open();
 	if(do_sigs) {
 #ifdef SIGHUP
 		ub_thread_sig_unblock(SIGHUP);
@@ -1796,12 +1904,27 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker->daemon->connect_sslctx, cfg->delay_close,
 		cfg->tls_use_sni, dtenv, cfg->udp_connect,
 		cfg->max_reuse_tcp_queries, cfg->tcp_reuse_timeout,
-		cfg->tcp_auth_query_timeout);
+		cfg->tcp_auth_query_timeout, cfg->tls_upstream_resume,
+		cfg->tls_upstream_early_data,
+		cfg->udp_hedge?cfg->udp_hedge_percentile:0,
+		cfg->udp_hedge_max_rate,
+		cfg->udp_upstream_batch?cfg->udp_batch_size:0,
+		cfg->udp_connect_pool, cfg->udp_connect_reuse);
 	if(!worker->back) {
 		log_err("could not create outgoing sockets");
 		worker_delete(worker);
 		return 0;
 	}
+	if(worker->daemon->outnetpool) {
+		worker->back->pool = outnet_pool_conn_create(
+			worker->daemon->outnetpool, worker->base,
+			cfg->msg_buffer_size);
+		if(!worker->back->pool) {
+			log_err("could not connect to upstream stream pool");
+			worker_delete(worker);
+			return 0;
+		}
+	}
 	iterator_set_ip46_support(&worker->daemon->mods, worker->daemon->env,
 		worker->back);
 	/* start listening to commands */
@@ -1827,8 +1950,15 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	}
 
 	server_stats_init(&worker->stats, cfg);
-	alloc_init(&worker->alloc, &worker->daemon->superalloc, 
-		worker->thread_num);
+	if(worker->daemon->numa) {
+		/* the free rrset keys are kept on the node of the memory */
+		alloc_init(&worker->alloc,
+			&worker->daemon->nodealloc[worker->node],
+			worker->thread_num);
+		alloc_set_node(&worker->alloc, worker->node,
+			worker->daemon->nodealloc, worker->daemon->num_nodes);
+	} else	alloc_init(&worker->alloc, &worker->daemon->superalloc, 
+			worker->thread_num);
 	alloc_set_id_cleanup(&worker->alloc, &worker_alloc_cleanup, worker);
 	worker->env = *worker->daemon->env;
 	comm_base_timept(worker->base, &worker->env.now, &worker->env.now_tv);
@@ -1849,6 +1979,25 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	if(worker->daemon->valpool) {
+		worker->env.val_pool = val_pool_conn_create(
+			worker->daemon->valpool, worker->base);
+		if(!worker->env.val_pool) {
+			log_err("could not connect to signature verify threads");
+			worker_delete(worker);
+			return 0;
+		}
+	}
+	if(worker->daemon->authparse) {
+		worker->env.auth_parse = auth_parse_conn_create(
+			worker->daemon->authparse, worker->base);
+		if(!worker->env.auth_parse) {
+			log_err("could not connect to zone transfer parse "
+				"threads");
+			worker_delete(worker);
+			return 0;
+		}
+	}
 	worker->env.mesh = mesh_create(&worker->daemon->mods, &worker->env);
 	if(!worker->env.mesh) {
 		log_err("malloc failure");
@@ -1858,6 +2007,16 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	/* Pass on daemon variables that we would need in the mesh area */
 	worker->env.mesh->use_response_ip = worker->daemon->use_response_ip;
 	worker->env.mesh->use_rpz = worker->daemon->use_rpz;
+	if(worker->daemon->inflight) {
+		worker->env.mesh->inflight = inflight_conn_create(
+			worker->daemon->inflight, worker->thread_num,
+			worker->base, worker->env.mesh);
+		if(!worker->env.mesh->inflight) {
+			log_err("could not connect to shared inflight table");
+			worker_delete(worker);
+			return 0;
+		}
+	}
 
 	worker->env.detach_subs = &mesh_detach_subs;
 	worker->env.attach_sub = &mesh_attach_sub;
@@ -1951,16 +2110,30 @@ worker_delete(struct worker* worker)
 		worker_mem_report(worker, NULL);
 	}
 	outside_network_quit_prepare(worker->back);
-	mesh_delete(worker->env.mesh);
+#ifdef USE_CACHEDB
+	cachedb_thread_close(&worker->env);
+#endif
+	if(worker->env.mesh) {
+		/* the mesh states are deleted first, they are in the table */
+		struct inflight_conn* inflight = worker->env.mesh->inflight;
+		mesh_delete(worker->env.mesh);
+		inflight_conn_delete(inflight);
+	}
+	val_pool_conn_delete(worker->env.val_pool);
+	auth_parse_conn_delete(worker->env.auth_parse);
 	sldns_buffer_free(worker->env.scratch_buffer);
 	forwards_delete(worker->env.fwds);
 	hints_delete(worker->env.hints);
 	listen_delete(worker->front);
+	if(worker->back)
+		outnet_pool_conn_delete(worker->back->pool);
 	outside_network_delete(worker->back);
 	comm_signal_delete(worker->comsig);
 	tube_delete(worker->cmd);
 	comm_timer_delete(worker->stat_timer);
 	comm_timer_delete(worker->env.probe_timer);
+	if(worker->cache_miss_fd != -1)
+		close(worker->cache_miss_fd);
 	free(worker->ports);
 	if(worker->thread_num == 0) {
 #ifdef UB_ON_WINDOWS
@@ -1989,7 +2162,8 @@ struct outbound_entry*
 worker_send_query(struct query_info* qinfo, uint16_t flags, int dnssec,
 	int want_dnssec, int nocaps, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* zone, size_t zonelen, int ssl_upstream,
-	char* tls_auth_name, struct module_qstate* q)
+	char* tls_auth_name, struct sockaddr_storage* hedge_addr,
+	socklen_t hedge_addrlen, struct module_qstate* q)
 {
 	struct worker* worker = q->env->worker;
 	struct outbound_entry* e = (struct outbound_entry*)regional_alloc(
@@ -1997,13 +2171,17 @@ worker_send_query(struct query_info* qinfo, uint16_t flags, int dnssec,
 	if(!e) 
 		return NULL;
 	e->qstate = q;
+	if(!mesh_pclass_fetch(q, &e->fetch_count))
+		return NULL;
 	e->qsent = outnet_serviced_query(worker->back, qinfo, flags, dnssec,
 		want_dnssec, nocaps, q->env->cfg->tcp_upstream,
-		ssl_upstream, tls_auth_name, addr, addrlen, zone, zonelen, q,
-		worker_handle_service_reply, e, worker->back->udp_buff, q->env);
+		ssl_upstream, tls_auth_name, addr, addrlen, zone, zonelen,
+		hedge_addr, hedge_addrlen, q, worker_handle_service_reply, e,
+		worker->back->udp_buff, q->env);
 	if(!e->qsent) {
 		return NULL;
 	}
+	(*e->fetch_count)++;
 	return e;
 }
 
@@ -2021,6 +2199,18 @@ void worker_stats_clear(struct worker* worker)
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
 	worker->back->num_tcp_outgoing = 0;
+	worker->back->num_tls_handshake = 0;
+	worker->back->num_tls_resumed = 0;
+	worker->back->num_tls_early_data = 0;
+	worker->back->num_tls_ktls = 0;
+	worker->back->tls_handshake_usec = 0;
+	worker->back->num_udp_outgoing = 0;
+	worker->back->num_udp_sock_reuse = 0;
+	worker->back->num_udp_hedge = 0;
+	worker->back->num_udp_hedge_won = 0;
+	memset(comm_base_udp_batch_stats(worker->base), 0,
+		sizeof(struct comm_udp_batch_stats));
+	(void)server_stats_cache_misses(worker->cache_miss_fd, 1);
 }
 
 void worker_start_accept(void* arg)
@@ -2047,6 +2237,8 @@ struct outbound_entry* libworker_send_query(
 	struct sockaddr_storage* ATTR_UNUSED(addr), socklen_t ATTR_UNUSED(addrlen),
 	uint8_t* ATTR_UNUSED(zone), size_t ATTR_UNUSED(zonelen),
 	int ATTR_UNUSED(ssl_upstream), char* ATTR_UNUSED(tls_auth_name),
+	struct sockaddr_storage* ATTR_UNUSED(hedge_addr),
+	socklen_t ATTR_UNUSED(hedge_addrlen),
 	struct module_qstate* ATTR_UNUSED(q))
 {
 	log_assert(0);
@@ -82,6 +82,8 @@ enum worker_commands {
 struct worker {
 	/** the thread number (in daemon array). First in struct for debug. */
 	int thread_num;
+	/** the NUMA node of the thread, 0 if not numa-aware */
+	int node;
 	/** global shared daemon structure */
 	struct daemon* daemon;
 	/** thread id */
@@ -104,6 +106,8 @@ struct worker {
 	struct comm_point* cmd_com;
 	/** timer for statistics */
 	struct comm_timer* stat_timer;
+	/** hardware counter of the cache misses of the thread, or -1 */
+	int cache_miss_fd;
 	/** ratelimit for errors, time value */
 	time_t err_limit_time;
 	/** ratelimit for errors, packet count */
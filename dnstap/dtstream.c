@@ -61,7 +61,7 @@
 #endif
 
 /** number of messages to process in one output callback */
-#define DTIO_MESSAGES_PER_CALLBACK 100
+#define DTIO_MESSAGES_PER_CALLBACK 128
 /** the msec to wait for reconnect (if not immediate, the first attempt) */
 #define DTIO_RECONNECT_TIMEOUT_MIN 10
 /** the msec to wait for reconnect max after backoff */
@@ -114,33 +114,73 @@ dt_msg_queue_create(struct comm_base* base)
 		return NULL;
 	}
 	lock_basic_init(&mq->lock);
-	lock_protect(&mq->lock, mq, sizeof(*mq));
+	lock_protect(&mq->lock, &mq->dtio, sizeof(mq->dtio));
 	return mq;
 }
 
-/** clear the message list, caller must hold the lock */
+/** read a queue position that is written by the other thread */
+static size_t
+mq_pos_load(struct dt_msg_queue* mq, dt_queue_pos_type* pos)
+{
+#ifdef HAVE_STDATOMIC_H
+	(void)mq;
+	return atomic_load_explicit(pos, memory_order_acquire);
+#else
+	size_t v;
+	lock_basic_lock(&mq->lock);
+	v = *pos;
+	lock_basic_unlock(&mq->lock);
+	return v;
+#endif
+}
+
+/** read a queue position that is only written by the calling thread */
+static size_t
+mq_pos_own(dt_queue_pos_type* pos)
+{
+#ifdef HAVE_STDATOMIC_H
+	return atomic_load_explicit(pos, memory_order_relaxed);
+#else
+	return *pos;
+#endif
+}
+
+/** store a queue position, the other thread can then read it, and the
+ * ring contents written before it */
+static void
+mq_pos_store(struct dt_msg_queue* mq, dt_queue_pos_type* pos, size_t v)
+{
+#ifdef HAVE_STDATOMIC_H
+	(void)mq;
+	atomic_store_explicit(pos, v, memory_order_release);
+#else
+	lock_basic_lock(&mq->lock);
+	*pos = v;
+	lock_basic_unlock(&mq->lock);
+#endif
+}
+
+/** clear the message ring, the queue must not be in use by other threads */
 static void
 dt_msg_queue_clear(struct dt_msg_queue* mq)
 {
-	struct dt_msg_entry* e = mq->first, *next=NULL;
-	while(e) {
-		next = e->next;
-		free(e->buf);
-		free(e);
-		e = next;
+	size_t head = mq_pos_own(&mq->head), tail = mq_pos_own(&mq->tail);
+	while(head != tail) {
+		free(mq->ring[head & (DT_MSG_QUEUE_SIZE-1)].buf);
+		head++;
 	}
-	mq->first = NULL;
-	mq->last = NULL;
-	mq->cursize = 0;
-	mq->msgcount = 0;
+	mq->bytes_in = 0;
+	mq_pos_store(mq, &mq->bytes_out, 0);
+	mq_pos_store(mq, &mq->head, 0);
+	mq_pos_store(mq, &mq->tail, 0);
 }
 
 void
 dt_msg_queue_delete(struct dt_msg_queue* mq)
 {
 	if(!mq) return;
-	lock_basic_destroy(&mq->lock);
 	dt_msg_queue_clear(mq);
+	lock_basic_destroy(&mq->lock);
 	comm_timer_delete(mq->wakeup_timer);
 	free(mq);
 }
@@ -223,6 +263,7 @@ void
 dt_msg_queue_submit(struct dt_msg_queue* mq, void* buf, size_t len)
 {
 	int wakeupnow = 0, wakeupstarttimer = 0;
+	size_t tail, count, cursize;
 	struct dt_msg_entry* entry;
 
 	/* check conditions */
@@ -240,48 +281,35 @@ dt_msg_queue_submit(struct dt_msg_queue* mq, void* buf, size_t len)
 		return;
 	}
 
-	/* allocate memory for queue entry */
-	entry = malloc(sizeof(*entry));
-	if(!entry) {
-		log_err("out of memory logging dnstap");
-		free(buf);
-		return;
-	}
-	entry->next = NULL;
-	entry->buf = buf;
-	entry->len = len;
-
-	/* aqcuire lock */
-	lock_basic_lock(&mq->lock);
+	/* the worker is the only one that moves the tail, the dtio
+	 * thread moves the head, and can take out messages meanwhile,
+	 * that only makes the queue smaller than what is seen here */
+	tail = mq_pos_own(&mq->tail);
+	count = tail - mq_pos_load(mq, &mq->head);
+	cursize = mq->bytes_in - mq_pos_load(mq, &mq->bytes_out);
 	/* if list was empty, start timer for (eventual) wakeup */
-	if(mq->first == NULL)
+	if(count == 0)
 		wakeupstarttimer = 1;
 	/* if list contains more than wakeupnum elements, wakeup now,
 	 * or if list is (going to be) almost full */
-	if(mq->msgcount == DTIO_MSG_FOR_WAKEUP ||
-		(mq->cursize < mq->maxsize * 9 / 10 &&
-		mq->cursize+len >= mq->maxsize * 9 / 10))
+	if(count == DTIO_MSG_FOR_WAKEUP ||
+		(cursize < mq->maxsize * 9 / 10 &&
+		cursize+len >= mq->maxsize * 9 / 10))
 		wakeupnow = 1;
 	/* see if it is going to fit */
-	if(mq->cursize + len > mq->maxsize) {
+	if(count >= DT_MSG_QUEUE_SIZE || cursize + len > mq->maxsize) {
 		/* buffer full, or congested. */
 		/* drop */
-		lock_basic_unlock(&mq->lock);
+		mq->dropped++;
 		free(buf);
-		free(entry);
 		return;
 	}
-	mq->cursize += len;
-	mq->msgcount ++;
-	/* append to list */
-	if(mq->last) {
-		mq->last->next = entry;
-	} else {
-		mq->first = entry;
-	}
-	mq->last = entry;
-	/* release lock */
-	lock_basic_unlock(&mq->lock);
+	entry = &mq->ring[tail & (DT_MSG_QUEUE_SIZE-1)];
+	entry->buf = buf;
+	entry->len = len;
+	mq->bytes_in += len;
+	/* publish the entry to the dtio thread */
+	mq_pos_store(mq, &mq->tail, tail+1);
 
 	if(wakeupnow) {
 		dtio_wakeup(mq->dtio);
@@ -479,52 +507,44 @@ void dt_io_thread_unregister_queue(struct dt_io_thread* dtio,
 	}
 }
 
-/** pick a message from the queue, the routine locks and unlocks,
- * returns true if there is a message */
-static int dt_msg_queue_pop(struct dt_msg_queue* mq, void** buf,
-	size_t* len)
+/** take messages from the queue, at most max of them, into the array.
+ * Only the dtio thread calls this.  returns the number of messages. */
+static int dt_msg_queue_pop_batch(struct dt_msg_queue* mq,
+	struct dt_msg_entry* batch, int max)
 {
-	lock_basic_lock(&mq->lock);
-	if(mq->first) {
-		struct dt_msg_entry* entry = mq->first;
-		mq->first = entry->next;
-		if(!entry->next) mq->last = NULL;
-		mq->cursize -= entry->len;
-		mq->msgcount --;
-		lock_basic_unlock(&mq->lock);
-
-		*buf = entry->buf;
-		*len = entry->len;
-		free(entry);
-		return 1;
+	size_t head = mq_pos_own(&mq->head);
+	size_t tail = mq_pos_load(mq, &mq->tail);
+	size_t bytes = 0;
+	int num = 0;
+	while(head != tail && num < max) {
+		batch[num] = mq->ring[head & (DT_MSG_QUEUE_SIZE-1)];
+		bytes += batch[num].len;
+		head++;
+		num++;
 	}
-	lock_basic_unlock(&mq->lock);
-	return 0;
-}
-
-/** find message in queue, false if no message, true if message to send */
-static int dtio_find_in_queue(struct dt_io_thread* dtio,
-	struct dt_msg_queue* mq)
-{
-	void* buf=NULL;
-	size_t len=0;
-	if(dt_msg_queue_pop(mq, &buf, &len)) {
-		dtio->cur_msg = buf;
-		dtio->cur_msg_len = len;
-		dtio->cur_msg_done = 0;
-		dtio->cur_msg_len_done = 0;
-		return 1;
-	}
-	return 0;
+	if(num == 0)
+		return 0;
+	/* the bytes before the head, so the worker does not see the
+	 * slots as free while the bytes are still counted as in use */
+	mq_pos_store(mq, &mq->bytes_out, mq_pos_own(&mq->bytes_out)+bytes);
+	mq_pos_store(mq, &mq->head, head);
+	return num;
 }
 
-/** find a new message to write, search message queues, false if none */
-static int dtio_find_msg(struct dt_io_thread* dtio)
+/** fill the batch with messages from the queues, false if there are none.
+ * The previous batch must have been written completely. */
+static int dtio_fill_batch(struct dt_io_thread* dtio)
 {
 	struct dt_io_list_item *spot, *item;
+	int i;
+
+	log_assert(dtio->batch_first >= dtio->batch_num);
+	dtio->batch_num = 0;
+	dtio->batch_first = 0;
+	dtio->batch_done = 0;
 
 	spot = dtio->io_list_iter;
-	/* use the next queue for the next message lookup,
+	/* use the next queue for the next batch,
 	 * if we hit the end(NULL) the NULL restarts the iter at start. */
 	if(spot)
 		dtio->io_list_iter = spot->next;
@@ -532,20 +552,33 @@ static int dtio_find_msg(struct dt_io_thread* dtio)
 		dtio->io_list_iter = dtio->io_list->next;
 
 	/* scan from spot to end-of-io_list */
-	item = spot;
-	while(item) {
-		if(dtio_find_in_queue(dtio, item->queue))
-			return 1;
-		item = item->next;
+	for(item = spot; item && dtio->batch_num < DTIO_BATCH_MAX;
+		item = item->next) {
+		dtio->batch_num += dt_msg_queue_pop_batch(item->queue,
+			dtio->batch + dtio->batch_num,
+			DTIO_BATCH_MAX - dtio->batch_num);
 	}
 	/* scan starting at the start-of-list (to wrap around the end) */
-	item = dtio->io_list;
-	while(item) {
-		if(dtio_find_in_queue(dtio, item->queue))
-			return 1;
-		item = item->next;
+	for(item = dtio->io_list; item && item != spot &&
+		dtio->batch_num < DTIO_BATCH_MAX; item = item->next) {
+		dtio->batch_num += dt_msg_queue_pop_batch(item->queue,
+			dtio->batch + dtio->batch_num,
+			DTIO_BATCH_MAX - dtio->batch_num);
 	}
-	return 0;
+	for(i=0; i<dtio->batch_num; i++)
+		dtio->batch_lenfield[i] = htonl((uint32_t)dtio->batch[i].len);
+	return (dtio->batch_num != 0);
+}
+
+/** delete the messages in the batch, and reset counters */
+static void dtio_batch_free(struct dt_io_thread* dtio)
+{
+	int i;
+	for(i=dtio->batch_first; i<dtio->batch_num; i++)
+		free(dtio->batch[i].buf);
+	dtio->batch_num = 0;
+	dtio->batch_first = 0;
+	dtio->batch_done = 0;
 }
 
 /** callback for the dnstap reconnect, to start reconnecting to output */
@@ -688,6 +721,12 @@ static void dtio_close_output(struct dt_io_thread* dtio)
 	if(dtio->cur_msg) {
 		dtio_cur_msg_free(dtio);
 	}
+	if(dtio->batch_first < dtio->batch_num && dtio->batch_done != 0) {
+		free(dtio->batch[dtio->batch_first].buf);
+		dtio->batch[dtio->batch_first].buf = NULL;
+		dtio->batch_first++;
+		dtio->batch_done = 0;
+	}
 
 	dtio->ready_frame_sent = 0;
 	dtio->accept_frame_received = 0;
@@ -945,6 +984,114 @@ static int dtio_write_more(struct dt_io_thread* dtio)
 	return 1;
 }
 
+/** account for r bytes written of the batch, the messages that are
+ * completely written are freed */
+static void dtio_batch_written(struct dt_io_thread* dtio, size_t r)
+{
+	while(r > 0 && dtio->batch_first < dtio->batch_num) {
+		size_t left = 4 + dtio->batch[dtio->batch_first].len -
+			dtio->batch_done;
+		if(r < left) {
+			dtio->batch_done += r;
+			return;
+		}
+		r -= left;
+		free(dtio->batch[dtio->batch_first].buf);
+		dtio->batch[dtio->batch_first].buf = NULL;
+		dtio->batch_first++;
+		dtio->batch_done = 0;
+	}
+}
+
+#ifdef HAVE_WRITEV
+/** write the batch messages up to index last, with one writev call.
+ * returns number of bytes written, 0 if nothing happened,
+ * try again later, or -1 if the channel is to be closed. */
+static ssize_t dtio_write_batch_writev(struct dt_io_thread* dtio, int last)
+{
+	struct iovec iov[DTIO_BATCH_MAX*2];
+	int i, iovnum = 0, iovmax = DTIO_BATCH_MAX*2;
+	size_t done = dtio->batch_done;
+	ssize_t r;
+#ifdef IOV_MAX
+	if(iovmax > IOV_MAX)
+		iovmax = IOV_MAX;
+#endif
+	if(dtio->fd == -1)
+		return -1;
+	for(i=dtio->batch_first; i<last && iovnum+2 <= iovmax; i++) {
+		if(done < 4) {
+			iov[iovnum].iov_base =
+				((uint8_t*)&dtio->batch_lenfield[i])+done;
+			iov[iovnum].iov_len = 4-done;
+			iovnum++;
+			done = 4;
+		}
+		iov[iovnum].iov_base = ((uint8_t*)dtio->batch[i].buf)+(done-4);
+		iov[iovnum].iov_len = dtio->batch[i].len-(done-4);
+		iovnum++;
+		done = 0;
+	}
+	r = writev(dtio->fd, iov, iovnum);
+	if(r == -1) {
+#ifndef USE_WINSOCK
+		if(errno == EINTR || errno == EAGAIN)
+			return 0;
+#else
+		if(WSAGetLastError() == WSAEINPROGRESS)
+			return 0;
+		if(WSAGetLastError() == WSAEWOULDBLOCK) {
+			ub_winsock_tcp_wouldblock((dtio->stop_flush_event?
+				dtio->stop_flush_event:dtio->event),
+				UB_EV_WRITE);
+			return 0;
+		}
+#endif
+		log_err("dnstap io: failed writev: %s", sock_strerror(errno));
+		return -1;
+	}
+	return r;
+}
+#endif /* HAVE_WRITEV */
+
+/** write the batch messages, up to index last (exclusive).
+ * return true if they are done, false if incomplete.  If the channel
+ * is closed, the output is closed and dtio->fd is -1. */
+static int dtio_write_batch(struct dt_io_thread* dtio, int last)
+{
+	while(dtio->batch_first < last) {
+		ssize_t r;
+#ifdef HAVE_WRITEV
+		if(!dtio->ssl) {
+			/* we try writev for everything.*/
+			r = dtio_write_batch_writev(dtio, last);
+		} else
+#endif /* HAVE_WRITEV */
+		if(dtio->batch_done < 4) {
+			r = dtio_write_buf(dtio, ((uint8_t*)&dtio->
+				batch_lenfield[dtio->batch_first])+
+				dtio->batch_done, 4-dtio->batch_done);
+		} else {
+			struct dt_msg_entry* e = &dtio->batch[
+				dtio->batch_first];
+			r = dtio_write_buf(dtio, ((uint8_t*)e->buf)+
+				(dtio->batch_done-4),
+				e->len-(dtio->batch_done-4));
+		}
+		if(r == -1) {
+			/* close the channel */
+			dtio_del_output_event(dtio);
+			dtio_close_output(dtio);
+			return 0;
+		} else if(r == 0) {
+			/* try again later */
+			return 0;
+		}
+		dtio_batch_written(dtio, (size_t)r);
+	}
+	return 1;
+}
+
 /** Receive bytes from dtio->fd, store in buffer. Returns 0: closed,
  * -1: continue, >0: number of bytes read into buffer */
 static ssize_t receive_bytes(struct dt_io_thread* dtio, void* buf, size_t len) {
@@ -1459,7 +1606,7 @@ static int dtio_ssl_handshake(struct dt_io_thread* dtio,
 void dtio_output_cb(int ATTR_UNUSED(fd), short bits, void* arg)
 {
 	struct dt_io_thread* dtio = (struct dt_io_thread*)arg;
-	int i;
+	int num = 0;
 
 	if(dtio->check_nb_connect) {
 		int connect_err = dtio_check_nb_connect(dtio);
@@ -1493,18 +1640,39 @@ void dtio_output_cb(int ATTR_UNUSED(fd), short bits, void* arg)
 			return;
 	}
 
+	/* the control frame goes first, data frames are only written
+	 * after it */
+	if(dtio->cur_msg) {
+		if(dtio->cur_msg_done < dtio->cur_msg_len) {
+			if(!dtio_write_more(dtio))
+				return;
+		}
+		dtio_cur_msg_free(dtio);
+
+		/* If this is a bidirectional stream the first message will be
+		 * the READY control frame. We can only continue writing after
+		 * receiving an ACCEPT control frame. */
+		if(dtio->is_bidirectional && !dtio->ready_frame_sent) {
+			dtio->ready_frame_sent = 1;
+			(void)dtio_add_output_event_read(dtio);
+			return;
+		}
+	}
+
 	/* loop to process a number of messages.  This improves throughput,
 	 * because selecting on write-event if not needed for busy messages
 	 * (dnstap log) generation and if they need to all be written back.
+	 * The messages are taken from the queues in batches, and a batch
+	 * is written with one writev call.
 	 * The write event is usually not blocked up.  But not forever,
 	 * because the event loop needs to stay responsive for other events.
 	 * If there are no (more) messages, or if the output buffers get
 	 * full, it returns out of the loop. */
-	for(i=0; i<DTIO_MESSAGES_PER_CALLBACK; i++) {
+	while(num < DTIO_MESSAGES_PER_CALLBACK) {
 		/* see if there are messages that need writing */
-		if(!dtio->cur_msg) {
-			if(!dtio_find_msg(dtio)) {
-				if(i == 0) {
+		if(dtio->batch_first >= dtio->batch_num) {
+			if(!dtio_fill_batch(dtio)) {
+				if(num == 0) {
 					/* no messages on the first iteration,
 					 * the queues are all empty */
 					dtio_sleep(dtio);
@@ -1512,24 +1680,11 @@ void dtio_output_cb(int ATTR_UNUSED(fd), short bits, void* arg)
 				return; /* nothing to do */
 			}
 		}
+		num += dtio->batch_num - dtio->batch_first;
 
 		/* write it */
-		if(dtio->cur_msg_done < dtio->cur_msg_len) {
-			if(!dtio_write_more(dtio))
-				return;
-		}
-
-		/* done with the current message */
-		dtio_cur_msg_free(dtio);
-
-		/* If this is a bidirectional stream the first message will be
-		 * the READY control frame. We can only continue writing after
-		 * receiving an ACCEPT control frame. */
-		if(dtio->is_bidirectional && !dtio->ready_frame_sent) {
-			dtio->ready_frame_sent = 1;
-			(void)dtio_add_output_event_read(dtio);
-			break;
-		}
+		if(!dtio_write_batch(dtio, dtio->batch_num))
+			return;
 	}
 }
 
@@ -1745,6 +1900,19 @@ void dtio_stop_ev_cb(int ATTR_UNUSED(fd), short bits, void* arg)
 			"last frame");
 		dtio_cur_msg_free(dtio);
 	}
+	/* write remainder of the partially written data frame */
+	if(dtio->batch_first < dtio->batch_num && dtio->batch_done != 0) {
+		if(!dtio_write_batch(dtio, dtio->batch_first+1)) {
+			if(dtio->fd == -1) {
+				verbose(VERB_ALGO, "dnstap io: "
+					"stop flush: output closed");
+				dtio_stop_flush_exit(info);
+			}
+			return;
+		}
+		verbose(VERB_ALGO, "dnstap io: stop flush completed "
+			"last data frame");
+	}
 	/* write stop frame */
 	if(info->stop_frame_done < info->stop_frame_len) {
 		if(!dtio_control_stop_send(info))
@@ -1864,6 +2032,7 @@ static void dtio_desetup(struct dt_io_thread* dtio)
 	dtio_reconnect_del(dtio);
 	ub_event_free(dtio->reconnect_timer);
 	dtio_cur_msg_free(dtio);
+	dtio_batch_free(dtio);
 #ifndef THREADS_DISABLED
 	ub_event_base_free(dtio->event_base);
 #endif
@@ -45,52 +45,83 @@
 #define DTSTREAM_H
 
 #include "util/locks.h"
+#ifdef HAVE_STDATOMIC_H
+#include <stdatomic.h>
+#endif
 struct dt_msg_entry;
 struct dt_io_list_item;
 struct dt_io_thread;
 struct config_file;
 struct comm_base;
 
+/** number of message slots in the per-worker queue, a power of two */
+#define DT_MSG_QUEUE_SIZE 16384
+/** size of a cache line, the queue keeps the fields written by the worker
+ * and the fields written by the io thread on different cache lines */
+#define DT_CACHE_LINE 64
+/** number of messages the io thread takes out of the queues and writes
+ * in one go */
+#define DTIO_BATCH_MAX 64
+
+#ifdef HAVE_STDATOMIC_H
+/** queue position that is written by one thread and read by the other */
+typedef _Atomic size_t dt_queue_pos_type;
+#else
+/** queue position, without atomics it is accessed under the queue lock */
+typedef size_t dt_queue_pos_type;
+#endif
+
+/**
+ * An entry in the dt_msg_queue. contains one DNSTAP message.
+ */
+struct dt_msg_entry {
+	/** the buffer with the data to send, an encoded DNSTAP message */
+	void* buf;
+	/** the length to send. */
+	size_t len;
+};
+
 /**
  * A message buffer with dnstap messages queued up.  It is per-worker.
- * It has locks to synchronize.  If the buffer is full, a new message
- * cannot be added and is discarded.  A thread reads the messages and sends
- * them.
+ * It is a ring of message slots, with the worker as the only producer
+ * and the dtio thread as the only consumer, so adding and removing
+ * messages does not need a lock; the positions in the ring are atomic.
+ * If the buffer is full, a new message cannot be added and is discarded.
+ * A thread reads the messages and sends them.
  */
 struct dt_msg_queue {
-	/** lock of the buffer structure.  Hold this lock to add or remove
-	 * entries to the buffer.  Release it so that other threads can also
-	 * put messages to log, or a message can be taken out to send away
-	 * by the writer thread.
-	 */
+	/** lock on the dtio reference.  Without stdatomic.h it also
+	 * protects the positions in the ring. */
 	lock_basic_type lock;
 	/** the maximum size of the buffer, in bytes */
 	size_t maxsize;
-	/** current size of the buffer, in bytes.  data bytes of messages.
-	 * If a new message make it more than maxsize, the buffer is full */
-	size_t cursize;
-	/** number of messages in the queue */
-	int msgcount;
-	/** list of messages.  The messages are added to the back and taken
-	 * out from the front. */
-	struct dt_msg_entry* first, *last;
 	/** reference to the io thread to wakeup */
 	struct dt_io_thread* dtio;
 	/** the wakeup timer for dtio, on worker event base */
 	struct comm_timer* wakeup_timer;
-};
-
-/**
- * An entry in the dt_msg_queue. contains one DNSTAP message.
- * It is malloced.
- */
-struct dt_msg_entry {
-	/** next in the list. */
-	struct dt_msg_entry* next;
-	/** the buffer with the data to send, an encoded DNSTAP message */
-	void* buf;
-	/** the length to send. */
-	size_t len;
+	/** the message slots, the messages from head to tail are in use */
+	struct dt_msg_entry ring[DT_MSG_QUEUE_SIZE];
+
+	/** padding between the shared fields and the producer fields */
+	uint8_t pad_prod[DT_CACHE_LINE];
+	/** producer: position of the next message to add, counts up */
+	dt_queue_pos_type tail;
+	/** producer: number of data bytes added, only used by the worker */
+	size_t bytes_in;
+	/** producer: number of messages dropped because the buffer was
+	 * full, only used by the worker */
+	size_t dropped;
+
+	/** padding between the producer and the consumer fields */
+	uint8_t pad_cons[DT_CACHE_LINE];
+	/** consumer: position of the next message to take out, counts up */
+	dt_queue_pos_type head;
+	/** consumer: number of data bytes taken out.  The current size of
+	 * the buffer is bytes_in - bytes_out, if a new message makes it
+	 * more than maxsize, the buffer is full. */
+	dt_queue_pos_type bytes_out;
+	/** padding after the consumer fields */
+	uint8_t pad_end[DT_CACHE_LINE];
 };
 
 /**
@@ -171,6 +202,20 @@ struct dt_io_thread {
 	 * for the current message length that precedes the frame */
 	size_t cur_msg_len_done;
 
+	/** the data messages taken from the queues that are being written,
+	 * they are written together, with writev if possible */
+	struct dt_msg_entry batch[DTIO_BATCH_MAX];
+	/** the frame lengths of the batch messages, in network order */
+	uint32_t batch_lenfield[DTIO_BATCH_MAX];
+	/** number of messages in the batch */
+	int batch_num;
+	/** index of the first message in the batch that is not yet
+	 * completely written */
+	int batch_first;
+	/** number of bytes written of that message, this includes the
+	 * length that precedes the frame */
+	size_t batch_done;
+
 	/** lock on wakeup_timer_enabled */
 	lock_basic_type wakeup_timer_lock;
 	/** if wakeup timer is enabled in some thread */
@@ -255,9 +300,10 @@ struct dt_msg_queue* dt_msg_queue_create(struct comm_base* base);
 void dt_msg_queue_delete(struct dt_msg_queue* mq);
 
 /**
- * Submit a message to the queue.  The queue is locked by the routine,
- * the message is inserted, and then the queue is unlocked so the
- * message can be picked up by the writer thread.
+ * Submit a message to the queue.  The message is put in the ring and
+ * the tail is moved, so the message can be picked up by the writer thread.
+ * It must be called by the worker that owns the queue.  If the buffer
+ * is full, the message is dropped and counted in mq->dropped.
  * @param mq: message queue.
  * @param buf: buffer with message (dnstap contents).
  * 	The buffer must have been malloced by caller.  It is linked in
@@ -619,6 +619,22 @@ iter_server_selection(struct iter_env* iter_env,
 	return a;
 }
 
+struct delegpt_addr*
+iter_server_hedge(struct delegpt* dp, struct delegpt_addr* target)
+{
+	struct delegpt_addr* a, *best = NULL;
+	for(a = dp->result_list; a; a = a->next_result) {
+		if(a == target || a->sel_rtt >= USEFUL_SERVER_TOP_TIMEOUT ||
+			a->attempts >= OUTBOUND_MSG_RETRY ||
+			sockaddr_cmp(&a->addr, a->addrlen, &target->addr,
+			target->addrlen) == 0)
+			continue;
+		if(!best || a->sel_rtt < best->sel_rtt)
+			best = a;
+	}
+	return best;
+}
+
 struct dns_msg* 
 dns_alloc_msg(sldns_buffer* pkt, struct msg_parse* msg, 
 	struct regional* region)
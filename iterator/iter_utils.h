@@ -102,6 +102,17 @@ struct delegpt_addr* iter_server_selection(struct iter_env* iter_env,
 	int* chase_to_rd, int open_target, struct sock_list* blacklist,
 	time_t prefetch);
 
+/**
+ * Select the server to send a hedged query to, if the answer from the
+ * target is late.  It is the fastest other server in the result list,
+ * from the ordering made by iter_server_selection.
+ * @param dp: delegation point with result list.
+ * @param target: the selected target.
+ * @return server for the hedged query, or NULL if there is none.
+ */
+struct delegpt_addr* iter_server_hedge(struct delegpt* dp,
+	struct delegpt_addr* target);
+
 /**
  * Allocate dns_msg from parsed msg, in regional.
  * @param pkt: packet.
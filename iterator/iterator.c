@@ -2206,7 +2206,7 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	struct iter_env* ie, int id)
 {
 	int tf_policy;
-	struct delegpt_addr* target;
+	struct delegpt_addr* target, *hedge = NULL;
 	struct outbound_entry* outq;
 	int auth_fallback = 0;
 	uint8_t* qout_orig = NULL;
@@ -2645,6 +2645,11 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 		}
 	}
 
+	/* a hedged query goes to another server if the answer is late */
+	if(qstate->env->cfg->udp_hedge && !qstate->env->cfg->tcp_upstream &&
+		!(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream))
+		hedge = iter_server_hedge(iq->dp, target);
+
 	/* We have a valid target. */
 	if(verbosity >= VERB_QUERY) {
 		log_query_info(VERB_QUERY, "sending query:", &iq->qinfo_out);
@@ -2667,7 +2672,8 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 		ie, iq), &target->addr, target->addrlen,
 		iq->dp->name, iq->dp->namelen,
 		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream),
-		target->tls_auth_name, qstate);
+		target->tls_auth_name, (hedge?&hedge->addr:NULL),
+		(hedge?hedge->addrlen:0), qstate);
 	if(!outq) {
 		log_addr(VERB_QUERY, "error sending query to auth server",
 			&target->addr, target->addrlen);
@@ -93,6 +93,8 @@ context_finalize(struct ub_ctx* ctx)
 		if(!ctx->env->msg_cache)
 			return UB_NOMEM;
 	}
+	slabhash_set_policy(ctx->env->msg_cache,
+		lruhash_policy_from_str(cfg->msg_cache_policy));
 	ctx->env->rrset_cache = rrset_cache_adjust(ctx->env->rrset_cache,
 		ctx->env->cfg, ctx->env->alloc);
 	if(!ctx->env->rrset_cache)
@@ -1318,23 +1318,23 @@ int ub_ctx_zone_add(struct ub_ctx* ctx, const char *zone_name,
 		return UB_SYNTAX;
 	}
 
-	lock_rw_wrlock(&ctx->local_zones->lock);
+	local_zones_wrlock(ctx->local_zones);
 	if((z=local_zones_find(ctx->local_zones, nm, nmlen, nmlabs, 
 		LDNS_RR_CLASS_IN))) {
 		/* already present in tree */
 		lock_rw_wrlock(&z->lock);
 		z->type = t; /* update type anyway */
 		lock_rw_unlock(&z->lock);
-		lock_rw_unlock(&ctx->local_zones->lock);
+		local_zones_wrunlock(ctx->local_zones);
 		free(nm);
 		return UB_NOERROR;
 	}
 	if(!local_zones_add_zone(ctx->local_zones, nm, nmlen, nmlabs, 
 		LDNS_RR_CLASS_IN, t)) {
-		lock_rw_unlock(&ctx->local_zones->lock);
+		local_zones_wrunlock(ctx->local_zones);
 		return UB_NOMEM;
 	}
-	lock_rw_unlock(&ctx->local_zones->lock);
+	local_zones_wrunlock(ctx->local_zones);
 	return UB_NOERROR;
 }
 
@@ -1353,13 +1353,13 @@ int ub_ctx_zone_remove(struct ub_ctx* ctx, const char *zone_name)
 		return UB_SYNTAX;
 	}
 
-	lock_rw_wrlock(&ctx->local_zones->lock);
+	local_zones_wrlock(ctx->local_zones);
 	if((z=local_zones_find(ctx->local_zones, nm, nmlen, nmlabs, 
 		LDNS_RR_CLASS_IN))) {
 		/* present in tree */
 		local_zones_del_zone(ctx->local_zones, z);
 	}
-	lock_rw_unlock(&ctx->local_zones->lock);
+	local_zones_wrunlock(ctx->local_zones);
 	free(nm);
 	return UB_NOERROR;
 }
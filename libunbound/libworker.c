@@ -73,6 +73,9 @@
 #include "iterator/iter_hints.h"
 #include "sldns/sbuffer.h"
 #include "sldns/str2wire.h"
+#ifdef USE_CACHEDB
+#include "cachedb/cachedb.h"
+#endif
 #ifdef USE_DNSTAP
 #include "dnstap/dtstream.h"
 #endif
@@ -94,6 +97,9 @@ libworker_delete_env(struct libworker* w)
 {
 	if(w->env) {
 		outside_network_quit_prepare(w->back);
+#ifdef USE_CACHEDB
+		cachedb_thread_close(w->env);
+#endif
 		mesh_delete(w->env->mesh);
 		context_release_alloc(w->ctx, w->env->alloc, 
 			!w->is_bg || w->is_bg_thread);
@@ -243,7 +249,12 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 		cfg->do_udp || cfg->udp_upstream_without_downstream, w->sslctx,
 		cfg->delay_close, cfg->tls_use_sni, NULL, cfg->udp_connect,
 		cfg->max_reuse_tcp_queries, cfg->tcp_reuse_timeout,
-		cfg->tcp_auth_query_timeout);
+		cfg->tcp_auth_query_timeout, cfg->tls_upstream_resume,
+		cfg->tls_upstream_early_data,
+		cfg->udp_hedge?cfg->udp_hedge_percentile:0,
+		cfg->udp_hedge_max_rate,
+		cfg->udp_upstream_batch?cfg->udp_batch_size:0,
+		cfg->udp_connect_pool, cfg->udp_connect_reuse);
 	w->env->outnet = w->back;
 	if(!w->is_bg || w->is_bg_thread) {
 		lock_basic_unlock(&ctx->cfglock);
@@ -860,6 +871,7 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	uint16_t flags, int dnssec, int want_dnssec, int nocaps,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
 	size_t zonelen, int ssl_upstream, char* tls_auth_name,
+	struct sockaddr_storage* hedge_addr, socklen_t hedge_addrlen,
 	struct module_qstate* q)
 {
 	struct libworker* w = (struct libworker*)q->env->worker;
@@ -868,13 +880,17 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	if(!e)
 		return NULL;
 	e->qstate = q;
+	if(!mesh_pclass_fetch(q, &e->fetch_count))
+		return NULL;
 	e->qsent = outnet_serviced_query(w->back, qinfo, flags, dnssec,
 		want_dnssec, nocaps, q->env->cfg->tcp_upstream, ssl_upstream,
-		tls_auth_name, addr, addrlen, zone, zonelen, q,
-		libworker_handle_service_reply, e, w->back->udp_buff, q->env);
+		tls_auth_name, addr, addrlen, zone, zonelen, hedge_addr,
+		hedge_addrlen, q, libworker_handle_service_reply, e,
+		w->back->udp_buff, q->env);
 	if(!e->qsent) {
 		return NULL;
 	}
+	(*e->fetch_count)++;
 	return e;
 }
 
@@ -955,6 +971,8 @@ struct outbound_entry* worker_send_query(struct query_info* ATTR_UNUSED(qinfo),
 	struct sockaddr_storage* ATTR_UNUSED(addr), socklen_t ATTR_UNUSED(addrlen),
 	uint8_t* ATTR_UNUSED(zone), size_t ATTR_UNUSED(zonelen),
 	int ATTR_UNUSED(ssl_upstream), char* ATTR_UNUSED(tls_auth_name),
+	struct sockaddr_storage* ATTR_UNUSED(hedge_addr),
+	socklen_t ATTR_UNUSED(hedge_addrlen),
 	struct module_qstate* ATTR_UNUSED(q))
 {
 	log_assert(0);
@@ -658,6 +658,8 @@ struct ub_shm_stat_info {
 #define UB_STATS_BUCKET_NUM 40
 /** number of RPZ actions */
 #define UB_STATS_RPZ_ACTION_NUM 10
+/** number of priority classes in stats */
+#define UB_STATS_PCLASS_NUM 8
 
 /** per worker statistics. */
 struct ub_server_stats {
@@ -755,6 +757,22 @@ struct ub_server_stats {
 	long long infra_cache_count;
 	/** number of key cache entries */
 	long long key_cache_count;
+	/** message cache lookups that found an entry */
+	long long msg_cache_hits;
+	/** message cache lookups that did not find an entry */
+	long long msg_cache_misses;
+	/** rrset cache lookups that found an entry */
+	long long rrset_cache_hits;
+	/** rrset cache lookups that did not find an entry */
+	long long rrset_cache_misses;
+	/** infra cache lookups that found an entry */
+	long long infra_cache_hits;
+	/** infra cache lookups that did not find an entry */
+	long long infra_cache_misses;
+	/** key cache lookups that found an entry */
+	long long key_cache_hits;
+	/** key cache lookups that did not find an entry */
+	long long key_cache_misses;
 
 	/** number of queries that used dnscrypt */
 	long long num_query_dnscrypt_crypted;
@@ -795,8 +813,72 @@ struct ub_server_stats {
 	long long mem_http2_response_buffer;
 	/** number of TLS connection resume */
 	long long qtls_resume;
+	/** number of queries over TLS connections with kTLS */
+	long long qtls_ktls;
 	/** RPZ action stats */
 	long long rpz_action[UB_STATS_RPZ_ACTION_NUM];
+	/** number of recvmmsg calls on UDP sockets */
+	long long udp_recvmmsg;
+	/** number of datagrams read with recvmmsg */
+	long long udp_recvmmsg_datagrams;
+	/** number of sendmmsg calls on UDP sockets */
+	long long udp_sendmmsg;
+	/** number of datagrams written with sendmmsg */
+	long long udp_sendmmsg_datagrams;
+	/** number of sendmmsg calls for queries to upstream servers */
+	long long udp_out_sendmmsg;
+	/** number of queries to upstream servers written with sendmmsg */
+	long long udp_out_sendmmsg_datagrams;
+	/** number of dnstap messages dropped because the queue was full */
+	long long dnstap_dropped;
+	/** number of streams open in the shared upstream stream pool */
+	long long tcp_pool_streams;
+	/** number of queries that wait for an answer in the stream pool */
+	long long tcp_pool_inflight;
+	/** number of queries sent over the shared upstream stream pool */
+	long long tcp_pool_queries;
+	/** number of streams opened by the shared upstream stream pool */
+	long long tcp_pool_opened;
+	/** number of TLS handshakes with upstreams */
+	long long tls_upstream_handshake;
+	/** number of TLS handshakes with upstreams that resumed a session */
+	long long tls_upstream_resumed;
+	/** number of TLS handshakes with upstreams that sent early data */
+	long long tls_upstream_early_data;
+	/** number of TLS streams to upstreams with kTLS */
+	long long tls_upstream_ktls;
+	/** time spent in TLS connection setup with upstreams, microseconds */
+	long long tls_upstream_handshake_usec;
+	/** number of UDP queries to upstream servers */
+	long long qudp_outgoing;
+	/** number of hedged UDP queries to upstream servers */
+	long long qudp_hedge;
+	/** number of hedged UDP queries whose answer was used */
+	long long qudp_hedge_won;
+	/** number of UDP queries sent over an already connected socket */
+	long long qudp_sock_reuse;
+	/** number of queries that waited for the same query on another
+	 * thread */
+	long long num_joined;
+	/** number of query states per priority class */
+	long long pclass_states[UB_STATS_PCLASS_NUM];
+	/** number of outstanding upstream queries per priority class */
+	long long pclass_fetches[UB_STATS_PCLASS_NUM];
+	/** number of queries dropped because the priority class was full */
+	long long pclass_dropped[UB_STATS_PCLASS_NUM];
+	/** number of replies sent per priority class */
+	long long pclass_replies[UB_STATS_PCLASS_NUM];
+	/** sum of the waiting times for the replies per priority class,
+	 * in microseconds */
+	long long pclass_wait_usec[UB_STATS_PCLASS_NUM];
+	/** message cache hits on entries of another NUMA node */
+	long long msg_cache_remote;
+	/** rrset cache hits on entries of another NUMA node */
+	long long rrset_cache_remote;
+	/** key cache hits on entries of another NUMA node */
+	long long key_cache_remote;
+	/** hardware cache misses of the thread, with extended statistics */
+	long long cache_misses;
 };
 
 /** 
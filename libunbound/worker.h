@@ -65,6 +65,8 @@ struct query_info;
  * @param ssl_upstream: use SSL for upstream queries.
  * @param tls_auth_name: if ssl_upstream, use this name with TLS
  * 	authentication.
+ * @param hedge_addr: where to send a hedged UDP query, or NULL.
+ * @param hedge_addrlen: length of hedge_addr.
  * @param q: wich query state to reactivate upon return.
  * @return: false on failure (memory or socket related). no query was
  *      sent.
@@ -73,6 +75,7 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	uint16_t flags, int dnssec, int want_dnssec, int nocaps,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
 	size_t zonelen, int ssl_upstream, char* tls_auth_name,
+	struct sockaddr_storage* hedge_addr, socklen_t hedge_addrlen,
 	struct module_qstate* q);
 
 /** process incoming serviced query replies from the network */
@@ -116,6 +119,8 @@ void worker_sighandler(int sig, void* arg);
  * @param ssl_upstream: use SSL for upstream queries.
  * @param tls_auth_name: if ssl_upstream, use this name with TLS
  * 	authentication.
+ * @param hedge_addr: where to send a hedged UDP query, or NULL.
+ * @param hedge_addrlen: length of hedge_addr.
  * @param q: wich query state to reactivate upon return.
  * @return: false on failure (memory or socket related). no query was
  *      sent.
@@ -124,6 +129,7 @@ struct outbound_entry* worker_send_query(struct query_info* qinfo,
 	uint16_t flags, int dnssec, int want_dnssec, int nocaps,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
 	size_t zonelen, int ssl_upstream, char* tls_auth_name,
+	struct sockaddr_storage* hedge_addr, socklen_t hedge_addrlen,
 	struct module_qstate* q);
 
 /** 
@@ -55,6 +55,7 @@
 #include "util/log.h"
 #include "util/module.h"
 #include "util/random.h"
+#include "util/tube.h"
 #include "services/cache/dns.h"
 #include "services/outside_network.h"
 #include "services/listen_dnsport.h"
@@ -95,6 +96,11 @@
 /** number of timeouts before we fallback from IXFR to AXFR,
  * because some versions of servers (eg. dnsmasq) drop IXFR packets. */
 #define NUM_TIMEOUTS_FALLBACK_IXFR 3
+/** max number of parts, parsed by threads at the same time, that an AXFR
+ * is split into when it is loaded */
+#define AUTH_XFR_PARSE_PARTS_MAX 16
+/** an AXFR with fewer chunks than this is parsed in one part */
+#define AUTH_XFR_PARSE_PARTS_MIN_CHUNKS 32
 
 /** pick up nextprobe task to start waiting to perform transfer actions */
 static void xfr_set_timeout(struct auth_xfer* xfr, struct module_env* env,
@@ -108,6 +114,8 @@ static int xfr_start_probe(struct auth_xfer* xfr, struct module_env* env,
 	struct auth_master* spec);
 /** delete xfer structure (not its tree entry) */
 void auth_xfer_delete(struct auth_xfer* xfr);
+/** delete the parse job of a transfer, if it has one */
+static void auth_parse_job_cancel(struct auth_transfer* at);
 
 /** create new dns_msg */
 static struct dns_msg*
@@ -392,6 +400,7 @@ auth_zone_delete(struct auth_zone* z, struct auth_zones* az)
 	if(!z) return;
 	lock_rw_destroy(&z->lock);
 	traverse_postorder(&z->data, auth_data_del, NULL);
+	name_hash_clear(&z->dataidx);
 
 	if(az && z->rpz) {
 		/* keep RPZ linked list intact */
@@ -429,6 +438,7 @@ auth_zone_create(struct auth_zones* az, uint8_t* nm, size_t nmlen,
 		return NULL;
 	}
 	rbtree_init(&z->data, &auth_data_cmp);
+	name_hash_init(&z->dataidx);
 	lock_rw_init(&z->lock);
 	lock_protect(&z->lock, &z->name, sizeof(*z)-sizeof(rbnode_type)-
 			sizeof(&z->rpz_az_next)-sizeof(&z->rpz_az_prev));
@@ -605,6 +615,7 @@ az_domain_create(struct auth_zone* z, uint8_t* nm, size_t nmlen)
 		free(n);
 		return NULL;
 	}
+	name_hash_insert(&z->dataidx, n->name, z->dclass, n);
 	return n;
 }
 
@@ -613,6 +624,9 @@ static struct auth_data*
 az_find_name(struct auth_zone* z, uint8_t* nm, size_t nmlen)
 {
 	struct auth_zone key;
+	if(name_hash_usable(&z->dataidx))
+		return (struct auth_data*)name_hash_lookup(&z->dataidx, nm,
+			z->dclass);
 	key.node.key = &key;
 	key.name = nm;
 	key.namelen = nmlen;
@@ -1301,6 +1315,7 @@ az_remove_rr(struct auth_zone* z, uint8_t* rr, size_t rr_len,
 	/* an rrsets==NULL entry is not kept around for empty nonterminals,
 	 * and also parent nodes are not kept around, so we just delete it */
 	if(node->rrsets == NULL) {
+		name_hash_remove(&z->dataidx, node->name, z->dclass);
 		(void)rbtree_delete(&z->data, node);
 		auth_data_delete(node);
 	}
@@ -1600,6 +1615,7 @@ auth_zone_read_zonefile(struct auth_zone* z, struct config_file* cfg)
 	/* clear the data tree */
 	traverse_postorder(&z->data, auth_data_del, NULL);
 	rbtree_init(&z->data, &auth_data_cmp);
+	name_hash_clear(&z->dataidx);
 	/* clear the RPZ policies */
 	if(z->rpz)
 		rpz_clear(z->rpz);
@@ -2046,9 +2062,10 @@ auth_zones_setup_zones(struct auth_zones* az)
 	return 1;
 }
 
-/** set config items and create zones */
+/** set config items and create zones, num_threads is the number of
+ * query threads that read RPZ zones */
 static int
-auth_zones_cfg(struct auth_zones* az, struct config_auth* c)
+auth_zones_cfg(struct auth_zones* az, struct config_auth* c, int num_threads)
 {
 	struct auth_zone* z;
 	struct auth_xfer* x = NULL;
@@ -2102,6 +2119,11 @@ auth_zones_cfg(struct auth_zones* az, struct config_auth* c)
 			fatal_exit("Could not setup RPZ zones");
 			return 0;
 		}
+		if(!local_zones_set_readers(z->rpz->local_zones,
+			num_threads)) {
+			fatal_exit("Could not setup RPZ zones");
+			return 0;
+		}
 		lock_protect(&z->lock, &z->rpz->local_zones, sizeof(*z->rpz));
 		/* the az->rpz_lock is locked above */
 		z->rpz_az_next = az->rpz_first;
@@ -2200,7 +2222,7 @@ int auth_zones_apply_cfg(struct auth_zones* az, struct config_file* cfg,
 			continue;
 		}
 		*is_rpz = (*is_rpz || p->isrpz);
-		if(!auth_zones_cfg(az, p)) {
+		if(!auth_zones_cfg(az, p, cfg->num_threads)) {
 			log_err("cannot config auth zone %s", p->name);
 			return 0;
 		}
@@ -2283,6 +2305,7 @@ auth_xfer_delete(struct auth_xfer* xfr)
 		free(xfr->task_probe);
 	}
 	if(xfr->task_transfer) {
+		auth_parse_job_cancel(xfr->task_transfer);
 		auth_free_masters(xfr->task_transfer->masters);
 		comm_point_delete(xfr->task_transfer->cp);
 		comm_timer_delete(xfr->task_transfer->timer);
@@ -4912,10 +4935,18 @@ apply_ixfr(struct auth_xfer* xfr, struct auth_zone* z,
 	return 1;
 }
 
-/** apply AXFR to zone in memory. z is locked. false on failure(mallocfail) */
+/** parse the RRs of the AXFR chunks from start up to stop (exclusive,
+ * NULL for the end of the list) and insert them in zone z.
+ * rr_counter is the number of RRs before start in the transfer, the
+ * first SOA starts the transfer and the next SOA ends it.
+ * Sets serial from the start SOA, and at_end if the end of the transfer
+ * is found in this part of the list; have_end_soa if that was the end SOA.
+ * false on failure(mallocfail, parse failure) */
 static int
-apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
-	struct sldns_buffer* scratch_buffer)
+axfr_parse_range(struct auth_zone* z, struct auth_chunk* start,
+	struct auth_chunk* stop, size_t rr_counter,
+	struct sldns_buffer* scratch_buffer, uint32_t* serial, int* at_end,
+	int* have_end_soa)
 {
 	struct auth_chunk* rr_chunk;
 	int rr_num;
@@ -4923,14 +4954,66 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 	uint8_t* rr_dname, *rr_rdata;
 	uint16_t rr_type, rr_class, rr_rdlen;
 	uint32_t rr_ttl;
-	uint32_t serial = 0;
 	size_t rr_nextpos;
-	size_t rr_counter = 0;
-	int have_end_soa = 0;
+
+	*at_end = 0;
+	*have_end_soa = 0;
+	for(rr_chunk = start; rr_chunk != stop; rr_chunk = rr_chunk->next) {
+		if(rr_chunk->len < LDNS_HEADER_SIZE) {
+			/* the RR list ends at a malformed chunk */
+			*at_end = 1;
+			return 1;
+		}
+		rr_pos = 0;
+		for(rr_num = 0; rr_num < (int)LDNS_ANCOUNT(rr_chunk->data);
+			rr_num++) {
+			if(!chunk_rrlist_get_current(rr_chunk, rr_num, rr_pos,
+				&rr_dname, &rr_type, &rr_class, &rr_ttl,
+				&rr_rdlen, &rr_rdata, &rr_nextpos)) {
+				/* failed to parse RR */
+				return 0;
+			}
+			if(verbosity>=7) log_rrlist_position("apply_axfr",
+				rr_chunk, rr_dname, rr_type, rr_counter);
+			if(rr_type == LDNS_RR_TYPE_SOA) {
+				if(rr_counter != 0) {
+					/* end of the axfr */
+					*at_end = 1;
+					*have_end_soa = 1;
+					return 1;
+				}
+				if(rr_rdlen < 22) return 0; /* bad SOA rdlen */
+				*serial = sldns_read_uint32(rr_rdata+rr_rdlen-20);
+			}
+
+			/* add this RR */
+			if(!az_insert_rr_decompress(z, rr_chunk->data,
+				rr_chunk->len, scratch_buffer, rr_dname,
+				rr_type, rr_class, rr_ttl, rr_rdata, rr_rdlen,
+				NULL)) {
+				/* failed, malloc error or so */
+				return 0;
+			}
+
+			rr_counter++;
+			rr_pos = rr_nextpos;
+		}
+	}
+	return 1;
+}
+
+/** apply AXFR to zone in memory. z is locked. false on failure(mallocfail) */
+static int
+apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
+	struct sldns_buffer* scratch_buffer)
+{
+	uint32_t serial = 0;
+	int at_end = 0, have_end_soa = 0;
 
 	/* clear the data tree */
 	traverse_postorder(&z->data, auth_data_del, NULL);
 	rbtree_init(&z->data, &auth_data_cmp);
+	name_hash_clear(&z->dataidx);
 	/* clear the RPZ policies */
 	if(z->rpz)
 		rpz_clear(z->rpz);
@@ -4940,38 +5023,9 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 
 	/* insert all RRs in to the zone */
 	/* insert the SOA only once, skip the last one */
-	/* start RR iterator over chunklist of packets */
-	chunk_rrlist_start(xfr, &rr_chunk, &rr_num, &rr_pos);
-	while(!chunk_rrlist_end(rr_chunk, rr_num)) {
-		if(!chunk_rrlist_get_current(rr_chunk, rr_num, rr_pos,
-			&rr_dname, &rr_type, &rr_class, &rr_ttl, &rr_rdlen,
-			&rr_rdata, &rr_nextpos)) {
-			/* failed to parse RR */
-			return 0;
-		}
-		if(verbosity>=7) log_rrlist_position("apply_axfr",
-			rr_chunk, rr_dname, rr_type, rr_counter);
-		if(rr_type == LDNS_RR_TYPE_SOA) {
-			if(rr_counter != 0) {
-				/* end of the axfr */
-				have_end_soa = 1;
-				break;
-			}
-			if(rr_rdlen < 22) return 0; /* bad SOA rdlen */
-			serial = sldns_read_uint32(rr_rdata+rr_rdlen-20);
-		}
-
-		/* add this RR */
-		if(!az_insert_rr_decompress(z, rr_chunk->data, rr_chunk->len,
-			scratch_buffer, rr_dname, rr_type, rr_class, rr_ttl,
-			rr_rdata, rr_rdlen, NULL)) {
-			/* failed, malloc error or so */
-			return 0;
-		}
-
-		rr_counter++;
-		chunk_rrlist_gonext(&rr_chunk, &rr_num, &rr_pos, rr_nextpos);
-	}
+	if(!axfr_parse_range(z, xfr->task_transfer->chunks_first, NULL, 0,
+		scratch_buffer, &serial, &at_end, &have_end_soa))
+		return 0;
 	if(!have_end_soa) {
 		log_err("no end SOA record for AXFR");
 		return 0;
@@ -4982,24 +5036,11 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 	return 1;
 }
 
-/** apply HTTP to zone in memory. z is locked. false on failure(mallocfail) */
+/** check the HTTP download before it is applied, false if it is not a
+ * zonefile */
 static int
-apply_http(struct auth_xfer* xfr, struct auth_zone* z,
-	struct sldns_buffer* scratch_buffer)
+http_download_check(struct auth_xfer* xfr, struct sldns_buffer* scratch_buffer)
 {
-	/* parse data in chunks */
-	/* parse RR's and read into memory. ignore $INCLUDE from the
-	 * downloaded file*/
-	struct sldns_file_parse_state pstate;
-	struct auth_chunk* chunk;
-	size_t chunk_pos;
-	memset(&pstate, 0, sizeof(pstate));
-	pstate.default_ttl = 3600;
-	if(xfr->namelen < sizeof(pstate.origin)) {
-		pstate.origin_len = xfr->namelen;
-		memmove(pstate.origin, xfr->name, xfr->namelen);
-	}
-
 	if(verbosity >= VERB_ALGO)
 		verbose(VERB_ALGO, "http download %s of size %d",
 		xfr->task_transfer->master->file,
@@ -5027,16 +5068,27 @@ apply_http(struct auth_xfer* xfr, struct auth_zone* z,
 			sldns_buffer_begin(scratch_buffer));
 		return 0;
 	}
+	return 1;
+}
 
-	/* clear the data tree */
-	traverse_postorder(&z->data, auth_data_del, NULL);
-	rbtree_init(&z->data, &auth_data_cmp);
-	/* clear the RPZ policies */
-	if(z->rpz)
-		rpz_clear(z->rpz);
-
-	xfr->have_zone = 0;
-	xfr->serial = 0;
+/** parse the lines of the HTTP download and add the RRs to zone z.
+ * false on failure(mallocfail, parse failure) */
+static int
+http_parse_lines(struct auth_xfer* xfr, struct auth_zone* z,
+	struct sldns_buffer* scratch_buffer)
+{
+	/* parse data in chunks */
+	/* parse RR's and read into memory. ignore $INCLUDE from the
+	 * downloaded file*/
+	struct sldns_file_parse_state pstate;
+	struct auth_chunk* chunk;
+	size_t chunk_pos;
+	memset(&pstate, 0, sizeof(pstate));
+	pstate.default_ttl = 3600;
+	if(xfr->namelen < sizeof(pstate.origin)) {
+		pstate.origin_len = xfr->namelen;
+		memmove(pstate.origin, xfr->name, xfr->namelen);
+	}
 
 	chunk = xfr->task_transfer->chunks_first;
 	chunk_pos = 0;
@@ -5066,6 +5118,707 @@ apply_http(struct auth_xfer* xfr, struct auth_zone* z,
 	return 1;
 }
 
+/** apply HTTP to zone in memory. z is locked. false on failure(mallocfail) */
+static int
+apply_http(struct auth_xfer* xfr, struct auth_zone* z,
+	struct sldns_buffer* scratch_buffer)
+{
+	if(!http_download_check(xfr, scratch_buffer))
+		return 0;
+
+	/* clear the data tree */
+	traverse_postorder(&z->data, auth_data_del, NULL);
+	rbtree_init(&z->data, &auth_data_cmp);
+	name_hash_clear(&z->dataidx);
+	/* clear the RPZ policies */
+	if(z->rpz)
+		rpz_clear(z->rpz);
+
+	xfr->have_zone = 0;
+	xfr->serial = 0;
+
+	return http_parse_lines(xfr, z, scratch_buffer);
+}
+
+/** create a zone tree that is filled with the contents of a transfer,
+ * while the zone itself keeps answering from the old contents.  It has
+ * no RPZ and no lock, it is only used by the worker doing the transfer,
+ * or the parse thread it handed the transfer to.  The name is not owned,
+ * it is not freed with the tree. */
+static struct auth_zone*
+az_staged_create(uint8_t* name, size_t namelen, int namelabs,
+	uint16_t dclass)
+{
+	struct auth_zone* z = (struct auth_zone*)calloc(1, sizeof(*z));
+	if(!z) return NULL;
+	z->node.key = z;
+	z->name = name;
+	z->namelen = namelen;
+	z->namelabs = namelabs;
+	z->dclass = dclass;
+	rbtree_init(&z->data, &auth_data_cmp);
+	name_hash_init(&z->dataidx);
+	return z;
+}
+
+/** delete a staged zone tree and the data in it */
+static void
+az_staged_delete(struct auth_zone* z)
+{
+	if(!z) return;
+	traverse_postorder(&z->data, auth_data_del, NULL);
+	name_hash_clear(&z->dataidx);
+	free(z);
+}
+
+/** swap the contents of the zone with the staged contents.  The zone is
+ * write locked.  Afterwards the staged tree holds the old contents. */
+static void
+az_staged_swap(struct auth_zone* z, struct auth_zone* staged)
+{
+	rbtree_type old = z->data;
+	struct name_hash oldidx = z->dataidx;
+	z->data = staged->data;
+	staged->data = old;
+	z->dataidx = staged->dataidx;
+	staged->dataidx = oldidx;
+}
+
+/** argument for merging the trees of AXFR parts */
+struct az_merge_arg {
+	/** the zone tree the nodes are moved into */
+	struct auth_zone* z;
+	/** set if a malloc failed */
+	int fail;
+};
+
+/** traverse_postorder callback that moves a domain node into the zone
+ * tree.  If the name is already there, because the RRs of the name are
+ * split over parts, the RRs are added to it and the node is deleted. */
+static void
+az_merge_node(rbnode_type* n, void* arg)
+{
+	struct az_merge_arg* m = (struct az_merge_arg*)arg;
+	struct auth_data* node = (struct auth_data*)n->key, *exist;
+	struct auth_rrset* rrset;
+	size_t i;
+	exist = az_find_name(m->z, node->name, node->namelen);
+	if(!exist) {
+		(void)rbtree_insert(&m->z->data, &node->node);
+		name_hash_insert(&m->z->dataidx, node->name, m->z->dclass,
+			node);
+		return;
+	}
+	/* add them one by one, that removes duplicates and puts the
+	 * RRSIGs with the rrset they cover */
+	for(rrset = node->rrsets; rrset && !m->fail; rrset = rrset->next) {
+		for(i=0; i<rrset->data->count+rrset->data->rrsig_count; i++) {
+			uint16_t tp = (i < rrset->data->count)?rrset->type:
+				LDNS_RR_TYPE_RRSIG;
+			if(!az_domain_add_rr(exist, tp,
+				(uint32_t)rrset->data->rr_ttl[i],
+				rrset->data->rr_data[i],
+				rrset->data->rr_len[i], NULL)) {
+				m->fail = 1;
+				break;
+			}
+		}
+	}
+	auth_data_delete(node);
+}
+
+/** part of an AXFR that is parsed into a tree of its own */
+struct axfr_part {
+	/** next part in the queue of the parse threads */
+	struct axfr_part* next;
+	/** the job the part is in, NULL for a parse on the worker */
+	struct auth_parse_job* job;
+	/** the tree the RRs are inserted into */
+	struct auth_zone* z;
+	/** the first chunk of the part */
+	struct auth_chunk* start;
+	/** the chunk after the part, NULL at end of list */
+	struct auth_chunk* stop;
+	/** RR count before the part, only zero or nonzero is used */
+	size_t rr_counter;
+	/** the serial from the start SOA */
+	uint32_t serial;
+	/** if the end of the transfer is in this part */
+	int at_end;
+	/** if the end of the transfer is the end SOA */
+	int have_end_soa;
+	/** result of the parse, false on failure */
+	int result;
+};
+
+/** state of an AXFR parse job */
+enum auth_parse_job_state {
+	/** its parts are in the queue, or a parse thread works on them */
+	auth_parse_job_busy = 0,
+	/** parsed and merged, in the done list of the connection */
+	auth_parse_job_done,
+	/** taken from the done list by the worker */
+	auth_parse_job_taken
+};
+
+/**
+ * An AXFR that is parsed by the parse threads.  It owns the chunks of the
+ * transfer and the trees of the parts, so that the transfer can be
+ * deleted while the parse is busy.
+ */
+struct auth_parse_job {
+	/** next in the done list */
+	struct auth_parse_job* next;
+	/** previous in the done list */
+	struct auth_parse_job* prev;
+	/** state, protected by the pool lock */
+	enum auth_parse_job_state state;
+	/** the transfer is gone, the parse thread deletes the job */
+	int cancelled;
+	/** number of parts in the queue or with a parse thread, protected
+	 * by the pool lock.  The thread that finishes the last part merges
+	 * the parts. */
+	int busy;
+	/** the connection of the worker that owns the transfer */
+	struct auth_parse_conn* conn;
+	/** the transfer, only used on the worker */
+	struct auth_xfer* xfr;
+	/** the zone name, the trees point to it */
+	uint8_t* name;
+	/** the chunks of the transfer */
+	struct auth_chunk* chunks;
+	/** the parts */
+	struct axfr_part part[AUTH_XFR_PARSE_PARTS_MAX];
+	/** number of parts */
+	int numparts;
+	/** the number of chunks, for the log */
+	size_t numchunks;
+	/** the result, the merged tree, or NULL on failure */
+	struct auth_zone* z;
+	/** the serial of the zone in the result */
+	uint32_t serial;
+};
+
+/** split the chunks of an AXFR into parts and create their trees.
+ * false on malloc failure, the created trees are in the parts */
+static int
+axfr_parts_setup(struct axfr_part* part, int numparts,
+	struct auth_chunk* first, size_t numchunks, uint8_t* name,
+	size_t namelen, int namelabs, uint16_t dclass)
+{
+	struct auth_chunk* c = first;
+	size_t per = (numchunks + numparts - 1) / numparts, i;
+	int p;
+	for(p=0; p<numparts; p++) {
+		part[p].start = c;
+		for(i=0; i<per && c; i++)
+			c = c->next;
+		part[p].stop = c;
+		part[p].rr_counter = (p==0?0:1);
+		part[p].z = az_staged_create(name, namelen, namelabs, dclass);
+		if(!part[p].z) {
+			log_err("out of memory parsing AXFR");
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/** parse a part of the AXFR */
+static void
+axfr_part_parse(struct axfr_part* part, struct sldns_buffer* buf)
+{
+	part->result = axfr_parse_range(part->z, part->start, part->stop,
+		part->rr_counter, buf, &part->serial, &part->at_end,
+		&part->have_end_soa);
+}
+
+/** merge the parsed parts in order, up to the end of the transfer.
+ * Deletes the trees of the parts.
+ * returns the merged tree or NULL on failure */
+static struct auth_zone*
+axfr_parts_merge(struct axfr_part* part, int numparts, uint32_t* serial)
+{
+	struct auth_zone* z = part[0].z;
+	struct az_merge_arg m;
+	int p, ok = 1, have_end_soa = 0;
+	m.z = z;
+	m.fail = 0;
+	for(p=0; p<numparts; p++) {
+		if(!part[p].result) {
+			ok = 0;
+			break;
+		}
+		if(p > 0) {
+			traverse_postorder(&part[p].z->data, az_merge_node,
+				&m);
+			rbtree_init(&part[p].z->data, &auth_data_cmp);
+			name_hash_clear(&part[p].z->dataidx);
+			if(m.fail) {
+				log_err("out of memory parsing AXFR");
+				ok = 0;
+				break;
+			}
+		}
+		if(part[p].at_end) {
+			have_end_soa = part[p].have_end_soa;
+			break;
+		}
+	}
+	if(ok && !have_end_soa) {
+		log_err("no end SOA record for AXFR");
+		ok = 0;
+	}
+	*serial = part[0].serial;
+	for(p=0; p<numparts; p++) {
+		if(p != 0 || !ok)
+			az_staged_delete(part[p].z);
+		part[p].z = NULL;
+	}
+	if(!ok)
+		return NULL;
+	return z;
+}
+
+/** parse AXFR into a staged zone tree, that is not in use by queries,
+ * on the worker.  returns staged tree or NULL on failure */
+static struct auth_zone*
+axfr_build_staged(struct auth_xfer* xfr, struct module_env* env,
+	uint32_t* serial)
+{
+	struct axfr_part part;
+	struct auth_chunk* c;
+	size_t numchunks = 0;
+	memset(&part, 0, sizeof(part));
+	for(c = xfr->task_transfer->chunks_first; c; c = c->next)
+		numchunks++;
+	if(!axfr_parts_setup(&part, 1, xfr->task_transfer->chunks_first,
+		numchunks, xfr->name, xfr->namelen, xfr->namelabs,
+		xfr->dclass)) {
+		az_staged_delete(part.z);
+		return NULL;
+	}
+	axfr_part_parse(&part, env->scratch_buffer);
+	return axfr_parts_merge(&part, 1, serial);
+}
+
+/** free the chunks of a job */
+static void
+auth_parse_job_chunks_free(struct auth_parse_job* job)
+{
+	struct auth_chunk* c = job->chunks, *cn;
+	while(c) {
+		cn = c->next;
+		free(c->data);
+		free(c);
+		c = cn;
+	}
+	job->chunks = NULL;
+}
+
+/** free a job and its contents, it is not in a list */
+static void
+auth_parse_job_free(struct auth_parse_job* job)
+{
+	int p;
+	if(!job)
+		return;
+	for(p=0; p<job->numparts; p++)
+		az_staged_delete(job->part[p].z);
+	az_staged_delete(job->z);
+	auth_parse_job_chunks_free(job);
+	free(job->name);
+	free(job);
+}
+
+/** remove the queued parts of a job from the queue, with the lock */
+static void
+auth_parse_job_unqueue(struct auth_parse_pool* pool,
+	struct auth_parse_job* job)
+{
+	struct axfr_part** pp = &pool->queue_first;
+	pool->queue_last = NULL;
+	while(*pp) {
+		if((*pp)->job == job) {
+			*pp = (*pp)->next;
+			job->busy--;
+			pool->queue_num--;
+			continue;
+		}
+		pool->queue_last = *pp;
+		pp = &(*pp)->next;
+	}
+}
+
+/** put the job in the done list of its connection, with the lock */
+static void
+auth_parse_job_put_done(struct auth_parse_job* job)
+{
+	struct auth_parse_conn* conn = job->conn;
+	uint8_t msg = 0;
+	int wake = (conn->done_first == NULL);
+	job->state = auth_parse_job_done;
+	job->next = NULL;
+	job->prev = conn->done_last;
+	if(conn->done_last)
+		conn->done_last->next = job;
+	else	conn->done_first = job;
+	conn->done_last = job;
+	/* the worker is woken up once for the list, it takes all jobs */
+	if(wake && !tube_write_msg(conn->tube, &msg, sizeof(msg), 0))
+		log_err("auth parse: could not wake up worker");
+}
+
+/** take the first part from the queue, with the lock */
+static struct axfr_part*
+auth_parse_queue_pop(struct auth_parse_pool* pool)
+{
+	struct axfr_part* part = pool->queue_first;
+	if(!part)
+		return NULL;
+	pool->queue_first = part->next;
+	if(!part->next)
+		pool->queue_last = NULL;
+	pool->queue_num--;
+	part->next = NULL;
+	return part;
+}
+
+/** the parse thread function */
+static void*
+auth_parse_thread(void* arg)
+{
+	struct auth_parse_thr* thr = (struct auth_parse_thr*)arg;
+	struct auth_parse_pool* pool = thr->pool;
+	log_thread_set(&thr->thread_num);
+	ub_thread_blocksigs();
+	verbose(VERB_ALGO, "start zone transfer parse thread");
+	for(;;) {
+		struct axfr_part* part;
+		struct auth_parse_job* job;
+		uint8_t* msg = NULL;
+		uint32_t len = 0;
+		int r, cancelled;
+		/* wait for a part, one thread reads the tube at a time */
+		lock_basic_lock(&pool->read_lock);
+		r = tube_read_msg(pool->tube, &msg, &len, 0);
+		lock_basic_unlock(&pool->read_lock);
+		free(msg);
+		lock_basic_lock(&pool->lock);
+		if(!r || pool->quit) {
+			if(!pool->quit)
+				log_err("zone transfer parse thread: could "
+					"not read tube, thread stops");
+			lock_basic_unlock(&pool->lock);
+			break;
+		}
+		/* the job may have been deleted while it was queued */
+		if(!(part = auth_parse_queue_pop(pool))) {
+			lock_basic_unlock(&pool->lock);
+			continue;
+		}
+		job = part->job;
+		cancelled = job->cancelled;
+		lock_basic_unlock(&pool->lock);
+
+		if(!cancelled)
+			axfr_part_parse(part, thr->buf);
+
+		lock_basic_lock(&pool->lock);
+		if(job->busy > 1) {
+			job->busy--;
+			lock_basic_unlock(&pool->lock);
+			continue;
+		}
+		if(job->cancelled) {
+			lock_basic_unlock(&pool->lock);
+			auth_parse_job_free(job);
+			continue;
+		}
+		lock_basic_unlock(&pool->lock);
+
+		/* the last part is done, merge them on this thread, the
+		 * job stays busy meanwhile */
+		job->z = axfr_parts_merge(job->part, job->numparts,
+			&job->serial);
+		/* the trees are merged, the chunks are not needed */
+		auth_parse_job_chunks_free(job);
+
+		lock_basic_lock(&pool->lock);
+		job->busy = 0;
+		if(job->cancelled) {
+			lock_basic_unlock(&pool->lock);
+			auth_parse_job_free(job);
+			continue;
+		}
+		auth_parse_job_put_done(job);
+		lock_basic_unlock(&pool->lock);
+	}
+	verbose(VERB_ALGO, "stop zone transfer parse thread");
+	return NULL;
+}
+
+struct auth_parse_pool*
+auth_parse_pool_create(struct config_file* cfg, int num, int thread_num)
+{
+	int i;
+	struct auth_parse_pool* pool = (struct auth_parse_pool*)calloc(1,
+		sizeof(*pool));
+	if(!pool)
+		return NULL;
+	if(num > AUTH_XFR_PARSE_PARTS_MAX)
+		num = AUTH_XFR_PARSE_PARTS_MAX;
+	lock_basic_init(&pool->lock);
+	lock_basic_init(&pool->read_lock);
+	lock_protect(&pool->lock, &pool->queue_first, sizeof(pool->queue_first)
+		+ sizeof(pool->queue_last) + sizeof(pool->queue_num)
+		+ sizeof(pool->quit));
+	pool->tube = tube_create();
+	pool->thr = (struct auth_parse_thr*)calloc((size_t)num,
+		sizeof(*pool->thr));
+	if(!pool->tube || !pool->thr) {
+		auth_parse_pool_delete(pool);
+		return NULL;
+	}
+	pool->num = num;
+	for(i=0; i<num; i++) {
+		pool->thr[i].pool = pool;
+		pool->thr[i].thread_num = thread_num+i;
+		pool->thr[i].buf = sldns_buffer_new(cfg->msg_buffer_size);
+		if(!pool->thr[i].buf) {
+			auth_parse_pool_delete(pool);
+			return NULL;
+		}
+	}
+	/* the threads get the CPU affinity of the caller, that is not
+	 * pinned to the CPU of a worker */
+	for(i=0; i<num; i++) {
+		ub_thread_create(&pool->thr[i].tid, auth_parse_thread,
+			&pool->thr[i]);
+		pool->num_started++;
+	}
+	verbose(VERB_ALGO, "started %d zone transfer parse threads", num);
+	return pool;
+}
+
+void
+auth_parse_pool_delete(struct auth_parse_pool* pool)
+{
+	int i;
+	if(!pool)
+		return;
+	if(pool->num_started > 0) {
+		uint8_t msg = 0;
+		lock_basic_lock(&pool->lock);
+		pool->quit = 1;
+		for(i=0; i<pool->num_started; i++) {
+			if(!tube_write_msg(pool->tube, &msg, sizeof(msg), 0))
+				log_err("auth parse: could not stop thread");
+		}
+		lock_basic_unlock(&pool->lock);
+		for(i=0; i<pool->num_started; i++)
+			ub_thread_join(pool->thr[i].tid);
+	}
+	/* the transfers of the jobs are gone, with the workers */
+	lock_basic_lock(&pool->lock);
+	while(pool->queue_first) {
+		struct auth_parse_job* job = pool->queue_first->job;
+		auth_parse_job_unqueue(pool, job);
+		if(job->busy == 0)
+			auth_parse_job_free(job);
+	}
+	lock_basic_unlock(&pool->lock);
+	if(pool->thr) {
+		for(i=0; i<pool->num; i++)
+			sldns_buffer_free(pool->thr[i].buf);
+		free(pool->thr);
+	}
+	tube_delete(pool->tube);
+	lock_basic_destroy(&pool->lock);
+	lock_basic_destroy(&pool->read_lock);
+	free(pool);
+}
+
+struct auth_parse_conn*
+auth_parse_conn_create(struct auth_parse_pool* pool, struct comm_base* base)
+{
+	struct auth_parse_conn* conn = (struct auth_parse_conn*)calloc(1,
+		sizeof(*conn));
+	if(!conn)
+		return NULL;
+	conn->pool = pool;
+	conn->tube = tube_create();
+	if(!conn->tube) {
+		free(conn);
+		return NULL;
+	}
+	if(!tube_setup_bg_listen(conn->tube, base, &auth_parse_conn_handle,
+		conn)) {
+		tube_delete(conn->tube);
+		free(conn);
+		return NULL;
+	}
+	return conn;
+}
+
+void
+auth_parse_conn_delete(struct auth_parse_conn* conn)
+{
+	struct auth_parse_job* job;
+	if(!conn)
+		return;
+	/* jobs that are left have no transfer any more */
+	lock_basic_lock(&conn->pool->lock);
+	while((job = conn->done_first) != NULL) {
+		conn->done_first = job->next;
+		auth_parse_job_free(job);
+	}
+	conn->done_last = NULL;
+	lock_basic_unlock(&conn->pool->lock);
+	tube_delete(conn->tube);
+	free(conn);
+}
+
+/** hand the AXFR to the parse threads.  The chunks are moved to the job.
+ * false if it is not, and it is parsed on the worker */
+static int
+auth_parse_job_submit(struct auth_xfer* xfr, struct module_env* env)
+{
+	struct auth_parse_conn* conn = env->auth_parse;
+	struct auth_parse_pool* pool;
+	struct auth_parse_job* job;
+	struct auth_chunk* c, *first = xfr->task_transfer->chunks_first;
+	uint8_t msg = 0;
+	size_t numchunks = 0;
+	int p;
+	if(!conn)
+		return 0;
+	pool = conn->pool;
+	for(c = first; c; c = c->next)
+		numchunks++;
+	/* the parts after the first see their SOA as the end SOA,
+	 * so the first RR must be in the first chunk */
+	if(numchunks < AUTH_XFR_PARSE_PARTS_MIN_CHUNKS ||
+		first->len < LDNS_HEADER_SIZE || LDNS_ANCOUNT(first->data) == 0)
+		return 0;
+	job = (struct auth_parse_job*)calloc(1, sizeof(*job));
+	if(!job)
+		return 0;
+	job->conn = conn;
+	job->xfr = xfr;
+	job->numchunks = numchunks;
+	job->numparts = pool->num;
+	job->name = memdup(xfr->name, xfr->namelen);
+	if(!job->name || !axfr_parts_setup(job->part, job->numparts, first,
+		numchunks, job->name, xfr->namelen, xfr->namelabs,
+		xfr->dclass)) {
+		auth_parse_job_free(job);
+		return 0;
+	}
+	/* the job owns the chunks now */
+	job->chunks = first;
+	xfr->task_transfer->chunks_first = NULL;
+	xfr->task_transfer->chunks_last = NULL;
+	xfr->task_transfer->parse_job = job;
+	verbose(VERB_ALGO, "AXFR of %d chunks parsed in %d parts by the "
+		"parse threads", (int)numchunks, job->numparts);
+
+	lock_basic_lock(&pool->lock);
+	job->state = auth_parse_job_busy;
+	for(p=0; p<job->numparts; p++) {
+		job->part[p].job = job;
+		job->part[p].next = NULL;
+		if(pool->queue_last)
+			pool->queue_last->next = &job->part[p];
+		else	pool->queue_first = &job->part[p];
+		pool->queue_last = &job->part[p];
+		pool->queue_num++;
+		job->busy++;
+		if(!tube_write_msg(pool->tube, &msg, sizeof(msg), 0))
+			log_err("auth parse: could not wake up parse thread");
+	}
+	lock_basic_unlock(&pool->lock);
+	return 1;
+}
+
+/** delete the parse job of a transfer, that is deleted or disowned.  If a
+ * parse thread is busy with it, the thread deletes it when it is done. */
+static void
+auth_parse_job_cancel(struct auth_transfer* at)
+{
+	struct auth_parse_job* job = at->parse_job;
+	struct auth_parse_pool* pool;
+	if(!job)
+		return;
+	at->parse_job = NULL;
+	pool = job->conn->pool;
+	lock_basic_lock(&pool->lock);
+	switch(job->state) {
+	case auth_parse_job_busy:
+		auth_parse_job_unqueue(pool, job);
+		if(job->busy > 0) {
+			/* a parse thread deletes it when it is done */
+			job->cancelled = 1;
+			lock_basic_unlock(&pool->lock);
+			return;
+		}
+		break;
+	case auth_parse_job_done:
+		if(job->prev)
+			job->prev->next = job->next;
+		else	job->conn->done_first = job->next;
+		if(job->next)
+			job->next->prev = job->prev;
+		else	job->conn->done_last = job->prev;
+		break;
+	case auth_parse_job_taken:
+	default:
+		break;
+	}
+	lock_basic_unlock(&pool->lock);
+	auth_parse_job_free(job);
+}
+
+/** parse HTTP download into a staged zone tree, that is not in use by
+ * queries. returns staged tree or NULL on failure */
+static struct auth_zone*
+http_build_staged(struct auth_xfer* xfr, struct module_env* env)
+{
+	struct auth_zone* z;
+	if(!http_download_check(xfr, env->scratch_buffer))
+		return NULL;
+	z = az_staged_create(xfr->name, xfr->namelen, xfr->namelabs,
+		xfr->dclass);
+	if(!z) {
+		log_err("out of memory parsing http download");
+		return NULL;
+	}
+	if(!http_parse_lines(xfr, z, env->scratch_buffer)) {
+		az_staged_delete(z);
+		return NULL;
+	}
+	return z;
+}
+
+/** see if the zone for the xfr is an RPZ zone, its policies are built
+ * while the RRs are inserted, so it is loaded in place.  No locks held. */
+static int
+xfr_zone_is_rpz(struct auth_xfer* xfr, struct module_env* env)
+{
+	struct auth_zone* z;
+	int rpz = 0;
+	lock_rw_rdlock(&env->auth_zones->lock);
+	z = auth_zone_find(env->auth_zones, xfr->name, xfr->namelen,
+		xfr->dclass);
+	if(z) {
+		lock_rw_rdlock(&z->lock);
+		rpz = (z->rpz != NULL);
+		lock_rw_unlock(&z->lock);
+	}
+	lock_rw_unlock(&env->auth_zones->lock);
+	return rpz;
+}
+
 /** write http chunks to zonefile to create downloaded file */
 static int
 auth_zone_write_chunks(struct auth_xfer* xfr, const char* fname)
@@ -5181,24 +5934,46 @@ static int xfr_process_reacquire_locks(struct auth_xfer* xfr,
 	return 1;
 }
 
-/** process chunk list and update zone in memory,
+/** update the zone in memory with the staged tree, or if NULL, with the
+ * chunk list.  Called without locks, returns with the xfr lock.
  * return false if it did not work */
 static int
-xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
-	int* ixfr_fail)
+xfr_process_staged(struct auth_xfer* xfr, struct module_env* env,
+	struct auth_zone* staged, uint32_t serial, int* ixfr_fail)
 {
 	struct auth_zone* z;
 
 	/* obtain locks and structures */
-	lock_basic_unlock(&xfr->lock);
 	if(!xfr_process_reacquire_locks(xfr, env, &z)) {
 		/* the zone is gone, ignore xfr results */
+		az_staged_delete(staged);
 		return 0;
 	}
 	/* holding xfr and z locks */
 
 	/* apply data */
-	if(xfr->task_transfer->master->http) {
+	if(staged && z->rpz) {
+		/* the zone was replaced by an RPZ zone, load it in place */
+		az_staged_delete(staged);
+		staged = NULL;
+	}
+	if(staged) {
+		az_staged_swap(z, staged);
+		xfr->have_zone = 0;
+		xfr->serial = 0;
+		if(!xfr->task_transfer->master->http) {
+			xfr->serial = serial;
+			xfr->have_zone = 1;
+		}
+		/* delete the old contents without the locks, queries
+		 * are answered from the new contents */
+		lock_basic_unlock(&xfr->lock);
+		lock_rw_unlock(&z->lock);
+		az_staged_delete(staged);
+		staged = NULL;
+		if(!xfr_process_reacquire_locks(xfr, env, &z))
+			return 0;
+	} else if(xfr->task_transfer->master->http) {
 		if(!apply_http(xfr, z, env->scratch_buffer)) {
 			lock_rw_unlock(&z->lock);
 			verbose(VERB_ALGO, "http from %s: could not store data",
@@ -5279,6 +6054,42 @@ xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
 	return 1;
 }
 
+/** process chunk list and update zone in memory,
+ * return false if it did not work.  If pending is set, the AXFR is
+ * parsed by the parse threads, and the transfer continues when they
+ * are done, in auth_parse_conn_handle */
+static int
+xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
+	int* ixfr_fail, int* pending)
+{
+	struct auth_zone* staged = NULL;
+	uint32_t serial = 0;
+
+	lock_basic_unlock(&xfr->lock);
+	/* a full zone is parsed into a new tree, without holding the zone
+	 * lock, so queries are answered from the old contents meanwhile.
+	 * The task is assigned to us, so it is accessed without the lock */
+	if((xfr->task_transfer->master->http ||
+		!xfr->task_transfer->on_ixfr ||
+		xfr->task_transfer->on_ixfr_is_axfr) &&
+		!xfr_zone_is_rpz(xfr, env)) {
+		if(xfr->task_transfer->master->http)
+			staged = http_build_staged(xfr, env);
+		else if(auth_parse_job_submit(xfr, env)) {
+			lock_basic_lock(&xfr->lock);
+			*pending = 1;
+			return 0;
+		} else	staged = axfr_build_staged(xfr, env, &serial);
+		if(!staged) {
+			lock_basic_lock(&xfr->lock);
+			verbose(VERB_ALGO, "xfr from %s: could not store data",
+				xfr->task_transfer->master->host);
+			return 0;
+		}
+	}
+	return xfr_process_staged(xfr, env, staged, serial, ixfr_fail);
+}
+
 /** disown task_transfer.  caller must hold xfr.lock */
 static void
 xfr_transfer_disown(struct auth_xfer* xfr)
@@ -5964,13 +6775,14 @@ xfer_link_data(sldns_buffer* pkt, struct auth_xfer* xfr)
 	return 1;
 }
 
-/** task transfer.  the list of data is complete. process it and if failed
- * move to next master, if succeeded, end the task transfer */
+/** task transfer.  the data is processed, if failed move to next
+ * master, if succeeded, end the task transfer.  Caller holds xfr lock,
+ * it is released */
 static void
-process_list_end_transfer(struct auth_xfer* xfr, struct module_env* env)
+xfr_transfer_processed(struct auth_xfer* xfr, struct module_env* env,
+	int ok, int ixfr_fail)
 {
-	int ixfr_fail = 0;
-	if(xfr_process_chunk_list(xfr, env, &ixfr_fail)) {
+	if(ok) {
 		/* it worked! */
 		auth_chunks_delete(xfr->task_transfer);
 
@@ -6016,6 +6828,77 @@ process_list_end_transfer(struct auth_xfer* xfr, struct module_env* env)
 	xfr_transfer_nexttarget_or_end(xfr, env);
 }
 
+/** task transfer.  the list of data is complete. process it and if failed
+ * move to next master, if succeeded, end the task transfer */
+static void
+process_list_end_transfer(struct auth_xfer* xfr, struct module_env* env)
+{
+	int ixfr_fail = 0, pending = 0, ok;
+	ok = xfr_process_chunk_list(xfr, env, &ixfr_fail, &pending);
+	if(pending) {
+		/* the parse threads have it, the task stays with us */
+		lock_basic_unlock(&xfr->lock);
+		return;
+	}
+	xfr_transfer_processed(xfr, env, ok, ixfr_fail);
+}
+
+void
+auth_parse_conn_handle(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct auth_parse_conn* conn = (struct auth_parse_conn*)arg;
+	struct auth_parse_job* job;
+	free(msg);
+	if(error != 0)
+		return;
+	/* continue the transfers one by one */
+	for(;;) {
+		struct auth_xfer* xfr;
+		struct auth_zone* staged;
+		struct module_env* env;
+		uint32_t serial;
+		int ixfr_fail = 0, ok;
+		lock_basic_lock(&conn->pool->lock);
+		job = conn->done_first;
+		if(job) {
+			conn->done_first = job->next;
+			if(job->next)
+				job->next->prev = NULL;
+			else	conn->done_last = NULL;
+			job->next = NULL;
+			job->prev = NULL;
+			job->state = auth_parse_job_taken;
+		}
+		lock_basic_unlock(&conn->pool->lock);
+		if(!job)
+			break;
+		xfr = job->xfr;
+		lock_basic_lock(&xfr->lock);
+		log_assert(xfr->task_transfer->parse_job == job);
+		xfr->task_transfer->parse_job = NULL;
+		staged = job->z;
+		serial = job->serial;
+		job->z = NULL;
+		auth_parse_job_free(job);
+		env = xfr->task_transfer->env;
+		if(!env || env->outnet->want_to_quit) {
+			lock_basic_unlock(&xfr->lock);
+			az_staged_delete(staged);
+			continue; /* stop on quit */
+		}
+		if(!staged) {
+			verbose(VERB_ALGO, "xfr from %s: could not store data",
+				xfr->task_transfer->master->host);
+			xfr_transfer_processed(xfr, env, 0, 0);
+			continue;
+		}
+		lock_basic_unlock(&xfr->lock);
+		ok = xfr_process_staged(xfr, env, staged, serial, &ixfr_fail);
+		xfr_transfer_processed(xfr, env, ok, ixfr_fail);
+	}
+}
+
 /** callback for the task_transfer timer */
 void
 auth_xfer_transfer_timer_callback(void* arg)
@@ -6923,6 +7806,7 @@ void auth_zones_cleanup(struct auth_zones* az)
 			xfr_probe_disown(x);
 		}
 		if(x->task_transfer && x->task_transfer->worker != NULL) {
+			auth_parse_job_cancel(x->task_transfer);
 			auth_chunks_delete(x->task_transfer);
 			xfr_transfer_disown(x);
 		}
@@ -44,6 +44,7 @@
 #ifndef SERVICES_AUTHZONE_H
 #define SERVICES_AUTHZONE_H
 #include "util/rbtree.h"
+#include "util/storage/namehash.h"
 #include "util/locks.h"
 #include "services/mesh.h"
 #include "services/rpz.h"
@@ -65,6 +66,11 @@ struct auth_probe;
 struct auth_transfer;
 struct auth_master;
 struct auth_chunk;
+struct auth_parse_job;
+struct axfr_part;
+struct comm_base;
+struct tube;
+struct sldns_buffer;
 
 /**
  * Authoritative zones, shared.
@@ -116,6 +122,8 @@ struct auth_zone {
 	/** auth data for this zone
 	 * rbtree of struct auth_data */
 	rbtree_type data;
+	/** hash index of the names in data, for exact lookups */
+	struct name_hash dataidx;
 
 	/** zonefile name (or NULL for no zonefile) */
 	char* zonefile;
@@ -423,6 +431,9 @@ struct auth_transfer {
 	/** timeout for the transfer.
 	 * on the workers event base. */
 	struct comm_timer* timer;
+	/** the AXFR that the parse threads work on, it owns the chunks.
+	 * NULL if none */
+	struct auth_parse_job* parse_job;
 };
 
 /** list of addresses */
@@ -777,4 +788,102 @@ void auth_zonemd_dnskey_lookup_callback(void* arg, int rcode,
 void auth_zones_pickup_zonemd_verify(struct auth_zones* az,
 	struct module_env* env);
 
+/**
+ * The connection of a worker to the zone transfer parse threads.  Parsed
+ * transfers are put in its done list, and the worker is woken up.
+ */
+struct auth_parse_conn {
+	/** the pool */
+	struct auth_parse_pool* pool;
+	/** tube that wakes up the worker */
+	struct tube* tube;
+	/** list of parsed transfers, protected by the pool lock */
+	struct auth_parse_job* done_first;
+	/** last of the list of parsed transfers */
+	struct auth_parse_job* done_last;
+};
+
+/**
+ * A zone transfer parse thread.
+ */
+struct auth_parse_thr {
+	/** the pool */
+	struct auth_parse_pool* pool;
+	/** thread number for the log */
+	int thread_num;
+	/** the thread */
+	ub_thread_type tid;
+	/** scratch buffer to decompress RRs */
+	struct sldns_buffer* buf;
+};
+
+/**
+ * The zone transfer parse threads, shared by the workers.  A large AXFR
+ * is split into parts that the threads parse at the same time, the
+ * thread that finishes the last part merges them.  The worker that
+ * owns the transfer then swaps the result into the zone.
+ */
+struct auth_parse_pool {
+	/** lock on the queue, the done lists and the job states */
+	lock_basic_type lock;
+	/** lock that the threads hold while they wait on the tube */
+	lock_basic_type read_lock;
+	/** tube with one message for every queued part, the threads
+	 * block on it */
+	struct tube* tube;
+	/** queue of parts to parse */
+	struct axfr_part* queue_first;
+	/** last in the queue */
+	struct axfr_part* queue_last;
+	/** number of parts in the queue */
+	size_t queue_num;
+	/** the threads must stop */
+	int quit;
+	/** number of threads, and the number of parts of a transfer */
+	int num;
+	/** number of threads that have been started */
+	int num_started;
+	/** the threads, array of num */
+	struct auth_parse_thr* thr;
+};
+
+/**
+ * Create the zone transfer parse threads and start them.  They get the
+ * CPU affinity of the calling thread.
+ * @param cfg: config file, for the scratch buffer size.
+ * @param num: number of threads.
+ * @param thread_num: the number of the first thread, for the log.
+ * @return new pool or NULL on failure.
+ */
+struct auth_parse_pool* auth_parse_pool_create(struct config_file* cfg,
+	int num, int thread_num);
+
+/**
+ * Stop the parse threads and delete the pool.  The connections must have
+ * been deleted.
+ * @param pool: the pool.
+ */
+void auth_parse_pool_delete(struct auth_parse_pool* pool);
+
+/**
+ * Create the connection of a worker, on that thread.
+ * @param pool: the pool.
+ * @param base: the event base of the worker.
+ * @return new connection or NULL on failure.
+ */
+struct auth_parse_conn* auth_parse_conn_create(struct auth_parse_pool* pool,
+	struct comm_base* base);
+
+/**
+ * Delete the connection of a worker.  The transfers of the worker must
+ * have been disowned, with auth_zones_cleanup.
+ * @param conn: the connection.
+ */
+void auth_parse_conn_delete(struct auth_parse_conn* conn);
+
+/** callback for the tube of a connection, continues the transfers that
+ * have been parsed */
+void auth_parse_conn_handle(struct tube* tube, uint8_t* msg, size_t len,
+	int error, void* arg);
+
 #endif /* SERVICES_AUTHZONE_H */
@@ -243,8 +243,11 @@ infra_create(struct config_file* cfg)
 		free(infra);
 		return NULL;
 	}
+	slabhash_set_policy(infra->hosts,
+		lruhash_policy_from_str(cfg->infra_cache_policy));
 	infra->host_ttl = cfg->host_ttl;
 	infra->infra_keep_probing = cfg->infra_keep_probing;
+	infra->select_percentile = cfg->infra_select_percentile;
 	infra_dp_ratelimit = cfg->ratelimit;
 	infra->domain_rates = slabhash_create(cfg->ratelimit_slabs,
 		INFRA_HOST_STARTSIZE, cfg->ratelimit_size,
@@ -299,6 +302,7 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 		return infra_create(cfg);
 	infra->host_ttl = cfg->host_ttl;
 	infra->infra_keep_probing = cfg->infra_keep_probing;
+	infra->select_percentile = cfg->infra_select_percentile;
 	infra_dp_ratelimit = cfg->ratelimit;
 	infra_ip_ratelimit = cfg->ip_ratelimit;
 	maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
@@ -321,6 +325,8 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 			infra_delete(infra);
 			return NULL;
 		}
+		slabhash_set_policy(infra->hosts,
+			lruhash_policy_from_str(cfg->infra_cache_policy));
 	}
 	return infra;
 }
@@ -435,6 +441,20 @@ new_entry(struct infra_cache* infra, struct sockaddr_storage* addr,
 	return &key->entry;
 }
 
+int
+infra_insert_host(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen, struct infra_data* data)
+{
+	struct lruhash_entry* e = new_entry(infra, addr, addrlen, name,
+		namelen, data->ttl);
+	if(!e)
+		return 0;
+	memcpy(e->data, data, sizeof(*data));
+	slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
+	return 1;
+}
+
 int 
 infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
         socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow,
@@ -694,7 +714,10 @@ infra_get_lame_rtt(struct infra_cache* infra,
 	if(!e) 
 		return 0;
 	host = (struct infra_data*)e->data;
-	*rtt = rtt_unclamped(&host->rtt);
+	if(infra->select_percentile)
+		*rtt = rtt_select_percentile(&host->rtt,
+			infra->select_percentile);
+	else	*rtt = rtt_unclamped(&host->rtt);
 	if(host->rtt.rto >= PROBE_MAXRTO && timenow >= host->probedelay
 		&& infra->infra_keep_probing) {
 		/* single probe, keep probing */
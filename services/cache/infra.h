@@ -116,6 +116,9 @@ struct infra_cache {
 	int host_ttl;
 	/** the hosts that are down are kept probed for recovery */
 	int infra_keep_probing;
+	/** percentile of the rtt distribution used for server selection,
+	 * 0 uses the smoothed rtt */
+	int select_percentile;
 	/** hash table with query rates per name: rate_key, rate_data */
 	struct slabhash* domain_rates;
 	/** ratelimit settings for domains, struct domain_limit_data */
@@ -229,6 +232,21 @@ struct lruhash_entry* infra_lookup_nottl(struct infra_cache* infra,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
 	size_t namelen, int wr);
 
+/**
+ * Insert a host entry with the given data, replaces an existing entry.
+ * Used to restore the infra cache from a snapshot.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: domain name of zone.
+ * @param namelen: length of domain name.
+ * @param data: the host data to copy into the entry, with absolute ttl.
+ * @return: 0 on malloc failure.
+ */
+int infra_insert_host(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen, struct infra_data* data);
+
 /**
  * Find host information to send a packet. Creates new entry if not found.
  * Lameness is empty. EDNS is 0 (try with first), and rtt is returned for 
@@ -331,7 +349,8 @@ int infra_edns_update(struct infra_cache* infra,
  * @param dnsseclame: if function returns true, this returns if the zone
  *	is dnssec-lame.
  * @param reclame: if function returns true, this is if it is recursion lame.
- * @param rtt: if function returns true, this returns avg rtt of the server.
+ * @param rtt: if function returns true, this returns avg rtt of the server,
+ * 	or the configured percentile of its rtt distribution.
  * 	The rtt value is unclamped and reflects recent timeouts.
  * @param timenow: what time it is now.
  * @return if found in cache, or false if not (or TTL bad).
@@ -88,6 +88,9 @@ struct rrset_cache* rrset_cache_adjust(struct rrset_cache *r,
 		rrset_cache_delete(r);
 		r = rrset_cache_create(cfg, alloc);
 	}
+	if(r && cfg)
+		slabhash_set_policy(&r->table,
+			lruhash_policy_from_str(cfg->rrset_cache_policy));
 	return r;
 }
 
@@ -190,6 +193,7 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	struct ub_packed_rrset_key* k = ref->key;
 	hashvalue_type h = k->entry.hash;
 	uint16_t rrset_type = ntohs(k->rk.type);
+	rrset_id_type stamp = 0;
 	int equal = 0;
 	log_assert(ref->id != 0 && k->id != 0);
 	log_assert(k->rk.dname != NULL);
@@ -214,6 +218,10 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 			if(equal) return 2;
 			return 1;
 		}
+		/* the same rdata keeps its stamp, so that the wire images
+		 * of replies stay valid */
+		if(equal)
+			stamp = ((struct packed_rrset_data*)e->data)->stamp;
 		lock_rw_unlock(&e->lock);
 		/* Go on and insert the passed item.
 		 * small gap here, where entry is not locked.
@@ -224,6 +232,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 		 * cache size values nicely. */
 	}
 	log_assert(ref->key->id != 0);
+	((struct packed_rrset_data*)k->entry.data)->stamp =
+		(stamp?stamp:alloc_get_id(alloc));
 	slabhash_insert(&r->table, h, &k->entry, k->entry.data, alloc);
 	if(e) {
 		/* For NSEC, NSEC3, DNAME, when rdata is updated, update 
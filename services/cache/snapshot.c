@@ -0,0 +1,769 @@
+/*
+ * services/cache/snapshot.c - binary snapshot of the caches on disk
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions to write the caches to a binary snapshot
+ * file and read them back.  The records follow the layout of the
+ * packed_rrset_data, reply_info and infra_data structures, so that reading
+ * the snapshot is a copy and pointer fixup per entry, without the text
+ * parsing that the dump_cache and load_cache commands perform.
+ */
+#include "config.h"
+#include <fcntl.h>
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+#include "services/cache/snapshot.h"
+#include "services/cache/rrset.h"
+#include "services/cache/infra.h"
+#include "util/data/msgreply.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/dname.h"
+#include "util/storage/slabhash.h"
+#include "util/module.h"
+#include "util/alloc.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "sldns/pkthdr.h"
+
+/** magic string at the start of the snapshot file */
+#define SNAP_MAGIC "UBCSNAP\n"
+/** version of the snapshot format */
+#define SNAP_VERSION 1
+/** value to check the byte order of the host that wrote the file */
+#define SNAP_ENDIAN 0x01020304
+/** record type for the end of the file */
+#define SNAP_REC_END 0
+/** record type for an rrset */
+#define SNAP_REC_RRSET 1
+/** record type for a message */
+#define SNAP_REC_MSG 2
+/** record type for an infra host */
+#define SNAP_REC_INFRA 3
+
+/** header at the start of the snapshot file */
+struct snap_header {
+	/** the SNAP_MAGIC string */
+	char magic[8];
+	/** SNAP_VERSION */
+	uint32_t version;
+	/** SNAP_ENDIAN, in the byte order of the writer */
+	uint32_t endian;
+	/** sizeof(size_t) of the writer */
+	uint32_t size_size;
+	/** sizeof(time_t) of the writer */
+	uint32_t time_size;
+	/** sizeof(struct packed_rrset_data) of the writer */
+	uint32_t rrset_data_size;
+	/** sizeof(struct infra_data) of the writer */
+	uint32_t infra_data_size;
+	/** time the snapshot was written */
+	int64_t time;
+};
+
+/** header of a record, followed by len bytes of record data */
+struct snap_rec {
+	/** the record type */
+	uint32_t type;
+	/** length of the record data */
+	uint32_t len;
+};
+
+/**
+ * rrset record, followed by the packed_rrset_data, with its rr_len,
+ * rr_data and rr_ttl arrays and the rdata, and then the owner name.
+ */
+struct snap_rrset {
+	/** length of the packed rrset data */
+	uint32_t data_len;
+	/** rrset key flags */
+	uint32_t flags;
+	/** type, network order */
+	uint16_t type;
+	/** class, network order */
+	uint16_t rrset_class;
+	/** length of the owner name */
+	uint16_t dname_len;
+};
+
+/**
+ * message record, followed by the qname and then a snap_ref with the
+ * owner name for every rrset in the reply.
+ */
+struct snap_msg {
+	/** the absolute ttl of the reply */
+	int64_t ttl;
+	/** the absolute prefetch ttl */
+	int64_t prefetch_ttl;
+	/** the absolute serve expired ttl */
+	int64_t serve_expired_ttl;
+	/** number of answer rrsets */
+	uint32_t an;
+	/** number of authority rrsets */
+	uint32_t ns;
+	/** number of additional rrsets */
+	uint32_t ar;
+	/** security status of the reply */
+	int32_t security;
+	/** reply flags */
+	uint16_t flags;
+	/** qdcount */
+	uint16_t qdcount;
+	/** query type */
+	uint16_t qtype;
+	/** query class */
+	uint16_t qclass;
+	/** length of the qname */
+	uint16_t qname_len;
+	/** authoritative flag of the reply */
+	uint8_t authoritative;
+	/** if the entry was hashed for a query with the CD flag */
+	uint8_t cd;
+};
+
+/** reference from a message to an rrset, followed by the owner name */
+struct snap_ref {
+	/** rrset key flags */
+	uint32_t flags;
+	/** type, network order */
+	uint16_t type;
+	/** class, network order */
+	uint16_t rrset_class;
+	/** length of the owner name */
+	uint16_t dname_len;
+};
+
+/** infra host record, followed by the infra_data, address and zone name */
+struct snap_infra {
+	/** length of the address */
+	uint32_t addrlen;
+	/** length of the zone name */
+	uint32_t namelen;
+};
+
+/** state while writing the snapshot */
+struct snap_writer {
+	/** the output file */
+	FILE* out;
+	/** if a write error happened */
+	int err;
+	/** time now */
+	time_t now;
+	/** number of rrsets written */
+	size_t num_rrset;
+	/** number of messages written */
+	size_t num_msg;
+	/** number of infra hosts written */
+	size_t num_infra;
+};
+
+const char*
+cache_snapshot_fname(struct config_file* cfg)
+{
+	const char* fname = cfg->cache_snapshot_file;
+	if(!fname || !fname[0])
+		return NULL;
+	if(cfg->chrootdir && cfg->chrootdir[0] && strncmp(fname,
+		cfg->chrootdir, strlen(cfg->chrootdir)) == 0)
+		fname += strlen(cfg->chrootdir);
+	return fname;
+}
+
+/** write bytes to the snapshot */
+static void
+snap_write(struct snap_writer* w, const void* data, size_t len)
+{
+	if(w->err || len == 0)
+		return;
+	if(fwrite(data, 1, len, w->out) != len)
+		w->err = 1;
+}
+
+/** write a record header */
+static void
+snap_write_rec(struct snap_writer* w, uint32_t type, size_t len)
+{
+	struct snap_rec rec;
+	memset(&rec, 0, sizeof(rec));
+	rec.type = type;
+	rec.len = (uint32_t)len;
+	snap_write(w, &rec, sizeof(rec));
+}
+
+/** write one rrset, with read lock held on the entry */
+static void
+snap_write_rrset(struct snap_writer* w, struct ub_packed_rrset_key* k,
+	struct packed_rrset_data* d)
+{
+	struct snap_rrset r;
+	size_t i, num;
+	if(!k || !d || k->id == 0)
+		return; /* deleted */
+	if(d->ttl < w->now)
+		return; /* expired */
+	num = d->count + d->rrsig_count;
+	memset(&r, 0, sizeof(r));
+	r.data_len = (uint32_t)(sizeof(*d) + num*(sizeof(size_t) +
+		sizeof(uint8_t*) + sizeof(time_t)));
+	for(i=0; i<num; i++)
+		r.data_len += (uint32_t)d->rr_len[i];
+	r.flags = k->rk.flags;
+	r.type = k->rk.type;
+	r.rrset_class = k->rk.rrset_class;
+	r.dname_len = (uint16_t)k->rk.dname_len;
+	snap_write_rec(w, SNAP_REC_RRSET, sizeof(r) + r.data_len +
+		r.dname_len);
+	snap_write(w, &r, sizeof(r));
+	/* the same layout as packed_rrset_ptr_fixup expects */
+	snap_write(w, d, sizeof(*d));
+	snap_write(w, d->rr_len, sizeof(size_t)*num);
+	snap_write(w, d->rr_data, sizeof(uint8_t*)*num);
+	snap_write(w, d->rr_ttl, sizeof(time_t)*num);
+	for(i=0; i<num; i++)
+		snap_write(w, d->rr_data[i], d->rr_len[i]);
+	snap_write(w, k->rk.dname, k->rk.dname_len);
+	w->num_rrset++;
+}
+
+/** write the rrset cache */
+static void
+snap_write_rrset_cache(struct snap_writer* w, struct rrset_cache* r)
+{
+	struct lruhash_entry* e;
+	size_t slab;
+	for(slab=0; slab<r->table.size && !w->err; slab++) {
+		lock_quick_lock(&r->table.array[slab]->lock);
+		/* oldest first, so reading it back keeps the lru order */
+		for(e=r->table.array[slab]->lru_end; e; e = e->lru_prev) {
+			lock_rw_rdlock(&e->lock);
+			snap_write_rrset(w, (struct ub_packed_rrset_key*)e->key,
+				(struct packed_rrset_data*)e->data);
+			lock_rw_unlock(&e->lock);
+		}
+		lock_quick_unlock(&r->table.array[slab]->lock);
+	}
+}
+
+/** write one message, with read lock held on the entry */
+static void
+snap_write_msg(struct snap_writer* w, struct lruhash_entry* e)
+{
+	struct query_info* k = &((struct msgreply_entry*)e->key)->key;
+	struct reply_info* d = (struct reply_info*)e->data;
+	struct snap_msg m;
+	struct snap_ref ref;
+	size_t i, len;
+	if(!d || d->ttl < w->now)
+		return; /* expired */
+	if(!rrset_array_lock(d->ref, d->rrset_count, w->now))
+		return; /* rrsets have timed out or do not exist */
+	memset(&m, 0, sizeof(m));
+	m.ttl = (int64_t)d->ttl;
+	m.prefetch_ttl = (int64_t)d->prefetch_ttl;
+	m.serve_expired_ttl = (int64_t)d->serve_expired_ttl;
+	m.an = (uint32_t)d->an_numrrsets;
+	m.ns = (uint32_t)d->ns_numrrsets;
+	m.ar = (uint32_t)d->ar_numrrsets;
+	m.security = (int32_t)d->security;
+	m.flags = d->flags;
+	m.qdcount = d->qdcount;
+	m.qtype = k->qtype;
+	m.qclass = k->qclass;
+	m.qname_len = (uint16_t)k->qname_len;
+	m.authoritative = d->authoritative;
+	m.cd = (e->hash != query_info_hash(k, 0));
+	len = sizeof(m) + m.qname_len;
+	for(i=0; i<d->rrset_count; i++)
+		len += sizeof(ref) + d->rrsets[i]->rk.dname_len;
+	snap_write_rec(w, SNAP_REC_MSG, len);
+	snap_write(w, &m, sizeof(m));
+	snap_write(w, k->qname, k->qname_len);
+	for(i=0; i<d->rrset_count; i++) {
+		struct ub_packed_rrset_key* rk = d->rrsets[i];
+		memset(&ref, 0, sizeof(ref));
+		ref.flags = rk->rk.flags;
+		ref.type = rk->rk.type;
+		ref.rrset_class = rk->rk.rrset_class;
+		ref.dname_len = (uint16_t)rk->rk.dname_len;
+		snap_write(w, &ref, sizeof(ref));
+		snap_write(w, rk->rk.dname, rk->rk.dname_len);
+	}
+	rrset_array_unlock(d->ref, d->rrset_count);
+	w->num_msg++;
+}
+
+/** write the message cache */
+static void
+snap_write_msg_cache(struct snap_writer* w, struct slabhash* sh)
+{
+	struct lruhash_entry* e;
+	size_t slab;
+	for(slab=0; slab<sh->size && !w->err; slab++) {
+		lock_quick_lock(&sh->array[slab]->lock);
+		for(e=sh->array[slab]->lru_end; e; e = e->lru_prev) {
+			lock_rw_rdlock(&e->lock);
+			snap_write_msg(w, e);
+			lock_rw_unlock(&e->lock);
+		}
+		lock_quick_unlock(&sh->array[slab]->lock);
+	}
+}
+
+/** write the infra cache hosts */
+static void
+snap_write_infra_cache(struct snap_writer* w, struct infra_cache* infra)
+{
+	struct slabhash* sh = infra->hosts;
+	struct lruhash_entry* e;
+	struct snap_infra r;
+	size_t slab;
+	for(slab=0; slab<sh->size && !w->err; slab++) {
+		lock_quick_lock(&sh->array[slab]->lock);
+		for(e=sh->array[slab]->lru_end; e; e = e->lru_prev) {
+			struct infra_key* k = (struct infra_key*)e->key;
+			struct infra_data* d;
+			lock_rw_rdlock(&e->lock);
+			d = (struct infra_data*)e->data;
+			if(d->ttl < w->now) {
+				lock_rw_unlock(&e->lock);
+				continue;
+			}
+			memset(&r, 0, sizeof(r));
+			r.addrlen = (uint32_t)k->addrlen;
+			r.namelen = (uint32_t)k->namelen;
+			snap_write_rec(w, SNAP_REC_INFRA, sizeof(r) +
+				sizeof(*d) + r.addrlen + r.namelen);
+			snap_write(w, &r, sizeof(r));
+			snap_write(w, d, sizeof(*d));
+			snap_write(w, &k->addr, k->addrlen);
+			snap_write(w, k->zonename, k->namelen);
+			lock_rw_unlock(&e->lock);
+			w->num_infra++;
+		}
+		lock_quick_unlock(&sh->array[slab]->lock);
+	}
+}
+
+int
+cache_snapshot_write(struct module_env* env, const char* fname, time_t now)
+{
+	struct snap_writer w;
+	struct snap_header hdr;
+	char tmpf[1024];
+	memset(&w, 0, sizeof(w));
+	w.now = now;
+	snprintf(tmpf, sizeof(tmpf), "%s.%u", fname, (unsigned)getpid());
+	if(!(w.out = fopen(tmpf, "wb"))) {
+		log_err("could not open %s: %s", tmpf, strerror(errno));
+		return 0;
+	}
+	memset(&hdr, 0, sizeof(hdr));
+	memmove(hdr.magic, SNAP_MAGIC, sizeof(hdr.magic));
+	hdr.version = SNAP_VERSION;
+	hdr.endian = SNAP_ENDIAN;
+	hdr.size_size = (uint32_t)sizeof(size_t);
+	hdr.time_size = (uint32_t)sizeof(time_t);
+	hdr.rrset_data_size = (uint32_t)sizeof(struct packed_rrset_data);
+	hdr.infra_data_size = (uint32_t)sizeof(struct infra_data);
+	hdr.time = (int64_t)now;
+	snap_write(&w, &hdr, sizeof(hdr));
+	/* rrsets first, the messages refer to them */
+	if(env->rrset_cache)
+		snap_write_rrset_cache(&w, env->rrset_cache);
+	if(env->msg_cache)
+		snap_write_msg_cache(&w, env->msg_cache);
+	if(env->infra_cache)
+		snap_write_infra_cache(&w, env->infra_cache);
+	snap_write_rec(&w, SNAP_REC_END, 0);
+	if(fclose(w.out) != 0)
+		w.err = 1;
+	if(w.err) {
+		log_err("could not write %s: %s", tmpf, strerror(errno));
+		(void)unlink(tmpf);
+		return 0;
+	}
+	if(rename(tmpf, fname) != 0) {
+		log_err("could not rename %s to %s: %s", tmpf, fname,
+			strerror(errno));
+		(void)unlink(tmpf);
+		return 0;
+	}
+	verbose(VERB_OPS, "cache snapshot %s: wrote %u rrsets, %u messages, "
+		"%u infra hosts", fname, (unsigned)w.num_rrset,
+		(unsigned)w.num_msg, (unsigned)w.num_infra);
+	return 1;
+}
+
+/** read an rrset record into the rrset cache, false if malformed */
+static int
+snap_read_rrset(struct module_env* env, struct alloc_cache* alloc,
+	uint8_t* p, size_t len, time_t now)
+{
+	struct snap_rrset r;
+	struct packed_rrset_data* d;
+	struct ub_packed_rrset_key* k;
+	struct rrset_ref ref;
+	size_t i, num, s, rrlen;
+	uint8_t* dname;
+	if(len < sizeof(r))
+		return 0;
+	memmove(&r, p, sizeof(r));
+	if(r.data_len < sizeof(*d) || sizeof(r) + (size_t)r.data_len +
+		(size_t)r.dname_len != len)
+		return 0;
+	dname = p + sizeof(r) + r.data_len;
+	if(r.dname_len == 0 || dname_valid(dname, r.dname_len) != r.dname_len)
+		return 0;
+	d = (struct packed_rrset_data*)malloc(r.data_len);
+	if(!d) {
+		log_err("cache snapshot: out of memory");
+		return 0;
+	}
+	memmove(d, p + sizeof(r), r.data_len);
+	if(d->count > RR_COUNT_MAX || d->rrsig_count > RR_COUNT_MAX ||
+		d->count + d->rrsig_count == 0) {
+		free(d);
+		return 0;
+	}
+	num = d->count + d->rrsig_count;
+	s = sizeof(*d) + num*(sizeof(size_t) + sizeof(uint8_t*) +
+		sizeof(time_t));
+	if(s > r.data_len) {
+		free(d);
+		return 0;
+	}
+	/* check the rdata lengths before the pointer fixup uses them */
+	for(i=0; i<num; i++) {
+		memmove(&rrlen, (uint8_t*)d + sizeof(*d) + i*sizeof(size_t),
+			sizeof(rrlen));
+		if(rrlen > r.data_len - s) {
+			free(d);
+			return 0;
+		}
+		s += rrlen;
+	}
+	if(s != r.data_len) {
+		free(d);
+		return 0;
+	}
+	if(d->ttl < now) {
+		free(d);
+		return 1; /* expired, skip it */
+	}
+	packed_rrset_ptr_fixup(d);
+
+	k = alloc_special_obtain(alloc);
+	if(!k) {
+		log_err("cache snapshot: out of memory");
+		free(d);
+		return 0;
+	}
+	k->entry.data = NULL;
+	k->rk.dname = (uint8_t*)memdup(dname, r.dname_len);
+	if(!k->rk.dname) {
+		log_err("cache snapshot: out of memory");
+		ub_packed_rrset_parsedelete(k, alloc);
+		free(d);
+		return 0;
+	}
+	k->rk.dname_len = r.dname_len;
+	k->rk.type = r.type;
+	k->rk.rrset_class = r.rrset_class;
+	k->rk.flags = r.flags;
+	k->entry.hash = rrset_key_hash(&k->rk);
+	k->entry.data = d;
+	ref.key = k;
+	ref.id = k->id;
+	(void)rrset_cache_update(env->rrset_cache, &ref, alloc, now);
+	return 1;
+}
+
+/** read a message record into the message cache, false if malformed */
+static int
+snap_read_msg(struct module_env* env, struct alloc_cache* alloc,
+	uint8_t* p, size_t len, time_t now)
+{
+	struct snap_msg m;
+	struct snap_ref ref;
+	struct reply_info* rep;
+	struct query_info qinfo;
+	struct msgreply_entry* e;
+	struct ub_packed_rrset_key* k;
+	uint8_t* q, *end = p + len, *dname;
+	size_t i, total;
+	hashvalue_type h;
+	if(len < sizeof(m))
+		return 0;
+	memmove(&m, p, sizeof(m));
+	q = p + sizeof(m);
+	if(m.qname_len == 0 || m.qname_len > (size_t)(end - q) ||
+		dname_valid(q, m.qname_len) != m.qname_len)
+		return 0;
+	total = (size_t)m.an + (size_t)m.ns + (size_t)m.ar;
+	if(total >= RR_COUNT_MAX)
+		return 0;
+	if((time_t)m.ttl < now)
+		return 1; /* expired, skip it */
+	rep = construct_reply_info_base(NULL, m.flags, m.qdcount,
+		(time_t)m.ttl, (time_t)m.prefetch_ttl,
+		(time_t)m.serve_expired_ttl, m.an, m.ns, m.ar, total,
+		(enum sec_status)m.security);
+	if(!rep) {
+		log_err("cache snapshot: out of memory");
+		return 0;
+	}
+	rep->authoritative = m.authoritative;
+	qinfo.qname = q;
+	qinfo.qname_len = m.qname_len;
+	qinfo.qtype = m.qtype;
+	qinfo.qclass = m.qclass;
+	qinfo.local_alias = NULL;
+	q += m.qname_len;
+	for(i=0; i<total; i++) {
+		if(sizeof(ref) > (size_t)(end - q)) {
+			free(rep);
+			return 0;
+		}
+		memmove(&ref, q, sizeof(ref));
+		dname = q + sizeof(ref);
+		if(ref.dname_len == 0 || ref.dname_len > (size_t)(end-dname) ||
+			dname_valid(dname, ref.dname_len) != ref.dname_len) {
+			free(rep);
+			return 0;
+		}
+		q = dname + ref.dname_len;
+		k = rrset_cache_lookup(env->rrset_cache, dname,
+			ref.dname_len, ntohs(ref.type), ntohs(ref.rrset_class),
+			ref.flags, now, 0);
+		if(!k) {
+			/* not loaded or expired, skip the message */
+			free(rep);
+			return 1;
+		}
+		rep->rrsets[i] = k;
+		rep->ref[i].key = k;
+		rep->ref[i].id = k->id;
+		lock_rw_unlock(&k->entry.lock);
+	}
+	if(q != end) {
+		free(rep);
+		return 0;
+	}
+	reply_info_sortref(rep);
+	h = query_info_hash(&qinfo, (uint16_t)(m.cd?BIT_CD:0));
+	qinfo.qname = memdup(qinfo.qname, qinfo.qname_len);
+	if(!qinfo.qname) {
+		log_err("cache snapshot: out of memory");
+		free(rep);
+		return 0;
+	}
+	if(!(e = query_info_entrysetup(&qinfo, rep, h))) {
+		log_err("cache snapshot: out of memory");
+		free(qinfo.qname);
+		free(rep);
+		return 0;
+	}
+	slabhash_insert(env->msg_cache, h, &e->entry, rep, alloc);
+	return 1;
+}
+
+/** read an infra host record into the infra cache, false if malformed */
+static int
+snap_read_infra(struct module_env* env, uint8_t* p, size_t len,
+	time_t now)
+{
+	struct snap_infra r;
+	struct infra_data d;
+	struct sockaddr_storage addr;
+	uint8_t* name;
+	if(len < sizeof(r))
+		return 0;
+	memmove(&r, p, sizeof(r));
+	if(r.addrlen == 0 || r.addrlen > sizeof(addr) || r.namelen == 0 ||
+		sizeof(r) + sizeof(d) + (size_t)r.addrlen +
+		(size_t)r.namelen != len)
+		return 0;
+	memmove(&d, p + sizeof(r), sizeof(d));
+	memset(&addr, 0, sizeof(addr));
+	memmove(&addr, p + sizeof(r) + sizeof(d), r.addrlen);
+	name = p + sizeof(r) + sizeof(d) + r.addrlen;
+	if(dname_valid(name, r.namelen) != r.namelen)
+		return 0;
+	if(d.ttl < now)
+		return 1; /* expired, skip it */
+	if(!infra_insert_host(env->infra_cache, &addr, (socklen_t)r.addrlen,
+		name, r.namelen, &d)) {
+		log_err("cache snapshot: out of memory");
+		return 0;
+	}
+	return 1;
+}
+
+/** map the snapshot file in memory, returns NULL on failure */
+static uint8_t*
+snap_map(const char* fname, size_t* len, int* mapped, int* missing)
+{
+	struct stat st;
+	uint8_t* buf;
+	int fd = open(fname, O_RDONLY);
+	if(fd == -1) {
+		if(errno == ENOENT) {
+			verbose(VERB_ALGO, "no cache snapshot %s", fname);
+			*missing = 1;
+		} else	log_err("could not open %s: %s", fname,
+				strerror(errno));
+		return NULL;
+	}
+	if(fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(
+		struct snap_header)) {
+		log_err("cache snapshot %s: file too short", fname);
+		close(fd);
+		return NULL;
+	}
+	*len = (size_t)st.st_size;
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+	buf = (uint8_t*)mmap(NULL, *len, PROT_READ, MAP_PRIVATE, fd, 0);
+	if(buf != (uint8_t*)MAP_FAILED) {
+		close(fd);
+		*mapped = 1;
+		return buf;
+	}
+#endif
+	*mapped = 0;
+	buf = (uint8_t*)malloc(*len);
+	if(!buf) {
+		log_err("cache snapshot %s: out of memory", fname);
+		close(fd);
+		return NULL;
+	}
+	if(read(fd, buf, *len) != (ssize_t)*len) {
+		log_err("could not read %s: %s", fname, strerror(errno));
+		free(buf);
+		close(fd);
+		return NULL;
+	}
+	close(fd);
+	return buf;
+}
+
+/** release the snapshot file from memory */
+static void
+snap_unmap(uint8_t* buf, size_t len, int mapped)
+{
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+	if(mapped) {
+		(void)munmap(buf, len);
+		return;
+	}
+#else
+	(void)len;
+	(void)mapped;
+#endif
+	free(buf);
+}
+
+int
+cache_snapshot_read(struct module_env* env, struct alloc_cache* alloc,
+	const char* fname, time_t now)
+{
+	struct snap_header hdr;
+	struct snap_rec rec;
+	uint8_t* buf, *p, *end;
+	size_t len = 0, num_rrset = 0, num_msg = 0, num_infra = 0;
+	int mapped = 0, missing = 0, ok = 1, done = 0;
+
+	if(!(buf = snap_map(fname, &len, &mapped, &missing)))
+		return missing;
+	memmove(&hdr, buf, sizeof(hdr));
+	if(memcmp(hdr.magic, SNAP_MAGIC, sizeof(hdr.magic)) != 0 ||
+		hdr.version != SNAP_VERSION || hdr.endian != SNAP_ENDIAN ||
+		hdr.size_size != sizeof(size_t) ||
+		hdr.time_size != sizeof(time_t) ||
+		hdr.rrset_data_size != sizeof(struct packed_rrset_data) ||
+		hdr.infra_data_size != sizeof(struct infra_data)) {
+		log_err("cache snapshot %s: not a snapshot of this version "
+			"and platform, ignored", fname);
+		snap_unmap(buf, len, mapped);
+		return 0;
+	}
+	p = buf + sizeof(hdr);
+	end = buf + len;
+	while(ok && !done && sizeof(rec) <= (size_t)(end - p)) {
+		memmove(&rec, p, sizeof(rec));
+		p += sizeof(rec);
+		if(rec.len > (size_t)(end - p)) {
+			ok = 0;
+			break;
+		}
+		switch(rec.type) {
+		case SNAP_REC_RRSET:
+			ok = snap_read_rrset(env, alloc, p, rec.len, now);
+			num_rrset++;
+			break;
+		case SNAP_REC_MSG:
+			ok = snap_read_msg(env, alloc, p, rec.len, now);
+			num_msg++;
+			break;
+		case SNAP_REC_INFRA:
+			ok = snap_read_infra(env, p, rec.len, now);
+			num_infra++;
+			break;
+		case SNAP_REC_END:
+			done = 1;
+			break;
+		default:
+			ok = 0;
+			break;
+		}
+		p += rec.len;
+	}
+	snap_unmap(buf, len, mapped);
+	if(!ok || !done) {
+		log_err("cache snapshot %s: malformed or truncated, "
+			"partially loaded", fname);
+		return 0;
+	}
+	verbose(VERB_OPS, "cache snapshot %s: read %u rrsets, %u messages, "
+		"%u infra hosts, written " ARG_LL "d seconds ago", fname,
+		(unsigned)num_rrset, (unsigned)num_msg, (unsigned)num_infra,
+		(long long)(now - (time_t)hdr.time));
+	return 1;
+}
@@ -0,0 +1,82 @@
+/*
+ * services/cache/snapshot.h - binary snapshot of the caches on disk
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains functions to write the rrset, message and infra
+ * caches to a binary snapshot file, and to read it back into the caches.
+ * The snapshot stores the cache data in host byte order with absolute
+ * TTLs, and can only be read on the same kind of host by the same version.
+ */
+
+#ifndef SERVICES_CACHE_SNAPSHOT_H
+#define SERVICES_CACHE_SNAPSHOT_H
+struct module_env;
+struct alloc_cache;
+struct config_file;
+
+/**
+ * Get the snapshot file name to use, after the chroot.
+ * @param cfg: config with the cache-snapshot-file.
+ * @return file name or NULL if no snapshot is configured.
+ */
+const char* cache_snapshot_fname(struct config_file* cfg);
+
+/**
+ * Write the rrset, message and infra caches to a snapshot file.
+ * The file is written under a temporary name and then renamed.
+ * @param env: module env with the caches.
+ * @param fname: name of the snapshot file.
+ * @param now: the time now, expired entries are skipped.
+ * @return false on failure, the failure is logged.
+ */
+int cache_snapshot_write(struct module_env* env, const char* fname,
+	time_t now);
+
+/**
+ * Read a snapshot file into the rrset, message and infra caches.
+ * Expired entries are skipped.
+ * @param env: module env with the caches.
+ * @param alloc: alloc cache for the rrset keys.
+ * @param fname: name of the snapshot file.
+ * @param now: the time now.
+ * @return false on failure, the failure is logged.  A missing file
+ *	is not a failure.
+ */
+int cache_snapshot_read(struct module_env* env, struct alloc_cache* alloc,
+	const char* fname, time_t now);
+
+#endif /* SERVICES_CACHE_SNAPSHOT_H */
@@ -0,0 +1,254 @@
+/*
+ * services/inflight.c - queries in flight, shared between the threads.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of client queries that the threads are
+ * resolving, so that a query is resolved by one thread at a time.
+ */
+#include "config.h"
+#include "services/inflight.h"
+#include "services/mesh.h"
+#include "util/tube.h"
+#include "util/log.h"
+#include "util/net_help.h"
+
+int
+inflight_entry_cmp(const void* a, const void* b)
+{
+	struct inflight_entry* x = (struct inflight_entry*)a;
+	struct inflight_entry* y = (struct inflight_entry*)b;
+	if(x->qflags != y->qflags)
+		return (x->qflags < y->qflags)?-1:1;
+	return query_info_compare(&x->qinfo, &y->qinfo);
+}
+
+struct inflight_table*
+inflight_create(int num)
+{
+	struct inflight_table* table = (struct inflight_table*)calloc(1,
+		sizeof(*table));
+	if(!table)
+		return NULL;
+	table->conns = (struct inflight_conn**)calloc((size_t)num,
+		sizeof(*table->conns));
+	if(!table->conns) {
+		free(table);
+		return NULL;
+	}
+	table->num = num;
+	rbtree_init(&table->tree, &inflight_entry_cmp);
+	lock_basic_init(&table->lock);
+	lock_protect(&table->lock, &table->tree, sizeof(table->tree));
+	return table;
+}
+
+/** delete an entry */
+static void
+entry_delete(struct inflight_entry* e)
+{
+	free(e->qinfo.qname);
+	free(e->waiting);
+	free(e);
+}
+
+/** delete an entry in the tree traversal */
+static void
+entry_del_tree(rbnode_type* n, void* ATTR_UNUSED(arg))
+{
+	entry_delete((struct inflight_entry*)n);
+}
+
+void
+inflight_delete(struct inflight_table* table)
+{
+	if(!table)
+		return;
+	/* the queries are gone with the threads, this is for errors */
+	traverse_postorder(&table->tree, &entry_del_tree, NULL);
+	lock_basic_destroy(&table->lock);
+	free(table->conns);
+	free(table);
+}
+
+struct inflight_conn*
+inflight_conn_create(struct inflight_table* table, int index,
+	struct comm_base* base, struct mesh_area* mesh)
+{
+	struct inflight_conn* conn = (struct inflight_conn*)calloc(1,
+		sizeof(*conn));
+	if(!conn)
+		return NULL;
+	log_assert(index >= 0 && index < table->num);
+	conn->table = table;
+	conn->index = index;
+	conn->mesh = mesh;
+	conn->tube = tube_create();
+	if(!conn->tube) {
+		free(conn);
+		return NULL;
+	}
+	if(!tube_setup_bg_listen(conn->tube, base, &inflight_conn_handle,
+		conn)) {
+		tube_delete(conn->tube);
+		free(conn);
+		return NULL;
+	}
+	lock_basic_lock(&table->lock);
+	table->conns[index] = conn;
+	lock_basic_unlock(&table->lock);
+	return conn;
+}
+
+void
+inflight_conn_delete(struct inflight_conn* conn)
+{
+	if(!conn)
+		return;
+	/* after this, the other threads do not write to the tube */
+	lock_basic_lock(&conn->table->lock);
+	conn->table->conns[conn->index] = NULL;
+	lock_basic_unlock(&conn->table->lock);
+	tube_delete(conn->tube);
+	free(conn);
+}
+
+/** find the entry for a query, with the lock */
+static struct inflight_entry*
+entry_find(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t qflags)
+{
+	struct inflight_entry key;
+	key.node.key = &key;
+	key.qinfo = *qinfo;
+	key.qflags = qflags;
+	return (struct inflight_entry*)rbtree_search(&table->tree, &key);
+}
+
+/** create an entry for a query that the thread owns */
+static struct inflight_entry*
+entry_create(struct inflight_table* table, struct query_info* qinfo,
+	uint16_t qflags, int owner)
+{
+	struct inflight_entry* e = (struct inflight_entry*)calloc(1,
+		sizeof(*e));
+	if(!e)
+		return NULL;
+	e->node.key = e;
+	e->qinfo.qname = memdup(qinfo->qname, qinfo->qname_len);
+	e->waiting = (uint8_t*)calloc((size_t)table->num, sizeof(uint8_t));
+	if(!e->qinfo.qname || !e->waiting) {
+		entry_delete(e);
+		return NULL;
+	}
+	e->qinfo.qname_len = qinfo->qname_len;
+	e->qinfo.qtype = qinfo->qtype;
+	e->qinfo.qclass = qinfo->qclass;
+	e->qflags = qflags;
+	e->owner = owner;
+	return e;
+}
+
+enum inflight_result
+inflight_start(struct inflight_conn* conn, struct query_info* qinfo,
+	uint16_t qflags)
+{
+	struct inflight_table* table = conn->table;
+	struct inflight_entry* e;
+	lock_basic_lock(&table->lock);
+	e = entry_find(table, qinfo, qflags);
+	if(e && e->owner != conn->index) {
+		e->waiting[conn->index] = 1;
+		lock_basic_unlock(&table->lock);
+		return inflight_wait;
+	}
+	if(e) {
+		/* a query of this thread that is not done, should not be */
+		lock_basic_unlock(&table->lock);
+		return inflight_none;
+	}
+	e = entry_create(table, qinfo, qflags, conn->index);
+	if(!e) {
+		lock_basic_unlock(&table->lock);
+		log_err("inflight: out of memory, query is not shared");
+		return inflight_none;
+	}
+	(void)rbtree_insert(&table->tree, &e->node);
+	lock_basic_unlock(&table->lock);
+	return inflight_own;
+}
+
+void
+inflight_done(struct inflight_conn* conn, struct query_info* qinfo,
+	uint16_t qflags)
+{
+	struct inflight_table* table = conn->table;
+	struct inflight_entry* e;
+	uint8_t msg = 0;
+	int i;
+	lock_basic_lock(&table->lock);
+	e = entry_find(table, qinfo, qflags);
+	if(!e || e->owner != conn->index) {
+		lock_basic_unlock(&table->lock);
+		return;
+	}
+	(void)rbtree_delete(&table->tree, e);
+	/* the thread is woken up once, and checks all its queries */
+	for(i=0; i<table->num; i++) {
+		struct inflight_conn* w = table->conns[i];
+		if(!e->waiting[i] || !w || w->woken)
+			continue;
+		w->woken = 1;
+		if(!tube_write_msg(w->tube, &msg, sizeof(msg), 0))
+			log_err("inflight: could not wake up thread");
+	}
+	lock_basic_unlock(&table->lock);
+	entry_delete(e);
+}
+
+void
+inflight_conn_handle(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct inflight_conn* conn = (struct inflight_conn*)arg;
+	free(msg);
+	if(error != 0)
+		return;
+	lock_basic_lock(&conn->table->lock);
+	conn->woken = 0;
+	lock_basic_unlock(&conn->table->lock);
+	mesh_inflight_wakeup(conn->mesh);
+}
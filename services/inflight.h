@@ -0,0 +1,179 @@
+/*
+ * services/inflight.h - queries in flight, shared between the threads.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the table of client queries that the threads are
+ * resolving.  When a query misses the cache on a thread, and another
+ * thread is resolving the same query, the thread does not resolve it
+ * again.  The query waits until the other thread is done, and then runs
+ * and finds the answer in the shared cache.  If the answer is not in the
+ * cache, for example because it was an error, the query resolves it
+ * itself.
+ *
+ * The queries are looked up like in the mesh, by name, type, class and
+ * the RD and CD flags.  Queries with client specific processing are not
+ * shared.
+ */
+
+#ifndef SERVICES_INFLIGHT_H
+#define SERVICES_INFLIGHT_H
+#include "util/locks.h"
+#include "util/rbtree.h"
+#include "util/data/msgreply.h"
+struct comm_base;
+struct mesh_area;
+struct tube;
+struct inflight_conn;
+
+/**
+ * A query that a thread is resolving.
+ */
+struct inflight_entry {
+	/** node in the table, key is this struct */
+	rbnode_type node;
+	/** the query, the qname is malloced */
+	struct query_info qinfo;
+	/** the RD and CD flags of the query */
+	uint16_t qflags;
+	/** the thread that resolves it */
+	int owner;
+	/** array with a flag for every thread, if it waits for it */
+	uint8_t* waiting;
+};
+
+/**
+ * The table of queries in flight, shared by the threads.
+ */
+struct inflight_table {
+	/** lock on the tree, the entries and the woken flags */
+	lock_basic_type lock;
+	/** the queries, of struct inflight_entry */
+	rbtree_type tree;
+	/** number of threads */
+	int num;
+	/** the connections of the threads, array of num, NULL for a
+	 * thread that is not running */
+	struct inflight_conn** conns;
+};
+
+/**
+ * The connection of a thread to the table.
+ */
+struct inflight_conn {
+	/** the table */
+	struct inflight_table* table;
+	/** the number of the thread */
+	int index;
+	/** tube that wakes up the thread when queries it waits for are done */
+	struct tube* tube;
+	/** a wakeup is in the tube, protected by the table lock */
+	int woken;
+	/** the mesh of the thread, with the queries that wait */
+	struct mesh_area* mesh;
+};
+
+/** result of the start of a query */
+enum inflight_result {
+	/** the query is not in the table, the thread resolves it */
+	inflight_none = 0,
+	/** the thread resolves it, and is the owner of the entry */
+	inflight_own,
+	/** another thread resolves it, the thread waits for it */
+	inflight_wait
+};
+
+/**
+ * Create the table.
+ * @param num: number of threads.
+ * @return new table or NULL on failure.
+ */
+struct inflight_table* inflight_create(int num);
+
+/**
+ * Delete the table.  The connections must have been deleted.
+ * @param table: the table.
+ */
+void inflight_delete(struct inflight_table* table);
+
+/**
+ * Create the connection of a thread, on that thread.
+ * @param table: the table.
+ * @param index: the number of the thread.
+ * @param base: the event base of the thread.
+ * @param mesh: the mesh of the thread.
+ * @return new connection or NULL on failure.
+ */
+struct inflight_conn* inflight_conn_create(struct inflight_table* table,
+	int index, struct comm_base* base, struct mesh_area* mesh);
+
+/**
+ * Delete the connection of a thread.  The queries of the thread must
+ * have been deleted.
+ * @param conn: the connection.
+ */
+void inflight_conn_delete(struct inflight_conn* conn);
+
+/**
+ * Start a query.  If another thread resolves it, the thread is woken up
+ * when that is done.  Otherwise, the thread owns the entry for it, and
+ * has to call inflight_done when it is done.
+ * @param conn: the connection of the thread.
+ * @param qinfo: the query.
+ * @param qflags: the RD and CD flags of the query.
+ * @return what the thread has to do with it.
+ */
+enum inflight_result inflight_start(struct inflight_conn* conn,
+	struct query_info* qinfo, uint16_t qflags);
+
+/**
+ * The query that the thread owns is done, and the threads that wait for
+ * it are woken up.
+ * @param conn: the connection of the thread.
+ * @param qinfo: the query.
+ * @param qflags: the RD and CD flags of the query.
+ */
+void inflight_done(struct inflight_conn* conn, struct query_info* qinfo,
+	uint16_t qflags);
+
+/** compare entries in the table */
+int inflight_entry_cmp(const void* a, const void* b);
+
+/** the thread is woken up, the queries that wait are checked */
+void inflight_conn_handle(struct tube* tube, uint8_t* msg, size_t len,
+	int error, void* arg);
+
+#endif /* SERVICES_INFLIGHT_H */
@@ -78,6 +78,9 @@
 #ifdef HAVE_NET_IF_H
 #include <net/if.h>
 #endif
+#ifdef HAVE_LINUX_FILTER_H
+#include <linux/filter.h>
+#endif
 
 /** number of queued TCP connections for listen() */
 #define TCP_BACKLOG 256 
@@ -92,6 +95,8 @@ static lock_basic_type http2_response_buffer_count_lock;
 #endif
 /** size (in bytes) of stream wait buffers */
 static size_t stream_wait_count = 0;
+/** number of streams that have results in the stream wait buffers */
+static size_t stream_wait_conns = 0;
 /** is the lock initialised for stream wait buffers */
 static int stream_wait_lock_inited = 0;
 /** size (in bytes) of HTTP2 query buffers */
@@ -1778,6 +1783,84 @@ void listening_ports_free(struct listen_port* list)
 	}
 }
 
+int
+listening_ports_steer_cpu(struct listen_port* list, const int* cpus, int num)
+{
+#if defined(HAVE_LINUX_FILTER_H) && defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+	struct sock_filter* code;
+	struct sock_fprog prog;
+	struct listen_port* p;
+	int i, j, n = 0, ok = 1;
+	if(!cpus) {
+#  ifdef SO_DETACH_REUSEPORT_BPF
+		int dummy = 0;
+		for(p = list; p; p = p->next) {
+			/* ENOENT if there is no program on the group */
+			if(setsockopt(p->fd, SOL_SOCKET,
+				SO_DETACH_REUSEPORT_BPF, (void*)&dummy,
+				(socklen_t)sizeof(dummy)) < 0 &&
+				errno != ENOENT) {
+				log_err("setsockopt(.. SO_DETACH_REUSEPORT_BPF "
+					"..) failed: %s", sock_strerror(errno));
+				ok = 0;
+			}
+		}
+#  endif
+		return ok;
+	}
+	/* the load, a compare and return per socket, and the return for
+	 * the CPUs of no socket */
+	if(num < 1 || 2 + 2*num > BPF_MAXINSNS) {
+		log_err("cannot steer the queries to %d sockets", num);
+		return 0;
+	}
+	code = (struct sock_filter*)calloc((size_t)(2 + 2*num),
+		sizeof(*code));
+	if(!code) {
+		log_err("out of memory");
+		return 0;
+	}
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_LD|BPF_W|BPF_ABS,
+		(uint32_t)(SKF_AD_OFF + SKF_AD_CPU));
+	for(i=0; i<num; i++) {
+		/* a CPU with several sockets is not steered, so that all
+		 * their threads get queries */
+		for(j=0; j<num; j++)
+			if(j != i && cpus[j] == cpus[i])
+				break;
+		if(j != num)
+			continue;
+		code[n++] = (struct sock_filter)BPF_JUMP(BPF_JMP|BPF_JEQ|BPF_K,
+			(uint32_t)cpus[i], 0, 1);
+		code[n++] = (struct sock_filter)BPF_STMT(BPF_RET|BPF_K,
+			(uint32_t)i);
+	}
+	/* a socket index out of range makes the kernel pick the socket
+	 * by the hash of the addresses, like without a program */
+	code[n++] = (struct sock_filter)BPF_STMT(BPF_RET|BPF_K, 0xffffffff);
+	memset(&prog, 0, sizeof(prog));
+	prog.len = (unsigned short)n;
+	prog.filter = code;
+	for(p = list; p; p = p->next) {
+		if(setsockopt(p->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+			(void*)&prog, (socklen_t)sizeof(prog)) < 0) {
+			log_err("setsockopt(.. SO_ATTACH_REUSEPORT_CBPF ..) "
+				"failed: %s", sock_strerror(errno));
+			ok = 0;
+		}
+	}
+	free(code);
+	return ok;
+#else
+	(void)list;
+	(void)num;
+	if(cpus)
+		log_warn("steering the queries to the CPUs is not supported "
+			"on this system");
+	return 0;
+#endif
+}
+
 size_t listen_get_mem(struct listen_dnsport* listen)
 {
 	struct listen_list* p;
@@ -1847,6 +1930,18 @@ tcp_req_info_delete(struct tcp_req_info* req)
 	free(req);
 }
 
+/** give back stream-wait-size space that the stream used for a result */
+static void
+tcp_req_info_release_space(struct tcp_req_info* req, size_t space)
+{
+	lock_basic_lock(&stream_wait_count_lock);
+	stream_wait_count -= space;
+	req->done_req_size -= space;
+	if(req->done_req_size == 0)
+		stream_wait_conns--;
+	lock_basic_unlock(&stream_wait_count_lock);
+}
+
 void tcp_req_info_clear(struct tcp_req_info* req)
 {
 	struct tcp_req_open_item* open, *nopen;
@@ -1868,10 +1963,8 @@ void tcp_req_info_clear(struct tcp_req_info* req)
 	item = req->done_req_list;
 	while(item) {
 		nitem = item->next;
-		lock_basic_lock(&stream_wait_count_lock);
-		stream_wait_count -= (sizeof(struct tcp_req_done_item)
-			+item->len);
-		lock_basic_unlock(&stream_wait_count_lock);
+		tcp_req_info_release_space(req,
+			sizeof(struct tcp_req_done_item)+item->len);
 		free(item->buf);
 		free(item);
 		item = nitem;
@@ -1952,9 +2045,8 @@ tcp_req_info_pop_done(struct tcp_req_info* req)
 	struct tcp_req_done_item* item;
 	log_assert(req->num_done_req > 0 && req->done_req_list);
 	item = req->done_req_list;
-	lock_basic_lock(&stream_wait_count_lock);
-	stream_wait_count -= (sizeof(struct tcp_req_done_item)+item->len);
-	lock_basic_unlock(&stream_wait_count_lock);
+	tcp_req_info_release_space(req,
+		sizeof(struct tcp_req_done_item)+item->len);
 	req->done_req_list = req->done_req_list->next;
 	req->num_done_req --;
 	return item;
@@ -1972,7 +2064,61 @@ tcp_req_info_start_write_buf(struct tcp_req_info* req, uint8_t* buf,
 	req->cp->tcp_is_reading = 0; /* we are now writing */
 }
 
-/** pick up the next result and start writing it to the channel */
+/**
+ * Add a result to the write that is set up, but has not started yet.
+ * The results are then written in one go, each with its length in front,
+ * and with TLS that fills the records instead of one record per result.
+ * @param req: the tcp request info.
+ * @param buf: result packet.
+ * @param len: length of the packet.
+ * @return false if it cannot be added, and has to be written later.
+ */
+static int
+tcp_req_info_append_write(struct tcp_req_info* req, uint8_t* buf,
+	size_t len)
+{
+	struct comm_point* c = req->cp;
+	size_t cur = sldns_buffer_limit(c->buffer);
+	if(c->tcp_is_reading || c->tcp_byte_count != 0 ||
+		sldns_buffer_position(c->buffer) != 0 || cur == 0)
+		return 0;
+#ifdef USE_DNSCRYPT
+	if(c->dnscrypt)
+		return 0; /* written from the dnscrypt buffer */
+#endif
+	if(!c->tcp_write_prefixed) {
+		/* put the length in front of the result that is there */
+		if(cur + 2*sizeof(uint16_t) + len >
+			sldns_buffer_capacity(c->buffer))
+			return 0;
+		sldns_buffer_set_limit(c->buffer, cur + sizeof(uint16_t));
+		memmove(sldns_buffer_at(c->buffer, sizeof(uint16_t)),
+			sldns_buffer_begin(c->buffer), cur);
+		sldns_buffer_write_u16_at(c->buffer, 0, (uint16_t)cur);
+		c->tcp_write_prefixed = 1;
+		cur += sizeof(uint16_t);
+	}
+	if(cur + sizeof(uint16_t) + len > sldns_buffer_capacity(c->buffer))
+		return 0;
+	sldns_buffer_set_limit(c->buffer, cur + sizeof(uint16_t) + len);
+	sldns_buffer_write_u16_at(c->buffer, cur, (uint16_t)len);
+	sldns_buffer_write_at(c->buffer, cur + sizeof(uint16_t), buf, len);
+	return 1;
+}
+
+/** add pending results to the write, as far as they fit in the buffer */
+static void
+tcp_req_info_append_done(struct tcp_req_info* req)
+{
+	while(req->num_done_req > 0 && tcp_req_info_append_write(req,
+		req->done_req_list->buf, req->done_req_list->len)) {
+		struct tcp_req_done_item* item = tcp_req_info_pop_done(req);
+		free(item->buf);
+		free(item);
+	}
+}
+
+/** pick up the next results and start writing them to the channel */
 static void
 tcp_req_pickup_next_result(struct tcp_req_info* req)
 {
@@ -1983,6 +2129,7 @@ tcp_req_pickup_next_result(struct tcp_req_info* req)
 		free(item->buf);
 		free(item);
 	}
+	tcp_req_info_append_done(req);
 }
 
 /** the read channel has closed */
@@ -2027,6 +2174,9 @@ tcp_req_info_handle_writedone(struct tcp_req_info* req)
 	tcp_req_info_setup_listen(req);
 }
 
+static int tcp_req_info_add_result(struct tcp_req_info* req, uint8_t* buf,
+	size_t len);
+
 void
 tcp_req_info_handle_readdone(struct tcp_req_info* req)
 {
@@ -2051,7 +2201,17 @@ tcp_req_info_handle_readdone(struct tcp_req_info* req)
 		/* since we were just reading a query, the channel is
 		 * clear to write to */
 	send_it:
+		/* if the next query is in the TLS buffers already, answer
+		 * that too, and write the answers together */
+		if(comm_point_tls_msg_pending(c) && tcp_req_info_add_result(
+			req, sldns_buffer_begin(c->buffer),
+			sldns_buffer_limit(c->buffer))) {
+			sldns_buffer_clear(c->buffer);
+			req->read_again = 1;
+			return;
+		}
 		c->tcp_is_reading = 0;
+		tcp_req_info_append_done(req);
 		comm_point_stop_listening(c);
 		comm_point_start_listening(c, -1, adjusted_tcp_timeout(c));
 		return;
@@ -2111,7 +2271,19 @@ tcp_req_info_add_result(struct tcp_req_info* req, uint8_t* buf, size_t len)
 		verbose(VERB_ALGO, "drop stream reply, no space left, in stream-wait-size");
 		return 0;
 	}
+	/* when more than half is in use, a stream can only have its share,
+	 * so that one stream cannot take the space from the others */
+	if(stream_wait_count + space > stream_wait_max/2 &&
+		req->done_req_size + space > stream_wait_max /
+		(stream_wait_conns + (req->done_req_size == 0?1:0))) {
+		lock_basic_unlock(&stream_wait_count_lock);
+		verbose(VERB_ALGO, "drop stream reply, stream has its share of stream-wait-size");
+		return 0;
+	}
+	if(req->done_req_size == 0)
+		stream_wait_conns++;
 	stream_wait_count += space;
+	req->done_req_size += space;
 	lock_basic_unlock(&stream_wait_count_lock);
 
 	/* find last element */
@@ -2122,6 +2294,7 @@ tcp_req_info_add_result(struct tcp_req_info* req, uint8_t* buf, size_t len)
 	/* create new element */
 	item = (struct tcp_req_done_item*)malloc(sizeof(*item));
 	if(!item) {
+		tcp_req_info_release_space(req, space);
 		log_err("malloc failure, for stream result list");
 		return 0;
 	}
@@ -2130,6 +2303,7 @@ tcp_req_info_add_result(struct tcp_req_info* req, uint8_t* buf, size_t len)
 	item->buf = memdup(buf, len);
 	if(!item->buf) {
 		free(item);
+		tcp_req_info_release_space(req, space);
 		log_err("malloc failure, adding reply to stream result list");
 		return 0;
 	}
@@ -2174,6 +2348,11 @@ tcp_req_info_send_reply(struct tcp_req_info* req)
 			adjusted_tcp_timeout(req->cp));
 		return;
 	}
+	/* if a write is set up but has not started, add it to that write */
+	if(req->num_done_req == 0 && tcp_req_info_append_write(req,
+		sldns_buffer_begin(req->spool_buffer),
+		sldns_buffer_limit(req->spool_buffer)))
+		return;
 	/* queue up the answer behind the others already pending */
 	if(!tcp_req_info_add_result(req, sldns_buffer_begin(req->spool_buffer),
 		sldns_buffer_limit(req->spool_buffer))) {
@@ -150,6 +150,20 @@ struct listen_port* listening_ports_open(struct config_file* cfg,
  */
 void listening_ports_free(struct listen_port* list);
 
+/**
+ * Steer the queries on the reuseport sockets to the socket of the thread
+ * on the CPU that received them.  A program is attached to the reuseport
+ * groups of the ports, that picks the socket in the group, with the
+ * sockets in the order that they were opened.
+ * @param list: the ports that were opened first, of the first thread.
+ * @param cpus: the CPU of the thread of every socket in the groups,
+ *	or NULL to remove the program.
+ * @param num: number of sockets in the groups.
+ * @return false on failure, logged.
+ */
+int listening_ports_steer_cpu(struct listen_port* list, const int* cpus,
+	int num);
+
 struct config_strlist;
 /**
  * Resolve interface names in config and store result IP addresses
@@ -312,6 +326,8 @@ struct tcp_req_info {
 	int num_done_req;
 	/** list of pending writable result packets, malloced one at a time */
 	struct tcp_req_done_item* done_req_list;
+	/** bytes of stream-wait-size used by the pending results */
+	size_t done_req_size;
 };
 
 /**
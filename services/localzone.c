@@ -51,6 +51,7 @@
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
 #include "util/as112.h"
+#include "util/alloc.h"
 
 /* maximum RRs in an RRset, to cap possible 'endless' list RRs.
  * with 16 bytes for an A record, a 64K packet has about 4000 max */
@@ -63,9 +64,15 @@ local_zones_create(void)
 		sizeof(*zones));
 	if(!zones)
 		return NULL;
+	if(!lock_thr_rw_init(&zones->readers, 1)) {
+		free(zones);
+		return NULL;
+	}
 	rbtree_init(&zones->ztree, &local_zone_cmp);
+	name_hash_init(&zones->zidx);
 	lock_rw_init(&zones->lock);
 	lock_protect(&zones->lock, &zones->ztree, sizeof(zones->ztree));
+	lock_protect(&zones->lock, &zones->zidx, sizeof(zones->zidx));
 	/* also lock protects the rbnode's in struct local_zone */
 	return zones;
 }
@@ -84,11 +91,39 @@ local_zones_delete(struct local_zones* zones)
 	if(!zones)
 		return;
 	lock_rw_destroy(&zones->lock);
+	lock_thr_rw_destroy(&zones->readers);
 	/* walk through zones and delete them all */
 	traverse_postorder(&zones->ztree, lzdel, NULL);
+	name_hash_clear(&zones->zidx);
 	free(zones);
 }
 
+int
+local_zones_set_readers(struct local_zones* zones, int num)
+{
+	struct lock_thr_rw readers;
+	/* on failure the zones keep their lock, so they stay usable */
+	if(!lock_thr_rw_init(&readers, num))
+		return 0;
+	lock_thr_rw_destroy(&zones->readers);
+	zones->readers = readers;
+	return 1;
+}
+
+void
+local_zones_wrlock(struct local_zones* zones)
+{
+	lock_rw_wrlock(&zones->lock);
+	lock_thr_rw_wrlock(&zones->readers);
+}
+
+void
+local_zones_wrunlock(struct local_zones* zones)
+{
+	lock_thr_rw_wrunlock(&zones->readers);
+	lock_rw_unlock(&zones->lock);
+}
+
 void 
 local_zone_delete(struct local_zone* z)
 {
@@ -199,6 +234,7 @@ lz_enter_zone_dname(struct local_zones* zones, uint8_t* nm, size_t len,
 		local_zone_delete(oldz);
 		return z;
 	}
+	name_hash_insert(&zones->zidx, z->name, z->dclass, z);
 	lock_rw_unlock(&zones->lock);
 	return z;
 }
@@ -1149,6 +1185,25 @@ local_zones_tags_lookup(struct local_zones* zones,
 		dname_remove_label(&name, &len);
 		labs--;
 	}
+	if(name_hash_usable(&zones->zidx)) {
+		/* go up label by label, the first zone found is the
+		 * closest enclosing zone */
+		for(;;) {
+			result = (struct local_zone*)name_hash_lookup(
+				&zones->zidx, name, dclass);
+			if(result || dname_is_root(name))
+				break;
+			dname_remove_label(&name, &len);
+		}
+		while(result) {
+			if(ignoretags || !result->taglist ||
+				taglist_intersect(result->taglist,
+				result->taglen, taglist, taglen))
+				break;
+			result = result->parent;
+		}
+		return result;
+	}
 	key.node.key = &key;
 	key.dclass = dclass;
 	key.name = name;
@@ -1178,12 +1233,15 @@ local_zones_find(struct local_zones* zones,
         uint8_t* name, size_t len, int labs, uint16_t dclass)
 {
 	struct local_zone key;
+	/* exact */
+	if(name_hash_usable(&zones->zidx))
+		return (struct local_zone*)name_hash_lookup(&zones->zidx,
+			name, dclass);
 	key.node.key = &key;
 	key.dclass = dclass;
 	key.name = name;
 	key.namelen = len;
 	key.namelabs = labs;
-	/* exact */
 	return (struct local_zone*)rbtree_search(&zones->ztree, &key);
 }
 
@@ -1747,7 +1805,7 @@ local_zones_answer(struct local_zones* zones, struct module_env* env,
 	struct local_data* ld = NULL;
 	struct local_zone* z = NULL;
 	enum localzone_type lzt = local_zone_transparent;
-	int r, tag = -1;
+	int r, tag = -1, thr = -1;
 
 	if(view) {
 		lock_rw_rdlock(&view->lock);
@@ -1783,19 +1841,19 @@ local_zones_answer(struct local_zones* zones, struct module_env* env,
 		lock_rw_unlock(&view->lock);
 	}
 	if(!z) {
-		/* try global local_zones tree */
-		lock_rw_rdlock(&zones->lock);
+		/* try global local_zones tree, the readers lock of this
+		 * thread keeps the tree and the zone contents unchanged */
+		thr = env->alloc->thread_num;
+		lock_thr_rw_rdlock(&zones->readers, thr);
 		if(!(z = local_zones_tags_lookup(zones, qinfo->qname,
 			qinfo->qname_len, labs, qinfo->qclass, qinfo->qtype,
 			taglist, taglen, 0))) {
-			lock_rw_unlock(&zones->lock);
+			lock_thr_rw_rdunlock(&zones->readers, thr);
 			return 0;
 		}
-		lock_rw_rdlock(&z->lock);
 		lzt = lz_type(taglist, taglen, z->taglist, z->taglen,
 			tagactions, tagactionssize, z->type, repinfo,
 			z->override_tree, &tag, tagname, num_tags);
-		lock_rw_unlock(&zones->lock);
 		if(z && verbosity >= VERB_ALGO) {
 			char zname[255+1];
 			dname_str(z->name, zname);
@@ -1817,13 +1875,19 @@ local_zones_answer(struct local_zones* zones, struct module_env* env,
 		&& lzt != local_zone_always_deny
 		&& local_data_answer(z, env, qinfo, edns, repinfo, buf, temp, labs,
 			&ld, lzt, tag, tag_datas, tag_datas_size, tagname, num_tags)) {
-		lock_rw_unlock(&z->lock);
+		if(thr != -1)
+			lock_thr_rw_rdunlock(&zones->readers, thr);
+		else
+			lock_rw_unlock(&z->lock);
 		/* We should tell the caller that encode is deferred if we found
 		 * a local alias. */
 		return !qinfo->local_alias;
 	}
 	r = local_zones_zone_answer(z, env, qinfo, edns, repinfo, buf, temp, ld, lzt);
-	lock_rw_unlock(&z->lock);
+	if(thr != -1)
+		lock_thr_rw_rdunlock(&zones->readers, thr);
+	else
+		lock_rw_unlock(&z->lock);
 	return r && !qinfo->local_alias; /* see above */
 }
 
@@ -1942,6 +2006,7 @@ struct local_zone* local_zones_add_zone(struct local_zones* zones,
 		log_err("internal: duplicate entry in local_zones_add_zone");
 		return NULL;
 	}
+	name_hash_insert(&zones->zidx, z->name, z->dclass, z);
 
 	/* set parent pointers right */
 	set_kiddo_parents(z, z->parent, z);
@@ -1958,6 +2023,7 @@ void local_zones_del_zone(struct local_zones* zones, struct local_zone* z)
 
 	/* remove from tree */
 	(void)rbtree_delete(&zones->ztree, z);
+	name_hash_remove(&zones->zidx, z->name, z->dclass);
 
 	/* delete the zone */
 	lock_rw_unlock(&z->lock);
@@ -1979,22 +2045,22 @@ local_zones_add_RR(struct local_zones* zones, const char* rr)
 	labs = dname_count_size_labels(rr_name, &len);
 	/* could first try readlock then get writelock if zone does not exist,
 	 * but we do not add enough RRs (from multiple threads) to optimize */
-	lock_rw_wrlock(&zones->lock);
+	local_zones_wrlock(zones);
 	z = local_zones_lookup(zones, rr_name, len, labs, rr_class, rr_type);
 	if(!z) {
 		z = local_zones_add_zone(zones, rr_name, len, labs, rr_class,
 			local_zone_transparent);
 		if(!z) {
-			lock_rw_unlock(&zones->lock);
+			local_zones_wrunlock(zones);
 			return 0;
 		}
 	} else {
 		free(rr_name);
 	}
 	lock_rw_wrlock(&z->lock);
-	lock_rw_unlock(&zones->lock);
 	r = lz_enter_rr_into_zone(z, rr);
 	lock_rw_unlock(&z->lock);
+	local_zones_wrunlock(zones);
 	return r;
 }
 
@@ -2057,7 +2123,7 @@ void local_zones_del_data(struct local_zones* zones,
 	struct local_data* d;
 
 	/* remove DS */
-	lock_rw_rdlock(&zones->lock);
+	local_zones_wrlock(zones);
 	z = local_zones_lookup(zones, name, len, labs, dclass, LDNS_RR_TYPE_DS);
 	if(z) {
 		lock_rw_wrlock(&z->lock);
@@ -2068,18 +2134,15 @@ void local_zones_del_data(struct local_zones* zones,
 		}
 		lock_rw_unlock(&z->lock);
 	}
-	lock_rw_unlock(&zones->lock);
 
 	/* remove other types */
-	lock_rw_rdlock(&zones->lock);
 	z = local_zones_lookup(zones, name, len, labs, dclass, 0);
 	if(!z) {
 		/* no such zone, we're done */
-		lock_rw_unlock(&zones->lock);
+		local_zones_wrunlock(zones);
 		return;
 	}
 	lock_rw_wrlock(&z->lock);
-	lock_rw_unlock(&zones->lock);
 
 	/* find the domain */
 	d = local_zone_find_data(z, name, len, labs);
@@ -2097,4 +2160,5 @@ void local_zones_del_data(struct local_zones* zones,
 	}
 
 	lock_rw_unlock(&z->lock);
+	local_zones_wrunlock(zones);
 }
@@ -44,6 +44,7 @@
 #include "util/rbtree.h"
 #include "util/locks.h"
 #include "util/storage/dnstree.h"
+#include "util/storage/namehash.h"
 #include "util/module.h"
 #include "services/view.h"
 #include "sldns/sbuffer.h"
@@ -111,8 +112,14 @@ enum localzone_type {
 struct local_zones {
 	/** lock on the localzone tree */
 	lock_rw_type lock;
+	/** lock for the query threads, that read the tree and the zone
+	 * contents with only the lock of their own thread.  Changes after
+	 * the setup from config hold it for writing, with local_zones_wrlock */
+	struct lock_thr_rw readers;
 	/** rbtree of struct local_zone */
 	rbtree_type ztree;
+	/** hash index of the zones in ztree, by name and class */
+	struct name_hash zidx;
 };
 
 /**
@@ -213,6 +220,29 @@ struct local_zones* local_zones_create(void);
  */
 void local_zones_delete(struct local_zones* zones);
 
+/**
+ * Set the number of query threads that read the local zones, the
+ * threads then do not share a lock.  Call before the zones are in use.
+ * @param zones: the local zones.
+ * @param num: number of threads.
+ * @return false on malloc failure, the zones then keep the lock that
+ *	they had, and can still be used.
+ */
+int local_zones_set_readers(struct local_zones* zones, int num);
+
+/**
+ * Lock the local zones for a change, after the setup from config.
+ * This locks the zones lock, and the readers lock, for writing.
+ * @param zones: the local zones.
+ */
+void local_zones_wrlock(struct local_zones* zones);
+
+/**
+ * Unlock the local zones after a change, locked with local_zones_wrlock.
+ * @param zones: the local zones.
+ */
+void local_zones_wrunlock(struct local_zones* zones);
+
 /**
  * Apply config settings; setup the local authoritative data. 
  * Takes care of locking.
@@ -390,7 +420,8 @@ local_zones_find_le(struct local_zones* zones,
 	int* exact);
 
 /**
- * Add a new zone. Caller must hold the zones lock.
+ * Add a new zone. Caller must hold the zones lock, with local_zones_wrlock
+ * if the zones are in use.
  * Adjusts the other zones as well (parent pointers) after insertion.
  * The zone must NOT exist (returns NULL and logs error).
  * @param zones: the zones tree
@@ -406,7 +437,8 @@ struct local_zone* local_zones_add_zone(struct local_zones* zones,
 	enum localzone_type tp);
 
 /**
- * Delete a zone. Caller must hold the zones lock.
+ * Delete a zone. Caller must hold the zones lock, with local_zones_wrlock
+ * if the zones are in use.
  * Adjusts the other zones as well (parent pointers) after insertion.
  * @param zones: the zones tree
  * @param zone: the zone to delete from tree. Also deletes zone from memory.
@@ -63,6 +63,7 @@
 #include "util/data/dname.h"
 #include "respip/respip.h"
 #include "services/listen_dnsport.h"
+#include "services/inflight.h"
 
 /** subtract timers and the values do not overflow or become negative */
 static void
@@ -244,6 +245,68 @@ mesh_state_ref_compare(const void* ap, const void* bp)
 	return mesh_state_compare(a->s, b->s);
 }
 
+int
+mesh_state_run_compare(const void* ap, const void* bp)
+{
+	struct mesh_state* a = (struct mesh_state*)ap;
+	struct mesh_state* b = (struct mesh_state*)bp;
+	if(a->pclass != b->pclass)
+		return a->pclass < b->pclass ? -1 : 1;
+	return mesh_state_compare(ap, bp);
+}
+
+/** set up the priority classes from the config */
+static int
+mesh_pclass_setup(struct mesh_area* mesh, struct config_file* cfg)
+{
+	const char* names[CFG_PRIORITY_CLASS_MAX];
+	int percent[CFG_PRIORITY_CLASS_MAX];
+	int i, num = cfg_priority_classes(cfg, names, percent);
+	if(num == -1)
+		return 0;
+	log_assert(num <= UB_STATS_PCLASS_NUM);
+	for(i=0; i<num; i++) {
+		struct mesh_pclass* c = &mesh->pclass[i];
+		c->name = names[i];
+		/* a share of the requestlist and of the outgoing-range */
+		if(percent[i] != 0) {
+			c->max_states = mesh->max_reply_states *
+				(size_t)percent[i] / 100;
+			c->max_fetches = (size_t)cfg->outgoing_num_ports *
+				(size_t)percent[i] / 100;
+			if(c->max_states == 0)
+				c->max_states = 1;
+			if(c->max_fetches == 0)
+				c->max_fetches = 1;
+		}
+		if(strcmp(names[i], "client") == 0)
+			mesh->pclass_client = i;
+		else if(strcmp(names[i], "internal") == 0)
+			mesh->pclass_internal = i;
+		else if(strcmp(names[i], "prefetch") == 0)
+			mesh->pclass_prefetch = i;
+	}
+	mesh->num_pclass = num;
+	return 1;
+}
+
+/** see if the priority class has space for a new state */
+static int
+mesh_pclass_space(struct mesh_area* mesh, int pclass)
+{
+	struct mesh_pclass* c = &mesh->pclass[pclass];
+	return c->max_states == 0 || c->num_states < c->max_states;
+}
+
+/** set the priority class of a new state */
+static void
+mesh_state_set_pclass(struct mesh_area* mesh, struct mesh_state* s,
+	int pclass)
+{
+	s->pclass = pclass;
+	mesh->pclass[pclass].num_states++;
+}
+
 struct mesh_area* 
 mesh_create(struct module_stack* stack, struct module_env* env)
 {
@@ -261,7 +324,7 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	}
 	mesh->mods = *stack;
 	mesh->env = env;
-	rbtree_init(&mesh->run, &mesh_state_compare);
+	rbtree_init(&mesh->run, &mesh_state_run_compare);
 	rbtree_init(&mesh->all, &mesh_state_compare);
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
@@ -270,8 +333,16 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	mesh->stats_jostled = 0;
 	mesh->stats_dropped = 0;
 	mesh->ans_expired = 0;
+	mesh->num_joined = 0;
 	mesh->max_reply_states = env->cfg->num_queries_per_thread;
 	mesh->max_forever_states = (mesh->max_reply_states+1)/2;
+	if(!mesh_pclass_setup(mesh, env->cfg)) {
+		timehist_delete(mesh->histogram);
+		sldns_buffer_free(mesh->qbuf_bak);
+		free(mesh);
+		log_err("mesh area: could not set up the priority classes");
+		return NULL;
+	}
 #ifndef S_SPLINT_S
 	mesh->jostle_max.tv_sec = (time_t)(env->cfg->jostle_time / 1000);
 	mesh->jostle_max.tv_usec = (time_t)((env->cfg->jostle_time % 1000)
@@ -314,7 +385,7 @@ mesh_delete_all(struct mesh_area* mesh)
 		mesh_delete_helper(mesh->all.root);
 	mesh->stats_dropped += mesh->num_reply_addrs;
 	/* clear mesh area references */
-	rbtree_init(&mesh->run, &mesh_state_compare);
+	rbtree_init(&mesh->run, &mesh_state_run_compare);
 	rbtree_init(&mesh->all, &mesh_state_compare);
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
@@ -326,7 +397,51 @@ mesh_delete_all(struct mesh_area* mesh)
 	mesh->jostle_last = NULL;
 }
 
-int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
+/** jostle out a reply state to make space for a new one */
+static void
+mesh_jostle_out(struct mesh_area* mesh, struct mesh_state* m,
+	sldns_buffer* qbuf)
+{
+	log_nametypeclass(VERB_ALGO, "query jostled out to "
+		"make space for a new one",
+		m->s.qinfo.qname, m->s.qinfo.qtype,
+		m->s.qinfo.qclass);
+	/* backup the query */
+	if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
+	/* notify supers */
+	if(m->super_set.count > 0) {
+		verbose(VERB_ALGO, "notify supers of failure");
+		m->s.return_msg = NULL;
+		m->s.return_rcode = LDNS_RCODE_SERVFAIL;
+		mesh_walk_supers(mesh, m);
+	}
+	mesh->stats_jostled ++;
+	mesh_state_delete(&m->s);
+	/* restore the query - note that the qinfo ptr to
+	 * the querybuffer is then correct again. */
+	if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+}
+
+/** find the oldest reply state of a class with a lower priority */
+static struct mesh_state*
+mesh_pclass_find_lower(struct mesh_area* mesh, int pclass)
+{
+	struct mesh_state* m;
+	size_t lower = 0;
+	int i;
+	for(i=pclass+1; i<mesh->num_pclass; i++)
+		lower += mesh->pclass[i].num_states;
+	if(lower == 0)
+		return NULL;
+	for(m = mesh->jostle_first; m; m = m->next) {
+		if(m->pclass > pclass && m->reply_list)
+			return m;
+	}
+	return NULL;
+}
+
+int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf,
+	int pclass)
 {
 	struct mesh_state* m = mesh->jostle_first;
 	/* free space is available */
@@ -340,27 +455,15 @@ int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 			&m->reply_list->start_time);
 		if(timeval_smaller(&mesh->jostle_max, &age)) {
 			/* its a goner */
-			log_nametypeclass(VERB_ALGO, "query jostled out to "
-				"make space for a new one",
-				m->s.qinfo.qname, m->s.qinfo.qtype,
-				m->s.qinfo.qclass);
-			/* backup the query */
-			if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
-			/* notify supers */
-			if(m->super_set.count > 0) {
-				verbose(VERB_ALGO, "notify supers of failure");
-				m->s.return_msg = NULL;
-				m->s.return_rcode = LDNS_RCODE_SERVFAIL;
-				mesh_walk_supers(mesh, m);
-			}
-			mesh->stats_jostled ++;
-			mesh_state_delete(&m->s);
-			/* restore the query - note that the qinfo ptr to
-			 * the querybuffer is then correct again. */
-			if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+			mesh_jostle_out(mesh, m, qbuf);
 			return 1;
 		}
 	}
+	/* a query of a lower priority class makes space, whatever its age */
+	if((m = mesh_pclass_find_lower(mesh, pclass)) != NULL) {
+		mesh_jostle_out(mesh, m, qbuf);
+		return 1;
+	}
 	/* no space for new item */
 	return 0;
 }
@@ -456,9 +559,89 @@ mesh_serve_expired_init(struct mesh_state* mstate, int timeout)
 	return 1;
 }
 
+/** add the state to a list of states that wait or are woken up */
+static void
+mesh_inflight_link(struct mesh_state** first, struct mesh_state* mstate)
+{
+	mstate->inflight_prev = NULL;
+	mstate->inflight_next = *first;
+	if(*first)
+		(*first)->inflight_prev = mstate;
+	*first = mstate;
+}
+
+/** remove the state from a list of states that wait or are woken up */
+static void
+mesh_inflight_unlink(struct mesh_state** first, struct mesh_state* mstate)
+{
+	if(mstate->inflight_prev)
+		mstate->inflight_prev->inflight_next = mstate->inflight_next;
+	else	*first = mstate->inflight_next;
+	if(mstate->inflight_next)
+		mstate->inflight_next->inflight_prev = mstate->inflight_prev;
+	mstate->inflight_prev = NULL;
+	mstate->inflight_next = NULL;
+}
+
+/**
+ * See if another thread resolves the query of the new client state.
+ * @param mesh: the mesh.
+ * @param mstate: the new state.
+ * @return true if the state waits for the other thread, and does not run.
+ */
+static int
+mesh_inflight_wait(struct mesh_area* mesh, struct mesh_state* mstate)
+{
+	enum inflight_result r;
+	/* client specific processing is not shared */
+	if(!mesh->inflight || mstate->unique || mstate->s.client_info ||
+		mstate->s.is_priming || mstate->s.is_valrec)
+		return 0;
+	r = inflight_start(mesh->inflight, &mstate->s.qinfo,
+		mstate->s.query_flags);
+	if(r == inflight_wait) {
+		mstate->inflight = 2;
+		mesh_inflight_link(&mesh->inflight_first, mstate);
+		mesh->num_joined++;
+		log_query_info(VERB_ALGO, "mesh waits for the query on "
+			"another thread", &mstate->s.qinfo);
+		return 1;
+	}
+	mstate->inflight = (r == inflight_own)?1:0;
+	return 0;
+}
+
+void
+mesh_inflight_wakeup(struct mesh_area* mesh)
+{
+	struct mesh_state* m;
+	/* move the states that wait to the list of woken up states, this
+	 * list is updated when a state that runs deletes other states */
+	while((m = mesh->inflight_first) != NULL) {
+		mesh_inflight_unlink(&mesh->inflight_first, m);
+		mesh_inflight_link(&mesh->inflight_ready, m);
+		m->inflight = 3;
+	}
+	while((m = mesh->inflight_ready) != NULL) {
+		enum inflight_result r;
+		mesh_inflight_unlink(&mesh->inflight_ready, m);
+		r = inflight_start(mesh->inflight, &m->s.qinfo,
+			m->s.query_flags);
+		if(r == inflight_wait) {
+			/* the other thread is not done with it */
+			m->inflight = 2;
+			mesh_inflight_link(&mesh->inflight_first, m);
+			continue;
+		}
+		m->inflight = (r == inflight_own)?1:0;
+		mesh_run(mesh, m, module_event_new, NULL);
+	}
+}
+
 void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	struct respip_client_info* cinfo, uint16_t qflags,
-	struct edns_data* edns, struct comm_reply* rep, uint16_t qid)
+	struct edns_data* edns, struct comm_reply* rep, uint16_t qid,
+	int pclass)
 {
 	struct mesh_state* s = NULL;
 	int unique = unique_mesh_state(edns->opt_list, mesh->env);
@@ -471,15 +654,27 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	if(rep->c->tcp_req_info) {
 		r_buffer = rep->c->tcp_req_info->spool_buffer;
 	}
+	if(pclass == -1)
+		pclass = mesh->pclass_client;
 	if(!unique)
 		s = mesh_area_find(mesh, cinfo, qinfo, qflags&(BIT_RD|BIT_CD), 0, 0);
 	/* does this create a new reply state? */
 	if(!s || s->list_select == mesh_no_list) {
-		if(!mesh_make_new_space(mesh, rep->c->buffer)) {
+		if(!s && !mesh_pclass_space(mesh, pclass)) {
+			verbose(VERB_ALGO, "Too many queries in priority "
+				"class %s. dropping incoming query.",
+				mesh->pclass[pclass].name);
+			comm_point_drop_reply(rep);
+			mesh->stats_dropped++;
+			mesh->pclass[pclass].stats_dropped++;
+			return;
+		}
+		if(!mesh_make_new_space(mesh, rep->c->buffer, pclass)) {
 			verbose(VERB_ALGO, "Too many queries. dropping "
 				"incoming query.");
 			comm_point_drop_reply(rep);
 			mesh->stats_dropped++;
+			mesh->pclass[pclass].stats_dropped++;
 			return;
 		}
 		/* for this new reply state, the reply address is free,
@@ -511,6 +706,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			comm_point_send_reply(rep);
 			return;
 		}
+		mesh_state_set_pclass(mesh, s, pclass);
 		if(unique)
 			mesh_state_make_unique(s);
 		/* copy the edns options we got from the front */
@@ -587,7 +783,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			s->list_select = mesh_jostle_list;
 		}
 	}
-	if(added)
+	if(added && !mesh_inflight_wait(mesh, s))
 		mesh_run(mesh, s, module_event_new, NULL);
 	return;
 
@@ -630,6 +826,7 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 		if(!s) {
 			return 0;
 		}
+		mesh_state_set_pclass(mesh, s, mesh->pclass_client);
 		if(unique)
 			mesh_state_make_unique(s);
 		if(edns->opt_list) {
@@ -703,9 +900,18 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 			s->s.prefetch_leeway = leeway;
 		return;
 	}
-	if(!mesh_make_new_space(mesh, NULL)) {
+	if(!mesh_pclass_space(mesh, mesh->pclass_prefetch)) {
+		verbose(VERB_ALGO, "Too many queries in priority class %s. "
+			"dropped prefetch.",
+			mesh->pclass[mesh->pclass_prefetch].name);
+		mesh->stats_dropped ++;
+		mesh->pclass[mesh->pclass_prefetch].stats_dropped++;
+		return;
+	}
+	if(!mesh_make_new_space(mesh, NULL, mesh->pclass_prefetch)) {
 		verbose(VERB_ALGO, "Too many queries. dropped prefetch.");
 		mesh->stats_dropped ++;
+		mesh->pclass[mesh->pclass_prefetch].stats_dropped++;
 		return;
 	}
 
@@ -715,6 +921,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 		log_err("prefetch mesh_state_create: out of memory");
 		return;
 	}
+	mesh_state_set_pclass(mesh, s, mesh->pclass_prefetch);
 #ifdef UNBOUND_DEBUG
 	n =
 #else
@@ -762,6 +969,21 @@ void mesh_new_prefetch(struct mesh_area* mesh, struct query_info* qinfo,
 	mesh_schedule_prefetch(mesh, qinfo, qflags, leeway, 1);
 }
 
+int
+mesh_pclass_fetch(struct module_qstate* qstate, size_t** count)
+{
+	struct mesh_pclass* c = &qstate->env->mesh->pclass[
+		qstate->mesh_info->pclass];
+	if(c->max_fetches != 0 && c->num_fetches >= c->max_fetches) {
+		verbose(VERB_ALGO, "Too many outgoing queries in priority "
+			"class %s.", c->name);
+		*count = NULL;
+		return 0;
+	}
+	*count = &c->num_fetches;
+	return 1;
+}
+
 void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
         struct comm_reply* reply, int what)
 {
@@ -834,6 +1056,7 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	mstate->s.env = env;
 	mstate->s.mesh_info = mstate;
 	mstate->s.prefetch_leeway = 0;
+	mstate->pclass = -1;
 	mstate->s.serve_expired_data = NULL;
 	mstate->s.no_cache_lookup = 0;
 	mstate->s.no_cache_store = 0;
@@ -874,6 +1097,21 @@ mesh_state_cleanup(struct mesh_state* mstate)
 	if(!mstate)
 		return;
 	mesh = mstate->s.env->mesh;
+	/* the threads that wait for it resolve it themselves, or take the
+	 * answer from the cache */
+	if(mstate->inflight == 1)
+		inflight_done(mesh->inflight, &mstate->s.qinfo,
+			mstate->s.query_flags);
+	else if(mstate->inflight == 2)
+		mesh_inflight_unlink(&mesh->inflight_first, mstate);
+	else if(mstate->inflight == 3)
+		mesh_inflight_unlink(&mesh->inflight_ready, mstate);
+	mstate->inflight = 0;
+	if(mstate->pclass != -1) {
+		log_assert(mesh->pclass[mstate->pclass].num_states > 0);
+		mesh->pclass[mstate->pclass].num_states--;
+		mstate->pclass = -1;
+	}
 	/* Stop and delete the serve expired timer */
 	if(mstate->s.serve_expired_data && mstate->s.serve_expired_data->timer) {
 		comm_timer_delete(mstate->s.serve_expired_data->timer);
@@ -1023,6 +1261,13 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 #ifdef UNBOUND_DEBUG
 		struct rbnode_type* n;
 #endif
+		if(!mesh_pclass_space(mesh, mesh->pclass_internal)) {
+			verbose(VERB_ALGO, "attach failed, too many queries "
+				"in priority class %s",
+				mesh->pclass[mesh->pclass_internal].name);
+			mesh->pclass[mesh->pclass_internal].stats_dropped++;
+			return 0;
+		}
 		/* create a new one */
 		*sub = mesh_state_create(qstate->env, qinfo, NULL, qflags, prime,
 			valrec);
@@ -1030,6 +1275,7 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 			log_err("mesh_attach_sub: out of memory");
 			return 0;
 		}
+		mesh_state_set_pclass(mesh, *sub, mesh->pclass_internal);
 #ifdef UNBOUND_DEBUG
 		n =
 #else
@@ -1314,6 +1560,9 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 		(long long)duration.tv_sec, (int)duration.tv_usec);
 	m->s.env->mesh->replies_sent++;
 	timeval_add(&m->s.env->mesh->replies_sum_wait, &duration);
+	m->s.env->mesh->pclass[m->pclass].replies_sent++;
+	timeval_add(&m->s.env->mesh->pclass[m->pclass].replies_sum_wait,
+		&duration);
 	timehist_insert(m->s.env->mesh->histogram, &duration);
 	if(m->s.env->cfg->stat_extended) {
 		uint16_t rc = FLAGS_GET_RCODE(sldns_buffer_read_u16_at(
@@ -1723,8 +1972,14 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 		/* run more modules */
 		ev = module_event_pass;
 		if(mesh->run.count > 0) {
-			/* pop random element off the runnable tree */
-			mstate = (struct mesh_state*)mesh->run.root->key;
+			/* pop random element off the runnable tree, of
+			 * the class with the highest priority */
+			mstate = (struct mesh_state*)rbtree_first(
+				&mesh->run)->key;
+			if(((struct mesh_state*)mesh->run.root->key)->pclass
+				== mstate->pclass)
+				mstate = (struct mesh_state*)
+					mesh->run.root->key;
 			(void)rbtree_delete(&mesh->run, mstate);
 		} else mstate = NULL;
 	}
@@ -1783,6 +2038,7 @@ mesh_stats(struct mesh_area* mesh, const char* str)
 void 
 mesh_stats_clear(struct mesh_area* mesh)
 {
+	int i;
 	if(!mesh)
 		return;
 	mesh->replies_sent = 0;
@@ -1794,9 +2050,16 @@ mesh_stats_clear(struct mesh_area* mesh)
 	mesh->ans_secure = 0;
 	mesh->ans_bogus = 0;
 	mesh->ans_expired = 0;
+	mesh->num_joined = 0;
 	memset(&mesh->ans_rcode[0], 0, sizeof(size_t)*UB_STATS_RCODE_NUM);
 	memset(&mesh->rpz_action[0], 0, sizeof(size_t)*UB_STATS_RPZ_ACTION_NUM);
 	mesh->ans_nodata = 0;
+	for(i=0; i<mesh->num_pclass; i++) {
+		mesh->pclass[i].stats_dropped = 0;
+		mesh->pclass[i].replies_sent = 0;
+		mesh->pclass[i].replies_sum_wait.tv_sec = 0;
+		mesh->pclass[i].replies_sum_wait.tv_usec = 0;
+	}
 }
 
 size_t 
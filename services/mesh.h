@@ -62,6 +62,7 @@ struct reply_info;
 struct outbound_entry;
 struct timehist;
 struct respip_client_info;
+struct inflight_conn;
 
 /**
  * Maximum number of mesh state activations. Any more is likely an
@@ -76,6 +77,29 @@ struct respip_client_info;
  */
 #define MESH_MAX_SUBSUB 1024
 
+/**
+ * A priority class of query states.  The classes are in the order of
+ * priority, the runnable states of the first class are run first.
+ */
+struct mesh_pclass {
+	/** the name of the class, points into the config */
+	const char* name;
+	/** max number of query states in the class, 0 for no limit */
+	size_t max_states;
+	/** max number of outstanding upstream queries, 0 for no limit */
+	size_t max_fetches;
+	/** number of query states in the class */
+	size_t num_states;
+	/** number of outstanding upstream queries of the class */
+	size_t num_fetches;
+	/** stats, number of queries dropped because the class was full */
+	size_t stats_dropped;
+	/** stats, number of replies sent */
+	size_t replies_sent;
+	/** stats, sum of waiting times for the replies */
+	struct timeval replies_sum_wait;
+};
+
 /** 
  * Mesh of query states
  */
@@ -114,6 +138,8 @@ struct mesh_area {
 	size_t stats_dropped;
 	/** stats, number of expired replies sent */
 	size_t ans_expired;
+	/** stats, number of queries that waited for another thread */
+	size_t num_joined;
 	/** number of replies sent */
 	size_t replies_sent;
 	/** sum of waiting times for the replies */
@@ -131,6 +157,17 @@ struct mesh_area {
 	/** (extended stats) type of applied RPZ action */
 	size_t rpz_action[UB_STATS_RPZ_ACTION_NUM];
 
+	/** the priority classes, in the order of priority */
+	struct mesh_pclass pclass[UB_STATS_PCLASS_NUM];
+	/** number of priority classes */
+	int num_pclass;
+	/** the class of the queries from clients */
+	int pclass_client;
+	/** the class of the queries that the modules need to continue */
+	int pclass_internal;
+	/** the class of the prefetch queries */
+	int pclass_prefetch;
+
 	/** backup of query if other operations recurse and need the
 	 * network buffers */
 	struct sldns_buffer* qbuf_bak;
@@ -153,6 +190,14 @@ struct mesh_area {
 	int use_response_ip;
 	/** If we need to use RPZ (value passed from daemon) */
 	int use_rpz;
+
+	/** connection to the queries in flight on the other threads, or
+	 * NULL if they are not shared */
+	struct inflight_conn* inflight;
+	/** list of the query states that wait for another thread */
+	struct mesh_state* inflight_first;
+	/** list of the query states that are woken up, and start */
+	struct mesh_state* inflight_ready;
 };
 
 /**
@@ -194,6 +239,16 @@ struct mesh_state {
 		mesh_jostle_list } list_select;
 	/** pointer to this state for uniqueness or NULL */
 	struct mesh_state* unique;
+	/** if the state is in the shared table of queries in flight,
+	 * 0 not, 1 this thread resolves it, 2 it waits for another thread,
+	 * 3 it is woken up and starts */
+	int inflight;
+	/** previous in the list of states that wait or are woken up */
+	struct mesh_state* inflight_prev;
+	/** next in the list of states that wait or are woken up */
+	struct mesh_state* inflight_next;
+	/** the priority class of the state, it does not change */
+	int pclass;
 
 	/** true if replies have been sent out (at end for alignment) */
 	uint8_t replies_sent;
@@ -296,10 +351,12 @@ void mesh_delete(struct mesh_area* mesh);
  * @param edns: edns data from client query.
  * @param rep: where to reply to.
  * @param qid: query id to reply with.
+ * @param pclass: priority class of the client, -1 for the client class.
  */
 void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	struct respip_client_info* cinfo, uint16_t qflags,
-	struct edns_data* edns, struct comm_reply* rep, uint16_t qid);
+	struct edns_data* edns, struct comm_reply* rep, uint16_t qid,
+	int pclass);
 
 /**
  * New query with callback. Create new query state if needed, and
@@ -565,6 +622,14 @@ int mesh_state_add_cb(struct mesh_state* s, struct edns_data* edns,
 void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate, 
 	enum module_ev ev, struct outbound_entry* e);
 
+/**
+ * The queries in flight on other threads that states of the mesh wait for
+ * may be done.  The states that do not wait any more start, and find the
+ * answer in the cache or resolve it.
+ * @param mesh: the mesh.
+ */
+void mesh_inflight_wakeup(struct mesh_area* mesh);
+
 /**
  * Print some stats about the mesh to the log.
  * @param mesh: the mesh to print it for.
@@ -614,6 +679,9 @@ int mesh_state_compare(const void* ap, const void* bp);
 /** compare two mesh references */
 int mesh_state_ref_compare(const void* ap, const void* bp);
 
+/** compare two mesh states in the runnable tree, by priority class */
+int mesh_state_run_compare(const void* ap, const void* bp);
+
 /**
  * Make space for another recursion state for a reply in the mesh
  * @param mesh: mesh area
@@ -624,9 +692,23 @@ int mesh_state_ref_compare(const void* ap, const void* bp);
  *    udp query is sent - on error callback - callback sends SERVFAIL reply
  *    over the same network channel, and shared UDP buffer is overwritten.
  *    You can pass NULL if there is no buffer that must be backed up.
+ * @param pclass: priority class of the new state.  If there is no space,
+ *    a reply state of a class with a lower priority can be jostled out.
  * @return false if no space is available.
  */
-int mesh_make_new_space(struct mesh_area* mesh, struct sldns_buffer* qbuf);
+int mesh_make_new_space(struct mesh_area* mesh, struct sldns_buffer* qbuf,
+	int pclass);
+
+/**
+ * See if the priority class of a query state may send another query
+ * upstream.
+ * @param qstate: the query state.
+ * @param count: the counter of the outstanding queries of the class is
+ *    returned, to increment when the query is sent and decrement when it
+ *    is done.
+ * @return false if the class has too many outstanding queries.
+ */
+int mesh_pclass_fetch(struct module_qstate* qstate, size_t** count);
 
 /**
  * Insert mesh state into a double linked list.  Inserted at end.
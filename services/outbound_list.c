@@ -58,6 +58,8 @@ outbound_list_clear(struct outbound_list* list)
 	while(p) {
 		np = p->next;
 		outnet_serviced_query_stop(p->qsent, p);
+		if(p->fetch_count)
+			(*p->fetch_count)--;
 		/* in region, no free needed */
 		p = np;
 	}
@@ -80,6 +82,8 @@ outbound_list_remove(struct outbound_list* list, struct outbound_entry* e)
 	if(!e)
 		return;
 	outnet_serviced_query_stop(e->qsent, e);
+	if(e->fetch_count)
+		(*e->fetch_count)--;
 	if(e->next)
 		e->next->prev = e->prev;
 	if(e->prev)
@@ -67,6 +67,9 @@ struct outbound_entry {
 	struct serviced_query* qsent;
 	/** the module query state that sent it */
 	struct module_qstate* qstate;
+	/** counter of the outstanding queries of the priority class of the
+	 * query state, decremented when the entry is removed, or NULL */
+	size_t* fetch_count;
 };
 
 /**
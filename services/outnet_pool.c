@@ -0,0 +1,516 @@
+/*
+ * services/outnet_pool.c - shared upstream TCP and TLS streams.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the pool of upstream TCP and TLS streams that is
+ * shared by the threads.
+ */
+#include "config.h"
+#include "services/outnet_pool.h"
+#include "services/outside_network.h"
+#include "util/netevent.h"
+#include "util/tube.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/random.h"
+#include "util/config_file.h"
+#include "util/fptr_wlist.h"
+#include "sldns/sbuffer.h"
+
+/** delete a job */
+static void
+job_free(struct outnet_pool_job* job)
+{
+	if(!job)
+		return;
+	if(job->psq) {
+		free(job->psq->tls_auth_name);
+		free(job->psq);
+	}
+	free(job->pkt);
+	free(job->reply);
+	free(job);
+}
+
+/** append the job to a list, with the lock */
+static void
+list_append(struct outnet_pool_job** first, struct outnet_pool_job** last,
+	struct outnet_pool_job* job)
+{
+	job->next = NULL;
+	job->prev = *last;
+	if(*last)
+		(*last)->next = job;
+	else	*first = job;
+	*last = job;
+}
+
+/** remove the job from a list, with the lock.  The last element can be
+ * NULL for a list that has no last element. */
+static void
+list_remove(struct outnet_pool_job** first, struct outnet_pool_job** last,
+	struct outnet_pool_job* job)
+{
+	if(job->prev)
+		job->prev->next = job->next;
+	else	*first = job->next;
+	if(job->next)
+		job->next->prev = job->prev;
+	else if(last)
+		*last = job->prev;
+	job->next = NULL;
+	job->prev = NULL;
+}
+
+/** remove the job from the jobs of its connection, with the lock */
+static void
+conn_list_remove(struct outnet_pool_conn* conn, struct outnet_pool_job* job)
+{
+	if(job->conn_prev)
+		job->conn_prev->conn_next = job->conn_next;
+	else	conn->jobs = job->conn_next;
+	if(job->conn_next)
+		job->conn_next->conn_prev = job->conn_prev;
+	job->conn_next = NULL;
+	job->conn_prev = NULL;
+}
+
+/** update the stream statistics, on the pool thread with the lock */
+static void
+pool_stats_streams(struct outnet_pool* pool)
+{
+	struct outside_network* outnet = pool->outnet;
+	size_t i, n = 0;
+	for(i=0; i<outnet->num_tcp; i++) {
+		if(outnet->tcp_conns[i]->c->fd != -1)
+			n++;
+	}
+	pool->stats.streams = n;
+	/* the outside network counts the streams it opens */
+	pool->stats.opened += outnet->num_tcp_outgoing;
+	outnet->num_tcp_outgoing = 0;
+}
+
+/** the answer for a job arrived, or it failed, on the pool thread */
+static void
+job_answer(struct outnet_pool* pool, struct outnet_pool_job* job, int error,
+	struct sldns_buffer* buf)
+{
+	uint8_t* reply = NULL;
+	size_t len = 0;
+	uint8_t msg = 0;
+	if(error == NETEVENT_NOERROR) {
+		len = sldns_buffer_limit(buf);
+		reply = memdup(sldns_buffer_begin(buf), len);
+		if(!reply) {
+			log_err("outnet pool: malloc failure");
+			error = NETEVENT_CLOSED;
+			len = 0;
+		}
+	}
+	lock_basic_lock(&pool->lock);
+	list_remove(&pool->running, NULL, job);
+	pool->stats.inflight--;
+	pool_stats_streams(pool);
+	if(!job->conn) {
+		/* the query is gone */
+		lock_basic_unlock(&pool->lock);
+		free(reply);
+		job_free(job);
+		return;
+	}
+	job->error = error;
+	job->reply = reply;
+	job->reply_len = len;
+	job->state = outnet_pool_job_done;
+	/* the thread is woken up once for the list, it takes all jobs */
+	if(job->conn->done_first == NULL &&
+		!tube_write_msg(job->conn->tube, &msg, sizeof(msg), 0))
+		log_err("outnet pool: could not wake up query thread");
+	list_append(&job->conn->done_first, &job->conn->done_last, job);
+	lock_basic_unlock(&pool->lock);
+}
+
+int
+outnet_pool_tcp_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* ATTR_UNUSED(reply_info))
+{
+	struct outnet_pool_job* job = (struct outnet_pool_job*)arg;
+	job_answer(job->pool, job, error, c?c->buffer:NULL);
+	return 0;
+}
+
+void
+outnet_pool_handle(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct outnet_pool* pool = (struct outnet_pool*)arg;
+	struct outnet_pool_job* job;
+	free(msg);
+	if(error != 0)
+		return;
+	for(;;) {
+		lock_basic_lock(&pool->lock);
+		if(pool->quit) {
+			lock_basic_unlock(&pool->lock);
+			comm_base_exit(pool->base);
+			return;
+		}
+		job = pool->queue_first;
+		if(job) {
+			list_remove(&pool->queue_first, &pool->queue_last,
+				job);
+			job->state = outnet_pool_job_running;
+			job->next = pool->running;
+			if(pool->running)
+				pool->running->prev = job;
+			pool->running = job;
+			pool->stats.inflight++;
+			pool->stats.queries++;
+		}
+		lock_basic_unlock(&pool->lock);
+		if(!job)
+			break;
+		/* the job is not changed by the query thread while it runs,
+		 * only its conn is cleared when the query is gone */
+		sldns_buffer_clear(pool->buf);
+		sldns_buffer_write(pool->buf, job->pkt, job->pkt_len);
+		sldns_buffer_flip(pool->buf);
+		if(!pending_tcp_query(job->psq, pool->buf, job->timeout,
+			&outnet_pool_tcp_cb, job)) {
+			verbose(VERB_ALGO, "outnet pool: failed to send "
+				"tcp query");
+			job_answer(pool, job, NETEVENT_CLOSED, NULL);
+		}
+	}
+	lock_basic_lock(&pool->lock);
+	pool_stats_streams(pool);
+	lock_basic_unlock(&pool->lock);
+}
+
+/** the pool thread function */
+static void*
+outnet_pool_thread(void* arg)
+{
+	struct outnet_pool* pool = (struct outnet_pool*)arg;
+	log_thread_set(&pool->thread_num);
+	ub_thread_blocksigs();
+	verbose(VERB_ALGO, "start upstream stream pool thread");
+	comm_base_dispatch(pool->base);
+	verbose(VERB_ALGO, "stop upstream stream pool thread");
+	return NULL;
+}
+
+struct outnet_pool*
+outnet_pool_create(struct config_file* cfg, int thread_num,
+	struct ub_randstate* rnd, struct infra_cache* infra, void* sslctx,
+	int* ports, int num_ports)
+{
+	struct outnet_pool* pool = (struct outnet_pool*)calloc(1,
+		sizeof(*pool));
+	if(!pool)
+		return NULL;
+	lock_basic_init(&pool->lock);
+	lock_protect(&pool->lock, &pool->queue_first, sizeof(pool->queue_first)
+		+ sizeof(pool->queue_last) + sizeof(pool->running)
+		+ sizeof(pool->stats) + sizeof(pool->quit));
+	pool->thread_num = thread_num;
+	pool->tube = tube_create();
+	pool->base = comm_base_create(0);
+	pool->rnd = ub_initstate(rnd);
+	pool->buf = sldns_buffer_new(cfg->msg_buffer_size);
+	if(!pool->tube || !pool->base || !pool->rnd || !pool->buf) {
+		log_err("outnet pool: malloc failure");
+		outnet_pool_delete(pool);
+		return NULL;
+	}
+	/* the outside network only makes TCP and TLS streams, the
+	 * ports are for the choice of the outgoing interface */
+	pool->outnet = outside_network_create(pool->base,
+		cfg->msg_buffer_size, 1, cfg->out_ifs, cfg->num_out_ifs,
+		cfg->do_ip4, cfg->do_ip6, (size_t)cfg->outgoing_num_tcp,
+		cfg->ip_dscp, infra, pool->rnd, 0, ports, num_ports, 0,
+		cfg->outgoing_tcp_mss, NULL, NULL, 0, sslctx, 0,
+		cfg->tls_use_sni, NULL, 0, cfg->max_reuse_tcp_queries,
+		cfg->tcp_reuse_timeout, cfg->tcp_auth_query_timeout,
+		cfg->tls_upstream_resume, cfg->tls_upstream_early_data, 0, 0,
+		0, 0, 0);
+	if(!pool->outnet) {
+		log_err("outnet pool: could not create outside network");
+		outnet_pool_delete(pool);
+		return NULL;
+	}
+	if(!tube_setup_bg_listen(pool->tube, pool->base, &outnet_pool_handle,
+		pool)) {
+		log_err("outnet pool: could not listen on tube");
+		outnet_pool_delete(pool);
+		return NULL;
+	}
+	ub_thread_create(&pool->tid, outnet_pool_thread, pool);
+	pool->started = 1;
+	verbose(VERB_ALGO, "started upstream stream pool thread");
+	return pool;
+}
+
+void
+outnet_pool_delete(struct outnet_pool* pool)
+{
+	struct outnet_pool_job* job;
+	if(!pool)
+		return;
+	if(pool->started) {
+		uint8_t msg = 0;
+		lock_basic_lock(&pool->lock);
+		pool->quit = 1;
+		if(!tube_write_msg(pool->tube, &msg, sizeof(msg), 0))
+			log_err("outnet pool: could not stop thread");
+		lock_basic_unlock(&pool->lock);
+		ub_thread_join(pool->tid);
+	}
+	/* the pending queries are deleted without callbacks */
+	outside_network_delete(pool->outnet);
+	/* the queries of the jobs are gone, with their connections */
+	lock_basic_lock(&pool->lock);
+	while((job = pool->queue_first) != NULL) {
+		list_remove(&pool->queue_first, &pool->queue_last, job);
+		job_free(job);
+	}
+	while((job = pool->running) != NULL) {
+		list_remove(&pool->running, NULL, job);
+		job_free(job);
+	}
+	lock_basic_unlock(&pool->lock);
+	tube_delete(pool->tube);
+	comm_base_delete(pool->base);
+	ub_randfree(pool->rnd);
+	sldns_buffer_free(pool->buf);
+	lock_basic_destroy(&pool->lock);
+	free(pool);
+}
+
+struct outnet_pool_conn*
+outnet_pool_conn_create(struct outnet_pool* pool, struct comm_base* base,
+	size_t bufsize)
+{
+	struct outnet_pool_conn* conn = (struct outnet_pool_conn*)calloc(1,
+		sizeof(*conn));
+	if(!conn)
+		return NULL;
+	conn->pool = pool;
+	conn->tube = tube_create();
+	conn->c = (struct comm_point*)calloc(1, sizeof(*conn->c));
+	if(!conn->tube || !conn->c) {
+		outnet_pool_conn_delete(conn);
+		return NULL;
+	}
+	conn->c->fd = -1;
+	conn->c->type = comm_tcp;
+	conn->c->buffer = sldns_buffer_new(bufsize);
+	if(!conn->c->buffer) {
+		outnet_pool_conn_delete(conn);
+		return NULL;
+	}
+	if(!tube_setup_bg_listen(conn->tube, base, &outnet_pool_conn_handle,
+		conn)) {
+		outnet_pool_conn_delete(conn);
+		return NULL;
+	}
+	return conn;
+}
+
+void
+outnet_pool_conn_delete(struct outnet_pool_conn* conn)
+{
+	struct outnet_pool_job* job, *del = NULL;
+	if(!conn)
+		return;
+	if(conn->pool) {
+		lock_basic_lock(&conn->pool->lock);
+		while((job = conn->jobs) != NULL) {
+			conn_list_remove(conn, job);
+			if(job->state == outnet_pool_job_running) {
+				/* the pool thread deletes it */
+				job->conn = NULL;
+				continue;
+			}
+			if(job->state == outnet_pool_job_queued)
+				list_remove(&conn->pool->queue_first,
+					&conn->pool->queue_last, job);
+			else	list_remove(&conn->done_first,
+					&conn->done_last, job);
+			job->next = del;
+			del = job;
+		}
+		lock_basic_unlock(&conn->pool->lock);
+	}
+	while((job = del) != NULL) {
+		del = job->next;
+		job_free(job);
+	}
+	tube_delete(conn->tube);
+	if(conn->c) {
+		sldns_buffer_free(conn->c->buffer);
+		free(conn->c);
+	}
+	free(conn);
+}
+
+struct outnet_pool_job*
+outnet_pool_query(struct outnet_pool_conn* conn, struct serviced_query* sq,
+	struct sldns_buffer* packet, int timeout)
+{
+	struct outnet_pool* pool = conn->pool;
+	struct outnet_pool_job* job = (struct outnet_pool_job*)calloc(1,
+		sizeof(*job));
+	uint8_t msg = 0;
+	if(!job)
+		return NULL;
+	job->pool = pool;
+	job->conn = conn;
+	job->sq = sq;
+	job->timeout = timeout;
+	job->pkt_len = sldns_buffer_limit(packet);
+	job->pkt = memdup(sldns_buffer_begin(packet), job->pkt_len);
+	job->psq = (struct serviced_query*)calloc(1, sizeof(*job->psq));
+	if(!job->pkt || !job->psq) {
+		job_free(job);
+		return NULL;
+	}
+	memcpy(&job->psq->addr, &sq->addr, sq->addrlen);
+	job->psq->addrlen = sq->addrlen;
+	job->psq->tcp_upstream = sq->tcp_upstream;
+	job->psq->ssl_upstream = sq->ssl_upstream;
+	job->psq->outnet = pool->outnet;
+	if(sq->tls_auth_name) {
+		job->psq->tls_auth_name = strdup(sq->tls_auth_name);
+		if(!job->psq->tls_auth_name) {
+			job_free(job);
+			return NULL;
+		}
+	}
+	lock_basic_lock(&pool->lock);
+	job->state = outnet_pool_job_queued;
+	/* the pool thread is woken up once for the queue */
+	if(pool->queue_first == NULL &&
+		!tube_write_msg(pool->tube, &msg, sizeof(msg), 0))
+		log_err("outnet pool: could not wake up pool thread");
+	list_append(&pool->queue_first, &pool->queue_last, job);
+	job->conn_next = conn->jobs;
+	if(conn->jobs)
+		conn->jobs->conn_prev = job;
+	conn->jobs = job;
+	lock_basic_unlock(&pool->lock);
+	return job;
+}
+
+void
+outnet_pool_job_cancel(struct outnet_pool_job* job)
+{
+	struct outnet_pool_conn* conn = job->conn;
+	struct outnet_pool* pool = conn->pool;
+	lock_basic_lock(&pool->lock);
+	conn_list_remove(conn, job);
+	switch(job->state) {
+	case outnet_pool_job_queued:
+		list_remove(&pool->queue_first, &pool->queue_last, job);
+		break;
+	case outnet_pool_job_running:
+		/* the pool thread deletes it when the answer arrives */
+		job->conn = NULL;
+		lock_basic_unlock(&pool->lock);
+		return;
+	case outnet_pool_job_done:
+	default:
+		list_remove(&conn->done_first, &conn->done_last, job);
+		break;
+	}
+	lock_basic_unlock(&pool->lock);
+	job_free(job);
+}
+
+void
+outnet_pool_get_stats(struct outnet_pool* pool,
+	struct outnet_pool_stats* stats, int reset)
+{
+	lock_basic_lock(&pool->lock);
+	*stats = pool->stats;
+	if(reset) {
+		pool->stats.queries = 0;
+		pool->stats.opened = 0;
+	}
+	lock_basic_unlock(&pool->lock);
+}
+
+void
+outnet_pool_conn_handle(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct outnet_pool_conn* conn = (struct outnet_pool_conn*)arg;
+	struct outnet_pool_job* job;
+	free(msg);
+	if(error != 0)
+		return;
+	/* answer the queries one by one, a callback can delete the jobs
+	 * of other queries */
+	for(;;) {
+		struct serviced_query* sq;
+		int err;
+		lock_basic_lock(&conn->pool->lock);
+		job = conn->done_first;
+		if(job) {
+			list_remove(&conn->done_first, &conn->done_last, job);
+			conn_list_remove(conn, job);
+		}
+		lock_basic_unlock(&conn->pool->lock);
+		if(!job)
+			break;
+		sq = job->sq;
+		err = job->error;
+		sq->pool_job = NULL;
+		sldns_buffer_clear(conn->c->buffer);
+		if(err == NETEVENT_NOERROR) {
+			if(job->reply_len > sldns_buffer_capacity(
+				conn->c->buffer))
+				err = NETEVENT_CLOSED;
+			else	sldns_buffer_write(conn->c->buffer,
+					job->reply, job->reply_len);
+		}
+		sldns_buffer_flip(conn->c->buffer);
+		job_free(job);
+		(void)serviced_tcp_callback(conn->c, sq, err, NULL);
+	}
+}
@@ -0,0 +1,261 @@
+/*
+ * services/outnet_pool.h - shared upstream TCP and TLS streams.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the pool of upstream TCP and TLS streams that is
+ * shared by the threads.  One extra thread owns an outside network with
+ * the streams.  The threads that handle queries give it their TCP queries
+ * for upstreams that use tcp-upstream or tls-upstream, and it sends them
+ * over the streams, that are reused for the queries of all threads.
+ * Answers go back to the thread of the query over a tube, and are handled
+ * there by serviced_tcp_callback, like answers on its own streams.
+ */
+
+#ifndef SERVICES_OUTNET_POOL_H
+#define SERVICES_OUTNET_POOL_H
+#include "util/locks.h"
+struct config_file;
+struct comm_base;
+struct comm_point;
+struct comm_reply;
+struct outside_network;
+struct infra_cache;
+struct serviced_query;
+struct ub_randstate;
+struct tube;
+struct sldns_buffer;
+struct outnet_pool;
+struct outnet_pool_conn;
+
+/** state of a pool query */
+enum outnet_pool_job_state {
+	/** in the queue of the pool */
+	outnet_pool_job_queued = 0,
+	/** sent by the pool thread, waiting for the answer */
+	outnet_pool_job_running,
+	/** answered, in the done list of the connection */
+	outnet_pool_job_done
+};
+
+/**
+ * A query that is sent over the shared streams.
+ */
+struct outnet_pool_job {
+	/** next in the queue, the running list or the done list */
+	struct outnet_pool_job* next;
+	/** previous in the queue, the running list or the done list */
+	struct outnet_pool_job* prev;
+	/** next in the list of jobs of the connection */
+	struct outnet_pool_job* conn_next;
+	/** previous in the list of jobs of the connection */
+	struct outnet_pool_job* conn_prev;
+	/** state, protected by the pool lock */
+	enum outnet_pool_job_state state;
+	/** the pool */
+	struct outnet_pool* pool;
+	/** the connection of the thread of the query, NULL if the query
+	 * is gone, then the pool thread deletes the job */
+	struct outnet_pool_conn* conn;
+	/** the serviced query, only used on the thread of the query */
+	struct serviced_query* sq;
+	/** serviced query for pending_tcp_query on the pool thread, with
+	 * the outside network of the pool and copies of the address and
+	 * tls auth name */
+	struct serviced_query* psq;
+	/** the query packet */
+	uint8_t* pkt;
+	/** length of the query packet */
+	size_t pkt_len;
+	/** timeout in msec */
+	int timeout;
+	/** the netevent error code of the answer */
+	int error;
+	/** the answer packet, or NULL */
+	uint8_t* reply;
+	/** length of the answer packet */
+	size_t reply_len;
+};
+
+/**
+ * The connection of a query thread to the pool.  Answered jobs are put
+ * in its done list, and the thread is woken up.
+ */
+struct outnet_pool_conn {
+	/** the pool */
+	struct outnet_pool* pool;
+	/** tube that wakes up the query thread */
+	struct tube* tube;
+	/** comm point with the buffer that answers are given in to
+	 * serviced_tcp_callback, it has no file descriptor */
+	struct comm_point* c;
+	/** list of answered jobs, protected by the pool lock */
+	struct outnet_pool_job* done_first;
+	/** last of the list of answered jobs */
+	struct outnet_pool_job* done_last;
+	/** list of all jobs of the connection, protected by the pool lock */
+	struct outnet_pool_job* jobs;
+};
+
+/**
+ * Statistics of the pool.
+ */
+struct outnet_pool_stats {
+	/** number of streams that are open */
+	size_t streams;
+	/** number of queries that wait for an answer */
+	size_t inflight;
+	/** number of queries sent */
+	size_t queries;
+	/** number of streams opened */
+	size_t opened;
+};
+
+/**
+ * The pool thread with the shared streams.
+ */
+struct outnet_pool {
+	/** lock on the queue, the lists, the job states and the stats */
+	lock_basic_type lock;
+	/** tube that wakes up the pool thread */
+	struct tube* tube;
+	/** queue of jobs */
+	struct outnet_pool_job* queue_first;
+	/** last in the queue */
+	struct outnet_pool_job* queue_last;
+	/** list of jobs that wait for an answer */
+	struct outnet_pool_job* running;
+	/** the statistics */
+	struct outnet_pool_stats stats;
+	/** the thread must stop */
+	int quit;
+	/** thread number for the log */
+	int thread_num;
+	/** if the thread has been started */
+	int started;
+	/** the thread */
+	ub_thread_type tid;
+	/** event base of the pool thread */
+	struct comm_base* base;
+	/** random state of the pool thread */
+	struct ub_randstate* rnd;
+	/** the outside network with the streams, used by the pool thread */
+	struct outside_network* outnet;
+	/** buffer for the query that is sent */
+	struct sldns_buffer* buf;
+};
+
+/**
+ * Create the pool and start its thread.
+ * @param cfg: config file, for the number of streams and the timeouts.
+ * @param thread_num: the number of the thread, for the log.
+ * @param rnd: random state, the pool thread gets its own from it.
+ * @param infra: infra cache of the daemon.
+ * @param sslctx: context for the TLS streams, or NULL.
+ * @param ports: ports that the outside network can use, it does not
+ *	send UDP queries.
+ * @param num_ports: number of ports.
+ * @return new pool or NULL on failure.
+ */
+struct outnet_pool* outnet_pool_create(struct config_file* cfg,
+	int thread_num, struct ub_randstate* rnd, struct infra_cache* infra,
+	void* sslctx, int* ports, int num_ports);
+
+/**
+ * Stop the pool thread and delete the pool.  The connections must have
+ * been deleted.
+ * @param pool: the pool.
+ */
+void outnet_pool_delete(struct outnet_pool* pool);
+
+/**
+ * Create the connection of a query thread, on that thread.
+ * @param pool: the pool.
+ * @param base: the event base of the query thread.
+ * @param bufsize: size of the buffer for the answers.
+ * @return new connection or NULL on failure.
+ */
+struct outnet_pool_conn* outnet_pool_conn_create(struct outnet_pool* pool,
+	struct comm_base* base, size_t bufsize);
+
+/**
+ * Delete the connection of a query thread.  The jobs that are left are
+ * deleted, or deleted by the pool thread when their answer arrives.
+ * @param conn: the connection.
+ */
+void outnet_pool_conn_delete(struct outnet_pool_conn* conn);
+
+/**
+ * Send a TCP query of a serviced query over the shared streams.  The
+ * answer is given to serviced_tcp_callback on the thread of the query.
+ * @param conn: the connection of the query thread.
+ * @param sq: the serviced query, with the address and TLS settings.
+ * @param packet: the query packet, it is copied.
+ * @param timeout: timeout in msec.
+ * @return the job, or NULL on failure.
+ */
+struct outnet_pool_job* outnet_pool_query(struct outnet_pool_conn* conn,
+	struct serviced_query* sq, struct sldns_buffer* packet, int timeout);
+
+/**
+ * Cancel the job of a serviced query that is deleted.
+ * @param job: the job.
+ */
+void outnet_pool_job_cancel(struct outnet_pool_job* job);
+
+/**
+ * Get the statistics of the pool.
+ * @param pool: the pool.
+ * @param stats: the statistics are returned here.
+ * @param reset: if the counters are set to zero.
+ */
+void outnet_pool_get_stats(struct outnet_pool* pool,
+	struct outnet_pool_stats* stats, int reset);
+
+/** handle the wake up of the pool thread, it sends the queued queries */
+void outnet_pool_handle(struct tube* tube, uint8_t* msg, size_t len,
+	int error, void* arg);
+
+/** handle the wake up of a query thread, it passes the answers to the
+ * serviced queries */
+void outnet_pool_conn_handle(struct tube* tube, uint8_t* msg, size_t len,
+	int error, void* arg);
+
+/** callback for the answer of a query on the pool thread */
+int outnet_pool_tcp_cb(struct comm_point* c, void* arg, int error,
+	struct comm_reply* reply_info);
+
+#endif /* SERVICES_OUTNET_POOL_H */
@@ -46,6 +46,7 @@
 #endif
 #include <sys/time.h>
 #include "services/outside_network.h"
+#include "services/outnet_pool.h"
 #include "services/listen_dnsport.h"
 #include "services/cache/infra.h"
 #include "iterator/iterator.h"
@@ -79,6 +80,8 @@
 #define MAX_PORT_RETRY 10000
 /** number of retries on outgoing UDP queries */
 #define OUTBOUND_UDP_RETRY 1
+/** max number of UDP queries in the send queue */
+#define UDP_SEND_BATCH_MAX 64
 
 /** initiate TCP transaction for serviced query */
 static void serviced_tcp_initiate(struct serviced_query* sq, sldns_buffer* buff);
@@ -175,6 +178,24 @@ reuse_cmp(const void* key1, const void* key2)
 	return 0;
 }
 
+int
+tls_session_cmp(const void* key1, const void* key2)
+{
+	struct tls_session* s1 = (struct tls_session*)key1;
+	struct tls_session* s2 = (struct tls_session*)key2;
+	int r = sockaddr_cmp(&s1->addr, s1->addrlen, &s2->addr, s2->addrlen);
+	if(r != 0)
+		return r;
+	if(!s1->auth_name || !s2->auth_name) {
+		if(s1->auth_name)
+			return 1;
+		if(s2->auth_name)
+			return -1;
+		return 0;
+	}
+	return strcmp(s1->auth_name, s2->auth_name);
+}
+
 int reuse_id_cmp(const void* key1, const void* key2)
 {
 	struct waiting_tcp* w1 = (struct waiting_tcp*)key1;
@@ -572,6 +593,168 @@ outnet_tcp_take_query_setup(int s, struct pending_tcp* pend,
 	comm_timer_set(w->timer, &tv);
 }
 
+/** free a stored TLS session */
+static void
+tls_session_free(struct tls_session* s)
+{
+#ifdef HAVE_SSL
+	SSL_SESSION_free((SSL_SESSION*)s->session);
+#endif
+	free(s->auth_name);
+	free(s);
+}
+
+/** remove a stored TLS session from the tree and lru list, and free it */
+static void
+tls_session_delete(struct outside_network* outnet, struct tls_session* s)
+{
+	(void)rbtree_delete(&outnet->tls_sessions, s);
+	if(s->lru_prev)
+		s->lru_prev->lru_next = s->lru_next;
+	else	outnet->tls_session_first = s->lru_next;
+	if(s->lru_next)
+		s->lru_next->lru_prev = s->lru_prev;
+	else	outnet->tls_session_last = s->lru_prev;
+	tls_session_free(s);
+}
+
+/** store the TLS session of a stream when its first answer has been read,
+ * the session tickets have arrived then, so that the next stream to the
+ * same upstream and auth name can resume it */
+static void
+tls_session_store(struct outside_network* outnet, struct pending_tcp* pend,
+	struct waiting_tcp* w)
+{
+#ifdef HAVE_SSL
+	struct tls_session key, *s;
+	SSL_SESSION* sess;
+	if(!outnet->tls_resume || !SSL_is_init_finished(pend->c->ssl))
+		return;
+	sess = SSL_get1_session(pend->c->ssl);
+	if(!sess)
+		return;
+#ifdef HAVE_SSL_SESSION_IS_RESUMABLE
+	if(!SSL_SESSION_is_resumable(sess)) {
+		SSL_SESSION_free(sess);
+		return;
+	}
+#endif
+	memset(&key, 0, sizeof(key));
+	memmove(&key.addr, &w->addr, w->addrlen);
+	key.addrlen = w->addrlen;
+	key.auth_name = w->tls_auth_name;
+	key.node.key = &key;
+	s = (struct tls_session*)rbtree_search(&outnet->tls_sessions, &key);
+	if(s) {
+		/* replace the older session of the upstream */
+		tls_session_delete(outnet, s);
+	} else if(outnet->tls_sessions.count >= outnet->num_tcp &&
+		outnet->tls_session_last) {
+		tls_session_delete(outnet, outnet->tls_session_last);
+	}
+	s = (struct tls_session*)calloc(1, sizeof(*s));
+	if(!s) {
+		SSL_SESSION_free(sess);
+		return;
+	}
+	memmove(&s->addr, &w->addr, w->addrlen);
+	s->addrlen = w->addrlen;
+	if(w->tls_auth_name) {
+		s->auth_name = strdup(w->tls_auth_name);
+		if(!s->auth_name) {
+			free(s);
+			SSL_SESSION_free(sess);
+			return;
+		}
+	}
+	s->session = sess;
+	s->node.key = s;
+	if(verbosity >= VERB_ALGO)
+		log_addr(VERB_ALGO, "store TLS session for", &s->addr,
+			s->addrlen);
+	(void)rbtree_insert(&outnet->tls_sessions, &s->node);
+	s->lru_prev = NULL;
+	s->lru_next = outnet->tls_session_first;
+	if(outnet->tls_session_first)
+		outnet->tls_session_first->lru_prev = s;
+	else	outnet->tls_session_last = s;
+	outnet->tls_session_first = s;
+#else
+	(void)outnet;
+	(void)pend;
+	(void)w;
+#endif /* HAVE_SSL */
+}
+
+/** setup the TLS session of a new stream, with a stored session to
+ * resume for the upstream */
+static void
+tls_session_resume(struct pending_tcp* pend, struct waiting_tcp* w)
+{
+	struct outside_network* outnet = w->outnet;
+#ifdef HAVE_SSL
+	struct tls_session key, *s;
+#endif
+	pend->c->ssl_early_data = 0;
+	pend->c->ssl_ktls = 0;
+	pend->tls_counted = 0;
+	pend->tls_stored = 0;
+	pend->tls_start = *outnet->now_tv;
+#ifdef HAVE_SSL
+	if(!outnet->tls_resume)
+		return;
+	memset(&key, 0, sizeof(key));
+	memmove(&key.addr, &w->addr, w->addrlen);
+	key.addrlen = w->addrlen;
+	key.auth_name = w->tls_auth_name;
+	key.node.key = &key;
+	s = (struct tls_session*)rbtree_search(&outnet->tls_sessions, &key);
+	if(!s)
+		return;
+	if(verbosity >= VERB_ALGO)
+		log_addr(VERB_ALGO, "resume TLS session for", &w->addr,
+			w->addrlen);
+	if(!SSL_set_session(pend->c->ssl, (SSL_SESSION*)s->session)) {
+		log_crypto_err("could not SSL_set_session");
+	}
+#ifdef HAVE_SSL_WRITE_EARLY_DATA
+	else if(outnet->tls_early_data &&
+		SSL_SESSION_get_max_early_data((SSL_SESSION*)s->session) >=
+		(uint32_t)w->pkt_len + 2) {
+		pend->c->ssl_early_data = 1;
+	}
+#endif
+	/* a session ticket is used once, the stream stores a new one */
+	tls_session_delete(outnet, s);
+#endif /* HAVE_SSL */
+}
+
+/** count the TLS handshake of a stream, it is done when the first query
+ * on the stream has been written */
+static void
+tls_handshake_count(struct outside_network* outnet, struct pending_tcp* pend)
+{
+	struct timeval* now = outnet->now_tv;
+	pend->tls_counted = 1;
+	outnet->num_tls_handshake++;
+#ifdef HAVE_SSL
+	if(SSL_session_reused(pend->c->ssl))
+		outnet->num_tls_resumed++;
+#ifdef HAVE_SSL_WRITE_EARLY_DATA
+	if(SSL_get_early_data_status(pend->c->ssl) == SSL_EARLY_DATA_ACCEPTED)
+		outnet->num_tls_early_data++;
+#endif
+	if(pend->c->ssl_ktls)
+		outnet->num_tls_ktls++;
+#endif /* HAVE_SSL */
+	if(now->tv_sec > pend->tls_start.tv_sec ||
+		(now->tv_sec == pend->tls_start.tv_sec &&
+		now->tv_usec > pend->tls_start.tv_usec))
+		outnet->tls_handshake_usec +=
+			((long long)(now->tv_sec - pend->tls_start.tv_sec))
+			*1000000 + (now->tv_usec - pend->tls_start.tv_usec);
+}
+
 /** use next free buffer to service a tcp query */
 static int
 outnet_tcp_take_into_use(struct waiting_tcp* w)
@@ -677,6 +860,7 @@ outnet_tcp_take_into_use(struct waiting_tcp* w)
 			comm_point_close(pend->c);
 			return 0;
 		}
+		tls_session_resume(pend, w);
 	}
 	w->next_waiting = (void*)pend;
 	w->outnet->num_tcp_outgoing++;
@@ -1091,6 +1275,8 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 		log_assert(c == pend->c);
 		log_assert(pend->query->pkt == pend->c->tcp_write_pkt);
 		log_assert(pend->query->pkt_len == pend->c->tcp_write_pkt_len);
+		if(pend->c->ssl && !pend->tls_counted)
+			tls_handshake_count(outnet, pend);
 		pend->c->tcp_write_pkt = NULL;
 		pend->c->tcp_write_pkt_len = 0;
 		/* the pend.query is already in tree_by_id */
@@ -1143,6 +1329,10 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 		error = NETEVENT_CLOSED;
 	}
 	if(error == NETEVENT_NOERROR) {
+		if(pend->c->ssl && !pend->tls_stored) {
+			pend->tls_stored = 1;
+			tls_session_store(outnet, pend, w);
+		}
 		/* add to reuse tree so it can be reused, if not a failure.
 		 * This is possible if the state machine wants to make a tcp
 		 * query again to the same destination. */
@@ -1180,16 +1370,25 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 	return 0;
 }
 
-/** lower use count on pc, see if it can be closed */
+/** remove the connected socket from the idle array */
 static void
-portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
+udp_conn_idle_remove(struct outside_network* outnet, struct port_comm* pc)
 {
-	struct port_if* pif;
-	pc->num_outstanding--;
-	if(pc->num_outstanding > 0) {
+	struct port_comm* last;
+	if(!pc->idle)
 		return;
-	}
-	/* close it and replace in unused list */
+	last = outnet->udp_idle[--outnet->udp_idle_num];
+	outnet->udp_idle[pc->idle_index] = last;
+	last->idle_index = pc->idle_index;
+	pc->idle = 0;
+}
+
+/** close the port and put it in the unused list */
+static void
+portcomm_close(struct outside_network* outnet, struct port_comm* pc)
+{
+	struct port_if* pif;
+	udp_conn_idle_remove(outnet, pc);
 	verbose(VERB_ALGO, "close of port %d", pc->number);
 	comm_point_close(pc->cp);
 	pif = pc->pif;
@@ -1204,6 +1403,40 @@ portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
 	outnet->unused_fds = pc;
 }
 
+/** lower use count on pc, see if it can be closed */
+static void
+portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
+{
+	pc->num_outstanding--;
+	if(pc->num_outstanding > 0) {
+		return;
+	}
+	/* keep a connected socket for a next query, unless it has been
+	 * used enough, the pool is full, or queries wait for a port */
+	if(outnet->udp_conn_pool && pc->num_queries < outnet->udp_conn_reuse
+		&& outnet->udp_idle_num < outnet->udp_conn_pool &&
+		!outnet->udp_wait_first && !outnet->want_to_quit) {
+		log_assert(!pc->idle);
+		pc->idle = 1;
+		pc->idle_index = outnet->udp_idle_num;
+		outnet->udp_idle[outnet->udp_idle_num++] = pc;
+		return;
+	}
+	portcomm_close(outnet, pc);
+}
+
+/** note the destination of a newly connected socket, it can be kept
+ * for the next queries when it is idle */
+static void
+udp_conn_insert(struct port_comm* pc, struct sockaddr_storage* addr,
+	socklen_t addrlen)
+{
+	pc->num_queries = 1;
+	pc->idle = 0;
+	memmove(&pc->addr, addr, addrlen);
+	pc->addrlen = addrlen;
+}
+
 /** try to send waiting UDP queries */
 static void
 outnet_send_wait_udp(struct outside_network* outnet)
@@ -1437,7 +1670,9 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
 	void* sslctx, int delayclose, int tls_use_sni, struct dt_env* dtenv,
 	int udp_connect, int max_reuse_tcp_queries, int tcp_reuse_timeout,
-	int tcp_auth_query_timeout)
+	int tcp_auth_query_timeout, int tls_resume, int tls_early_data,
+	int udp_hedge_percentile, int udp_hedge_max_rate, int udp_send_batch,
+	int udp_conn_pool, int udp_conn_reuse)
 {
 	struct outside_network* outnet = (struct outside_network*)
 		calloc(1, sizeof(struct outside_network));
@@ -1457,6 +1692,11 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->rnd = rnd;
 	outnet->sslctx = sslctx;
 	outnet->tls_use_sni = tls_use_sni;
+	outnet->tls_resume = tls_resume;
+	outnet->tls_early_data = tls_early_data;
+	rbtree_init(&outnet->tls_sessions, tls_session_cmp);
+	outnet->udp_hedge_percentile = udp_hedge_percentile;
+	outnet->udp_hedge_max_rate = udp_hedge_max_rate;
 #ifdef USE_DNSTAP
 	outnet->dtenv = dtenv;
 #else
@@ -1480,6 +1720,28 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 #endif
 	if(udp_connect) {
 		outnet->udp_connect = 1;
+		if(udp_conn_pool > 0 && udp_conn_reuse > 1) {
+			outnet->udp_conn_pool = udp_conn_pool;
+			outnet->udp_conn_reuse = udp_conn_reuse;
+			outnet->udp_idle = (struct port_comm**)calloc(
+				(size_t)udp_conn_pool, sizeof(struct port_comm*));
+			if(!outnet->udp_idle) {
+				log_err("malloc failed");
+				outside_network_delete(outnet);
+				return NULL;
+			}
+		}
+	}
+	if(udp_send_batch > UDP_SEND_BATCH_MAX)
+		udp_send_batch = UDP_SEND_BATCH_MAX;
+	if(udp_send_batch > 1) {
+		outnet->udp_send_batch = udp_send_batch;
+		if(!(outnet->udp_send_timer = comm_timer_create(base,
+			outnet_udp_send_timer_cb, outnet))) {
+			log_err("malloc failed");
+			outside_network_delete(outnet);
+			return NULL;
+		}
 	}
 	if(numavailports == 0 || num_ports == 0) {
 		log_err("no outgoing ports available");
@@ -1595,6 +1857,7 @@ serviced_node_del(rbnode_type* node, void* ATTR_UNUSED(arg))
 {
 	struct serviced_query* sq = (struct serviced_query*)node;
 	struct service_callback* p = sq->cblist, *np;
+	comm_timer_delete(sq->hedge_timer);
 	free(sq->qbuf);
 	free(sq->zone);
 	free(sq->tls_auth_name);
@@ -1622,6 +1885,17 @@ outside_network_delete(struct outside_network* outnet)
 	if(!outnet)
 		return;
 	outnet->want_to_quit = 1;
+	/* the queued queries are not sent, empty the queue so that the
+	 * pendings can be deleted in any order */
+	while(outnet->udp_send_first) {
+		struct pending* p = outnet->udp_send_first;
+		outnet->udp_send_first = p->next_send;
+		p->next_send = NULL;
+		p->on_send_queue = 0;
+	}
+	outnet->udp_send_last = NULL;
+	outnet->udp_send_num = 0;
+	comm_timer_delete(outnet->udp_send_timer);
 	/* check every element, since we can be called on malloc error */
 	if(outnet->pending) {
 		/* free pending elements, but do no unlink from tree. */
@@ -1676,6 +1950,7 @@ outside_network_delete(struct outside_network* outnet)
 		}
 		free(outnet->ip6_ifs);
 	}
+	free(outnet->udp_idle);
 	if(outnet->tcp_conns) {
 		size_t i;
 		for(i=0; i<outnet->num_tcp; i++)
@@ -1705,6 +1980,16 @@ outside_network_delete(struct outside_network* outnet)
 			p = np;
 		}
 	}
+	if(outnet->tls_session_first) {
+		struct tls_session* s = outnet->tls_session_first, *ns;
+		while(s) {
+			ns = s->lru_next;
+			tls_session_free(s);
+			s = ns;
+		}
+		outnet->tls_session_first = NULL;
+		outnet->tls_session_last = NULL;
+	}
 	/* was allocated in struct pending that was deleted above */
 	rbtree_init(&outnet->tcp_reuse, reuse_cmp);
 	outnet->tcp_reuse_first = NULL;
@@ -1720,6 +2005,27 @@ outside_network_delete(struct outside_network* outnet)
 	free(outnet);
 }
 
+/** remove the pending from the send queue */
+static void
+udp_send_queue_remove(struct outside_network* outnet, struct pending* pend)
+{
+	struct pending* prev = NULL, *p = outnet->udp_send_first;
+	while(p && p != pend) {
+		prev = p;
+		p = p->next_send;
+	}
+	if(!p)
+		return;
+	if(prev)
+		prev->next_send = p->next_send;
+	else	outnet->udp_send_first = p->next_send;
+	if(outnet->udp_send_last == p)
+		outnet->udp_send_last = prev;
+	p->next_send = NULL;
+	p->on_send_queue = 0;
+	outnet->udp_send_num--;
+}
+
 void 
 pending_delete(struct outside_network* outnet, struct pending* p)
 {
@@ -1742,6 +2048,8 @@ pending_delete(struct outside_network* outnet, struct pending* p)
 				outnet->udp_wait_last = prev;
 		}
 	}
+	if(p->on_send_queue)
+		udp_send_queue_remove(p->outnet, p);
 	if(outnet) {
 		(void)rbtree_delete(outnet->pending, p->node.key);
 	}
@@ -1861,6 +2169,52 @@ static int udp_connect_needs_log(int err)
 }
 
 
+/** take a random idle connected socket on one of the interfaces, and
+ * connect it to the destination.  NULL if there is none */
+static struct port_comm*
+udp_conn_take(struct outside_network* outnet, struct sockaddr_storage* addr,
+	socklen_t addrlen, int num_if, struct port_if* ifs)
+{
+	struct port_comm* pc;
+	int i, start;
+	while(outnet->udp_idle_num > 0) {
+		/* the sockets are on random ports, start at a random one,
+		 * and look for the address family of the destination */
+		pc = NULL;
+		start = ub_random_max(outnet->rnd, outnet->udp_idle_num);
+		for(i=0; i<outnet->udp_idle_num; i++) {
+			struct port_comm* p = outnet->udp_idle[
+				(start+i)%outnet->udp_idle_num];
+			if(p->pif >= ifs && p->pif < ifs+num_if) {
+				pc = p;
+				break;
+			}
+		}
+		if(!pc)
+			return NULL;
+		udp_conn_idle_remove(outnet, pc);
+		if(sockaddr_cmp(&pc->addr, pc->addrlen, addr, addrlen) != 0) {
+			/* connect it to the new destination, answers from
+			 * the old one are not received on it any more */
+			if(connect(pc->cp->fd,
+				(struct sockaddr*)addr, addrlen) < 0) {
+				if(udp_connect_needs_log(errno)) {
+					log_err_addr("udp connect failed",
+						strerror(errno), addr, addrlen);
+				}
+				portcomm_close(outnet, pc);
+				continue;
+			}
+			memmove(&pc->addr, addr, addrlen);
+			pc->addrlen = addrlen;
+		}
+		pc->num_queries++;
+		outnet->num_udp_sock_reuse++;
+		return pc;
+	}
+	return NULL;
+}
+
 /** Select random interface and port */
 static int
 select_ifport(struct outside_network* outnet, struct pending* pend,
@@ -1874,6 +2228,22 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 			"outgoing interfaces of that family");
 		return 0;
 	}
+	if(outnet->udp_connect && outnet->udp_conn_pool) {
+		/* an idle connected socket, on a random port */
+		struct port_comm* pc = udp_conn_take(outnet, &pend->addr,
+			pend->addrlen, num_if, ifs);
+		if(pc) {
+			pend->pc = pc;
+			pend->pc->num_outstanding++;
+			verbose(VERB_ALGO, "using connected UDP port=%d",
+				pc->number);
+			return 1;
+		}
+		/* the idle sockets are of the other address family,
+		 * close one to free a port */
+		if(!outnet->unused_fds && outnet->udp_idle_num > 0)
+			portcomm_close(outnet, outnet->udp_idle[0]);
+	}
 	log_assert(outnet->unused_fds);
 	tries = 0;
 	while(1) {
@@ -1941,6 +2311,10 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 			pend->pc->num_outstanding = 0;
 			comm_point_start_listening(pend->pc->cp, fd, -1);
 
+			if(outnet->udp_connect)
+				udp_conn_insert(pend->pc, &pend->addr,
+					pend->addrlen);
+
 			/* grab port in interface */
 			pif->out[pif->inuse] = pend->pc;
 #ifndef DISABLE_EXPLICIT_PORT_RANDOMISATION
@@ -1964,6 +2338,124 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 	return 1;
 }
 
+/** the pending could not be sent, report the error from a timer, so that
+ * the callbacks run outside of the send queue processing */
+static void
+udp_send_failed(struct pending* pend)
+{
+	struct timeval tv;
+	tv.tv_sec = 0;
+	tv.tv_usec = 0;
+	pend->timer->callback = &pending_udp_send_error_cb;
+	comm_timer_set(pend->timer, &tv);
+}
+
+/** send the queued UDP queries, with one sendmmsg per port */
+static void
+udp_send_flush(struct outside_network* outnet)
+{
+	struct comm_udp_msg msgs[UDP_SEND_BATCH_MAX];
+	struct pending* group[UDP_SEND_BATCH_MAX];
+	struct pending* p, *prev, *next;
+	struct port_comm* pc;
+	int n, i;
+	comm_timer_disable(outnet->udp_send_timer);
+	while(outnet->udp_send_first) {
+		/* take the queries for the port of the first one */
+		pc = outnet->udp_send_first->pc;
+		prev = NULL;
+		n = 0;
+		for(p = outnet->udp_send_first; p && n < UDP_SEND_BATCH_MAX;
+			p = next) {
+			next = p->next_send;
+			if(p->pc != pc) {
+				prev = p;
+				continue;
+			}
+			if(prev)
+				prev->next_send = next;
+			else	outnet->udp_send_first = next;
+			if(outnet->udp_send_last == p)
+				outnet->udp_send_last = prev;
+			p->next_send = NULL;
+			p->on_send_queue = 0;
+			outnet->udp_send_num--;
+			group[n] = p;
+			msgs[n].data = p->pkt;
+			msgs[n].len = p->pkt_len;
+			msgs[n].addr = &p->addr;
+			msgs[n].addrlen = p->addrlen;
+			n++;
+		}
+		(void)comm_point_send_udp_msgs(pc->cp, msgs, n,
+			outnet->udp_connect);
+		for(i=0; i<n; i++) {
+			free(group[i]->pkt);
+			group[i]->pkt = NULL;
+			group[i]->pkt_len = 0;
+			if(!msgs[i].sent)
+				udp_send_failed(group[i]);
+		}
+	}
+}
+
+/** add the query to the send queue, false on malloc failure */
+static int
+udp_send_queue_add(struct outside_network* outnet, struct pending* pend,
+	sldns_buffer* packet)
+{
+	log_assert(!pend->pkt && !pend->on_send_queue);
+	pend->pkt_len = sldns_buffer_limit(packet);
+	pend->pkt = (uint8_t*)memdup(sldns_buffer_begin(packet),
+		pend->pkt_len);
+	if(!pend->pkt) {
+		log_err("malloc failure for UDP send queue");
+		pend->pkt_len = 0;
+		return 0;
+	}
+	pend->next_send = NULL;
+	pend->on_send_queue = 1;
+	if(outnet->udp_send_last)
+		outnet->udp_send_last->next_send = pend;
+	else	outnet->udp_send_first = pend;
+	outnet->udp_send_last = pend;
+	outnet->udp_send_num++;
+	if(outnet->udp_send_num >= outnet->udp_send_batch) {
+		udp_send_flush(outnet);
+	} else if(outnet->udp_send_num == 1) {
+		/* send at the end of this event loop iteration */
+		struct timeval tv;
+		tv.tv_sec = 0;
+		tv.tv_usec = 0;
+		comm_timer_set(outnet->udp_send_timer, &tv);
+	}
+	return 1;
+}
+
+void
+outnet_udp_send_timer_cb(void* arg)
+{
+	struct outside_network* outnet = (struct outside_network*)arg;
+	if(outnet->want_to_quit)
+		return;
+	udp_send_flush(outnet);
+}
+
+void
+pending_udp_send_error_cb(void* arg)
+{
+	struct pending* p = (struct pending*)arg;
+	struct outside_network* outnet = p->outnet;
+	verbose(VERB_ALGO, "udp send failed");
+	if(p->cb) {
+		fptr_ok(fptr_whitelist_pending_udp(p->cb));
+		(void)(*p->cb)(p->pc->cp, p->cb_arg, NETEVENT_CLOSED, NULL);
+	}
+	portcomm_loweruse(outnet, p->pc);
+	pending_delete(outnet, p);
+	outnet_send_wait_udp(outnet);
+}
+
 static int
 randomize_and_send_udp(struct pending* pend, sldns_buffer* packet, int timeout)
 {
@@ -1986,21 +2478,33 @@ randomize_and_send_udp(struct pending* pend, sldns_buffer* packet, int timeout)
 			return 0;
 	}
 	log_assert(pend->pc && pend->pc->cp);
-
-	/* send it over the commlink */
-	if(!comm_point_send_udp_msg(pend->pc->cp, packet,
-		(struct sockaddr*)&pend->addr, pend->addrlen, outnet->udp_connect)) {
-		portcomm_loweruse(outnet, pend->pc);
-		return 0;
-	}
-
-	/* system calls to set timeout after sending UDP to make roundtrip
-	   smaller. */
 #ifndef S_SPLINT_S
 	tv.tv_sec = timeout/1000;
 	tv.tv_usec = (timeout%1000)*1000;
 #endif
-	comm_timer_set(pend->timer, &tv);
+
+	if(outnet->udp_send_batch) {
+		/* the timer is set first, a full queue is sent right away,
+		 * and a failed send sets the timer to report the error */
+		comm_timer_set(pend->timer, &tv);
+		if(!udp_send_queue_add(outnet, pend, packet)) {
+			comm_timer_disable(pend->timer);
+			portcomm_loweruse(outnet, pend->pc);
+			return 0;
+		}
+	} else {
+		/* send it over the commlink */
+		if(!comm_point_send_udp_msg(pend->pc->cp, packet,
+			(struct sockaddr*)&pend->addr, pend->addrlen,
+			outnet->udp_connect)) {
+			portcomm_loweruse(outnet, pend->pc);
+			return 0;
+		}
+
+		/* system calls to set timeout after sending UDP to make
+		 * roundtrip smaller. */
+		comm_timer_set(pend->timer, &tv);
+	}
 
 #ifdef USE_DNSTAP
 	/*
@@ -2022,16 +2526,19 @@ randomize_and_send_udp(struct pending* pend, sldns_buffer* packet, int timeout)
 	return 1;
 }
 
-struct pending* 
-pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
-	int timeout, comm_point_callback_type* cb, void* cb_arg)
+/** send UDP query for the serviced query to the address */
+static struct pending*
+pending_udp_query_addr(struct serviced_query* sq,
+	struct sockaddr_storage* addr, socklen_t addrlen,
+	struct sldns_buffer* packet, int timeout, comm_point_callback_type* cb,
+	void* cb_arg)
 {
 	struct pending* pend = (struct pending*)calloc(1, sizeof(*pend));
 	if(!pend) return NULL;
 	pend->outnet = sq->outnet;
 	pend->sq = sq;
-	pend->addrlen = sq->addrlen;
-	memmove(&pend->addr, &sq->addr, sq->addrlen);
+	pend->addrlen = addrlen;
+	memmove(&pend->addr, addr, addrlen);
 	pend->cb = cb;
 	pend->cb_arg = cb_arg;
 	pend->node.key = pend;
@@ -2042,7 +2549,7 @@ pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 		return NULL;
 	}
 
-	if(sq->outnet->unused_fds == NULL) {
+	if(sq->outnet->unused_fds == NULL && sq->outnet->udp_idle_num == 0) {
 		/* no unused fd, cannot create a new port (randomly) */
 		verbose(VERB_ALGO, "no fds available, udp query waiting");
 		pend->timeout = timeout;
@@ -2069,6 +2576,14 @@ pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 	return pend;
 }
 
+struct pending* 
+pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
+	int timeout, comm_point_callback_type* cb, void* cb_arg)
+{
+	return pending_udp_query_addr(sq, &sq->addr, sq->addrlen, packet,
+		timeout, cb, cb_arg);
+}
+
 void
 outnet_tcptimer(void* arg)
 {
@@ -2414,6 +2929,12 @@ serviced_create(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	sq->outnet = outnet;
 	sq->cblist = NULL;
 	sq->pending = NULL;
+	sq->pool_job = NULL;
+	sq->hedge_addrlen = 0;
+	sq->hedge_timer = NULL;
+	sq->hedge = NULL;
+	sq->hedge_sent = 0;
+	sq->hedge_rtt = 0;
 	sq->status = serviced_initial;
 	sq->retry = 0;
 	sq->to_be_deleted = 0;
@@ -2491,11 +3012,31 @@ reuse_tcp_remove_serviced_keep(struct waiting_tcp* w,
 	return 0;
 }
 
+/** stop the hedged query of the serviced query, if any */
+static void
+serviced_hedge_stop(struct serviced_query* sq)
+{
+	if(sq->hedge_timer)
+		comm_timer_disable(sq->hedge_timer);
+	if(sq->hedge) {
+		struct pending* p = sq->hedge;
+		sq->hedge = NULL;
+		if(p->pc)
+			portcomm_loweruse(sq->outnet, p->pc);
+		pending_delete(sq->outnet, p);
+	}
+}
+
 /** cleanup serviced query entry */
 static void
 serviced_delete(struct serviced_query* sq)
 {
 	verbose(VERB_CLIENT, "serviced_delete");
+	serviced_hedge_stop(sq);
+	if(sq->pool_job) {
+		outnet_pool_job_cancel(sq->pool_job);
+		sq->pool_job = NULL;
+	}
 	if(sq->pending) {
 		/* clear up the pending query */
 		if(sq->status == serviced_query_UDP_EDNS ||
@@ -2583,6 +3124,41 @@ serviced_perturb_qname(struct ub_randstate* rnd, uint8_t* qbuf, size_t len)
 	}
 }
 
+/** start the timer that sends a hedged query, if the answer from the
+ * server is later than the percentile of its roundtrip times */
+static void
+serviced_hedge_start(struct serviced_query* sq, int rtt)
+{
+	struct outside_network* outnet = sq->outnet;
+	struct rtt_info ri;
+	struct timeval tv;
+	int delay, probedelay, ta, taaaa, tother;
+	if(outnet->udp_hedge_percentile == 0 || sq->hedge_addrlen == 0 ||
+		sq->hedge_sent)
+		return;
+	if(infra_get_host_rto(outnet->infra, &sq->addr, sq->addrlen,
+		sq->zone, sq->zonelen, &ri, &probedelay,
+		*outnet->now_secs, &ta, &taaaa, &tother) < 0)
+		return;
+	delay = rtt_percentile(&ri, outnet->udp_hedge_percentile);
+	if(delay < RTT_MIN_TIMEOUT)
+		delay = RTT_MIN_TIMEOUT;
+	if(delay >= rtt)
+		return; /* the retry is not later than the hedged query */
+	if(!sq->hedge_timer) {
+		sq->hedge_timer = comm_timer_create(outnet->base,
+			serviced_hedge_timer_cb, sq);
+		if(!sq->hedge_timer)
+			return;
+	}
+	verbose(VERB_ALGO, "serviced query UDP hedge after %d msec", delay);
+#ifndef S_SPLINT_S
+	tv.tv_sec = delay/1000;
+	tv.tv_usec = (delay%1000)*1000;
+#endif
+	comm_timer_set(sq->hedge_timer, &tv);
+}
+
 /** put serviced query into a buffer */
 static void
 serviced_encode(struct serviced_query* sq, sldns_buffer* buff, int with_edns)
@@ -2669,6 +3245,13 @@ serviced_udp_send(struct serviced_query* sq, sldns_buffer* buff)
 		serviced_udp_callback, sq);
 	if(!sq->pending)
 		return 0;
+	sq->outnet->num_udp_outgoing++;
+	if(sq->outnet->udp_hedge_percentile != 0) {
+		sq->outnet->udp_hedge_tokens += sq->outnet->udp_hedge_max_rate;
+		if(sq->outnet->udp_hedge_tokens > HEDGE_TOKENS_MAX)
+			sq->outnet->udp_hedge_tokens = HEDGE_TOKENS_MAX;
+		serviced_hedge_start(sq, rtt);
+	}
 	return 1;
 }
 
@@ -2742,6 +3325,7 @@ serviced_callbacks(struct serviced_query* sq, int error, struct comm_point* c,
 	rbtree_delete(sq->outnet->serviced, sq);
 	log_assert(rem); /* should have been present */
 	sq->to_be_deleted = 1; 
+	serviced_hedge_stop(sq);
 	verbose(VERB_ALGO, "svcd callbacks start");
 	if(sq->outnet->use_caps_for_id && error == NETEVENT_NOERROR && c &&
 		!sq->nocaps && sq->qtype != LDNS_RR_TYPE_PTR) {
@@ -2823,7 +3407,8 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 	struct waiting_tcp* w = (struct waiting_tcp*)sq->pending;
 	struct pending_tcp* pend_tcp = NULL;
 	struct port_if* pi = NULL;
-	if(!w->on_tcp_waiting_list && w->next_waiting) {
+	/* the queries of the shared stream pool have no waiting_tcp */
+	if(w && !w->on_tcp_waiting_list && w->next_waiting) {
 		pend_tcp = (struct pending_tcp*)w->next_waiting;
 		pi = pend_tcp->pi;
 	}
@@ -2912,6 +3497,22 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 	return 0;
 }
 
+/** send the TCP query of a serviced query, over the shared stream pool if
+ * it is used for the upstream, return false on failure */
+static int
+serviced_tcp_pending(struct serviced_query* sq, sldns_buffer* buff,
+	int timeout)
+{
+	if(sq->outnet->pool && (sq->tcp_upstream || sq->ssl_upstream)) {
+		sq->pool_job = outnet_pool_query(sq->outnet->pool, sq, buff,
+			timeout);
+		return sq->pool_job != NULL;
+	}
+	sq->pending = pending_tcp_query(sq, buff, timeout,
+		serviced_tcp_callback, sq);
+	return sq->pending != NULL;
+}
+
 static void
 serviced_tcp_initiate(struct serviced_query* sq, sldns_buffer* buff)
 {
@@ -2919,9 +3520,8 @@ serviced_tcp_initiate(struct serviced_query* sq, sldns_buffer* buff)
 		sq->status==serviced_query_TCP_EDNS?"EDNS":"");
 	serviced_encode(sq, buff, sq->status == serviced_query_TCP_EDNS);
 	sq->last_sent_time = *sq->outnet->now_tv;
-	sq->pending = pending_tcp_query(sq, buff, sq->outnet->tcp_auth_query_timeout,
-		serviced_tcp_callback, sq);
-	if(!sq->pending) {
+	if(!serviced_tcp_pending(sq, buff,
+		sq->outnet->tcp_auth_query_timeout)) {
 		/* delete from tree so that a retry by above layer does not
 		 * clash with this entry */
 		verbose(VERB_ALGO, "serviced_tcp_initiate: failed to send tcp query");
@@ -2952,9 +3552,7 @@ serviced_tcp_send(struct serviced_query* sq, sldns_buffer* buff)
 	} else {
 		timeout = sq->outnet->tcp_auth_query_timeout;
 	}
-	sq->pending = pending_tcp_query(sq, buff, timeout,
-		serviced_tcp_callback, sq);
-	return sq->pending != NULL;
+	return serviced_tcp_pending(sq, buff, timeout);
 }
 
 /* see if packet is edns malformed; got zeroes at start.
@@ -3126,6 +3724,7 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 	if(LDNS_TC_WIRE(sldns_buffer_begin(c->buffer))) {
 		/* fallback to TCP */
 		/* this discards partial UDP contents */
+		serviced_hedge_stop(sq);
 		if(sq->status == serviced_query_UDP_EDNS ||
 			sq->status == serviced_query_UDP_EDNS_FRAG ||
 			sq->status == serviced_query_UDP_EDNS_fallback)
@@ -3140,12 +3739,109 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 	return 0;
 }
 
+void
+serviced_hedge_timer_cb(void* arg)
+{
+	struct serviced_query* sq = (struct serviced_query*)arg;
+	struct outside_network* outnet = sq->outnet;
+	int vs, rtt;
+	uint8_t edns_lame_known;
+	if(sq->hedge || sq->hedge_sent || !sq->pending ||
+		!(sq->status == serviced_query_UDP_EDNS ||
+		sq->status == serviced_query_UDP ||
+		sq->status == serviced_query_UDP_EDNS_FRAG ||
+		sq->status == serviced_query_UDP_EDNS_fallback))
+		return;
+	if(outnet->udp_hedge_tokens < 100) {
+		verbose(VERB_ALGO, "serviced query: no hedge, max rate reached");
+		return;
+	}
+	if(!infra_host(outnet->infra, &sq->hedge_addr, sq->hedge_addrlen,
+		sq->zone, sq->zonelen, *outnet->now_secs, &vs,
+		&edns_lame_known, &rtt))
+		return;
+	serviced_encode(sq, outnet->udp_buff, vs != -1 &&
+		(sq->status == serviced_query_UDP_EDNS ||
+		sq->status == serviced_query_UDP_EDNS_FRAG));
+	log_name_addr(VERB_ALGO, "hedge query", sq->qbuf+10,
+		&sq->hedge_addr, sq->hedge_addrlen);
+	sq->hedge = pending_udp_query_addr(sq, &sq->hedge_addr,
+		sq->hedge_addrlen, outnet->udp_buff, rtt,
+		serviced_hedge_callback, sq);
+	if(!sq->hedge)
+		return;
+	sq->hedge_sent = 1;
+	sq->hedge_rtt = rtt;
+	sq->hedge_sent_time = *outnet->now_tv;
+	outnet->udp_hedge_tokens -= 100;
+	outnet->num_udp_hedge++;
+}
+
+int
+serviced_hedge_callback(struct comm_point* c, void* arg, int error,
+        struct comm_reply* rep)
+{
+	struct serviced_query* sq = (struct serviced_query*)arg;
+	struct outside_network* outnet = sq->outnet;
+	struct timeval now = *outnet->now_tv;
+	int rcode;
+	sq->hedge = NULL; /* removed after callback */
+	if(error == NETEVENT_TIMEOUT) {
+		if(!infra_rtt_update(outnet->infra, &sq->hedge_addr,
+			sq->hedge_addrlen, sq->zone, sq->zonelen, sq->qtype,
+			-1, sq->hedge_rtt, (time_t)now.tv_sec))
+			log_err("out of memory in UDP exponential backoff");
+		return 0;
+	}
+	if(error != NETEVENT_NOERROR)
+		return 0;
+	rcode = LDNS_RCODE_WIRE(sldns_buffer_begin(c->buffer));
+	if(LDNS_TC_WIRE(sldns_buffer_begin(c->buffer)) ||
+		(rcode != LDNS_RCODE_NOERROR && rcode != LDNS_RCODE_NXDOMAIN) ||
+		(outnet->use_caps_for_id && !sq->nocaps &&
+		sq->qtype != LDNS_RR_TYPE_PTR &&
+		!serviced_check_qname(c->buffer, sq->qbuf, sq->qbuflen))) {
+		/* the query to the first server continues */
+		log_addr(VERB_ALGO, "hedged answer not used, from",
+			&sq->hedge_addr, sq->hedge_addrlen);
+		return 0;
+	}
+	if(now.tv_sec > sq->hedge_sent_time.tv_sec ||
+		(now.tv_sec == sq->hedge_sent_time.tv_sec &&
+		now.tv_usec > sq->hedge_sent_time.tv_usec)) {
+		int roundtime = ((int)(now.tv_sec -
+			sq->hedge_sent_time.tv_sec))*1000 + ((int)now.tv_usec -
+			(int)sq->hedge_sent_time.tv_usec)/1000;
+		if(roundtime < 60000) {
+		    if(!infra_rtt_update(outnet->infra, &sq->hedge_addr,
+			sq->hedge_addrlen, sq->zone, sq->zonelen, sq->qtype,
+			roundtime, sq->hedge_rtt, (time_t)now.tv_sec))
+			log_err("out of memory noting rtt.");
+		}
+	}
+	log_addr(VERB_ALGO, "hedged answer is first, from", &sq->hedge_addr,
+		sq->hedge_addrlen);
+	outnet->num_udp_hedge_won++;
+	/* stop the query to the first server */
+	if(sq->pending) {
+		struct pending* p = (struct pending*)sq->pending;
+		sq->pending = NULL;
+		if(p->pc)
+			portcomm_loweruse(outnet, p->pc);
+		pending_delete(outnet, p);
+	}
+	serviced_callbacks(sq, NETEVENT_NOERROR, c, rep);
+	outnet_send_wait_udp(outnet);
+	return 0;
+}
+
 struct serviced_query* 
 outnet_serviced_query(struct outside_network* outnet,
 	struct query_info* qinfo, uint16_t flags, int dnssec, int want_dnssec,
 	int nocaps, int tcp_upstream, int ssl_upstream, char* tls_auth_name,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
-	size_t zonelen, struct module_qstate* qstate,
+	size_t zonelen, struct sockaddr_storage* hedge_addr,
+	socklen_t hedge_addrlen, struct module_qstate* qstate,
 	comm_point_callback_type* callback, void* callback_arg, sldns_buffer* buff,
 	struct module_env* env)
 {
@@ -3186,6 +3882,10 @@ outnet_serviced_query(struct outside_network* outnet,
 			free(cb);
 			return NULL;
 		}
+		if(hedge_addr && hedge_addrlen <= sizeof(sq->hedge_addr)) {
+			memmove(&sq->hedge_addr, hedge_addr, hedge_addrlen);
+			sq->hedge_addrlen = hedge_addrlen;
+		}
 		/* perform first network action */
 		if(outnet->do_udp && !(tcp_upstream || ssl_upstream)) {
 			if(!serviced_udp_send(sq, buff)) {
@@ -63,6 +63,8 @@ struct edns_option;
 struct module_env;
 struct module_qstate;
 struct query_info;
+struct outnet_pool_conn;
+struct outnet_pool_job;
 
 /**
  * Send queries to outside servers and wait for answers from servers.
@@ -110,6 +112,33 @@ struct outside_network {
 	/** if we perform udp-connect, connect() for UDP socket to mitigate
 	 * ICMP side channel leakage */
 	int udp_connect;
+	/** max number of idle connected UDP sockets that are kept open for
+	 * the next query, 0 if they are closed */
+	int udp_conn_pool;
+	/** max number of queries sent over one connected UDP socket */
+	int udp_conn_reuse;
+	/**
+	 * The idle connected UDP sockets, array of udp_conn_pool.  They are
+	 * on random ports, a query takes a random one and connects it to its
+	 * destination.  A socket in use is not in it, it has one query at
+	 * a time.
+	 */
+	struct port_comm** udp_idle;
+	/** number of sockets in the udp_idle array */
+	int udp_idle_num;
+	/** number of UDP queries sent over a connected socket that was
+	 * already open, for statistics */
+	size_t num_udp_sock_reuse;
+	/** max number of UDP queries in the send queue, 0 if queries are
+	 * sent right away */
+	int udp_send_batch;
+	/** queue of UDP queries that are sent at the end of the event loop
+	 * iteration, with one sendmmsg per port, linked with next_send */
+	struct pending* udp_send_first, *udp_send_last;
+	/** number of queries in the send queue */
+	int udp_send_num;
+	/** zero timeout timer that sends the queued UDP queries */
+	struct comm_timer* udp_send_timer;
 
 	/** array of outgoing IP4 interfaces */
 	struct port_if* ip4_ifs;
@@ -185,6 +214,68 @@ struct outside_network {
 	struct waiting_tcp* tcp_wait_first;
 	/** last of waiting query list */
 	struct waiting_tcp* tcp_wait_last;
+	/** the connection to the shared stream pool, or NULL.  If set, the
+	 * TCP queries for tcp upstream and ssl upstream are sent by it */
+	struct outnet_pool_conn* pool;
+
+	/** if TLS sessions of upstreams are stored and resumed */
+	int tls_resume;
+	/** if the first query on a resumed TLS stream is sent as TLS 1.3
+	 * early data */
+	int tls_early_data;
+	/**
+	 * tree of TLS sessions to resume, by address and auth name of the
+	 * upstream.  Entries are of type struct tls_session.  A session is
+	 * stored when the first answer on a stream is read, and taken out
+	 * when a new stream to the upstream resumes it.
+	 */
+	rbtree_type tls_sessions;
+	/** first and last(oldest) in lru list of TLS sessions, the oldest
+	 * is deleted when the tree has num_tcp elements */
+	struct tls_session* tls_session_first, *tls_session_last;
+	/** number of TLS handshakes with upstreams, for statistics */
+	size_t num_tls_handshake;
+	/** number of TLS handshakes that resumed a session */
+	size_t num_tls_resumed;
+	/** number of TLS handshakes where the early data was accepted */
+	size_t num_tls_early_data;
+	/** number of TLS streams where the kernel sends the records */
+	size_t num_tls_ktls;
+	/** sum of the TLS handshake times, in microseconds */
+	long long tls_handshake_usec;
+
+	/** percentile of the server roundtrip time after which a hedged
+	 * query is sent to another server, 0 if queries are not hedged */
+	int udp_hedge_percentile;
+	/** max percentage of UDP queries that is hedged */
+	int udp_hedge_max_rate;
+	/** hedge budget, every UDP query adds udp_hedge_max_rate and a
+	 * hedged query takes 100 */
+	int udp_hedge_tokens;
+	/** number of UDP queries sent by serviced queries, for statistics */
+	size_t num_udp_outgoing;
+	/** number of hedged UDP queries sent */
+	size_t num_udp_hedge;
+	/** number of hedged UDP queries whose answer was used */
+	size_t num_udp_hedge_won;
+};
+
+/**
+ * TLS session of an upstream, that a new stream to it can resume.
+ */
+struct tls_session {
+	/** rbtree node in the tls_sessions tree, key is this structure */
+	rbnode_type node;
+	/** address and port of the upstream */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** the auth name of the upstream, or NULL */
+	char* auth_name;
+	/** the session, of type SSL_SESSION */
+	void* session;
+	/** lru list, the most recently stored is first */
+	struct tls_session* lru_next, *lru_prev;
 };
 
 /**
@@ -234,6 +325,18 @@ struct port_comm {
 	int num_outstanding;
 	/** UDP commpoint, fd=-1 if not in use */
 	struct comm_point* cp;
+
+	/*---- for connected sockets that are reused -----*/
+	/** the destination that the socket is connected to */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** number of queries sent over the socket */
+	int num_queries;
+	/** if the socket is in the udp_idle array */
+	int idle;
+	/** index in the udp_idle array */
+	int idle_index;
 };
 
 /**
@@ -337,6 +440,13 @@ struct pending {
 	uint8_t* pkt;
 	/** length of query packet. */
 	size_t pkt_len;
+
+	/*---- filled if udp pending is in the send queue, the packet is
+	 * stored in pkt -----*/
+	/** next in the send queue */
+	struct pending* next_send;
+	/** if the pending is in the send queue */
+	int on_send_queue;
 };
 
 /**
@@ -356,6 +466,12 @@ struct pending_tcp {
 	 * It is here for memory pre-allocation, and used to make this
 	 * pending_tcp wait for reuse. */
 	struct reuse_tcp reuse;
+	/** time when the TLS handshake started, for statistics */
+	struct timeval tls_start;
+	/** if the TLS handshake of the stream has been counted */
+	int tls_counted;
+	/** if the TLS session of the stream has been stored for resumption */
+	int tls_stored;
 };
 
 /**
@@ -433,6 +549,9 @@ struct service_callback {
 #define EDNS_FRAG_SIZE_IP4 1472
 /** fallback size for EDNS in IPv6, fits one fragment with ip6-tunnel-ids */
 #define EDNS_FRAG_SIZE_IP6 1232
+/** the max number of hedged queries that can be sent in a burst, in the
+ * udp_hedge_tokens of the outside network */
+#define HEDGE_TOKENS_MAX 1000
 
 /**
  * Query service record.
@@ -509,6 +628,22 @@ struct serviced_query {
 	struct service_callback* cblist;
 	/** the UDP or TCP query that is pending, see status which */
 	void* pending;
+	/** the TCP query that is sent by the shared stream pool, or NULL */
+	struct outnet_pool_job* pool_job;
+	/** server to send a hedged UDP query to, if addrlen is not 0 */
+	struct sockaddr_storage hedge_addr;
+	/** length of hedge_addr, 0 if there is no hedge server */
+	socklen_t hedge_addrlen;
+	/** timer that sends the hedged query, or NULL */
+	struct comm_timer* hedge_timer;
+	/** the hedged query that is pending, or NULL */
+	struct pending* hedge;
+	/** if the hedged query has been sent, it is sent once */
+	int hedge_sent;
+	/** rtt timeout of the hedged query */
+	int hedge_rtt;
+	/** time the hedged query was sent */
+	struct timeval hedge_sent_time;
 	/** block size with which to pad encrypted queries (default: 128) */
 	size_t padding_block_size;
 };
@@ -544,6 +679,18 @@ struct serviced_query {
  * @param max_reuse_tcp_queries: max number of queries on a reuse connection.
  * @param tcp_reuse_timeout: timeout for REUSE entries in milliseconds.
  * @param tcp_auth_query_timeout: timeout in milliseconds for TCP queries to auth servers.
+ * @param tls_resume: if TLS sessions of upstreams are resumed.
+ * @param tls_early_data: if the first query on a resumed TLS stream is
+ *	sent as early data.
+ * @param udp_hedge_percentile: percentile of the server roundtrip time
+ *	after which a hedged UDP query is sent, or 0 to not hedge queries.
+ * @param udp_hedge_max_rate: max percentage of UDP queries that is hedged.
+ * @param udp_send_batch: number of UDP queries that are queued and sent
+ *	together, with sendmmsg per port, or 0 to send them right away.
+ * @param udp_conn_pool: max number of idle connected UDP sockets that are
+ *	kept open for the next queries, or 0 to close them.
+ * @param udp_conn_reuse: max number of queries sent over one connected
+ *	UDP socket.
  * @return: the new structure (with no pending answers) or NULL on error.
  */
 struct outside_network* outside_network_create(struct comm_base* base,
@@ -554,7 +701,9 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
 	void* sslctx, int delayclose, int tls_use_sni, struct dt_env *dtenv,
 	int udp_connect, int max_reuse_tcp_queries, int tcp_reuse_timeout,
-	int tcp_auth_query_timeout);
+	int tcp_auth_query_timeout, int tls_resume, int tls_early_data,
+	int udp_hedge_percentile, int udp_hedge_max_rate, int udp_send_batch,
+	int udp_conn_pool, int udp_conn_reuse);
 
 /**
  * Delete outside_network structure.
@@ -628,6 +777,10 @@ void pending_delete(struct outside_network* outnet, struct pending* p);
 	This is the delegation point name for which the server is deemed
 	authoritative.
  * @param zonelen: length of zone.
+ * @param hedge_addr: if not NULL, and hedging is enabled, a UDP query
+ *	is sent to this server too when the answer from addr is late, and
+ *	the first answer is used.
+ * @param hedge_addrlen: length of hedge_addr.
  * @param qstate: module qstate. Mainly for inspecting the available
  *	edns_opts_lists.
  * @param callback: callback function.
@@ -641,7 +794,8 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 	struct query_info* qinfo, uint16_t flags, int dnssec, int want_dnssec,
 	int nocaps, int tcp_upstream, int ssl_upstream, char* tls_auth_name,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
-	size_t zonelen, struct module_qstate* qstate,
+	size_t zonelen, struct sockaddr_storage* hedge_addr,
+	socklen_t hedge_addrlen, struct module_qstate* qstate,
 	comm_point_callback_type* callback, void* callback_arg,
 	struct sldns_buffer* buff, struct module_env* env);
 
@@ -764,6 +918,12 @@ void pending_udp_timer_cb(void *arg);
 /** callback for udp delay for timeout */
 void pending_udp_timer_delay_cb(void *arg);
 
+/** callback for a queued udp query that could not be sent */
+void pending_udp_send_error_cb(void *arg);
+
+/** callback for the timer that sends the queued udp queries */
+void outnet_udp_send_timer_cb(void *arg);
+
 /** callback for outgoing TCP timer event */
 void outnet_tcptimer(void* arg);
 
@@ -771,6 +931,13 @@ void outnet_tcptimer(void* arg);
 int serviced_udp_callback(struct comm_point* c, void* arg, int error,
         struct comm_reply* rep);
 
+/** callback for the hedged UDP query of a serviced query */
+int serviced_hedge_callback(struct comm_point* c, void* arg, int error,
+        struct comm_reply* rep);
+
+/** timer to send the hedged UDP query of a serviced query */
+void serviced_hedge_timer_cb(void* arg);
+
 /** TCP reply or error callback for serviced queries */
 int serviced_tcp_callback(struct comm_point* c, void* arg, int error,
         struct comm_reply* rep);
@@ -787,4 +954,7 @@ int reuse_cmp(const void* key1, const void* key2);
 /** compare function of reuse_tcp tree_by_id rbtree */
 int reuse_id_cmp(const void* key1, const void* key2);
 
+/** compare function of tls_session rbtree in outside_network struct */
+int tls_session_cmp(const void* key1, const void* key2);
+
 #endif /* OUTSIDE_NETWORK_H */
@@ -50,6 +50,7 @@
 #include "util/data/dname.h"
 #include "util/locks.h"
 #include "util/regional.h"
+#include "util/alloc.h"
 
 /** string for RPZ action enum */
 const char*
@@ -314,11 +315,15 @@ int
 rpz_clear(struct rpz* r)
 {
 	/* must hold write lock on auth_zone */
+	int readers = r->local_zones->readers.num;
 	local_zones_delete(r->local_zones);
 	respip_set_delete(r->respip_set);
 	if(!(r->local_zones = local_zones_create())){
 		return 0;
 	}
+	if(!local_zones_set_readers(r->local_zones, readers)) {
+		return 0;
+	}
 	if(!(r->respip_set = respip_set_create())) {
 		return 0;
 	}
@@ -499,7 +504,7 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 		return;
 	}
 
-	lock_rw_wrlock(&r->local_zones->lock);
+	local_zones_wrlock(r->local_zones);
 	/* exact match */
 	z = local_zones_find(r->local_zones, dname, dnamelen, dnamelabs,
 		LDNS_RR_CLASS_IN);
@@ -509,14 +514,14 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 			log_err("malloc error while inserting RPZ qname "
 				"trigger");
 			free(dname);
-			lock_rw_unlock(&r->local_zones->lock);
+			local_zones_wrunlock(r->local_zones);
 			return;
 		}
 		verbose(VERB_ALGO, "RPZ: skipping duplicate record: '%s'",
 			rrstr);
 		free(rrstr);
 		free(dname);
-		lock_rw_unlock(&r->local_zones->lock);
+		local_zones_wrunlock(r->local_zones);
 		return;
 	}
 	if(!z) {
@@ -524,7 +529,7 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 		if(!(z = local_zones_add_zone(r->local_zones, dname, dnamelen,
 			dnamelabs, rrclass, tp))) {
 			log_warn("RPZ create failed");
-			lock_rw_unlock(&r->local_zones->lock);
+			local_zones_wrunlock(r->local_zones);
 			/* dname will be free'd in failed local_zone_create() */
 			return;
 		}
@@ -536,7 +541,7 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 			log_err("malloc error while inserting RPZ qname "
 				"trigger");
 			free(dname);
-			lock_rw_unlock(&r->local_zones->lock);
+			local_zones_wrunlock(r->local_zones);
 			return;
 		}
 		lock_rw_wrlock(&z->lock);
@@ -547,7 +552,7 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 	}
 	if(!newzone)
 		free(dname);
-	lock_rw_unlock(&r->local_zones->lock);
+	local_zones_wrunlock(r->local_zones);
 	return;
 }
 
@@ -668,20 +673,18 @@ rpz_insert_rr(struct rpz* r, uint8_t* azname, size_t aznamelen, uint8_t* dname,
 }
 
 /**
- * Find RPZ local-zone by qname.
+ * Find RPZ local-zone by qname.  The caller holds the local-zones lock, or
+ * the readers lock of the local-zones.
  * @param r: rpz containing local-zone tree
  * @param qname: qname
  * @param qname_len: length of qname
  * @param qclass: qclass
  * @param only_exact: if 1 only excact (non wildcard) matches are returned
- * @param wr: get write lock for local-zone if 1, read lock if 0
- * @param zones_keep_lock: if set do not release the r->local_zones lock, this
- * 	  makes the caller of this function responsible for releasing the lock.
- * @return: NULL or local-zone holding rd or wr lock
+ * @return: NULL or local-zone
  */
 static struct local_zone*
 rpz_find_zone(struct rpz* r, uint8_t* qname, size_t qname_len, uint16_t qclass,
-	int only_exact, int wr, int zones_keep_lock)
+	int only_exact)
 {
 	uint8_t* ce;
 	size_t ce_len;
@@ -689,27 +692,17 @@ rpz_find_zone(struct rpz* r, uint8_t* qname, size_t qname_len, uint16_t qclass,
 	uint8_t wc[LDNS_MAX_DOMAINLEN+1];
 	int exact;
 	struct local_zone* z = NULL;
-	if(wr) {
-		lock_rw_wrlock(&r->local_zones->lock);
-	} else {
-		lock_rw_rdlock(&r->local_zones->lock);
-	}
-	z = local_zones_find_le(r->local_zones, qname, qname_len,
-		dname_count_labels(qname),
-		LDNS_RR_CLASS_IN, &exact);
-	if(!z || (only_exact && !exact)) {
-		lock_rw_unlock(&r->local_zones->lock);
+	/* the exact lookup uses the hash index, the ordered lookup is
+	 * only needed to find the closest encloser for the wildcard */
+	z = local_zones_find(r->local_zones, qname, qname_len,
+		dname_count_labels(qname), LDNS_RR_CLASS_IN);
+	exact = (z != NULL);
+	if(!z && !only_exact)
+		z = local_zones_find_le(r->local_zones, qname, qname_len,
+			dname_count_labels(qname),
+			LDNS_RR_CLASS_IN, &exact);
+	if(!z || (only_exact && !exact))
 		return NULL;
-	}
-	if(wr) {
-		lock_rw_wrlock(&z->lock);
-	} else {
-		lock_rw_rdlock(&z->lock);
-	}
-	if(!zones_keep_lock) {
-		lock_rw_unlock(&r->local_zones->lock);
-	}
-
 	if(exact)
 		return z;
 
@@ -718,48 +711,16 @@ rpz_find_zone(struct rpz* r, uint8_t* qname, size_t qname_len, uint16_t qclass,
 	 * zone match, append '*' to that and do another lookup. */
 
 	ce = dname_get_shared_topdomain(z->name, qname);
-	if(!ce /* should not happen */) {
-		lock_rw_unlock(&z->lock);
-		if(zones_keep_lock) {
-			lock_rw_unlock(&r->local_zones->lock);
-		}
+	if(!ce /* should not happen */)
 		return NULL;
-	}
 	ce_labs = dname_count_size_labels(ce, &ce_len);
-	if(ce_len+2 > sizeof(wc)) {
-		lock_rw_unlock(&z->lock);
-		if(zones_keep_lock) {
-			lock_rw_unlock(&r->local_zones->lock);
-		}
+	if(ce_len+2 > sizeof(wc))
 		return NULL;
-	}
 	wc[0] = 1; /* length of wildcard label */
 	wc[1] = (uint8_t)'*'; /* wildcard label */
 	memmove(wc+2, ce, ce_len);
-	lock_rw_unlock(&z->lock);
-
-	if(!zones_keep_lock) {
-		if(wr) {
-			lock_rw_wrlock(&r->local_zones->lock);
-		} else {
-			lock_rw_rdlock(&r->local_zones->lock);
-		}
-	}
-	z = local_zones_find_le(r->local_zones, wc,
-		ce_len+2, ce_labs+1, qclass, &exact);
-	if(!z || !exact) {
-		lock_rw_unlock(&r->local_zones->lock);
-		return NULL;
-	}
-	if(wr) {
-		lock_rw_wrlock(&z->lock);
-	} else {
-		lock_rw_rdlock(&z->lock);
-	}
-	if(!zones_keep_lock) {
-		lock_rw_unlock(&r->local_zones->lock);
-	}
-	return z;
+	return local_zones_find(r->local_zones, wc, ce_len+2, ce_labs+1,
+		qclass);
 }
 
 /**
@@ -852,26 +813,28 @@ rpz_remove_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 {
 	struct local_zone* z;
 	int delete_zone = 1;
-	z = rpz_find_zone(r, dname, dnamelen, rr_class,
-		1 /* only exact */, 1 /* wr lock */, 1 /* keep lock*/);
+	local_zones_wrlock(r->local_zones);
+	z = rpz_find_zone(r, dname, dnamelen, rr_class, 1 /* only exact */);
 	if(!z) {
+		local_zones_wrunlock(r->local_zones);
 		verbose(VERB_ALGO, "RPZ: cannot remove RR from IXFR, "
 			"RPZ domain not found");
 		return;
 	}
+	lock_rw_wrlock(&z->lock);
 	if(a == RPZ_LOCAL_DATA_ACTION)
 		delete_zone = rpz_data_delete_rr(z, dname,
 			dnamelen, rr_type, rdatawl, rdatalen);
 	else if(a != localzone_type_to_rpz_action(z->type)) {
 		lock_rw_unlock(&z->lock);
-		lock_rw_unlock(&r->local_zones->lock);
+		local_zones_wrunlock(r->local_zones);
 		return;
 	}
 	lock_rw_unlock(&z->lock); 
 	if(delete_zone) {
 		local_zones_del_zone(r->local_zones, z);
 	}
-	lock_rw_unlock(&r->local_zones->lock); 
+	local_zones_wrunlock(r->local_zones);
 	return;
 }
 
@@ -976,14 +939,17 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 	enum localzone_type lzt;
 	struct local_zone* z = NULL;
 	struct local_data* ld = NULL;
+	/* the local-zones are read with the readers lock of this thread */
+	int thr = env->alloc->thread_num;
 	lock_rw_rdlock(&az->rpz_lock);
 	for(a = az->rpz_first; a; a = a->rpz_az_next) {
 		lock_rw_rdlock(&a->lock);
 		r = a->rpz;
 		if(!r->disabled && (!r->taglist || taglist_intersect(r->taglist,
 			r->taglistlen, taglist, taglen))) {
+			lock_thr_rw_rdlock(&r->local_zones->readers, thr);
 			z = rpz_find_zone(r, qinfo->qname, qinfo->qname_len,
-				qinfo->qclass, 0, 0, 0);
+				qinfo->qclass, 0);
 			if(z && r->action_override == RPZ_DISABLED_ACTION) {
 				if(r->log)
 					log_rpz_apply(z->name,
@@ -992,11 +958,11 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 				/* TODO only register stats when stats_extended?
 				 * */
 				stats->rpz_action[r->action_override]++;
-				lock_rw_unlock(&z->lock);
 				z = NULL;
 			}
 			if(z)
 				break;
+			lock_thr_rw_rdunlock(&r->local_zones->readers, thr);
 		}
 		lock_rw_unlock(&a->lock); /* not found in this auth_zone */
 	}
@@ -1014,7 +980,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 		qinfo->local_alias =
 			regional_alloc_zero(temp, sizeof(struct local_rrset));
 		if(!qinfo->local_alias) {
-			lock_rw_unlock(&z->lock);
+			lock_thr_rw_rdunlock(&r->local_zones->readers, thr);
 			lock_rw_unlock(&a->lock);
 			return 0; /* out of memory */
 		}
@@ -1022,7 +988,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 			regional_alloc_init(temp, r->cname_override,
 				sizeof(*r->cname_override));
 		if(!qinfo->local_alias->rrset) {
-			lock_rw_unlock(&z->lock);
+			lock_thr_rw_rdunlock(&r->local_zones->readers, thr);
 			lock_rw_unlock(&a->lock);
 			return 0; /* out of memory */
 		}
@@ -1032,7 +998,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 			log_rpz_apply(z->name, RPZ_CNAME_OVERRIDE_ACTION, 
 				qinfo, repinfo, r->log_name);
 		stats->rpz_action[RPZ_CNAME_OVERRIDE_ACTION]++;
-		lock_rw_unlock(&z->lock);
+		lock_thr_rw_rdunlock(&r->local_zones->readers, thr);
 		lock_rw_unlock(&a->lock);
 		return 0;
 	}
@@ -1045,7 +1011,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 				localzone_type_to_rpz_action(lzt), qinfo,
 				repinfo, r->log_name);
 		stats->rpz_action[localzone_type_to_rpz_action(lzt)]++;
-		lock_rw_unlock(&z->lock);
+		lock_thr_rw_rdunlock(&r->local_zones->readers, thr);
 		lock_rw_unlock(&a->lock);
 		return !qinfo->local_alias;
 	}
@@ -1056,7 +1022,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 		log_rpz_apply(z->name, localzone_type_to_rpz_action(lzt),
 			qinfo, repinfo, r->log_name);
 	stats->rpz_action[localzone_type_to_rpz_action(lzt)]++;
-	lock_rw_unlock(&z->lock);
+	lock_thr_rw_rdunlock(&r->local_zones->readers, thr);
 	lock_rw_unlock(&a->lock);
 
 	return ret;
@@ -223,6 +223,20 @@ acl_view_tag_checks(struct config_file* cfg, struct views* views)
 		lock_rw_unlock(&v->lock);
 	}
 
+	/* acl_priority_class */
+	for(acl=cfg->acl_priority_class; acl; acl = acl->next) {
+		if(!netblockstrtoaddr(acl->str, UNBOUND_DNS_PORT, &a, &alen,
+			&d)) {
+			fatal_exit("cannot parse access-control-priority-class "
+				"address %s %s", acl->str, acl->str2);
+		}
+		if(find_priority_class(cfg, acl->str2) == -1) {
+			fatal_exit("cannot find priority-class for "
+				"access-control-priority-class: %s %s",
+				acl->str, acl->str2);
+		}
+	}
+
 	/* acl_tags */
 	for(sb=cfg->acl_tags; sb; sb = sb->next) {
 		if(!netblockstrtoaddr(sb->str, UNBOUND_DNS_PORT, &a, &alen,
@@ -580,6 +594,12 @@ morechecks(struct config_file* cfg)
 	if(cfg->edns_buffer_size > cfg->msg_buffer_size)
 		fatal_exit("edns-buffer-size larger than msg-buffer-size, "
 			"answers will not fit in processing buffer");
+	if(cfg->priority_class) {
+		const char* names[CFG_PRIORITY_CLASS_MAX];
+		int percent[CFG_PRIORITY_CLASS_MAX];
+		if(cfg_priority_classes(cfg, names, percent) == -1)
+			fatal_exit("bad priority-class config");
+	}
 #ifdef UB_ON_WINDOWS
 	w_config_adjust_directory(cfg);
 #endif
@@ -120,6 +120,8 @@ usage(void)
 	printf("  				(one entry per line).\n");
 	printf("  dump_cache			print cache to stdout\n");
 	printf("  load_cache			load cache from stdin\n");
+	printf("  dump_cache_snapshot		write the binary cache snapshot to\n");
+	printf("  				the cache-snapshot-file\n");
 	printf("  lookup <name>			print nameservers for name\n");
 	printf("  flush <name>			flushes common types for name from cache\n");
 	printf("  				types:  A, AAAA, MX, PTR, NS,\n");
@@ -229,6 +231,7 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
 	PR_UL_NM("num.cachemiss", s->svr.num_queries_missed_cache);
 	PR_UL_NM("num.prefetch", s->svr.num_queries_prefetch);
 	PR_UL_NM("num.expired", s->svr.ans_expired);
+	PR_UL_NM("num.joined", s->svr.num_joined);
 	PR_UL_NM("num.recursivereplies", s->mesh_replies_sent);
 #ifdef USE_DNSCRYPT
     PR_UL_NM("num.dnscrypt.crypted", s->svr.num_query_dnscrypt_crypted);
@@ -256,6 +259,17 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
 	PR_TIMEVAL("recursion.time.avg", avg);
 	printf("%s.recursion.time.median"SQ"%g\n", nm, s->mesh_time_median);
 	PR_UL_NM("tcpusage", s->svr.tcp_accept_usage);
+	PR_UL_NM("udp.recvmmsg", s->svr.udp_recvmmsg);
+	PR_UL_NM("udp.recvmmsg.datagrams", s->svr.udp_recvmmsg_datagrams);
+	PR_UL_NM("udp.sendmmsg", s->svr.udp_sendmmsg);
+	PR_UL_NM("udp.sendmmsg.datagrams", s->svr.udp_sendmmsg_datagrams);
+	PR_UL_NM("udp.out.sendmmsg", s->svr.udp_out_sendmmsg);
+	PR_UL_NM("udp.out.sendmmsg.datagrams",
+		s->svr.udp_out_sendmmsg_datagrams);
+	PR_UL_NM("cache.misses", s->svr.cache_misses);
+#ifdef USE_DNSTAP
+	PR_UL_NM("dnstap.dropped", s->svr.dnstap_dropped);
+#endif /* USE_DNSTAP */
 }
 
 /** print uptime */
@@ -354,8 +368,17 @@ static void print_extended(struct ub_stats_info* s)
 	/* transport */
 	PR_UL("num.query.tcp", s->svr.qtcp);
 	PR_UL("num.query.tcpout", s->svr.qtcp_outgoing);
+	PR_UL("num.query.udpout", s->svr.qudp_outgoing);
+	PR_UL("num.query.udpout.hedged", s->svr.qudp_hedge);
+	PR_UL("num.query.udpout.hedge_won", s->svr.qudp_hedge_won);
+	PR_UL("num.query.udpout.sockreuse", s->svr.qudp_sock_reuse);
+	printf("udpout.hedge.rate"SQ"%g\n", s->svr.qudp_outgoing?
+		(double)s->svr.qudp_hedge/(double)s->svr.qudp_outgoing : 0.0);
+	printf("udpout.hedge.won.rate"SQ"%g\n", s->svr.qudp_hedge?
+		(double)s->svr.qudp_hedge_won/(double)s->svr.qudp_hedge : 0.0);
 	PR_UL("num.query.tls", s->svr.qtls);
 	PR_UL("num.query.tls_resume", s->svr.qtls_resume);
+	PR_UL("num.query.tls.ktls", s->svr.qtls_ktls);
 	PR_UL("num.query.ipv6", s->svr.qipv6);
 	PR_UL("num.query.https", s->svr.qhttps);
 
@@ -398,6 +421,25 @@ static void print_extended(struct ub_stats_info* s)
 	PR_UL("rrset.cache.count", s->svr.rrset_cache_count);
 	PR_UL("infra.cache.count", s->svr.infra_cache_count);
 	PR_UL("key.cache.count", s->svr.key_cache_count);
+	/* cache lookups */
+	PR_UL("msg.cache.hits", s->svr.msg_cache_hits);
+	PR_UL("msg.cache.misses", s->svr.msg_cache_misses);
+	PR_UL("rrset.cache.hits", s->svr.rrset_cache_hits);
+	PR_UL("rrset.cache.misses", s->svr.rrset_cache_misses);
+	PR_UL("infra.cache.hits", s->svr.infra_cache_hits);
+	PR_UL("infra.cache.misses", s->svr.infra_cache_misses);
+	PR_UL("key.cache.hits", s->svr.key_cache_hits);
+	PR_UL("key.cache.misses", s->svr.key_cache_misses);
+	/* cache hits on the NUMA node of the thread, and on others */
+	PR_UL("msg.cache.hits.local", s->svr.msg_cache_hits -
+		s->svr.msg_cache_remote);
+	PR_UL("msg.cache.hits.remote", s->svr.msg_cache_remote);
+	PR_UL("rrset.cache.hits.local", s->svr.rrset_cache_hits -
+		s->svr.rrset_cache_remote);
+	PR_UL("rrset.cache.hits.remote", s->svr.rrset_cache_remote);
+	PR_UL("key.cache.hits.local", s->svr.key_cache_hits -
+		s->svr.key_cache_remote);
+	PR_UL("key.cache.hits.remote", s->svr.key_cache_remote);
 	/* applied RPZ actions */
 	for(i=0; i<UB_STATS_RPZ_ACTION_NUM; i++) {
 		if(i == RPZ_NO_OVERRIDE_ACTION)
@@ -417,12 +459,61 @@ static void print_extended(struct ub_stats_info* s)
 #endif /* USE_DNSCRYPT */
 	PR_UL("num.query.authzone.up", s->svr.num_query_authzone_up);
 	PR_UL("num.query.authzone.down", s->svr.num_query_authzone_down);
+	PR_UL("tcpout.pool.streams", s->svr.tcp_pool_streams);
+	PR_UL("tcpout.pool.inflight", s->svr.tcp_pool_inflight);
+	PR_UL("tcpout.pool.queries", s->svr.tcp_pool_queries);
+	PR_UL("tcpout.pool.opened", s->svr.tcp_pool_opened);
+	printf("tcpout.pool.queries_per_stream"SQ"%g\n",
+		s->svr.tcp_pool_opened?(double)s->svr.tcp_pool_queries/
+		(double)s->svr.tcp_pool_opened : 0.0);
+	PR_UL("num.tls.upstream.handshake", s->svr.tls_upstream_handshake);
+	PR_UL("num.tls.upstream.resumed", s->svr.tls_upstream_resumed);
+	PR_UL("num.tls.upstream.early_data", s->svr.tls_upstream_early_data);
+	PR_UL("num.tls.upstream.ktls", s->svr.tls_upstream_ktls);
+	printf("tls.upstream.resume.rate"SQ"%g\n",
+		s->svr.tls_upstream_handshake?
+		(double)s->svr.tls_upstream_resumed/
+		(double)s->svr.tls_upstream_handshake : 0.0);
+	printf("tls.upstream.handshake.time.avg"SQ"%g\n",
+		s->svr.tls_upstream_handshake?
+		(double)s->svr.tls_upstream_handshake_usec/1000000.0/
+		(double)s->svr.tls_upstream_handshake : 0.0);
 #ifdef CLIENT_SUBNET
 	PR_UL("num.query.subnet", s->svr.num_query_subnet);
 	PR_UL("num.query.subnet_cache", s->svr.num_query_subnet_cache);
 #endif
 }
 
+/** print stats of the priority classes, if they are configured */
+static void pr_pclass(const char* nm, struct config_file* cfg,
+	struct ub_stats_info* s)
+{
+	const char* names[CFG_PRIORITY_CLASS_MAX];
+	int percent[CFG_PRIORITY_CLASS_MAX];
+	struct timeval sumwait, avg;
+	int i, num;
+	if(!cfg->priority_class)
+		return;
+	num = cfg_priority_classes(cfg, names, percent);
+	for(i=0; i<num; i++) {
+		printf("%s.requestlist.class.%s.current"SQ"%lu\n", nm,
+			names[i], (unsigned long)s->svr.pclass_states[i]);
+		printf("%s.requestlist.class.%s.fetches"SQ"%lu\n", nm,
+			names[i], (unsigned long)s->svr.pclass_fetches[i]);
+		printf("%s.requestlist.class.%s.exceeded"SQ"%lu\n", nm,
+			names[i], (unsigned long)s->svr.pclass_dropped[i]);
+		printf("%s.requestlist.class.%s.replies"SQ"%lu\n", nm,
+			names[i], (unsigned long)s->svr.pclass_replies[i]);
+#ifndef S_SPLINT_S
+		sumwait.tv_sec = s->svr.pclass_wait_usec[i] / 1000000;
+		sumwait.tv_usec = s->svr.pclass_wait_usec[i] % 1000000;
+#endif
+		timeval_divide(&avg, &sumwait, s->svr.pclass_replies[i]);
+		printf("%s.requestlist.class.%s.", nm, names[i]);
+		PR_TIMEVAL("time.avg", avg);
+	}
+}
+
 /** print statistics out of memory structures */
 static void do_stats_shm(struct config_file* cfg, struct ub_stats_info* stats,
 	struct ub_shm_stat_info* shm_stat)
@@ -432,8 +523,10 @@ static void do_stats_shm(struct config_file* cfg, struct ub_stats_info* stats,
 	for(i=0; i<cfg->num_threads; i++) {
 		snprintf(nm, sizeof(nm), "thread%d", i);
 		pr_stats(nm, &stats[i+1]);
+		pr_pclass(nm, cfg, &stats[i+1]);
 	}
 	pr_stats("total", &stats[0]);
+	pr_pclass("total", cfg, &stats[0]);
 	print_uptime(shm_stat);
 	if(cfg->stat_extended) {
 		print_mem(shm_stat, &stats[0]);
@@ -62,6 +62,7 @@
 #include "util/log.h"
 #include "util/fptr_wlist.h"
 #include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
 #include "sldns/wire2str.h"
 #include "sldns/str2wire.h"
 #include "daemon/remote.h"
@@ -308,6 +309,73 @@ pending_list_delete(struct replay_runtime* runtime, struct fake_pending* pend)
 	}
 }
 
+/** stop the hedge of a serviced query, the hedged query is removed */
+static void
+fake_hedge_stop(struct replay_runtime* runtime, struct fake_pending* pend)
+{
+	if(pend->hedge_timer)
+		comm_timer_disable(pend->hedge_timer);
+	if(pend->hedge) {
+		log_info("testbound: hedged query cancelled");
+		pending_list_delete(runtime, pend->hedge);
+		pend->hedge = NULL;
+	}
+}
+
+/**
+ * A serviced query gets a reply or an error, see what that does to the
+ * hedge, like serviced_hedge_callback does.
+ * @param runtime: the runtime.
+ * @param pend: the serviced query, or the hedged query, that is answered.
+ *	A hedged query is deleted.
+ * @param error: the netevent error.
+ * @param buf: the reply.
+ * @return false if the callback is not made, because it is an answer for
+ *	the hedged query that is not used.
+ */
+static int
+fake_hedge_reply(struct replay_runtime* runtime, struct fake_pending* pend,
+	int error, sldns_buffer* buf)
+{
+	struct fake_pending* sq = pend->hedge_of;
+	int rcode;
+	if(!sq) {
+		/* the first server answers, the hedge is not needed */
+		fake_hedge_stop(runtime, pend);
+		return 1;
+	}
+	sq->hedge = NULL;
+	pending_list_delete(runtime, pend);
+	if(error != NETEVENT_NOERROR)
+		return 0;
+	rcode = LDNS_RCODE_WIRE(sldns_buffer_begin(buf));
+	if(LDNS_TC_WIRE(sldns_buffer_begin(buf)) ||
+		(rcode != LDNS_RCODE_NOERROR && rcode != LDNS_RCODE_NXDOMAIN)) {
+		log_info("testbound: hedged answer not used");
+		return 0;
+	}
+	log_info("testbound: hedged answer is first");
+	sq->outnet->num_udp_hedge_won++;
+	fake_hedge_stop(runtime, sq);
+	return 1;
+}
+
+/** the pending query for a REPLY, TIMEOUT or ERROR moment, the last one
+ * sent out, or the last one sent to the address of the moment */
+static struct fake_pending*
+pending_for_moment(struct replay_runtime* runtime, struct replay_moment* mom)
+{
+	struct fake_pending* p;
+	if(mom->addrlen == 0)
+		return runtime->pending_list;
+	for(p = runtime->pending_list; p; p = p->next) {
+		if(sockaddr_cmp(&p->addr, p->addrlen, &mom->addr,
+			mom->addrlen) == 0)
+			return p;
+	}
+	return NULL;
+}
+
 /** number of replies in entry */
 static int
 count_reply_packets(struct entry* entry)
@@ -394,6 +462,10 @@ answer_callback_from_entry(struct replay_runtime* runtime,
 		} else {
 			pending_list_delete(runtime, pend);
 		}
+	} else if(!fake_hedge_reply(runtime, pend, NETEVENT_NOERROR,
+		c.buffer)) {
+		sldns_buffer_free(c.buffer);
+		return;
 	}
 	if((*cb)(&c, cb_arg, NETEVENT_NOERROR, &repinfo)) {
 		fatal_exit("testbound: unexpected: callback returned 1");
@@ -486,7 +558,7 @@ static void
 fake_pending_callback(struct replay_runtime* runtime, 
 	struct replay_moment* todo, int error)
 {
-	struct fake_pending* p = runtime->pending_list;
+	struct fake_pending* p = pending_for_moment(runtime, todo);
 	struct comm_reply repinfo;
 	struct comm_point c;
 	void* cb_arg;
@@ -518,6 +590,9 @@ fake_pending_callback(struct replay_runtime* runtime,
 		} else {
 			pending_list_delete(runtime, p);
 		}
+	} else if(!fake_hedge_reply(runtime, p, error, c.buffer)) {
+		sldns_buffer_free(c.buffer);
+		return;
 	}
 	if((*cb)(&c, cb_arg, error, &repinfo)) {
 		fatal_exit("unexpected: pending callback returned 1");
@@ -702,9 +777,10 @@ do_infra_rtt(struct replay_runtime* runtime)
 
 /** perform exponential backoff on the timeout */
 static void
-expon_timeout_backoff(struct replay_runtime* runtime)
+expon_timeout_backoff(struct replay_runtime* runtime,
+	struct replay_moment* mom)
 {
-	struct fake_pending* p = runtime->pending_list;
+	struct fake_pending* p = pending_for_moment(runtime, mom);
 	int rtt, vs;
 	uint8_t edns_lame_known;
 	int last_rtt, rto;
@@ -764,7 +840,7 @@ do_moment_and_advance(struct replay_runtime* runtime)
 	case repevt_timeout:
 		mom = runtime->now;
 		advance_moment(runtime);
-		expon_timeout_backoff(runtime);
+		expon_timeout_backoff(runtime, mom);
 		fake_pending_callback(runtime, mom, NETEVENT_TIMEOUT);
 		break;
 	case repevt_back_reply:
@@ -955,6 +1031,20 @@ comm_base_timept(struct comm_base* b, time_t** tt, struct timeval** tv)
 	*tv = &runtime->now_tv;
 }
 
+void
+comm_base_set_udp_batch(struct comm_base* ATTR_UNUSED(b),
+	int ATTR_UNUSED(num))
+{
+	/* no UDP batching in testbound */
+}
+
+struct comm_udp_batch_stats*
+comm_base_udp_batch_stats(struct comm_base* ATTR_UNUSED(b))
+{
+	static struct comm_udp_batch_stats st;
+	return &st;
+}
+
 void 
 comm_base_dispatch(struct comm_base* b)
 {
@@ -1048,7 +1138,10 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 	int ATTR_UNUSED(delayclose), int ATTR_UNUSED(tls_use_sni),
 	struct dt_env* ATTR_UNUSED(dtenv), int ATTR_UNUSED(udp_connect),
 	int ATTR_UNUSED(max_reuse_tcp_queries), int ATTR_UNUSED(tcp_reuse_timeout),
-	int ATTR_UNUSED(tcp_auth_query_timeout))
+	int ATTR_UNUSED(tcp_auth_query_timeout), int ATTR_UNUSED(tls_resume),
+	int ATTR_UNUSED(tls_early_data), int udp_hedge_percentile,
+	int udp_hedge_max_rate, int ATTR_UNUSED(udp_send_batch),
+	int ATTR_UNUSED(udp_conn_pool), int ATTR_UNUSED(udp_conn_reuse))
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
 	struct outside_network* outnet =  calloc(1, 
@@ -1058,6 +1151,8 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 		return NULL;
 	runtime->infra = infra;
 	outnet->base = base;
+	outnet->udp_hedge_percentile = udp_hedge_percentile;
+	outnet->udp_hedge_max_rate = udp_hedge_max_rate;
 	outnet->udp_buff = sldns_buffer_new(bufsize);
 	if(!outnet->udp_buff) {
 		free(outnet);
@@ -1180,12 +1275,54 @@ pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 	return (struct waiting_tcp*)pend;
 }
 
+/** start the timer for the hedged query of a serviced query, when the
+ * percentile of the server roundtrip is before its timeout, like
+ * serviced_hedge_start */
+static void
+fake_hedge_start(struct replay_runtime* runtime, struct fake_pending* pend)
+{
+	struct outside_network* outnet = pend->outnet;
+	struct rtt_info ri;
+	struct timeval tv;
+	int vs, rtt, delay, probedelay, ta, taaaa, tother;
+	uint8_t edns_lame_known;
+	if(outnet->udp_hedge_percentile == 0)
+		return;
+	outnet->udp_hedge_tokens += outnet->udp_hedge_max_rate;
+	if(outnet->udp_hedge_tokens > HEDGE_TOKENS_MAX)
+		outnet->udp_hedge_tokens = HEDGE_TOKENS_MAX;
+	if(pend->hedge_addrlen == 0)
+		return;
+	if(!infra_host(runtime->infra, &pend->addr, pend->addrlen,
+		pend->zone, pend->zonelen, runtime->now_secs, &vs,
+		&edns_lame_known, &rtt))
+		return;
+	if(infra_get_host_rto(runtime->infra, &pend->addr, pend->addrlen,
+		pend->zone, pend->zonelen, &ri, &probedelay,
+		runtime->now_secs, &ta, &taaaa, &tother) < 0)
+		return;
+	delay = rtt_percentile(&ri, outnet->udp_hedge_percentile);
+	if(delay < RTT_MIN_TIMEOUT)
+		delay = RTT_MIN_TIMEOUT;
+	if(delay >= rtt)
+		return;
+	pend->hedge_timer = comm_timer_create(outnet->base,
+		serviced_hedge_timer_cb, pend);
+	log_info("testbound: hedge after %d msec", delay);
+#ifndef S_SPLINT_S
+	tv.tv_sec = delay/1000;
+	tv.tv_usec = (delay%1000)*1000;
+#endif
+	comm_timer_set(pend->hedge_timer, &tv);
+}
+
 struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 	struct query_info* qinfo, uint16_t flags, int dnssec,
 	int ATTR_UNUSED(want_dnssec), int ATTR_UNUSED(nocaps),
 	int ATTR_UNUSED(tcp_upstream), int ATTR_UNUSED(ssl_upstream),
 	char* ATTR_UNUSED(tls_auth_name), struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* zone, size_t zonelen,
+	struct sockaddr_storage* hedge_addr, socklen_t hedge_addrlen,
 	struct module_qstate* qstate, comm_point_callback_type* callback,
 	void* callback_arg, sldns_buffer* ATTR_UNUSED(buff),
 	struct module_env* env)
@@ -1256,6 +1393,11 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 	pend->pkt = NULL;
 	pend->runtime = runtime;
 	pend->serviced = 1;
+	pend->outnet = outnet;
+	if(hedge_addr && hedge_addrlen != 0) {
+		memcpy(&pend->hedge_addr, hedge_addr, hedge_addrlen);
+		pend->hedge_addrlen = hedge_addrlen;
+	}
 	pend->pkt_len = sldns_buffer_limit(pend->buffer);
 	pend->pkt = memdup(sldns_buffer_begin(pend->buffer), pend->pkt_len);
 	if(!pend->pkt) fatal_exit("out of memory");
@@ -1279,6 +1421,7 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 	/* add to list */
 	pend->next = runtime->pending_list;
 	runtime->pending_list = pend;
+	fake_hedge_start(runtime, pend);
 	return (struct serviced_query*)pend;
 }
 
@@ -1296,6 +1439,8 @@ void outnet_serviced_query_stop(struct serviced_query* sq, void* cb_arg)
 			if(prev)
 				prev->next = p->next;
 			else 	runtime->pending_list = p->next;
+			fake_hedge_stop(runtime, p);
+			comm_timer_delete(p->hedge_timer);
 			sldns_buffer_free(p->buffer);
 			free(p->pkt);
 			free(p->zone);
@@ -1327,6 +1472,12 @@ void listening_ports_free(struct listen_port* list)
 	free(list);
 }
 
+int listening_ports_steer_cpu(struct listen_port* ATTR_UNUSED(list),
+	const int* ATTR_UNUSED(cpus), int ATTR_UNUSED(num))
+{
+	return 0;
+}
+
 struct comm_point* comm_point_create_local(struct comm_base* ATTR_UNUSED(base),
         int ATTR_UNUSED(fd), size_t ATTR_UNUSED(bufsize),
         comm_point_callback_type* ATTR_UNUSED(callback), 
@@ -1418,11 +1569,80 @@ void pending_udp_timer_cb(void *ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void serviced_hedge_timer_cb(void* arg)
+{
+	struct fake_pending* sq = (struct fake_pending*)arg;
+	struct replay_runtime* runtime = sq->runtime;
+	struct outside_network* outnet = sq->outnet;
+	struct fake_pending* pend;
+	if(sq->hedge_sent)
+		return;
+	if(outnet->udp_hedge_tokens < 100) {
+		log_info("testbound: no hedge, max rate reached");
+		return;
+	}
+	pend = (struct fake_pending*)calloc(1, sizeof(struct fake_pending));
+	log_assert(pend);
+	pend->buffer = sldns_buffer_new(sldns_buffer_capacity(sq->buffer));
+	log_assert(pend->buffer);
+	sldns_buffer_write(pend->buffer, sldns_buffer_begin(sq->buffer),
+		sldns_buffer_limit(sq->buffer));
+	sldns_buffer_flip(pend->buffer);
+	memcpy(&pend->addr, &sq->hedge_addr, sq->hedge_addrlen);
+	pend->addrlen = sq->hedge_addrlen;
+	pend->zone = memdup(sq->zone, sq->zonelen);
+	pend->zonelen = sq->zonelen;
+	pend->qtype = sq->qtype;
+	log_assert(pend->zone);
+	pend->callback = sq->callback;
+	pend->cb_arg = sq->cb_arg;
+	pend->timeout = sq->timeout;
+	pend->transport = transport_udp;
+	pend->runtime = runtime;
+	pend->serviced = 1;
+	pend->outnet = outnet;
+	pend->hedge_of = sq;
+	pend->pkt_len = sq->pkt_len;
+	pend->pkt = memdup(sq->pkt, sq->pkt_len);
+	if(!pend->pkt) fatal_exit("out of memory");
+	log_addr(0, "testbound: hedged query to", &pend->addr, pend->addrlen);
+
+	/* see if it matches the current moment */
+	if(runtime->now && runtime->now->evt_type == repevt_back_query &&
+		(runtime->now->addrlen == 0 || sockaddr_cmp(
+			&runtime->now->addr, runtime->now->addrlen,
+			&pend->addr, pend->addrlen) == 0) &&
+		find_match(runtime->now->match, pend->pkt, pend->pkt_len,
+			pend->transport)) {
+		log_info("testbound: matched pending to event. "
+			"advance time between events.");
+		log_info("testbound: do STEP %d %s", runtime->now->time_step,
+			repevt_string(runtime->now->evt_type));
+		advance_moment(runtime);
+	}
+	pend->next = runtime->pending_list;
+	runtime->pending_list = pend;
+	sq->hedge = pend;
+	sq->hedge_sent = 1;
+	outnet->udp_hedge_tokens -= 100;
+	outnet->num_udp_hedge++;
+}
+
 void pending_udp_timer_delay_cb(void *ATTR_UNUSED(arg))
 {
 	log_assert(0);
 }
 
+void pending_udp_send_error_cb(void *ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
+void outnet_udp_send_timer_cb(void *ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void outnet_tcptimer(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -1496,6 +1716,14 @@ int serviced_udp_callback(struct comm_point* ATTR_UNUSED(c),
 	return 0;
 }
 
+int serviced_hedge_callback(struct comm_point* ATTR_UNUSED(c),
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(reply_info))
+{
+	log_assert(0);
+	return 0;
+}
+
 int serviced_tcp_callback(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(reply_info))
@@ -1528,6 +1756,12 @@ int reuse_id_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
 	return 0;
 }
 
+int tls_session_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
+{
+	log_assert(0);
+	return 0;
+}
+
 /* timers in testbound for autotrust. statistics tested in tdir. */
 struct comm_timer* comm_timer_create(struct comm_base* base, 
 	void (*cb)(void*), void* cb_arg)
@@ -86,6 +86,8 @@
  *	o CHECK_TEMPFILE [fname] - followed by FILE_BEGIN [to match] FILE_END
  *	o INFRA_RTT [ip] [dp] [rtt] - update infra cache entry with rtt.
  *	o ERROR
+ * ; REPLY, TIMEOUT and ERROR act on the last query sent out, or with
+ * ; ADDRESS on the last query sent to that address.
  * ; following entry starts on the next line, ENTRY_BEGIN.
  * ; more STEP items
  * SCENARIO_END
@@ -147,6 +149,7 @@ struct fake_pending;
 struct fake_timer;
 struct replay_var;
 struct infra_cache;
+struct outside_network;
 struct sldns_buffer;
 
 /**
@@ -358,6 +361,22 @@ struct fake_pending {
 	int tcp_pkt_counter;
 	/** the runtime structure this is part of */
 	struct replay_runtime* runtime;
+
+	/*---- hedged UDP queries of serviced queries -----*/
+	/** the outside network, for the hedge budget */
+	struct outside_network* outnet;
+	/** server to send the hedged query to, if addrlen is not 0 */
+	struct sockaddr_storage hedge_addr;
+	/** length of hedge_addr */
+	socklen_t hedge_addrlen;
+	/** timer that sends the hedged query, or NULL */
+	struct comm_timer* hedge_timer;
+	/** the hedged query that is pending, or NULL */
+	struct fake_pending* hedge;
+	/** if the hedged query has been sent */
+	int hedge_sent;
+	/** for a hedged query, the serviced query it is hedged for */
+	struct fake_pending* hedge_of;
 };
 
 /**
@@ -102,6 +102,7 @@ testbound_usage(void)
 	printf("-e 	detect ECDSA support (exit code 0 or 1)\n");
 	printf("-c 	detect CLIENT_SUBNET support (exit code 0 or 1)\n");
 	printf("-i 	detect IPSECMOD support (exit code 0 or 1)\n");
+	printf("-d 	detect CACHEDB support (exit code 0 or 1)\n");
 	printf("-s 	testbound self-test - unit test of testbound parts.\n");
 	printf("-o str  unbound commandline options separated by spaces.\n");
 	printf("Version %s\n", PACKAGE_VERSION);
@@ -379,7 +380,7 @@ main(int argc, char* argv[])
 	pass_argc = 1;
 	pass_argv[0] = "unbound";
 	add_opts("-d", &pass_argc, pass_argv);
-	while( (c=getopt(argc, argv, "12egciho:p:s")) != -1) {
+	while( (c=getopt(argc, argv, "12egcidho:p:s")) != -1) {
 		switch(c) {
 		case 's':
 			free(pass_argv[1]);
@@ -446,6 +447,15 @@ main(int argc, char* argv[])
 #else
 			printf("IPSECMOD not supported\n");
 			exit(1);
+#endif
+			break;
+		case 'd':
+#ifdef USE_CACHEDB
+			printf("CACHEDB supported\n");
+			exit(0);
+#else
+			printf("CACHEDB not supported\n");
+			exit(1);
 #endif
 			break;
 		case 'p':
@@ -45,6 +45,7 @@
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
 #include "services/cache/dns.h"
+#include "util/storage/namehash.h"
 #include "sldns/str2wire.h"
 #include "sldns/wire2str.h"
 #include "sldns/sbuffer.h"
@@ -888,6 +889,62 @@ authzone_query_test(void)
 	check_queries("example.com", zone_example_com, example_com_queries);
 }
 
+/** number of names in the name hash test */
+#define NAMEHASH_TEST_NUM 1000
+/** make name for the name hash test, iN.example.com */
+static void
+namehash_mkname(uint8_t* nm, int i, int upper)
+{
+	char buf[32];
+	int len = snprintf(buf, sizeof(buf), "%c%d", upper?'I':'i', i);
+	nm[0] = (uint8_t)len;
+	memmove(nm+1, buf, (size_t)len);
+	memmove(nm+1+len, upper?"\007EXAMPLE\003COM":"\007example\003com",
+		13);
+}
+
+/** test the name hash index */
+static void
+namehash_test(void)
+{
+	struct name_hash h;
+	uint8_t* names[NAMEHASH_TEST_NUM];
+	uint8_t nm[64];
+	int i;
+	unit_show_func("util/storage/namehash.c", "name_hash_lookup");
+	name_hash_init(&h);
+	unit_assert(name_hash_usable(&h));
+	namehash_mkname(nm, 0, 0);
+	unit_assert(name_hash_lookup(&h, nm, LDNS_RR_CLASS_IN) == NULL);
+	for(i=0; i<NAMEHASH_TEST_NUM; i++) {
+		namehash_mkname(nm, i, 0);
+		names[i] = memdup(nm, sizeof(nm));
+		unit_assert(names[i]);
+		name_hash_insert(&h, names[i], LDNS_RR_CLASS_IN, names[i]);
+	}
+	unit_assert(h.count == NAMEHASH_TEST_NUM);
+	/* case insensitive, and the class is part of the key */
+	for(i=0; i<NAMEHASH_TEST_NUM; i++) {
+		namehash_mkname(nm, i, 1);
+		unit_assert(name_hash_lookup(&h, nm, LDNS_RR_CLASS_IN)
+			== names[i]);
+		unit_assert(name_hash_lookup(&h, nm, LDNS_RR_CLASS_CH)
+			== NULL);
+	}
+	/* remove every third name, the others must stay reachable */
+	for(i=0; i<NAMEHASH_TEST_NUM; i+=3)
+		name_hash_remove(&h, names[i], LDNS_RR_CLASS_IN);
+	for(i=0; i<NAMEHASH_TEST_NUM; i++) {
+		void* found = name_hash_lookup(&h, names[i], LDNS_RR_CLASS_IN);
+		unit_assert(found == (i%3 == 0?NULL:names[i]));
+	}
+	name_hash_clear(&h);
+	unit_assert(h.count == 0);
+	unit_assert(name_hash_lookup(&h, names[1], LDNS_RR_CLASS_IN) == NULL);
+	for(i=0; i<NAMEHASH_TEST_NUM; i++)
+		free(names[i]);
+}
+
 /** test authzone code */
 void 
 authzone_test(void)
@@ -897,4 +954,5 @@ authzone_test(void)
 	authzone_compare_serial();
 	authzone_read_test();
 	authzone_query_test();
+	namehash_test();
 }
@@ -0,0 +1,249 @@
+/*
+ * testcode/unitinflight.c - unit test for the queries in flight.
+ *
+ * Copyright (c) 2024, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * \file
+ * Calls the tests of the queries in flight that are shared between the
+ * threads. Two threads, with a mesh each, are run in turn by the test, and
+ * the wakeups between them are read from their tubes.
+ */
+
+#include "config.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/config_file.h"
+#include "util/module.h"
+#include "util/net_help.h"
+#include "util/netevent.h"
+#include "util/tube.h"
+#include "services/inflight.h"
+#include "services/mesh.h"
+#include "testcode/unitmain.h"
+#include "sldns/rrdef.h"
+
+/** a thread with a mesh for the inflight test */
+struct inflight_thr {
+	/** module env, with the mesh */
+	struct module_env env;
+	/** alloc for the states */
+	struct alloc_cache alloc;
+	/** the connection to the table */
+	struct inflight_conn* conn;
+};
+
+/** create a state on the thread and start it, like a new client query */
+static struct mesh_state* inflight_state(struct inflight_thr* t,
+	uint8_t* qname, size_t qname_len, enum inflight_result expect)
+{
+	struct mesh_area* mesh = t->env.mesh;
+	struct mesh_state* m;
+	struct query_info qinfo;
+	enum inflight_result r;
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = qname;
+	qinfo.qname_len = qname_len;
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	m = mesh_state_create(&t->env, &qinfo, NULL, BIT_RD, 0, 0);
+	unit_assert(m);
+	mesh->num_detached_states++;
+	r = inflight_start(mesh->inflight, &m->s.qinfo, m->s.query_flags);
+	unit_assert(r == expect);
+	if(r == inflight_wait) {
+		m->inflight = 2;
+		m->inflight_next = mesh->inflight_first;
+		if(mesh->inflight_first)
+			mesh->inflight_first->inflight_prev = m;
+		mesh->inflight_first = m;
+	} else	m->inflight = (r == inflight_own)?1:0;
+	return m;
+}
+
+/** read the wakeup of the thread from the tube and handle it */
+static void inflight_wakeup(struct inflight_thr* t)
+{
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	unit_assert(t->conn->woken);
+	unit_assert(tube_read_msg(t->conn->tube, &msg, &len, 1));
+	inflight_conn_handle(t->conn->tube, msg, len, 0, t->conn);
+	unit_assert(!t->conn->woken);
+}
+
+/** set up a thread with a mesh and its connection to the table */
+static void inflight_thr_init(struct inflight_thr* t, int i,
+	struct config_file* cfg, struct module_stack* mods,
+	struct inflight_table* table, struct comm_base* base)
+{
+	memset(t, 0, sizeof(*t));
+	alloc_init(&t->alloc, NULL, i);
+	t->env.cfg = cfg;
+	t->env.alloc = &t->alloc;
+	t->env.mesh = mesh_create(mods, &t->env);
+	unit_assert(t->env.mesh);
+	t->conn = inflight_conn_create(table, i, base, t->env.mesh);
+	unit_assert(t->conn);
+	t->env.mesh->inflight = t->conn;
+}
+
+/** delete the mesh and connection of a thread */
+static void inflight_thr_clear(struct inflight_thr* t)
+{
+	inflight_conn_delete(t->conn);
+	mesh_delete(t->env.mesh);
+	alloc_clear(&t->alloc);
+}
+
+/** test the owner of a query in flight, and a thread that waits for it */
+static void inflight_owner_test(struct inflight_table* table,
+	struct inflight_thr* thr)
+{
+	uint8_t q1[] = "\003www\007example\003com";
+	struct mesh_state* own, *w;
+	struct query_info qinfo;
+	unit_show_func("services/inflight.c", "inflight_start");
+	/* own, the owner again is none, other flags are another query */
+	own = inflight_state(&thr[0], q1, sizeof(q1), inflight_own);
+	qinfo = own->s.qinfo;
+	unit_assert(inflight_start(thr[0].conn, &qinfo, BIT_RD)
+		== inflight_none);
+	unit_assert(inflight_start(thr[1].conn, &qinfo, 0) == inflight_own);
+	inflight_done(thr[1].conn, &qinfo, 0);
+	w = inflight_state(&thr[1], q1, sizeof(q1), inflight_wait);
+	unit_assert(table->tree.count == 1);
+	/* done by another thread than the owner does nothing */
+	inflight_done(thr[1].conn, &qinfo, BIT_RD);
+	unit_assert(table->tree.count == 1 && !thr[1].conn->woken);
+	/* deleting the owning state wakes up the waiting thread */
+	mesh_state_delete(&own->s);
+	unit_assert(table->tree.count == 0 && thr[1].conn->woken);
+	mesh_state_delete(&w->s);
+	inflight_wakeup(&thr[1]);
+	unit_assert(thr[1].env.mesh->inflight_first == NULL);
+}
+
+/** test the wakeup of the waiting states, that are deleted meanwhile */
+static void inflight_wakeup_test(struct inflight_table* table,
+	struct inflight_thr* thr)
+{
+	uint8_t q1[] = "\003www\007example\003com";
+	uint8_t q2[] = "\004mail\007example\003com";
+	struct mesh_state* own1, *own2, *w1, *w2;
+	unit_show_func("services/inflight.c", "inflight_conn_handle");
+	own1 = inflight_state(&thr[0], q1, sizeof(q1), inflight_own);
+	own2 = inflight_state(&thr[0], q2, sizeof(q2), inflight_own);
+	w1 = inflight_state(&thr[1], q1, sizeof(q1), inflight_wait);
+	w2 = inflight_state(&thr[1], q2, sizeof(q2), inflight_wait);
+	unit_assert(table->tree.count == 2);
+	mesh_state_delete(&own1->s);
+	unit_assert(table->tree.count == 1 && thr[1].conn->woken);
+	/* the waiter is jostled out of inflight_first before the wakeup */
+	mesh_state_delete(&w1->s);
+	unit_assert(thr[1].env.mesh->inflight_first == w2);
+	unit_assert(w2->inflight_prev == NULL && w2->inflight_next == NULL);
+	/* the wakeup starts the other waiter, that still has to wait */
+	inflight_wakeup(&thr[1]);
+	unit_assert(thr[1].env.mesh->inflight_first == w2);
+	unit_assert(thr[1].env.mesh->inflight_ready == NULL);
+	unit_assert(w2->inflight == 2);
+
+	/* the second owner is done, and its waiter is deleted before the
+	 * wakeup is handled, that then has nothing to do */
+	mesh_state_delete(&own2->s);
+	unit_assert(table->tree.count == 0 && thr[1].conn->woken);
+	mesh_state_delete(&w2->s);
+	unit_assert(thr[1].env.mesh->inflight_first == NULL);
+	inflight_wakeup(&thr[1]);
+	unit_assert(thr[1].env.mesh->inflight_first == NULL);
+}
+
+/** test that states are jostled out of inflight_ready, while a woken up
+ * state runs, from the middle and the ends of the list */
+static void inflight_ready_test(struct inflight_table* table,
+	struct inflight_thr* t)
+{
+	uint8_t q1[] = "\003www\007example\003com";
+	struct mesh_state* r[3];
+	int i;
+	unit_show_func("services/mesh.c", "mesh_state_delete");
+	for(i=0; i<3; i++) {
+		r[i] = inflight_state(t, q1, sizeof(q1), inflight_own);
+		inflight_done(t->conn, &r[i]->s.qinfo, r[i]->s.query_flags);
+		r[i]->inflight = 3;
+		r[i]->inflight_prev = (i>0)?r[i-1]:NULL;
+		if(i>0)
+			r[i-1]->inflight_next = r[i];
+	}
+	t->env.mesh->inflight_ready = r[0];
+	mesh_state_delete(&r[1]->s);
+	unit_assert(r[0]->inflight_next == r[2]);
+	unit_assert(r[2]->inflight_prev == r[0]);
+	mesh_state_delete(&r[0]->s);
+	unit_assert(t->env.mesh->inflight_ready == r[2]);
+	unit_assert(r[2]->inflight_prev == NULL);
+	mesh_state_delete(&r[2]->s);
+	unit_assert(t->env.mesh->inflight_ready == NULL);
+	unit_assert(table->tree.count == 0);
+}
+
+void inflight_test(void)
+{
+	struct config_file* cfg;
+	struct comm_base* base;
+	struct inflight_table* table;
+	struct module_stack mods;
+	struct inflight_thr thr[2];
+	int i;
+	unit_show_feature("inflight");
+	cfg = config_create();
+	unit_assert(cfg);
+	base = comm_base_create(0);
+	unit_assert(base);
+	table = inflight_create(2);
+	unit_assert(table);
+	memset(&mods, 0, sizeof(mods));
+	for(i=0; i<2; i++)
+		inflight_thr_init(&thr[i], i, cfg, &mods, table, base);
+
+	inflight_owner_test(table, thr);
+	inflight_wakeup_test(table, thr);
+	inflight_ready_test(table, &thr[1]);
+
+	for(i=0; i<2; i++)
+		inflight_thr_clear(&thr[i]);
+	inflight_delete(table);
+	comm_base_delete(base);
+	config_delete(cfg);
+}
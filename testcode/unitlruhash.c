@@ -39,6 +39,7 @@
  */
 
 #include "config.h"
+#include <sys/time.h>
 #include "testcode/unitmain.h"
 #include "util/log.h"
 #include "util/storage/lruhash.h"
@@ -49,6 +50,9 @@ typedef struct slabhash_testkey testkey_type;
 /** use this type for the lruhash test data */
 typedef struct slabhash_testdata testdata_type;
 
+/** print the timing of the benchmark, it is always run */
+static int hashverbose = 0;
+
 /** delete key */
 static void delkey(struct slabhash_testkey* k) {
 	lock_rw_destroy(&k->entry.lock); free(k);}
@@ -204,6 +208,184 @@ static void test_lru(struct lruhash* table)
 	delkey(k2);
 }
 
+/** test that a looked up entry gets a second chance at reclaim */
+static void
+test_second_chance(struct lruhash* table)
+{
+	size_t i, n = table->space_max / test_slabhash_sizefunc(NULL, NULL);
+	testkey_type* k;
+	struct lruhash_entry* en;
+	unit_assert(table->num == 0 && n > 2);
+	for(i=0; i<n; i++) {
+		k = newkey((int)i);
+		k->entry.data = newdata((int)i);
+		lruhash_insert(table, myhash((int)i), &k->entry,
+			k->entry.data, NULL);
+	}
+	unit_assert(table->num == n);
+	/* the oldest entry is referenced by a lookup, not moved */
+	k = newkey(0);
+	en = lruhash_lookup(table, myhash(0), k, 0);
+	unit_assert(en && en->lru_ref);
+	lock_rw_unlock(&en->lock);
+	unit_assert(table->lru_end == en);
+	/* the next insert evicts entry 1 instead of entry 0 */
+	k->id = (int)n;
+	k->entry.hash = myhash((int)n);
+	k->entry.data = newdata((int)n);
+	lruhash_insert(table, myhash((int)n), &k->entry, k->entry.data,
+		NULL);
+	k = newkey(0);
+	en = lruhash_lookup(table, myhash(0), k, 0);
+	unit_assert(en && table->lru_end != en);
+	lock_rw_unlock(&en->lock);
+	k->id = 1;
+	unit_assert(lruhash_lookup(table, myhash(1), k, 0) == NULL);
+	delkey(k);
+	lruhash_clear(table);
+}
+
+/** test that a new entry is not evicted by the reclaim after its insert,
+ * when all the older entries are referenced */
+static void
+test_new_entry_kept(struct lruhash* table)
+{
+	size_t i, n = table->space_max / test_slabhash_sizefunc(NULL, NULL);
+	testkey_type* k;
+	struct lruhash_entry* en;
+	unit_assert(table->num == 0 && n > 2);
+	for(i=0; i<n; i++) {
+		k = newkey((int)i);
+		k->entry.data = newdata((int)i);
+		lruhash_insert(table, myhash((int)i), &k->entry,
+			k->entry.data, NULL);
+	}
+	k = newkey(0);
+	for(i=0; i<n; i++) {
+		k->id = (int)i;
+		en = lruhash_lookup(table, myhash((int)i), k, 0);
+		unit_assert(en);
+		lock_rw_unlock(&en->lock);
+	}
+	delkey(k);
+	k = newkey((int)n);
+	k->entry.data = newdata((int)n);
+	lruhash_insert(table, myhash((int)n), &k->entry, k->entry.data,
+		NULL);
+	unit_assert(table->num == n);
+	k = newkey((int)n);
+	en = lruhash_lookup(table, myhash((int)n), k, 0);
+	unit_assert(en);
+	lock_rw_unlock(&en->lock);
+	delkey(k);
+	lruhash_clear(table);
+}
+
+/** test that with sieve a looked up entry stays during a scan */
+static void
+test_sieve(struct lruhash* table)
+{
+	size_t i, n = table->space_max / test_slabhash_sizefunc(NULL, NULL);
+	testkey_type* k;
+	struct lruhash_entry* en;
+	lruhash_set_policy(table, lruhash_policy_sieve);
+	unit_assert(table->num == 0 && n > 2);
+	for(i=0; i<n; i++) {
+		k = newkey((int)i);
+		k->entry.data = newdata((int)i);
+		lruhash_insert(table, myhash((int)i), &k->entry,
+			k->entry.data, NULL);
+	}
+	k = newkey(0);
+	en = lruhash_lookup(table, myhash(0), k, 0);
+	unit_assert(en);
+	lock_rw_unlock(&en->lock);
+	/* touch does not move the entry */
+	lock_quick_lock(&table->lock);
+	lru_touch(table, en);
+	unit_assert(table->lru_end == en);
+	lock_quick_unlock(&table->lock);
+	/* a scan of new names, that are not looked up again */
+	for(i=n; i<2*n; i++) {
+		testkey_type* s = newkey((int)i);
+		s->entry.data = newdata((int)i);
+		lruhash_insert(table, myhash((int)i), &s->entry,
+			s->entry.data, NULL);
+	}
+	en = lruhash_lookup(table, myhash(0), k, 0);
+	unit_assert(en);
+	lock_rw_unlock(&en->lock);
+	k->id = 1;
+	unit_assert(lruhash_lookup(table, myhash(1), k, 0) == NULL);
+	delkey(k);
+	lruhash_clear(table);
+	lruhash_set_policy(table, lruhash_policy_lru);
+}
+
+/** test that hits on entries of another NUMA node are counted */
+static void
+test_remote_hits(struct lruhash* table)
+{
+	int node0 = 0, node1 = 1;
+	size_t h, m, r;
+	testkey_type* k = newkey(12);
+	testkey_type* k2 = newkey(12);
+	struct lruhash_entry* en;
+	lruhash_get_hits(table, &h, &m, &r, 1);
+	lruhash_thread_node_init();
+	lruhash_thread_node_set(&node1);
+	k->entry.data = newdata(12);
+	lruhash_insert(table, myhash(12), &k->entry, k->entry.data, NULL);
+	unit_assert(k->entry.node == 1);
+	en = lruhash_lookup(table, myhash(12), k2, 0);
+	unit_assert(en == &k->entry);
+	lock_rw_unlock(&en->lock);
+	lruhash_thread_node_set(&node0);
+	en = lruhash_lookup(table, myhash(12), k2, 0);
+	unit_assert(en == &k->entry);
+	lock_rw_unlock(&en->lock);
+	lruhash_get_hits(table, &h, &m, &r, 1);
+	unit_assert(h == 2 && m == 0 && r == 1);
+	lruhash_thread_node_set(NULL);
+	unit_assert(lruhash_thread_node() == 0);
+	delkey(k2);
+	lruhash_clear(table);
+}
+
+/** test that the size of the data of an entry can change */
+static void
+test_entry_size(struct lruhash* table)
+{
+	size_t i, n = table->space_max / test_slabhash_sizefunc(NULL, NULL);
+	size_t used, extra = 0, other = 0;
+	testkey_type* k;
+	testdata_type* d = newdata(0);
+	unit_assert(table->num == 0 && n > 2);
+	for(i=0; i<n-1; i++) {
+		k = newkey((int)i);
+		k->entry.data = (i==0?d:newdata((int)i));
+		lruhash_insert(table, myhash((int)i), &k->entry,
+			k->entry.data, NULL);
+	}
+	k = newkey(0);
+	used = table->space_used;
+	/* other data for the key is not changed */
+	lruhash_update_entry_size(table, myhash(0), k, k, &other, 10, NULL);
+	unit_assert(other == 0 && table->space_used == used);
+	lruhash_update_entry_size(table, myhash(0), k, d, &extra, 10, NULL);
+	unit_assert(extra == 10 && table->space_used == used+10);
+	lruhash_update_entry_size(table, myhash(0), k, d, &extra, -4, NULL);
+	unit_assert(extra == 6 && table->space_used == used+6);
+	/* a larger size makes space by deleting the oldest entries,
+	 * the entry itself is the oldest */
+	lruhash_update_entry_size(table, myhash(0), k, d, &extra,
+		(int)(2*test_slabhash_sizefunc(NULL, NULL)), NULL);
+	unit_assert(table->space_used <= table->space_max);
+	unit_assert(lruhash_lookup(table, myhash(0), k, 0) == NULL);
+	delkey(k);
+	lruhash_clear(table);
+}
+
 /** test hashtable using short sequence */
 static void
 test_short_table(struct lruhash* table) 
@@ -457,6 +639,42 @@ test_thr_main(void* arg)
 	return NULL;
 }
 
+/** main routine for threaded lookups, while thread 1 grows the table */
+static void*
+test_thr_lookup_main(void* arg) 
+{
+	struct test_thr* t = (struct test_thr*)arg;
+	int i;
+	log_thread_set(&t->num);
+	for(i=0; i<10000; i++) {
+		if(t->num == 1)
+			testadd_unlim(t->table, NULL);
+		else	testlookup_unlim(t->table, NULL);
+	}
+	check_table(t->table);
+	return NULL;
+}
+
+/** test lookups without the table lock, while the table grows */
+static void
+test_threaded_lookup(struct lruhash* table)
+{
+	int numth = 10;
+	struct test_thr t[100];
+	int i;
+
+	for(i=1; i<numth; i++) {
+		t[i].num = i;
+		t[i].table = table;
+		ub_thread_create(&t[i].id, test_thr_lookup_main, &t[i]);
+	}
+
+	for(i=1; i<numth; i++) {
+		ub_thread_join(t[i].id);
+	}
+	if(0) lruhash_status(table, "hashtest", 1);
+}
+
 /** test hash table access by multiple threads */
 static void
 test_threaded_table(struct lruhash* table)
@@ -477,6 +695,120 @@ test_threaded_table(struct lruhash* table)
 	if(0) lruhash_status(table, "hashtest", 1);
 }
 
+/** number of entries in the table for the benchmark */
+#define BENCH_ENTRIES 4096
+/** number of operations per thread in the benchmark */
+#define BENCH_ITER 100000
+/** largest number of threads for the benchmark */
+#define BENCH_THR_MAX 16
+
+/** the benchmark spreads the entries over the bins, unlike myhash */
+static hashvalue_type benchhash(int id)
+{
+	return (hashvalue_type)id * (hashvalue_type)0x9e3779b1;
+}
+
+/** insert an entry for the benchmark */
+static void
+bench_add(struct lruhash* table, int id)
+{
+	testkey_type* k = newkey(id);
+	testdata_type* d = newdata(id);
+	k->entry.hash = benchhash(id);
+	k->entry.data = d;
+	lruhash_insert(table, k->entry.hash, &k->entry, d, NULL);
+}
+
+/** main routine for the benchmark, mostly lookups, some inserts */
+static void*
+test_thr_bench_main(void* arg)
+{
+	struct test_thr* t = (struct test_thr*)arg;
+	struct lruhash_entry* e;
+	testkey_type key;
+	unsigned int seed = (unsigned int)t->num;
+	int i, id;
+	log_thread_set(&t->num);
+	memset(&key, 0, sizeof(key));
+	key.entry.key = &key;
+	for(i=0; i<BENCH_ITER; i++) {
+		/* a small per thread generator, random() has a lock */
+		seed = seed*1103515245 + 12345;
+		id = (int)((seed>>16) % BENCH_ENTRIES);
+		if(i % 100 == 0) {
+			/* replaces the entry with that id, takes the
+			 * hashtable lock */
+			bench_add(t->table, id);
+			continue;
+		}
+		key.id = id;
+		key.entry.hash = benchhash(id);
+		e = lruhash_lookup(t->table, key.entry.hash, &key, 0);
+		if(e) {
+			unit_assert(((testdata_type*)e->data)->data == id);
+			lock_rw_unlock(&e->lock);
+		}
+	}
+	return NULL;
+}
+
+/** run the benchmark with a number of threads, returns ops per second */
+static double
+bench_threads(struct lruhash* table, int numth)
+{
+	struct test_thr t[BENCH_THR_MAX];
+	struct timeval start, end;
+	double dt;
+	int i;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<numth; i++) {
+		t[i].num = i+1;
+		t[i].table = table;
+		ub_thread_create(&t[i].id, test_thr_bench_main, &t[i]);
+	}
+	for(i=0; i<numth; i++) {
+		ub_thread_join(t[i].id);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	/* time in millisec */
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(dt <= 0.)
+		dt = 0.001;
+	return (double)numth*BENCH_ITER / (dt/1000.);
+}
+
+/** stress the table with an increasing number of threads, lookups do not
+ * take the hashtable lock. It checks the table under concurrent use, the
+ * printed rates are for a comparison on a host with several cores */
+static void
+test_threaded_bench(void)
+{
+	struct lruhash* table;
+	double ops, base = 0.;
+	int i, numth;
+	table = lruhash_create(BENCH_ENTRIES, 16*1024*1024,
+		test_slabhash_sizefunc, test_slabhash_compfunc,
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	unit_assert(table);
+	for(i=0; i<BENCH_ENTRIES; i++)
+		bench_add(table, i);
+	unit_assert(table->num == BENCH_ENTRIES);
+	for(numth=1; numth<=BENCH_THR_MAX; numth*=2) {
+		ops = bench_threads(table, numth);
+		if(numth == 1)
+			base = ops;
+		if(hashverbose)
+			printf("lruhash bench: %d threads %g lookups/sec, "
+				"%.2fx of 1 thread\n", numth, ops, ops/base);
+	}
+	/* the inserts replaced entries, they did not add any */
+	unit_assert(table->num == BENCH_ENTRIES);
+	lruhash_delete(table);
+}
+
 void lruhash_test(void)
 {
 	/* start very very small array, so it can do lots of table_grow() */
@@ -488,6 +820,11 @@ void lruhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_bin_find_entry(table);
 	test_lru(table);
+	test_second_chance(table);
+	test_new_entry_kept(table);
+	test_sieve(table);
+	test_remote_hits(table);
+	test_entry_size(table);
 	test_short_table(table);
 	test_long_table(table);
 	lruhash_delete(table);
@@ -496,4 +833,10 @@ void lruhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_threaded_table(table);
 	lruhash_delete(table);
+	table = lruhash_create(2, 1024*1024, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	test_threaded_lookup(table);
+	lruhash_delete(table);
+	test_threaded_bench();
 }
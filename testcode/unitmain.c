@@ -70,6 +70,7 @@
 int testcount = 0;
 
 #include "util/alloc.h"
+#include "util/data/packed_rrset.h"
 /** test alloc code */
 static void
 alloc_test(void) {
@@ -108,6 +109,38 @@ alloc_test(void) {
 	alloc_clear(&major);
 }
 
+/** test that alloc gives items back to their NUMA node */
+static void
+alloc_node_test(void) {
+	alloc_special_type *t1, *t2;
+	struct alloc_cache nodes[2], thr0, thr1;
+
+	unit_show_feature("alloc_set_node");
+	alloc_init(&nodes[0], NULL, 0);
+	alloc_init(&nodes[1], NULL, 0);
+	alloc_init(&thr0, &nodes[0], 0);
+	alloc_set_node(&thr0, 0, nodes, 2);
+	alloc_init(&thr1, &nodes[1], 1);
+	alloc_set_node(&thr1, 1, nodes, 2);
+
+	t1 = alloc_special_obtain(&thr1);
+	unit_assert(t1->entry.node == 1);
+	/* released on the other node, it goes back to node 1 */
+	alloc_special_release(&thr0, t1);
+	unit_assert(thr0.num_quar == 0 && nodes[1].num_quar == 1);
+	t2 = alloc_special_obtain(&thr0);
+	unit_assert(t2 != t1 && t2->entry.node == 0);
+	alloc_special_release(&thr0, t2);
+	unit_assert(nodes[1].num_quar == 1 &&
+		thr0.num_quar + nodes[0].num_quar == 11);
+
+	alloc_clear(&thr0);
+	alloc_clear(&thr1);
+	unit_assert(nodes[0].num_quar == 11 && nodes[1].num_quar == 11);
+	alloc_clear(&nodes[0]);
+	alloc_clear(&nodes[1]);
+}
+
 #include "util/net_help.h"
 /** test net code */
 static void 
@@ -401,6 +434,43 @@ config_tag_test(void)
 		(uint8_t*)"\001\000\001", 3, (uint8_t*)"\001", 1
 		) == 1);
 }
+
+/** test the order of the priority classes */
+static void
+config_pclass_test(void)
+{
+	const char* names[CFG_PRIORITY_CLASS_MAX];
+	int percent[CFG_PRIORITY_CLASS_MAX];
+	struct config_file* cfg = config_create();
+	unit_show_func("util/config_file.c", "cfg_priority_classes");
+	unit_assert(cfg);
+	/* the builtin classes, without a limit */
+	unit_assert(cfg_priority_classes(cfg, names, percent) == 3);
+	unit_assert(strcmp(names[0], "client") == 0 && percent[0] == 0);
+	unit_assert(strcmp(names[1], "internal") == 0 && percent[1] == 0);
+	unit_assert(strcmp(names[2], "prefetch") == 0 && percent[2] == 0);
+	/* configured classes first, in the order of the config */
+	unit_assert(cfg_str2list_insert(&cfg->priority_class,
+		strdup("trusted"), strdup("0")));
+	unit_assert(cfg_str2list_insert(&cfg->priority_class,
+		strdup("prefetch"), strdup("10")));
+	unit_assert(cfg_str2list_insert(&cfg->priority_class,
+		strdup("bulk"), strdup("20")));
+	unit_assert(cfg_priority_classes(cfg, names, percent) == 5);
+	unit_assert(strcmp(names[0], "trusted") == 0 && percent[0] == 0);
+	unit_assert(strcmp(names[1], "prefetch") == 0 && percent[1] == 10);
+	unit_assert(strcmp(names[2], "bulk") == 0 && percent[2] == 20);
+	unit_assert(strcmp(names[3], "client") == 0);
+	unit_assert(strcmp(names[4], "internal") == 0);
+	unit_assert(find_priority_class(cfg, "bulk") == 2);
+	unit_assert(find_priority_class(cfg, "internal") == 4);
+	unit_assert(find_priority_class(cfg, "nosuchclass") == -1);
+	/* a class that is listed twice is an error */
+	unit_assert(cfg_str2list_insert(&cfg->priority_class,
+		strdup("bulk"), strdup("5")));
+	unit_assert(cfg_priority_classes(cfg, names, percent) == -1);
+	config_delete(cfg);
+}
 	
 #include "util/rtt.h"
 #include "util/timehist.h"
@@ -429,6 +499,39 @@ rtt_test(void)
 		unit_assert( rtt_timeout(&r) > RTT_MIN_TIMEOUT-1);
 		unit_assert( rtt_timeout(&r) < RTT_MAX_TIMEOUT+1);
 	}
+	unit_show_func("util/rtt.c", "rtt_percentile");
+	rtt_init(&r);
+	r.srtt = 100;
+	r.rttvar = 40;
+	unit_assert( rtt_percentile(&r, 50) == 100 );
+	unit_assert( rtt_percentile(&r, 90) == 100 + 128*40*5/400 );
+	unit_assert( rtt_percentile(&r, 95) > rtt_percentile(&r, 90) );
+	unit_assert( rtt_percentile(&r, 99) > rtt_percentile(&r, 97) );
+	unit_assert( rtt_percentile(&r, 96) > rtt_percentile(&r, 95) &&
+		rtt_percentile(&r, 96) < rtt_percentile(&r, 97) );
+	/* bimodal server, 5 msec and 500 msec */
+	unit_show_func("util/rtt.c", "rtt_hist_percentile");
+	rtt_init(&r);
+	unit_assert( rtt_hist_percentile(&r.hist, 50, -1) == -1 );
+	for(i=0; i<100; i++)
+		rtt_update(&r, (i%4==0)?500:5);
+	unit_assert( r.hist.total <= RTT_HIST_MAX );
+	unit_assert( rtt_percentile(&r, 50) >= 4 &&
+		rtt_percentile(&r, 50) < 6 );
+	unit_assert( rtt_percentile(&r, 90) >= 384 &&
+		rtt_percentile(&r, 90) < 512 );
+	/* a server that loses queries is slow at the high percentiles */
+	rtt_init(&r);
+	for(i=0; i<100; i++) {
+		if(i%5==0)
+			rtt_lost(&r, rtt_timeout(&r));
+		else	rtt_update(&r, 20);
+	}
+	unit_assert( rtt_percentile(&r, 90) < 24 );
+	unit_assert( rtt_select_percentile(&r, 50) < 24 );
+	unit_assert( rtt_select_percentile(&r, 90) == rtt_timeout(&r) );
+	for(i=0; i<RTT_HIST_BUCKETS-1; i++)
+		unit_assert( rtt_hist_bucket_low(i) < rtt_hist_bucket_low(i+1) );
 	/* must be the same, timehist bucket is used in stats */
 	unit_assert(UB_STATS_BUCKET_NUM == NUM_BUCKETS_HIST);
 }
@@ -943,18 +1046,23 @@ main(int argc, char* argv[])
 	net_test();
 	config_memsize_test();
 	config_tag_test();
+	config_pclass_test();
 	dname_test();
 	rtt_test();
 	anchors_test();
 	alloc_test();
+	alloc_node_test();
 	regional_test();
 	lruhash_test();
 	slabhash_test();
 	infra_test();
+	snapshot_test();
 	ldns_test();
 	zonemd_test();
 	msgparse_test();
 	tcpid_test();
+	inflight_test();
+	outnet_test();
 #ifdef CLIENT_SUBNET
 	ecs_test();
 #endif /* CLIENT_SUBNET */
@@ -82,5 +82,11 @@ void ldns_test(void);
 void authzone_test(void);
 /** unit test for zonemd functions */
 void zonemd_test(void);
+/** unit test for outside network UDP functions */
+void outnet_test(void);
+/** unit test for the cache snapshot functions */
+void snapshot_test(void);
+/** unit test for the queries in flight that are shared between threads */
+void inflight_test(void);
 
 #endif /* TESTCODE_UNITMAIN_H */
@@ -309,6 +309,63 @@ check_the_rrsigs(struct query_info* qinfo, struct reply_info* rep)
 	}
 }
 
+/** check that the answer from the wire image is the same as the encoded
+ * answer, with a different ID, flags and time */
+static void
+check_wire_image(struct query_info* qi, struct reply_info* rep,
+	sldns_buffer* out, struct regional* region, struct edns_data* edns)
+{
+	struct reply_wire* w = NULL;
+	sldns_buffer* exp = sldns_buffer_new(65535);
+	struct edns_data e = *edns;
+	int dnssec = (int)(edns->bits & EDNS_DO);
+	size_t i;
+	unit_assert(exp);
+	e.opt_list = NULL;
+	/* unstamped data, that is not from the rrset cache, has no image */
+	for(i=0; i<rep->rrset_count; i++)
+		((struct packed_rrset_data*)rep->rrsets[i]->entry.data)->
+			stamp = 0;
+	if(rep->rrset_count > 0) {
+		unit_assert(reply_info_answer_encode_wire(qi, rep, 0x1234, 0,
+			out, 0, 1, region, 65535, &e, dnssec, 0, &w));
+		unit_assert(!w);
+	}
+	/* stamp the data like the rrset cache does */
+	for(i=0; i<rep->rrset_count; i++)
+		((struct packed_rrset_data*)rep->rrsets[i]->entry.data)->
+			stamp = i+1;
+	unit_assert(reply_info_answer_encode_wire(qi, rep, 0x1234, 0, out,
+		0, 1, region, 65535, &e, dnssec, 0, &w));
+	unit_assert(w);
+	unit_assert(reply_info_answer_encode(qi, rep, 0x4321, BIT_RD|BIT_CD,
+		exp, 10, 1, region, 65535, &e, dnssec, 1));
+	unit_assert(reply_wire_answer_encode(w, qi, rep, 0x4321, BIT_RD|BIT_CD,
+		out, 10, 1, 65535, &e, dnssec, 1) == 1);
+	unit_assert(sldns_buffer_limit(out) == sldns_buffer_limit(exp));
+	unit_assert(memcmp(sldns_buffer_begin(out), sldns_buffer_begin(exp),
+		sldns_buffer_limit(exp)) == 0);
+	/* an answer that does not fit is encoded with truncation */
+	if(w->len > 512)
+		unit_assert(reply_wire_answer_encode(w, qi, rep, 0x4321, 0,
+			out, 10, 1, 512, &e, dnssec, 1) == 0);
+	/* a changed rrset makes the image stale */
+	if(rep->rrset_count > 0) {
+		rrset_id_type id = rep->rrsets[0]->id;
+		rep->rrsets[0]->id = id+1;
+		unit_assert(reply_wire_answer_encode(w, qi, rep, 0x4321, 0,
+			out, 10, 1, 65535, &e, dnssec, 1) == -1);
+		rep->rrsets[0]->id = id;
+		/* and so does changed rrset data */
+		((struct packed_rrset_data*)rep->rrsets[0]->entry.data)->
+			stamp = rep->rrset_count+1;
+		unit_assert(reply_wire_answer_encode(w, qi, rep, 0x4321, 0,
+			out, 10, 1, 65535, &e, dnssec, 1) == -1);
+	}
+	free(w);
+	sldns_buffer_free(exp);
+}
+
 /** test a packet */
 static void
 testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out, 
@@ -371,6 +428,8 @@ testpkt(sldns_buffer* pkt, struct alloc_cache* alloc, sldns_buffer* out,
 				/* must set TC bit if shortened */
 			unit_assert(sldns_buffer_limit(out) <= lim);
 		}
+		if(rep->qdcount == 1 && (rep->flags & BIT_QR))
+			check_wire_image(&qi, rep, out, region, &edns);
 	} 
 
 	query_info_clear(&qi);
@@ -39,13 +39,19 @@
  */
 
 #include "config.h"
+#include <sys/time.h>
 #include "util/log.h"
 #include "util/net_help.h"
+#include "util/config_file.h"
+#include "util/regional.h"
 #include "util/data/packed_rrset.h"
+#include "util/data/msgreply.h"
 #include "util/data/dname.h"
 #include "testcode/unitmain.h"
 #include "validator/val_neg.h"
+#include "services/cache/rrset.h"
 #include "sldns/rrdef.h"
+#include "sldns/sbuffer.h"
 
 /** verbose unit test for negative cache */
 static int negverbose = 0;
@@ -203,7 +209,7 @@ static void add_item(struct val_neg_cache* neg)
 	char* zname = get_random_zone();
 	char* from, *to;
 
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	if(negverbose)
 		log_nametypeclass(0, "add to zone", (uint8_t*)zname, 0, 0);
 	z = neg_find_zone(neg, (uint8_t*)zname, strlen(zname)+1, 
@@ -236,7 +242,7 @@ static void add_item(struct val_neg_cache* neg)
 	rr_data = (uint8_t*)to;
 
 	neg_insert_data(neg, z, &nsec);
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /** remove a random item */
@@ -247,9 +253,9 @@ static void remove_item(struct val_neg_cache* neg)
 	rbnode_type* walk;
 	struct val_neg_zone* z;
 	
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	if(neg->tree.count == 0) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return; /* nothing to delete */
 	}
 
@@ -269,11 +275,11 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 	if(!z->in_use) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 	if(negverbose)
@@ -295,7 +301,7 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 	if(d->in_use) {
@@ -303,7 +309,7 @@ static void remove_item(struct val_neg_cache* neg)
 			log_nametypeclass(0, "neg delete item:", d->name, 0, 0);
 		neg_delete_data(neg, d);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /** sum up the zone trees */
@@ -473,7 +479,7 @@ static void check_neg_invariants(struct val_neg_cache* neg)
 {
 	struct val_neg_zone* z;
 	/* check structure of LRU list */
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	check_lru(neg);
 	unit_assert(neg->max == 1024*1024);
 	unit_assert(neg->nsec3_max_iter == 1500);
@@ -485,7 +491,7 @@ static void check_neg_invariants(struct val_neg_cache* neg)
 		unit_assert(neg->first == NULL);
 		unit_assert(neg->last == NULL);
 		unit_assert(neg->use == 0);
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 
@@ -495,7 +501,7 @@ static void check_neg_invariants(struct val_neg_cache* neg)
 	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
 		check_zone_invariants(neg, z);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /** perform stress test on insert and delete in neg cache */
@@ -529,6 +535,207 @@ static void stress_test(struct val_neg_cache* neg)
 	}
 }
 
+/** number of zones for the threaded test */
+#define NEG_THR_ZONES 8
+/** max number of threads for the threaded test, it runs with 1, 2, 4
+ * and 8 threads */
+#define NEG_THR_MAX 8
+/** number of operations per thread in the threaded test */
+#define NEG_THR_ITER 50000
+
+/** a reply with the SOA and an NSEC of a zone, for the threaded test */
+struct neg_thr_reply {
+	/** the reply */
+	struct reply_info rep;
+	/** the rrsets of the reply */
+	struct ub_packed_rrset_key* rrsets[2];
+	/** the SOA and the NSEC */
+	struct ub_packed_rrset_key soa, nsec;
+	/** the rrset data */
+	struct packed_rrset_data soa_d, nsec_d;
+	/** NSEC rdata */
+	size_t rr_len;
+	/** NSEC ttl */
+	time_t rr_ttl;
+	/** NSEC rdata */
+	uint8_t* rr_data;
+	/** zone name, NSEC owner name and NSEC rdata with the next name */
+	uint8_t zname[32], owner[32], next[32];
+	/** a name below the zone, that the NSEC covers */
+	uint8_t qname[32];
+};
+
+/** structure for the threaded test of the negative cache */
+struct neg_thr {
+	/** thread num */
+	int num;
+	/** number of threads in this run */
+	int numth;
+	/** id */
+	ub_thread_type id;
+	/** the negative cache */
+	struct val_neg_cache* neg;
+	/** the replies, for every zone */
+	struct neg_thr_reply* replies;
+	/** the rrset cache, it is empty */
+	struct rrset_cache* rrset_cache;
+	/** config with aggressive nsec */
+	struct config_file* cfg;
+};
+
+/** setup the reply of a zone for the threaded test */
+static void
+neg_thr_reply_setup(struct neg_thr_reply* r, int i)
+{
+	memset(r, 0, sizeof(*r));
+	snprintf((char*)r->zname, sizeof(r->zname), "\004z%3.3d\007example\003com",
+		i);
+	snprintf((char*)r->owner, sizeof(r->owner), "\001a%s", r->zname);
+	snprintf((char*)r->next+2, sizeof(r->next)-2, "\001m%s", r->zname);
+	snprintf((char*)r->qname, sizeof(r->qname), "\001b%s", r->zname);
+	r->soa.rk.dname = r->zname;
+	r->soa.rk.dname_len = strlen((char*)r->zname)+1;
+	r->soa.rk.type = htons(LDNS_RR_TYPE_SOA);
+	r->soa.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	r->soa.entry.data = &r->soa_d;
+	r->soa_d.security = sec_status_secure;
+	r->nsec.rk.dname = r->owner;
+	r->nsec.rk.dname_len = strlen((char*)r->owner)+1;
+	r->nsec.rk.type = htons(LDNS_RR_TYPE_NSEC);
+	r->nsec.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	r->nsec.entry.data = &r->nsec_d;
+	r->nsec_d.security = sec_status_secure;
+	r->nsec_d.count = 1;
+	r->nsec_d.rr_len = &r->rr_len;
+	r->rr_len = strlen((char*)r->next+2)+1+2;
+	r->next[1] = (uint8_t)(r->rr_len-2);
+	r->nsec_d.rr_ttl = &r->rr_ttl;
+	r->nsec_d.rr_data = &r->rr_data;
+	r->rr_data = r->next;
+	r->rrsets[0] = &r->soa;
+	r->rrsets[1] = &r->nsec;
+	r->rep.ns_numrrsets = 2;
+	r->rep.rrset_count = 2;
+	r->rep.rrsets = r->rrsets;
+	r->rep.security = sec_status_secure;
+}
+
+/** main routine for the threads, they insert the NSECs of their zones
+ * again, like the validator does, and look up names in all zones */
+static void*
+neg_thr_main(void* arg)
+{
+	struct neg_thr* t = (struct neg_thr*)arg;
+	struct regional* region = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	struct query_info qinfo;
+	int i;
+	unit_assert(region && buf);
+	log_thread_set(&t->num);
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	for(i=0; i<NEG_THR_ITER; i++) {
+		struct neg_thr_reply* r;
+		if(i%4 == 0) {
+			r = &t->replies[(t->num + i/4*t->numth)%
+				NEG_THR_ZONES];
+			val_neg_addreply(t->neg, &r->rep);
+			continue;
+		}
+		r = &t->replies[(t->num*3 + i)%NEG_THR_ZONES];
+		qinfo.qname = r->qname;
+		qinfo.qname_len = strlen((char*)r->qname)+1;
+		/* the rrset cache is empty, the lookup stops after the
+		 * negative cache, that is what is timed */
+		(void)val_neg_getmsg(t->neg, &qinfo, region, t->rrset_cache,
+			buf, 0, 1, NULL, t->cfg);
+		regional_free_all(region);
+	}
+	regional_destroy(region);
+	sldns_buffer_free(buf);
+	return NULL;
+}
+
+/** run the threads over the negative cache, returns ops per second */
+static double
+neg_thr_run(struct val_neg_cache* neg, struct neg_thr_reply* replies,
+	struct rrset_cache* rrset_cache, struct config_file* cfg, int numth)
+{
+	struct neg_thr t[NEG_THR_MAX];
+	struct timeval start, end;
+	double dt;
+	int i;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<numth; i++) {
+		t[i].num = i;
+		t[i].numth = numth;
+		t[i].neg = neg;
+		t[i].replies = replies;
+		t[i].rrset_cache = rrset_cache;
+		t[i].cfg = cfg;
+		ub_thread_create(&t[i].id, neg_thr_main, &t[i]);
+	}
+	for(i=0; i<numth; i++) {
+		ub_thread_join(t[i].id);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	/* time in millisec */
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(dt <= 0.)
+		dt = 0.001;
+	return (double)numth*NEG_THR_ITER / (dt/1000.);
+}
+
+/** test the negative cache with an increasing number of threads, and time
+ * it. Lookups and refreshes of NSECs in different zones do not share a
+ * lock. It checks the cache under concurrent use, the printed rates are
+ * for a comparison on a host with several cores */
+static void
+neg_threaded_test(struct val_neg_cache* neg)
+{
+	struct neg_thr_reply* replies;
+	struct rrset_cache* rrset_cache;
+	struct config_file* cfg;
+	double ops, base = 0.;
+	int i, numth;
+
+	replies = (struct neg_thr_reply*)calloc(NEG_THR_ZONES,
+		sizeof(*replies));
+	cfg = config_create();
+	unit_assert(replies && cfg);
+	cfg->aggressive_nsec = 1;
+	rrset_cache = rrset_cache_create(cfg, NULL);
+	unit_assert(rrset_cache);
+	for(i=0; i<NEG_THR_ZONES; i++)
+		neg_thr_reply_setup(&replies[i], i);
+
+	for(numth=1; numth<=NEG_THR_MAX; numth*=2) {
+		ops = neg_thr_run(neg, replies, rrset_cache, cfg, numth);
+		if(numth == 1)
+			base = ops;
+		if(negverbose)
+			printf("neg threaded: %d threads %g ops/sec, "
+				"%.2fx of 1 thread\n", numth, ops, ops/base);
+	}
+
+	/* every zone is in the cache, with its NSEC */
+	check_neg_invariants(neg);
+	for(i=0; i<NEG_THR_ZONES; i++) {
+		struct val_neg_zone* z = neg_find_zone(neg, replies[i].zname,
+			strlen((char*)replies[i].zname)+1, LDNS_RR_CLASS_IN);
+		unit_assert(z && z->in_use);
+		unit_assert(z->tree.count != 0);
+	}
+
+	rrset_cache_delete(rrset_cache);
+	config_delete(cfg);
+	free(replies);
+}
+
 void neg_test(void)
 {
 	struct val_neg_cache* neg;
@@ -542,4 +749,9 @@ void neg_test(void)
 	stress_test(neg);
 
 	neg_cache_delete(neg);
+
+	neg = val_neg_create(NULL, 1500);
+	unit_assert(neg);
+	neg_threaded_test(neg);
+	neg_cache_delete(neg);
 }
@@ -0,0 +1,392 @@
+/*
+ * testcode/unitoutnet.c - unit test for outgoing UDP socket handling.
+ *
+ * Copyright (c) 2024, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * \file
+ * Calls outside network UDP tests, for the connected socket pool, the
+ * send queue and the batched reads and writes of the UDP commpoints.
+ * Uses sockets on the loopback interface.
+ */
+
+#include "config.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/netevent.h"
+#include "util/ub_event.h"
+#include "util/random.h"
+#include "util/config_file.h"
+#include "services/outside_network.h"
+#include "testcode/unitmain.h"
+#include "sldns/sbuffer.h"
+#ifdef HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+
+/** a test upstream server, UDP socket on loopback */
+struct test_server {
+	/** the socket */
+	int s;
+	/** its address */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+};
+
+/** open the test server on a free loopback port */
+static void
+server_open(struct test_server* srv)
+{
+	struct sockaddr_in* sa = (struct sockaddr_in*)&srv->addr;
+	memset(srv, 0, sizeof(*srv));
+	sa->sin_family = AF_INET;
+	sa->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	srv->addrlen = (socklen_t)sizeof(*sa);
+	srv->s = socket(AF_INET, SOCK_DGRAM, 0);
+	unit_assert(srv->s != -1);
+	unit_assert(bind(srv->s, (struct sockaddr*)&srv->addr,
+		srv->addrlen) == 0);
+	unit_assert(getsockname(srv->s, (struct sockaddr*)&srv->addr,
+		&srv->addrlen) == 0);
+}
+
+/** receive a datagram at the server, returns the source port or 0 if
+ * nothing arrives within wait milliseconds */
+static int
+server_recv(struct test_server* srv, int wait)
+{
+	uint8_t buf[512];
+	struct sockaddr_in from;
+	socklen_t fromlen = (socklen_t)sizeof(from);
+	struct timeval tv;
+	fd_set rset;
+	FD_ZERO(&rset);
+	FD_SET(FD_SET_T srv->s, &rset);
+	tv.tv_sec = wait/1000;
+	tv.tv_usec = (wait%1000)*1000;
+	if(select(srv->s+1, &rset, NULL, NULL, &tv) <= 0)
+		return 0;
+	if(recvfrom(srv->s, (void*)buf, sizeof(buf), 0,
+		(struct sockaddr*)&from, &fromlen) == -1)
+		return 0;
+	return (int)ntohs(from.sin_port);
+}
+
+/** local port of the socket used by the pending query */
+static int
+pend_port(struct pending* p)
+{
+	struct sockaddr_in sa;
+	socklen_t len = (socklen_t)sizeof(sa);
+	unit_assert(p && p->pc && p->pc->cp);
+	unit_assert(getsockname(p->pc->cp->fd, (struct sockaddr*)&sa,
+		&len) == 0);
+	return (int)ntohs(sa.sin_port);
+}
+
+/** create the outside network on loopback with the options */
+static struct outside_network*
+test_outnet_create(struct comm_base* base, struct ub_randstate* rnd,
+	int* avail, int numavail, int connect, int batch, int pool, int reuse)
+{
+	char* ifs[1];
+	struct outside_network* outnet;
+	ifs[0] = "127.0.0.1";
+	outnet = outside_network_create(base, 65552, 16, ifs, 1, 1, 0, 0, 0,
+		NULL, rnd, 0, avail, numavail, 0, 0, NULL, NULL, 1, NULL, 0,
+		0, NULL, connect, 0, 0, 0, 0, 0, 0, 0, batch, pool, reuse);
+	unit_assert(outnet);
+	return outnet;
+}
+
+/** send a query to the server, with a long timeout and no callback */
+static struct pending*
+test_query(struct serviced_query* sq, struct test_server* srv,
+	sldns_buffer* pkt)
+{
+	memmove(&sq->addr, &srv->addr, srv->addrlen);
+	sq->addrlen = srv->addrlen;
+	return pending_udp_query(sq, pkt, 100000, NULL, NULL);
+}
+
+/** test that pooled sockets are only handed out when idle, and are
+ * reconnected to the new destination */
+static void
+conn_pool_test(struct comm_base* base, struct ub_randstate* rnd,
+	int* avail, int numavail, sldns_buffer* pkt)
+{
+	struct outside_network* outnet;
+	struct serviced_query sq;
+	struct test_server a, b;
+	struct pending* p1, *p2, *p3, *p4;
+	int port1, port2;
+	unit_show_func("services/outside_network.c", "udp_conn_take");
+	server_open(&a);
+	server_open(&b);
+	outnet = test_outnet_create(base, rnd, avail, numavail, 1, 0, 4, 3);
+	memset(&sq, 0, sizeof(sq));
+	sq.outnet = outnet;
+
+	/* a socket with a query outstanding is not shared */
+	p1 = test_query(&sq, &a, pkt);
+	unit_assert(p1);
+	port1 = pend_port(p1);
+	unit_assert(server_recv(&a, 1000) == port1);
+	p2 = test_query(&sq, &a, pkt);
+	unit_assert(p2);
+	port2 = pend_port(p2);
+	unit_assert(p2->pc != p1->pc);
+	unit_assert(server_recv(&a, 1000) == port2);
+	unit_assert(outnet->udp_idle_num == 0);
+
+	/* the answered socket becomes idle, and is reconnected to the
+	 * other server for the next query */
+	pending_udp_timer_cb(p1);
+	unit_assert(outnet->udp_idle_num == 1);
+	p3 = test_query(&sq, &b, pkt);
+	unit_assert(p3);
+	unit_assert(outnet->udp_idle_num == 0);
+	unit_assert(pend_port(p3) == port1);
+	unit_assert(server_recv(&b, 1000) == port1);
+	unit_assert(server_recv(&a, 10) == 0);
+	unit_assert(p3->pc->num_queries == 2);
+
+	/* the last query of the reuse limit closes the socket */
+	pending_udp_timer_cb(p3);
+	unit_assert(outnet->udp_idle_num == 1);
+	p4 = test_query(&sq, &a, pkt);
+	unit_assert(p4);
+	unit_assert(pend_port(p4) == port1);
+	unit_assert(server_recv(&a, 1000) == port1);
+	unit_assert(p4->pc->num_queries == 3);
+	pending_udp_timer_cb(p4);
+	unit_assert(outnet->udp_idle_num == 0);
+	pending_udp_timer_cb(p2);
+	unit_assert(outnet->udp_idle_num == 1);
+	unit_assert(outnet->udp_idle[0]->num_outstanding == 0);
+
+	outside_network_delete(outnet);
+	close(a.s);
+	close(b.s);
+}
+
+/** test that queries wait on the send queue until it is full or the
+ * timer flushes it */
+static void
+send_queue_test(struct comm_base* base, struct ub_randstate* rnd,
+	int* avail, int numavail, sldns_buffer* pkt)
+{
+	struct outside_network* outnet;
+	struct serviced_query sq;
+	struct test_server a;
+	struct pending* p[5];
+	int i;
+	unit_show_func("services/outside_network.c", "udp_send_flush");
+	server_open(&a);
+	outnet = test_outnet_create(base, rnd, avail, numavail, 1, 3, 0, 0);
+	memset(&sq, 0, sizeof(sq));
+	sq.outnet = outnet;
+
+	/* nothing is sent before the batch is full */
+	p[0] = test_query(&sq, &a, pkt);
+	p[1] = test_query(&sq, &a, pkt);
+	unit_assert(p[0] && p[1]);
+	unit_assert(p[0]->on_send_queue && p[1]->on_send_queue);
+	unit_assert(outnet->udp_send_num == 2);
+	unit_assert(server_recv(&a, 10) == 0);
+
+	/* the third query fills the batch and sends all three */
+	p[2] = test_query(&sq, &a, pkt);
+	unit_assert(p[2]);
+	unit_assert(outnet->udp_send_num == 0);
+	for(i=0; i<3; i++) {
+		unit_assert(!p[i]->on_send_queue && p[i]->pkt == NULL);
+		unit_assert(server_recv(&a, 1000) == pend_port(p[i]));
+	}
+	unit_assert(server_recv(&a, 10) == 0);
+
+	/* a short queue is sent by the timer */
+	p[3] = test_query(&sq, &a, pkt);
+	unit_assert(p[3] && p[3]->on_send_queue);
+	outnet_udp_send_timer_cb(outnet);
+	unit_assert(outnet->udp_send_num == 0 && !p[3]->on_send_queue);
+	unit_assert(server_recv(&a, 1000) == pend_port(p[3]));
+
+	/* a query that is removed is taken off the queue, unsent */
+	p[4] = test_query(&sq, &a, pkt);
+	unit_assert(p[4] && p[4]->on_send_queue);
+	pending_udp_timer_cb(p[4]);
+	unit_assert(outnet->udp_send_num == 0);
+	unit_assert(outnet->udp_send_first == NULL &&
+		outnet->udp_send_last == NULL);
+	outnet_udp_send_timer_cb(outnet);
+	unit_assert(server_recv(&a, 10) == 0);
+
+	for(i=0; i<4; i++)
+		pending_udp_timer_cb(p[i]);
+	unit_assert(outnet->pending->count == 0);
+
+	outside_network_delete(outnet);
+	close(a.s);
+}
+
+/** send a reply with the id from the server to the loopback port */
+static void
+server_reply(struct test_server* srv, int port, uint16_t id)
+{
+	/* reply header and the root name, class and type */
+	uint8_t r[] = {0, 0, 0x81, 0x80, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1};
+	struct sockaddr_in to;
+	memset(&to, 0, sizeof(to));
+	to.sin_family = AF_INET;
+	to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	to.sin_port = htons((uint16_t)port);
+	r[0] = (uint8_t)(id>>8);
+	r[1] = (uint8_t)(id&0xff);
+	unit_assert(sendto(srv->s, (void*)r, sizeof(r), 0,
+		(struct sockaddr*)&to, (socklen_t)sizeof(to)) ==
+		(ssize_t)sizeof(r));
+}
+
+/** test that a sendmmsg that stops at a failed datagram continues with
+ * the rest, and that a recvmmsg batch with datagrams from different
+ * sources is matched per datagram */
+static void
+udp_batch_test(struct comm_base* base, struct ub_randstate* rnd,
+	int* avail, int numavail, sldns_buffer* pkt)
+{
+	struct outside_network* outnet;
+	struct serviced_query sq;
+	struct test_server a, b;
+	struct pending* p;
+	struct comm_udp_msg msgs[3];
+	struct sockaddr_storage bad;
+	struct comm_udp_batch_stats* st = comm_base_udp_batch_stats(base);
+	struct comm_udp_batch_stats old;
+	int port, fd;
+	unit_show_func("util/netevent.c", "comm_point_udp_batch_callback");
+	server_open(&a);
+	server_open(&b);
+	comm_base_set_udp_batch(base, 32);
+	/* unconnected, so that the socket receives from every source */
+	outnet = test_outnet_create(base, rnd, avail, numavail, 0, 0, 0, 0);
+	memset(&sq, 0, sizeof(sq));
+	sq.outnet = outnet;
+	p = test_query(&sq, &a, pkt);
+	unit_assert(p);
+	port = pend_port(p);
+	fd = p->pc->cp->fd;
+	unit_assert(server_recv(&a, 1000) == port);
+
+	/* the datagram to port 0 fails in the middle of the batch, the
+	 * ones before and after it are sent */
+	memmove(&bad, &a.addr, a.addrlen);
+	((struct sockaddr_in*)&bad)->sin_port = 0;
+	memset(msgs, 0, sizeof(msgs));
+	msgs[0].addr = &a.addr;
+	msgs[0].addrlen = a.addrlen;
+	msgs[1].addr = &bad;
+	msgs[1].addrlen = a.addrlen;
+	msgs[2].addr = &b.addr;
+	msgs[2].addrlen = b.addrlen;
+	msgs[0].data = msgs[1].data = msgs[2].data = sldns_buffer_begin(pkt);
+	msgs[0].len = msgs[1].len = msgs[2].len = sldns_buffer_limit(pkt);
+	old = *st;
+	unit_assert(comm_point_send_udp_msgs(p->pc->cp, msgs, 3, 0) == 2);
+	unit_assert(msgs[0].sent && !msgs[1].sent && msgs[2].sent);
+	unit_assert(server_recv(&a, 1000) == port);
+	unit_assert(server_recv(&b, 1000) == port);
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+	unit_assert(st->out_calls == old.out_calls+2);
+	unit_assert(st->out_pkts == old.out_pkts+2);
+#endif
+
+	/* one batch with a reply from the wrong source, a reply with the
+	 * wrong id, the answer, and a datagram after the answer, when the
+	 * answered socket is already closed */
+	server_reply(&b, port, (uint16_t)p->id);
+	server_reply(&a, port, (uint16_t)(p->id^1));
+	server_reply(&a, port, (uint16_t)p->id);
+	server_reply(&b, port, (uint16_t)p->id);
+	old = *st;
+	comm_point_udp_callback(fd, UB_EV_READ, p->pc->cp);
+	unit_assert(outnet->pending->count == 0);
+	unit_assert(outnet->unwanted_replies == 2);
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG)
+	unit_assert(st->recv_calls == old.recv_calls+1);
+	unit_assert(st->recv_pkts == old.recv_pkts+4);
+	unit_assert(st->send_calls == old.send_calls);
+#endif
+
+	outside_network_delete(outnet);
+	comm_base_set_udp_batch(base, 0);
+	close(a.s);
+	close(b.s);
+}
+
+void
+outnet_test(void)
+{
+	struct config_file* cfg;
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	sldns_buffer* pkt;
+	int* avail = NULL;
+	int numavail;
+	/* query header and the root name, class and type */
+	uint8_t q[] = {0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1};
+	unit_show_feature("outside network udp");
+	cfg = config_create();
+	unit_assert(cfg);
+	numavail = cfg_condense_ports(cfg, &avail);
+	unit_assert(numavail > 0 && avail);
+	base = comm_base_create(0);
+	unit_assert(base);
+	rnd = ub_initstate(NULL);
+	unit_assert(rnd);
+	pkt = sldns_buffer_new(sizeof(q));
+	unit_assert(pkt);
+	sldns_buffer_write(pkt, q, sizeof(q));
+	sldns_buffer_flip(pkt);
+
+	conn_pool_test(base, rnd, avail, numavail, pkt);
+	send_queue_test(base, rnd, avail, numavail, pkt);
+	udp_batch_test(base, rnd, avail, numavail, pkt);
+
+	sldns_buffer_free(pkt);
+	ub_randfree(rnd);
+	comm_base_delete(base);
+	free(avail);
+	config_delete(cfg);
+}
@@ -0,0 +1,256 @@
+/*
+ * testcode/unitsnapshot.c - unit test for the cache snapshot.
+ *
+ * Copyright (c) 2024, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * \file
+ * Calls the cache snapshot tests. The message, rrset and infra caches are
+ * written to a file and read back, and truncated and corrupt files are
+ * read.
+ */
+
+#include "config.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/regional.h"
+#include "util/module.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/snapshot.h"
+#include "services/cache/dns.h"
+#include "services/cache/rrset.h"
+#include "services/cache/infra.h"
+#include "testcode/unitmain.h"
+#include "sldns/sbuffer.h"
+
+/** create the caches for the snapshot test */
+static void
+snapshot_env_create(struct module_env* env, struct config_file* cfg,
+	struct alloc_cache* alloc, time_t* now)
+{
+	memset(env, 0, sizeof(*env));
+	env->cfg = cfg;
+	env->now = now;
+	env->alloc = alloc;
+	env->rrset_cache = rrset_cache_create(cfg, alloc);
+	env->msg_cache = slabhash_create(cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
+		msgreply_sizefunc, query_info_compare, query_entry_delete,
+		reply_info_delete, NULL);
+	env->infra_cache = infra_create(cfg);
+	env->scratch = regional_create();
+	unit_assert(env->rrset_cache && env->msg_cache && env->infra_cache &&
+		env->scratch);
+}
+
+/** delete the caches of the snapshot test */
+static void
+snapshot_env_delete(struct module_env* env)
+{
+	slabhash_delete(env->msg_cache);
+	rrset_cache_delete(env->rrset_cache);
+	infra_delete(env->infra_cache);
+	regional_destroy(env->scratch);
+}
+
+/** write the bytes to the file */
+static void
+snapshot_file_write(const char* fname, uint8_t* data, size_t len)
+{
+	FILE* out = fopen(fname, "wb");
+	unit_assert(out);
+	if(len != 0)
+		unit_assert(fwrite(data, 1, len, out) == len);
+	unit_assert(fclose(out) == 0);
+}
+
+/** read the file into a malloced buffer */
+static uint8_t*
+snapshot_file_read(const char* fname, size_t* len)
+{
+	uint8_t* buf;
+	long sz;
+	FILE* in = fopen(fname, "rb");
+	unit_assert(in);
+	unit_assert(fseek(in, 0, SEEK_END) == 0);
+	sz = ftell(in);
+	unit_assert(sz > 0);
+	unit_assert(fseek(in, 0, SEEK_SET) == 0);
+	buf = (uint8_t*)malloc((size_t)sz);
+	unit_assert(buf);
+	unit_assert(fread(buf, 1, (size_t)sz, in) == (size_t)sz);
+	fclose(in);
+	*len = (size_t)sz;
+	return buf;
+}
+
+void
+snapshot_test(void)
+{
+	/* reply for www.example.com A with an NS rrset in authority */
+	uint8_t pkt[] = {0x12, 0x34, 0x85, 0x80, 0, 1, 0, 1, 0, 1, 0, 0,
+		3, 'w', 'w', 'w', 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+		3, 'c', 'o', 'm', 0, 0, 1, 0, 1,
+		3, 'w', 'w', 'w', 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+		3, 'c', 'o', 'm', 0, 0, 1, 0, 1, 0, 0, 0x0e, 0x10, 0, 4,
+		10, 20, 30, 40,
+		7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 3, 'c', 'o', 'm', 0,
+		0, 2, 0, 1, 0, 0, 0x0e, 0x10, 0, 16,
+		2, 'n', 's', 7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+		3, 'c', 'o', 'm', 0};
+	uint8_t* zone = (uint8_t*)"\007example\003com\000";
+	size_t zonelen = 13;
+	struct config_file* cfg = config_create();
+	struct alloc_cache alloc;
+	struct module_env env, env2;
+	struct query_info qinfo;
+	struct reply_info* rep;
+	struct edns_data edns;
+	struct dns_msg* msg;
+	struct packed_rrset_data* d;
+	struct sockaddr_storage addr;
+	struct lruhash_entry* e;
+	socklen_t addrlen;
+	sldns_buffer* buf;
+	struct regional* region;
+	char fname[256], cutf[256];
+	uint8_t* file, edns_lame;
+	size_t len, i;
+	time_t now = 1000;
+	int vs, to, to2;
+	FILE* devnull;
+
+	unit_show_feature("cache snapshot");
+	unit_assert(cfg);
+	snprintf(fname, sizeof(fname), "/tmp/unbound.unittest.snap.%u",
+		(unsigned)getpid());
+	snprintf(cutf, sizeof(cutf), "/tmp/unbound.unittest.snapcut.%u",
+		(unsigned)getpid());
+	alloc_init(&alloc, NULL, 0);
+	region = regional_create();
+	buf = sldns_buffer_new(sizeof(pkt));
+	unit_assert(region && buf);
+	sldns_buffer_write(buf, pkt, sizeof(pkt));
+	sldns_buffer_flip(buf);
+	unit_assert(ipstrtoaddr("127.0.0.1", 53, &addr, &addrlen));
+
+	/* fill the caches and write them */
+	snapshot_env_create(&env, cfg, &alloc, &now);
+	memset(&edns, 0, sizeof(edns));
+	unit_assert(reply_info_parse(buf, &alloc, &qinfo, &rep, region,
+		&edns) == 0);
+	unit_assert(dns_cache_store(&env, &qinfo, rep, 0, 0, 0, region, 0));
+	reply_info_parsedelete(rep, &alloc);
+	unit_assert(infra_rtt_update(env.infra_cache, &addr, addrlen, zone,
+		zonelen, LDNS_RR_TYPE_A, 100, -1, now));
+	unit_assert(infra_host(env.infra_cache, &addr, addrlen, zone,
+		zonelen, now, &vs, &edns_lame, &to));
+	unit_assert(cache_snapshot_write(&env, fname, now));
+	snapshot_env_delete(&env);
+
+	/* read it back, later, and the entries are there with less TTL */
+	now += 100;
+	snapshot_env_create(&env2, cfg, &alloc, &now);
+	unit_assert(cache_snapshot_read(&env2, &alloc, fname, now));
+	msg = dns_cache_lookup(&env2, qinfo.qname, qinfo.qname_len,
+		qinfo.qtype, qinfo.qclass, 0, region, env2.scratch, 0, NULL, 0);
+	unit_assert(msg);
+	unit_assert(msg->rep->an_numrrsets == 1 &&
+		msg->rep->ns_numrrsets == 1 && msg->rep->ttl == 3500);
+	d = (struct packed_rrset_data*)msg->rep->rrsets[0]->entry.data;
+	unit_assert(d->count == 1 && d->rr_len[0] == 6 &&
+		memcmp(d->rr_data[0]+2, "\012\024\036\050", 4) == 0);
+	e = infra_lookup_nottl(env2.infra_cache, &addr, addrlen, zone,
+		zonelen, 0);
+	unit_assert(e);
+	lock_rw_unlock(&e->lock);
+	unit_assert(infra_host(env2.infra_cache, &addr, addrlen, zone,
+		zonelen, now, &vs, &edns_lame, &to2));
+	unit_assert(to2 == to);
+	snapshot_env_delete(&env2);
+
+	/* entries that expired meanwhile are skipped */
+	now += 3600 + cfg->host_ttl;
+	snapshot_env_create(&env2, cfg, &alloc, &now);
+	unit_assert(cache_snapshot_read(&env2, &alloc, fname, now));
+	unit_assert(!dns_cache_lookup(&env2, qinfo.qname, qinfo.qname_len,
+		qinfo.qtype, qinfo.qclass, 0, region, env2.scratch, 0, NULL,
+		0));
+	unit_assert(!infra_lookup_nottl(env2.infra_cache, &addr, addrlen,
+		zone, zonelen, 0));
+	snapshot_env_delete(&env2);
+	now -= 3600 + cfg->host_ttl;
+
+	/* a missing file is not a failure */
+	snapshot_env_create(&env2, cfg, &alloc, &now);
+	unit_assert(cache_snapshot_read(&env2, &alloc, cutf, now));
+
+	/* the failures are logged, keep that out of the test output */
+	devnull = fopen("/dev/null", "w");
+	if(devnull)
+		log_file(devnull);
+	file = snapshot_file_read(fname, &len);
+	/* every truncated file fails, without the end record */
+	for(i=0; i<len; i++) {
+		snapshot_file_write(cutf, file, i);
+		unit_assert(!cache_snapshot_read(&env2, &alloc, cutf, now));
+	}
+	/* a corrupt file is rejected or read, but never read out of
+	 * bounds; a bad magic string is always rejected */
+	for(i=0; i<len; i++) {
+		file[i] ^= 0xff;
+		snapshot_file_write(cutf, file, len);
+		if(i < 8)
+			unit_assert(!cache_snapshot_read(&env2, &alloc, cutf,
+				now));
+		else	(void)cache_snapshot_read(&env2, &alloc, cutf, now);
+		file[i] ^= 0xff;
+	}
+	log_file(stderr);
+	if(devnull)
+		fclose(devnull);
+	free(file);
+	snapshot_env_delete(&env2);
+
+	unlink(fname);
+	unlink(cutf);
+	query_info_clear(&qinfo);
+	sldns_buffer_free(buf);
+	regional_destroy(region);
+	alloc_clear(&alloc);
+	config_delete(cfg);
+}
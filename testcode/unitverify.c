@@ -60,6 +60,15 @@
 #include "sldns/keyraw.h"
 #include "sldns/str2wire.h"
 #include "sldns/wire2str.h"
+#ifndef THREADS_DISABLED
+#include "validator/val_pool.h"
+#include "validator/val_kentry.h"
+#include "util/netevent.h"
+#include "util/locks.h"
+#ifdef HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif
+#endif /* THREADS_DISABLED */
 
 /** verbose signature test */
 static int vsig = 0;
@@ -497,6 +506,184 @@ nsec3_hash_test(const char* fname)
 	sldns_buffer_free(buf);
 }
 
+#ifndef THREADS_DISABLED
+/** make an rrset with one rdata for the val pool test */
+static struct ub_packed_rrset_key* valpool_rrset(struct regional* region,
+	uint16_t type, uint8_t* rdata, size_t rdlen)
+{
+	uint8_t name[] = "\007example\003com";
+	struct ub_packed_rrset_key* k = regional_alloc_zero(region,
+		sizeof(*k));
+	struct packed_rrset_data* d = regional_alloc_zero(region,
+		sizeof(*d) + sizeof(size_t) + sizeof(uint8_t*) +
+		sizeof(time_t) + rdlen);
+	unit_assert(k && d);
+	k->rk.dname = regional_alloc_init(region, name, sizeof(name));
+	unit_assert(k->rk.dname);
+	k->rk.dname_len = sizeof(name);
+	k->rk.type = htons(type);
+	k->rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	k->entry.key = k;
+	k->entry.data = d;
+	d->ttl = 3600;
+	d->count = 1;
+	d->trust = rrset_trust_ans_noAA;
+	d->security = sec_status_unchecked;
+	packed_rrset_ptr_fixup(d);
+	d->rr_len[0] = rdlen;
+	packed_rrset_ptr_fixup(d);
+	d->rr_ttl[0] = 3600;
+	memmove(d->rr_data[0], rdata, rdlen);
+	return k;
+}
+
+/** make and submit a job for the val pool test */
+static struct val_pool_job* valpool_job(struct val_pool_conn* conn,
+	struct module_qstate* qstate, struct val_env* ve,
+	struct key_entry_key* kkey, struct ub_packed_rrset_key* r1,
+	int required, struct ub_packed_rrset_key* r2)
+{
+	struct val_pool_job* job = val_pool_job_create(conn, qstate, ve,
+		kkey, 2);
+	unit_assert(job);
+	unit_assert(val_pool_job_add(job, r1, LDNS_SECTION_ANSWER,
+		required));
+	if(r2)
+		unit_assert(val_pool_job_add(job, r2, LDNS_SECTION_ANSWER,
+			0));
+	unit_assert(val_pool_job_submit(job));
+	return job;
+}
+
+/** wait until the verify thread has done the job */
+static void valpool_wait(struct val_pool* pool, struct val_pool_job* job)
+{
+	int i, done = 0;
+	for(i=0; i<10000 && !done; i++) {
+		struct timeval tv;
+		lock_basic_lock(&pool->lock);
+		done = (job->state == val_pool_job_done);
+		lock_basic_unlock(&pool->lock);
+		if(done)
+			break;
+		tv.tv_sec = 0;
+		tv.tv_usec = 1000;
+		(void)select(0, NULL, NULL, NULL, &tv);
+	}
+	unit_assert(done);
+}
+
+/** test the cancel and resume of the signature verify jobs */
+static void val_pool_test(void)
+{
+	/* rdata with the rdlength in front */
+	uint8_t ip4[] = {0, 4, 192, 0, 2, 1};
+	uint8_t ip6[] = {0, 16, 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1};
+	uint8_t key[] = {0, 8, 1, 1, 3, 8, 3, 1, 0, 1};
+	uint8_t zone[] = "\007example\003com";
+	struct config_file* cfg;
+	struct comm_base* base;
+	struct regional* region;
+	struct val_pool* pool;
+	struct val_pool_conn* conn;
+	struct module_env env;
+	struct module_qstate qstate;
+	struct val_env ve;
+	struct key_entry_key* kkey;
+	struct ub_packed_rrset_key* a, *aaaa, *dnskey;
+	struct val_pool_job* j1, *j2, *j3, *j4, *j5;
+	enum sec_status sec;
+	char* reason = NULL;
+	time_t now = 1000;
+	unit_show_func("validator/val_pool.c", "val_pool_job_delete");
+	cfg = config_create();
+	unit_assert(cfg);
+	base = comm_base_create(0);
+	unit_assert(base);
+	region = regional_create();
+	unit_assert(region);
+	pool = val_pool_create(cfg, 1, 0);
+	unit_assert(pool);
+	conn = val_pool_conn_create(pool, base);
+	unit_assert(conn);
+	memset(&env, 0, sizeof(env));
+	env.cfg = cfg;
+	env.now = &now;
+	memset(&qstate, 0, sizeof(qstate));
+	qstate.env = &env;
+	memset(&ve, 0, sizeof(ve));
+	a = valpool_rrset(region, LDNS_RR_TYPE_A, ip4, sizeof(ip4));
+	aaaa = valpool_rrset(region, LDNS_RR_TYPE_AAAA, ip6, sizeof(ip6));
+	dnskey = valpool_rrset(region, LDNS_RR_TYPE_DNSKEY, key, sizeof(key));
+	kkey = key_entry_create_rrset(region, zone, sizeof(zone),
+		LDNS_RR_CLASS_IN, dnskey, NULL, now);
+	unit_assert(kkey);
+
+	/* keep the verify thread from taking jobs off the queue */
+	lock_basic_lock(&pool->read_lock);
+	/* a queued job that is deleted is taken out of the queue */
+	j1 = valpool_job(conn, &qstate, &ve, kkey, a, 0, NULL);
+	j2 = valpool_job(conn, &qstate, &ve, kkey, a, 0, NULL);
+	unit_assert(pool->queue_num == 2 && j1->state == val_pool_job_queued);
+	val_pool_job_delete(j1);
+	unit_assert(pool->queue_num == 1 && pool->queue_first == j2 &&
+		pool->queue_last == j2 && j2->prev == NULL);
+
+	/* a job that is deleted while it is verified is cancelled, and the
+	 * verify thread deletes it; the test takes the place of the thread */
+	lock_basic_lock(&pool->lock);
+	pool->queue_first = pool->queue_last = NULL;
+	pool->queue_num = 0;
+	j2->state = val_pool_job_running;
+	lock_basic_unlock(&pool->lock);
+	val_pool_job_delete(j2);
+	unit_assert(j2->cancelled);
+	regional_destroy(j2->region);
+	free(j2);
+
+	/* the verified jobs wait in the done list, a deleted job is taken
+	 * out of it.  The tube still has the wakeups of the deleted jobs,
+	 * the thread finds no job for them. */
+	j3 = valpool_job(conn, &qstate, &ve, kkey, a, 0, aaaa);
+	j4 = valpool_job(conn, &qstate, &ve, kkey, aaaa, 0, NULL);
+	j5 = valpool_job(conn, &qstate, &ve, kkey, a, 1, aaaa);
+	lock_basic_unlock(&pool->read_lock);
+	valpool_wait(pool, j5);
+	unit_assert(conn->done_first == j3 && conn->done_last == j5);
+	unit_assert(j3->next == j4 && j4->next == j5);
+	val_pool_job_delete(j4);
+	unit_assert(conn->done_first == j3 && conn->done_last == j5);
+	unit_assert(j3->next == j5 && j5->prev == j3);
+
+	/* the query thread takes the jobs in order, and resumes with the
+	 * results */
+	unit_assert(!val_pool_job_is_done(j3));
+	unit_assert(val_pool_conn_take(conn) == j3);
+	unit_assert(val_pool_job_is_done(j3));
+	unit_assert(j3->num_done == 2);
+	unit_assert(val_pool_job_result(j3, a, &sec, &reason));
+	unit_assert(sec == sec_status_bogus && reason);
+	unit_assert(val_pool_job_result(j3, aaaa, &sec, &reason));
+	unit_assert(!val_pool_job_result(j3, dnskey, &sec, &reason));
+	/* the job stops at the required rrset that failed */
+	unit_assert(val_pool_conn_take(conn) == j5);
+	unit_assert(j5->num_done == 1);
+	unit_assert(val_pool_job_result(j5, a, &sec, &reason));
+	unit_assert(!val_pool_job_result(j5, aaaa, &sec, &reason));
+	unit_assert(val_pool_conn_take(conn) == NULL);
+	unit_assert(conn->done_first == NULL && conn->done_last == NULL);
+	val_pool_job_delete(j3);
+	val_pool_job_delete(j5);
+
+	val_pool_conn_delete(conn);
+	val_pool_delete(pool);
+	regional_destroy(region);
+	comm_base_delete(base);
+	config_delete(cfg);
+}
+#endif /* THREADS_DISABLED */
+
 #define xstr(s) str(s)
 #define str(s) #s
 
@@ -563,4 +750,7 @@ verify_test(void)
 #endif
 	nsectest();
 	nsec3_hash_test(SRCDIRSTR "/testdata/test_nsec3_hash.1");
+#ifndef THREADS_DISABLED
+	val_pool_test();
+#endif
 }
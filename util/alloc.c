@@ -75,6 +75,7 @@ prealloc_setup(struct alloc_cache* alloc)
 			return;
 		}
 		alloc_setup_special(p);
+		p->entry.node = (uint8_t)alloc->node;
 		alloc_set_special_next(p, alloc->quar);
 		alloc->quar = p;
 		alloc->num_quar++;
@@ -245,6 +246,7 @@ alloc_special_obtain(struct alloc_cache* alloc)
 		return NULL;
 	}
 	alloc_setup_special(p);
+	p->entry.node = (uint8_t)alloc->node;
 	p->id = alloc_get_id(alloc);
 	return p;
 }
@@ -281,6 +283,19 @@ alloc_special_release(struct alloc_cache* alloc, alloc_special_type* mem)
 	log_assert(alloc);
 	if(!mem)
 		return;
+	if(alloc->node_supers && (int)mem->entry.node < alloc->num_nodes &&
+		&alloc->node_supers[mem->entry.node] != alloc->super &&
+		&alloc->node_supers[mem->entry.node] != alloc) {
+		/* give it back to its node, so it is reused there */
+		struct alloc_cache* home = &alloc->node_supers[mem->entry.node];
+		alloc_special_clean(mem);
+		lock_quick_lock(&home->lock);
+		alloc_set_special_next(mem, home->quar);
+		home->quar = mem;
+		home->num_quar++;
+		lock_quick_unlock(&home->lock);
+		return;
+	}
 	if(!alloc->super) { 
 		lock_quick_lock(&alloc->lock); /* superalloc needs locking */
 	}
@@ -361,6 +376,15 @@ alloc_set_id_cleanup(struct alloc_cache* alloc, void (*cleanup)(void*),
 	alloc->cleanup_arg = arg;
 }
 
+void
+alloc_set_node(struct alloc_cache* alloc, int node,
+	struct alloc_cache* node_supers, int num_nodes)
+{
+	alloc->node = node;
+	alloc->node_supers = node_supers;
+	alloc->num_nodes = num_nodes;
+}
+
 /** global debug value to keep track of total memory mallocs */
 size_t unbound_mem_alloc = 0;
 /** global debug value to keep track of total memory frees */
@@ -95,6 +95,14 @@ struct alloc_cache {
 	size_t num_reg_blocks;
 	/** linked list of regional blocks, using regional->next */
 	struct regional* reg_list;
+
+	/** the NUMA node of the thread, the items in quar are of it */
+	int node;
+	/** the top allocs of the NUMA nodes, array of num_nodes, or NULL.
+	 * Items of another node are released to the one of their node. */
+	struct alloc_cache* node_supers;
+	/** number of NUMA nodes in node_supers */
+	int num_nodes;
 };
 
 /**
@@ -184,6 +192,19 @@ void alloc_reg_release(struct alloc_cache* alloc, struct regional* r);
 void alloc_set_id_cleanup(struct alloc_cache* alloc, void (*cleanup)(void*),
 	void* arg);
 
+/**
+ * Set the NUMA node of the alloc.  The new items are of that node, and
+ * released items of other nodes are given back to their node.
+ * Call it before the alloc is used.
+ * @param alloc: the alloc, its super should be node_supers[node], or
+ *	a top alloc that gives all items back to their node.
+ * @param node: the NUMA node of the thread of the alloc.
+ * @param node_supers: the top allocs of the nodes, array of num_nodes.
+ * @param num_nodes: number of nodes.
+ */
+void alloc_set_node(struct alloc_cache* alloc, int node,
+	struct alloc_cache* node_supers, int num_nodes);
+
 #ifdef UNBOUND_ALLOC_LITE
 #  include <sldns/ldns.h>
 #  include <sldns/packet.h>
@@ -108,6 +108,7 @@ config_create(void)
 	cfg->tcp_reuse_timeout = 60 * 1000; /* 60s in milisecs */
 	cfg->max_reuse_tcp_queries = 200;
 	cfg->tcp_upstream = 0;
+	cfg->tcp_upstream_pool = 0;
 	cfg->udp_upstream_without_downstream = 0;
 	cfg->tcp_mss = 0;
 	cfg->outgoing_tcp_mss = 0;
@@ -122,6 +123,9 @@ config_create(void)
 	cfg->tls_cert_bundle = NULL;
 	cfg->tls_win_cert = 0;
 	cfg->tls_use_sni = 1;
+	cfg->tls_upstream_resume = 1;
+	cfg->tls_upstream_early_data = 0;
+	cfg->tls_use_ktls = 0;
 	cfg->https_port = UNBOUND_DNS_OVER_HTTPS_PORT;
 	if(!(cfg->http_endpoint = strdup("/dns-query"))) goto error_exit;
 	cfg->http_max_streams = 100;
@@ -159,6 +163,7 @@ config_create(void)
 	cfg->msg_buffer_size = 65552; /* 64 k + a small margin */
 	cfg->msg_cache_size = 4 * 1024 * 1024;
 	cfg->msg_cache_slabs = 4;
+	cfg->msg_cache_wire_image = 0;
 	cfg->jostle_time = 200;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
@@ -169,13 +174,23 @@ config_create(void)
 	cfg->max_negative_ttl = 3600;
 	cfg->prefetch = 0;
 	cfg->prefetch_key = 0;
+	cfg->shared_inflight = 0;
 	cfg->deny_any = 0;
 	cfg->infra_cache_slabs = 4;
 	cfg->infra_cache_numhosts = 10000;
 	cfg->infra_cache_min_rtt = 50;
 	cfg->infra_keep_probing = 0;
+	cfg->infra_select_percentile = 0;
+	cfg->udp_hedge = 0;
+	cfg->udp_hedge_percentile = 95;
+	cfg->udp_hedge_max_rate = 5;
 	cfg->delay_close = 0;
 	cfg->udp_connect = 1;
+	cfg->udp_batch_size = 32;
+	cfg->udp_upstream_batch = 0;
+	cfg->udp_connect_pool = 0;
+	cfg->udp_connect_reuse = 8;
+	cfg->use_io_uring = 0;
 	if(!(cfg->outgoing_avail_ports = (int*)calloc(65536, sizeof(int))))
 		goto error_exit;
 	init_outgoing_availports(cfg->outgoing_avail_ports, 65536);
@@ -187,6 +202,10 @@ config_create(void)
 	if(!(cfg->logfile = strdup(""))) goto error_exit;
 	if(!(cfg->pidfile = strdup(PIDFILE))) goto error_exit;
 	if(!(cfg->target_fetch_policy = strdup("3 2 1 0 0"))) goto error_exit;
+	if(!(cfg->msg_cache_policy = strdup("lru"))) goto error_exit;
+	if(!(cfg->rrset_cache_policy = strdup("lru"))) goto error_exit;
+	if(!(cfg->infra_cache_policy = strdup("lru"))) goto error_exit;
+	if(!(cfg->key_cache_policy = strdup("lru"))) goto error_exit;
 	cfg->fast_server_permil = 0;
 	cfg->fast_server_num = 3;
 	cfg->donotqueryaddrs = NULL;
@@ -198,6 +217,8 @@ config_create(void)
 	cfg->so_rcvbuf = 0;
 	cfg->so_sndbuf = 0;
 	cfg->so_reuseport = REUSEPORT_DEFAULT;
+	cfg->worker_cpu_affinity = 0;
+	cfg->numa_aware = 0;
 	cfg->ip_transparent = 0;
 	cfg->ip_freebind = 0;
 	cfg->ip_dscp = 0;
@@ -256,6 +277,7 @@ config_create(void)
 	cfg->val_clean_additional = 1;
 	cfg->val_log_level = 0;
 	cfg->val_log_squelch = 0;
+	cfg->val_verify_threads = 0;
 	cfg->val_permissive_mode = 0;
 	cfg->aggressive_nsec = 0;
 	cfg->ignore_cd = 0;
@@ -364,6 +386,7 @@ config_create(void)
 	cfg->redis_server_port = 6379;
 	cfg->redis_expire_records = 0;
 #endif  /* USE_REDIS */
+	cfg->redis_async = 0;
 #endif  /* USE_CACHEDB */
 #ifdef USE_IPSET
 	cfg->ipset_name_v4 = NULL;
@@ -516,6 +539,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("prefer-ip4:", prefer_ip4)
 	else S_YNO("prefer-ip6:", prefer_ip6)
 	else S_YNO("tcp-upstream:", tcp_upstream)
+	else S_YNO("tcp-upstream-pool:", tcp_upstream_pool)
 	else S_YNO("udp-upstream-without-downstream:",
 		udp_upstream_without_downstream)
 	else S_NUMBER_NONZERO("tcp-mss:", tcp_mss)
@@ -539,6 +563,9 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STR("tls-ciphers:", tls_ciphers)
 	else S_STR("tls-ciphersuites:", tls_ciphersuites)
 	else S_YNO("tls-use-sni:", tls_use_sni)
+	else S_YNO("tls-upstream-resume:", tls_upstream_resume)
+	else S_YNO("tls-upstream-early-data:", tls_upstream_early_data)
+	else S_YNO("tls-use-ktls:", tls_use_ktls)
 	else S_NUMBER_NONZERO("https-port:", https_port)
 	else S_STR("http-endpoint:", http_endpoint)
 	else S_NUMBER_NONZERO("http-max-streams:", http_max_streams)
@@ -558,18 +585,24 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_SIZET_NONZERO("msg-buffer-size:", msg_buffer_size)
 	else S_MEMSIZE("msg-cache-size:", msg_cache_size)
 	else S_POW2("msg-cache-slabs:", msg_cache_slabs)
+	else S_STR("msg-cache-policy:", msg_cache_policy)
+	else S_YNO("msg-cache-wire-image:", msg_cache_wire_image)
 	else S_SIZET_NONZERO("num-queries-per-thread:",num_queries_per_thread)
 	else S_SIZET_OR_ZERO("jostle-timeout:", jostle_time)
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
 	else S_MEMSIZE("so-sndbuf:", so_sndbuf)
 	else S_YNO("so-reuseport:", so_reuseport)
+	else S_YNO("worker-cpu-affinity:", worker_cpu_affinity)
+	else S_YNO("numa-aware:", numa_aware)
 	else S_YNO("ip-transparent:", ip_transparent)
 	else S_YNO("ip-freebind:", ip_freebind)
 	else S_NUMBER_OR_ZERO("ip-dscp:", ip_dscp)
 	else S_MEMSIZE("rrset-cache-size:", rrset_cache_size)
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
+	else S_STR("rrset-cache-policy:", rrset_cache_policy)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
+	else S_YNO("shared-inflight:", shared_inflight)
 	else S_YNO("deny-any:", deny_any)
 	else if(strcmp(opt, "cache-max-ttl:") == 0)
 	{ IS_NUMBER_OR_ZERO; cfg->max_ttl = atoi(val); MAX_TTL=(time_t)cfg->max_ttl;}
@@ -582,15 +615,27 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	    RTT_MIN_TIMEOUT=cfg->infra_cache_min_rtt;
 	}
 	else S_YNO("infra-keep-probing:", infra_keep_probing)
+	else S_NUMBER_OR_ZERO("infra-select-percentile:",
+		infra_select_percentile)
+	else S_YNO("udp-hedge:", udp_hedge)
+	else S_NUMBER_NONZERO("udp-hedge-percentile:", udp_hedge_percentile)
+	else S_NUMBER_OR_ZERO("udp-hedge-max-rate:", udp_hedge_max_rate)
 	else S_NUMBER_OR_ZERO("infra-host-ttl:", host_ttl)
 	else S_POW2("infra-cache-slabs:", infra_cache_slabs)
 	else S_SIZET_NONZERO("infra-cache-numhosts:", infra_cache_numhosts)
+	else S_STR("infra-cache-policy:", infra_cache_policy)
 	else S_NUMBER_OR_ZERO("delay-close:", delay_close)
 	else S_YNO("udp-connect:", udp_connect)
+	else S_NUMBER_OR_ZERO("udp-batch-size:", udp_batch_size)
+	else S_YNO("udp-upstream-batch:", udp_upstream_batch)
+	else S_NUMBER_OR_ZERO("udp-connect-pool:", udp_connect_pool)
+	else S_NUMBER_NONZERO("udp-connect-reuse:", udp_connect_reuse)
+	else S_YNO("use-io-uring:", use_io_uring)
 	else S_STR("chroot:", chrootdir)
 	else S_STR("username:", username)
 	else S_STR("directory:", directory)
 	else S_STR("pidfile:", pidfile)
+	else S_STR("cache-snapshot-file:", cache_snapshot_file)
 	else S_YNO("hide-identity:", hide_identity)
 	else S_YNO("hide-version:", hide_version)
 	else S_YNO("hide-trustanchor:", hide_trustanchor)
@@ -636,6 +681,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_OR_ZERO("val-bogus-ttl:", bogus_ttl)
 	else S_YNO("val-clean-additional:", val_clean_additional)
 	else S_NUMBER_OR_ZERO("val-log-level:", val_log_level)
+	else S_NUMBER_OR_ZERO("val-verify-threads:", val_verify_threads)
 	else S_YNO("val-log-squelch:", val_log_squelch)
 	else S_YNO("log-queries:", log_queries)
 	else S_YNO("log-replies:", log_replies)
@@ -665,6 +711,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	  autr_permit_small_holddown = cfg->permit_small_holddown; }
 	else S_MEMSIZE("key-cache-size:", key_cache_size)
 	else S_POW2("key-cache-slabs:", key_cache_slabs)
+	else S_STR("key-cache-policy:", key_cache_policy)
 	else S_MEMSIZE("neg-cache-size:", neg_cache_size)
 	else S_YNO("minimal-responses:", minimal_responses)
 	else S_YNO("rrset-roundrobin:", rrset_roundrobin)
@@ -790,6 +837,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 		 * name, forward-addr, forward-host,
 		 * ratelimit-for-domain, ratelimit-below-domain,
 		 * local-zone-tag, access-control-view,
+		 * priority-class, access-control-priority-class,
 		 * send-client-subnet, client-subnet-always-forward,
 		 * max-client-subnet-ipv4, max-client-subnet-ipv6,
 		 * min-client-subnet-ipv4, min-client-subnet-ipv6,
@@ -980,17 +1028,23 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "msg-buffer-size", msg_buffer_size)
 	else O_MEM(opt, "msg-cache-size", msg_cache_size)
 	else O_DEC(opt, "msg-cache-slabs", msg_cache_slabs)
+	else O_STR(opt, "msg-cache-policy", msg_cache_policy)
+	else O_YNO(opt, "msg-cache-wire-image", msg_cache_wire_image)
 	else O_DEC(opt, "num-queries-per-thread", num_queries_per_thread)
 	else O_UNS(opt, "jostle-timeout", jostle_time)
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
 	else O_MEM(opt, "so-sndbuf", so_sndbuf)
 	else O_YNO(opt, "so-reuseport", so_reuseport)
+	else O_YNO(opt, "worker-cpu-affinity", worker_cpu_affinity)
+	else O_YNO(opt, "numa-aware", numa_aware)
 	else O_YNO(opt, "ip-transparent", ip_transparent)
 	else O_YNO(opt, "ip-freebind", ip_freebind)
 	else O_DEC(opt, "ip-dscp", ip_dscp)
 	else O_MEM(opt, "rrset-cache-size", rrset_cache_size)
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
+	else O_STR(opt, "rrset-cache-policy", rrset_cache_policy)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
+	else O_YNO(opt, "shared-inflight", shared_inflight)
 	else O_YNO(opt, "prefetch", prefetch)
 	else O_YNO(opt, "deny-any", deny_any)
 	else O_DEC(opt, "cache-max-ttl", max_ttl)
@@ -1000,9 +1054,19 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "infra-cache-slabs", infra_cache_slabs)
 	else O_DEC(opt, "infra-cache-min-rtt", infra_cache_min_rtt)
 	else O_YNO(opt, "infra-keep-probing", infra_keep_probing)
+	else O_DEC(opt, "infra-select-percentile", infra_select_percentile)
+	else O_YNO(opt, "udp-hedge", udp_hedge)
+	else O_DEC(opt, "udp-hedge-percentile", udp_hedge_percentile)
+	else O_DEC(opt, "udp-hedge-max-rate", udp_hedge_max_rate)
 	else O_MEM(opt, "infra-cache-numhosts", infra_cache_numhosts)
+	else O_STR(opt, "infra-cache-policy", infra_cache_policy)
 	else O_UNS(opt, "delay-close", delay_close)
 	else O_YNO(opt, "udp-connect", udp_connect)
+	else O_DEC(opt, "udp-batch-size", udp_batch_size)
+	else O_YNO(opt, "udp-upstream-batch", udp_upstream_batch)
+	else O_DEC(opt, "udp-connect-pool", udp_connect_pool)
+	else O_DEC(opt, "udp-connect-reuse", udp_connect_reuse)
+	else O_YNO(opt, "use-io-uring", use_io_uring)
 	else O_YNO(opt, "do-ip4", do_ip4)
 	else O_YNO(opt, "do-ip6", do_ip6)
 	else O_YNO(opt, "do-udp", do_udp)
@@ -1010,6 +1074,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "prefer-ip4", prefer_ip4)
 	else O_YNO(opt, "prefer-ip6", prefer_ip6)
 	else O_YNO(opt, "tcp-upstream", tcp_upstream)
+	else O_YNO(opt, "tcp-upstream-pool", tcp_upstream_pool)
 	else O_YNO(opt, "udp-upstream-without-downstream", udp_upstream_without_downstream)
 	else O_DEC(opt, "tcp-mss", tcp_mss)
 	else O_DEC(opt, "outgoing-tcp-mss", outgoing_tcp_mss)
@@ -1030,6 +1095,9 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_STR(opt, "tls-ciphers", tls_ciphers)
 	else O_STR(opt, "tls-ciphersuites", tls_ciphersuites)
 	else O_YNO(opt, "tls-use-sni", tls_use_sni)
+	else O_YNO(opt, "tls-upstream-resume", tls_upstream_resume)
+	else O_YNO(opt, "tls-upstream-early-data", tls_upstream_early_data)
+	else O_YNO(opt, "tls-use-ktls", tls_use_ktls)
 	else O_DEC(opt, "https-port", https_port)
 	else O_STR(opt, "http-endpoint", http_endpoint)
 	else O_UNS(opt, "http-max-streams", http_max_streams)
@@ -1049,6 +1117,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "log-local-actions", log_local_actions)
 	else O_YNO(opt, "log-servfail", log_servfail)
 	else O_STR(opt, "pidfile", pidfile)
+	else O_STR(opt, "cache-snapshot-file", cache_snapshot_file)
 	else O_YNO(opt, "hide-identity", hide_identity)
 	else O_YNO(opt, "hide-version", hide_version)
 	else O_YNO(opt, "hide-trustanchor", hide_trustanchor)
@@ -1071,6 +1140,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "val-bogus-ttl", bogus_ttl)
 	else O_YNO(opt, "val-clean-additional", val_clean_additional)
 	else O_DEC(opt, "val-log-level", val_log_level)
+	else O_DEC(opt, "val-verify-threads", val_verify_threads)
 	else O_YNO(opt, "val-permissive-mode", val_permissive_mode)
 	else O_YNO(opt, "aggressive-nsec", aggressive_nsec)
 	else O_YNO(opt, "ignore-cd-flag", ignore_cd)
@@ -1088,6 +1158,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "permit-small-holddown", permit_small_holddown)
 	else O_MEM(opt, "key-cache-size", key_cache_size)
 	else O_DEC(opt, "key-cache-slabs", key_cache_slabs)
+	else O_STR(opt, "key-cache-policy", key_cache_policy)
 	else O_MEM(opt, "neg-cache-size", neg_cache_size)
 	else O_YNO(opt, "control-enable", remote_control_enable)
 	else O_DEC(opt, "control-port", control_port)
@@ -1200,6 +1271,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_LS3(opt, "access-control-tag-action", acl_tag_actions)
 	else O_LS3(opt, "access-control-tag-data", acl_tag_datas)
 	else O_LS2(opt, "access-control-view", acl_view)
+	else O_LS2(opt, "access-control-priority-class", acl_priority_class)
+	else O_LS2(opt, "priority-class", priority_class)
 	else O_YNO(opt, "pad-responses", pad_responses)
 	else O_DEC(opt, "pad-responses-block-size", pad_responses_block_size)
 	else O_YNO(opt, "pad-queries", pad_queries)
@@ -1222,6 +1295,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "redis-timeout", redis_timeout)
 	else O_YNO(opt, "redis-expire-records", redis_expire_records)
 #endif  /* USE_REDIS */
+	else O_YNO(opt, "redis-async", redis_async)
 #endif  /* USE_CACHEDB */
 #ifdef USE_IPSET
 	else O_STR(opt, "name-v4", ipset_name_v4)
@@ -1501,7 +1575,12 @@ config_delete(struct config_file* cfg)
 	free(cfg->directory);
 	free(cfg->logfile);
 	free(cfg->pidfile);
+	free(cfg->cache_snapshot_file);
 	free(cfg->target_fetch_policy);
+	free(cfg->msg_cache_policy);
+	free(cfg->rrset_cache_policy);
+	free(cfg->infra_cache_policy);
+	free(cfg->key_cache_policy);
 	free(cfg->ssl_service_key);
 	free(cfg->ssl_service_pem);
 	free(cfg->tls_cert_bundle);
@@ -1556,6 +1635,8 @@ config_delete(struct config_file* cfg)
 	config_del_strbytelist(cfg->respip_tags);
 	config_deltrplstrlist(cfg->acl_tag_actions);
 	config_deltrplstrlist(cfg->acl_tag_datas);
+	config_deldblstrlist(cfg->acl_priority_class);
+	config_deldblstrlist(cfg->priority_class);
 	config_delstrlist(cfg->control_ifs.first);
 	free(cfg->server_key_file);
 	free(cfg->server_cert_file);
@@ -1996,6 +2077,70 @@ find_tag_id(struct config_file* cfg, const char* tag)
 	return -1;
 }
 
+int
+cfg_priority_classes(struct config_file* cfg, const char** names,
+	int* percent)
+{
+	static const char* builtin[] = {"client", "internal", "prefetch"};
+	struct config_str2list* p;
+	int num = 0, i, j;
+	for(p=cfg->priority_class; p; p=p->next)
+		num++;
+	if(num > CFG_PRIORITY_CLASS_MAX) {
+		log_err("too many priority-class entries, the max is %d",
+			CFG_PRIORITY_CLASS_MAX);
+		return -1;
+	}
+	/* the list is in reverse order of the config */
+	i = num;
+	for(p=cfg->priority_class; p; p=p->next) {
+		i--;
+		names[i] = p->str;
+		percent[i] = atoi(p->str2);
+	}
+	for(i=0; i<num; i++) {
+		for(j=0; j<i; j++) {
+			if(strcmp(names[i], names[j]) == 0) {
+				log_err("priority-class %s is listed twice",
+					names[i]);
+				return -1;
+			}
+		}
+	}
+	/* the builtin classes that are not configured have no limit */
+	for(j=0; j<(int)(sizeof(builtin)/sizeof(builtin[0])); j++) {
+		for(i=0; i<num; i++) {
+			if(strcmp(names[i], builtin[j]) == 0)
+				break;
+		}
+		if(i < num)
+			continue;
+		if(num == CFG_PRIORITY_CLASS_MAX) {
+			log_err("too many priority-class entries, the max "
+				"is %d with the builtin client, internal and "
+				"prefetch classes", CFG_PRIORITY_CLASS_MAX);
+			return -1;
+		}
+		names[num] = builtin[j];
+		percent[num] = 0;
+		num++;
+	}
+	return num;
+}
+
+int
+find_priority_class(struct config_file* cfg, const char* name)
+{
+	const char* names[CFG_PRIORITY_CLASS_MAX];
+	int percent[CFG_PRIORITY_CLASS_MAX];
+	int i, num = cfg_priority_classes(cfg, names, percent);
+	for(i=0; i<num; i++) {
+		if(strcmp(names[i], name) == 0)
+			return i;
+	}
+	return -1;
+}
+
 int
 config_add_tag(struct config_file* cfg, const char* tag)
 {
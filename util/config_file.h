@@ -101,6 +101,8 @@ struct config_file {
 	int tcp_auth_query_timeout;
 	/** tcp upstream queries (no UDP upstream queries) */
 	int tcp_upstream;
+	/** tcp and tls upstream streams are shared by the threads */
+	int tcp_upstream_pool;
 	/** udp upstream enabled when no UDP downstream is enabled (do_udp no)*/
 	int udp_upstream_without_downstream;
 	/** maximum segment size of tcp socket which queries are answered */
@@ -136,6 +138,12 @@ struct config_file {
 	char* tls_ciphersuites;
 	/** if SNI is to be used */
 	int tls_use_sni;
+	/** if TLS sessions of upstreams are resumed */
+	int tls_upstream_resume;
+	/** if the first query on a resumed TLS stream is early data */
+	int tls_upstream_early_data;
+	/** if the kernel is asked to do the TLS records (kTLS) */
+	int tls_use_ktls;
 
 	/** port on which to provide DNS over HTTPS service */
 	int https_port;
@@ -171,6 +179,10 @@ struct config_file {
 	size_t msg_cache_size;
 	/** slabs in the message cache. */
 	size_t msg_cache_slabs;
+	/** eviction policy of the message cache, "lru" or "sieve" */
+	char* msg_cache_policy;
+	/** if wire images of cached replies are kept, to answer from */
+	int msg_cache_wire_image;
 	/** number of queries every thread can service */
 	size_t num_queries_per_thread;
 	/** number of msec to wait before items can be jostled out */
@@ -179,20 +191,44 @@ struct config_file {
 	size_t rrset_cache_size;
 	/** slabs in the rrset cache */
 	size_t rrset_cache_slabs;
+	/** eviction policy of the rrset cache */
+	char* rrset_cache_policy;
 	/** host cache ttl in seconds */
 	int host_ttl;
 	/** number of slabs in the infra host cache */
 	size_t infra_cache_slabs;
 	/** max number of hosts in the infra cache */
 	size_t infra_cache_numhosts;
+	/** eviction policy of the infra host cache */
+	char* infra_cache_policy;
 	/** min value for infra cache rtt */
 	int infra_cache_min_rtt;
+	/** file for the binary cache snapshot, NULL or "" if disabled */
+	char* cache_snapshot_file;
 	/** keep probing hosts that are down */
 	int infra_keep_probing;
+	/** percentile of the server rtt used for server selection, 0 off */
+	int infra_select_percentile;
+	/** send a hedged UDP query to another server when the answer is late */
+	int udp_hedge;
+	/** percentile of the server roundtrip time to wait before hedging */
+	int udp_hedge_percentile;
+	/** max percentage of UDP queries that is hedged */
+	int udp_hedge_max_rate;
 	/** delay close of udp-timeouted ports, if 0 no delayclose. in msec */
 	int delay_close;
 	/** udp_connect enable uses UDP connect to mitigate ICMP side channel */
 	int udp_connect;
+	/** number of UDP datagrams read and written per system call */
+	int udp_batch_size;
+	/** queue upstream UDP queries and send them with sendmmsg per port */
+	int udp_upstream_batch;
+	/** max number of idle connected UDP sockets kept open per thread */
+	int udp_connect_pool;
+	/** max number of queries sent over one connected UDP socket */
+	int udp_connect_reuse;
+	/** use the io_uring event base in the daemon */
+	int use_io_uring;
 
 	/** the target fetch policy for the iterator */
 	char* target_fetch_policy;
@@ -211,6 +247,10 @@ struct config_file {
 	size_t so_sndbuf;
 	/** SO_REUSEPORT requested on port 53 sockets */
 	int so_reuseport;
+	/** pin the threads to the CPUs, and steer the queries to them */
+	int worker_cpu_affinity;
+	/** bind the threads to NUMA nodes, with node local allocation */
+	int numa_aware;
 	/** IP_TRANSPARENT socket option requested on port 53 sockets */
 	int ip_transparent;
 	/** IP_FREEBIND socket option request on port 53 sockets */
@@ -303,6 +343,8 @@ struct config_file {
 	int prefetch;
 	/** if prefetching of DNSKEYs should be performed. */
 	int prefetch_key;
+	/** if the threads share the client queries that they resolve */
+	int shared_inflight;
 	/** deny queries of type ANY with an empty answer */
 	int deny_any;
 
@@ -381,6 +423,9 @@ struct config_file {
 	int val_log_level;
 	/** squelch val_log_level to log - this is library goes to callback */
 	int val_log_squelch;
+	/** number of threads that verify signatures for the validator,
+	 * 0 to verify on the thread that handles the query */
+	int val_verify_threads;
 	/** should validator allow bogus messages to go through */
 	int val_permissive_mode;
 	/** use cached NSEC records to synthesise (negative) answers */
@@ -417,6 +462,8 @@ struct config_file {
 	size_t key_cache_size;
 	/** slabs in the key cache. */
 	size_t key_cache_slabs;
+	/** eviction policy of the key cache */
+	char* key_cache_policy;
 	/** size of the neg cache */
 	size_t neg_cache_size;
 
@@ -448,6 +495,10 @@ struct config_file {
 	struct config_str3list* acl_tag_datas;
 	/** list of aclname, view*/
 	struct config_str2list* acl_view;
+	/** list of aclname, priority class name */
+	struct config_str2list* acl_priority_class;
+	/** list of priority class name, percent of the resources */
+	struct config_str2list* priority_class;
 	/** list of IP-netblock, tagbitlist */
 	struct config_strbytelist* respip_tags;
 	/** list of response-driven access control entries, linked list */
@@ -653,6 +704,9 @@ struct config_file {
 	/** set timeout on redis records based on DNS response ttl */
 	int redis_expire_records;
 #endif
+	/** use asynchronous, pipelined communication with the redis server,
+	 * also makes the lookups of the testframe backend asynchronous */
+	int redis_async;
 #endif
 
 	/* ipset module */
@@ -1123,6 +1177,31 @@ int config_add_tag(struct config_file* cfg, const char* tag);
  */
 int find_tag_id(struct config_file* cfg, const char* tag);
 
+/** the max number of priority classes, with the builtin classes */
+#define CFG_PRIORITY_CLASS_MAX 8
+
+/**
+ * Get the priority classes, in the order of priority.  These are the
+ * classes in the config, followed by the builtin client, internal and
+ * prefetch classes, for those that are not in the config.
+ * @param cfg: the config structure.
+ * @param names: array of CFG_PRIORITY_CLASS_MAX, the names are returned,
+ *	they point into the config or to static strings.
+ * @param percent: array of CFG_PRIORITY_CLASS_MAX, the percent of the
+ *	resources for the class is returned, 0 for no limit.
+ * @return: the number of classes, or -1 on error, that is logged.
+ */
+int cfg_priority_classes(struct config_file* cfg, const char** names,
+	int* percent);
+
+/**
+ * Find the number of a priority class.
+ * @param cfg: the config structure.
+ * @param name: the name of the class.
+ * @return: 0..(num-1) with the class number, or -1 if it is not found.
+ */
+int find_priority_class(struct config_file* cfg, const char* name);
+
 /**
  * parse taglist from string into bytestring with bitlist.
  * @param cfg: the config structure (with tagnames)
@@ -354,8 +354,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 348
-#define YY_END_OF_BUFFER 349
+#define YY_NUM_RULES 374
+#define YY_END_OF_BUFFER 375
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -363,2688 +363,2458 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[3439] =
+static const flex_int16_t yy_accept[3705] =
     {   0,
-        1,    1,  322,  322,  326,  326,  330,  330,  334,  334,
-        1,    1,  338,  338,  342,  342,  349,  346,    1,  320,
-      320,  347,    2,  347,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  322,  323,  323,  324,
-      347,  326,  327,  327,  328,  347,  333,  330,  331,  331,
-      332,  347,  334,  335,  335,  336,  347,  345,  321,    2,
-      325,  347,  345,  341,  338,  339,  339,  340,  347,  342,
-      343,  343,  344,  347,  346,    0,    1,    2,    2,    2,
-        2,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  322,
-        0,  326,    0,  333,    0,  330,  334,    0,  345,    0,
-        2,    2,  345,  341,    0,  338,  342,    0,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  345,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  128,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  137,
-      346,  346,  346,  346,  346,  346,  346,  345,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  112,  346,  319,
-      346,  346,  346,  346,  346,  346,  346,    8,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  129,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      142,  346,  346,  345,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  312,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      345,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,   67,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  244,  346,
-       14,   15,  346,   19,   18,  346,  346,  228,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  135,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  226,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,    3,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  345,  346,  346,  346,  346,  346,  346,  346,
-      306,  346,  346,  305,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  329,  346,  346,  346,  346,  346,  346,  346,  346,
-       66,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,   70,  346,  275,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  313,
-      314,  346,  346,  346,  346,  346,  346,  346,   71,  346,
-      346,  136,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  132,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  215,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,   21,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  161,
-      346,  346,  346,  346,  345,  329,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  110,  346,  346,
-      346,  346,  346,  346,  346,  283,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  185,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  160,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  109,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,   35,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-       36,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,   68,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  134,  346,  346,  345,
-      346,  346,  346,  346,  346,  127,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,   69,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  248,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  186,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,   57,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      266,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-       61,  346,   62,  346,  346,  346,  346,  346,  113,  346,
-      114,  346,  346,  346,  346,  111,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,    7,  346,  346,
-      346,  345,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      237,  346,  346,  346,  346,  163,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  249,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,   48,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,   58,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  207,  346,  206,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,   16,   17,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,   72,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  214,  346,  346,  346,  346,  346,
-
-      346,  116,  346,  115,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  198,  346,
-      346,  346,  346,  346,  346,  346,  346,  143,  346,  346,
-      345,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  104,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,   92,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  227,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,   97,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,   65,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  201,  202,  346,
-      346,  346,  277,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,    6,  346,  346,  346,
-      346,  346,  346,  296,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  281,  346,  346,  346,  346,  346,  346,  307,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,   45,  346,  346,  346,  346,   47,  346,  346,
-      346,   93,  346,  346,  346,  346,  346,   55,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  345,  346,  194,
-      346,  346,  346,  138,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  219,  346,  195,  346,  346,  346,
-      234,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,   56,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  140,  121,  346,  122,  346,  346,  346,  120,
-      346,  346,  346,  346,  346,  346,  346,  346,  158,  346,
-      346,   53,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  265,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  196,  346,
-      346,  346,  346,  346,  199,  346,  205,  346,  346,  346,
-      346,  346,  346,  233,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      108,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  133,
-
-      346,  346,  346,  346,  346,  346,  346,   63,  346,  346,
-      346,   29,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,   20,  346,  346,  346,  346,  346,  346,
-       30,   39,  346,  168,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  345,
-      346,  346,  346,  346,  346,  346,   80,   82,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  285,  346,  346,  346,  346,  245,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  123,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  157,
-      346,   49,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  300,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  162,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  294,  346,  346,  346,
-      225,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      310,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  179,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  117,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  174,  346,  187,  346,  346,  346,
-      346,  346,  346,  345,  346,  146,  346,  346,  346,  346,
-      346,  103,  346,  346,  346,  346,  217,  346,  346,  346,
-      346,  346,  346,  235,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      257,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  139,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  178,  346,  346,  346,
-
-      346,  346,  346,   83,  346,   84,  346,  346,  346,  346,
-      346,   64,  303,  346,  346,  346,  346,  346,   91,  188,
-      346,  208,  346,  238,  346,  346,  200,  278,  346,  346,
-      346,  346,  346,  346,   76,  346,  190,  346,  346,  346,
-      346,  346,    9,  346,  346,  346,  346,  346,  107,  346,
-      346,  346,  346,  270,  346,  346,  346,  346,  216,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  345,
-      346,  346,  346,  346,  177,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  164,  346,  284,  346,  346,
-      346,  346,  346,  256,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  229,  346,  346,  346,  346,
-      346,  276,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  304,  346,  189,  346,  346,  346,  346,  346,
-      346,  346,  346,   75,   77,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  106,  346,  346,  346,  346,  268,
-      346,  346,  346,  346,  280,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  221,   37,   31,
-       33,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,   38,  346,   32,   34,  346,  346,  346,  346,
-      346,  346,  346,  346,  102,  346,  346,  346,  346,  346,
-      346,  346,  346,  345,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  223,  220,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,   74,  346,  346,  346,  141,
-
-      346,  124,  346,  346,  346,  346,  346,  346,  346,  346,
-      159,   50,  346,  346,  346,  337,   13,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  298,  346,  301,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,   12,  346,  346,   22,  346,  346,  346,  346,  346,
-      274,  346,  346,  346,  346,  282,  346,  346,  346,   78,
-      346,  231,  346,  346,  346,  346,  346,  222,  346,  346,
-       73,  346,  346,  346,  346,  346,   23,  346,  346,   46,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  173,  172,  346,  346,  337,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  224,  218,  346,  236,
-      346,  346,  286,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,   85,  346,  346,  346,  346,
-      269,  346,  346,  346,  346,  204,  346,  346,  346,  346,
-      346,  230,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  308,  309,  170,  346,  346,   79,  346,
-      346,  346,  346,  180,  346,  346,  346,  118,  119,  346,
-      346,  346,   25,  346,  346,  165,  346,  167,  346,  209,
-
-      346,  346,  346,  346,  171,  346,  346,  346,  346,  239,
-      346,  346,  346,  346,  346,  346,  346,  148,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      247,  346,  346,  346,  346,  346,  346,  346,  317,  346,
-       27,  346,  279,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,   89,  210,  346,
-      346,  267,  346,  302,  346,  203,  346,  346,  346,  346,
-      346,   59,  346,  346,  346,  346,  346,  346,    4,  346,
-      346,  346,  346,  131,  147,  346,  346,  346,  184,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  242,   40,   41,
-      346,  346,  346,  346,  346,  346,  346,  287,  346,  346,
-      346,  346,  346,  346,  346,  255,  346,  346,  346,  346,
-      346,  346,  346,  346,  213,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,   88,  346,   60,
-      273,  346,  243,  346,  346,  346,  346,  346,   11,  346,
-      346,  346,  346,  346,  346,  346,  346,  130,  346,  346,
-      346,  346,  211,   94,  346,  346,   43,  346,  346,  346,
-      346,  346,  346,  346,  346,  176,  346,  346,  346,  346,
-      346,  346,  346,  150,  346,  346,  346,  346,  246,  346,
-
-      346,  346,  346,  346,  254,  346,  346,  346,  346,  144,
-      346,  346,  346,  125,  126,  346,  346,  346,   96,  100,
-       95,  346,  346,  346,  346,   86,  346,  346,  346,  346,
-      346,  346,   10,  346,  346,  346,  346,  346,  271,  311,
-      346,  346,  346,  346,  346,  316,   42,  346,  346,  346,
-      346,  346,  175,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  101,   99,
-      346,   54,  346,  346,   87,  299,  346,  346,  346,  346,
-       24,  346,  346,  346,  346,  346,  197,  346,  346,  346,
-
-      346,  346,  212,  346,  346,  346,  346,  346,  346,  346,
-      346,  193,  346,  346,  166,   81,  346,  346,  346,  346,
-      346,  288,  346,  346,  346,  346,  346,  346,  346,  251,
-      346,  346,  250,  145,  346,  346,   98,   51,  346,  151,
-      152,  155,  156,  153,  154,   90,  297,  346,  346,  272,
-      346,  346,  346,   26,  346,  169,  346,  346,  346,  346,
-      192,  346,  241,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  182,  181,   44,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  295,  346,
-      346,  346,  346,  105,  346,  240,  346,  264,  292,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      318,  346,   52,    5,  346,  346,  232,  346,  346,  293,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  252,
-       28,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  253,  346,  346,  346,  149,  346,  346,
-      346,  346,  346,  346,  346,  346,  183,  346,  191,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  289,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  315,  346,  346,  260,
-      346,  346,  346,  346,  346,  290,  346,  346,  346,  346,
-      346,  346,  291,  346,  346,  346,  258,  346,  261,  262,
-      346,  346,  346,  346,  346,  259,  263,    0
+        1,     1,   348,   348,   352,   352,   356,   356,   360,   360,
+        1,     1,   364,   364,   368,   368,   375,   372,     1,   346,
+      346,   373,     2,   373,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   348,   349,   349,
+      350,   373,   352,   353,   353,   354,   373,   359,   356,   357,
+      357,   358,   373,   360,   361,   361,   362,   373,   371,   347,
+        2,   351,   373,   371,   367,   364,   365,   365,   366,   373,
+      368,   369,   369,   370,   373,   372,     0,     1,     2,     2,
+        2,     2,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   348,     0,   348,   352,     0,   352,   359,     0,
+      356,   359,   360,     0,   360,   371,     0,     2,     2,   371,
+      371,   367,     0,   364,   367,   368,     0,   368,     2,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,     2,   371,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   150,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   159,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   371,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   134,   372,   345,   372,   372,
+      372,   372,   372,   372,   372,   372,     8,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   151,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   164,   372,   372,   372,   371,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   338,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   371,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,    73,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   269,   372,    14,    15,   372,    19,    18,
+      372,   372,   252,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   157,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   250,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,     3,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   371,   372,   372,
+      372,   372,   372,   372,   372,   331,   372,   372,   372,   330,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   355,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,    72,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,    76,   372,   300,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   339,   340,   372,   372,
+      372,   372,   372,   372,   372,   372,    77,   372,   372,   158,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   154,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   239,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,    22,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   183,   372,   372,   372,   372,   372,
+      371,   355,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   132,   372,   372,   372,   372,   372,
+
+      372,   372,   308,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      207,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      182,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   129,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+       36,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,    37,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,    74,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   156,   372,   372,   371,   372,   372,
+      372,   372,   372,   149,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+       75,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   273,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   208,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,    61,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   291,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,    65,   372,    66,   372,   372,   372,
+      372,   372,   135,   372,   136,   372,   372,   372,   372,   133,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      102,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,     7,   372,   372,
+      372,   372,   371,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   261,   372,   372,   372,   372,   185,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   274,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,    52,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,    62,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   231,   372,
+      230,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,    69,   372,   372,   372,   372,   372,
+      372,   372,   372,    16,    17,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+       79,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   238,   372,   372,   372,   372,   372,
+      372,   138,   372,   137,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   222,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   165,   372,   372,   372,   371,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   124,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   107,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   251,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   117,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,    71,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   225,   226,   372,
+      372,   372,   302,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,     6,   372,
+      372,   372,   372,   372,   372,   321,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   337,
+      372,   372,   372,   372,   372,   306,   372,   372,   372,   372,
+
+      372,   372,   332,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,    46,   372,   372,
+      372,   372,   372,    48,   372,   372,   372,   372,   372,   108,
+      372,   372,   372,   372,   372,   372,   372,   372,    59,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      371,   372,   218,   372,   372,   372,   160,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   243,   372,
+      219,   372,   372,   372,   258,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,    60,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   162,   143,   372,   144,
+      372,   372,   372,   142,   372,   372,   372,   372,   372,   372,
+      372,   372,   180,   372,   372,    57,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   290,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   220,   372,   372,   372,   372,   372,
+      372,   223,   372,   229,   372,   372,   372,   372,   372,   372,
+      257,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   128,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   155,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,    67,
+      372,   372,   372,    30,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,    20,   372,   372,   372,
+      372,   372,   372,   372,    31,    51,    40,   372,   190,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      113,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   371,   372,   372,   372,   372,   372,   372,    90,
+       92,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   310,   372,   372,   372,   372,
+      270,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   145,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   179,   372,    53,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   325,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      184,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   319,   372,   372,   372,   372,
+      249,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      335,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   201,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   139,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   196,   372,   209,   372,   372,
+      372,   372,   372,   372,   372,   372,   371,   372,   168,   372,
+      372,   372,   372,   372,   372,   123,   372,   372,   372,   372,
+
+      241,   372,   372,   372,   372,   372,   372,   259,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   282,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   161,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      200,   372,   372,   372,   372,   372,   372,   372,    93,   372,
+       94,   372,   372,   372,   372,   372,   372,    70,   328,   372,
+      372,   372,   372,   372,   106,   372,   211,   372,   232,   372,
+      262,   372,   372,   224,   303,   372,   372,   372,   372,   372,
+      372,   372,    83,   372,   372,   214,   372,   372,   372,   372,
+
+      372,     9,   372,   372,   372,   372,   131,   372,   127,   372,
+      372,   372,   372,   295,   372,   372,   372,   372,   240,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   109,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   371,   372,   372,   372,   372,   372,   199,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      186,   372,   309,   372,   372,   372,   372,   372,   281,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      253,   372,   372,   372,   372,   372,   301,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   329,
+      372,   372,   212,   372,   372,   372,   372,   372,   372,   372,
+      372,    82,   372,    84,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   126,   372,   372,   372,   372,   293,
+      372,   372,   372,   372,   305,   372,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   372,   372,   372,   372,   245,   130,
+       38,    32,    34,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,    39,   372,    33,    35,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   122,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   371,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   247,
+      244,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,    81,
+      372,   372,   372,   163,   372,   146,   372,   372,   372,   372,
+
+      372,   372,   372,   372,   181,    54,   372,   372,   372,   363,
+       13,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   323,   372,   326,   372,   213,   372,   372,
+      372,   372,   372,   372,   372,   372,    85,   372,   372,   372,
+       12,   372,   372,    23,   372,   372,   372,   372,   372,   299,
+      372,   372,   372,   372,   307,   372,   372,   372,   372,    87,
+      372,   255,   372,   372,   372,   372,   372,   246,   372,   372,
+       80,   372,   372,   372,   372,   372,    24,   372,   372,   372,
+       47,   372,   372,   372,   372,   372,   372,   111,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+
+      195,   194,   372,   372,   372,   372,   363,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   248,   242,
+      372,   260,   372,   372,   311,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,    95,   372,
+      372,   372,   372,   372,   294,   372,   372,   372,   372,   228,
+      372,   372,   372,   372,   372,   254,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   333,   334,
+      192,   372,   372,   372,    88,   372,   372,   372,   372,   202,
+
+      372,   372,   372,   140,   141,   372,   372,   372,    26,    21,
+      372,   372,   372,   372,   187,   372,   189,   112,   372,   372,
+      372,   372,   233,   372,   372,   372,   372,   193,   372,   372,
+      372,   372,   372,   372,   372,   263,   372,   372,   372,   372,
+      372,   372,   372,   372,   170,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   272,   372,   372,
+      372,   372,   372,   372,   372,   343,   372,    28,   372,   304,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,    97,   100,   372,   234,   372,   372,
+      292,   372,   327,   372,   227,   372,   372,   372,   372,   372,
+
+      372,    63,   372,   372,   372,   372,   372,   372,     4,   372,
+      372,   372,   372,   153,    89,   169,   372,   372,   372,   206,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      104,   372,   110,   372,   372,   372,   372,   372,   372,   210,
+      372,   372,   372,   372,   372,   372,   266,    41,    42,   372,
+      372,    78,   372,   372,   372,   372,   372,   312,   372,   372,
+      372,   372,   372,   372,   372,   280,   372,   372,   372,   372,
+      372,   372,   372,   372,   237,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,    99,   372,   372,
+       64,   298,   372,   268,   372,   372,   372,   372,   372,   372,
+
+       11,   372,   372,   372,   372,   372,   372,   372,   372,   152,
+      372,   372,   372,   372,   235,   114,   372,   372,    44,   372,
+      372,   372,    49,   372,   372,   372,   372,   372,   372,   372,
+      198,    68,   372,   372,   372,   372,   372,   372,   372,   372,
+      172,   372,   372,   372,   372,   271,   372,   372,   372,   372,
+      372,   279,   372,   372,   372,   372,   166,   372,   372,   372,
+      147,   148,   372,   372,   372,   116,   120,   115,   372,   372,
+      372,   372,    96,   372,   372,   372,   372,   372,   372,    86,
+      372,    10,   372,   372,   372,   372,   372,   296,   336,   372,
+      372,   372,   372,   372,   342,    43,   372,   372,   372,   103,
+
+      372,   372,   372,   197,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      121,   119,   372,    58,   372,   372,    98,   372,   324,   372,
+      372,   372,   372,    25,   372,   372,   372,   372,   372,   221,
+      372,   372,   372,   372,   372,   236,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   217,   372,   372,   372,   188,
+       91,   372,   372,   372,   372,   372,   313,   372,   372,   372,
+      372,   372,   372,   372,   276,   372,   372,   275,   167,   372,
+      372,   118,    55,   372,   372,   173,   174,   177,   178,   175,
+
+      176,   105,   322,   372,   372,   297,   372,   372,   372,    27,
+      372,   372,   191,   372,   372,   372,   372,   216,   372,   372,
+      265,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   101,   372,
+      372,   372,   204,   203,    45,    50,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   320,
+      372,   372,   372,   372,   125,   372,   372,   264,   372,   289,
+      317,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   344,   372,    56,     5,   372,   372,   256,   372,
+
+      372,   372,   318,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   277,    29,   372,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   278,   372,   372,
+      372,   372,   171,   372,   372,   372,   372,   372,   372,   372,
+      372,   205,   372,   215,   267,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   314,   372,   372,   372,   372,   372,
+      372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+      372,   372,   341,   372,   372,   285,   372,   372,   372,   372,
+      372,   315,   372,   372,   372,   372,   372,   372,   316,   372,
+      372,   372,   283,   372,   286,   287,   372,   372,   372,   372,
+
+      372,   284,   288,     0
     } ;
 
 static const YY_CHAR yy_ec[256] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    1,    5,    6,    1,    1,    1,    7,    1,
-        1,    1,    1,    1,    8,    1,    1,    1,    9,    1,
-       10,   11,    1,   12,    1,    1,    1,   13,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,   14,    1,    1,    1,    1,   15,   16,   17,   18,
-
-       19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
-       29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
-       39,   40,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
+        1,     1,     1,     1,     1,     1,     1,     1,     2,     3,
+        1,     1,     4,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     2,     1,     5,     6,     1,     1,     1,     7,     1,
+        1,     1,     1,     1,     8,     1,     1,     1,     9,     1,
+       10,    11,     1,    12,     1,     1,     1,    13,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,    14,     1,     1,     1,     1,    15,    16,    17,    18,
+
+       19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+       29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+       39,    40,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1
     } ;
 
 static const YY_CHAR yy_meta[41] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    1,    7,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1
     } ;
 
-static const flex_int16_t yy_base[3457] =
+static const flex_int16_t yy_base[3705] =
     {   0,
-        0,    0,   38,   41,   44,   46,   59,   65,   71,   77,
-       90,  112,   96,  118,  124,  136, 2864, 2494,   81, 6714,
-     6714, 6714,  129,   52,  130,   63,  131,  152,   70,  140,
-      149,  156,   57,   88,   76,  173,  175,   95,  197,  145,
-      185,  199,  208,  213,  178,  123, 2453, 6714, 6714, 6714,
-      107, 2397, 6714, 6714, 6714,  154, 2315, 2042, 6714, 6714,
-     6714,  245, 1786, 6714, 6714, 6714,  163, 1733, 6714,  249,
-     6714,  253,  148, 1670, 1574, 6714, 6714, 6714,  257, 1426,
-     6714, 6714, 6714,  233, 1294,  263,  201,    0,  267,    0,
-        0,  165,  191,  221,  252,  205,  181,  265,   92,  261,
-
-      216,  263,  271,  272,  210,  279,  274,  282,  278,  291,
-      283,  286,  276,  285,  295,  293,  306,  314,  297,  313,
-      317,  311,  315,  319,  321,  331,  327,  332,  336,  322,
-      339,  337,  346,  345,  347,  348,  353,  351,  357,  284,
-      358,  359,  369,  360,  380,  365,  381,  379,  375,  366,
-      367,  389,  390,  394,  393,  395,  396,  403,  404, 1266,
-      419, 1115,  422, 1023,  429,  930,  888,  433,  775,  437,
-      441,    0,  433,  705,  447,  479,  287,  452,  411,  445,
-      426,  446,  447,  448,  449,  450,  451,  453,  452,  456,
-      470,  234,  463,  473,  481,  479,  476,  483,  486,  487,
-
-      488,  489,  491,  492,  501,  500,  502,  505,  508,  510,
-      511,  460,  509,  513,  527,  515,  516,  519,  538,  529,
-      540,  543,  539,  548,  555,  400,  550,  551,  558,  553,
-      560,  561,  569,  562,  565,  566,  567,  570,  572,  574,
-      576,  579,  578,  582,  577,  590,  591,  585,  595,  594,
-      606,  601,  608,  604,  605,  362,  607,  611,  615,  623,
-      612,  627,  613,  614,  629,  633,  640,  641,  636,  622,
-      637,  639,  643,  644,  646,  648,  647,  656,  660,  659,
-      663,  667,  657,  665,  669,  671,  673,  649,  682,  675,
-      684,  688,  680,  683,  690,  692,  694,  696,  695,  699,
-
-      697,  700,  708,  704,  713,  712,  721,  716,  722,  719,
-      731,  732,  727,  717,  728,  729,  733,  736,  730,  740,
-      738,  741,  745,  743,  750,  752,  760,  755,  756,  771,
-      763,  766,  762,  774,  773,  765,  769,  794,  799,  782,
-      787,  800,  801,  804,  802,  803,  806,  808,  809,  814,
-      818,  819,  823,  807,  825,  827,  834,  829, 6714,  831,
-      838,  846,  839,  847,  850,  848,  854,  856,  836,  866,
-      864,  867,  876,  898,  849,  871,  868,  878,  881, 6714,
-      884,  882,  922,  890,  891,  908,  910,  859,  909,  911,
-      904,  912,  933,  906,  915,  929,  945,  942,  920,  930,
-
-      944,  946,  948,  958,  953,  955,  956,  957,  966,  861,
-      961,  962,  972,  964,  973,  974,  978,  979,  980,  987,
-      993,  985,  976,  988,  994,  996,  999,  998, 1011, 1008,
-     1006, 1004, 1001, 1017, 1027, 1019, 1030, 1031, 1034, 1033,
-     1022, 1043, 1032, 1047, 1048, 1039, 1049, 1057, 1054, 1041,
-     1055, 1059, 1060, 1061, 1063, 1066, 1067, 1068, 1069, 1073,
-     1077, 1071, 1087, 1074, 1082, 1089, 1084, 6714, 1091, 6714,
-     1093, 1094, 1095, 1096, 1100, 1098, 1097, 6714, 1101, 1107,
-     1108, 1099, 1116, 1111, 1129, 1122, 1112, 1124, 1130, 1131,
-     1134, 1142, 1137, 1138, 1146, 1139, 1143, 1144, 1147, 1150,
-
-     1151, 1152, 1155, 1158, 1159, 1162, 1179, 6714, 1161, 1163,
-     1171, 1165, 1170, 1172, 1176, 1190, 1191, 1173, 1197, 1201,
-     1203, 1210, 1206, 1207, 1208, 1209, 1213, 1182, 1214, 1218,
-     1216, 1222, 1225, 1224, 1226, 1230, 1227, 1228, 1229, 1245,
-     6714, 1237, 1238, 1249, 1256, 1252, 1254, 1241, 1257, 1255,
-     1258, 1259, 1261, 1265,  517, 1272, 1278, 1268, 1273, 1281,
-     1279, 1283, 1282, 1284, 1287, 1290, 1288, 1289, 1301, 1298,
-     1303, 1309, 1312, 1314, 1316, 1323, 1325, 1310, 1318, 1326,
-     1322, 1320, 1328, 1332, 1333, 1321, 1334, 1337, 1346, 1343,
-     1342, 1345, 1348, 1351, 1349, 1354, 1356, 1355, 1357, 1365,
-
-     1358, 1366, 1370, 1367, 1368, 1372, 1376, 1374, 1383, 1384,
-     1386, 6714, 1393, 1391, 1394, 1395, 1402, 1403, 1404, 1389,
-     1396, 1408, 1410, 1411, 1412, 1418, 1413, 1419, 1420, 1424,
-     1425, 1427, 1435, 1430, 1428, 1445, 1444, 1446, 1437, 1448,
-     1449, 1433, 1456, 1453, 1463, 1461, 1459, 1460, 1472, 1467,
-     1468, 1469, 1476, 1473, 1477, 1478, 1475, 1490, 1487, 1479,
-     1499, 1496, 1498, 1506, 1501, 1485, 1507, 1504, 1512, 1511,
-     1515, 1516, 1517, 1518, 1525, 1520, 1521, 1522, 1526, 1527,
-     1528, 1531, 1535, 1546, 1532, 1539, 1542, 1544, 1548, 1549,
-     1551, 1556, 1557, 1558, 1559, 1560, 1561, 1567, 1564, 1571,
-
-     1570, 1572, 1582, 1580, 1583, 1585, 1586, 1587, 1589, 1590,
-     1592, 1597, 1598, 1604, 1606, 1607, 1609, 1608, 1612, 1620,
-     1610, 1618, 1625, 1619, 1626, 1627, 1630, 1611, 1637, 1638,
-     1641, 1643, 1645, 6714, 1631, 1634, 1646, 1649, 1651, 1652,
-     1655, 1662, 1657, 1660, 1658, 1659, 1661, 1685, 6714, 1664,
-     6714, 6714, 1669, 6714, 6714, 1671, 1668, 6714, 1672, 1682,
-     1683, 1688, 1695, 1700, 1698, 1675, 1689, 1702, 1712, 1723,
-     1708, 1710, 1711, 1714, 1715, 1716, 1721, 1719, 1717, 1728,
-     1734, 1746, 1743, 1747, 1744, 1749, 1751, 1755, 1758, 1757,
-     1764, 1765, 1756, 1766, 1769, 1770, 1772, 1771, 1774, 1777,
-
-     1780, 1781, 1778, 1776, 1783, 1793, 1784, 1798, 1801, 6714,
-     1799, 1808, 1803, 1812, 1809, 1813, 1815, 1810, 1811, 1821,
-     1824, 1817, 1826, 1827, 1828, 1829, 1830, 1831, 1834, 1836,
-     1840, 1838, 1849, 1839, 6714, 1842, 1852, 1841, 1854, 1853,
-     1857, 1863, 1855, 1856, 1864, 1866, 1876, 1871, 1867, 1874,
-     1877, 1878, 1880, 1884, 6714, 1883, 1889, 1890, 1891, 1892,
-     1894, 1897, 1899, 1900, 1901, 1903, 1904, 1905, 1906, 1915,
-     1907, 1912, 1918, 1919, 1922, 1927, 1929, 1931, 1939, 1930,
-     1932, 1941, 1934, 1940, 1942, 1944, 1945, 1947, 1957, 1959,
-     1946, 1961, 1956, 1958, 1969, 1971, 1968, 1973, 1974, 1975,
-
-     1976, 1981, 1983, 1984, 1985, 1988, 1995, 1979, 1991, 1993,
-     2000, 1996, 2008, 1998, 2006, 2015, 2004, 2009, 2017, 2018,
-     6714, 2019, 2020, 6714, 2023, 2021, 2024, 2046, 2027, 2031,
-     2025, 2033, 2038, 2044, 2039, 2042, 2047, 2050, 2059, 2060,
-     2061, 2066, 2065, 2068, 2072, 2071, 2074, 2077, 2078, 2081,
-     2079, 2086, 2093, 2095, 2097, 2099, 2106, 2101, 2102, 2104,
-     2124, 2103, 2105, 2112, 2107, 2108, 2111, 2120, 2113, 2114,
-     2117, 2118, 2135, 2137, 2139, 2131, 2140, 2141, 2146, 2148,
-     2147, 6714, 2160, 2155, 2153, 2157, 2161, 2169, 2165, 2164,
-     6714, 2166, 2168, 2171, 2179, 2176, 2178, 2181, 2180, 2182,
-
-     2184, 2189, 2190, 2193, 2188, 2191, 2198, 6714, 2195, 6714,
-     2203, 2205, 2207, 2209, 2206, 2213, 2214, 2210, 2216, 6714,
-     6714, 2218, 2224, 2226, 2236, 2232, 2219, 2222, 6714, 2237,
-     2244, 6714, 2245, 2239, 2240, 2247, 2248, 2250, 2252, 2251,
-     2261, 2256, 2263, 2258, 2269, 2270, 6714, 2259, 2260, 2272,
-     2275, 2271, 2279, 2278, 2285, 2282, 6714, 2286, 2289, 2291,
-     2299, 2296, 2298, 2300, 2301, 2302, 2306, 2308, 2309, 2310,
-     2312, 2317, 2320, 2316, 2323, 2332, 2330, 2337, 6714, 2333,
-     2322, 2319, 2342, 2341, 2344, 2345, 2347, 2334, 2348, 2350,
-     2355, 2349, 2357, 2351, 2359, 2361, 2370, 2372, 2363, 2368,
-
-     2375, 2365, 2376, 2377, 2383, 2381, 2382, 2385, 2386, 6714,
-     2387, 2393, 2395, 2396, 2388,  171, 2398, 2394, 2402, 2405,
-     2407, 2418, 2403, 2419, 2421, 2420, 2422, 2424, 2425, 2428,
-     2429, 2432, 2431, 2433, 2434, 2435, 2438, 6714, 2440, 2444,
-     2445, 2447, 2448, 2449, 2451, 6714, 2455, 2460, 2466, 2473,
-     2468, 2464, 2474, 2476, 2479, 2480, 2481, 2482, 2484, 2483,
-     2485, 2487, 2490, 6714, 2492, 2500, 2502, 2493, 2503, 2506,
-     2511, 2504, 2512, 2514, 2516, 2515, 2517, 2522, 2518, 2521,
-     2523, 2525, 2529, 2526, 2532, 2536, 2535, 2538, 2539, 2540,
-     2543, 2547, 2549, 6714, 2554, 2555, 2553, 2556, 2558, 2560,
-
-     2561, 2563, 2580, 2565, 2571, 2573, 2581, 2587, 2577, 2589,
-     2597, 2593, 2599, 2602, 2607, 2603, 2609, 2612, 2605, 2615,
-     2617, 2618, 2619, 2627, 2623, 2624, 2625, 2628, 2629, 2639,
-     2640, 2631, 2641, 2643, 2646, 2635, 2653, 2658, 2572, 6714,
-     2660, 2650, 2648, 2662, 2673, 2668, 2669, 2670, 2674, 2676,
-     2678, 2679, 2680, 2687, 2682, 2684, 2686, 2690, 2689, 2693,
-     2699, 2696, 2701, 2704, 2708, 2705, 2711, 2713, 6714, 2716,
-     2712, 2718, 2721, 2723, 2724, 2728, 2731, 2729, 2725, 2733,
-     2736, 2738, 2739, 2740, 2741, 2748, 2745, 2751, 2747, 2752,
-     6714, 2759, 2753, 2764, 2757, 2767, 2755, 2773, 2774, 2775,
-
-     2765, 2776, 2779, 2782, 2783, 2785, 6714, 2792, 2793, 2784,
-     2800, 2795, 2791, 2796, 2802, 2799, 6714, 2803, 2805, 2808,
-     2806, 2809, 2817, 2818, 2814, 6714, 2822, 2813, 2824, 2825,
-     2828, 2829, 2830, 2834, 2831, 2836, 2837, 2841, 2839, 2842,
-     2847, 6714, 2849, 2859, 2854, 2857, 2856, 2860, 2862, 2863,
-     2871, 2873, 2867, 2870, 6714, 2886, 2883, 2885, 2894, 2889,
-     2875, 2891, 2890, 2892, 2898, 2899, 2900, 2902, 6714, 2903,
-     2906, 2907, 2910, 2914, 2912, 2904, 2921, 2920, 2926, 2913,
-     2928, 2929, 2931, 2933, 2934, 2935, 2936, 2937, 2947, 2942,
-     2949, 2939, 2951, 2961, 2962, 2953, 2964, 2960, 2965, 2968,
-
-     2969, 2976, 2977, 2978, 2979, 2982, 6714, 2985, 2986, 2987,
-     2973, 2988, 2992, 2993, 2994, 2997, 2975, 2999, 3004, 3002,
-     3003, 3011, 3018, 3013, 3014, 3019, 3020, 3021, 3023, 3024,
-     3025, 3026, 3035, 3027, 3031, 3034, 3042, 3037, 3040, 3047,
-     3048, 3049, 3050, 3052, 3058, 3053, 3055, 3061, 3054, 3059,
-     3063, 3064, 3066, 3080, 3081, 3073, 3075, 3083, 3084, 3085,
-     6714, 3089, 3090, 3093, 3094, 3096, 3099, 3100, 3109, 3101,
-     3102, 3106, 3113, 3118, 3110, 3119, 3120, 3121, 3131, 3124,
-     6714, 3126, 6714, 3127, 3128, 3134, 3138, 3136, 6714, 3140,
-     6714, 3142, 3147, 3143, 3149, 6714, 3150, 3151, 3154, 3152,
-
-     3155, 3157, 3162, 3160, 3163, 3164, 3166, 3167, 3170, 3171,
-     3173, 3176, 3178, 3183, 3185, 3186, 3187, 3190, 3194, 3191,
-     3196, 3202, 3197, 3200, 3206, 3207, 3208, 6714, 3215, 3209,
-     3212, 3218, 3220, 3221, 3223, 3225, 3224, 3227, 3231, 3230,
-     3232, 3241, 3237, 3248, 3244, 3245, 3251, 3260, 3255, 3263,
-     6714, 3258, 3262, 3259, 3265, 6714, 3268, 3266, 3269, 3276,
-     3267, 3274, 3279, 3280, 3284, 3282, 3286, 3287, 3293, 3295,
-     3297, 3301, 6714, 3303, 3305, 3288, 3306, 3315, 3322, 3323,
-     3319, 3325, 3327, 3335, 3331, 3308, 3330, 3318, 3332, 3338,
-     3339, 3340, 3342, 3349, 3344, 3345, 3354, 3346, 3355, 3356,
-
-     3357, 3358, 3360, 3361, 3362, 3359, 3229, 3363, 3364, 6714,
-     3366, 3369, 3379, 3388, 3370, 3371, 3385, 3386, 3368, 6714,
-     3394, 3391, 3396, 3395, 3397, 3399, 3402, 3403, 3404, 3406,
-     3408, 3410, 3409, 3412, 6714, 3419, 6714, 3413, 3426, 3425,
-     3431, 3420, 3433, 3437, 3436, 3441, 3442, 3443, 3444, 3445,
-     3446, 3452, 3449, 3453, 3455, 3457, 3462, 3460, 3463, 3469,
-     3470, 3471, 3473, 3480, 3476, 3475, 6714, 6714, 3477, 3478,
-     3490, 3484, 3486, 3492, 3493, 3498, 3499, 3501, 3503, 3505,
-     3512, 6714, 3513, 3514, 3509, 3515, 3522, 3517, 3526, 3534,
-     3532, 3530, 3539, 3536, 6714, 3518, 3540, 3547, 3543, 3546,
-
-     3551, 6714, 3550, 6714, 3548, 3552, 3553, 3557, 3559, 3560,
-     3563, 3564, 3565, 3566, 3570, 3581, 3582, 3574, 3584, 3578,
-     3585, 3586, 3589, 3593, 3596, 3592, 3594, 3595, 6714, 3600,
-     3597, 3604, 3602, 3611, 3615, 3609, 3601, 6714, 3612, 3619,
-     3623, 3625, 3627, 3628, 3629, 3630, 3632, 3634, 3636, 3633,
-     3638, 6714, 3637, 3639, 3652, 3642, 3644, 3651, 3661, 3655,
-     3664, 6714, 3665, 3666, 3673, 3669, 3671, 3672, 3676, 3677,
-     3678, 3680, 3681, 3682, 3684, 3685, 3690, 3686, 3688, 3695,
-     3691, 3703, 3705, 3692, 3713, 3720, 3706, 6714, 3709, 3716,
-     3718, 3719, 3721, 3722, 3724, 3730, 3732, 3726, 3741, 3742,
-
-     3733, 3737, 3745, 3747, 3755, 3750, 6714, 3762, 3748, 3763,
-     3752, 3761, 3760, 3765, 3767, 3769, 3771, 3770, 3773, 3774,
-     3776, 3788, 3780, 3783, 3779, 3784, 3795, 3787, 6714, 3802,
-     3798, 3790, 3806, 3800, 3809, 3816, 3813, 3814, 3815, 3818,
-     3819, 3820, 3823, 3825, 3826, 3829, 3830, 6714, 6714, 3832,
-     3833, 3835, 6714, 3837, 3838, 3848, 3839, 3841, 3849, 3851,
-     3853, 3852, 3854, 3856, 3862, 3863, 6714, 3864, 3871, 3867,
-     3868, 3878, 3874, 6714, 3873, 3883, 3882, 3884, 3885, 3886,
-     3890, 3891, 3893, 3895, 3897, 3898, 3907, 3908, 3900, 3904,
-     3910, 6714, 3905, 3911, 3912, 3916, 3918, 3921, 6714, 3922,
-
-     3924, 3926, 3929, 3931, 3939, 3942, 3932, 3945, 3934, 3947,
-     3949, 3951, 3950, 3952, 3959, 3957, 3954, 3958, 3960, 3965,
-     3966, 3974, 6714, 3962, 3976, 3977, 3980, 6714, 3982, 3989,
-     3990, 6714, 3991, 3986, 3993, 3994, 4001, 6714, 3996, 3999,
-     4002, 4000, 4010, 4005, 4013, 4009, 4011, 4015, 4017, 6714,
-     4018, 4016, 4019, 6714, 4023, 4021, 4033, 4037, 4034, 4044,
-     4039, 4041, 4042, 4040, 6714, 4047, 6714, 4050, 4043, 4056,
-     6714, 4051, 4058, 4059, 4061, 4062, 4067, 4068, 4066, 4075,
-     4065, 4077, 4076, 4078, 4079, 4082, 4090, 4080, 4091, 4081,
-     4088, 6714, 4092, 4089, 4096, 4095, 4108, 4101, 4106, 4103,
-
-     4111, 4112, 6714, 6714, 4114, 6714, 4117, 4119, 4121, 6714,
-     4123, 4122, 4132, 4127, 4128, 4131, 4140, 4134, 6714, 4146,
-     4147, 6714, 4130, 4143, 4156, 4151, 4141, 4152, 4154, 4157,
-     4159, 4161, 4162, 4160, 4164, 4165, 4167, 4171, 6714, 4168,
-     4169, 4181, 4179, 4183, 4184, 4186, 4194, 4185, 6714, 4195,
-     4196, 4197, 4202, 4203, 6714, 4208, 6714, 4206, 4209, 4211,
-     4212, 4213, 4222, 6714, 4219, 4220, 4226, 4227, 4228, 4229,
-     4230, 4236, 4237, 4238, 4245, 4242, 4243, 4240, 4250, 4246,
-     6714, 4248, 4251, 4260, 4261, 4257, 4263, 4270, 4266, 4273,
-     4268, 4269, 4279, 4276, 4280, 4289, 4282, 4287, 4284, 6714,
-
-     4294, 4293, 4296, 4305, 4297, 4298, 4300, 6714, 4301, 4310,
-     4311, 6714, 4308, 4314, 4318, 4320, 4322, 4323, 4326, 4324,
-     4325, 4328, 4330, 6714, 4332, 4333, 4331, 4347, 4348, 4329,
-     6714, 6714, 4350, 6714, 4354, 4336, 4346, 4337, 4357, 4358,
-     4363, 4364, 4366, 4368, 4370, 4371, 4372, 4375, 4383, 4378,
-     4390, 4386, 4397, 4392, 4388, 4379, 6714, 6714, 4402, 4403,
-     4398, 4406, 4408, 4381, 4410, 4417, 4414, 4412, 4416, 4420,
-     4427, 6714, 4422, 4423, 4430, 4424, 6714, 4431, 4432, 4435,
-     4433, 4436, 4439, 4438, 4440, 4442, 4445, 4450, 4451, 4446,
-     4459, 4452, 4453, 4462, 4463, 4465, 4466, 4468, 4473, 6714,
-
-     4469, 4475, 4476, 4480, 4481, 4483, 4485, 4484, 4487, 6714,
-     4489, 6714, 4488, 4493, 4491, 4490, 4499, 4509, 4510, 4511,
-     4512, 4515, 4516, 4519, 4520, 4530, 4521, 4525, 4531, 4533,
-     4535, 4540, 4541, 6714, 4543, 4527, 4537, 4544, 4550, 4552,
-     4553, 4555, 4558, 4560, 4562, 4561, 4564, 4568, 4565, 4569,
-     4170, 4570, 4571, 6714, 4575, 4574, 4581, 4583, 4585, 4586,
-     4588, 4593, 4596, 4587, 4589, 4597, 6714, 4598, 4601, 4608,
-     6714, 4602, 4500, 4610, 4611, 4617, 4605, 4614, 4612, 4618,
-     6714, 4629, 4621, 4623, 4626, 4631, 4632, 4634, 4635, 4637,
-     4642, 4645, 6714, 4653, 4639, 4638, 4652, 4654, 4655, 4656,
-
-     4659, 4658, 6714, 4661, 4662, 4670, 4675, 4678, 4671, 4673,
-     4680, 4676, 4682, 4683, 4686, 4690, 4689, 4691, 4694, 4695,
-     4696, 4707, 4711, 4702, 6714, 4697, 6714, 4709, 4712, 4720,
-     4715, 4719, 4721, 4725, 4723, 6714, 4726, 4731, 4733, 4729,
-     4727, 6714, 4734, 4735, 4737, 4738, 6714, 4753, 4749, 4739,
-     4748, 4741, 4757, 6714, 4762, 4763, 4764, 4771, 4773, 4768,
-     4775, 4770, 4778, 4776, 4772, 4780, 4781, 4789, 4787, 4785,
-     6714, 4791, 4793, 4798, 4800, 4794, 4802, 4792, 4804, 4807,
-     4809, 6714, 4810, 4813, 4814, 4816, 4817, 4818, 4819, 4826,
-     4823, 4825, 4827, 4828, 4831, 4832, 6714, 4837, 4835, 4839,
-
-     4848, 4850, 4852, 6714, 4855, 6714, 4845, 4840, 4857, 4856,
-     4861, 6714, 6714, 4863, 4871, 4866, 4869, 4870, 6714, 6714,
-     4873, 6714, 4874, 6714, 4875, 4877, 6714, 6714, 4876, 4880,
-     4883, 4885, 4886, 4888, 6714, 4895, 6714, 4902, 4897, 4884,
-     4899, 4903, 6714, 4901, 4907, 4905, 4911, 4913, 6714, 4909,
-     4922, 4914, 4915, 6714, 4925, 4926, 4919, 4927, 6714, 4933,
-     4936, 4937, 4928, 4931, 4939, 4941, 4947, 4948, 4951, 4949,
-     4950, 4952, 4953, 4956, 4960, 4965, 4967, 4957, 4968, 4971,
-     4973, 4977, 4975, 4979, 4980, 4981, 4982, 4984, 4989, 4983,
-     4991, 4994, 4985, 4995, 4997, 4998, 5005, 5006, 5008, 5009,
-
-     5013, 5014, 5015, 5016, 5017, 5018, 5019, 5021, 5020, 5026,
-     5031, 5035, 5024, 5034, 6714, 5027, 5037, 5040, 5047, 5046,
-     5048, 5051, 5055, 5058, 5061, 6714, 5064, 6714, 5066, 5052,
-     5068, 5069, 5071, 6714, 5072, 5073, 5074, 5075, 5076, 5077,
-     5078, 5081, 5082, 5084, 5089, 6714, 5094, 5098, 5083, 5099,
-     5104, 6714, 5106, 5110, 5107, 5111, 5113, 5116, 5114, 5117,
-     5118, 5119, 5122, 5124, 5126, 5127, 5130, 5140, 5142, 5143,
-     5133, 5144, 5128, 5148, 5149, 5150, 5152, 5153, 5155, 5161,
-     5163, 5167, 6714, 5156, 6714, 5164, 5168, 5169, 5171, 5174,
-     5177, 5176, 5178, 6714, 6714, 5180, 5183, 5185, 5188, 5189,
-
-     5193, 5190, 5194, 5195, 6714, 5198, 5202, 5205, 5208, 6714,
-     5210, 5211, 5212, 5215, 6714, 5216, 5217, 5218, 5220, 5223,
-     5230, 5233, 5227, 5224, 5234, 5235, 5244, 6714, 6714, 6714,
-     6714, 5247, 5237, 5250, 5239, 5241, 5251, 5253, 5256, 5258,
-     5261, 5263, 6714, 5267, 6714, 6714, 5264, 5268, 5270, 5271,
-     5272, 5274, 5277, 5275, 6714, 5279, 5282, 5285, 5288, 5292,
-     5296, 5297, 5289, 5299, 5300, 5301, 5304, 5305, 5315, 5311,
-     5312, 5310, 5314, 5318, 5321, 6714, 6714, 5324, 5327, 5328,
-     5335, 5333, 5336, 5330, 5345, 5342, 5343, 5340, 5332, 5350,
-     5351, 5359, 5360, 5352, 5355, 6714, 5356, 5361, 5362, 6714,
-
-     5364, 6714, 5368, 5369, 5370, 5371, 5377, 5378, 5379, 5381,
-     6714, 6714, 5375, 5389, 5385, 6714, 6714, 5382, 5392, 5394,
-     5396, 5397, 5398, 5399, 5400, 5403, 5405, 6714, 5406, 6714,
-     5407, 5410, 5419, 5409, 5422, 5426, 5411, 5431, 5433, 5428,
-     5430, 6714, 5437, 5438, 6714, 5445, 5440, 5444, 5441, 5442,
-     6714, 5449, 5447, 5453, 5459, 6714, 5461, 5462, 5463, 6714,
-     5470, 6714, 5454, 5467, 5464, 5479, 5471, 6714, 5475, 5480,
-     6714, 5485, 5487, 5488, 5477, 5489, 6714, 5493, 5482, 6714,
-     5494, 5497, 5498, 5504, 5501, 5506, 5507, 5508, 5509, 5517,
-     5513, 5515, 6714, 6714, 5524, 5522,  135, 5531, 5510, 5521,
-
-     5528, 5529, 5538, 5534, 5536, 5543, 6714, 6714, 5539, 6714,
-     5537, 5546, 6714, 5547, 5550, 5551, 5556, 5555, 5557, 5558,
-     5554, 5562, 5563, 5576, 5566, 5564, 5581, 5571, 5591, 5567,
-     5593, 5594, 5596, 5598, 5600, 5588, 5602, 5603, 5582, 5605,
-     5606, 5609, 5611, 5612, 5613, 6714, 5616, 5618, 5619, 5621,
-     6714, 5627, 5624, 5629, 5630, 6714, 5637, 5634, 5638, 5640,
-     5641, 6714, 5642, 5645, 5648, 5646, 5651, 5653, 5569, 5662,
-     5654, 5657, 5659, 6714, 6714, 6714, 5668, 5672, 6714, 5675,
-     5665, 5658, 5669, 6714, 5677, 5680, 5678, 6714, 6714, 5681,
-     5686, 5684, 6714, 5682, 5694, 6714, 5685, 6714, 5692, 6714,
-
-     5695, 5696, 5698, 5703, 6714, 5704, 5705, 5707, 5710, 6714,
-     5716, 5720, 5723, 5708, 5724, 5726, 5725, 6714, 5733, 5729,
-     5731, 5738, 5728, 5735, 5732, 5743, 5739, 5755, 5740, 5742,
-     6714, 5750, 5751, 5758, 5759, 5752, 5761, 5762, 6714, 5764,
-     6714, 5767, 6714, 5768, 5769, 5770, 5778, 5772, 5773, 5775,
-     5780, 5789, 5786, 5779, 5791, 5794, 5796, 6714, 6714, 5799,
-     5801, 6714, 5802, 6714, 5804, 6714, 5805, 5806, 5807, 5808,
-     5809, 6714, 5811, 5813, 5816, 5826, 5818, 5819, 6714, 5827,
-     5829, 5830, 5832, 6714, 6714, 5834, 5842, 5835, 6714, 5837,
-     5845, 5847, 5848, 5850, 5852, 5853, 5856, 5855, 5866, 5839,
-
-     5857, 5861, 5868, 5862, 5873, 5879, 5883, 6714, 6714, 6714,
-     5874, 5872, 5891, 5888, 5890, 5895, 5878, 6714, 5894, 5898,
-     5900, 5901, 5908, 5904, 5907, 6714, 5903, 5909, 5910, 5911,
-     5913, 5914, 5916, 5917, 6714, 5919, 5929, 5925, 5923, 5931,
-     5939, 5941, 5943, 5934, 5944, 5951, 5948, 6714, 5950, 6714,
-     6714, 5946, 6714, 5952, 5954, 5956, 5955, 5957, 6714, 5960,
-     5961, 5962, 5964, 5963, 5971, 5967, 5969, 6714, 5979, 5972,
-     5982, 5984, 6714, 6714, 5985, 5991, 6714, 5994, 5995, 5988,
-     6003, 5986, 5996, 6008, 6005, 6714, 6009, 6011, 5999, 6012,
-     6015, 6014, 6017, 6714, 6021, 6018, 6022, 6024, 6714, 6025,
-
-     6030, 6031, 6033, 6034, 6714, 6035, 6027, 6051, 6036, 6714,
-     6038, 6050, 6052, 6714, 6714, 6056, 6060, 6057, 6714, 6714,
-     6714, 6063, 6064, 6066, 6068, 6714, 6071, 6075, 6079, 6081,
-     6086, 6074, 6714, 6082, 6088, 6090, 6091, 6092, 6714, 6714,
-     6093, 6094, 6095, 6099, 6096, 6714, 6714, 6101, 6103, 6104,
-     6102, 6105, 6714, 6107, 6112, 6119, 6115, 6121, 6128, 6130,
-     6123, 6131, 6132, 6140, 6143, 6133, 6135, 6142, 6146, 6147,
-     6145, 6149, 6159, 6154, 6156, 6162, 6157, 6165, 6714, 6714,
-     6167, 6714, 6169, 6171, 6714, 6714, 6174, 6176, 6178, 6182,
-     6714, 6184, 6186, 6188, 6190, 6179, 6714, 6191, 6193, 6194,
-
-     6195, 6196, 6714, 6198, 6199, 6202, 6204, 6208, 6210, 6211,
-     6214, 6714, 6209, 6226, 6714, 6714, 6215, 6217, 6206, 6227,
-     6223, 6714, 6231, 6235, 6230, 6237, 6236, 6238, 6243, 6714,
-     6239, 6240, 6714, 6714, 6246, 6247, 6714, 6714, 6248, 6714,
-     6714, 6714, 6714, 6714, 6714, 6714, 6714, 6252, 6251, 6714,
-     6253, 6261, 6264, 6714, 6268, 6714, 6258, 6269, 6271, 6265,
-     6714, 6270, 6714, 6272, 6276, 6277, 6286, 6279, 6289, 6280,
-     6273, 6283, 6291, 6296, 6297, 6299, 6298, 6300, 6302, 6304,
-     6314, 6306, 6311, 6714, 6714, 6714, 6303, 6315, 6319, 6320,
-     6325, 6327, 6331, 6333, 6322, 6334, 6336, 6337, 6338, 6340,
-
-     6344, 6351, 6346, 6349, 6347, 6356, 6348, 6358, 6714, 6363,
-     6364, 6350, 6367, 6714, 6370, 6714, 6353, 6714, 6714, 6373,
-     6374, 6376, 6377, 6386, 6387, 6378, 6382, 6383, 6388, 6390,
-     6714, 6398, 6714, 6714, 6391, 6394, 6714, 6399, 6400, 6714,
-     6401, 6403, 6405, 6406, 6407, 6409, 6410, 6411, 6418, 6714,
-     6714, 6422, 6423, 6425, 6427, 6429, 6436, 6431, 6433, 6435,
-     6443, 6437, 6445, 6714, 6447, 6449, 6451, 6714, 6453, 6452,
-     6455, 6458, 6459, 6466, 6461, 6463, 6714, 6464, 6714, 6468,
-     6470, 6469, 6472, 6473, 6475, 6483, 6481, 6485, 6714, 6487,
-     6489, 6493, 6494, 6496, 6499, 6500, 6501, 6503, 6505, 6506,
-
-     6515, 6509, 6511, 6517, 6519, 6521, 6714, 6523, 6525, 6714,
-     6526, 6527, 6528, 6529, 6533, 6714, 6538, 6530, 6535, 6541,
-     6546, 6543, 6714, 6552, 6556, 6553, 6714, 6557, 6714, 6714,
-     6558, 6559, 6561, 6565, 6567, 6714, 6714, 6714, 6594, 6601,
-     6608, 6615, 6622, 6629, 6636,   88, 6643, 6650, 6657, 6664,
-     6671, 6678, 6685, 6692, 6699, 6706
+        0,    41,    41,    82,    82,   123,   123,   164,   164,   205,
+      205,   246,   246,   287,   287,   328,   328,   328,   369,   330,
+      331,   331,   372,   413,   437,   316,   442,   447,   441,   445,
+      446,   460,   303,   314,   306,   462,   468,   306,   477,   342,
+      478,   492,   487,   466,   505,   387,   427,   529,   462,   462,
+      462,   570,   611,   462,   462,   462,   652,   693,   460,   465,
+      465,   465,   734,   775,   465,   465,   465,   816,   857,   465,
+      898,   465,   939,   437,   980,   465,   482,   482,   482,  1021,
+     1062,   482,   482,   482,  1103,   482,   482,   482,  1144,   482,
+      482,  1185,   482,   465,   471,   484,   486,   481,   500,  1209,
+
+      486,   499,   495,  1207,   500,   491,   501,  1220,   545,   586,
+      581,  1204,   586,   623,   677,   662,   678,   670,  1221,  1223,
+      667,  1213,  1223,   826,   709,   760,   758,   753,   798,   837,
+      834,   828,   883,   910,   964,   951,  1223,   950,   970,   990,
+     1216,  1222,  1208,  1032,  1233,  1242,  1245,  1236,  1244,  1242,
+     1236,  1033,  1236,  1037,  1257,  1080,  1128,  1162,  1226,  1248,
+     1240,  1249,  1280,  1280,  1280,  1280,  1280,  1280,  1280,  1280,
+     1280,  1280,  1280,  1280,  1280,  1280,  1280,  1280,  1291,  1280,
+     1263,  1281,  1281,  1281,  1281,  1281,  1281,  1281,  1281,  1262,
+     1324,  1251,  1255,  1311,  1260,  1267,  1253,  1261,  1315,  1301,
+
+     1313,  1329,  1307,  1319,  1326,  1334,  1331,  1332,  1334,  1325,
+     1319,  1334,  1335,  1330,  1323,  1350,  1341,  1342,  1332,  1335,
+     1335,  1343,  1336,  1351,  1354,  1359,  1356,  1342,  1348,  1372,
+     1366,  1374,  1375,  1350,  1377,  1378,  1355,  1381,  1373,  1387,
+     1378,  1389,  1377,  1391,  1385,  1394,  1369,  1385,  1379,  1385,
+     1382,  1391,  1394,  1389,  1389,  1386,  1413,  1403,  1391,  1406,
+     1396,  1395,  1420,  1397,  1423,  1399,  1415,  1419,  1406,  1416,
+     1430,  1432,  1408,  1434,  1435,  1416,  1430,  1439,  1438,  1440,
+     1433,  1434,  1429,  1437,  1457,  1431,  1425,  1437,  1426,  1443,
+     1426,  1456,  1459,  1449,  1450,  1464,  1444,  1447,  1444,  1449,
+
+     1456,  1461,  1472,  1464,  1466,  1468,  1476,  1453,  1471,  1473,
+     1459,  1461,  1474,  1485,  1471,  1472,  1489,  1470,  1491,  1485,
+     1494,  1487,  1491,  1488,  1500,  1501,  1476,  1479,  1478,  1496,
+     1499,  1499,  1485,  1500,  1500,  1488,  1506,  1492,  1508,  1500,
+     1519,  1512,  1504,  1512,  1508,  1500,  1517,  1520,  1523,  1514,
+     1521,  1532,  1543,  1533,  1540,  1523,  1550,  1531,  1530,  1541,
+     1542,  1553,  1548,  1553,  1537,  1555,  1542,  1553,  1547,  1541,
+     1560,  1547,  1569,  1563,  1579,  1545,  1562,  1574,  1564,  1565,
+     1566,  1569,  1570,  1573,  1569,  1578,  1587,  1583,  1578,  1584,
+     1585,  1570,  1607,  1576,  1580,  1582,  1612,  1604,  1584,  1615,
+
+     1584,  1591,  1617,  1598,  1619,  1591,  1595,  1604,  1611,  1602,
+     1628,  1614,  1613,  1621,  1642,  1633,  1619,  1621,  1627,  1638,
+     1629,  1651,  1646,  1628,  1637,  1636,  1658,  1652,  1660,  1650,
+     1660,  1639,  1644,  1645,  1648,  1664,  1661,  1664,  1663,  1668,
+     1651,  1656,  1656,  1668,  1660,  1671,  1670,  1691,  1680,  1685,
+     1688,  1685,  1701,  1682,  1691,  1694,  1696,  1695,  1681,  1701,
+     1691,  1711,  1702,  1695,  1708,  1718,  1709,  1699,  1694,  1712,
+     1713,  1718,  1708,  1701,  1704,  1711,  1722,  1721,  1724,  1717,
+     1729,  1726,  1711,  1732,  1720,  1749,  1734,  1750,  1715,  1743,
+     1737,  1730,  1719,  1736,  1723,  1732,  1759,  1727,  1728,  1739,
+
+     1729,  1736,  1758,  1744,  1760,  1750,  1743,  1750,  1756,  1746,
+     1747,  1769,  1744,  1762,  1772,  1763,  1754,  1764,  1748,  1750,
+     1768,  1768,  1759,  1770,  1771,  1758,  1779,  1777,  1795,  1761,
+     1761,  1769,  1782,  1769,  1784,  1778,  1791,  1793,  1784,  1795,
+     1785,  1796,  1812,  1813,  1793,  1804,  1794,  1808,  1809,  1793,
+     1814,  1801,  1824,  1818,  1805,  1817,  1807,  1804,  1802,  1820,
+     1817,  1822,  1809,  1815,  1828,  1845,  1819,  1822,  1832,  1834,
+     1845,  1828,  1826,  1823,  1839,  1829,  1827,  1842,  1835,  1845,
+     1835,  1847,  1852,  1862,  1845,  1864,  1850,  1860,  1850,  1851,
+     1862,  1865,  1860,  1855,  1878,  1872,  1875,  1876,  1884,  1881,
+
+     1882,  1888,  1889,  1879,  1874,  1884,  1884,  1871,  1883,  1889,
+     1888,  1882,  1876,  1892,  1903,  1894,  1881,  1896,  1888,  1902,
+     1891,  1886,  1903,  1893,  1898,  1917,  1907,  1899,  1911,  1897,
+     1915,  1899,  1904,  1916,  1919,  1911,  1911,  1941,  1933,  1934,
+     1926,  1927,  1927,  1930,  1929,  1919,  1918,  1932,  1925,  1935,
+     1921,  1943,  1936,  1927,  1926,  1933,  1941,  1939,  1958,  1948,
+     1952,  1961,  1953,  1955,  1943,  1943,  1950,  1960,  1948,  1974,
+     1964,  1976,  1968,  1956,  1953,  1969,  1981,  1964,  1965,  1978,
+     1988,  1965,  1976,  1981,  1967,  1987,  1982,  1987,  1997,  1980,
+     1989,  2001,  1999,  1995,  1974,  1999,  1983,  2004,  1989,  1990,
+
+     1991,  1991,  1991,  2018,  2009,  2005,  2002,  2003,  2001,  2001,
+     2009,  2007,  2029,  2004,  2011,  2014,  2009,  2016,  2011,  2028,
+     2015,  2019,  2016,  2021,  2017,  2040,  2028,  2042,  2040,  2026,
+     2033,  2044,  2030,  2049,  2037,  2047,  2037,  2060,  2036,  2043,
+     2050,  2053,  2052,  2057,  2058,  2046,  2058,  2048,  2058,  2055,
+     2061,  2077,  2060,  2079,  2069,  2072,  2073,  2064,  2070,  2065,
+     2067,  2064,  2084,  2086,  2074,  2090,  2085,  2082,  2106,  2073,
+     2099,  2074,  2092,  2085,  2079,  2081,  2107,  2097,  2096,  2088,
+     2082,  2088,  2107,  2124,  2095,  2125,  2125,  2104,  2127,  2127,
+     2104,  2109,  2131,  2111,  2109,  2104,  2119,  2123,  2124,  2134,
+
+     2112,  2117,  2112,  2139,  2134,  2129,  2118,  2122,  2138,  2144,
+     2140,  2142,  2129,  2134,  2125,  2148,  2160,  2148,  2155,  2142,
+     2153,  2160,  2157,  2158,  2161,  2160,  2167,  2167,  2158,  2152,
+     2168,  2154,  2156,  2170,  2176,  2164,  2166,  2180,  2164,  2171,
+     2166,  2191,  2181,  2190,  2196,  2205,  2186,  2199,  2175,  2202,
+     2192,  2204,  2196,  2194,  2193,  2203,  2204,  2196,  2187,  2201,
+     2206,  2203,  2191,  2206,  2193,  2215,  2210,  2208,  2218,  2206,
+     2226,  2202,  2237,  2214,  2215,  2206,  2225,  2222,  2219,  2226,
+     2225,  2220,  2208,  2226,  2231,  2243,  2237,  2235,  2220,  2232,
+     2219,  2227,  2243,  2261,  2238,  2246,  2252,  2254,  2250,  2235,
+
+     2239,  2238,  2259,  2241,  2253,  2247,  2260,  2247,  2247,  2273,
+     2259,  2257,  2252,  2258,  2267,  2269,  2260,  2275,  2284,  2265,
+     2265,  2277,  2267,  2280,  2269,  2268,  2272,  2272,  2299,  2300,
+     2281,  2302,  2294,  2284,  2292,  2280,  2308,  2309,  2300,  2286,
+     2286,  2296,  2304,  2289,  2310,  2319,  2311,  2297,  2304,  2324,
+     2311,  2301,  2323,  2306,  2322,  2321,  2311,  2334,  2325,  2327,
+     2331,  2312,  2315,  2331,  2318,  2352,  2318,  2325,  2340,  2357,
+     2330,  2324,  2324,  2343,  2346,  2345,  2335,  2352,  2333,  2351,
+     2341,  2343,  2355,  2347,  2368,  2354,  2351,  2362,  2353,  2364,
+     2358,  2366,  2358,  2352,  2360,  2366,  2371,  2375,  2387,  2388,
+
+     2384,  2389,  2391,  2364,  2368,  2383,  2389,  2379,  2389,  2382,
+     2386,  2398,  2395,  2403,  2388,  2386,  2387,  2408,  2416,  2407,
+     2401,  2396,  2400,  2399,  2419,  2416,  2407,  2433,  2425,  2419,
+     2404,  2421,  2423,  2417,  2436,  2426,  2413,  2447,  2429,  2424,
+     2421,  2445,  2431,  2422,  2437,  2423,  2430,  2425,  2434,  2438,
+     2439,  2443,  2438,  2457,  2466,  2436,  2467,  2439,  2434,  2451,
+     2439,  2445,  2442,  2456,  2457,  2458,  2478,  2478,  2459,  2456,
+     2467,  2449,  2475,  2461,  2457,  2460,  2488,  2458,  2481,  2490,
+     2482,  2477,  2474,  2468,  2463,  2475,  2469,  2468,  2474,  2473,
+     2495,  2470,  2497,  2477,  2488,  2480,  2509,  2492,  2490,  2492,
+
+     2493,  2483,  2492,  2497,  2498,  2490,  2493,  2520,  2500,  2492,
+     2503,  2516,  2514,  2503,  2496,  2512,  2522,  2499,  2505,  2501,
+     2519,  2512,  2532,  2533,  2523,  2524,  2536,  2526,  2538,  2547,
+     2528,  2516,  2515,  2542,  2532,  2539,  2530,  2531,  2523,  2531,
+     2540,  2541,  2540,  2538,  2542,  2543,  2531,  2540,  2534,  2561,
+     2562,  2539,  2564,  2554,  2561,  2542,  2559,  2551,  2568,  2547,
+     2557,  2548,  2562,  2575,  2584,  2551,  2566,  2573,  2569,  2571,
+     2557,  2592,  2564,  2565,  2569,  2578,  2575,  2586,  2588,  2594,
+     2595,  2574,  2575,  2587,  2591,  2590,  2582,  2583,  2593,  2584,
+     2582,  2595,  2588,  2585,  2619,  2606,  2592,  2589,  2594,  2604,
+
+     2591,  2607,  2627,  2620,  2612,  2610,  2618,  2611,  2605,  2617,
+     2603,  2607,  2618,  2623,  2610,  2619,  2627,  2619,  2626,  2615,
+     2652,  2639,  2634,  2635,  2621,  2637,  2639,  2635,  2630,  2631,
+     2628,  2636,  2634,  2643,  2639,  2633,  2634,  2636,  2650,  2642,
+     2638,  2639,  2651,  2646,  2643,  2651,  2645,  2666,  2651,  2647,
+     2682,  2674,  2654,  2656,  2663,  2653,  2659,  2669,  2671,  2667,
+     2686,  2662,  2668,  2679,  2682,  2685,  2675,  2680,  2701,  2695,
+     2692,  2690,  2706,  2696,  2697,  2702,  2684,  2705,  2704,  2690,
+     2696,  2718,  2704,  2695,  2711,  2703,  2700,  2725,  2726,  2716,
+     2718,  2718,  2715,  2720,  2712,  2726,  2739,  2723,  2744,  2727,
+
+     2735,  2725,  2723,  2733,  2749,  2731,  2737,  2734,  2744,  2736,
+     2742,  2747,  2734,  2740,  2763,  2757,  2759,  2745,  2756,  2748,
+     2754,  2757,  2747,  2759,  2763,  2765,  2772,  2757,  2774,  2780,
+     2790,  2773,  2772,  2759,  2770,  2781,  2767,  2786,  2787,  2784,
+     2787,  2770,  2793,  2773,  2785,  2792,  2776,  2803,  2793,  2790,
+     2798,  2783,  2817,  2800,  2789,  2800,  2786,  2793,  2804,  2802,
+     2806,  2818,  2810,  2820,  2810,  2816,  2813,  2802,  2822,  2813,
+     2824,  2822,  2839,  2831,  2832,  2822,  2835,  2821,  2813,  2835,
+     2835,  2838,  2818,  2818,  2854,  2822,  2831,  2827,  2823,  2841,
+     2851,  2853,  2842,  2863,  2855,  2836,  2832,  2834,  2834,  2850,
+
+     2843,  2840,  2858,  2841,  2838,  2847,  2861,  2868,  2845,  2864,
+     2884,  2851,  2877,  2854,  2864,  2867,  2863,  2884,  2864,  2875,
+     2872,  2882,  2871,  2900,  2892,  2883,  2889,  2895,  2871,  2875,
+     2874,  2890,  2891,  2879,  2878,  2897,  2883,  2918,  2890,  2887,
+     2888,  2906,  2905,  2892,  2892,  2918,  2901,  2895,  2901,  2901,
+     2902,  2899,  2914,  2913,  2917,  2905,  2915,  2924,  2911,  2918,
+     2908,  2928,  2936,  2937,  2919,  2940,  2931,  2925,  2919,  2937,
+     2949,  2950,  2951,  2943,  2946,  2948,  2964,  2951,  2947,  2943,
+     2935,  2942,  2941,  2941,  2950,  2957,  2939,  2952,  2956,  2948,
+     2947,  2971,  2973,  2948,  2968,  2966,  2954,  2965,  2970,  2957,
+
+     2957,  2960,  2985,  2975,  2961,  2968,  2989,  2965,  2980,  2993,
+     2972,  2970,  2971,  2973,  2994,  2983,  2997,  2984,  2999,  2998,
+     2983,  2984,  2992,  3006,  3009,  3004,  2998,  3007,  3007,  3004,
+     3001,  3015,  3030,  3013,  3001,  3017,  3008,  3004,  3016,  3027,
+     3022,  3034,  3014,  3017,  3026,  3029,  3031,  3016,  3019,  3029,
+     3019,  3046,  3029,  3043,  3057,  3025,  3058,  3023,  3040,  3045,
+     3053,  3028,  3063,  3050,  3064,  3047,  3052,  3036,  3037,  3068,
+     3051,  3034,  3036,  3048,  3038,  3058,  3045,  3040,  3059,  3058,
+     3059,  3064,  3054,  3058,  3050,  3054,  3076,  3052,  3052,  3061,
+     3089,  3074,  3062,  3061,  3075,  3066,  3068,  3084,  3080,  3065,
+
+     3085,  3066,  3084,  3086,  3072,  3088,  3100,  3110,  3097,  3103,
+     3087,  3093,  3086,  3086,  3091,  3087,  3094,  3084,  3109,  3106,
+     3092,  3093,  3109,  3116,  3107,  3113,  3099,  3118,  3116,  3128,
+     3103,  3130,  3139,  3111,  3127,  3108,  3122,  3143,  3124,  3115,
+     3130,  3131,  3119,  3116,  3134,  3134,  3137,  3123,  3131,  3122,
+     3141,  3151,  3141,  3145,  3165,  3142,  3147,  3128,  3151,  3156,
+     3163,  3164,  3155,  3160,  3161,  3169,  3160,  3157,  3149,  3149,
+     3149,  3168,  3178,  3179,  3169,  3181,  3177,  3172,  3179,  3174,
+     3162,  3161,  3162,  3169,  3170,  3171,  3168,  3162,  3184,  3187,
+     3171,  3205,  3197,  3180,  3180,  3200,  3175,  3191,  3177,  3178,
+
+     3187,  3209,  3218,  3205,  3185,  3201,  3196,  3216,  3206,  3198,
+     3195,  3196,  3206,  3201,  3224,  3205,  3213,  3207,  3238,  3209,
+     3241,  3202,  3229,  3234,  3235,  3223,  3218,  3234,  3239,  3226,
+     3221,  3236,  3239,  3238,  3225,  3229,  3237,  3228,  3233,  3240,
+     3241,  3242,  3259,  3255,  3269,  3235,  3243,  3239,  3244,  3243,
+     3266,  3256,  3250,  3277,  3277,  3238,  3263,  3248,  3266,  3252,
+     3260,  3265,  3270,  3263,  3274,  3269,  3258,  3278,  3260,  3288,
+     3294,  3266,  3268,  3271,  3281,  3294,  3271,  3291,  3297,  3287,
+     3280,  3301,  3290,  3288,  3312,  3278,  3286,  3307,  3289,  3300,
+     3310,  3320,  3298,  3321,  3293,  3289,  3302,  3306,  3304,  3301,
+
+     3306,  3304,  3304,  3305,  3321,  3327,  3328,  3310,  3305,  3326,
+     3306,  3309,  3309,  3320,  3336,  3330,  3327,  3320,  3340,  3318,
+     3338,  3320,  3334,  3357,  3344,  3324,  3342,  3342,  3344,  3345,
+     3342,  3339,  3333,  3369,  3354,  3347,  3354,  3346,  3344,  3361,
+     3342,  3355,  3346,  3367,  3354,  3362,  3358,  3359,  3357,  3388,
+     3355,  3355,  3382,  3365,  3360,  3373,  3381,  3378,  3383,  3397,
+     3378,  3375,  3391,  3387,  3375,  3386,  3386,  3370,  3393,  3375,
+     3376,  3390,  3391,  3388,  3386,  3384,  3395,  3392,  3383,  3399,
+     3400,  3391,  3408,  3414,  3391,  3423,  3390,  3394,  3409,  3397,
+     3416,  3405,  3419,  3423,  3424,  3404,  3427,  3426,  3407,  3408,
+
+     3431,  3427,  3439,  3431,  3449,  3441,  3418,  3443,  3436,  3437,
+     3442,  3422,  3438,  3445,  3430,  3425,  3442,  3447,  3444,  3456,
+     3439,  3434,  3438,  3437,  3465,  3466,  3442,  3477,  3469,  3450,
+     3450,  3464,  3465,  3455,  3477,  3473,  3453,  3453,  3476,  3476,
+     3457,  3478,  3460,  3477,  3483,  3486,  3466,  3501,  3501,  3488,
+     3464,  3481,  3505,  3482,  3471,  3499,  3489,  3496,  3475,  3482,
+     3493,  3492,  3490,  3477,  3503,  3488,  3481,  3492,  3523,  3515,
+     3516,  3491,  3505,  3519,  3512,  3529,  3513,  3522,  3518,  3499,
+     3514,  3512,  3502,  3504,  3512,  3522,  3508,  3501,  3527,  3543,
+     3535,  3536,  3511,  3518,  3530,  3549,  3515,  3527,  3532,  3539,
+
+     3523,  3525,  3555,  3522,  3539,  3543,  3546,  3536,  3539,  3548,
+     3547,  3542,  3557,  3552,  3565,  3541,  3556,  3542,  3543,  3570,
+     3547,  3551,  3562,  3563,  3575,  3569,  3567,  3586,  3563,  3564,
+     3557,  3584,  3582,  3596,  3583,  3590,  3591,  3571,  3572,  3601,
+     3567,  3574,  3599,  3568,  3590,  3584,  3604,  3601,  3615,  3589,
+     3598,  3591,  3597,  3611,  3602,  3613,  3609,  3604,  3590,  3591,
+     3607,  3601,  3628,  3602,  3596,  3611,  3632,  3615,  3618,  3621,
+     3622,  3603,  3606,  3633,  3622,  3624,  3624,  3632,  3646,  3627,
+     3648,  3631,  3623,  3635,  3651,  3625,  3626,  3634,  3641,  3633,
+     3638,  3639,  3642,  3647,  3627,  3639,  3645,  3631,  3647,  3647,
+
+     3659,  3636,  3646,  3638,  3643,  3672,  3657,  3641,  3651,  3641,
+     3663,  3656,  3654,  3668,  3663,  3657,  3685,  3685,  3672,  3687,
+     3670,  3668,  3659,  3690,  3670,  3664,  3685,  3677,  3680,  3681,
+     3687,  3679,  3702,  3689,  3689,  3706,  3683,  3690,  3699,  3694,
+     3699,  3679,  3699,  3693,  3682,  3689,  3693,  3695,  3693,  3697,
+     3694,  3697,  3697,  3707,  3728,  3694,  3692,  3704,  3718,  3706,
+     3699,  3717,  3717,  3705,  3741,  3718,  3723,  3727,  3713,  3727,
+     3726,  3748,  3725,  3749,  3717,  3727,  3725,  3736,  3740,  3746,
+     3755,  3739,  3736,  3744,  3718,  3736,  3741,  3745,  3743,  3744,
+     3746,  3734,  3733,  3760,  3750,  3744,  3744,  3764,  3753,  3776,
+
+     3743,  3745,  3751,  3767,  3766,  3754,  3748,  3776,  3766,  3770,
+     3757,  3769,  3777,  3766,  3778,  3779,  3772,  3777,  3765,  3800,
+     3771,  3778,  3786,  3787,  3797,  3780,  3784,  3782,  3787,  3811,
+     3785,  3793,  3794,  3814,  3787,  3781,  3793,  3804,  3786,  3787,
+     3794,  3799,  3795,  3796,  3807,  3797,  3828,  3802,  3803,  3796,
+     3812,  3813,  3810,  3815,  3835,  3835,  3835,  3816,  3835,  3822,
+     3818,  3810,  3821,  3835,  3828,  3825,  3815,  3814,  3813,  3830,
+     3854,  3841,  3832,  3843,  3834,  3840,  3840,  3833,  3829,  3843,
+     3831,  3857,  3832,  3861,  3862,  3863,  3855,  3851,  3841,  3876,
+     3876,  3868,  3864,  3863,  3856,  3867,  3867,  3857,  3852,  3877,
+
+     3867,  3872,  3875,  3870,  3882,  3894,  3876,  3861,  3878,  3863,
+     3898,  3859,  3880,  3868,  3872,  3883,  3872,  3883,  3873,  3889,
+     3891,  3897,  3894,  3885,  3896,  3883,  3885,  3892,  3911,  3901,
+     3904,  3890,  3911,  3925,  3917,  3893,  3895,  3892,  3917,  3899,
+     3907,  3908,  3900,  3936,  3907,  3937,  3910,  3925,  3921,  3935,
+     3932,  3927,  3930,  3922,  3922,  3925,  3928,  3941,  3944,  3942,
+     3946,  3941,  3932,  3935,  3948,  3941,  3952,  3953,  3949,  3969,
+     3950,  3945,  3938,  3947,  3961,  3958,  3963,  3944,  3965,  3948,
+     3969,  3954,  3965,  3972,  3973,  3959,  3965,  3962,  3962,  3958,
+     3992,  3973,  3978,  3983,  3964,  3990,  3986,  3968,  3981,  3985,
+
+     3988,  3991,  3972,  3977,  3992,  4009,  3980,  3997,  3978,  3999,
+     4013,  3979,  3995,  3986,  4001,  4003,  3987,  4003,  3994,  3995,
+     4025,  4012,  3992,  4006,  4000,  3997,  3998,  4018,  4020,  4019,
+     4013,  4021,  4022,  4040,  4032,  4015,  4023,  4009,  4026,  4038,
+     4035,  4017,  4031,  4011,  4053,  4034,  4036,  4028,  4050,  4051,
+     4026,  4034,  4035,  4057,  4047,  4048,  4029,  4042,  4057,  4056,
+     4053,  4050,  4052,  4053,  4065,  4050,  4045,  4049,  4063,  4068,
+     4061,  4070,  4078,  4079,  4082,  4088,  4054,  4089,  4066,  4076,
+     4084,  4078,  4075,  4072,  4073,  4082,  4083,  4073,  4104,  4085,
+     4075,  4093,  4079,  4087,  4091,  4112,  4087,  4082,  4085,  4091,
+
+     4118,  4101,  4100,  4086,  4095,  4109,  4108,  4124,  4111,  4108,
+     4108,  4120,  4121,  4107,  4118,  4104,  4118,  4108,  4107,  4128,
+     4122,  4130,  4111,  4121,  4141,  4126,  4125,  4130,  4126,  4123,
+     4124,  4114,  4131,  4137,  4124,  4152,  4133,  4119,  4121,  4128,
+     4139,  4124,  4140,  4152,  4145,  4144,  4131,  4133,  4148,  4153,
+     4169,  4143,  4153,  4152,  4164,  4165,  4151,  4162,  4177,  4154,
+     4179,  4147,  4152,  4166,  4165,  4169,  4170,  4186,  4186,  4168,
+     4181,  4164,  4178,  4169,  4193,  4174,  4194,  4181,  4195,  4163,
+     4196,  4168,  4167,  4198,  4198,  4179,  4159,  4165,  4182,  4183,
+     4190,  4165,  4205,  4192,  4183,  4207,  4199,  4193,  4180,  4178,
+
+     4193,  4215,  4196,  4199,  4191,  4192,  4219,  4206,  4220,  4197,
+     4213,  4190,  4207,  4224,  4211,  4208,  4193,  4195,  4228,  4213,
+     4217,  4212,  4200,  4210,  4211,  4216,  4221,  4210,  4211,  4214,
+     4222,  4212,  4209,  4226,  4234,  4235,  4236,  4237,  4238,  4226,
+     4221,  4235,  4240,  4241,  4231,  4224,  4233,  4226,  4235,  4233,
+     4250,  4251,  4232,  4253,  4254,  4256,  4236,  4238,  4246,  4258,
+     4248,  4275,  4249,  4243,  4262,  4250,  4248,  4249,  4265,  4251,
+     4252,  4274,  4265,  4255,  4256,  4278,  4279,  4265,  4279,  4268,
+     4271,  4282,  4274,  4269,  4287,  4280,  4275,  4277,  4308,  4276,
+     4273,  4287,  4282,  4295,  4285,  4296,  4297,  4305,  4307,  4306,
+
+     4322,  4307,  4323,  4308,  4292,  4301,  4295,  4300,  4330,  4296,
+     4299,  4296,  4299,  4311,  4301,  4320,  4303,  4306,  4307,  4325,
+     4341,  4328,  4314,  4307,  4321,  4332,  4346,  4323,  4334,  4316,
+     4317,  4329,  4322,  4321,  4322,  4325,  4323,  4344,  4345,  4325,
+     4328,  4343,  4351,  4352,  4358,  4335,  4339,  4352,  4337,  4343,
+     4355,  4355,  4341,  4342,  4358,  4362,  4366,  4364,  4368,  4382,
+     4349,  4370,  4385,  4362,  4353,  4362,  4353,  4372,  4373,  4359,
+     4361,  4395,  4382,  4396,  4369,  4363,  4381,  4386,  4371,  4370,
+     4390,  4391,  4376,  4388,  4407,  4378,  4390,  4396,  4383,  4411,
+     4382,  4378,  4379,  4401,  4415,  4389,  4394,  4400,  4402,  4407,
+
+     4388,  4410,  4405,  4402,  4410,  4401,  4394,  4416,  4430,  4430,
+     4430,  4430,  4430,  4415,  4398,  4419,  4406,  4408,  4413,  4414,
+     4416,  4428,  4408,  4417,  4415,  4445,  4432,  4446,  4446,  4427,
+     4421,  4435,  4430,  4422,  4433,  4440,  4435,  4421,  4422,  4440,
+     4437,  4425,  4437,  4439,  4462,  4433,  4444,  4445,  4436,  4453,
+     4454,  4450,  4449,  4454,  4441,  4462,  4453,  4464,  4459,  4447,
+     4448,  4473,  4463,  4458,  4471,  4458,  4469,  4476,  4477,  4491,
+     4491,  4464,  4479,  4478,  4488,  4478,  4479,  4471,  4494,  4485,
+     4485,  4482,  4477,  4485,  4486,  4501,  4502,  4492,  4486,  4513,
+     4492,  4495,  4498,  4516,  4490,  4517,  4498,  4499,  4487,  4493,
+
+     4499,  4500,  4509,  4502,  4526,  4526,  4494,  4519,  4520,  4529,
+     4529,  4510,  4504,  4498,  4503,  4520,  4513,  4516,  4503,  4514,
+     4510,  4528,  4511,  4545,  4516,  4546,  4512,  4547,  4529,  4535,
+     4510,  4542,  4543,  4520,  4545,  4541,  4555,  4540,  4537,  4538,
+     4558,  4535,  4533,  4561,  4553,  4545,  4545,  4545,  4536,  4566,
+     4551,  4535,  4555,  4556,  4570,  4557,  4554,  4555,  4536,  4576,
+     4563,  4577,  4543,  4559,  4553,  4572,  4555,  4582,  4548,  4568,
+     4584,  4571,  4573,  4570,  4561,  4562,  4590,  4577,  4578,  4561,
+     4594,  4560,  4556,  4569,  4584,  4583,  4586,  4600,  4587,  4582,
+     4579,  4581,  4576,  4593,  4580,  4576,  4581,  4602,  4598,  4594,
+
+     4613,  4613,  4600,  4580,  4607,  4597,  4617,  4588,  4610,  4606,
+     4586,  4587,  4602,  4616,  4606,  4587,  4609,  4616,  4630,  4630,
+     4611,  4632,  4610,  4617,  4635,  4596,  4619,  4622,  4607,  4621,
+     4609,  4608,  4617,  4633,  4619,  4631,  4621,  4617,  4629,  4644,
+     4645,  4621,  4642,  4644,  4645,  4646,  4647,  4633,  4645,  4631,
+     4648,  4649,  4636,  4651,  4648,  4638,  4639,  4661,  4675,  4662,
+     4648,  4664,  4661,  4647,  4680,  4667,  4664,  4670,  4665,  4686,
+     4673,  4664,  4666,  4667,  4668,  4692,  4671,  4661,  4681,  4677,
+     4673,  4664,  4676,  4670,  4694,  4673,  4681,  4690,  4709,  4709,
+     4709,  4690,  4697,  4698,  4712,  4699,  4685,  4680,  4683,  4716,
+
+     4703,  4694,  4699,  4720,  4720,  4681,  4702,  4699,  4723,  4723,
+     4710,  4716,  4718,  4708,  4728,  4702,  4730,  4730,  4717,  4705,
+     4719,  4720,  4734,  4715,  4716,  4722,  4713,  4738,  4719,  4726,
+     4701,  4714,  4714,  4711,  4731,  4747,  4734,  4735,  4737,  4728,
+     4718,  4740,  4736,  4737,  4757,  4749,  4739,  4740,  4747,  4729,
+     4736,  4728,  4745,  4733,  4758,  4728,  4755,  4770,  4752,  4752,
+     4753,  4758,  4741,  4762,  4747,  4777,  4743,  4778,  4765,  4779,
+     4752,  4753,  4763,  4759,  4764,  4751,  4763,  4768,  4773,  4766,
+     4758,  4779,  4780,  4762,  4796,  4796,  4762,  4797,  4784,  4785,
+     4799,  4764,  4800,  4787,  4801,  4771,  4773,  4785,  4775,  4787,
+
+     4788,  4808,  4795,  4775,  4787,  4803,  4775,  4780,  4815,  4800,
+     4797,  4784,  4805,  4820,  4820,  4820,  4786,  4813,  4803,  4823,
+     4790,  4810,  4814,  4801,  4795,  4818,  4807,  4815,  4821,  4812,
+     4836,  4817,  4838,  4804,  4831,  4807,  4828,  4808,  4830,  4844,
+     4831,  4816,  4829,  4824,  4832,  4835,  4852,  4852,  4852,  4826,
+     4819,  4855,  4847,  4843,  4840,  4850,  4836,  4860,  4841,  4848,
+     4843,  4830,  4857,  4835,  4856,  4870,  4844,  4839,  4853,  4846,
+     4861,  4842,  4847,  4855,  4879,  4866,  4867,  4862,  4870,  4865,
+     4872,  4873,  4874,  4861,  4863,  4882,  4872,  4893,  4880,  4871,
+     4895,  4895,  4862,  4896,  4873,  4861,  4866,  4864,  4888,  4896,
+
+     4902,  4889,  4865,  4873,  4879,  4889,  4887,  4899,  4900,  4914,
+     4906,  4881,  4883,  4898,  4918,  4918,  4886,  4906,  4920,  4907,
+     4903,  4909,  4925,  4897,  4913,  4919,  4915,  4910,  4917,  4912,
+     4933,  4933,  4920,  4915,  4901,  4902,  4903,  4920,  4914,  4929,
+     4943,  4921,  4911,  4911,  4912,  4947,  4915,  4920,  4920,  4918,
+     4935,  4955,  4936,  4923,  4950,  4940,  4960,  4926,  4948,  4949,
+     4963,  4963,  4950,  4951,  4948,  4967,  4967,  4967,  4954,  4949,
+     4936,  4957,  4971,  4945,  4959,  4962,  4966,  4962,  4968,  4981,
+     4963,  4982,  4963,  4964,  4971,  4953,  4958,  4988,  4988,  4954,
+     4955,  4972,  4980,  4960,  4995,  4995,  4973,  4962,  4976,  4998,
+
+     4980,  4976,  4971,  5002,  4970,  4984,  4991,  4966,  4983,  4999,
+     4995,  4996,  4982,  4994,  4992,  5008,  5009,  4980,  4991,  4989,
+     5004,  5006,  5013,  5015,  5021,  5017,  5018,  5019,  5004,  5015,
+     5035,  5035,  5022,  5036,  5023,  5015,  5039,  5020,  5040,  5027,
+     5028,  5029,  5030,  5044,  5031,  5032,  5034,  5035,  5026,  5050,
+     5027,  5038,  5029,  5041,  5019,  5055,  5042,  5023,  5044,  5047,
+     5032,  5043,  5037,  5049,  5052,  5068,  5060,  5040,  5058,  5072,
+     5072,  5053,  5056,  5034,  5061,  5045,  5078,  5061,  5071,  5067,
+     5062,  5049,  5051,  5071,  5086,  5066,  5064,  5088,  5088,  5075,
+     5061,  5091,  5091,  5051,  5079,  5094,  5094,  5094,  5094,  5094,
+
+     5094,  5094,  5094,  5075,  5079,  5097,  5070,  5085,  5086,  5100,
+     5087,  5089,  5103,  5080,  5081,  5087,  5093,  5107,  5090,  5080,
+     5109,  5072,  5085,  5092,  5096,  5084,  5100,  5089,  5085,  5087,
+     5090,  5104,  5094,  5101,  5099,  5107,  5120,  5110,  5130,  5117,
+     5098,  5114,  5134,  5134,  5134,  5134,  5106,  5101,  5123,  5114,
+     5112,  5126,  5125,  5128,  5129,  5111,  5111,  5129,  5128,  5129,
+     5110,  5121,  5143,  5124,  5127,  5135,  5143,  5123,  5145,  5159,
+     5146,  5131,  5129,  5150,  5164,  5135,  5150,  5166,  5136,  5167,
+     5167,  5154,  5154,  5148,  5139,  5165,  5166,  5147,  5163,  5144,
+     5159,  5166,  5180,  5167,  5181,  5181,  5168,  5148,  5183,  5155,
+
+     5151,  5170,  5186,  5152,  5168,  5156,  5164,  5165,  5160,  5175,
+     5176,  5183,  5197,  5197,  5163,  5166,  5166,  5167,  5188,  5183,
+     5196,  5190,  5187,  5188,  5189,  5176,  5202,  5211,  5198,  5193,
+     5200,  5201,  5215,  5197,  5183,  5209,  5185,  5186,  5212,  5188,
+     5195,  5223,  5208,  5224,  5224,  5211,  5202,  5207,  5194,  5196,
+     5204,  5217,  5214,  5207,  5235,  5208,  5222,  5205,  5224,  5225,
+     5222,  5221,  5210,  5231,  5226,  5230,  5234,  5229,  5230,  5219,
+     5234,  5221,  5255,  5242,  5223,  5257,  5238,  5239,  5226,  5227,
+     5246,  5262,  5249,  5230,  5231,  5250,  5253,  5246,  5268,  5255,
+     5256,  5249,  5271,  5252,  5272,  5272,  5253,  5240,  5241,  5262,
+
+     5263,  5277,  5277,  5278
     } ;
 
-static const flex_int16_t yy_def[3457] =
+static const flex_int16_t yy_def[3705] =
     {   0,
-     3438,    1, 3439, 3439, 3440, 3440, 3441, 3441, 3442, 3442,
-     3443, 3443, 3444, 3444, 3445, 3445, 3438, 3446, 3438, 3438,
-     3438, 3438, 3447, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3448, 3438, 3438, 3438,
-     3448, 3449, 3438, 3438, 3438, 3449, 3450, 3438, 3438, 3438,
-     3438, 3450, 3451, 3438, 3438, 3438, 3451, 3452, 3438, 3453,
-     3438, 3452, 3452, 3454, 3438, 3438, 3438, 3438, 3454, 3455,
-     3438, 3438, 3438, 3455, 3446, 3446, 3438, 3456, 3447, 3456,
-     3447, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3448,
-     3448, 3449, 3449, 3450, 3450, 3438, 3451, 3451, 3452, 3452,
-     3453, 3453, 3452, 3454, 3454, 3438, 3455, 3455, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3452, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3452, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3452, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3452, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3438, 3438, 3446, 3438, 3438, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3452, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3452, 3452, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3452,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3452, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3438, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3452, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3452, 3446, 3438,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3438, 3438, 3446, 3438, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3438, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3452,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3452, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3438, 3438, 3446, 3446, 3446, 3446, 3446, 3438, 3438,
-     3446, 3438, 3446, 3438, 3446, 3446, 3438, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3452,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3438, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438, 3438,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3438, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3452, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3438,
-
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3438, 3446, 3446, 3446, 3438, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3438,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3438, 3446, 3446, 3452, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438, 3446, 3438,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3438, 3438, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3438, 3438, 3446,
-     3446, 3446, 3438, 3446, 3446, 3438, 3446, 3438, 3446, 3438,
-
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3438, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438, 3446,
-     3446, 3438, 3446, 3438, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3438, 3438, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3438,
-     3438, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3438, 3438, 3446, 3446, 3438, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3438, 3446,
-
-     3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3446, 3438, 3438, 3446, 3446, 3446, 3438, 3438,
-     3438, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3438, 3438,
-     3446, 3446, 3446, 3446, 3446, 3438, 3438, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3438,
-     3446, 3438, 3446, 3446, 3438, 3438, 3446, 3446, 3446, 3446,
-     3438, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446,
-
-     3446, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3438, 3438, 3446, 3446, 3446, 3446,
-     3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3446, 3446, 3438, 3438, 3446, 3446, 3438, 3438, 3446, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3446, 3446, 3438,
-     3446, 3446, 3446, 3438, 3446, 3438, 3446, 3446, 3446, 3446,
-     3438, 3446, 3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3438, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3438, 3446, 3438, 3446, 3438, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3438, 3446, 3438, 3438, 3446, 3446, 3438, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438,
-     3438, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-     3446, 3446, 3446, 3438, 3446, 3446, 3446, 3438, 3446, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446,
-     3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446, 3446,
-
-     3446, 3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3438,
-     3446, 3446, 3446, 3446, 3446, 3438, 3446, 3446, 3446, 3446,
-     3446, 3446, 3438, 3446, 3446, 3446, 3438, 3446, 3438, 3438,
-     3446, 3446, 3446, 3446, 3446, 3438, 3438,    0, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438
+     3704,     1,  3704,     3,  3704,     5,  3704,     7,  3704,     9,
+     3704,    11,  3704,    13,  3704,    15,  3704,  3704,  3704,  3704,
+       20,    20,  3704,  3704,    18,    18,    18,    18,    18,    18,
+       18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+       18,    18,    18,    18,    18,    18,    18,  3704,    20,    20,
+       20,  3704,  3704,    20,    20,    20,  3704,  3704,    20,    20,
+       20,    20,  3704,  3704,    20,    20,    20,  3704,  3704,    20,
+     3704,    20,  3704,    69,  3704,    20,    20,    20,    20,  3704,
+     3704,    20,    20,    20,  3704,    18,    24,    19,  3704,    23,
+       89,  3704,    18,    18,    18,    18,    18,    18,    18,    18,
+
+       18,    18,    18,    18,    18,    18,    18,    18,    40,    40,
+       86,    86,    86,    86,    86,    86,    34,    40,    86,    86,
+       86,    86,    86,    86,    86,    86,    86,    86,    86,    86,
+       86,    86,    93,   101,    95,   101,   102,    98,    99,   111,
+      107,   102,   103,   107,   109,   128,   107,   109,   113,   113,
+      111,   121,   113,   151,   115,   148,   117,   148,   134,   157,
+      134,   125,    48,    52,    48,    53,    57,    53,    58,    63,
+       59,    58,    64,    68,    64,    69,    73,    71,  3704,    69,
+       69,    75,    80,    76,    75,    81,    85,    81,    23,   157,
+      130,   134,   142,   142,   128,   129,   144,   142,   157,   138,
+
+      134,   139,   136,   157,   139,   147,   140,   153,   205,   148,
+      144,   157,   157,   148,   200,   206,   151,   157,   154,   162,
+      193,   156,   159,   157,   160,   159,   160,   200,   219,   206,
+      205,   206,   206,   200,   206,   201,   197,   206,   199,   206,
+      217,   202,   203,   206,   205,   206,   215,   246,   221,   210,
+      245,   212,   213,   221,   219,   228,   230,   218,   223,   241,
+      221,   223,   230,   259,   230,   228,   227,   228,   229,   243,
+      233,   233,   269,   235,   235,   237,   237,   238,   240,   240,
+      268,   243,   243,   252,    71,    69,   269,   250,   247,   252,
+      282,   263,   263,   252,   258,   263,   255,   276,   259,   276,
+
+      288,   260,   263,   262,   268,   277,   265,   299,   277,   277,
+      269,   297,   304,   272,   273,   315,   280,   276,   280,   305,
+      280,   314,   306,   284,   292,   287,   289,   299,   289,   290,
+      306,   304,   299,   314,   295,   299,   306,   299,   304,   300,
+      303,   304,   340,   308,   315,   308,   324,   308,   313,   330,
+      340,   313,   317,   332,   315,   327,   317,   318,   328,   345,
+      345,   355,   324,   331,   328,   331,   358,   347,   340,   335,
+      331,   358,   341,   337,    20,   371,   347,   341,   347,   347,
+      347,   342,   342,   349,   345,   364,   357,   355,   363,   349,
+      354,   371,   352,   358,   358,   383,    20,   360,   383,   358,
+
+      367,   360,   362,   363,   363,    69,   370,   367,   385,   370,
+      373,   369,   371,   383,   373,   377,   376,   376,   394,   379,
+      394,   387,   386,   392,   383,   396,   387,   386,   387,   389,
+      389,   392,   429,   429,   396,   394,   413,   396,   407,   423,
+      407,   401,   429,   404,   414,   409,   414,   411,   409,   420,
+      438,   449,   422,   414,   417,   438,   417,   420,   424,   423,
+      421,   422,   430,   461,   440,   427,   438,   442,   454,   430,
+      450,   440,   433,   459,   444,   473,   457,   450,   451,   473,
+      460,   450,   454,   460,   445,    20,   460,    20,   454,   448,
+      460,   452,   454,   458,   459,   473,    20,   459,   475,   492,
+
+      459,   459,   466,   492,   466,   463,   502,   490,   477,   502,
+      468,   503,   474,   477,   475,   479,   502,   478,   485,   483,
+      479,   482,   511,   482,   482,   483,   484,   487,    20,   495,
+      489,   511,   516,   526,   494,   525,   516,   500,   511,   506,
+      525,   504,   503,   503,   511,   506,   525,   509,   509,   513,
+      544,   511,   512,   544,   523,   516,   523,   526,   519,   522,
+      542,   522,   526,   523,   524,    20,   525,   542,   533,    69,
+      530,   556,   532,   534,   533,   539,   567,   537,   558,   539,
+      539,   540,   542,   571,   556,   571,   556,   548,   575,   552,
+      560,   588,   558,   552,   571,   554,   583,   583,   571,   583,
+
+      583,   571,   571,   562,   572,   588,   591,   574,   582,   588,
+      591,   572,   574,   578,   584,   578,   577,   591,   589,   580,
+      590,   604,   591,   594,   585,   586,   591,   589,   592,   617,
+      620,   617,   594,   607,   607,   619,   621,    20,   599,   599,
+      606,   614,   607,   606,   607,   624,   617,   607,   608,   611,
+      625,   611,   640,   613,   622,   624,   640,   617,   626,   619,
+      641,   621,   641,   623,   630,   625,   628,   627,   654,   639,
+      634,   639,   641,   633,   651,   635,   639,   649,   649,   643,
+      659,   654,   653,   645,   651,   646,   648,   661,   659,   658,
+      664,   652,   659,   686,   674,   656,   669,   696,   665,   665,
+
+      665,   669,   675,   670,   665,   683,   667,   707,   699,   682,
+      690,   707,   681,   675,   675,   690,   682,   678,   682,   705,
+      699,   682,   699,   697,   697,   686,   715,   694,   705,   703,
+      715,   705,   697,   694,   715,   726,   722,   704,   702,   700,
+      701,   726,   741,   726,   726,   709,   741,   709,   709,   715,
+      749,   713,   716,   738,    69,   715,   720,   727,   749,   719,
+      727,   721,   722,   728,   727,   763,   726,   749,    20,   733,
+      738,   730,   732,   753,   733,   746,   738,   736,   741,   746,
+      775,   772,   742,    20,   760,    20,    20,   743,    20,    21,
+      749,   745,    22,   792,   749,   748,   757,   750,   798,   752,
+
+      776,   758,   772,   771,   770,   767,   762,   776,   773,   763,
+      772,   767,   770,   785,   775,   770,   771,   779,   798,   785,
+      806,   798,   806,   806,   816,   806,   781,   782,   785,   813,
+      797,   803,   813,   794,   798,   814,   802,   798,   801,   829,
+      801,   804,   806,   827,   817,    49,   806,   842,   813,   842,
+      812,   842,   816,   813,   834,   827,   827,   834,   839,   821,
+      822,   821,   839,   823,   830,   827,   826,   834,   844,   829,
+      842,   833,    50,   867,   867,   849,   835,   843,   867,   853,
+      843,   840,   870,   867,   843,   844,   861,   847,   849,   867,
+      877,   859,   853,    51,   867,   854,   856,   856,   860,   898,
+
+      859,   901,   861,   901,   867,   864,   865,   892,   872,   871,
+      874,   870,   872,   882,   874,   875,   882,   878,   897,   889,
+      901,   884,   901,   916,   901,   903,   889,   901,   910,   910,
+      914,   910,   892,   914,   895,   901,   910,   910,   907,   909,
+      901,   902,   918,   941,   905,   910,   933,   908,   909,   910,
+      911,   921,   919,   948,   933,   918,   948,    69,   918,   939,
+      945,   926,   923,   943,   927,    54,   925,   931,   945,    55,
+      949,   936,   941,   933,   945,   939,   959,   953,   936,   939,
+      959,   968,   943,   968,   946,   951,   968,   960,   959,   956,
+      948,   956,   968,   973,   968,   986,   954,   956,   956,   999,
+
+      978,   960,   999,   962,   965,   964,   965,   991,   983,   982,
+      991,   975,   983,   975,   982,  1005,  1005,   978,   999,   983,
+      991,  1006,  1018,  1006,  1001,   986,   987,    56,   999,   989,
+     1005,   992,   992,  1008,   999,   998,  1005,    60,   997,  1039,
+     1018,  1000,  1039,  1005,  1009,  1027,  1010,  1027,  1008,  1039,
+     1039,  1010,  1011,  1019,    60,  1018,    61,  1015,  1027,  1020,
+     1017,  1047,  1022,  1020,  1032,  1032,    62,    65,  1032,  1039,
+     1025,  1063,  1029,  1039,  1064,  1033,    66,  1041,  1035,    67,
+     1035,  1071,  1036,  1047,  1046,  1040,  1041,  1063,  1076,  1064,
+     1054,  1046,  1054,  1064,  1060,  1058,    70,  1083,  1052,  1060,
+
+     1060,  1056,  1070,  1060,  1060,  1062,  1062,    72,  1063,  1078,
+     1109,  1073,  1069,  1070,  1072,  1083,  1073,  1088,  1075,  1085,
+     1083,  1089,  1081,  1091,  1095,  1095,  1091,  1095,  1091,    77,
+     1095,  1115,  1092,  1091,  1095,  1113,  1103,  1103,  1115,  1119,
+     1116,  1116,  1101,  1102,  1104,  1104,  1115,  1107,  1119,  1112,
+     1112,  1115,  1112,  1125,  1136,  1119,  1116,  1148,  1118,  1132,
+     1137,  1149,  1122,  1123,    77,  1149,  1125,  1136,  1128,  1128,
+       69,    69,  1157,  1153,  1148,  1135,  1137,  1136,  1136,  1150,
+     1150,  1167,  1167,  1145,  1142,  1145,  1157,  1157,  1146,  1153,
+     1149,  1149,  1153,  1156,    78,  1155,  1157,  1160,  1174,  1163,
+
+     1179,  1162,    79,  1159,  1160,  1169,  1168,  1192,  1173,  1166,
+     1191,  1198,  1177,  1170,  1191,  1175,  1176,  1187,  1177,  1191,
+       82,  1196,  1184,  1184,  1201,  1184,  1204,  1213,  1190,  1190,
+     1191,  1216,  1190,  1192,  1216,  1194,  1194,  1198,  1200,  1199,
+     1201,  1201,  1213,  1229,  1211,  1216,  1211,  1207,  1229,  1225,
+       83,  1210,  1229,  1218,  1213,  1225,  1215,  1217,  1217,  1232,
+     1222,  1220,  1254,  1223,  1224,  1226,  1264,  1228,  1252,  1265,
+     1258,  1243,  1252,  1258,  1258,  1265,  1237,  1265,  1258,  1241,
+     1240,  1252,  1243,  1250,  1258,  1254,  1281,  1252,  1252,  1258,
+     1250,  1258,  1254,  1258,  1263,  1265,  1257,  1258,    84,  1259,
+
+     1291,  1262,  1281,  1268,  1269,  1286,  1268,  1267,  1271,  1286,
+     1272,  1271,  1312,  1286,  1282,  1276,  1276,  1286,  1285,  1286,
+     1283,  1281,  1287,  1283,  1284,  1285,  1286,  1302,  1327,  1289,
+      375,  1300,  1292,  1312,  1304,  1327,  1295,  1327,  1316,  1309,
+     1300,  1341,  1327,  1337,  1304,  1332,  1337,  1315,  1309,  1311,
+     1330,  1323,   375,  1332,  1328,  1319,  1337,  1318,  1319,  1318,
+     1319,  1348,  1332,  1327,  1326,  1339,  1326,  1352,  1327,  1335,
+     1329,  1330,   375,  1348,  1348,  1340,  1348,  1350,  1337,  1338,
+     1339,  1343,  1344,  1342,   375,  1352,  1344,    69,  1347,  1346,
+     1348,  1348,  1369,   397,  1362,  1357,  1357,  1379,  1357,  1356,
+
+     1358,  1368,  1366,  1383,  1381,  1368,  1365,  1382,  1390,  1367,
+      486,  1379,  1374,  1386,  1370,  1371,  1401,  1374,  1386,  1376,
+     1378,  1378,  1401,   488,  1391,  1381,  1382,  1391,  1398,  1386,
+     1402,  1407,  1407,  1402,  1397,  1407,  1397,   497,  1401,  1402,
+     1402,  1403,  1426,  1402,  1412,  1425,  1404,  1412,  1417,  1418,
+     1418,  1412,  1410,  1412,  1432,  1414,  1415,  1442,  1418,  1421,
+     1435,  1442,  1425,  1425,  1423,  1425,  1426,  1427,  1429,  1432,
+     1446,  1446,  1446,  1433,  1442,  1442,   529,  1466,  1443,  1457,
+     1440,  1447,  1449,  1450,  1454,  1458,  1461,  1447,  1453,  1449,
+     1452,  1463,  1463,  1461,  1458,  1455,  1496,  1457,  1470,  1496,
+
+     1461,  1481,  1463,  1470,  1487,  1465,  1471,  1496,  1468,  1471,
+     1491,  1496,  1496,  1496,  1478,  1483,  1476,  1484,  1486,  1480,
+     1496,  1496,  1483,  1515,  1515,  1489,  1523,  1488,  1489,  1498,
+     1529,  1496,   566,  1520,  1502,  1499,  1518,  1501,  1498,  1515,
+     1504,  1503,  1518,  1529,  1504,  1528,  1528,  1538,  1535,  1530,
+     1538,  1542,  1523,  1515,   638,  1535,   769,  1517,  1526,  1519,
+     1542,  1538,   784,  1524,   786,  1534,  1524,  1539,  1539,   787,
+     1534,  1558,  1538,  1530,  1538,  1560,  1537,  1558,  1534,  1536,
+     1536,  1560,  1553,  1550,  1549,  1543,  1542,  1579,  1548,  1568,
+      789,  1560,  1581,  1549,  1559,  1577,  1581,  1554,  1553,  1562,
+
+     1560,  1558,  1559,  1599,  1579,  1580,  1564,   790,  1567,  1607,
+     1568,  1580,    69,  1585,  1581,  1573,  1581,  1587,  1576,  1580,
+     1589,  1589,  1580,  1598,  1584,  1595,  1589,  1585,  1595,  1607,
+     1589,  1607,   793,  1593,  1598,  1605,  1594,   846,  1595,  1596,
+     1601,  1601,  1615,  1614,  1601,  1602,  1619,  1614,  1605,  1621,
+     1614,  1610,  1612,  1636,   873,  1625,  1620,  1618,  1646,  1624,
+     1630,  1630,  1620,  1641,  1641,  1630,  1626,  1625,  1644,  1636,
+     1631,  1646,  1630,  1632,  1639,  1652,  1635,  1639,  1660,  1639,
+     1644,  1650,  1650,  1643,  1684,  1684,  1648,  1658,  1648,  1649,
+     1670,   894,  1652,  1693,  1668,  1661,  1671,  1657,  1671,  1671,
+
+     1684,  1661,   966,  1679,  1671,  1667,  1693,  1666,  1667,  1684,
+     1669,  1681,  1671,  1709,  1673,  1709,  1693,  1698,   970,  1682,
+     1028,  1688,  1679,  1704,  1704,  1693,  1687,  1723,  1704,  1695,
+     1691,  1706,  1723,  1706,  1691,  1698,  1713,  1731,  1709,  1707,
+     1713,  1713,  1700,  1704,  1038,  1705,  1730,  1712,  1710,  1718,
+     1724,  1732,  1726,  1055,  1057,  1722,  1712,  1727,  1757,  1718,
+     1737,  1732,  1739,  1726,  1724,  1732,  1727,  1725,  1727,  1729,
+     1067,  1749,  1739,  1730,  1732,  1743,  1748,  1744,  1743,  1752,
+     1749,  1743,  1739,  1741,  1068,  1746,  1749,  1743,  1747,  1761,
+     1776,  1077,  1748,  1080,  1749,  1795,  1793,  1752,  1761,  1789,
+
+     1761,  1789,  1772,  1772,  1765,  1776,  1776,  1789,  1795,  1778,
+     1786,  1769,  1795,  1784,  1776,  1773,  1775,  1789,  1776,  1777,
+     1778,  1812,  1780,  1097,  1810,  1786,  1783,  1798,  1798,  1798,
+     1799,  1789,  1811,  1108,  1816,  1799,  1795,    69,  1796,  1810,
+     1809,  1799,  1809,  1810,  1803,  1823,  1842,  1842,  1839,  1130,
+     1809,  1811,  1819,  1842,  1812,  1812,  1825,  1837,  1825,  1165,
+     1817,  1831,  1819,  1825,  1842,  1821,  1837,  1826,  1825,  1855,
+     1855,  1828,  1829,  1831,  1842,  1839,  1861,  1836,  1852,  1842,
+     1861,  1849,  1844,  1853,  1843,  1195,  1851,  1851,  1846,  1852,
+     1866,  1889,  1851,  1857,  1857,  1868,  1857,  1893,  1885,  1885,
+
+     1859,  1861,  1863,  1867,  1203,  1884,  1870,  1884,  1867,  1904,
+     1883,  1879,  1872,  1883,  1876,  1885,  1877,  1893,  1877,  1884,
+     1887,  1890,  1907,  1890,  1884,  1884,  1890,  1221,  1894,  1888,
+     1915,  1891,  1891,  1915,  1903,  1894,  1896,  1899,  1897,  1898,
+     1899,  1918,  1912,  1902,  1918,  1911,  1912,  1251,  1299,  1911,
+     1909,  1936,  1331,  1936,  1916,  1920,  1913,  1914,  1916,  1931,
+     1917,  1936,  1940,  1941,  1942,  1923,  1941,  1957,  1353,  1925,
+     1926,  1927,  1961,  1935,  1932,  1373,  1932,  1935,  1939,  1977,
+     1970,  1952,  1943,  1977,  1940,  1941,  1966,  1964,  1945,  1385,
+     1956,  1956,  1947,  1960,  1972,  1394,  1972,  1954,  1970,  1958,
+
+     1957,  1960,  1411,  1977,  1960,  1965,  1962,  1982,  1973,  1979,
+     2005,  1968,  1979,  1970,  1971,  1977,  1981,  1983,  1983,  1978,
+     1987,  1994,  1981,  1981,  1991,  1989,  2005,  1424,  2008,  2012,
+     1993,  1991,  2000,  1438,  2000,  1992,  2020,  1994,  2021,  1477,
+     1997,  2021,  2020,  2038,  2017,  2002,  2020,  2010,  1533,  2046,
+     2011,  2046,  2009,  2020,  2011,  2020,  2013,  2014,  2016,  2018,
+       69,  2046,  1555,  2046,  2059,  2023,  1557,  2021,  2026,  2033,
+     2033,  2031,  2031,  2037,  2058,  2045,  2058,  2033,  1563,  2045,
+     1565,  2068,  2046,  2069,  1570,  2046,  2046,  2045,  2048,  2078,
+     2045,  2045,  2068,  2048,  2060,  2078,  2051,  2059,  2053,  2066,
+
+     2056,  2097,  2078,  2097,  2059,  1591,  2062,  2097,  2078,  2072,
+     2069,  2078,  2083,  2070,  2076,  2072,  1608,  1633,  2089,  1638,
+     2082,  2075,  2122,  1655,  2077,  2105,  2101,  2082,  2084,  2084,
+     2089,  2087,  1692,  2089,  2111,  1703,  2090,  2091,  2101,  2093,
+     2094,  2095,  2111,  2103,  2114,  2125,  2113,  2113,  2125,  2113,
+     2122,  2105,  2125,  2138,  1719,  2110,  2137,  2113,  2119,  2113,
+     2142,  2121,  2116,  2142,  1721,  2144,  2163,  2130,  2160,  2163,
+     2140,  1745,  2144,  1754,  2160,  2144,  2147,  2168,  2134,  2139,
+     1755,  2168,  2138,  2159,  2152,  2144,  2163,  2168,  2163,  2163,
+     2163,  2160,  2156,  2180,  2163,  2151,  2158,  2159,  2156,  1771,
+
+     2179,  2179,  2183,  2159,  2160,  2161,  2164,  2180,  2167,  2168,
+     2169,  2199,  2184,  2177,  2205,  2205,  2176,  2187,  2192,  1785,
+     2206,  2186,  2182,  2182,  2184,  2197,  2186,  2197,  2199,  1792,
+     2197,  2189,  2190,  1794,  2196,  2193,  2217,  2204,  2211,  2211,
+     2197,  2199,  2203,  2206,  2209,  2241,  1824,  2214,  2214,  2207,
+     2209,  2209,  2217,  2211,  1834,  1850,  1860,  2211,  1886,  2213,
+     2218,  2221,  2218,  2216,  2217,  2223,  2221,  2239,  2242,  2227,
+     1905,  2238,  2227,  2238,  2227,  2228,  2232,  2235,  2239,  2260,
+     2275,  2264,    69,  2238,  2264,  2264,  2265,  2241,  2250,  1928,
+     1948,  2264,  2272,  2262,  2253,  2272,  2249,  2250,  2268,  2264,
+
+     2261,  2297,  2272,  2261,  2264,  1949,  2276,  2289,  2276,  2289,
+     1953,  2269,  2277,  2268,  2269,  2277,  2279,  2273,  2289,  2277,
+     2276,  2293,  2307,  2315,  2301,  2281,  2299,  2298,  2285,  2301,
+     2287,  2299,  2293,  1969,  2292,  2329,  2329,  2314,  2296,  2329,
+     2298,  2328,  2341,  1976,  2315,  1990,  2331,  2303,  2304,  2305,
+     2322,  2313,  2309,  2331,  2348,  2331,  2328,  2315,  2322,  2350,
+     2322,  2320,  2324,  2331,  2358,  2328,  2333,  2333,  2330,  1996,
+     2330,  2328,  2372,  2342,  2333,  2353,  2333,  2336,  2351,  2337,
+     2351,  2345,  2352,  2351,  2351,  2348,  2345,  2347,  2348,  2378,
+     2003,  2352,  2353,  2359,  2378,  2354,  2359,  2380,  2357,  2376,
+
+     2365,  2361,  2378,  2363,  2363,  2028,  2382,  2367,  2378,  2367,
+     2034,  2372,  2369,  2382,  2372,  2375,  2378,  2383,  2382,  2382,
+     2040,  2379,  2412,  2380,  2386,  2398,  2398,  2384,  2385,  2386,
+     2387,  2405,  2393,  2049,  2396,  2428,  2418,  2412,  2418,  2396,
+     2397,  2398,  2418,  2429,  2063,  2418,  2418,  2404,  2435,  2435,
+     2442,  2414,  2414,  2435,  2418,  2418,  2440,  2441,  2416,  2430,
+     2418,  2431,  2431,  2431,  2423,  2448,  2442,  2426,  2437,  2430,
+     2431,  2430,  2435,  2435,  2435,  2067,  2438,  2079,  2462,  2460,
+     2449,  2460,  2443,  2462,  2462,  2460,    69,  2477,  2081,  2446,
+     2490,  2465,  2452,  2462,  2451,  2085,  2452,  2490,  2466,  2497,
+
+     2106,  2459,  2461,  2477,  2497,  2465,  2470,  2117,  2465,  2502,
+     2469,  2473,  2473,  2471,  2492,  2472,  2470,  2497,  2472,  2473,
+     2480,  2481,  2516,  2483,  2118,  2480,  2502,  2492,  2483,  2484,
+     2485,  2504,  2526,  2492,  2491,  2120,  2503,  2504,  2504,  2516,
+     2526,  2504,  2503,  2512,  2502,  2503,  2520,  2520,  2511,  2507,
+     2124,  2518,  2510,  2511,  2512,  2513,  2514,  2515,  2133,  2530,
+     2136,  2546,  2519,  2521,  2527,  2521,  2564,  2155,  2165,  2526,
+     2544,  2552,  2528,  2530,  2172,  2529,  2174,  2534,  2181,  2546,
+     2200,  2540,  2553,  2220,  2230,  2537,  2566,  2550,  2543,  2543,
+     2573,  2576,  2234,  2573,  2557,  2247,  2544,  2564,  2553,  2547,
+
+     2549,  2255,  2549,  2565,  2552,  2572,  2256,  2573,  2257,  2557,
+     2571,  2562,  2558,  2259,  2573,  2565,  2603,  2580,  2271,  2567,
+     2573,  2586,  2580,  2574,  2574,  2586,  2574,  2582,  2582,  2605,
+     2586,  2583,  2632,  2589,  2591,  2591,  2591,  2591,  2594,  2605,
+     2612,  2601,  2598,  2620,  2605,  2632,  2605,  2632,  2605,  2613,
+     2608,  2615,  2617,  2615,  2615,  2615,  2618,  2617,  2630,  2620,
+     2630,  2290,  2630,  2653,  2643,  2628,  2632,  2632,  2631,  2632,
+     2632,  2635,  2632,  2633,  2646,  2635,  2636,  2666,  2643,  2666,
+     2640,  2641,    69,  2657,  2643,  2673,  2650,  2650,  2291,  2657,
+     2681,  2673,  2650,  2651,  2666,  2669,  2669,  2655,  2672,  2665,
+
+     2306,  2665,  2311,  2665,  2684,  2661,  2664,  2687,  2334,  2667,
+     2684,  2681,  2668,  2673,  2670,  2682,  2675,  2684,  2684,  2679,
+     2344,  2698,  2678,  2681,  2686,  2698,  2346,  2686,  2698,  2684,
+     2690,  2686,  2687,  2690,  2690,  2691,  2707,  2698,  2698,  2710,
+     2705,  2697,  2698,  2699,  2700,  2705,  2708,  2705,  2707,  2723,
+     2748,  2710,  2713,  2713,  2752,  2716,  2722,  2716,  2722,  2370,
+     2737,  2722,  2391,  2725,  2737,  2723,  2740,  2752,  2752,  2740,
+     2737,  2406,  2738,  2411,  2731,  2740,  2748,  2738,  2747,  2741,
+     2738,  2738,  2747,  2740,  2421,  2747,  2784,  2743,  2775,  2434,
+     2747,  2753,  2753,  2757,  2445,  2766,  2764,  2784,  2777,  2757,
+
+     2761,  2757,  2768,  2764,  2758,  2766,  2767,  2762,  2476,  2478,
+     2489,  2496,  2501,  2764,  2765,  2773,  2775,  2775,  2797,  2797,
+     2797,  2773,  2776,  2796,  2779,  2508,  2778,  2525,  2536,  2803,
+     2796,  2781,  2803,  2783,  2803,  2788,  2803,  2792,  2792,  2799,
+     2792,  2801,  2797,  2841,  2551,  2825,  2803,  2803,  2825,  2802,
+     2802,  2803,  2804,  2830,  2842,    69,  2819,  2808,  2830,  2815,
+     2860,  2817,  2830,  2824,  2820,  2825,  2830,  2827,  2827,  2559,
+     2561,  2825,  2827,  2840,  2836,  2833,  2833,  2834,  2862,  2852,
+     2837,  2843,  2846,  2841,  2841,  2862,  2862,  2847,  2864,  2568,
+     2858,  2848,  2874,  2569,  2864,  2575,  2854,  2854,  2860,  2872,
+
+     2857,  2857,  2865,  2882,  2577,  2579,  2860,  2862,  2862,  2581,
+     2584,  2863,  2864,  2912,  2866,  2868,  2891,  2876,  2912,  2882,
+     2883,  2916,  2912,  2585,  2883,  2593,  2913,  2596,  2880,  2916,
+     2915,  2886,  2886,  2899,  2886,  2916,  2602,  2903,  2888,  2892,
+     2607,  2901,  2900,  2609,  2908,  2895,  2929,  2898,  2921,  2614,
+     2903,  2907,  2916,  2916,  2619,  2916,  2929,  2918,  2915,  2662,
+     2916,  2689,  2913,  2918,  2915,  2916,  2965,  2701,  2927,  2938,
+     2703,  2922,  2922,  2946,  2943,  2943,  2709,  2930,  2930,  2934,
+     2721,  2963,  2959,  2943,  2936,  2938,  2936,  2727,  2953,  2940,
+     2942,  2942,  2949,  2953,  2975,  2952,  2948,  2949,  2953,  2957,
+
+     2760,  2763,  2953,  2963,  2998,  2958,    69,  2993,  2961,  2961,
+     2963,  2969,  2965,  2998,  2990,  2983,  3000,  2972,  2772,  2774,
+     2990,  2785,  2992,  2975,  2790,  2983,  3024,  2986,  2980,  2990,
+     2996,  3004,  2997,  2987,  2997,  3024,  2997,  3003,  2992,  2994,
+     2994,  3003,  2999,  3028,  3028,  3028,  3028,  3003,  3006,  3011,
+     3006,  3015,  3038,  3015,  3011,  3012,  3032,  3018,  2795,  3018,
+     3033,  3018,  3024,  3031,  2809,  3034,  3024,  3034,  3030,  2810,
+     3034,  3055,  3055,  3055,  3055,  2811,  3067,  3064,  3043,  3037,
+     3055,  3038,  3039,  3042,  3041,  3042,  3055,  3080,  2812,  2813,
+     2826,  3049,  3058,  3058,  2828,  3058,  3061,  3050,  3064,  2829,
+
+     3058,  3055,  3054,  2845,  2870,  3098,  3069,  3072,  2871,  2890,
+     3058,  3060,  3112,  3069,  2894,  3103,  2896,  2905,  3066,  3103,
+     3068,  3068,  2906,  3069,  3092,  3072,  3073,  2910,  3092,  3079,
+     3098,  3086,  3097,  3099,  3088,  2911,  3093,  3093,  3093,  3087,
+     3111,  3093,  3088,  3092,  2924,  3112,  3107,  3107,  3101,  3099,
+     3103,  3122,  3107,  3134,  3112,  3131,  3119,  2926,  3111,  3114,
+     3114,  3126,  3143,  3119,  3164,  2928,  3141,  2937,  3130,  2941,
+     3132,  3132,  3159,  3127,  3129,  3143,  3131,  3144,  3162,  3140,
+     3150,  3137,  3138,  3143,  2944,  2950,  3141,  2955,  3142,  3142,
+     2960,  3152,  2962,  3149,  2968,  3175,  3175,  3148,  3175,  3153,
+
+     3153,  2971,  3157,  3167,  3174,  3155,  3156,  3163,  2977,  3162,
+     3160,  3163,  3169,  2981,  2988,  3001,  3167,  3206,  3178,  3002,
+     3167,  3169,  3183,  3172,  3187,  3176,  3175,  3176,  3183,  3180,
+     3019,  3198,  3020,  3187,  3206,  3184,  3183,  3187,  3189,  3022,
+     3189,  3224,  3192,  3205,  3243,  3210,  3025,  3059,  3065,  3237,
+     3204,  3070,  3206,  3203,  3243,  3206,  3205,  3076,  3219,  3213,
+     3219,  3212,  3218,  3257,  3213,  3089,  3237,  3257,  3219,  3221,
+     3222,  3236,  3224,  3230,  3090,  3229,  3229,  3232,  3229,  3232,
+     3239,  3239,  3239,  3270,  3237,  3253,  3259,  3091,  3241,  3244,
+     3095,  3100,  3262,  3104,  3244,  3295,  3262,  3295,  3254,  3253,
+
+     3105,  3254,  3285,  3262,  3279,  3259,  3274,  3265,  3265,  3109,
+     3263,  3306,  3272,  3278,  3110,  3115,  3268,  3271,  3117,  3271,
+     3278,  3300,  3118,  3279,  3276,  3286,  3277,  3278,  3281,  3280,
+     3123,  3128,  3281,  3287,  3306,  3306,  3306,  3287,  3327,  3289,
+     3136,  3328,  3293,  3306,  3306,  3145,  3297,  3298,  3347,  3317,
+     3314,  3158,  3314,  3306,  3311,  3314,  3166,  3312,  3308,  3309,
+     3168,  3170,  3318,  3318,  3333,  3185,  3186,  3188,  3318,  3321,
+     3343,  3320,  3191,  3327,  3325,  3324,  3376,  3329,  3376,  3193,
+     3333,  3195,  3330,  3330,  3363,  3347,  3335,  3202,  3209,  3336,
+     3337,  3338,  3363,  3344,  3214,  3215,  3342,  3344,  3344,  3216,
+
+     3365,  3384,  3348,  3220,  3386,  3351,  3363,  3397,  3384,  3355,
+     3363,  3363,  3403,  3370,  3374,  3364,  3365,  3397,  3403,  3371,
+     3383,  3383,  3375,  3378,  3417,  3378,  3385,  3385,  3403,  3392,
+     3231,  3233,  3385,  3240,  3393,  3402,  3247,  3392,  3248,  3393,
+     3393,  3393,  3407,  3249,  3407,  3407,  3407,  3407,  3402,  3252,
+     3409,  3407,  3409,  3407,  3408,  3258,  3411,  3423,  3411,  3412,
+     3413,  3414,  3454,  3459,  3424,  3266,  3425,  3419,  3424,  3275,
+     3288,  3421,  3422,  3449,  3459,  3472,  3291,  3473,  3467,  3428,
+     3430,  3458,  3472,  3435,  3292,  3436,  3451,  3294,  3301,  3440,
+     3461,  3310,  3315,  3449,  3443,  3316,  3319,  3323,  3331,  3332,
+
+     3341,  3346,  3352,  3481,  3473,  3357,  3462,  3448,  3452,  3361,
+     3452,  3452,  3362,  3453,  3487,  3490,  3457,  3366,  3473,  3480,
+     3367,  3514,  3461,  3481,  3463,  3468,  3475,  3507,  3482,  3472,
+     3484,  3473,  3491,  3487,  3476,  3481,  3479,  3481,  3368,  3495,
+     3517,  3504,  3373,  3380,  3382,  3388,  3520,  3517,  3495,  3515,
+     3535,  3495,  3527,  3508,  3508,  3529,  3517,  3519,  3524,  3524,
+     3532,  3526,  3516,  3520,  3535,  3524,  3540,  3541,  3540,  3389,
+     3540,  3526,  3529,  3540,  3395,  3533,  3553,  3396,  3531,  3400,
+     3404,  3540,  3553,  3534,  3556,  3563,  3563,  3547,  3540,  3556,
+     3542,  3549,  3431,  3549,  3432,  3434,  3549,  3557,  3437,  3564,
+
+     3556,  3553,  3439,  3557,  3559,  3556,  3589,  3589,  3573,  3560,
+     3566,  3567,  3444,  3450,  3568,  3579,  3573,  3573,  3567,  3591,
+     3586,  3577,  3591,  3591,  3591,  3585,  3586,  3456,  3582,  3591,
+     3592,  3592,  3466,  3602,  3590,  3587,  3590,  3590,  3621,  3601,
+     3607,  3470,  3622,  3471,  3477,  3612,  3598,  3605,  3601,  3606,
+     3607,  3622,  3610,  3607,  3485,  3608,  3622,  3617,  3622,  3622,
+     3620,  3636,  3617,  3619,  3620,  3620,  3629,  3636,  3636,  3626,
+     3625,  3626,  3488,  3629,  3635,  3489,  3630,  3648,  3635,  3635,
+     3643,  3492,  3646,  3637,  3638,  3643,  3646,  3662,  3493,  3646,
+     3646,  3662,  3496,  3648,  3497,  3498,  3653,  3650,  3658,  3664,
+
+     3664,  3499,  3500,     0
     } ;
 
-static const flex_int16_t yy_nxt[6755] =
-    {   0,
-       18,   19,   20,   21,   22,   23,   22,   18,   18,   18,
-       18,   18,   22,   24,   25,   26,   27,   28,   29,   30,
-       18,   31,   32,   33,   34,   35,   36,   37,   38,   39,
-       40,   41,   42,   43,   44,   45,   18,   18,   18,   46,
-       48,   49,   50,   48,   49,   50,   53,   54,   53,   54,
-       55,   51,   55,   85,   51,   85,   85,   56,   85,   56,
-       58,   59,   60,   61,   85,   22,   58,   59,   60,   61,
-       86,   22,   62,   64,   65,   66,   86,   97,   62,   64,
-       65,   66,   87,   86,   67,  119,   88,  108,   85,   86,
-       67,   19,   20,   21,   69,   70,   71,   75,   76,   77,
-
-       78,   86,   22,   72,  121,   86,  120,  109,   86,   79,
-      160,  160,   73,   19,   20,   21,   69,   70,   71,   75,
-       76,   77,   78,  187,   22,   72,   81,   82,   83,  130,
-       90,   79,   90,   90,   73,   90,   86,   84,   81,   82,
-       83,   90,   91,   86,   86,   98,   92,   93,  170,   84,
-       94,  159,   99,   86,  110,   95,  100,  162,   86,  101,
-      162,  170,   86,  112,   96,   86,  167,  167,  111,   86,
-      102,  113,  137,  115,  103,  173,  116,  104,   86,  105,
-      106,  179,  114,  117,  170,  118,   86,  122,   86,  126,
-      107,   86,  156,  127,   86,  123,  157,  184,   86,  138,
-
-      158,  124,   87,  139,   86,  125,   88,  128,  180,  129,
-       86,  131,   86,  140,  141,  132,  142,  143,   86,  133,
-      144,   86,  148,   86,  149,  134,   86,  145,  135,   86,
-      152,  146,  147,  150,   86,  136,  177,  177,  183,  151,
-      153,  181,  196,  189,  154,  155,  164,   86,  164,  164,
-       90,  164,   90,   90,  169,   90,  169,  169,  174,  169,
-      174,  174,  172,  174,   85,   86,   85,   85,   90,   85,
-       90,   90,  289,   90,   86,   85,   86,  182,   86,   90,
-       91,  185,  190,  188,   86,   86,  197,   86,  191,   86,
-      192,   86,   86,  207,  186,   86,   86,   86,   86,   86,
-
-      178,  199,  193,  194,   86,  198,   86,  195,   86,  200,
-       86,  201,  245,  209,  205,  202,  203,  206,  208,   86,
-      210,  215,  211,  204,   86,  212,   86,   86,   86,  217,
-       86,  218,   86,  220,   86,   86,  226,  221,  213,  214,
-       86,  227,  225,  223,   86,   86,  216,  229,  224,   86,
-       86,  219,   86,  222,  230,  232,  233,  228,   86,   86,
-       86,   86,  231,  235,   86,  237,   86,  240,  234,  238,
-       86,   86,   86,   86,  242,   86,  236,  370,   86,   86,
-       86,  239,   86,  243,  241,  248,  251,  252,   86,  244,
-      253,  247,   86,   86,   86,  254,  249,  246,  260,  257,
-
-      250,  261,   86,   86,  259,  263,   86,   86,   86,   86,
-      258,  267,  255,   86,  264,  256,   86,   86,  262,  266,
-      268,  270,  160,  160,   86,  162,  265,  269,  162,  273,
-      164,  271,  164,  164,  337,  164,  167,  167,  169,   86,
-      169,  169,   90,  169,   90,   90,  170,   90,  174,  272,
-      174,  174,  274,  174,  172,  177,  177,  276,   86,   86,
-       86,   86,   86,   86,   86,   86,   86,  275,  278,   86,
-      281,  284,  280,   86,  277,  279,   86,  287,  286,  283,
-      176,  290,  282,   86,  288,  285,   86,  291,  292,   86,
-      293,  317,   86,  296,   86,  294,   86,  301,  297,   86,
-
-       86,   86,   86,  298,   86,   86,  304,  305,  308,  299,
-      300,  302,  295,   86,   86,   86,  306,  310,   86,  303,
-      311,   86,   86,   86,   86,  307,   86,  318,   86,   86,
-       86,  319,   86,  325,  312,  313,  315,  309,  314,  316,
-       86,  320,   86,  329,  321,  328,  322,  330,  327,  326,
-      332,   86,   86,   86,  732,  334,   86,  338,  323,  331,
-      324,   86,  335,   86,   86,  340,   86,  342,   86,  339,
-      341,   86,  333,   86,   86,   86,  344,  336,   86,   86,
-       86,  343,   86,   86,  346,   86,  348,   86,  345,   86,
-       86,   86,   86,  351,  353,   86,  349,  358,   86,  347,
-
-      352,  354,  359,   86,   86,  350,  355,   86,   86,  360,
-      357,  356,  362,  364,   86,  367,  361,   86,   86,   86,
-       86,   86,  373,  369,   86,   86,   86,   86,   86,  363,
-      374,  372,  365,  366,  376,   86,   86,  368,  377,  371,
-       86,  378,   86,  379,  375,  380,   86,  381,  383,   86,
-       86,  384,  170,   86,   86,  387,   86,   86,  386,   86,
-       86,   86,   86,  394,  388,  390,  392,  395,  385,   86,
-       86,  382,   86,   86,  398,  389,   86,  396,   86,  391,
-       86,  397,   86,  393,   86,  399,   86,  404,   86,  405,
-      409,  406,  400,   86,  403,   86,   86,   86,  402,  407,
-
-      401,   86,  408,   86,  411,   86,  412,   86,   86,   86,
-       86,  415,   86,   86,  410,  419,  416,   86,  175,  417,
-      421,   86,  418,  413,  414,   86,   86,  422,  423,   86,
-       86,  420,   86,  424,   86,   86,  426,  427,  428,  429,
-       86,   86,   86,   86,   86,   86,   86,  435,  432,   86,
-      425,   86,  436,   86,   86,  434,   86,  438,   86,  441,
-      431,  437,  433,   86,  430,   86,  443,  446,   86,   86,
-      439,  447,  440,   86,  442,   86,   86,  445,   86,   86,
-      457,  448,   86,  444,   86,  455,   86,   86,  170,  462,
-      458,  463,  459,  449,  464,   86,  450,  456,  469,  470,
-
-       86,  451,  452,  453,  454,  460,  467,   86,  461,  465,
-      466,  468,   86,   86,   86,   86,   86,   86,  478,   86,
-       86,   86,   86,  480,  476,  477,  479,   86,  481,  473,
-      471,   86,   86,  472,  474,  475,   86,  483,   86,  485,
-       86,  488,   86,  489,   86,  490,  482,   86,  484,   86,
-      506,   86,   86,  494,  491,  487,  493,  495,  486,   86,
-       86,   86,   86,   86,  492,  496,  498,   86,  499,   86,
-      501,  497,  170,  507,   86,  500,  508,   86,  505,   86,
-       86,   86,  522,  502,   86,  509,  503,  523,  504,   86,
-      510,   86,  511,  544,   86,   86,  525,   86,  512,  568,
-
-      528,  168,  513,   86,   86,  524,  526,  514,  527,  530,
-      515,   86,  516,  539,  517,  540,  529,   86,  538,   86,
-      541,   86,   86,   86,   86,   86,  547,  518,   86,  542,
-      519,  166,  520,   86,  521,   86,  543,  531,  532,  546,
-      549,  545,   86,   86,  548,  550,   86,  533,  551,  534,
-      535,  536,  553,  557,  537,   86,  552,   86,   86,   86,
-      555,   86,  554,  558,  560,  562,   86,  563,   86,   86,
-       86,   86,  559,  567,   86,   86,  561,   86,  556,   86,
-      570,  565,  571,  572,  566,   86,   86,   86,  564,   86,
-      569,   86,   86,   86,  577,  578,  579,  573,   86,  584,
-
-       86,   86,  574,  575,  581,  576,   86,   86,  585,   86,
-      582,   86,   86,  580,   86,  598,  586,   86,  601,   86,
-      590,   86,  600,  587,   86,  583,  589,  588,  599,  593,
-       86,  591,   86,  592,  603,   86,  165,  594,  595,  602,
-       86,  596,  597,   86,   86,   86,   86,   86,  606,  605,
-      607,  608,   86,  604,   86,  609,   86,  610,  611,  612,
-       86,   86,   86,  615,  616,  614,  613,   86,   86,  618,
-       86,  617,   86,   86,   86,  622,   86,  620,  621,   86,
-       86,   86,   86,  623,   86,  628,   86,   86,  624,  619,
-       86,  629,  633,  627,  630,   86,  631,   86,  626,  625,
-
-       86,  632,   86,  635,   86,  637,   86,   86,   86,   86,
-       86,   86,   86,   86,   86,  639,  634,  640,  642,  636,
-       86,   86,  644,  650,   86,   86,  649,  638,  163,   86,
-      641,  643,  645,  651,  646,   86,  652,   86,  647,  654,
-      653,  648,   86,   86,   86,  655,  657,   86,  656,  660,
-       86,   86,   86,  663,  662,   86,   86,   86,  658,   86,
-       86,  666,  659,   86,   86,   86,  665,  669,   86,  670,
-      661,   86,   86,  672,   86,   86,   86,  664,   86,  667,
-      671,  668,  687,   86,   86,   86,   86,  673,  675,   86,
-      689,  674,   86,  676,  684,   86,  706,  685,  677,  686,
-
-      678,  694,  688,   86,   86,  690,  679,  691,  680,  692,
-       86,  681,  682,  693,   86,  695,   86,  699,  683,   86,
-       86,   86,   86,   86,  703,  698,   86,   86,  700,   86,
-      696,   86,  708,  697,  701,   86,  702,   86,   86,   86,
-       86,   86,   86,   86,  709,  704,  705,  710,  714,  715,
-       86,   86,  707,  711,   86,  720,  712,  717,   86,  719,
-      716,  713,  170,  722,  718,   86,  721,   86,   86,   86,
-       86,   86,   86,  725,   86,  735,  729,  723,   86,  161,
-      731,   86,  724,  727,  726,   86,   86,  730,  737,  728,
-      734,   86,   86,  733,   86,   86,   86,   86,  736,  739,
-
-       86,   86,   86,   86,  738,  742,  743,   86,  748,  740,
-      744,   86,  741,  749,   86,  751,   86,  745,  747,  753,
-      746,  752,   86,   86,  750,   86,  754,   86,  755,   86,
-      756,   86,  757,   86,   86,   86,   86,  758,   86,   86,
-      762,   86,  761,  760,  759,   86,   86,   86,  765,  764,
-       86,  766,  763,  770,  769,   86,   86,  767,   86,   86,
-      771,   86,   86,  773,   86,  775,  768,   86,   86,   86,
-       86,   86,  781,  772,  778,  774,  782,  776,   86,   86,
-       86,   86,  789,   86,  779,   86,  784,   86,  777,   86,
-      780,  785,  792,  783,  786,  787,   86,   86,  788,   86,
-
-      796,  793,   86,  790,   86,  791,   86,   86,   86,   86,
-      798,  794,  799,  797,  795,   86,   86,   86,  804,  802,
-      801,   86,  803,   86,   86,   86,   86,  805,  806,  808,
-      810,   86,   86,   86,  800,  811,  807,   86,   86,  178,
-       86,   86,  817,   86,  819,  809,   86,  815,   86,  818,
-       86,  812,  816,  814,  813,  820,  821,   86,   86,   86,
-      822,   86,   86,  828,  823,  827,   86,  826,  824,   86,
-      830,  829,   86,   86,   86,  825,   86,  831,  833,  834,
-       86,   86,   86,  841,  835,   86,   86,  838,   86,   86,
-       86,   86,   86,  836,  837,  848,  844,  832,   86,  843,
-
-       86,  839,  840,   86,  846,  842,  850,  847,  845,   86,
-      849,   86,   86,  854,   86,  856,  852,   86,  855,   86,
-       86,  851,  858,  857,   86,   86,  853,  860,   86,   86,
-       86,   86,  866,   86,   86,   86,  859,  867,   86,   86,
-       86,   86,  861,  868,   86,   86,  862,  863,   86,  864,
-      869,  865,   86,  875,  870,   86,  873,   86,  871,   86,
-      872,   86,   86,  874,   86,  876,  877,  878,  882,   86,
-       86,   86,   86,   86,   86,  176,  879,   86,  891,  889,
-       86,  881,  880,   86,   86,   86,  884,  883,  892,  885,
-      886,  887,  888,   86,  890,   86,   86,  893,   86,   86,
-
-       86,  897,   86,   86,  894,   86,  895,  896,  902,  901,
-       86,   86,  903,  900,  898,  904,  905,   86,  899,   86,
-       86,   86,   86,  170,   86,   86,  907,  912,  913,  908,
-      910,   86,   86,   86,  914,  906,  909,  911,   86,   86,
-       86,  928,  915,   86,   86,  920,  916,   86,  917,  921,
-       86,   86,  922,  924,   86,  918,   86,  919,   86,   86,
-      923,  925,   86,  927,   86,   86,  930,  926,   86,  934,
-       86,   86,   86,   86,   86,   86,  931,   86,  935,  929,
-      936,   86,   86,  175,   86,   86,  933,  950,   86,  937,
-      932,  951,  947,  949,  939,   86,   86,  938,   86,  948,
-
-      940,   86,   86,  941,  952,  954,  958,  942,   86,  955,
-      943,   86,  953,   86,  956,   86,  959,  944,  945,  961,
-      946,   86,  957,   86,   86,   86,  969,   86,   86,   86,
-       86,  972,   86,  974,   86,  960,   86,  962,  963,  976,
-      964,   86,  971,  965,  970,  978,  170,   86,  966,  975,
-      980,  977,  973,  981,  967,  968,   86,   86,  982,   86,
-       86,  984,   86,  983,   86,  987,  979,  986,   86,   86,
-       86,   86,  985,  988,  989,  990,  991,   86,   86,   86,
-      992,  993,   86,   86,   86,   86,  995,   86,  999,   86,
-       86,   86,  998,   86,   86, 1002,   86,   86,  994,  168,
-
-     1006, 1004, 1007,  996,  997, 1000,   86, 1001, 1009, 1003,
-     1008,   86,   86, 1010,   86, 1012,   86, 1011, 1005, 1014,
-     1016,   86,   86,   86,   86,   86,   86, 1015,   86, 1018,
-       86, 1017, 1019, 1020,   86, 1013, 1021,   86, 1022,   86,
-       86,   86,   86,   86,   86, 1024, 1029,   86, 1025,   86,
-     1032,   86,   86,   86,   86,   86, 1033, 1023, 1030, 1027,
-     1026, 1031,   86, 1028, 1035,   86,   86,   86,   86,   86,
-       86, 1034, 1038, 1040, 1036, 1039,   86,   86, 1037,   86,
-       86, 1041, 1042, 1046,   86, 1048, 1044,   86, 1047,   86,
-       86,   86, 1045,   86, 1043, 1049,   86,   86, 1056, 1051,
-
-     1054, 1057,   86,   86,   86,   86, 1050,   86, 1055, 1059,
-       86, 1053,   86,   86,   86, 1052,   86,   86,   86,   86,
-       86, 1067, 1070, 1065, 1058,   86, 1060, 1061,   86, 1071,
-     1062,   86,   86, 1064, 1063,   86, 1068, 1072, 1069, 1066,
-       86, 1075,   86,   86,   86,   86, 1074,   86, 1076, 1078,
-     1073, 1079,   86,   86,   86,   86, 1077,   86,   86,   86,
-       86, 1084, 1080, 1082, 1089, 1081, 1090, 1083, 1092,   86,
-       86,   86,   86, 1091,   86, 1085, 1095, 1087, 1096, 1086,
-     1088,   86,   86, 1093,   86, 1097,   86,   86,   86,   86,
-     1104, 1094,   86, 1101,   86, 1103,   86,   86,   86, 1099,
-
-     1105,   86, 1108, 1110,   86, 1098,   86, 1100,   86,   86,
-     1102,   86, 1109,   86, 1107, 1115, 1106,   86, 1112,   86,
-     1116,  170,   86, 1118, 1111, 1113, 1117, 1114,   86, 1119,
-       86,   86,   86,   86,   86, 1122,   86,   86,   86, 1120,
-       86, 1135, 1121,  166,   86, 1138,   86, 1125, 1136, 1126,
-     1123,   86,   86, 1137, 1127,   86, 1124,   86, 1128,   86,
-       86, 1140, 1129,   86, 1130, 1143, 1145, 1141, 1131, 1142,
-     1132, 1146,   86,   86,   86, 1133, 1139, 1144,   86,   86,
-     1134,   86, 1147, 1149,   86,   86, 1152,   86, 1148, 1155,
-       86,   86,   86, 1151,   86, 1150, 1153, 1154, 1160,   86,
-
-     1162, 1156, 1163, 1159, 1161, 1158,   86, 1165,   86, 1164,
-       86, 1157,   86, 1166,   86,   86,   86,   86,   86,   86,
-       86,   86, 1181, 1178,   86,   86,   86,   86, 1177, 1182,
-       86,   86, 1180,   86, 1168, 1169, 1167,   86, 1170, 1179,
-     1184, 1183, 1188, 1171,   86, 1172, 1185, 1187,   86, 1186,
-       86, 1173,   86,   86,   86, 1189, 1174, 1175, 1194,   86,
-       86,   86, 1191, 1176, 1190, 1195,   86, 1197,   86, 1192,
-       86, 1198, 1193,   86,   86, 1200, 1202,   86,   86,   86,
-     1196,   86,   86, 1203,   86, 1199, 1208, 1201, 1205,   86,
-     1206,   86,   86,   86,   86,   86, 1204,   86, 1209, 1211,
-
-     1207,   86,   86,   86,   86, 1220,   86, 1218,   86, 1213,
-     1210,   86, 1216, 1212, 1215, 1217,   86, 1214,   86,   86,
-       86, 1219,   86,   86, 1221, 1224,   86,   86, 1229,   86,
-     1222,   86,   86, 1226, 1230,   86, 1231,   86, 1223,   86,
-     1233, 1225, 1228, 1234, 1227,   86, 1232, 1236, 1237,   86,
-       86, 1239,   86,   86, 1235, 1243, 1240,   86,   86, 1241,
-       86,   86, 1242,   86,   86,   86, 1238, 1244, 1250,   86,
-     1252,   86,   86,   86,   86, 1256,   86, 1246, 1248, 1249,
-     1245, 1247,   86,   86,   86,   86, 1253, 1254,   86, 1251,
-     1258,   86,   86, 1259, 1257,   86, 1262, 1255,   86,   86,
-
-     1260, 1261,   86, 1263,   86, 1265, 1268, 1264, 1269,   86,
-     1267,   86,   86,   86,   86,   86, 1273, 1272, 1266,   86,
-     1270,   86,   86,   86, 1279,   86, 1277, 1280,  165,   86,
-       86, 1271,   86,   86, 1281,   86,   86, 1274, 1278, 1283,
-     1275, 1282, 1276,   86, 1285,   86,   86,   86, 1284, 1289,
-       86, 1286, 1288, 1287,   86,   86, 1291,   86,   86, 1290,
-       86,   86,   86,   86,   86, 1294, 1296, 1292,   86, 1293,
-       86, 1297,   86, 1298,   86, 1299,   86, 1303,   86, 1304,
-     1295,   86, 1300,   86, 1301,   86, 1306, 1307,   86,   86,
-       86, 1305, 1311, 1302,   86,   86,   86, 1308,   86,   86,
-
-       86,  170, 1310, 1309, 1313, 1317,   86,   86,   86,   86,
-      163,   86, 1312, 1318, 1319,   86,   86, 1314,   86, 1316,
-       86, 1320, 1322, 1324, 1315, 1321, 1328, 1323, 1329, 1325,
-     1326,   86,   86,   86,   86,   86, 1327,   86,   86, 1332,
-     1331,   86,   86, 1333,   86,   86,   86,   86,   86, 1330,
-     1336,   86, 1342,   86, 1339, 1334, 1335,   86,   86, 1337,
-       86,   86,   86, 1340,   86, 1338,  161, 1346,   86, 1348,
-     1341, 1343, 1352,   86, 1353, 1345, 1344,   86, 1349,   86,
-     1350,   86, 1347, 1351, 1354, 1355,   86,   86, 1356,   86,
-     1358, 1357,   86,   86,   86,   86,   86,   86,   86, 1362,
-
-       86, 1365, 1361,   86, 1369,   86,   86,   86, 1359, 1364,
-     1360, 1367, 1366,   86, 1363,   86,   86,   86, 1370,   86,
-     1371, 1373, 1368, 1374,   86,   86, 1372,   86,   86,   86,
-       86,   86, 1376, 1375,   86,   86,   86, 1381,   86,   86,
-     1377, 1379,   86, 1380, 1386,   86, 1378, 1382,   86,   86,
-     1383,   86,   86,   86, 1385, 1384,   86, 1387, 1390, 1388,
-       86, 1398,   86, 1391, 1393, 1389,   86,   86,   86,   86,
-     1392,   86, 1394,   86,   86, 1396,   86, 1401,   86, 1404,
-     1400, 1395, 1397, 1399,   86,   86,   86, 1406, 1405, 1403,
-       86, 1402, 1407,   86,   86, 1411, 1455, 1408, 1409, 1410,
-
-       86, 1412,   86, 1419, 1421, 1413,   86, 1422, 1414, 1415,
-       86, 1420,   86, 1416, 1425,   86,   86, 1423,   86, 1417,
-       86, 1426,   86, 1418, 1424,   86, 1428, 1427,   86, 1430,
-       86,   86,   86, 1431, 1435, 1432,   86,   86,   86, 1429,
-       86,   86,   86, 1438,   86, 1436, 1441, 1442,   86, 1443,
-     1434, 1433,   86,   86,   86, 1439,   86, 1437, 1444,   86,
-     1440,   86, 1451,   86, 1450, 1445,   86, 1452, 1453, 1454,
-     1446,   86, 1447,   86, 1448,   86, 1449, 1456, 1457, 1458,
-     1460,   86,   86,   86, 1459, 1461,   86,   86, 1464,   86,
-     1462,   86,   86,   86, 1470,   86, 1471,   86, 1466,   86,
-
-       86, 1465,   86,   86, 1463, 1472,   86, 1469, 1474,   86,
-     1467, 1468,   86, 1473,   86, 1476, 1475,   86,   86, 1477,
-     1481,   86, 1480, 1483,   86,   86,   86, 1478, 1484,   86,
-     1486,   86, 1485, 1482,   86, 1489,   86,   86,   86, 1479,
-     1491,   86,   86, 1488,   86, 1492,   86, 1493, 1496,   86,
-     1487,   86,   86,   86,   86, 1501, 1499, 1490,   86, 1494,
-       86,   86, 1504, 1502,   86,   86,   86, 1495,   86, 1498,
-       86, 1497,   86, 1503, 1500, 1506, 1511,   86,   86, 1515,
-       86, 1507, 1508, 1505, 1509, 1510,   86,   86,   86,   86,
-     1513, 1512,   86, 1514, 1516,   86,   86,   86,   86, 1521,
-
-     1522, 1518, 1523, 1519,   86,   86,   86, 1524,   86,   86,
-     1517, 1520,   86,   86, 1528,   86,   86, 1525,   86,   86,
-     1527,  170,   86, 1526, 1535, 1536,   86,   86, 1531, 1538,
-       86,   86, 1529, 1537, 1530,   86, 1532,   86,   86, 1533,
-     1539,   86,   86,   86,   86, 1534, 1540,   86, 1546,   86,
-       86, 1551,   86, 1543,   86,   86, 1544, 1541, 1542, 1550,
-       86, 1545,   86, 3438, 1547, 1553, 1555,   86, 1549,   86,
-       86, 1556,   86,   86, 1548,   86,   86, 1559, 1552, 1558,
-       86, 1554, 1567,   86,   86, 1557,   86, 1560,   86, 1564,
-     1561, 1562, 1565, 1569, 1563, 1566,   86, 1568,   86,   86,
-
-     1570, 1572,   86,   86,   86,   86, 1573,   86, 1577, 1571,
-     1578,   86,   86,   86, 1575,   86,   86,   86, 1581,   86,
-       86, 1574, 1576,   86, 1586,   86,   86,   86, 1590, 1579,
-     1583, 1587, 1580,   86,   86, 1582, 1589, 1584, 1585,   86,
-     1593,   86,   86, 1588,   86, 1591,   86,   86,   86,   86,
-       86, 1597,   86, 1599, 1598,   86, 1594, 1595, 1592, 1601,
-       86, 1602,   86, 1596,   86, 1606,   86, 1600, 1607, 1608,
-     1603, 1604, 1605,   86,   86,   86, 1610,   86,   86, 1611,
-     1609,   86,   86, 1615, 1616, 1617,   86, 1614,   86,   86,
-       86,   86,   86, 1618, 1612,   86, 1619, 1620,   86,   86,
-
-       86,   86, 1613, 1621, 1623,   86,   86,   86, 1629, 1622,
-       86, 1628,   86, 1624, 1627,   86,   86,   86, 1634, 1625,
-     1630, 1626, 1631, 1635,   86, 1636,   86,   86, 1639, 1632,
-     1637,   86,   86,   86,   86, 1633,   86,   86,   86,   86,
-       86, 1643, 1647, 1642,   86, 1648, 1638,   86,   86, 1651,
-       86, 1640, 1641,   86, 1654,   86, 1644, 1646, 1645, 1653,
-       86,   86,   86,   86, 1649,   86,   86,   86,   86, 1652,
-     1663,   86,   86, 1650,   86, 1662,   86,   86, 1667,   86,
-     1655, 1656, 1657, 1661, 1658, 1659,   86, 1660,   86, 1666,
-     1670, 1664, 1668,   86,   86, 1665,   86,   86,   86, 1669,
-
-     1674, 1671,   86,   86, 1675, 1672,   86,   86, 1678,   86,
-     1673, 1682,   86,   86,   86,   86, 1684, 1676, 1683,   86,
-     1677, 1679,   86,   86, 1687, 1681,   86, 1680, 1686, 1685,
-     1688,   86,   86,   86,   86, 1689, 1695,   86, 1694,   86,
-       86,   86, 1692, 1690,   86, 1700, 1698,   86, 1699,   86,
-     1691,   86, 1702,   86, 1693,   86,   86, 1696, 1703, 1704,
-       86, 1697,   86,   86,   86,   86, 1707,   86,   86, 1701,
-       86, 1712, 1705,   86, 1710,   86,   86,   86, 1706,   86,
-       86, 1718, 1716,   86,   86, 1708,   86, 1709, 1711,   86,
-     1713,   86, 1719, 1717, 1714, 1715,   86, 1724,   86,   86,
-
-       86, 1721, 1720,   86,   86, 1727, 1729,   86, 1730,   86,
-       86, 1723, 1725,   86, 1722,   86, 1732, 1726, 1728,   86,
-       86,   86,   86, 1735, 1734,   86, 1737, 1738,   86, 1731,
-     1740,  170, 1733,   86,   86, 1739,   86,   86,   86, 1736,
-       86, 1748,   86,   86,   86,   86, 1817, 1741, 1743, 1749,
-       86, 1742, 1746, 1752,   86, 1744, 1745,   86,   86, 1753,
-     1756,   86, 1747, 1750,   86, 1751, 1754, 1758,   86, 1757,
-     1760,   86,   86,   86, 1762,   86,   86, 1755,   86,   86,
-       86,   86,   86, 1767, 1764, 1761, 1765,   86, 1759,   86,
-     1768, 1763,   86,   86, 1769,   86, 1772,   86, 1773,   86,
-
-       86,   86, 1780, 1766, 3438, 1770,   86, 1771,   86, 1777,
-       86, 1775, 1778, 1774,   86, 1781,   86, 1782,   86,   86,
-     1776,   86, 1787, 1785, 1779, 1784, 1786, 1788,   86, 1789,
-     1790,   86,   86, 1783, 1796,   86,   86, 1791,   86, 1792,
-       86, 1793, 1794,   86,   86,   86, 1801, 1802,   86, 1795,
-     1798,   86,   86,   86, 1800,   86, 1804,   86,   86,   86,
-     1803, 1797,   86, 1806, 1808, 1799, 1807,   86,   86,   86,
-       86,   86,   86,   86,   86,   86,   86,   86, 1818,   86,
-     1805,   86,   86,   86,   86, 1812, 1809, 1813, 1814, 1810,
-     1811, 1820,   86, 1815, 1821, 1823, 1819, 1816,   86,   86,
-
-     1825,   86, 1828, 1824,   86, 1822, 1829,   86,   86,   86,
-       86, 1833,   86, 1827, 1831,   86,   86,   86, 1826,   86,
-     1832,   86,   86,   86, 1830,   86,   86, 1834, 1838, 1835,
-     1840, 1841,   86,   86, 1842, 1837, 1839, 1848,   86,   86,
-     1836, 1843, 1847, 1849,   86, 1850,   86, 1844, 1853,   86,
-       86, 1846, 1845, 1852,   86,   86,   86,   86,   86,   86,
-     1857, 1856,   86, 1858, 1851,   86,   86, 1854,   86, 1866,
-       86, 1861, 1867,   86, 1855,   86,   86, 1863, 1859, 1865,
-     1864, 1860,   86,   86,   86, 1862,   86, 1873,   86,   86,
-       86,   86, 1874,   86, 1875, 1869, 1868,   86, 1871,   86,
-
-     1876, 1870, 1872,   86, 1879,   86,   86, 1883, 1881, 1878,
-     1882,   86,   86, 1880,   86, 1877,   86, 1887,   86, 1891,
-     1885, 1884,   86, 1886, 1892,   86,   86,   86,   86, 1897,
-       86,   86, 1888, 1896, 3438,   86, 1890, 1889, 1899,   86,
-     1893, 1900, 1894,   86, 1895,   86, 1903,   86, 1898,   86,
-     1901, 1905,   86,   86, 1907, 1904,   86, 1902, 1911,   86,
-       86,   86, 1909,   86,   86,   86,   86, 1906, 1910, 1908,
-       86, 1912,   86,   86, 1915, 1916,   86,   86,   86,   86,
-     1913, 1917, 1923,   86, 1914, 1919, 1918,   86, 1925, 1926,
-     1920,   86, 1921, 1922,   86,   86, 1928,   86,   86,   86,
-
-     1927, 1932,   86, 1934, 1924,   86,   86,   86,   86,   86,
-       86, 1929, 1938,   86,   86,   86, 1930,   86, 1931, 1933,
-     1941, 1940,   86, 1936,   86,   86, 1937, 1935,   86, 1942,
-     1939, 1944,   86, 1943, 1946, 1947,  170, 1945,   86, 1950,
-       86,   86,   86,   86, 1954,   86,   86,   86, 1948,   86,
-       86,   86,   86, 1949, 1952,   86, 1956,   86, 1957, 1961,
-     1951, 1955, 1953, 1958,   86,   86, 3438, 1962,   86, 1959,
-     1964, 1966, 1960, 1965,   86, 1963, 1967,   86,   86,   86,
-     1970, 1971,   86, 1968,   86,   86,   86, 1973, 1969,   86,
-       86,   86, 1974,   86,   86,   86, 1972,   86,   86,   86,
-
-     1979,   86, 1980,   86,   86,   86, 1984, 1981,   86, 3438,
-     1975, 1977, 1978, 1976, 1983, 1982,   86, 1985,   86,   86,
-     1991, 1988,   86, 1990, 1987, 1992,   86, 1993, 1989,   86,
-     1986,   86,   86,   86,   86,   86, 1999,   86, 2002,   86,
-     1994, 1995, 2003,   86, 2004,   86,   86, 1997, 1996, 2000,
-       86, 2001, 1998, 2006,   86,   86, 2007, 2010,   86, 2005,
-       86,   86, 2012,   86, 2011,   86, 2013, 2008,   86, 2014,
-     2016, 2009, 2019,   86,   86,   86,   86, 2018,   86, 2015,
-       86, 2022,   86,   86,   86, 2021,   86,   86, 2026,   86,
-     2017, 2025,   86,   86, 2027, 2028,   86,   86, 2020, 2023,
-
-       86,   86, 2036,   86, 2024, 2029, 2030, 2031,   86, 2038,
-     2034,   86, 2032,   86, 2039,   86, 2033, 2035, 2041,   86,
-     2037, 2042,   86, 2045, 2043, 2040,   86,   86,   86,   86,
-     2049,   86,   86,   86, 2051, 2046,   86, 2044,   86,   86,
-     2054, 2055,   86,   86, 2057,   86,   86, 2047,   86, 2048,
-       86,   86,   86, 2064,   86, 2062, 2052, 2059, 2050, 2060,
-     2053,   86,   86, 2056,   86,   86,   86,   86, 2063,   86,
-     2070, 2058, 2061, 2067, 2068,   86,   86,   86, 2074, 2066,
-       86,   86, 2073, 2065,   86, 2077,   86,   86, 2076, 2078,
-     2080,   86, 2072, 2069, 2081,   86,   86,   86,   86,   86,
-
-     2075, 2071, 2082,   86,   86, 2079,   86, 2083,   86, 2087,
-       86,   86, 2090,   86, 2091, 2092, 2086,   86,   86, 2084,
-       86,   86, 2085,   86,   86,   86, 2088, 2095, 2100,   86,
-     2099,   86, 2094, 2093,   86,   86, 2089,   86, 2097,   86,
-     2105, 2104,   86, 2096,   86,   86, 2098,   86, 2106, 2102,
-     2101, 2108,   86, 2107, 2103,   86, 2110, 2112,   86, 2109,
-       86, 2111,   86,   86,   86,   86, 2119,   86, 2113, 2116,
-       86,   86,   86,   86, 2114,   86, 2122, 2124,   86,   86,
-     2125, 2115, 2121, 2117, 2127, 2118, 2123,   86, 2120,   86,
-       86, 2126, 2131,   86, 2132,   86, 2133, 2135, 2136,   86,
-
-     2128, 2134,   86,   86,   86, 2129,   86,   86, 2140,   86,
-     2130, 2138,   86,   86,   86,   86, 2142, 2145,   86, 2139,
-     2147, 2141,   86,   86,   86, 2137,   86, 2143,  170,   86,
-       86,   86,   86, 2150,   86, 2156,   86, 2154, 2144, 2155,
-     2146, 2148, 2151, 2152, 2149, 2157,   86,   86, 2153, 2158,
-       86, 2160,   86,   86,   86,   86,   86,   86, 2161, 2162,
-       86, 2163, 2164,   86,   86, 2165, 2166, 2159, 2167,   86,
-     2168,   86,   86, 2172,   86,   86, 2169, 2171,   86,   86,
-       86,   86, 2176, 2170, 2173, 2174, 2175, 2177,   86,   86,
-       86,   86,   86,   86,   86,   86, 2182, 2184, 2178, 2179,
-
-     2183,   86,   86,   86,   86,   86, 2189, 2180,   86,   86,
-     2181, 2185, 2187, 2186,   86, 2188,   86, 2190, 2192,   86,
-     2191,   86, 2194, 2195,   86,   86, 2200,   86, 2193, 2198,
-       86, 2196,   86, 2201,   86,   86,   86, 2197, 2199, 2206,
-       86,   86, 2208,   86,   86,   86, 2209,   86, 2202, 2205,
-     2203, 2204, 2210,   86,   86, 2211,   86, 2207, 2212,   86,
-       86, 2213, 2215, 2216,   86,   86, 2214,   86, 2220,   86,
-       86, 2217,   86,   86,   86,   86, 2218,   86,   86, 2221,
-       86,   86,   86,   86,   86, 2219, 2223, 2224, 2225, 2226,
-     2229, 2234,   86, 2222,   86, 2228,   86,   86,   86,   86,
-
-     2431, 2231, 2237, 2230, 2227, 2232, 2233,   86,   86,   86,
-       86, 2241, 2238, 2240, 2235,   86,   86, 2236, 2239,   86,
-     2243,   86,   86, 2244,   86,   86,   86, 2249, 2242, 2251,
-     2245, 2247,   86,   86, 2252,   86, 2248, 2246, 2254,   86,
-       86,   86,   86,   86, 2257, 2250, 2256, 2253, 2258,   86,
-       86,   86, 2262,   86, 2259,   86,   86, 2266,   86,   86,
-     2263,   86, 2267,   86,   86, 2265, 2255, 2268, 2260, 2264,
-       86, 2261, 2271,   86,   86, 2272,   86, 2275, 2270,   86,
-     2269,   86,   86,   86, 2276, 2273,   86, 3438, 2277,   86,
-     2279, 2281,   86,   86, 2283,   86, 2274,   86, 2280, 2278,
-
-       86, 2282,   86, 2284, 2285, 2286,   86,   86, 2290,   86,
-       86,   86, 2292,   86,   86, 2287, 2288, 2293,   86, 2289,
-     2295,   86, 2294,   86,   86, 2296, 2297,   86, 2298, 2299,
-     2291,   86, 2303,   86, 2300,   86,   86,   86,   86,   86,
-     2302,   86,   86,   86,   86,   86,   86, 2301, 2310,   86,
-       86, 2316, 2308, 2304, 2305, 2306, 2309, 2311, 2312,   86,
-       86,   86, 2307,   86, 2313, 2314, 2315,   86, 2322, 2317,
-       86,   86, 2320, 2319, 2321, 2325,   86,   86, 2327,   86,
-     2324,   86, 2318,   86,   86,   86, 2326, 2329,   86, 2330,
-     2333,  170,   86, 2337,   86, 2323,   86, 2335, 2331,   86,
-
-     2328,   86, 2336,   86, 2338,   86, 2349, 2332, 2339, 2340,
-       86,   86, 2341, 2334, 2342,   86,   86, 2343, 2347,   86,
-     2346,   86, 2348,   86, 2351,   86, 2353,   86, 2354,   86,
-       86, 2344, 2352,   86, 2356,   86,   86,   86, 2355, 2357,
-       86, 2350, 2345,   86,   86,   86,   86, 2359,   86,   86,
-     2362,   86,   86,   86, 2365,   86, 2358, 2360,   86,   86,
-     2369, 2364, 2371,   86,   86,   86,   86, 2367, 2372, 2361,
-     2366, 2363,   86, 2368, 2373,   86,   86, 2374,   86,   86,
-     2370,   86,   86, 2379, 2376, 2382,   86, 2377,   86,   86,
-     2383, 2375, 2380,   86,   86, 2378,   86,   86,   86, 2381,
-
-       86,   86,   86,   86,   86, 2396,   86, 2384, 2385, 2390,
-     2395, 2397,   86,   86, 2393, 2388, 2386, 2392, 2387, 2389,
-     2394, 2391,   86,   86,   86,   86, 2399, 2398,   86,   86,
-     2403, 2404,   86,   86,   86, 2405, 2451, 2400,   86, 2401,
-       86, 2402, 2406,   86,   86, 2409,   86, 2412,   86, 2407,
-       86, 2408, 2413,   86,   86, 2410,   86,   86, 2411, 2414,
-     2416, 2415, 2419,   86, 2420,   86,   86, 2422,   86, 2418,
-     2417,   86, 2424,   86,   86,   86, 2427,   86,   86, 2426,
-     2428,   86,   86,   86,   86, 2421, 2435,   86,   86, 2423,
-     2425, 2430, 2429, 2434,   86, 2437,   86, 2432,   86,   86,
-
-       86,   86,   86, 2433, 2440, 2439,   86, 2441, 2443,   86,
-       86,   86, 2446, 2436,   86,   86, 2438, 2445,   86, 2444,
-     2449,   86, 2442,   86,   86,   86, 2447,   86, 2453, 2454,
-       86,   86, 2456, 2448,   86, 2450,   86, 2455, 2452,   86,
-     2457, 2459,   86, 2461,   86,   86, 2458,   86,   86, 2466,
-       86,   86,   86, 2462, 2460,   86, 2474, 2468,   86, 2467,
-     2472, 2469, 2463, 2464, 2473,   86,   86,   86,   86,   86,
-     2475,   86,   86, 2465,   86,   86, 2470, 2479, 2471, 2481,
-     2482, 2477, 2484,   86,   86, 2485,   86, 2488,   86,   86,
-     2478,   86, 2476,   86, 2489,   86,   86, 2480, 2483,   86,
-
-     2490, 2487,   86,   86,   86, 2486, 2493,   86,   86,   86,
-       86, 2494, 2492, 2495, 2499,   86, 2496, 2497, 2500, 2501,
-       86, 2491,   86, 2498,   86,   86, 2504, 2505,   86, 2506,
-     2502, 2503,   86,   86,   86, 2509,   86, 2507,  170,   86,
-       86, 2508,   86, 2510,   86, 2515,   86,   86,   86, 2517,
-       86,   86,   86, 2526,   86, 2513, 2511, 2516, 2512, 2518,
-     2514,   86,   86, 2521, 2519, 2520,   86, 2523, 3438, 2522,
-       86, 2527, 2524, 2525, 2528,   86,   86,   86, 2531, 2529,
-     2532,   86, 2530,   86,   86,   86,   86, 2534,   86,   86,
-     2533,   86, 2536,   86,   86, 2540, 2541, 2535,   86, 2538,
-
-       86, 2537,   86, 2543,   86,   86,   86,   86, 2544, 2545,
-     2546,   86, 2539,   86, 2542,   86, 2548,   86, 2547, 2552,
-       86, 2551,   86,   86, 2549, 2550,   86,   86, 2554,   86,
-       86,   86,   86, 2561, 2558, 2553,   86, 2560,   86,   86,
-       86,   86, 2562, 2557,   86,   86, 2555, 2556,   86, 2566,
-       86, 2559,   86,   86, 2576, 2571, 2563, 2570,   86, 2564,
-     2565,   86, 2568,   86, 2569,   86, 2567, 2573,   86,   86,
-       86, 2572, 2575, 2577,   86, 2579,   86, 2574, 2581,   86,
-     2580, 2583,   86,   86,   86, 2585,   86,   86,   86,   86,
-       86, 2582, 2584,   86, 2589, 2578,   86,   86,   86,   86,
-
-     2594,   86, 2587, 2592, 2593, 2586, 2588, 2595,   86, 2596,
-       86, 2597,   86, 2598,   86,   86,   86, 2591,   86, 2590,
-       86, 2600,   86, 2602,   86, 2605,   86,   86,   86, 2607,
-     2603, 2606,   86, 2601, 2599,   86, 2604, 2610,   86,   86,
-       86,   86, 2611, 2609,   86, 2608,   86, 2614, 2615,   86,
-       86, 2612,   86, 2618,   86, 2616, 2620, 2619, 2613, 2617,
-       86,   86,   86,   86,   86,   86,   86, 2624, 2628,   86,
-       86, 2627, 2629,   86, 2621, 2622, 2623, 2630,   86, 2631,
-       86,   86, 2632, 2625,   86, 2626,   86, 2635,   86, 2634,
-       86, 2636,   86,   86,   86,   86,   86,   86,   86, 2633,
-
-     2637, 2643,   86, 2645,   86, 2639, 2646,   86,   86, 2647,
-       86,   86, 2638, 2642, 2640, 2644, 2641, 2649,   86,   86,
-     2648,   86,   86, 2650, 2652, 2655,   86,   86,   86,   86,
-       86,   86,   86,   86,   86, 2663, 2656,   86, 2651,  170,
-       86, 2653, 2654, 2659,   86, 2665, 2661,   86,   86, 2658,
-       86, 2664, 2667,   86, 2657, 2660, 2662, 2666, 2669,   86,
-       86,   86, 2668, 2672,   86,   86, 2674, 2676,   86, 2675,
-     2677,   86, 2670, 2673,   86, 2678, 2671,   86, 2679,   86,
-     2680,   86,   86, 2681,   86,   86,   86,   86,   86,   86,
-       86,   86, 2682, 2691,   86,   86,   86,   86, 2689, 2684,
-
-     3438, 2683,   86, 2695, 2686, 2685, 2696,   86, 2688, 2687,
-     2690,   86,   86, 2693, 2692, 2694, 2700,   86, 2698,   86,
-       86, 2699, 2702,   86,   86, 2697,   86,   86, 2701,   86,
-       86,   86,   86, 2705, 2711,   86, 2712,   86, 2703,   86,
-       86,   86, 2704,   86, 2706, 2707,   86, 2709, 2708, 2715,
-     2718, 2710, 2716,   86, 2717,   86,   86,   86, 2714, 2713,
-     2721,   86,   86,   86, 2719,   86,   86, 2723,   86,   86,
-     2727, 2726, 2720, 2728,   86, 2722,   86,   86, 2729, 2730,
-       86,   86,   86, 2724,   86, 2725, 2732,   86, 2731,   86,
-       86,   86, 2736,   86, 2734, 2737,   86, 2742,   86, 2741,
-
-     2733,   86,   86,   86, 2735, 2745,   86,   86,   86, 2738,
-     2739,   86, 2748, 2740, 2746,   86, 2743, 2751,   86, 2750,
-     2744,   86, 2747,   86,   86,   86, 2749, 2756,   86,   86,
-       86,   86, 2760,   86, 2752, 2759,   86,   86, 2753, 2758,
-       86, 2757, 2762,   86, 2754, 2755,   86,   86,   86, 2764,
-       86, 2763,   86, 2765,   86, 2761, 2768,   86, 3438, 2766,
-       86, 2769, 2771,   86,   86, 2772,   86, 2773, 2767,   86,
-     2777,   86, 2770, 2774,   86, 2775,   86,   86, 2776, 2780,
-       86,   86, 2781,   86,   86,   86, 2782,   86,   86, 2784,
-       86, 2779,   86, 2785, 2778,   86, 2788, 2783,   86, 2787,
-
-     2790,   86,   86, 2791, 2793,   86, 2786, 2789, 2794,   86,
-       86, 2797,  170,   86,   86, 2795, 2792,   86,   86, 2799,
-     2798, 2796, 2802,   86,   86,   86, 2804,   86,   86, 2803,
-     2807,   86, 2806, 2808,   86, 2800, 2801,   86, 2805, 2810,
-       86,   86, 2812,   86, 2811,   86,   86, 2813,   86,   86,
-     2809, 2814, 2817,   86, 2815,   86,   86, 2816,   86, 2818,
-     2821, 2819, 2820,   86,   86,   86, 2824, 2825,   86,   86,
-     2826, 2822,   86,   86,   86,   86, 2828,   86, 2830, 2829,
-     2827,   86,   86,   86,   86, 2823, 2832, 2833,   86, 2831,
-       86,   86,   86, 2838,   86,   86, 2841, 2835,   86, 2836,
-
-     2837, 2834,   86, 2839, 2842,   86, 2840,   86, 2846,   86,
-       86,   86,   86,   86, 2843, 2851,   86, 2847,   86,   86,
-       86, 2849,   86,   86,   86, 2844, 2845, 2855, 2850, 2858,
-     2848, 2856,   86, 2859, 2853,   86, 3438, 2852, 2861,   86,
-     2854,   86, 2860,   86,   86, 2862,   86, 2857, 2864, 2863,
-       86,   86, 2867,   86,   86,   86, 2868,   86,   86, 2865,
-       86, 2869,   86, 2872, 2866, 2874,   86,   86, 2870, 3438,
-     2871, 2875,   86, 2876,   86,   86,   86,   86, 2873, 2877,
-       86, 2878, 2879,   86,   86, 2881, 2883, 2880,   86, 2882,
-       86, 2884,   86,   86, 2887,   86, 2885, 2888,   86, 2889,
-
-       86,   86,   86, 2891, 2890, 2893,   86,   86, 2886, 2896,
-       86,   86, 2897, 2894,   86, 2892, 2898,   86, 2900,   86,
-       86,   86,   86,   86, 2904, 2905,   86, 2895,   86, 2899,
-       86, 2907, 2906, 2901,   86,   86, 2903,   86, 2909, 2902,
-     2908,   86,   86, 2910,   86, 2915, 2911,   86, 2914,   86,
-       86,   86,   86, 2917, 2912, 2918,   86, 2919, 2920,   86,
-       86, 2913, 2921,   86,   86, 2924, 2923,   86,   86,   86,
-       86,   86, 2916, 2927, 2931,   86,   86,   86, 2938,   86,
-       86, 2930,   86, 2939,   86, 2922, 2925, 2926, 2928,   86,
-     2932, 2929, 2933, 2935,   86,   86, 2936, 2977, 2940, 2942,
-
-     2934,   86, 2937, 2941,   86, 2943,   86,   86, 2944,   86,
-     2945,   86, 2946,   86, 2947,   86,   86, 2948,   86,   86,
-     2949, 2951,   86, 2952,   86,   86,   86, 2954, 2958,   86,
-     2959,   86,   86, 2955,   86, 2960, 2950,   86, 2953, 2962,
-       86, 2964,   86,   86, 2963, 2956, 2957,   86, 2965, 2966,
-       86,   86, 2961,   86,   86,   86, 2967, 2972,   86,   86,
-     2968,   86, 2969, 2970,   86, 2973,   86,   86, 2974, 2978,
-       86,   86,   86, 2971, 2979,   86, 2982, 2976,   86, 2981,
-     2980,   86,   86, 2975, 2984,   86, 2983, 2985,   86, 2989,
-       86,   86, 2986,   86,   86,   86, 2987,   86,   86,   86,
-
-     2988, 2996, 2990, 2991, 2993,   86, 2994,   86,   86,   86,
-     2997,   86, 3001, 2999, 3000, 2995,   86,   86,   86, 2992,
-       86,   86, 3003,   86, 3006, 3002, 2998, 3007, 3008,   86,
-     3011, 3004, 3009,   86, 3005, 3010,   86,   86,   86,   86,
-     3015,   86,   86, 3014,   86,   86,   86, 3016,   86, 3017,
-     3018,   86,   86,   86, 3026,   86,   86, 3012, 3013, 3019,
-     3020, 3022, 3024,   86,   86,   86, 3021, 3027,   86, 3028,
-     3023,   86,   86, 3030,   86,   86, 3029,   86, 3025, 3035,
-       86,   86,   86,   86, 3031,   86,   86, 3038,   86, 3032,
-     3033,   86,   86,   86, 3036, 3037, 3042, 3034, 3043,   86,
-
-     3039, 3040,   86, 3044,   86, 3041, 3048,   86, 3045,   86,
-     3046, 3050,   86, 3051,   86,   86, 3053,   86,   86,   86,
-       86,   86,   86, 3059,   86, 3056,   86, 3058, 3049,   86,
-     3047,   86,   86, 3062, 3054, 3055, 3052, 3057, 3061,   86,
-       86, 3065,   86,   86, 3068,   86, 3060,   86,   86, 3070,
-       86, 3064,   86, 3071, 3063,   86, 3066, 3073,   86, 3074,
-       86,   86, 3067,   86, 3077,   86,   86, 3069,   86,   86,
-       86, 3083, 3072, 3082,   86,   86, 3075, 3079, 3080,   86,
-     3086,   86, 3084, 3076, 3078,   86,   86,   86, 3081, 3088,
-     3087,   86,   86, 3438, 3085, 3089,   86, 3090, 3093, 3091,
-
-     3094,   86, 3096,   86,   86, 3092, 3095,   86,   86, 3097,
-     3099,   86, 3098,   86,   86, 3102,   86,   86, 3100, 3105,
-       86,   86,   86,   86,   86, 3110,   86,   86, 3106,   86,
-       86, 3114,   86, 3101, 3103, 3104,   86, 3109,   86, 3113,
-     3107, 3115,   86, 3116,   86, 3112, 3111,   86, 3108, 3118,
-     3117, 3119,   86, 3120,   86, 3121,   86,   86, 3124,   86,
-     3122,   86, 3126,   86,   86,   86, 3125,   86,   86,   86,
-       86, 3132, 3133,   86,   86,   86,   86,   86, 3127, 3139,
-       86, 3140,   86, 3123,   86,   86, 3141, 3128, 3130, 3129,
-     3131, 3136,   86, 3138, 3135,   86, 3137,   86,   86,   86,
-
-     3134,   86, 3144, 3146,   86, 3142, 3147,   86,   86,   86,
-     3150, 3151,   86, 3148, 3143, 3149,   86, 3152,   86, 3145,
-     3153,   86,   86, 3154,   86,   86, 3155,   86,   86, 3156,
-       86,   86, 3157, 3159,   86,   86, 3161,   86,   86, 3160,
-       86, 3438, 3162,   86,   86, 3158,   86,   86,   86,   86,
-     3163,   86, 3171, 3172, 3175, 3164, 3166, 3165, 3174, 3167,
-     3173, 3168, 3169,   86,   86,   86, 3177, 3170, 3179,   86,
-       86, 3176, 3180,   86, 3181, 3182,   86,   86, 3178,   86,
-     3185,   86, 3183, 3186,   86, 3187, 3188,   86,   86, 3189,
-     3190, 3194,   86, 3191,   86,   86, 3192, 3193, 3184,   86,
-
-     3195,   86, 3197,   86,   86,   86,   86,   86,   86,   86,
-     3196, 3203,   86, 3202,   86,   86,   86,   86,   86, 3199,
-       86, 3207, 3198, 3206, 3208,   86, 3200, 3201,   86, 3204,
-     3211, 3212,   86, 3209,   86, 3214,   86, 3213, 3210, 3205,
-     3215,   86, 3216,   86,   86,   86,   86, 3221,   86, 3218,
-     3223, 3217, 3222,   86, 3219,   86,   86, 3220,   86,   86,
-       86, 3230,   86, 3225, 3227, 3228, 3231,   86, 3233,   86,
-       86, 3224,   86, 3232, 3234,   86, 3226, 3229,   86, 3237,
-       86, 3238,   86, 3236,   86, 3235, 3240,   86, 3241,   86,
-     3242,   86,   86, 3239, 3243,   86, 3244,   86, 3245,   86,
-
-     3246,   86, 3247,   86,   86, 3250,   86,   86,   86,   86,
-     3254,   86,   86, 3249, 3256,   86, 3251,   86, 3248,   86,
-     3252,   86,   86,   86,   86, 3260, 3261,   86,   86, 3253,
-       86, 3255, 3257, 3265, 3258, 3259,   86, 3262, 3263,   86,
-       86, 3267, 3270,   86,   86, 3266, 3264, 3269,   86,   86,
-       86,   86,   86,   86, 3268, 3272,   86, 3271, 3276,   86,
-       86,   86, 3277, 3278,   86,   86,   86, 3282, 3273, 3274,
-     3281,   86, 3275, 3284,   86, 3279, 3285,   86,   86, 3283,
-     3286,   86,   86,   86,   86,   86,   86, 3280, 3289,   86,
-       86, 3288,   86,   86, 3287, 3294,   86, 3291, 3290,   86,
-
-     3293, 3295,   86, 3297,   86, 3299, 3298, 3296, 3292,   86,
-       86,   86,   86,   86, 3300,   86,   86,   86, 3306,   86,
-     3301, 3304, 3308, 3305,   86, 3303, 3309,   86,   86, 3311,
-     3312, 3314,   86,   86, 3302,   86, 3307, 3316,   86, 3310,
-       86, 3317, 3315, 3318,   86, 3319,   86,   86, 3313,   86,
-       86,   86, 3322,   86, 3320, 3323, 3324,   86, 3327,   86,
-       86,   86,   86,   86,   86, 3330,   86, 3321, 3331,   86,
-     3333,   86, 3326, 3328, 3329, 3334,   86,   86, 3325, 3337,
-       86, 3332, 3336,   86, 3339, 3340,   86,   86, 3341,   86,
-       86,   86, 3335, 3344, 3345,   86,   86, 3342, 3338,   86,
-
-       86,   86, 3350,   86,   86, 3346, 3349,   86, 3347, 3343,
-     3351,   86,   86,   86,   86, 3348,   86, 3355,   86,   86,
-       86, 3357,   86,   86,   86, 3352, 3354, 3353, 3362, 3363,
-     3364,   86, 3359, 3360, 3356,   86,   86, 3358,   86, 3368,
-       86, 3361,   86, 3370,   86, 3371,   86, 3369,   86,   86,
-       86, 3372, 3376, 3373, 3366, 3365,   86, 3367,   86, 3377,
-       86, 3374,   86, 3379,   86,   86,   86, 3378,   86, 3375,
-     3380,   86,   86, 3385,   86, 3382,   86,   86, 3388,   86,
-     3389,   86,   86,   86, 3381,   86,   86, 3392,   86, 3387,
-     3383, 3384, 3390, 3386,   86, 3391,   86, 3396,   86, 3397,
-
-       86, 3395,   86, 3400, 3393, 3394,   86,   86, 3402,   86,
-     3403, 3398,   86,   86,   86, 3407,   86, 3404,   86,   86,
-     3405, 3409,   86, 3408,   86, 3401, 3399, 3410,   86, 3411,
-       86, 3412,   86, 3406,   86, 3416,   86, 3414,   86,   86,
-       86,   86,   86,   86, 3418, 3419,   86, 3422,   86, 3413,
-     3423,   86, 3438, 3415,   86, 3426,   86, 3417, 3427,   86,
-     3420, 3421, 3424, 3428, 3429,   86,   86, 3425, 3430,   86,
-       86,   86,   86, 3431,   86, 3432, 3433, 3436,   86, 3437,
-       86, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3434, 3438, 3435,   47,   47,   47,   47,   47,   47,
-
-       47,   52,   52,   52,   52,   52,   52,   52,   57,   57,
-       57,   57,   57,   57,   57,   63,   63,   63,   63,   63,
-       63,   63,   68,   68,   68,   68,   68,   68,   68,   74,
-       74,   74,   74,   74,   74,   74,   80,   80,   80,   80,
-       80,   80,   80,   89,   89, 3438,   89,   89,   89,   89,
-      160,  160, 3438, 3438, 3438,  160,  160,  162,  162, 3438,
-     3438,  162, 3438,  162,  164, 3438, 3438, 3438, 3438, 3438,
-      164,  167,  167, 3438, 3438, 3438,  167,  167,  169, 3438,
-     3438, 3438, 3438, 3438,  169,  171,  171, 3438,  171,  171,
-      171,  171,  174, 3438, 3438, 3438, 3438, 3438,  174,  177,
-
-      177, 3438, 3438, 3438,  177,  177,   90,   90, 3438,   90,
-       90,   90,   90,   17, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438
+static const flex_int16_t yy_nxt[5319] =
+    {   17,
+       18,    19,    20,    21,    22,    23,    22,    18,    18,    18,
+       18,    18,    22,    24,    25,    26,    27,    28,    29,    30,
+       18,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+       40,    41,    42,    43,    44,    45,    46,    18,    18,    47,
+       17,    48,    48,    49,    50,    51,    48,    48,    48,    48,
+       48,    48,    48,    48,    52,    48,    48,    48,    48,    48,
+       48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
+       48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
+       48,    17,    53,    53,    54,    55,    53,    53,    56,    53,
+       53,    53,    53,    53,    53,    57,    53,    53,    53,    53,
+
+       53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
+       53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
+       53,    53,    17,    58,    59,    60,    61,    62,    58,    22,
+       58,    58,    58,    58,    58,    58,    63,    58,    58,    58,
+       58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
+       58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
+       58,    58,    58,    17,    64,    64,    65,    66,    67,    64,
+       64,    64,    64,    64,    64,    64,    64,    68,    64,    64,
+       64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+       64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+
+       64,    64,    64,    64,    17,    69,    19,    20,    21,    70,
+       71,    72,    69,    69,    69,    69,    69,    69,    73,    69,
+       69,    69,    69,    69,    69,    69,    69,    74,    69,    69,
+       69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
+       69,    69,    69,    69,    69,    17,    75,    76,    77,    78,
+       79,    75,    22,    75,    75,    75,    75,    75,    75,    80,
+       75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+       75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+       75,    75,    75,    75,    75,    75,    17,    81,    81,    82,
+       83,    84,    81,    81,    81,    81,    81,    81,    81,    81,
+
+       85,    81,    81,    81,    81,    81,    81,    81,    81,    81,
+       81,    81,    81,    81,    81,    81,    81,    81,    81,    81,
+       81,    81,    81,    81,    81,    81,    81,    17,    86,    17,
+       99,   121,   122,    86,   123,    86,    86,    86,    86,    86,
+      132,    87,    86,    86,    86,    86,    86,    86,    86,    86,
+       86,    86,    86,    86,    86,    86,    86,    86,    86,    86,
+       86,    86,    86,    86,    86,    86,    86,    86,    17,   139,
+       88,    17,    90,    91,    89,    91,    91,    90,    91,    90,
+       90,    90,    90,    90,    91,    92,    90,    90,    90,    90,
+       90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
+
+       90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
+       90,    90,    17,    93,    93,   161,    93,    93,    93,    93,
+       93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+       93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+       93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+       93,    93,    93,    94,    95,   162,   100,    96,   110,   112,
+      114,   171,    97,   101,   181,   104,   184,   102,   115,   105,
+      103,    98,   106,   113,   107,   108,   124,   117,   111,   116,
+      118,   190,   128,   154,   125,   109,   129,   119,   191,   120,
+      126,   133,   140,   155,   127,   134,   141,   156,   157,   135,
+
+      130,   150,   131,   151,   192,   136,   142,   143,   137,   144,
+      145,   193,   152,   146,   194,   138,   195,   198,   153,   158,
+      147,   199,   200,   159,   148,   149,   206,   160,    17,   163,
+      163,   204,   205,   207,   163,   163,   163,   163,   163,   163,
+      163,   163,   164,   163,   163,   163,   163,   163,   163,   163,
+      163,   163,   163,   163,   163,   163,   163,   163,   163,   163,
+      163,   163,   163,   163,   163,   163,   163,   163,   163,    17,
+      165,   165,   210,   165,   165,   165,   165,   165,   165,   165,
+      165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+      165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+
+      165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+       17,   166,   166,   211,   212,   166,   166,   216,   166,   166,
+      166,   166,   166,   166,   167,   166,   166,   166,   166,   166,
+      166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+      166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+      166,    17,   168,   168,   217,   168,   168,   168,   168,   168,
+      168,   168,   168,   168,   168,   168,   168,   168,   168,   168,
+      168,   168,   168,   168,   168,   168,   168,   168,   168,   168,
+      168,   168,   168,   168,   168,   168,   168,   168,   168,   168,
+      168,   168,    17,   169,   218,   219,   220,   221,   169,   228,
+
+      169,   169,   169,   169,   169,   169,   170,   169,   169,   169,
+      169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
+      169,   169,   169,   169,   169,   169,   169,   169,   169,   169,
+      169,   169,   169,    17,   172,   172,   236,   172,   172,   172,
+      172,   172,   172,   172,   172,   172,   172,   172,   172,   172,
+      172,   172,   172,   172,   172,   172,   172,   172,   172,   172,
+      172,   172,   172,   172,   172,   172,   172,   172,   172,   172,
+      172,   172,   172,   172,    17,   173,   173,   237,   238,   239,
+      173,   173,   173,   173,   173,   173,   173,   173,   174,   173,
+      173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+
+      173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+      173,   173,   173,   173,   173,    17,   175,   175,   240,   175,
+      175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
+      175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
+      175,   175,   175,   175,   175,   175,   175,   175,   175,   175,
+      175,   175,   175,   175,   175,   175,    17,   176,   234,   241,
+      242,   243,   176,   235,   176,   176,   176,   176,   176,   176,
+      177,   176,   176,   176,   176,   176,   176,   176,   176,   176,
+      176,   176,   176,   176,   176,   176,   176,   176,   176,   176,
+      176,   176,   176,   176,   176,   176,   176,    17,   178,    91,
+
+      244,    91,    91,   178,    91,   178,   178,   178,   178,   178,
+      178,   179,   178,   178,   178,   178,   178,   178,   178,   178,
+      178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
+      178,   178,   178,   178,   178,   178,   178,   178,    17,   180,
+      180,   245,   180,   180,   180,   180,   180,   180,   180,   180,
+      180,   180,   180,   180,   180,   180,   180,   180,   180,   180,
+      180,   180,   180,   180,   180,   180,   180,   180,   180,   180,
+      180,   180,   180,   180,   180,   180,   180,   180,   180,    17,
+      182,   246,   247,   250,   251,   182,    86,   182,   182,   182,
+      182,   182,   182,   183,   182,   182,   182,   182,   182,   182,
+
+      182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
+      182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
+       17,   185,   185,   252,   185,   185,   185,   185,   185,   185,
+      185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+      185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+      185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+      185,    17,   186,   186,   258,   272,   274,   186,   186,   186,
+      186,   186,   186,   186,   186,   187,   186,   186,   186,   186,
+      186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+      186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+
+      186,   186,    17,   188,   188,   278,   188,   188,   188,   188,
+      188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
+      188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
+      188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
+      188,   188,   188,    17,    91,    91,   279,    91,    91,    91,
+       91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
+       91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
+       91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
+       91,    91,    91,    91,    17,   189,   189,   280,   189,   189,
+      189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
+
+      189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
+      189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
+      189,   189,   189,   189,   189,   196,   201,   208,   213,   214,
+      226,   229,   202,   253,   203,    86,   215,   222,   197,   231,
+      223,   248,   254,   232,    86,   249,   209,   257,   255,   259,
+      256,   230,   264,   224,   225,   227,   262,   281,   266,   233,
+      260,   265,   269,    86,   261,   271,   282,    86,   263,    86,
+      273,   283,   275,   270,    86,   267,   284,    86,   268,   286,
+      287,   276,   290,   291,   294,   296,    86,    86,   295,   297,
+       17,   285,   285,   277,   285,   285,   285,   285,   285,   285,
+
+      285,   285,   285,   285,   285,   285,   285,   285,   285,   285,
+      285,   285,   285,   285,   285,   285,   285,   285,   285,   285,
+      285,   285,   285,   285,   285,   285,   285,   285,   285,   285,
+      285,   288,   292,   298,   299,   300,   301,   304,    86,   293,
+      305,   306,   307,   302,    86,   303,   289,   308,   315,   310,
+      316,   317,   318,   319,   311,   320,   321,   322,   324,   312,
+      325,   326,   327,   328,   309,   313,   314,   331,   329,   332,
+       86,   330,   333,   334,   339,   340,   335,   341,   336,   342,
+      343,   344,   346,   347,   348,   349,   323,    86,   352,   351,
+      337,   353,   338,   345,   354,   355,   356,   358,   359,    86,
+
+      350,    86,   362,   357,   363,   364,   367,   365,   368,   369,
+       86,   360,    86,   361,   366,    86,   370,   371,   372,   373,
+      374,   376,   377,   378,    86,   375,   380,   381,   382,   383,
+      384,   379,   385,   386,   387,    86,   389,   390,   388,   391,
+      392,   393,    86,   395,   396,   398,    86,   400,   401,    86,
+       86,   397,    86,   404,    86,   405,   406,   407,   408,   409,
+      394,   410,   411,   412,    86,   402,   413,   414,   415,   399,
+      403,   416,   417,    86,   418,   419,   420,   421,    86,   423,
+      424,   425,   426,    86,   428,   429,   427,   430,   431,   432,
+      433,    86,    86,   435,   436,    86,   437,   438,   439,   422,
+
+      440,   441,   434,    86,   442,   444,   445,   446,   447,   449,
+      450,    86,   451,   453,    86,   454,   455,   456,    86,   458,
+      459,   443,   452,   460,   461,   463,   464,    86,   465,   466,
+      473,   474,   457,   448,   467,   475,   476,   468,   477,   480,
+      481,   462,   469,   470,   471,   472,   482,   483,   484,   487,
+      485,   478,   488,   489,   479,   486,   490,   491,    86,   492,
+      493,   494,    86,   495,   496,   497,   498,   499,   500,   501,
+      502,   503,   504,   505,    86,   507,   508,   509,   512,   510,
+      513,   514,   515,   516,   517,   519,    86,   520,   511,   522,
+      518,   526,   527,   506,   528,   529,   530,   521,   531,   537,
+
+      532,   538,   523,   543,   548,   524,   533,   525,   549,   550,
+      534,   554,   563,   564,   539,   535,   567,   540,   536,   541,
+      551,   542,   544,   545,   565,   570,   552,   571,   546,   566,
+      555,   556,   572,   573,   574,   575,   553,    86,   568,    86,
+      557,   547,   558,   559,   560,   569,   577,   561,   578,   579,
+      562,   581,   583,   576,   584,   585,   586,   587,   588,   580,
+      589,   590,   591,   592,    86,   593,    86,    86,   596,   582,
+      597,   598,   599,   600,   601,   602,   604,   605,    86,   603,
+      608,   607,   610,   611,   612,   613,    86,   615,   619,   595,
+      594,    86,    86,   616,   606,   609,   620,   621,   624,   614,
+
+      622,   623,   625,   626,   617,   627,   618,   628,   629,    86,
+      631,   632,   633,   634,   635,   636,   630,   637,    86,    86,
+      639,   640,   641,   638,    86,   642,   643,   644,   645,    86,
+      646,   647,   648,   650,   651,   652,   653,    86,   654,   655,
+      649,   656,   657,   658,   659,   660,   661,    86,   663,   664,
+       86,   666,   667,   668,   669,   662,   670,   671,   672,   674,
+      673,   675,   676,   677,   665,   678,   679,   680,   681,    86,
+      682,   683,   685,   686,   684,   687,   688,   689,   690,   691,
+      693,   694,   695,   696,   697,   698,   699,   700,   701,    86,
+      703,   705,    86,    86,   713,   714,   706,   715,   707,   716,
+
+      702,   717,   718,   692,   708,   704,   709,   719,   720,   710,
+      711,   721,   723,   724,   725,   722,   712,   726,   727,   728,
+       86,   731,   732,   733,   734,    86,   736,   730,   737,   738,
+      729,    86,   740,   741,    86,   743,   744,   745,   746,   747,
+      748,   749,   742,   750,   753,   735,    86,   751,    86,   754,
+      752,   755,   756,   757,   758,   759,    86,   761,   762,   763,
+      766,   764,   739,    86,   769,    86,   760,   765,   768,   770,
+      771,   772,   767,    86,    86,   773,   774,   775,    86,   776,
+      777,   778,   779,    86,   782,   783,    86,   786,   787,   780,
+      784,   788,   781,   789,   790,   791,   792,    86,   785,   795,
+
+      796,   793,   797,   798,   799,   800,   801,    86,   803,   804,
+      805,   806,   807,   794,   808,   809,   810,    86,   802,   811,
+      812,   813,   814,    86,   816,   817,   818,   819,   824,   825,
+      826,   815,   820,   827,   828,   821,   822,   829,   830,   831,
+      832,    86,   834,   823,   835,   837,   838,   839,   840,   841,
+       86,   843,   842,   844,   845,   846,   833,    86,   847,   848,
+      849,    86,   850,   851,   852,   853,   836,   854,   855,   858,
+       86,   856,   857,   859,   860,    86,    86,   862,   863,   861,
+      864,   865,   866,   867,   868,    86,   870,   871,   872,    86,
+      874,   875,   876,   873,   869,   880,   877,   881,   882,   883,
+
+      884,   885,   886,   887,   889,   890,   895,   891,   893,   896,
+      878,   879,   897,   894,   898,   899,    86,   892,   888,   900,
+      901,   902,   903,   904,   905,   906,   907,   908,    86,    86,
+      909,   910,   911,   912,   913,   914,   915,   916,   917,   918,
+       86,   919,    86,   921,    86,   922,   923,   925,   924,   928,
+      920,    86,   926,   927,    86,   930,   931,   932,   929,   933,
+      934,   935,   936,    86,   938,   939,   940,   941,   942,   943,
+      944,   945,   946,   937,    86,   947,   948,   949,   950,   951,
+      952,    86,   953,   954,   955,   956,   957,   958,   959,    86,
+      960,   961,   962,   963,   964,    86,   966,    86,   965,    86,
+
+      967,   969,   970,   971,   972,   973,   974,   975,   968,   976,
+      977,    86,   979,    86,   980,    86,   982,   978,   981,   983,
+      984,   985,   986,   993,    86,   987,   995,    86,   996,   988,
+      997,   998,   989,   999,   994,    86,  1000,  1001,  1002,   990,
+      991,    86,   992,  1004,  1005,  1006,  1007,  1015,  1008,  1009,
+       86,  1010,  1016,  1017,  1011,  1018,  3704,  1020,  1003,  1012,
+     1022,  1023,  1024,  1025,  1026,  1013,  1014,  1027,  1029,  1030,
+     1031,  1032,  1028,  1021,  1033,  1034,  1035,  1036,  1037,  1038,
+       86,  1019,  1039,  1040,  1041,  1042,    86,  1043,  1044,    86,
+     1046,  1045,  1047,  1048,  1049,  1050,  1051,    86,  1053,  1054,
+
+       86,  1052,  1055,  1056,  1058,    86,  1059,  1060,  1057,  1061,
+     1062,  1063,  1064,  1065,  1066,  1067,  1068,  1069,  1070,  1071,
+     1072,    86,  1074,  1073,    86,  1076,    86,  1077,    86,  1079,
+     1080,    86,  1078,  1082,  1083,  1075,  1084,  1085,  1086,    86,
+     1088,  1089,  1090,  1091,  1081,    86,  1093,  1092,  1094,    86,
+     1096,  1098,  1100,    86,  1101,  1097,  1102,  1095,  1103,  1104,
+     1106,  1107,  1087,  1099,  1108,    86,  3704,  1105,  1110,  1111,
+       86,  1113,  1112,    86,  1115,  1116,    86,  1118,  1119,  1120,
+     1121,  1122,  1123,  1117,  1124,  1125,  1126,  1128,  1109,    86,
+     1127,    86,    86,  1129,  1114,    86,  1130,  1131,  1132,  1133,
+
+     1134,  1135,  1136,  1137,  1138,  1139,  1140,  1141,  1142,  1143,
+     1144,  1145,  1146,  1147,    86,  1148,  1149,  1150,  1151,    86,
+     1152,  1153,  1155,  1156,  1157,    86,  1158,  1159,  1160,  1154,
+     1161,  1162,    86,  1163,  1164,  1165,    86,  1166,  1167,  1168,
+     1169,  1171,  1170,    86,  1174,  1175,  1172,  1176,  1177,  1178,
+     1179,    86,  1181,  1173,  1182,  1180,  1183,  1184,  1185,  1186,
+     1192,  1187,  1193,  1194,  1195,  1188,    86,  1189,  1197,  1198,
+     1199,  1196,  1190,  1200,  1201,  1202,  1204,  1191,  1205,  1206,
+     1203,  1208,  1209,  1211,  1212,  1213,  1214,  1215,  1216,    86,
+     1217,  1207,  1210,  1218,  1219,  1220,  1221,  1222,  1223,  1224,
+
+     1225,    86,    86,  1227,  1234,    86,    86,  1235,  1228,  1236,
+     1229,  1237,  1238,  1239,  1226,  1241,  1230,    86,  1242,  1243,
+     3704,  1231,  1232,  1245,  1240,  1246,  1247,  1248,  1233,  1249,
+     1250,  1251,  1254,  1252,    86,  1255,  1256,  1244,    86,  1257,
+     1253,    86,  1259,  1260,  1261,  1262,  1264,    86,    86,  1258,
+     1265,  1263,  1266,  1267,  1268,  1269,  1270,  1271,  1272,  1273,
+     1274,  1275,  1276,    86,  1278,  1279,  1280,  1281,  1277,  1282,
+       86,  1283,  1284,  1285,    86,  1287,  1288,  1289,  1290,  3704,
+     1292,  1291,  1293,  1294,  1286,  1295,  1296,  1297,  1298,  1300,
+     1303,  1301,    86,  1299,  1302,  1304,  1305,    86,  1307,  1308,
+
+     1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,    86,
+     1319,  1320,  1321,  1306,  1322,  1323,  1324,  1325,  1326,  1327,
+       86,  1328,  1329,  1330,  1318,  1332,  1331,  1333,  1334,    86,
+     1336,    86,    86,    86,  1338,  1339,  1335,  1337,  1340,  1341,
+     1342,  1343,  1344,  1345,  1346,  1347,  1348,  1349,  1350,  1351,
+     1352,  1353,  1354,  1355,  1356,  1357,  1359,  1360,    86,  1362,
+     1363,  1364,  1365,  1358,  1361,  1366,  1367,    86,  1368,  1369,
+     1370,    86,  1372,  1373,  1374,    86,  1376,  1377,  1378,  1379,
+     1380,  1381,    86,  1383,    86,  1385,  1375,  1386,    86,  1387,
+     1388,  1389,  1371,  1390,  1391,  1384,  1392,  1393,  1394,    86,
+
+     3704,  1396,  1397,  1398,  1399,  1400,  1401,    86,  1402,  1403,
+     1404,  1405,  1406,  1382,  1407,  1408,  1409,  1410,  1411,  1412,
+     1413,  1395,  1414,  1415,  1416,  1417,  1422,    86,  1423,    86,
+     1424,  1425,  1426,  1427,  1418,  1428,  1419,  1421,  1429,  1420,
+     1430,  1431,  1432,    86,  1433,  1434,  1435,  1437,    86,    86,
+     1436,  1438,  1439,  1440,  1441,  1442,  1443,  1444,  1445,  1446,
+     1447,  1448,  1449,  1450,  1451,  1452,    86,  1454,  1453,  1455,
+     1456,  1457,  1458,  1459,  1460,  1461,  1462,  1463,  3704,  1465,
+     1466,  1467,  1468,  1469,  1470,    86,  1471,  1473,  1472,  1474,
+       86,    86,  1475,  1476,  1478,  1479,  1481,    86,  1477,  1482,
+
+       86,  1489,  1490,  1483,  1464,  1480,  1484,  1485,  1491,  1492,
+     1493,  1486,  1494,  1495,  1496,  1497,  1498,  1487,  1499,  1500,
+     1501,  1488,  1502,  1503,    86,  1505,  1506,  1504,  1507,  1508,
+     1509,  1510,  1511,  1512,  1513,  1514,  1515,  1516,  1521,  1522,
+     1523,    86,  1517,  1527,  1518,    86,  1519,  1526,  1520,  1524,
+     1525,    86,  1528,  1529,  1530,  1531,  1532,    86,  1534,  1535,
+       86,  1533,  1537,  1538,  1539,    86,  1541,  1542,    86,  1536,
+     1543,  1544,  1546,    86,  1547,  1548,  1549,  1550,  1551,  1540,
+     1545,    86,  1553,  1554,  1555,  1556,  1557,    86,    86,  1559,
+     1560,  1561,  1562,  1563,    86,  1558,    86,  1552,  1565,    86,
+
+     1564,  1566,  1567,    86,  1569,  1570,  1571,    86,  1573,  1574,
+     1575,  1576,  1577,  1578,  1579,  1572,  1580,  1581,  1582,  1583,
+     1584,  1568,  1585,  1586,  1587,  1588,  1589,  1590,  1592,    86,
+     1593,  1594,  1591,  1595,  3704,  1597,  3704,    86,  1600,  1601,
+     1602,  1596,  1603,  1604,  1598,  1605,    86,  3704,  1599,    86,
+     1608,  1609,  1610,  1611,  1612,  1613,  1614,    86,  1616,  1606,
+     1617,  1618,  1619,  1620,    86,  1622,  1623,  1624,    86,  1621,
+     1626,  1627,  1628,  1607,  1629,  1625,  1630,  1615,  1631,  1632,
+     1633,  1634,  1635,  1636,  1637,  1639,  1640,    86,  1641,  1638,
+     1642,    86,  1644,  1646,  1648,  1645,  1647,  1649,  1650,  1651,
+
+     1652,  3704,  1654,  1656,    86,  1658,    86,  1655,  1659,  1660,
+     1661,  1662,  1643,  1653,  1657,  1663,  1664,  1665,  1666,  1667,
+     1668,    86,  1669,  1670,  1671,  1672,  1673,  1674,  1675,  1676,
+     1677,  1678,  1679,  1680,    86,  1681,  1682,  1683,  1684,  1685,
+     1686,  1687,  1688,  1689,  1690,    86,  1691,    86,    86,    86,
+     1693,    86,  1692,  1695,  1694,  1696,  1697,  1698,  1699,  1700,
+     1701,    86,  1702,  1703,  1704,  1705,  1706,  1707,  1708,  1709,
+     1710,  1711,  1712,  1713,  1714,  1715,  1716,    86,  1718,  1717,
+     1720,  1722,  1723,  1719,    86,  1721,  1725,  1726,  1727,  1728,
+     1729,  1730,  1731,  1732,  1733,    86,  1735,  1736,  1724,  1737,
+
+     1738,  1739,  1742,  1743,  1740,  1744,  1745,  1734,  1741,    86,
+     1746,    86,  1748,  1749,  1750,  1751,  1752,  1753,  1754,    86,
+       86,  1755,  1756,  1757,  1758,    86,  1760,  1761,    86,  1765,
+     1762,  1747,  1766,  1759,  1763,  1767,  1768,  1769,    86,  1771,
+     1772,  1773,  1774,  1775,  1776,  1770,  1777,  1764,  1778,  1779,
+     1780,  1781,  1782,  1783,  1784,  1785,  1786,  1787,  1788,  1789,
+     1790,  1791,  1792,  1793,  1794,  1795,  1796,  1797,  1798,  1799,
+     1800,  1801,  1802,  1803,  1804,    86,  1806,    86,  1808,  1809,
+     1810,  1811,  1812,    86,  1814,  1815,  1807,  1816,  1818,  1819,
+     1817,  1805,  1820,  1821,  1822,  1823,  1824,  1825,  1826,  1827,
+
+       86,  1828,    86,  1830,  1831,    86,  1832,  1833,  1829,  1834,
+     1835,  1837,  3704,  1836,  1813,  1838,    86,  1839,  1840,  1841,
+     1842,  1843,  1844,  1845,  1846,  1847,  1848,    86,  1850,  1851,
+     1849,  1852,  1853,  1854,  1855,  1856,  1857,  1858,  1859,  1860,
+     1861,  1862,  1863,    86,  1865,  1866,  1867,  1868,    86,    86,
+     1870,  1871,  1864,    86,  1872,  1874,  1873,  1875,  1878,  1879,
+     1876,  1880,  1869,    86,  1882,  1883,  1884,  1885,  1886,    86,
+     1887,  1888,  1877,  1889,  1890,  1891,  1892,  1881,  1893,    86,
+     1895,  1896,  1897,  1894,  1898,  1899,  1900,  1901,  1902,  3704,
+     1904,  1905,  1906,  1907,  1908,  1909,  1910,  1911,  1912,  1913,
+
+     1914,  1915,  1916,  1917,    86,  1919,  1920,  1921,  1922,    86,
+     1924,  1925,    86,  1903,  1926,    86,    86,  1928,  1929,  1930,
+     1923,  1931,  1918,    86,    86,  1934,    86,  1936,  1937,  1938,
+     1932,    86,  1935,  1940,  1933,  1941,  1943,  1944,  1942,    86,
+     1946,  3704,  1945,  1927,  1939,  1947,  1948,  1949,  1950,  1951,
+     1952,  1953,  1954,  1955,  1956,  1957,  1958,  1959,  1960,  1961,
+     1962,  1963,  1964,  1966,  1967,  1965,  1968,  1969,  1970,  1971,
+     1972,  1973,  1974,  1975,  1977,  1978,  1979,  1980,  1976,  1981,
+     1982,  1983,  1984,  1985,  1986,  1988,  1990,  1991,  1989,  1992,
+     3704,  1994,    86,  1997,    86,  1995,  1998,    86,  1987,  2000,
+
+     1996,  2001,  2002,  2003,  2004,  2005,  1999,  2006,  2007,  2008,
+     2009,  2010,  1993,  2011,  2012,  2013,  2014,  2016,    86,  2017,
+       86,  2019,  2015,  2020,  2021,  2018,  2022,  2023,  2024,    86,
+     2025,  2026,  2027,  2028,  2030,  2031,  2032,  2033,  2034,  2035,
+     2036,  2037,  2038,  2039,  2041,  2042,  2043,  2044,  2040,    86,
+     3704,  2047,    86,  2045,  2048,  2029,  2049,  2050,    86,  2051,
+     2052,    86,  2053,  2054,  2055,    86,  2057,  2046,  2058,  2059,
+     2060,  2061,  2062,  2063,  2064,  2056,    86,    86,  2066,  2067,
+     2065,  2068,  2069,  2070,  2071,  2072,    86,  2073,  2074,  2075,
+     2076,  2077,  2078,  2079,  2080,  2081,  2082,  2083,  2084,  2085,
+
+     2086,  2087,  2088,  2089,    86,  3704,  2091,  2092,  2093,  2094,
+     2095,  2096,  2097,  2098,  2099,    86,  2101,  2102,  2104,  2105,
+     2106,  2107,  2109,    86,  2103,  2108,  2110,  2100,  2090,    86,
+     2112,  2113,  2114,  2116,  2115,  2117,  2118,  2119,  2111,  2120,
+     2121,  2122,  2123,  2124,  2125,    86,  2126,  2127,  2128,  2129,
+     2130,    86,    86,  2132,  2133,  2134,  2135,  2136,  2137,  2138,
+     2139,  2140,  2141,  2142,  2143,  2144,  2145,  2148,  2146,  2149,
+     2150,  2147,  2151,  2152,  2131,  2153,  2154,  2156,  2157,  2158,
+       86,  2155,    86,  2160,  2161,  3704,  2163,  2164,  2165,  2159,
+       86,    86,  2168,  2169,    86,  2162,  2167,  2171,  2172,  2173,
+
+     2174,  2166,  2175,  2176,  2177,  2178,  2179,    86,  2181,  2182,
+     2183,    86,  2170,  2184,  2185,  2186,  2187,  2188,  2180,  2189,
+     2190,  2191,    86,  2193,  2194,  2195,  2196,  2197,    86,  2199,
+     2200,  2201,  2202,  2192,  2203,  2204,  2205,  2206,  2207,  2208,
+     2209,  2210,  2211,  2212,  2213,  2198,  2214,  2215,  2217,    86,
+     2219,  2220,  2221,  2223,  2224,  2222,  2225,  2226,  2228,  2229,
+     2230,    86,  2218,  2216,  2231,  2227,  2232,    86,    86,  2234,
+       86,  2233,    86,  2237,  2238,  2239,  2240,  2241,  2242,  2243,
+     2244,    86,  2246,  2248,  2249,  2250,  2235,  2247,  2251,  2245,
+     2253,  2254,  2236,  2252,  2256,  2257,  2255,  2258,  2260,    86,
+
+       86,  2262,  2259,  2263,  2264,  2265,  2266,  2267,  2268,  2269,
+     2261,  2270,    86,  2271,  2272,  2273,  2274,    86,  2276,    86,
+     2278,  3704,  2281,  2280,  2282,  2283,  2284,  2285,  2286,  2287,
+     2279,  2288,  2289,  2290,  2291,  2275,  2292,  2277,    86,  2293,
+     2294,  2295,  2296,  2297,  3704,  2299,    86,  2300,  2301,  2302,
+     2303,  2304,  2305,  2306,  2298,  2307,  2308,  2309,  2310,  2311,
+     2312,  2313,    86,  2315,  2316,  2317,  2318,  2319,  2320,  2321,
+     2322,  2323,  2325,  2326,  2327,    86,  2314,  2328,  2329,  2330,
+     3704,  2332,  2324,  2333,  2334,    86,  2335,    86,  2337,    86,
+       86,  2339,  2340,    86,  2342,    86,  2343,  2336,  2338,  2344,
+
+     2345,  2346,  2331,  2347,    86,    86,  2350,  2341,    86,  2349,
+       86,  3704,  2353,  2354,  2351,  2355,  2356,  2357,  2358,  2348,
+     2359,  2360,  2361,  2362,    86,  2364,  2365,  2367,  2368,  2369,
+     2370,    86,  2372,  2373,  2352,  2374,  2363,  2371,  2375,  2366,
+     2376,  2377,  2378,    86,  2379,  2380,  2381,  2382,  2383,  2384,
+     2385,  2386,  3704,  2388,  2389,    86,  2391,  2392,  2393,  2394,
+     2395,  2396,  2397,  2390,  2398,  2399,  2400,  2401,  2402,  2404,
+     2403,  2405,  2387,    86,  2407,  2408,  2406,  2409,  2410,  2411,
+     2412,  2414,  2413,  2415,  2416,  2417,    86,    86,  2418,  2421,
+     2419,  2422,  2423,  2424,  2425,  2426,  2427,    86,  2420,  2428,
+
+     2429,  2431,    86,  2430,  2433,  2435,  2436,  2437,  2438,  2434,
+     2439,  2440,  2441,  2442,  2443,  2444,  2445,  2446,  2447,    86,
+       86,  2432,  2450,  2448,  2451,  2452,  2453,  2454,  2455,  2456,
+     2457,  2458,  2459,  2460,  3704,  2462,  2465,  2449,  2466,  2467,
+     2470,  2464,  2468,  2472,  2469,  2473,  2461,    86,  2463,    86,
+       86,  2474,  2475,  2476,  2477,  2478,    86,  2480,  2481,  2482,
+     2483,  2471,  2484,  2485,  2486,    86,  2479,  2487,  2488,  2490,
+     2491,  2492,  2493,  2489,  2494,  2495,  2496,  2497,  2500,  2501,
+       86,  2502,  2503,  2504,  2505,  2506,  2507,  2508,  2509,  2510,
+       86,  2498,    86,  2511,  2512,  2513,  2514,  2515,  2516,    86,
+
+     2518,  2519,  2499,  2520,  2517,    86,  2522,  2523,    86,  2525,
+       86,  2526,  2521,  2527,  2528,    86,  2530,  2531,    86,  2533,
+       86,  2535,  2529,  2536,    86,  2538,  2524,  2539,  2540,  3704,
+     2534,  2542,    86,  2544,  2545,  2546,  2547,  3704,  2537,    86,
+     2549,  2543,    86,  2532,  2551,  2552,  2553,    86,  2554,  2555,
+     2550,  2556,  2548,  2557,  2541,  2558,  2559,  2560,  2561,  2562,
+     2563,  2564,  2565,  2566,  2568,  2569,  2567,  2570,  2571,    86,
+       86,  2573,  2574,  2575,  2576,  2577,  2578,  2579,  2572,  2580,
+       86,  2581,  2582,  2583,  2584,  2585,  2586,  2587,    86,  2589,
+     2590,  2591,  2588,    86,  2592,  2593,  2594,  2595,  2596,  2597,
+
+     2598,  2599,  2600,  2602,  2603,  2604,    86,  2605,  2606,  2607,
+     2608,  2609,  2610,    86,  2612,  2614,    86,  2601,  2613,  2615,
+       86,  2616,  2617,  2618,  2619,  2620,  2621,  2622,  2623,  2624,
+     3704,  2611,  3704,  2627,    86,  2628,  2629,    86,  2630,  2633,
+     2634,  2635,  2636,  2625,  2637,    86,    86,  3704,    86,  2641,
+     2642,  2640,  2643,  2631,  2644,  2632,  2645,  2646,  2647,  2626,
+     2648,  2639,  2649,  2650,  2651,  2652,  2653,  2654,  2655,  3704,
+     2657,  2658,  2659,  2656,  2660,  2661,  2638,  2662,  2663,  2664,
+     2665,  2666,  2667,  2668,    86,  2670,  2671,  2673,  2674,    86,
+     2675,  2676,  2677,  2679,  2680,  2681,  2682,  2669,    86,  2672,
+
+     2678,  2683,  2684,    86,  2688,  2689,  2685,  2690,  2686,  2691,
+     2692,  2694,  2693,  2695,  2687,    86,  2696,  2697,  2698,  2699,
+     2700,  2701,  2702,  2703,  2704,    86,  2705,  2706,  2707,  2708,
+     2709,  2710,  2711,  2712,  2713,    86,  2715,  2716,  2717,  2718,
+       86,  2720,  2721,  2719,  2722,  2723,  2724,  2725,  2726,  2727,
+     2728,  2729,  2730,    86,  2731,  2732,  2733,  2734,  2735,  2736,
+     2714,    86,    86,  2739,  2737,  2740,  2741,    86,  2743,    86,
+     2745,  2746,    86,  2748,  3704,  2738,  2750,  2749,  2751,  2752,
+     2753,  2754,  2744,    86,  2756,  2757,  2747,  2742,  2758,  2759,
+     2760,  2761,    86,  2763,  2764,  2765,  2766,  2767,  2768,  2769,
+
+     2770,  2771,  2772,  2773,  2774,  2775,  2776,  2777,  2755,  2778,
+       86,  2780,  2762,  2779,    86,  2782,  2783,  2784,  2785,  2786,
+     2787,  2788,    86,  2790,  2791,  2792,  2793,  2794,  2781,  2795,
+     2796,  2797,  2798,  2799,  2800,  2789,  2801,  2802,  2803,  2804,
+     2805,    86,  2807,    86,  2808,  2806,  2809,  2810,  2811,  2812,
+     2813,  2814,  2815,  2816,  2817,  2818,  2819,  2820,  2821,  2822,
+       86,  2824,  3704,  2826,  2827,  2828,  2829,  2831,  3704,  2823,
+     2832,  2833,    86,  2835,  2836,  2837,  2838,  2839,  2834,  2825,
+     2830,  2840,  2841,  2842,  2843,  2844,  2845,  2846,    86,  2848,
+     3704,  3704,  2851,  2852,  2847,  2853,    86,  2855,    86,  2856,
+
+     2857,  2858,  2859,  2860,  2849,  2861,  2854,  2862,  2863,  2864,
+       86,  2866,  2867,    86,  2868,  2869,  2850,  2870,  2865,  2871,
+     2872,  2873,  2874,  2875,    86,  2876,    86,  2877,  2878,  2879,
+     2880,  2881,  2882,  2883,  2884,  2885,  2886,  2887,  2888,  2889,
+     2890,  2891,  2892,  2893,  2894,  2895,  2896,  2897,  2898,  2899,
+     2900,    86,  2901,  2902,  2903,  2904,  2905,  2906,  2907,  2908,
+       86,    86,  2909,  2910,  2911,  2912,  2913,  2914,  2915,  2916,
+     2917,  2918,    86,  2919,  2920,  2921,  2922,  2923,  2924,  2925,
+     2926,  2927,  2928,    86,  2929,  2930,  2932,  2931,    86,    86,
+     2933,  2934,  2935,  2936,  2937,  2938,  2939,  2940,  2941,  2942,
+
+       86,  2943,  2944,  3704,  2946,  2947,  2948,  2949,  2950,  2951,
+     2952,  2953,  2954,  2955,  2956,  2945,  2957,  2958,  2959,  2960,
+     2961,    86,  2962,  2963,  2964,    86,  2966,  2967,  2968,  2969,
+       86,  2971,  2972,  2970,  2973,  2974,  2975,    86,  2976,  2965,
+     2977,  2978,  2979,  2980,  2981,  2982,  2983,  3704,  2985,  2986,
+       86,  2987,  2988,  2989,  2990,  2991,  2992,  2994,  2993,  2995,
+     2996,  2997,  2998,  2999,  3000,  3001,  3002,  3003,    86,  2984,
+       86,  3004,  3005,  3006,  3007,  3008,  3704,  3010,  3011,  3012,
+     3013,  3014,    86,  3015,  3009,  3016,  3017,  3018,  3019,  3020,
+     3021,  3022,    86,    86,  3023,  3024,  3026,  3027,  3028,    86,
+
+     3025,  3029,  3030,  3031,  3032,  3033,  3034,    86,  3036,  3037,
+     3038,  3039,  3040,  3041,  3042,  3043,  3044,  3045,  3046,  3047,
+     3035,  3048,  3049,  3050,  3051,  3052,  3053,    86,    86,    86,
+     3057,    86,  3059,  3060,  3061,  3062,  3063,  3056,  3064,  3054,
+     3065,  3058,  3055,  3066,  3067,  3068,  3069,  3070,  3071,  3072,
+     3073,  3074,  3075,  3076,  3077,    86,  3079,  3080,  3078,  3081,
+     3082,  3083,  3084,    86,  3086,  3087,  3088,  3089,  3090,  3091,
+       86,  3092,  3085,  3093,  3094,  3095,  3096,  3097,  3098,  3099,
+     3101,  3102,  3103,  3104,  3100,  3105,  3106,  3107,  3108,  3109,
+     3110,    86,  3111,  3112,  3113,  3114,  3115,  3116,  3117,  3118,
+
+     3119,  3120,  3121,    86,  3122,  3123,  3124,  3125,  3126,  3127,
+     3128,  3129,  3704,  3131,  3132,  3133,  3134,  3135,  3704,  3138,
+     3139,  3140,  3136,  3141,  3142,  3143,  3144,    86,  3145,  3146,
+       86,  3147,  3130,  3148,  3149,  3150,  3151,  3152,  3153,  3154,
+     3155,  3156,  3137,    86,  3157,  3158,  3159,  3160,  3162,  3163,
+     3164,  3165,  3167,  3169,  3170,  3161,  3166,  3168,  3171,  3172,
+     3173,  3174,  3175,  3176,  3177,    86,    86,  3179,  3180,  3181,
+     3182,  3183,  3184,  3185,  3186,  3187,  3188,  3189,  3190,  3191,
+       86,    86,  3193,  3194,  3192,  3195,  3196,  3178,  3197,  3198,
+     3199,  3200,  3201,  3202,  3203,  3204,  3205,    86,  3207,  3210,
+
+     3206,  3208,    86,  3211,    86,    86,  3209,  3212,  3213,  3214,
+     3215,  3216,  3217,    86,  3219,  3220,  3221,    86,  3218,  3223,
+     3224,  3225,  3704,  3227,  3222,  3228,  3229,  3230,  3704,  3231,
+     3232,  3233,  3704,  3235,  3236,  3238,  3237,  3239,  3240,  3241,
+     3242,  3243,  3244,  3226,    86,  3245,  3247,  3248,  3246,  3249,
+     3250,  3251,  3252,    86,  3234,  3254,  3255,  3256,  3257,  3258,
+     3259,  3260,  3261,  3262,  3263,  3264,  3265,  3266,  3253,  3267,
+     3268,  3269,  3270,  3271,  3704,  3273,  3274,  3275,  3276,  3277,
+     3278,  3279,    86,  3281,  3282,    86,  3283,  3284,  3285,  3286,
+     3272,  3704,  3288,  3280,  3289,  3290,  3291,  3292,  3293,  3294,
+
+     3295,    86,  3296,  3297,  3298,  3299,  3300,  3301,  3302,  3303,
+     3304,  3305,  3306,    86,  3307,    86,  3309,  3310,  3287,  3311,
+     3312,  3313,  3315,    86,  3308,  3314,  3316,    86,  3318,  3317,
+     3319,  3321,  3322,  3323,  3324,  3325,    86,  3326,  3327,  3328,
+     3704,  3330,  3331,  3332,  3333,  3334,  3335,    86,  3336,  3337,
+     3320,  3338,  3339,  3329,  3340,  3341,  3342,  3343,    86,  3345,
+     3346,  3347,  3348,    86,  3349,  3350,  3351,  3344,  3352,  3353,
+     3354,    86,  3356,  3357,  3358,    86,  3359,  3360,  3361,  3362,
+     3363,    86,  3704,  3365,  3366,  3367,  3368,  3369,    86,  3371,
+     3372,  3355,  3373,  3374,  3375,    86,  3377,  3364,  3378,  3379,
+
+     3380,  3382,  3370,    86,  3383,  3384,  3385,    86,  3376,  3387,
+     3381,  3388,  3389,  3390,  3391,  3392,  3393,    86,  3395,  3396,
+     3394,  3397,  3386,  3398,  3399,  3400,  3401,  3704,    86,  3404,
+     3405,  3403,  3704,  3407,  3408,  3409,  3410,  3406,  3411,  3412,
+     3402,  3704,  3414,  3415,  3416,  3417,  3418,    86,  3413,  3419,
+     3420,  3421,  3422,  3423,  3424,    86,  3425,  3426,  3427,  3428,
+     3704,  3704,  3431,  3432,  3429,  3433,  3434,  3435,  3436,  3437,
+     3438,  3439,  3440,  3441,  3444,  3430,  3442,  3443,  3445,  3446,
+     3447,  3448,    86,  3450,  3451,  3452,  3449,  3453,  3454,    86,
+     3455,    86,  3456,  3457,    86,  3459,  3460,  3461,  3462,  3463,
+
+       86,  3464,  3465,  3466,  3467,  3468,    86,  3470,  3471,    86,
+     3472,  3458,  3473,  3469,  3474,  3476,  3478,  3475,  3479,  3480,
+     3477,    86,  3482,  3481,  3483,  3704,    86,  3485,  3486,  3704,
+     3488,  3489,  3490,  3491,  3492,  3493,  3487,  3494,  3495,  3496,
+     3497,  3498,  3499,  3500,  3501,  3484,  3502,  3503,    86,  3505,
+     3506,  3507,  3509,  3704,  3510,  3511,  3704,    86,  3512,  3513,
+     3514,    86,  3516,  3517,  3518,  3504,  3508,  3519,  3520,  3515,
+     3521,    86,  3523,  3524,    86,  3525,  3526,  3527,  3528,  3704,
+     3530,  3531,  3532,  3704,  3522,  3534,  3535,  3704,    86,  3537,
+     3538,  3539,  3536,  3540,  3529,  3541,  3542,  3543,  3544,  3545,
+
+     3533,  3546,    86,  3548,  3549,  3704,  3551,  3552,  3553,  3554,
+     3555,  3556,  3557,    86,  3558,  3559,  3547,  3560,  3561,  3562,
+       86,    86,  3564,  3565,  3566,  3567,  3550,    86,  3569,  3570,
+       86,  3571,  3572,  3573,  3574,  3575,  3576,  3577,  3578,  3579,
+     3580,  3581,  3563,  3582,  3583,  3584,  3585,  3586,  3587,  3588,
+     3589,  3590,  3591,  3592,  3568,  3593,  3594,  3595,  3596,  3597,
+       86,  3598,  3599,  3600,  3601,    86,  3603,  3602,  3604,  3605,
+       86,  3606,  3607,  3608,  3609,  3704,  3611,  3612,  3613,  3614,
+     3704,  3616,  3617,  3618,    86,  3620,  3621,  3619,  3622,  3610,
+     3623,  3624,  3625,  3626,  3627,  3628,  3629,  3630,  3631,  3632,
+
+     3633,  3634,  3615,  3635,  3636,  3637,  3638,  3639,  3640,  3641,
+     3642,  3643,  3644,  3645,  3646,  3647,    86,  3649,  3650,  3651,
+     3652,  3653,  3654,  3655,  3656,  3658,  3659,  3657,  3660,  3648,
+     3661,  3662,  3663,  3664,    86,    86,  3666,  3667,  3668,  3669,
+     3670,  3671,  3672,  3673,  3674,  3675,  3676,  3665,    86,  3677,
+     3678,  3679,  3680,  3681,  3682,  3683,  3684,  3685,  3686,  3687,
+     3688,  3689,  3690,  3691,  3692,  3693,  3694,  3695,  3696,  3697,
+     3698,  3699,  3700,  3701,  3702,  3703,     0,  3704,  3704,  3704,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704
     } ;
 
-static const flex_int16_t yy_chk[6755] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    5,    5,    6,    6,
-        5,    3,    6,   24,    4,   24,   24,    5,   24,    6,
-        7,    7,    7,    7,   24,    7,    8,    8,    8,    8,
-       33,    8,    7,    9,    9,    9,   26,   26,    8,   10,
-       10,   10,   19,   29,    9,   33,   19,   29, 3446,   35,
-       10,   11,   11,   11,   11,   11,   11,   13,   13,   13,
-
-       13,   34,   13,   11,   35,   99,   34,   29,   38,   13,
-       51,   51,   11,   12,   12,   12,   12,   12,   12,   14,
-       14,   14,   14,   99,   14,   12,   15,   15,   15,   38,
-       23,   14,   23,   23,   12,   23,   46,   15,   16,   16,
-       16,   23,   23,   25,   27,   27,   25,   25, 2797,   16,
-       25,   46,   27,   30,   30,   25,   27,   56,   40,   27,
-       56,   73,   31,   31,   25,   28,   67,   67,   30,   32,
-       28,   31,   40,   32,   28,   73,   32,   28,   92,   28,
-       28,   92,   31,   32, 1116,   32,   36,   36,   37,   37,
-       28,   45,   45,   37,   97,   36,   45,   97,   41,   41,
-
-       45,   36,   87,   41,   93,   36,   87,   37,   93,   37,
-       39,   39,   42,   41,   41,   39,   41,   42,   96,   39,
-       42,   43,   43,  105,   43,   39,   44,   42,   39,  101,
-       44,   42,   42,   43,   94,   39,   84,   84,   96,   43,
-       44,   94,  105,  101,   44,   44,   62,  192,   62,   62,
-       70,   62,   70,   70,   72,   70,   72,   72,   79,   72,
-       79,   79,   70,   79,   86,   95,   86,   86,   89,   86,
-       89,   89,  192,   89,  100,   86,  102,   95,   98,   89,
-       89,   98,  102,  100,  103,  104,  106,  107,  102,  113,
-      102,  109,  106,  113,   98,  108,  111,  140,  114,  112,
-
-      177,  107,  103,  103,  110,  106,  116,  104,  115,  108,
-      119,  109,  140,  115,  111,  110,  110,  112,  114,  117,
-      116,  118,  117,  110,  122,  117,  120,  118,  123,  119,
-      121,  120,  124,  121,  125,  130,  124,  121,  117,  117,
-      127,  125,  123,  122,  126,  128,  118,  127,  122,  129,
-      132,  120,  131,  121,  128,  130,  131,  126,  134,  133,
-      135,  136,  129,  133,  138,  135,  137,  137,  132,  135,
-      139,  141,  142,  144,  139,  256,  134,  256,  146,  150,
-      151,  136,  143,  139,  138,  143,  144,  145,  149,  139,
-      146,  142,  148,  145,  147,  147,  143,  141,  150,  148,
-
-      143,  151,  152,  153,  149,  153,  155,  154,  156,  157,
-      148,  155,  147,  226,  153,  147,  158,  159,  152,  154,
-      156,  158,  161,  161,  179,  163,  153,  157,  163,  179,
-      165,  159,  165,  165,  226,  165,  168,  168,  170,  181,
-      170,  170,  171,  170,  171,  171,  173,  171,  175,  173,
-      175,  175,  180,  175,  171,  178,  178,  181,  180,  182,
-      183,  184,  185,  186,  187,  189,  188,  180,  183,  190,
-      185,  188,  184,  212,  182,  183,  193,  191,  190,  187,
-      176,  193,  186,  191,  191,  189,  194,  194,  195,  197,
-      196,  212,  196,  197,  195,  196,  198,  198,  197,  199,
-
-      200,  201,  202,  197,  203,  204,  201,  202,  205,  197,
-      197,  199,  196,  206,  205,  207,  203,  206,  208,  200,
-      207,  209,  213,  210,  211,  204,  214,  213,  216,  217,
-      555,  214,  218,  216,  208,  209,  211,  205,  210,  211,
-      215,  215,  220,  220,  215,  219,  215,  221,  218,  217,
-      222,  219,  223,  221,  555,  224,  222,  227,  215,  221,
-      215,  224,  225,  227,  228,  229,  230,  231,  225,  228,
-      230,  229,  223,  231,  232,  234,  233,  225,  235,  236,
-      237,  232,  233,  238,  235,  239,  237,  240,  234,  241,
-      245,  243,  242,  239,  241,  244,  238,  246,  248,  236,
-
-      240,  242,  246,  246,  247,  238,  243,  250,  249,  247,
-      245,  244,  249,  251,  252,  253,  248,  254,  255,  251,
-      257,  253,  259,  255,  258,  261,  263,  264,  259,  250,
-      260,  258,  252,  252,  262,  270,  260,  254,  263,  257,
-      262,  264,  265,  265,  261,  266,  266,  267,  268,  269,
-      271,  269,  272,  267,  268,  271,  273,  274,  270,  275,
-      277,  276,  288,  278,  272,  274,  276,  279,  269,  278,
-      283,  267,  280,  279,  282,  273,  281,  280,  284,  275,
-      282,  281,  285,  277,  286,  283,  287,  288,  290,  289,
-      293,  290,  284,  293,  287,  289,  294,  291,  286,  291,
-
-      285,  292,  292,  295,  295,  296,  296,  297,  299,  298,
-      301,  299,  300,  302,  294,  303,  300,  304,  174,  301,
-      305,  303,  302,  297,  298,  306,  305,  306,  307,  308,
-      314,  304,  310,  308,  307,  309,  309,  310,  311,  312,
-      313,  315,  316,  319,  311,  312,  317,  317,  314,  318,
-      308,  321,  318,  320,  322,  316,  324,  320,  323,  323,
-      313,  319,  315,  325,  312,  326,  325,  327,  328,  329,
-      321,  328,  322,  327,  324,  333,  331,  326,  336,  332,
-      333,  329,  337,  325,  330,  331,  335,  334,  169,  335,
-      334,  336,  334,  330,  337,  340,  330,  332,  340,  341,
-
-      341,  330,  330,  330,  330,  334,  339,  338,  334,  338,
-      338,  339,  339,  342,  343,  345,  346,  344,  347,  347,
-      354,  348,  349,  349,  345,  346,  348,  350,  350,  343,
-      342,  351,  352,  342,  344,  344,  353,  352,  355,  354,
-      356,  357,  358,  358,  360,  358,  351,  357,  353,  369,
-      369,  361,  363,  362,  358,  356,  361,  363,  355,  362,
-      364,  366,  375,  365,  360,  364,  365,  367,  365,  368,
-      367,  364,  388,  370,  410,  366,  371,  371,  368,  370,
-      372,  377,  375,  367,  376,  372,  367,  376,  367,  373,
-      373,  378,  373,  388,  379,  382,  377,  381,  373,  410,
-
-      381,  167,  373,  384,  385,  376,  378,  373,  379,  382,
-      373,  374,  374,  385,  374,  386,  381,  391,  384,  394,
-      386,  386,  389,  387,  390,  392,  391,  374,  395,  387,
-      374,  166,  374,  399,  374,  383,  387,  383,  383,  390,
-      393,  389,  396,  400,  392,  394,  393,  383,  395,  383,
-      383,  383,  397,  399,  383,  398,  396,  401,  397,  402,
-      398,  403,  397,  400,  402,  404,  405,  405,  406,  407,
-      408,  404,  401,  409,  411,  412,  403,  414,  398,  409,
-      412,  407,  413,  413,  408,  413,  415,  416,  406,  423,
-      411,  417,  418,  419,  418,  419,  419,  414,  422,  422,
-
-      420,  424,  415,  416,  420,  417,  421,  425,  423,  426,
-      421,  428,  427,  419,  433,  430,  424,  432,  433,  431,
-      428,  430,  432,  425,  429,  421,  427,  426,  431,  429,
-      434,  428,  436,  428,  435,  441,  164,  429,  429,  434,
-      435,  429,  429,  437,  438,  443,  440,  439,  438,  437,
-      439,  440,  446,  436,  450,  441,  442,  442,  443,  444,
-      444,  445,  447,  447,  448,  446,  445,  449,  451,  450,
-      448,  449,  452,  453,  454,  454,  455,  452,  453,  456,
-      457,  458,  459,  454,  462,  459,  460,  464,  455,  451,
-      461,  460,  464,  458,  461,  465,  462,  467,  457,  456,
-
-      463,  463,  466,  466,  469,  469,  471,  472,  473,  474,
-      477,  476,  482,  475,  479,  472,  465,  473,  475,  467,
-      480,  481,  477,  483,  484,  487,  482,  471,  162,  483,
-      474,  476,  479,  484,  479,  486,  485,  488,  480,  487,
-      486,  481,  485,  489,  490,  488,  489,  491,  488,  492,
-      493,  494,  496,  495,  494,  492,  497,  498,  490,  495,
-      499,  497,  491,  500,  501,  502,  496,  500,  503,  501,
-      493,  504,  505,  503,  509,  506,  510,  495,  512,  498,
-      502,  499,  512,  513,  511,  514,  518,  504,  506,  515,
-      514,  505,  507,  507,  509,  528,  528,  510,  507,  511,
-
-      507,  518,  513,  516,  517,  515,  507,  516,  507,  517,
-      519,  507,  507,  517,  520,  519,  521,  522,  507,  523,
-      524,  525,  526,  522,  525,  521,  527,  529,  522,  531,
-      520,  530,  530,  520,  523,  532,  524,  534,  533,  535,
-      537,  538,  539,  536,  531,  526,  527,  532,  536,  537,
-      542,  543,  529,  533,  548,  543,  534,  539,  540,  542,
-      538,  535,  544,  545,  540,  546,  544,  547,  550,  545,
-      549,  551,  552,  548,  553,  558,  552,  546,  554,  160,
-      554,  558,  547,  550,  549,  556,  559,  553,  560,  551,
-      557,  557,  561,  556,  560,  563,  562,  564,  559,  562,
-
-      565,  567,  568,  566,  561,  565,  566,   85,  569,  563,
-      567,  570,  564,  569,  569,  571,  571,  567,  568,  573,
-      567,  572,  572,  578,  570,  573,  574,  574,  575,  575,
-      576,  579,  577,  582,  586,  581,  576,  577,  577,  580,
-      581,  583,  580,  579,  578,  584,  585,  587,  584,  583,
-      588,  585,  582,  589,  588,  591,  590,  586,  592,  589,
-      590,  593,  595,  592,  594,  594,  587,  596,  598,  597,
-      599,  601,  600,  591,  597,  593,  601,  595,  600,  602,
-      604,  605,  605,  603,  598,  606,  603,  608,  596,  607,
-      599,  603,  608,  602,  603,  603,  609,  610,  604,  611,
-
-      613,  609,  620,  606,  614,  607,  613,  615,  616,  621,
-      615,  610,  616,  614,  611,  617,  618,  619,  620,  618,
-      617,  622,  619,  623,  624,  625,  627,  621,  622,  624,
-      626,  626,  628,  629,  616,  627,  623,  630,  631,   80,
-      632,  635,  633,  634,  635,  625,  642,  631,  633,  634,
-      639,  628,  632,  630,  629,  636,  636,  637,  636,  638,
-      637,  640,  641,  643,  638,  642,  644,  641,  639,  643,
-      645,  644,  647,  648,  646,  640,  645,  646,  648,  649,
-      650,  651,  652,  653,  649,  649,  654,  652,  657,  653,
-      655,  656,  660,  650,  651,  660,  656,  647,  666,  655,
-
-      659,  652,  652,  658,  658,  654,  661,  659,  657,  662,
-      660,  663,  661,  664,  665,  665,  663,  668,  664,  664,
-      667,  662,  667,  666,  670,  669,  663,  669,  671,  672,
-      673,  674,  675,  676,  677,  678,  668,  676,  675,  679,
-      680,  681,  670,  677,  682,  685,  671,  672,  683,  673,
-      678,  674,  686,  684,  679,  687,  682,  688,  680,  684,
-      681,  689,  690,  683,  691,  685,  686,  687,  691,  692,
-      693,  694,  695,  696,  697,   75,  688,  699,  699,  697,
-      698,  690,  689,  701,  700,  702,  693,  692,  700,  694,
-      695,  695,  696,  704,  698,  703,  705,  701,  706,  707,
-
-      708,  705,  709,  710,  702,  711,  703,  704,  710,  709,
-      712,  713,  711,  708,  706,  712,  713,  714,  707,  715,
-      716,  718,  717,  721,  728,  719,  715,  720,  721,  716,
-      718,  722,  724,  720,  722,  714,  717,  719,  723,  725,
-      726,  736,  723,  727,  735,  728,  724,  736,  725,  729,
-      729,  730,  730,  731,  731,  726,  732,  727,  733,  737,
-      730,  732,  738,  735,  739,  740,  738,  733,  741,  742,
-      743,  745,  746,  744,  747,  742,  739,  750,  743,  737,
-      744,  757,  753,   74,  756,  759,  741,  757,  766,  745,
-      740,  759,  750,  756,  747,  760,  761,  746,  748,  753,
-
-      748,  762,  767,  748,  760,  762,  766,  748,  763,  763,
-      748,  765,  761,  764,  764,  768,  767,  748,  748,  769,
-      748,  771,  765,  772,  773,  769,  771,  774,  775,  776,
-      779,  774,  778,  776,  777,  768,  770,  770,  770,  777,
-      770,  780,  773,  770,  772,  779,   68,  781,  770,  776,
-      781,  778,  775,  782,  770,  770,  783,  785,  782,  782,
-      784,  784,  786,  783,  787,  787,  780,  786,  788,  793,
-      790,  789,  785,  788,  789,  790,  791,  791,  792,  794,
-      792,  793,  795,  796,  798,  797,  795,  799,  799,  804,
-      800,  803,  798,  801,  802,  802,  805,  807,  794,   63,
-
-      806,  804,  807,  796,  797,  800,  806,  801,  809,  803,
-      808,  808,  811,  809,  809,  812,  813,  811,  805,  814,
-      816,  812,  815,  818,  819,  814,  816,  815,  817,  818,
-      822,  817,  819,  820,  820,  813,  821,  821,  822,  823,
-      824,  825,  826,  827,  828,  824,  829,  829,  825,  830,
-      832,  832,  834,  831,  838,  836,  833,  823,  830,  827,
-      826,  831,  833,  828,  836,  837,  840,  839,  843,  844,
-      841,  834,  839,  841,  837,  840,  842,  845,  838,  846,
-      849,  842,  843,  847,  848,  848,  845,  850,  847,  847,
-      851,  852,  846,  853,  844,  849,  856,  854,  856,  851,
-
-      854,  857,  857,  858,  859,  860,  850,  861,  854,  859,
-      862,  853,  863,  864,  865,  852,  866,  867,  868,  869,
-      871,  867,  870,  865,  858,  872,  860,  861,  870,  871,
-      862,  873,  874,  864,  863,  875,  868,  872,  869,  866,
-      876,  875,  877,  880,  878,  881,  874,  883,  876,  878,
-      873,  879,  879,  884,  882,  885,  877,  886,  887,  891,
-      888,  884,  880,  882,  889,  881,  890,  883,  892,  893,
-      889,  894,  890,  891,  892,  885,  895,  887,  896,  886,
-      888,  897,  895,  893,  896,  897,  898,  899,  900,  901,
-      903,  894,  908,  900,  902,  902,  903,  904,  905,  899,
-
-      904,  906,  907,  909,  909,  898,  910,  899,  907,  912,
-      901,  914,  908,  911,  906,  913,  905,  917,  911,  915,
-      913,  913,  918,  915,  910,  912,  914,  912,  916,  916,
-      919,  920,  922,  923,  926,  919,  925,  927,  931,  917,
-      929,  929,  918,   58,  930,  932,  932,  923,  930,  925,
-      920,  933,  935,  931,  926,  936,  922,  934,  927,  928,
-      937,  934,  928,  938,  928,  937,  939,  935,  928,  936,
-      928,  939,  939,  940,  941,  928,  933,  938,  943,  942,
-      928,  944,  940,  942,  946,  945,  944,  947,  941,  946,
-      948,  949,  951,  943,  950,  942,  944,  945,  951,  952,
-
-      953,  947,  954,  950,  952,  949,  953,  956,  954,  955,
-      955,  948,  956,  957,  958,  959,  962,  960,  963,  957,
-      965,  966,  966,  963,  967,  964,  969,  970,  962,  967,
-      971,  972,  965,  968,  959,  960,  958,  961,  961,  964,
-      969,  968,  973,  961,  976,  961,  970,  972,  973,  971,
-      974,  961,  975,  977,  978,  974,  961,  961,  979,  979,
-      981,  980,  976,  961,  975,  980,  985,  983,  984,  977,
-      986,  984,  978,  983,  987,  986,  988,  990,  989,  992,
-      981,  993,  988,  989,  994,  985,  995,  987,  992,  996,
-      993,  997,  995,  999,  998, 1000,  990, 1001,  996,  998,
-
-      994, 1005, 1002, 1003, 1006, 1007, 1004, 1005, 1009, 1000,
-      997, 1007, 1003,  999, 1002, 1004, 1011, 1001, 1012, 1015,
-     1013, 1006, 1014, 1018, 1009, 1013, 1016, 1017, 1018, 1019,
-     1011, 1022, 1027, 1015, 1019, 1028, 1022, 1023, 1012, 1024,
-     1024, 1014, 1017, 1025, 1016, 1026, 1023, 1027, 1028, 1025,
-     1030, 1031, 1034, 1035, 1026, 1034, 1031, 1031, 1033, 1033,
-     1036, 1037, 1033, 1038, 1040, 1039, 1030, 1035, 1041, 1042,
-     1043, 1044, 1048, 1049, 1041, 1048, 1043, 1037, 1039, 1040,
-     1036, 1038, 1045, 1046, 1052, 1050, 1044, 1045, 1051, 1042,
-     1050, 1054, 1053, 1051, 1049, 1056, 1054, 1046, 1055, 1058,
-
-     1052, 1053, 1059, 1055, 1060, 1058, 1061, 1056, 1062, 1062,
-     1060, 1063, 1061, 1064, 1065, 1066, 1066, 1065, 1059, 1067,
-     1063, 1068, 1069, 1070, 1072, 1071, 1070, 1073,   57, 1074,
-     1072, 1064, 1082, 1073, 1074, 1081, 1075, 1067, 1071, 1076,
-     1068, 1075, 1069, 1077, 1078, 1076, 1080, 1088, 1077, 1083,
-     1078, 1080, 1082, 1081, 1084, 1083, 1085, 1085, 1086, 1084,
-     1087, 1089, 1092, 1090, 1094, 1088, 1090, 1086, 1091, 1087,
-     1093, 1091, 1095, 1092, 1096, 1093, 1099, 1097, 1102, 1098,
-     1089, 1100, 1094, 1097, 1095, 1098, 1100, 1101, 1101, 1103,
-     1104, 1099, 1105, 1096, 1106, 1107, 1105, 1102, 1108, 1109,
-
-     1111, 1115, 1104, 1103, 1107, 1112, 1112, 1118, 1113, 1114,
-       52, 1117, 1106, 1113, 1114, 1119, 1123, 1108, 1120, 1111,
-     1121, 1115, 1118, 1120, 1109, 1117, 1124, 1119, 1125, 1121,
-     1122, 1122, 1124, 1126, 1125, 1127, 1123, 1128, 1129, 1128,
-     1127, 1130, 1131, 1129, 1133, 1132, 1134, 1135, 1136, 1126,
-     1132, 1137, 1139, 1139, 1135, 1130, 1131, 1140, 1141, 1133,
-     1142, 1143, 1144, 1136, 1145, 1134,   47, 1143, 1147, 1145,
-     1137, 1140, 1147, 1148, 1148, 1142, 1141, 1152, 1145, 1149,
-     1145, 1151, 1144, 1145, 1149, 1150, 1150, 1153, 1151, 1154,
-     1153, 1152, 1155, 1156, 1157, 1158, 1160, 1159, 1161, 1157,
-
-     1162, 1160, 1156, 1163, 1165, 1165, 1168,   18, 1154, 1159,
-     1155, 1162, 1161, 1166, 1158, 1167, 1169, 1172, 1166, 1170,
-     1167, 1169, 1163, 1170, 1171, 1173, 1168, 1174, 1176, 1175,
-     1177, 1179, 1172, 1171, 1180, 1178, 1181, 1177, 1182, 1184,
-     1173, 1175, 1183, 1176, 1182, 1185, 1174, 1178, 1187, 1186,
-     1179, 1188, 1189, 1190, 1181, 1180, 1191, 1183, 1186, 1184,
-     1192, 1195, 1193, 1187, 1189, 1185, 1197, 1195, 1196, 1198,
-     1188, 1199, 1190, 1200, 1201, 1192, 1202, 1198, 1204, 1201,
-     1197, 1191, 1193, 1196, 1205, 1239, 1206, 1203, 1202, 1200,
-     1209, 1199, 1203, 1203, 1207, 1207, 1239, 1204, 1205, 1206,
-
-     1208, 1208, 1210, 1209, 1211, 1208, 1212, 1212, 1208, 1208,
-     1211, 1210, 1213, 1208, 1215, 1214, 1216, 1213, 1219, 1208,
-     1215, 1216, 1217, 1208, 1214, 1218, 1218, 1217, 1220, 1220,
-     1221, 1222, 1223, 1221, 1224, 1221, 1225, 1226, 1227, 1219,
-     1224, 1228, 1229, 1227, 1232, 1225, 1230, 1231, 1236, 1232,
-     1223, 1222, 1230, 1231, 1233, 1228, 1234, 1226, 1233, 1235,
-     1229, 1243, 1236, 1242, 1235, 1234, 1237, 1237, 1238, 1238,
-     1234, 1238, 1234, 1241, 1234, 1244, 1234, 1241, 1242, 1243,
-     1245, 1246, 1247, 1248, 1244, 1245, 1245, 1249, 1248, 1250,
-     1246, 1251, 1252, 1253, 1254, 1255, 1255, 1256, 1250, 1257,
-
-     1254, 1249, 1259, 1258, 1247, 1256, 1260, 1253, 1258, 1262,
-     1251, 1252, 1261, 1257, 1263, 1260, 1259, 1264, 1266, 1261,
-     1265, 1265, 1264, 1267, 1267, 1271, 1268, 1262, 1268, 1270,
-     1271, 1272, 1270, 1266, 1273, 1274, 1274, 1275, 1279, 1263,
-     1276, 1276, 1278, 1273, 1277, 1277, 1280, 1278, 1281, 1281,
-     1272, 1282, 1283, 1284, 1285, 1286, 1284, 1275, 1287, 1279,
-     1289, 1286, 1289, 1287, 1288, 1290, 1293, 1280, 1297, 1283,
-     1295, 1282, 1292, 1288, 1285, 1292, 1297, 1294, 1301, 1301,
-     1296, 1293, 1294, 1290, 1295, 1296, 1298, 1299, 1300, 1302,
-     1299, 1298, 1303, 1300, 1302, 1304, 1305, 1310, 1306, 1308,
-
-     1309, 1304, 1310, 1305, 1313, 1308, 1309, 1311, 1312, 1314,
-     1303, 1306, 1316, 1311, 1315, 1315, 1318, 1312, 1319, 1321,
-     1314, 1320, 1322, 1313, 1323, 1324, 1328, 1325, 1319, 1327,
-     1323, 1324, 1316, 1325, 1318, 1327, 1320, 1329, 1330, 1321,
-     1328, 1331, 1332, 1333, 1335, 1322, 1328, 1334, 1334, 1336,
-     1337, 1339, 1339, 1331, 1338, 1340, 1332, 1329, 1330, 1338,
-     1341, 1333, 1343,   17, 1335, 1341, 1344, 1345, 1337, 1347,
-     1346, 1344, 1344, 1348, 1336, 1349, 1350, 1347, 1340, 1346,
-     1353, 1343, 1353, 1354, 1351, 1345, 1352, 1348, 1361, 1351,
-     1349, 1350, 1351, 1356, 1350, 1352, 1357, 1354, 1358, 1356,
-
-     1357, 1359, 1360, 1363, 1362, 1364, 1359, 1359, 1363, 1358,
-     1364, 1365, 1366, 1367, 1361, 1368, 1370, 1376, 1367, 1371,
-     1372, 1360, 1362, 1373, 1373, 1375, 1380, 1374, 1377, 1365,
-     1370, 1374, 1366, 1378, 1377, 1368, 1376, 1371, 1372, 1379,
-     1380, 1381, 1382, 1375, 1383, 1378, 1384, 1385, 1386, 1387,
-     1388, 1384, 1392, 1386, 1385, 1390, 1381, 1382, 1379, 1388,
-     1389, 1389, 1391, 1383, 1393, 1393, 1396, 1387, 1394, 1395,
-     1390, 1391, 1392, 1398, 1394, 1395, 1397, 1397, 1399, 1398,
-     1396, 1400, 1401, 1402, 1403, 1404, 1411, 1401, 1417, 1402,
-     1403, 1404, 1405, 1405, 1399, 1406, 1406, 1408, 1408, 1409,
-
-     1410, 1412, 1400, 1409, 1411, 1413, 1414, 1415, 1417, 1410,
-     1416, 1416, 1418, 1412, 1415, 1420, 1421, 1419, 1422, 1413,
-     1418, 1414, 1419, 1422, 1422, 1423, 1424, 1425, 1425, 1420,
-     1423, 1423, 1426, 1427, 1428, 1421, 1429, 1430, 1431, 1432,
-     1434, 1429, 1433, 1428, 1435, 1434, 1424, 1436, 1433, 1437,
-     1438, 1426, 1427, 1439, 1440, 1437, 1430, 1432, 1431, 1439,
-     1440, 1441, 1442, 1443, 1435, 1444, 1446, 1449, 1447, 1438,
-     1449, 1445, 1450, 1436, 1448, 1448, 1451, 1452, 1453, 1453,
-     1441, 1442, 1443, 1447, 1444, 1445, 1456, 1446, 1457, 1452,
-     1456, 1450, 1454, 1454, 1455, 1451, 1458, 1459, 1460, 1455,
-
-     1460, 1457, 1462, 1463, 1460, 1458, 1464, 1465, 1463, 1466,
-     1459, 1467, 1467, 1468, 1470, 1471, 1469, 1460, 1468, 1472,
-     1462, 1464, 1469, 1475, 1472, 1466, 1473, 1465, 1471, 1470,
-     1473, 1474, 1476, 1477, 1478, 1474, 1480, 1480, 1479, 1482,
-     1484, 1485, 1477, 1475, 1479, 1487, 1485, 1486, 1486, 1488,
-     1476, 1487, 1490, 1490, 1478, 1492, 1494, 1482, 1492, 1493,
-     1493, 1484, 1495, 1497, 1498, 1500, 1497, 1499, 1501, 1488,
-     1502, 1502, 1494, 1504, 1500, 1503, 1505, 1506, 1495, 1507,
-     1508, 1508, 1506, 1509, 1510, 1498, 1511, 1499, 1501, 1512,
-     1503, 1513, 1509, 1507, 1504, 1505, 1514, 1514, 1515, 1516,
-
-     1517, 1511, 1510, 1518, 1520, 1517, 1519, 1519, 1520, 1521,
-     1523, 1513, 1515, 1524, 1512, 1522, 1522, 1516, 1518, 1525,
-     1526, 1527, 1530, 1525, 1524, 1531, 1527, 1529, 1529, 1521,
-     1531, 1532, 1523, 1533, 1534, 1530, 1535, 1537, 1536, 1526,
-     1538, 1538, 1607, 1540, 1539, 1541, 1607, 1532, 1534, 1539,
-     1543, 1533, 1536, 1542, 1542, 1535, 1535, 1545, 1546, 1543,
-     1546, 1544, 1537, 1540, 1547, 1541, 1544, 1548, 1549, 1547,
-     1550, 1552, 1554, 1548, 1553, 1553, 1550, 1545, 1555, 1558,
-     1561, 1557, 1559, 1559, 1555, 1552, 1557, 1562, 1549, 1560,
-     1560, 1554, 1563, 1564, 1561, 1566, 1564, 1565, 1565, 1567,
-
-     1568, 1576, 1570, 1558,    0, 1562, 1569, 1563, 1570, 1569,
-     1571, 1567, 1569, 1566, 1572, 1571, 1574, 1572, 1575, 1577,
-     1568, 1586, 1577, 1575, 1569, 1574, 1576, 1578, 1578, 1579,
-     1580, 1588, 1581, 1572, 1586, 1579, 1580, 1581, 1582, 1582,
-     1583, 1583, 1584, 1587, 1585, 1589, 1591, 1592, 1584, 1585,
-     1588, 1590, 1591, 1592, 1590, 1593, 1594, 1595, 1596, 1598,
-     1593, 1587, 1594, 1596, 1598, 1589, 1597, 1597, 1599, 1600,
-     1601, 1602, 1606, 1603, 1604, 1605, 1608, 1609, 1608, 1611,
-     1595, 1619, 1612, 1615, 1616, 1602, 1599, 1603, 1604, 1600,
-     1601, 1611, 1613, 1605, 1612, 1614, 1609, 1606, 1617, 1618,
-
-     1616, 1614, 1619, 1615, 1622, 1613, 1621, 1621, 1624, 1623,
-     1625, 1625, 1626, 1618, 1623, 1627, 1628, 1629, 1617, 1630,
-     1624, 1631, 1633, 1632, 1622, 1634, 1638, 1626, 1630, 1627,
-     1632, 1633, 1636, 1642, 1633, 1629, 1631, 1640, 1640, 1639,
-     1628, 1634, 1639, 1641, 1641, 1642, 1643, 1636, 1645, 1645,
-     1644, 1638, 1636, 1644, 1646, 1647, 1648, 1649, 1650, 1651,
-     1649, 1648, 1653, 1650, 1643, 1652, 1654, 1646, 1655, 1657,
-     1656, 1653, 1658, 1658, 1647, 1657, 1659, 1655, 1651, 1656,
-     1655, 1652, 1660, 1661, 1662, 1654, 1663, 1664, 1666, 1665,
-     1669, 1670, 1664, 1664, 1665, 1660, 1659, 1672, 1662, 1673,
-
-     1666, 1661, 1663, 1671, 1671, 1674, 1675, 1675, 1673, 1670,
-     1674, 1676, 1677, 1672, 1678, 1669, 1679, 1677, 1680, 1681,
-     1676, 1675, 1685, 1676, 1681, 1681, 1683, 1684, 1686, 1687,
-     1688, 1696, 1678, 1686,    0, 1687, 1680, 1679, 1689, 1689,
-     1683, 1690, 1684, 1692, 1685, 1691, 1693, 1690, 1688, 1694,
-     1691, 1696, 1693, 1697, 1698, 1694, 1699, 1692, 1701, 1700,
-     1698, 1705, 1700, 1703, 1701, 1706, 1707, 1697, 1700, 1699,
-     1708, 1703, 1709, 1710, 1707, 1708, 1711, 1712, 1713, 1714,
-     1705, 1709, 1715, 1715, 1706, 1711, 1710, 1718, 1716, 1717,
-     1712, 1720, 1713, 1714, 1716, 1717, 1719, 1719, 1721, 1722,
-
-     1718, 1723, 1723, 1725, 1715, 1726, 1724, 1727, 1728, 1725,
-     1731, 1720, 1730, 1730, 1737, 1733, 1721, 1732, 1722, 1724,
-     1733, 1732, 1736, 1727, 1734, 1739, 1728, 1726, 1735, 1734,
-     1731, 1736, 1740, 1735, 1739, 1740, 1741, 1737, 1742, 1743,
-     1743, 1744, 1745, 1746, 1747, 1747, 1750, 1748, 1741, 1749,
-     1753, 1751, 1754, 1742, 1745, 1756, 1749, 1757, 1750, 1755,
-     1744, 1748, 1746, 1751, 1758, 1755,    0, 1756, 1760, 1753,
-     1758, 1760, 1754, 1759, 1759, 1757, 1761, 1761, 1763, 1764,
-     1765, 1766, 1766, 1763, 1767, 1768, 1765, 1768, 1764, 1769,
-     1770, 1771, 1769, 1772, 1773, 1774, 1767, 1775, 1776, 1778,
-
-     1774, 1779, 1775, 1777, 1781, 1784, 1779, 1776, 1780,    0,
-     1770, 1772, 1773, 1771, 1778, 1777, 1782, 1780, 1783, 1787,
-     1784, 1782, 1789, 1783, 1781, 1785, 1785, 1786, 1782, 1790,
-     1780, 1791, 1792, 1786, 1793, 1794, 1793, 1795, 1795, 1798,
-     1787, 1789, 1796, 1796, 1797, 1797, 1801, 1791, 1790, 1794,
-     1802, 1794, 1792, 1799, 1799, 1800, 1800, 1803, 1803, 1798,
-     1804, 1809, 1805, 1806, 1804, 1811, 1806, 1801, 1805, 1808,
-     1810, 1802, 1813, 1813, 1812, 1808, 1810, 1812, 1814, 1809,
-     1815, 1816, 1816, 1818, 1817, 1815, 1819, 1820, 1820, 1821,
-     1811, 1819, 1825, 1823, 1821, 1822, 1824, 1826, 1814, 1817,
-
-     1828, 1822, 1827, 1832, 1818, 1823, 1823, 1823, 1827, 1830,
-     1825, 1831, 1823, 1834, 1830, 1830, 1824, 1826, 1832, 1833,
-     1828, 1833, 1835, 1836, 1834, 1831, 1837, 1838, 1839, 1836,
-     1840, 1840, 1841, 1842, 1842, 1837, 1843, 1835, 1844, 1845,
-     1845, 1846, 1846, 1847, 1850, 1850, 1851, 1838, 1852, 1839,
-     1854, 1855, 1857, 1858, 1858, 1856, 1843, 1852, 1841, 1854,
-     1844, 1856, 1859, 1847, 1860, 1862, 1861, 1863, 1857, 1864,
-     1864, 1851, 1855, 1861, 1862, 1865, 1866, 1868, 1869, 1860,
-     1870, 1871, 1868, 1859, 1869, 1872, 1875, 1873, 1871, 1873,
-     1876, 1872, 1866, 1863, 1877, 1877, 1876, 1878, 1879, 1880,
-
-     1870, 1865, 1878, 1881, 1882, 1875, 1883, 1879, 1884, 1883,
-     1885, 1886, 1886, 1889, 1887, 1888, 1882, 1890, 1893, 1880,
-     1887, 1888, 1881, 1891, 1894, 1895, 1884, 1891, 1896, 1896,
-     1895, 1897, 1890, 1889, 1898, 1900, 1885, 1901, 1893, 1902,
-     1902, 1901, 1903, 1891, 1904, 1907, 1894, 1909, 1903, 1898,
-     1897, 1905, 1905, 1904, 1900, 1906, 1907, 1908, 1908, 1906,
-     1910, 1907, 1911, 1913, 1912, 1914, 1915, 1917, 1909, 1912,
-     1916, 1918, 1915, 1919, 1910, 1924, 1918, 1920, 1920, 1921,
-     1921, 1911, 1917, 1913, 1924, 1914, 1919, 1922, 1916, 1925,
-     1926, 1922, 1927, 1927, 1929, 1929, 1930, 1931, 1933, 1934,
-
-     1925, 1930, 1930, 1931, 1933, 1925, 1935, 1936, 1937, 1939,
-     1926, 1935, 1940, 1942, 1937, 1941, 1940, 1943, 1944, 1936,
-     1945, 1939, 1946, 1943, 1947, 1934, 1945, 1941, 1948, 1952,
-     1949, 1951, 1953, 1948, 1956, 1956, 1955, 1953, 1942, 1955,
-     1944, 1946, 1949, 1951, 1947, 1957, 1957, 1959, 1952, 1958,
-     1958, 1960, 1961, 1964, 1962, 1963, 1969, 1960, 1961, 1962,
-     1966, 1963, 1964, 1968, 1972, 1966, 1968, 1959, 1969, 1970,
-     1970, 1973, 1974, 1975, 1975, 1976, 1972, 1974, 1981, 1979,
-     1977, 1978, 1979, 1973, 1976, 1977, 1978, 1980, 1980, 1983,
-     1982, 1984, 1985, 1988, 1990, 1986, 1985, 1987, 1981, 1982,
-
-     1986, 1991, 1994, 1987, 1989, 1993, 1993, 1983, 1996, 1995,
-     1984, 1988, 1990, 1989, 1998, 1991, 2000, 1993, 1995, 1999,
-     1994, 1997, 1997, 1998, 2001, 2002, 2005, 2005, 1996, 2001,
-     2007, 1999, 2008, 2007, 2009, 2012, 2011, 2000, 2002, 2013,
-     2014, 2015, 2015, 2023, 2016, 2013, 2016, 2018, 2008, 2012,
-     2009, 2011, 2017, 2017, 2027, 2018, 2024, 2014, 2020, 2020,
-     2021, 2021, 2024, 2025, 2026, 2028, 2023, 2029, 2029, 2025,
-     2030, 2026, 2031, 2034, 2032, 2033, 2027, 2035, 2036, 2030,
-     2037, 2040, 2041, 2251, 2038, 2028, 2032, 2033, 2034, 2035,
-     2038, 2043, 2043, 2031, 2042, 2037, 2044, 2045, 2048, 2046,
-
-     2251, 2040, 2046, 2038, 2036, 2041, 2042, 2047, 2050, 2051,
-     2052, 2051, 2047, 2050, 2044, 2053, 2054, 2045, 2048, 2058,
-     2053, 2056, 2059, 2054, 2060, 2061, 2062, 2061, 2052, 2063,
-     2056, 2059, 2065, 2066, 2065, 2063, 2060, 2058, 2067, 2067,
-     2068, 2069, 2070, 2071, 2070, 2062, 2069, 2066, 2071, 2072,
-     2073, 2074, 2075, 2078, 2072, 2076, 2077, 2079, 2075, 2080,
-     2076, 2082, 2079, 2079, 2083, 2078, 2068, 2080, 2073, 2077,
-     2086, 2074, 2084, 2084, 2085, 2085, 2087, 2088, 2083, 2089,
-     2082, 2091, 2092, 2088, 2089, 2086, 2090,    0, 2090, 2094,
-     2092, 2093, 2093, 2095, 2095, 2097, 2087, 2099, 2092, 2091,
-
-     2098, 2094, 2096, 2096, 2097, 2098, 2102, 2101, 2102, 2103,
-     2105, 2106, 2104, 2107, 2109, 2099, 2101, 2104, 2104, 2101,
-     2106, 2113, 2105, 2110, 2111, 2107, 2109, 2114, 2110, 2111,
-     2103, 2115, 2116, 2116, 2113, 2117, 2118, 2120, 2121, 2119,
-     2115, 2122, 2130, 2123, 2127, 2125, 2126, 2114, 2123, 2136,
-     2138, 2130, 2121, 2117, 2118, 2119, 2122, 2125, 2126, 2137,
-     2128, 2129, 2120, 2133, 2127, 2128, 2129, 2135, 2138, 2133,
-     2139, 2140, 2136, 2135, 2137, 2141, 2141, 2142, 2143, 2143,
-     2140, 2144, 2133, 2145, 2146, 2147, 2142, 2145, 2148, 2146,
-     2149, 2150, 2156, 2152, 2164, 2139, 2149, 2151, 2147, 2152,
-
-     2144, 2155, 2151, 2151, 2153, 2154, 2164, 2148, 2154, 2155,
-     2153, 2161, 2156, 2150, 2159, 2159, 2160, 2160, 2162, 2162,
-     2161, 2163, 2163, 2165, 2166, 2168, 2168, 2167, 2169, 2169,
-     2166, 2160, 2167, 2170, 2171, 2173, 2174, 2176, 2170, 2173,
-     2171, 2165, 2160, 2175, 2178, 2179, 2181, 2175, 2180, 2182,
-     2179, 2184, 2183, 2185, 2182, 2186, 2174, 2176, 2187, 2190,
-     2186, 2181, 2188, 2188, 2189, 2192, 2193, 2184, 2189, 2178,
-     2183, 2180, 2191, 2185, 2190, 2194, 2195, 2191, 2196, 2197,
-     2187, 2198, 2201, 2196, 2193, 2199, 2199, 2194, 2202, 2203,
-     2201, 2192, 2197, 2204, 2205, 2195, 2206, 2208, 2207, 2198,
-
-     2209, 2213, 2211, 2216, 2215, 2216, 2214, 2202, 2203, 2208,
-     2215, 2217, 2217, 2273, 2213, 2206, 2204, 2211, 2205, 2207,
-     2214, 2209, 2218, 2219, 2220, 2221, 2219, 2218, 2222, 2223,
-     2223, 2224, 2224, 2225, 2227, 2225, 2273, 2220, 2228, 2221,
-     2236, 2222, 2226, 2226, 2229, 2229, 2230, 2231, 2231, 2227,
-     2237, 2228, 2232, 2232, 2233, 2230, 2235, 2238, 2230, 2233,
-     2236, 2235, 2239, 2239, 2240, 2240, 2241, 2242, 2242, 2238,
-     2237, 2243, 2244, 2244, 2246, 2245, 2247, 2247, 2249, 2246,
-     2248, 2248, 2250, 2252, 2253, 2241, 2256, 2256, 2255, 2243,
-     2245, 2250, 2249, 2255, 2257, 2258, 2258, 2252, 2259, 2260,
-
-     2264, 2261, 2265, 2253, 2261, 2260, 2262, 2262, 2263, 2263,
-     2266, 2268, 2266, 2257, 2269, 2272, 2259, 2265, 2277, 2264,
-     2270, 2270, 2262, 2274, 2275, 2279, 2268, 2278, 2275, 2276,
-     2276, 2280, 2278, 2269, 2283, 2272, 2284, 2277, 2274, 2285,
-     2279, 2282, 2282, 2284, 2286, 2287, 2280, 2288, 2289, 2289,
-     2290, 2296, 2295, 2285, 2283, 2291, 2296, 2291, 2292, 2290,
-     2294, 2292, 2286, 2287, 2295, 2297, 2294, 2298, 2299, 2300,
-     2297, 2302, 2301, 2288, 2304, 2305, 2292, 2301, 2292, 2304,
-     2305, 2299, 2307, 2306, 2309, 2308, 2310, 2311, 2307, 2312,
-     2300, 2308, 2298, 2311, 2312, 2313, 2314, 2302, 2306, 2315,
-
-     2313, 2310, 2317, 2316, 2318, 2309, 2316, 2319, 2320, 2321,
-     2326, 2317, 2315, 2318, 2322, 2324, 2319, 2320, 2323, 2324,
-     2322, 2314, 2328, 2321, 2323, 2329, 2329, 2330, 2331, 2331,
-     2326, 2328, 2332, 2330, 2333, 2333, 2335, 2331, 2334, 2337,
-     2341, 2332, 2340, 2334, 2338, 2339, 2339, 2343, 2344, 2341,
-     2345, 2346, 2350, 2352, 2352, 2337, 2335, 2340, 2335, 2343,
-     2338, 2351, 2349, 2346, 2344, 2345, 2348, 2349,    0, 2348,
-     2353, 2353, 2350, 2351, 2355, 2355, 2356, 2357, 2358, 2356,
-     2359, 2360, 2357, 2362, 2358, 2365, 2359, 2361, 2361, 2364,
-     2360, 2363, 2363, 2366, 2367, 2367, 2368, 2362, 2370, 2365,
-
-     2369, 2364, 2368, 2370, 2372, 2378, 2373, 2376, 2372, 2373,
-     2374, 2374, 2366, 2375, 2369, 2377, 2376, 2379, 2375, 2380,
-     2380, 2379, 2381, 2383, 2377, 2378, 2384, 2385, 2383, 2386,
-     2387, 2388, 2389, 2390, 2387, 2381, 2391, 2389, 2392, 2390,
-     2393, 2394, 2391, 2386, 2395, 2396, 2384, 2385, 2399, 2395,
-     2398, 2388, 2400, 2408, 2408, 2401, 2392, 2400, 2407, 2393,
-     2394, 2401, 2398, 2402, 2399, 2403, 2396, 2403, 2405, 2410,
-     2409, 2402, 2407, 2409, 2411, 2411, 2414, 2405, 2415, 2416,
-     2414, 2417, 2417, 2418, 2415, 2421, 2421, 2423, 2425, 2429,
-     2426, 2416, 2418, 2430, 2429, 2410, 2431, 2440, 2432, 2433,
-
-     2434, 2434, 2425, 2432, 2433, 2423, 2426, 2436, 2436, 2438,
-     2439, 2439, 2441, 2440, 2444, 2438, 2442, 2431, 2446, 2430,
-     2445, 2442, 2450, 2445, 2447, 2448, 2448, 2452, 2453, 2451,
-     2446, 2450, 2457, 2444, 2441, 2451, 2447, 2455, 2455, 2456,
-     2458, 2463, 2456, 2453, 2464, 2452, 2460, 2460, 2461, 2461,
-     2462, 2457, 2465, 2464, 2466, 2462, 2466, 2465, 2458, 2463,
-     2467, 2468, 2470, 2471, 2469, 2472, 2473, 2470, 2474, 2474,
-     2478, 2473, 2475, 2475, 2467, 2468, 2469, 2476, 2476, 2477,
-     2477, 2479, 2478, 2471, 2480, 2472, 2481, 2481, 2483, 2480,
-     2482, 2482, 2484, 2485, 2486, 2487, 2490, 2488, 2493, 2479,
-
-     2483, 2489, 2489, 2491, 2491, 2485, 2492, 2492, 2494, 2493,
-     2495, 2496, 2484, 2488, 2486, 2490, 2487, 2495, 2497, 2498,
-     2494, 2499, 2500, 2496, 2498, 2501, 2501, 2502, 2503, 2504,
-     2505, 2506, 2507, 2509, 2508, 2509, 2502, 2513, 2497, 2510,
-     2516, 2499, 2500, 2505, 2511, 2511, 2507, 2514, 2512, 2504,
-     2517, 2510, 2513, 2518, 2503, 2506, 2508, 2512, 2516, 2520,
-     2519, 2521, 2514, 2519, 2522, 2530, 2521, 2523, 2523, 2522,
-     2524, 2524, 2517, 2520, 2525, 2525, 2518, 2527, 2527, 2529,
-     2529, 2531, 2532, 2530, 2533, 2535, 2536, 2537, 2538, 2539,
-     2540, 2541, 2531, 2541, 2542, 2543, 2549, 2544, 2539, 2533,
-
-        0, 2532, 2545, 2545, 2536, 2535, 2547, 2547, 2538, 2537,
-     2540, 2548, 2550, 2543, 2542, 2544, 2551, 2551, 2549, 2553,
-     2555, 2550, 2554, 2554, 2556, 2548, 2557, 2559, 2553, 2558,
-     2560, 2561, 2562, 2557, 2563, 2563, 2564, 2564, 2555, 2565,
-     2566, 2573, 2556, 2567, 2558, 2559, 2571, 2561, 2560, 2567,
-     2570, 2562, 2568, 2568, 2569, 2569, 2570, 2572, 2566, 2565,
-     2573, 2574, 2575, 2576, 2571, 2577, 2578, 2575, 2579, 2584,
-     2579, 2578, 2572, 2580, 2580, 2574, 2581, 2586, 2581, 2582,
-     2582, 2587, 2588, 2576, 2589, 2577, 2586, 2590, 2584, 2592,
-     2591, 2593, 2590, 2596, 2588, 2591, 2597, 2598, 2598, 2597,
-
-     2587, 2599, 2600, 2602, 2589, 2601, 2601, 2603, 2604, 2592,
-     2593, 2606, 2604, 2596, 2602, 2607, 2599, 2608, 2608, 2607,
-     2600, 2609, 2603, 2611, 2612, 2613, 2606, 2614, 2614, 2616,
-     2617, 2618, 2619, 2619, 2609, 2618, 2620, 2624, 2611, 2617,
-     2623, 2616, 2621, 2621, 2612, 2613, 2622, 2625, 2626, 2623,
-     2633, 2622, 2635, 2624, 2636, 2620, 2627, 2627,    0, 2625,
-     2632, 2632, 2634, 2634, 2637, 2635, 2638, 2636, 2626, 2639,
-     2640, 2640, 2633, 2637, 2641, 2638, 2642, 2647, 2639, 2644,
-     2644, 2648, 2647, 2649, 2650, 2651, 2648, 2652, 2654, 2650,
-     2653, 2642, 2656, 2651, 2641, 2657, 2654, 2649, 2658, 2653,
-
-     2657, 2659, 2663, 2658, 2660, 2660, 2652, 2656, 2661, 2661,
-     2662, 2664, 2664, 2665, 2666, 2662, 2659, 2667, 2668, 2666,
-     2665, 2663, 2669, 2672, 2670, 2671, 2671, 2673, 2669, 2670,
-     2674, 2674, 2673, 2675, 2675, 2667, 2668, 2678, 2672, 2679,
-     2679, 2680, 2681, 2684, 2680, 2689, 2682, 2681, 2681, 2683,
-     2678, 2682, 2685, 2688, 2683, 2686, 2687, 2684, 2685, 2686,
-     2689, 2687, 2688, 2690, 2691, 2694, 2692, 2693, 2695, 2697,
-     2694, 2690, 2692, 2693, 2698, 2699, 2697, 2701, 2699, 2698,
-     2695, 2703, 2704, 2705, 2706, 2691, 2703, 2704, 2713, 2701,
-     2707, 2708, 2709, 2709, 2710, 2718, 2714, 2706, 2715, 2707,
-
-     2708, 2705, 2714, 2710, 2715, 2719, 2713, 2720, 2721, 2721,
-     2722, 2723, 2724, 2725, 2718, 2726, 2726, 2722, 2727, 2729,
-     2731, 2724, 2734, 2732, 2737, 2719, 2720, 2732, 2725, 2735,
-     2723, 2733, 2733, 2736, 2729, 2735,    0, 2727, 2738, 2736,
-     2731, 2740, 2737, 2741, 2738, 2739, 2739, 2734, 2741, 2740,
-     2743, 2744, 2746, 2747, 2749, 2750, 2747, 2748, 2746, 2743,
-     2753, 2748, 2752, 2752, 2744, 2754, 2754, 2763, 2749,    0,
-     2750, 2755, 2755, 2757, 2757, 2758, 2759, 2765, 2753, 2758,
-     2764, 2759, 2761, 2761, 2767, 2764, 2766, 2763, 2769, 2765,
-     2775, 2766, 2766, 2770, 2770, 2779, 2767, 2772, 2772, 2773,
-
-     2773, 2774, 2776, 2775, 2774, 2778, 2778, 2781, 2769, 2782,
-     2782, 2783, 2783, 2779, 2785, 2776, 2784, 2784, 2786, 2786,
-     2787, 2788, 2789, 2799, 2790, 2791, 2791, 2781, 2792, 2785,
-     2790, 2795, 2792, 2787, 2800, 2796, 2789, 2795, 2798, 2788,
-     2796, 2801, 2802, 2798, 2798, 2803, 2799, 2804, 2802, 2805,
-     2811, 2803, 2809, 2805, 2800, 2806, 2806, 2809, 2811, 2812,
-     2814, 2801, 2812, 2815, 2816, 2816, 2815, 2821, 2818, 2817,
-     2819, 2820, 2804, 2818, 2822, 2822, 2823, 2826, 2828, 2825,
-     2830, 2821, 2869, 2828, 2828, 2814, 2817, 2817, 2819, 2824,
-     2823, 2820, 2824, 2825, 2827, 2839, 2826, 2869, 2829, 2830,
-
-     2824, 2836, 2827, 2829, 2829, 2831, 2831, 2832, 2832, 2833,
-     2833, 2834, 2834, 2835, 2835, 2837, 2838, 2836, 2840, 2841,
-     2837, 2839, 2842, 2840, 2843, 2844, 2845, 2842, 2847, 2847,
-     2848, 2848, 2849, 2843, 2850, 2849, 2838, 2853, 2841, 2852,
-     2852, 2854, 2854, 2855, 2853, 2844, 2845, 2858, 2855, 2857,
-     2857, 2859, 2850, 2860, 2861, 2863, 2858, 2864, 2864, 2866,
-     2859, 2865, 2860, 2861, 2867, 2865, 2868, 2871, 2866, 2870,
-     2872, 2882, 2873, 2863, 2870, 2870, 2873, 2868, 2881, 2872,
-     2871, 2877, 2883, 2867, 2878, 2878, 2877, 2880, 2880, 2885,
-     2885, 2887, 2881, 2886, 2890, 2894, 2882, 2892, 2897, 2891,
-
-     2883, 2895, 2886, 2887, 2891, 2899, 2892, 2895, 2901, 2902,
-     2897, 2903, 2903, 2901, 2902, 2894, 2904, 2906, 2907, 2890,
-     2908, 2914, 2906, 2909, 2909, 2904, 2899, 2909, 2911, 2911,
-     2914, 2907, 2912, 2912, 2908, 2913, 2913, 2915, 2917, 2916,
-     2919, 2923, 2920, 2917, 2921, 2925, 2919, 2920, 2924, 2921,
-     2922, 2922, 2927, 2929, 2930, 2930, 2926, 2915, 2916, 2923,
-     2924, 2926, 2928, 2932, 2933, 2936, 2925, 2932, 2928, 2933,
-     2927, 2934, 2935, 2935, 2937, 2938, 2934, 2940, 2929, 2942,
-     2942, 2944, 2945, 2946, 2936, 2948, 2949, 2946, 2950, 2937,
-     2938, 2947, 2954, 2951, 2944, 2945, 2950, 2940, 2951, 2953,
-
-     2947, 2948, 2952, 2952, 2955, 2949, 2956, 2956, 2953, 2957,
-     2954, 2960, 2960, 2961, 2961, 2963, 2965, 2965, 2967, 2968,
-     2969, 2970, 2971, 2973, 2973, 2969, 2974, 2971, 2957, 2975,
-     2955, 2977, 2978, 2976, 2967, 2968, 2963, 2970, 2975, 2976,
-     2980, 2980, 2981, 2982, 2983, 2983, 2974, 2986, 2988, 2987,
-     2990, 2978, 3000, 2988, 2977, 2987, 2981, 2991, 2991, 2992,
-     2992, 2993, 2982, 2994, 2995, 2995, 2996, 2986, 2998, 2997,
-     3001, 3000, 2990, 2999, 3002, 3004, 2993, 2996, 2997, 2999,
-     3003, 3003, 3001, 2994, 2995, 3012, 3005, 3011, 2998, 3005,
-     3004, 3017, 3006,    0, 3002, 3006, 3007, 3007, 3013, 3011,
-
-     3014, 3014, 3016, 3015, 3013, 3012, 3015, 3019, 3016, 3017,
-     3020, 3020, 3019, 3021, 3022, 3023, 3027, 3024, 3021, 3025,
-     3025, 3023, 3028, 3029, 3030, 3031, 3031, 3032, 3027, 3033,
-     3034, 3036, 3036, 3022, 3024, 3024, 3039, 3030, 3038, 3034,
-     3028, 3037, 3037, 3038, 3040, 3033, 3032, 3044, 3029, 3040,
-     3039, 3041, 3041, 3042, 3042, 3043, 3043, 3045, 3046, 3052,
-     3044, 3047, 3049, 3049, 3046, 3054, 3047, 3055, 3057, 3056,
-     3058, 3058, 3060, 3060, 3061, 3062, 3064, 3063, 3052, 3066,
-     3066, 3067, 3067, 3045, 3065, 3070, 3069, 3054, 3056, 3055,
-     3057, 3063, 3069, 3065, 3062, 3071, 3064, 3072, 3075, 3082,
-
-     3061, 3080, 3072, 3076, 3076, 3070, 3078, 3078, 3079, 3083,
-     3081, 3082, 3089, 3079, 3071, 3080, 3081, 3083, 3085, 3075,
-     3084, 3084, 3087, 3085, 3088, 3090, 3087, 3092, 3091, 3088,
-     3093, 3096, 3089, 3091, 3095, 3097, 3093, 3098, 3100, 3092,
-     3107,    0, 3095, 3101, 3102, 3090, 3103, 3104, 3106, 3109,
-     3096, 3111, 3104, 3106, 3109, 3097, 3100, 3098, 3108, 3101,
-     3107, 3102, 3102, 3112, 3108, 3113, 3112, 3103, 3116, 3116,
-     3118, 3111, 3117, 3117, 3118, 3122, 3122, 3123, 3113, 3124,
-     3125, 3125, 3123, 3127, 3127, 3128, 3128, 3132, 3128, 3129,
-     3129, 3132, 3129, 3130, 3130, 3134, 3131, 3131, 3124, 3131,
-
-     3134, 3135, 3136, 3136, 3137, 3138, 3141, 3142, 3143, 3145,
-     3135, 3144, 3144, 3143, 3148, 3151, 3149, 3150, 3152, 3138,
-     3154, 3150, 3137, 3149, 3151, 3155, 3141, 3142, 3157, 3145,
-     3155, 3156, 3156, 3152, 3158, 3158, 3161, 3157, 3154, 3148,
-     3159, 3159, 3160, 3160, 3162, 3163, 3166, 3164, 3167, 3162,
-     3165, 3161, 3164, 3164, 3163, 3168, 3165, 3163, 3171, 3169,
-     3170, 3172, 3172, 3167, 3169, 3170, 3173, 3174, 3175, 3175,
-     3177, 3166, 3173, 3174, 3176, 3176, 3168, 3171, 3178, 3181,
-     3181, 3183, 3183, 3178, 3184, 3177, 3187, 3187, 3188, 3188,
-     3189, 3189, 3196, 3184, 3190, 3190, 3192, 3192, 3193, 3193,
-
-     3194, 3194, 3195, 3195, 3198, 3199, 3199, 3200, 3201, 3202,
-     3204, 3204, 3205, 3198, 3206, 3206, 3200, 3207, 3196, 3219,
-     3201, 3208, 3213, 3209, 3210, 3210, 3211, 3211, 3217, 3202,
-     3218, 3205, 3207, 3218, 3208, 3209, 3221, 3213, 3214, 3214,
-     3220, 3220, 3224, 3225, 3223, 3219, 3217, 3223, 3224, 3227,
-     3226, 3228, 3231, 3232, 3221, 3226, 3229, 3225, 3231, 3235,
-     3236, 3239, 3232, 3235, 3249, 3248, 3251, 3249, 3227, 3228,
-     3248, 3257, 3229, 3252, 3252, 3236, 3253, 3253, 3260, 3251,
-     3255, 3255, 3258, 3262, 3259, 3264, 3271, 3239, 3259, 3265,
-     3266, 3258, 3268, 3270, 3257, 3266, 3272, 3262, 3260, 3267,
-
-     3265, 3267, 3269, 3269, 3273, 3271, 3270, 3268, 3264, 3274,
-     3275, 3277, 3276, 3278, 3272, 3279, 3287, 3280, 3278, 3282,
-     3273, 3276, 3280, 3277, 3283, 3275, 3281, 3281, 3288, 3283,
-     3287, 3289, 3289, 3290, 3274, 3295, 3279, 3291, 3291, 3282,
-     3292, 3292, 3290, 3293, 3293, 3294, 3294, 3296, 3288, 3297,
-     3298, 3299, 3297, 3300, 3295, 3298, 3299, 3301, 3302, 3303,
-     3305, 3307, 3304, 3312, 3302, 3305, 3317, 3296, 3306, 3306,
-     3308, 3308, 3301, 3303, 3304, 3310, 3310, 3311, 3300, 3313,
-     3313, 3307, 3312, 3315, 3317, 3320, 3320, 3321, 3321, 3322,
-     3323, 3326, 3311, 3324, 3325, 3327, 3328, 3322, 3315, 3324,
-
-     3325, 3329, 3330, 3330, 3335, 3326, 3329, 3336, 3327, 3323,
-     3332, 3332, 3338, 3339, 3341, 3328, 3342, 3339, 3343, 3344,
-     3345, 3342, 3346, 3347, 3348, 3335, 3338, 3336, 3347, 3348,
-     3349, 3349, 3344, 3345, 3341, 3352, 3353, 3343, 3354, 3355,
-     3355, 3346, 3356, 3357, 3358, 3358, 3359, 3356, 3360, 3357,
-     3362, 3359, 3363, 3360, 3353, 3352, 3361, 3354, 3363, 3365,
-     3365, 3361, 3366, 3367, 3367, 3370, 3369, 3366, 3371, 3362,
-     3369, 3372, 3373, 3374, 3375, 3371, 3376, 3378, 3378, 3374,
-     3380, 3380, 3382, 3381, 3370, 3383, 3384, 3382, 3385, 3376,
-     3372, 3373, 3381, 3375, 3387, 3381, 3386, 3386, 3388, 3387,
-
-     3390, 3385, 3391, 3391, 3383, 3384, 3392, 3393, 3393, 3394,
-     3394, 3388, 3395, 3396, 3397, 3398, 3398, 3395, 3399, 3400,
-     3396, 3400, 3402, 3399, 3403, 3392, 3390, 3401, 3401, 3402,
-     3404, 3403, 3405, 3397, 3406, 3408, 3408, 3405, 3409, 3411,
-     3412, 3413, 3414, 3418, 3411, 3412, 3415, 3415, 3419, 3404,
-     3417, 3417,    0, 3406, 3420, 3420, 3422, 3409, 3421, 3421,
-     3413, 3414, 3418, 3422, 3424, 3424, 3426, 3419, 3425, 3425,
-     3428, 3431, 3432, 3426, 3433, 3428, 3431, 3434, 3434, 3435,
-     3435,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0, 3432,    0, 3433, 3439, 3439, 3439, 3439, 3439, 3439,
-
-     3439, 3440, 3440, 3440, 3440, 3440, 3440, 3440, 3441, 3441,
-     3441, 3441, 3441, 3441, 3441, 3442, 3442, 3442, 3442, 3442,
-     3442, 3442, 3443, 3443, 3443, 3443, 3443, 3443, 3443, 3444,
-     3444, 3444, 3444, 3444, 3444, 3444, 3445, 3445, 3445, 3445,
-     3445, 3445, 3445, 3447, 3447,    0, 3447, 3447, 3447, 3447,
-     3448, 3448,    0,    0,    0, 3448, 3448, 3449, 3449,    0,
-        0, 3449,    0, 3449, 3450,    0,    0,    0,    0,    0,
-     3450, 3451, 3451,    0,    0,    0, 3451, 3451, 3452,    0,
-        0,    0,    0,    0, 3452, 3453, 3453,    0, 3453, 3453,
-     3453, 3453, 3454,    0,    0,    0,    0,    0, 3454, 3455,
-
-     3455,    0,    0,    0, 3455, 3455, 3456, 3456,    0, 3456,
-     3456, 3456, 3456, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438, 3438,
-     3438, 3438, 3438, 3438
+static const flex_int16_t yy_chk[5319] =
+    {   1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+        3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+        3,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+        5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+
+        5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+        5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
+        5,     5,     7,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     7,     7,     7,     7,     7,     7,     7,
+        7,     7,     7,     9,     9,     9,     9,     9,     9,     9,
+        9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
+        9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
+        9,     9,     9,     9,     9,     9,     9,     9,     9,     9,
+
+        9,     9,     9,     9,    11,    11,    11,    11,    11,    11,
+       11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+       11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+       11,    11,    11,    11,    11,    11,    11,    11,    11,    11,
+       11,    11,    11,    11,    11,    13,    13,    13,    13,    13,
+       13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+       13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+       13,    13,    13,    13,    13,    13,    13,    13,    13,    13,
+       13,    13,    13,    13,    13,    13,    15,    15,    15,    15,
+       15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+
+       15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+       15,    15,    15,    15,    15,    15,    15,    15,    15,    15,
+       15,    15,    15,    15,    15,    15,    15,    18,    18,    20,
+       26,    33,    34,    18,    35,    18,    18,    18,    18,    18,
+       38,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+       18,    18,    18,    18,    18,    18,    18,    18,    18,    18,
+       18,    18,    18,    18,    18,    18,    18,    18,    19,    40,
+       19,    23,    23,    23,    19,    23,    23,    23,    23,    23,
+       23,    23,    23,    23,    23,    23,    23,    23,    23,    23,
+       23,    23,    23,    23,    23,    23,    23,    23,    23,    23,
+
+       23,    23,    23,    23,    23,    23,    23,    23,    23,    23,
+       23,    23,    24,    24,    24,    46,    24,    24,    24,    24,
+       24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+       24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+       24,    24,    24,    24,    24,    24,    24,    24,    24,    24,
+       24,    24,    24,    25,    25,    47,    27,    25,    29,    30,
+       31,    59,    25,    27,    74,    28,    76,    27,    31,    28,
+       27,    25,    28,    30,    28,    28,    36,    32,    29,    31,
+       32,    94,    37,    44,    36,    28,    37,    32,    95,    32,
+       36,    39,    41,    44,    36,    39,    41,    44,    44,    39,
+
+       37,    43,    37,    43,    96,    39,    41,    41,    39,    41,
+       42,    97,    43,    42,    98,    39,    99,   101,    43,    45,
+       42,   102,   103,    45,    42,    42,   106,    45,    48,    48,
+       48,   105,   105,   107,    48,    48,    48,    48,    48,    48,
+       48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
+       48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
+       48,    48,    48,    48,    48,    48,    48,    48,    48,    52,
+       52,    52,   109,    52,    52,    52,    52,    52,    52,    52,
+       52,    52,    52,    52,    52,    52,    52,    52,    52,    52,
+       52,    52,    52,    52,    52,    52,    52,    52,    52,    52,
+
+       52,    52,    52,    52,    52,    52,    52,    52,    52,    52,
+       53,    53,    53,   110,   111,    53,    53,   113,    53,    53,
+       53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
+       53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
+       53,    53,    53,    53,    53,    53,    53,    53,    53,    53,
+       53,    57,    57,    57,   114,    57,    57,    57,    57,    57,
+       57,    57,    57,    57,    57,    57,    57,    57,    57,    57,
+       57,    57,    57,    57,    57,    57,    57,    57,    57,    57,
+       57,    57,    57,    57,    57,    57,    57,    57,    57,    57,
+       57,    57,    58,    58,   115,   116,   117,   118,    58,   121,
+
+       58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
+       58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
+       58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
+       58,    58,    58,    63,    63,    63,   125,    63,    63,    63,
+       63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+       63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+       63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+       63,    63,    63,    63,    64,    64,    64,   126,   127,   128,
+       64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+       64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+
+       64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
+       64,    64,    64,    64,    64,    68,    68,    68,   129,    68,
+       68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
+       68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
+       68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
+       68,    68,    68,    68,    68,    68,    69,    69,   124,   130,
+      131,   132,    69,   124,    69,    69,    69,    69,    69,    69,
+       69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
+       69,    69,    69,    69,    69,    69,    69,    69,    69,    69,
+       69,    69,    69,    69,    69,    69,    69,    71,    71,    71,
+
+      133,    71,    71,    71,    71,    71,    71,    71,    71,    71,
+       71,    71,    71,    71,    71,    71,    71,    71,    71,    71,
+       71,    71,    71,    71,    71,    71,    71,    71,    71,    71,
+       71,    71,    71,    71,    71,    71,    71,    71,    73,    73,
+       73,   134,    73,    73,    73,    73,    73,    73,    73,    73,
+       73,    73,    73,    73,    73,    73,    73,    73,    73,    73,
+       73,    73,    73,    73,    73,    73,    73,    73,    73,    73,
+       73,    73,    73,    73,    73,    73,    73,    73,    73,    75,
+       75,   135,   136,   138,   139,    75,   139,    75,    75,    75,
+       75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+
+       75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+       75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+       80,    80,    80,   140,    80,    80,    80,    80,    80,    80,
+       80,    80,    80,    80,    80,    80,    80,    80,    80,    80,
+       80,    80,    80,    80,    80,    80,    80,    80,    80,    80,
+       80,    80,    80,    80,    80,    80,    80,    80,    80,    80,
+       80,    81,    81,    81,   144,   152,   154,    81,    81,    81,
+       81,    81,    81,    81,    81,    81,    81,    81,    81,    81,
+       81,    81,    81,    81,    81,    81,    81,    81,    81,    81,
+       81,    81,    81,    81,    81,    81,    81,    81,    81,    81,
+
+       81,    81,    85,    85,    85,   156,    85,    85,    85,    85,
+       85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
+       85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
+       85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
+       85,    85,    85,    89,    89,    89,   157,    89,    89,    89,
+       89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
+       89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
+       89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
+       89,    89,    89,    89,    92,    92,    92,   158,    92,    92,
+       92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
+
+       92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
+       92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
+       92,    92,    92,    92,    92,   100,   104,   108,   112,   112,
+      120,   122,   104,   141,   104,   143,   112,   119,   100,   123,
+      119,   137,   141,   123,   142,   137,   108,   143,   141,   145,
+      142,   122,   147,   119,   119,   120,   146,   159,   149,   123,
+      145,   148,   150,   148,   145,   151,   160,   153,   146,   151,
+      153,   161,   155,   150,   155,   149,   162,   147,   149,   181,
+      190,   155,   192,   193,   195,   197,   195,   196,   196,   198,
+      179,   179,   179,   155,   179,   179,   179,   179,   179,   179,
+
+      179,   179,   179,   179,   179,   179,   179,   179,   179,   179,
+      179,   179,   179,   179,   179,   179,   179,   179,   179,   179,
+      179,   179,   179,   179,   179,   179,   179,   179,   179,   179,
+      179,   191,   194,   199,   200,   201,   202,   204,   203,   194,
+      205,   206,   207,   202,   201,   203,   191,   207,   209,   208,
+      210,   211,   212,   213,   208,   214,   215,   216,   217,   208,
+      218,   219,   220,   221,   207,   208,   208,   223,   222,   224,
+      217,   222,   225,   226,   227,   228,   226,   229,   226,   230,
+      231,   232,   233,   234,   235,   236,   216,   237,   238,   237,
+      226,   239,   226,   232,   240,   241,   242,   243,   244,   245,
+
+      236,   246,   247,   242,   248,   249,   250,   249,   251,   252,
+      250,   245,   253,   246,   249,   243,   253,   254,   255,   256,
+      257,   258,   259,   260,   261,   257,   262,   263,   264,   264,
+      265,   261,   266,   267,   268,   269,   270,   271,   269,   272,
+      273,   274,   275,   276,   277,   279,   278,   280,   281,   283,
+      276,   278,   268,   283,   282,   284,   286,   287,   288,   289,
+      275,   290,   291,   292,   277,   281,   293,   294,   295,   279,
+      282,   296,   297,   297,   298,   299,   300,   301,   302,   303,
+      304,   305,   306,   307,   308,   309,   307,   310,   311,   312,
+      313,   311,   314,   315,   316,   304,   317,   318,   319,   302,
+
+      320,   321,   314,   315,   322,   323,   324,   325,   326,   327,
+      328,   329,   329,   331,   330,   332,   333,   334,   335,   336,
+      337,   322,   330,   338,   339,   340,   341,   340,   342,   343,
+      345,   346,   335,   326,   344,   347,   348,   344,   348,   349,
+      350,   339,   344,   344,   344,   344,   351,   352,   352,   354,
+      353,   348,   355,   356,   348,   353,   356,   357,   358,   358,
+      359,   359,   355,   360,   361,   362,   363,   364,   365,   366,
+      367,   368,   369,   370,   371,   372,   373,   374,   376,   374,
+      377,   378,   379,   380,   381,   382,   383,   382,   374,   384,
+      381,   385,   386,   371,   387,   388,   389,   383,   390,   391,
+
+      390,   391,   384,   392,   394,   384,   390,   384,   395,   396,
+      390,   399,   401,   402,   391,   390,   404,   391,   390,   391,
+      398,   391,   393,   393,   403,   406,   398,   407,   393,   403,
+      400,   400,   408,   409,   410,   411,   398,   405,   405,   412,
+      400,   393,   400,   400,   400,   405,   413,   400,   414,   415,
+      400,   416,   417,   412,   418,   419,   420,   421,   422,   415,
+      423,   424,   425,   426,   425,   427,   428,   429,   430,   416,
+      431,   431,   432,   433,   434,   435,   437,   437,   431,   436,
+      439,   438,   440,   441,   442,   443,   444,   445,   447,   429,
+      428,   438,   436,   446,   437,   439,   447,   447,   448,   444,
+
+      447,   447,   449,   450,   446,   451,   446,   452,   453,   454,
+      455,   456,   457,   458,   459,   460,   454,   461,   462,   461,
+      463,   464,   465,   462,   455,   466,   467,   468,   469,   457,
+      470,   471,   472,   473,   474,   475,   476,   473,   477,   478,
+      472,   479,   480,   481,   482,   483,   484,   485,   487,   489,
+      490,   491,   492,   493,   494,   485,   495,   496,   498,   499,
+      498,   500,   501,   502,   490,   503,   504,   505,   506,   502,
+      507,   508,   509,   510,   508,   511,   512,   513,   514,   515,
+      516,   517,   518,   519,   520,   521,   522,   523,   524,   525,
+      526,   528,   526,   527,   530,   531,   528,   532,   528,   533,
+
+      525,   534,   535,   515,   528,   527,   528,   536,   537,   528,
+      528,   538,   539,   540,   541,   538,   528,   541,   542,   543,
+      544,   545,   546,   547,   548,   549,   550,   544,   551,   552,
+      543,   553,   554,   555,   556,   557,   558,   559,   560,   561,
+      562,   563,   556,   564,   568,   549,   565,   565,   567,   569,
+      567,   570,   571,   572,   573,   574,   575,   576,   577,   578,
+      580,   579,   553,   581,   583,   582,   575,   579,   582,   584,
+      585,   586,   581,   580,   583,   587,   588,   589,   571,   590,
+      591,   592,   593,   594,   594,   595,   596,   597,   598,   593,
+      595,   599,   593,   600,   601,   602,   603,   604,   596,   605,
+
+      606,   603,   607,   608,   609,   610,   611,   612,   613,   614,
+      615,   616,   617,   604,   618,   619,   620,   620,   612,   621,
+      622,   623,   624,   625,   626,   627,   628,   629,   630,   631,
+      632,   625,   629,   633,   634,   629,   629,   635,   636,   637,
+      639,   640,   641,   629,   642,   643,   644,   645,   646,   647,
+      648,   649,   648,   650,   651,   652,   640,   649,   653,   654,
+      655,   652,   656,   657,   658,   659,   642,   660,   661,   663,
+      658,   662,   662,   664,   665,   660,   666,   667,   668,   666,
+      669,   670,   671,   672,   673,   674,   675,   676,   677,   662,
+      678,   679,   680,   677,   674,   681,   680,   682,   683,   684,
+
+      685,   686,   687,   688,   689,   690,   693,   691,   692,   694,
+      680,   680,   695,   692,   696,   697,   686,   691,   688,   698,
+      699,   700,   701,   702,   703,   704,   705,   706,   696,   707,
+      707,   708,   709,   710,   711,   712,   713,   714,   715,   716,
+      705,   717,   718,   719,   715,   720,   721,   723,   722,   725,
+      718,   722,   724,   724,   726,   727,   728,   729,   726,   730,
+      731,   732,   733,   734,   735,   736,   737,   738,   739,   740,
+      741,   742,   743,   734,   740,   744,   745,   746,   747,   748,
+      749,   741,   750,   751,   752,   753,   754,   755,   756,   749,
+      757,   758,   759,   760,   761,   762,   763,   760,   762,   756,
+
+      764,   765,   766,   767,   768,   770,   771,   772,   764,   773,
+      774,   775,   776,   763,   777,   778,   779,   775,   778,   780,
+      781,   782,   783,   785,   788,   783,   791,   792,   792,   783,
+      794,   795,   783,   796,   788,   796,   797,   798,   799,   783,
+      783,   800,   783,   801,   802,   803,   804,   806,   805,   805,
+      798,   805,   807,   808,   805,   809,   810,   811,   800,   805,
+      812,   813,   814,   815,   816,   805,   805,   817,   818,   819,
+      820,   821,   817,   811,   822,   823,   824,   825,   826,   827,
+      816,   810,   828,   829,   830,   831,   829,   832,   833,   834,
+      835,   834,   836,   837,   838,   839,   840,   841,   842,   843,
+
+      828,   841,   844,   845,   847,   827,   848,   849,   845,   850,
+      851,   852,   853,   854,   855,   856,   857,   858,   859,   860,
+      861,   862,   863,   862,   864,   865,   854,   866,   867,   868,
+      869,   870,   867,   871,   872,   864,   874,   875,   876,   877,
+      878,   879,   880,   881,   870,   882,   883,   882,   884,   885,
+      886,   887,   889,   888,   890,   886,   891,   885,   892,   893,
+      895,   896,   877,   888,   897,   896,   898,   893,   899,   900,
+      901,   902,   901,   903,   904,   905,   906,   907,   908,   909,
+      910,   911,   912,   906,   913,   914,   915,   917,   898,   915,
+      916,   916,   907,   918,   903,   912,   919,   920,   921,   922,
+
+      923,   924,   925,   926,   927,   928,   929,   930,   931,   932,
+      933,   934,   935,   936,   935,   937,   938,   939,   940,   941,
+      941,   942,   943,   944,   945,   933,   946,   947,   948,   942,
+      949,   950,   945,   951,   952,   953,   949,   954,   955,   956,
+      957,   958,   957,   959,   960,   961,   958,   962,   963,   964,
+      965,   967,   968,   959,   969,   967,   971,   972,   973,   974,
+      975,   974,   976,   977,   978,   974,   979,   974,   980,   981,
+      982,   979,   974,   983,   984,   985,   986,   974,   987,   988,
+      985,   989,   990,   991,   992,   993,   994,   995,   996,   991,
+      997,   988,   990,   998,   999,  1000,  1001,  1002,  1003,  1004,
+
+     1005,  1006,   997,  1007,  1008,   999,  1002,  1009,  1007,  1010,
+     1007,  1011,  1012,  1013,  1006,  1015,  1007,  1014,  1016,  1017,
+     1018,  1007,  1007,  1019,  1014,  1020,  1021,  1022,  1007,  1023,
+     1024,  1025,  1029,  1026,  1027,  1030,  1031,  1018,  1026,  1032,
+     1027,  1033,  1034,  1035,  1036,  1037,  1040,  1030,  1039,  1033,
+     1041,  1039,  1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,
+     1050,  1051,  1052,  1053,  1054,  1056,  1058,  1059,  1053,  1060,
+     1052,  1061,  1062,  1063,  1064,  1065,  1066,  1069,  1070,  1071,
+     1072,  1071,  1073,  1074,  1064,  1075,  1076,  1078,  1079,  1081,
+     1083,  1082,  1083,  1079,  1082,  1084,  1085,  1086,  1087,  1088,
+
+     1089,  1090,  1091,  1092,  1093,  1094,  1095,  1096,  1098,  1099,
+     1100,  1101,  1102,  1086,  1103,  1104,  1105,  1106,  1107,  1109,
+     1107,  1110,  1111,  1112,  1099,  1114,  1113,  1115,  1116,  1117,
+     1118,  1109,  1113,  1119,  1120,  1121,  1117,  1119,  1122,  1123,
+     1124,  1125,  1126,  1127,  1128,  1129,  1131,  1132,  1133,  1134,
+     1135,  1136,  1137,  1138,  1139,  1140,  1141,  1142,  1143,  1144,
+     1145,  1146,  1147,  1140,  1143,  1148,  1149,  1144,  1150,  1151,
+     1152,  1153,  1154,  1155,  1156,  1157,  1158,  1159,  1160,  1161,
+     1162,  1163,  1164,  1166,  1167,  1168,  1157,  1169,  1163,  1170,
+     1171,  1173,  1153,  1174,  1175,  1167,  1176,  1177,  1178,  1159,
+
+     1179,  1180,  1181,  1182,  1183,  1184,  1185,  1185,  1186,  1187,
+     1188,  1189,  1190,  1164,  1191,  1192,  1193,  1194,  1196,  1197,
+     1198,  1179,  1199,  1200,  1201,  1202,  1205,  1192,  1206,  1204,
+     1207,  1208,  1209,  1210,  1202,  1211,  1202,  1204,  1212,  1202,
+     1213,  1214,  1215,  1205,  1216,  1217,  1218,  1220,  1219,  1210,
+     1219,  1222,  1223,  1224,  1225,  1226,  1227,  1228,  1229,  1230,
+     1231,  1232,  1233,  1234,  1235,  1236,  1237,  1238,  1237,  1239,
+     1240,  1241,  1242,  1243,  1244,  1245,  1246,  1247,  1248,  1249,
+     1250,  1252,  1253,  1254,  1255,  1255,  1256,  1258,  1257,  1259,
+     1252,  1257,  1260,  1261,  1262,  1263,  1265,  1264,  1261,  1266,
+
+     1265,  1267,  1268,  1266,  1248,  1264,  1266,  1266,  1269,  1270,
+     1271,  1266,  1272,  1273,  1274,  1275,  1276,  1266,  1277,  1278,
+     1279,  1266,  1279,  1280,  1281,  1282,  1283,  1281,  1284,  1285,
+     1286,  1287,  1288,  1289,  1290,  1291,  1292,  1293,  1294,  1295,
+     1296,  1298,  1293,  1300,  1293,  1300,  1293,  1298,  1293,  1297,
+     1297,  1291,  1301,  1302,  1303,  1304,  1305,  1302,  1306,  1307,
+     1308,  1305,  1309,  1310,  1311,  1312,  1313,  1314,  1297,  1308,
+     1315,  1316,  1318,  1317,  1319,  1320,  1321,  1322,  1323,  1312,
+     1317,  1324,  1325,  1326,  1327,  1328,  1329,  1330,  1322,  1332,
+     1333,  1334,  1335,  1336,  1337,  1330,  1325,  1324,  1338,  1327,
+
+     1337,  1339,  1340,  1341,  1342,  1343,  1344,  1345,  1346,  1347,
+     1348,  1349,  1350,  1351,  1352,  1345,  1354,  1355,  1356,  1357,
+     1358,  1341,  1359,  1360,  1361,  1362,  1363,  1364,  1365,  1360,
+     1366,  1367,  1364,  1368,  1369,  1370,  1371,  1372,  1374,  1375,
+     1376,  1369,  1377,  1378,  1371,  1379,  1379,  1380,  1372,  1381,
+     1382,  1383,  1384,  1386,  1387,  1388,  1389,  1390,  1391,  1380,
+     1392,  1393,  1395,  1396,  1387,  1397,  1398,  1399,  1400,  1396,
+     1401,  1402,  1403,  1381,  1404,  1400,  1405,  1390,  1406,  1407,
+     1408,  1409,  1410,  1412,  1413,  1414,  1415,  1416,  1416,  1413,
+     1417,  1418,  1419,  1420,  1421,  1419,  1420,  1422,  1423,  1425,
+
+     1426,  1427,  1428,  1429,  1422,  1431,  1430,  1428,  1432,  1433,
+     1434,  1435,  1418,  1427,  1430,  1436,  1437,  1439,  1440,  1441,
+     1442,  1426,  1443,  1444,  1445,  1446,  1447,  1448,  1449,  1450,
+     1451,  1452,  1453,  1454,  1447,  1455,  1456,  1457,  1458,  1459,
+     1460,  1461,  1462,  1463,  1464,  1454,  1465,  1466,  1467,  1468,
+     1467,  1469,  1466,  1469,  1468,  1470,  1471,  1472,  1473,  1474,
+     1475,  1474,  1476,  1478,  1479,  1480,  1481,  1482,  1483,  1484,
+     1485,  1486,  1487,  1488,  1489,  1490,  1491,  1488,  1492,  1491,
+     1493,  1494,  1495,  1492,  1496,  1493,  1497,  1498,  1499,  1500,
+     1501,  1502,  1503,  1504,  1505,  1506,  1507,  1508,  1496,  1509,
+
+     1510,  1511,  1512,  1513,  1511,  1514,  1515,  1506,  1511,  1509,
+     1516,  1517,  1518,  1519,  1520,  1521,  1522,  1523,  1524,  1523,
+     1520,  1525,  1526,  1527,  1528,  1529,  1530,  1531,  1528,  1534,
+     1532,  1517,  1535,  1529,  1532,  1536,  1537,  1538,  1539,  1540,
+     1541,  1542,  1543,  1544,  1545,  1539,  1546,  1532,  1547,  1548,
+     1549,  1550,  1551,  1552,  1553,  1554,  1556,  1558,  1559,  1560,
+     1561,  1562,  1564,  1566,  1567,  1568,  1569,  1571,  1572,  1573,
+     1574,  1575,  1576,  1577,  1578,  1579,  1580,  1581,  1582,  1583,
+     1584,  1585,  1586,  1587,  1588,  1589,  1581,  1590,  1592,  1593,
+     1590,  1579,  1594,  1595,  1596,  1597,  1598,  1599,  1600,  1601,
+
+     1602,  1602,  1603,  1604,  1605,  1599,  1606,  1607,  1603,  1609,
+     1610,  1612,  1607,  1611,  1587,  1613,  1611,  1614,  1615,  1616,
+     1616,  1617,  1618,  1619,  1620,  1621,  1622,  1623,  1624,  1625,
+     1623,  1626,  1627,  1628,  1629,  1630,  1631,  1632,  1634,  1635,
+     1636,  1637,  1639,  1640,  1641,  1642,  1643,  1644,  1645,  1628,
+     1646,  1647,  1640,  1637,  1648,  1650,  1649,  1651,  1652,  1653,
+     1651,  1654,  1645,  1649,  1656,  1657,  1658,  1659,  1660,  1646,
+     1661,  1662,  1651,  1663,  1664,  1665,  1666,  1654,  1667,  1668,
+     1669,  1670,  1671,  1668,  1672,  1673,  1674,  1675,  1676,  1677,
+     1678,  1679,  1680,  1681,  1682,  1683,  1684,  1685,  1686,  1687,
+
+     1688,  1689,  1690,  1691,  1693,  1694,  1695,  1696,  1697,  1698,
+     1699,  1700,  1690,  1677,  1701,  1689,  1702,  1704,  1705,  1706,
+     1698,  1707,  1693,  1708,  1709,  1710,  1711,  1712,  1713,  1714,
+     1708,  1715,  1711,  1716,  1709,  1717,  1718,  1720,  1717,  1713,
+     1722,  1723,  1720,  1702,  1715,  1723,  1724,  1725,  1726,  1727,
+     1728,  1729,  1730,  1731,  1732,  1733,  1734,  1735,  1736,  1737,
+     1738,  1739,  1740,  1741,  1742,  1740,  1743,  1744,  1746,  1747,
+     1748,  1749,  1750,  1751,  1752,  1753,  1756,  1757,  1751,  1758,
+     1759,  1760,  1761,  1762,  1763,  1764,  1765,  1766,  1764,  1767,
+     1768,  1769,  1743,  1772,  1757,  1770,  1773,  1774,  1763,  1775,
+
+     1770,  1776,  1777,  1778,  1779,  1780,  1774,  1781,  1782,  1783,
+     1784,  1786,  1768,  1787,  1788,  1789,  1790,  1791,  1783,  1793,
+     1795,  1796,  1790,  1797,  1798,  1795,  1799,  1800,  1801,  1793,
+     1802,  1803,  1804,  1805,  1806,  1807,  1808,  1809,  1810,  1811,
+     1812,  1813,  1814,  1815,  1816,  1817,  1818,  1819,  1815,  1820,
+     1821,  1822,  1823,  1820,  1823,  1805,  1825,  1826,  1816,  1827,
+     1828,  1827,  1829,  1830,  1831,  1832,  1833,  1821,  1835,  1836,
+     1837,  1838,  1839,  1840,  1841,  1832,  1839,  1842,  1843,  1844,
+     1842,  1845,  1846,  1847,  1848,  1849,  1837,  1851,  1852,  1853,
+     1854,  1855,  1856,  1857,  1858,  1859,  1861,  1862,  1863,  1864,
+
+     1865,  1866,  1867,  1868,  1856,  1869,  1870,  1871,  1872,  1873,
+     1874,  1875,  1876,  1877,  1878,  1866,  1879,  1880,  1881,  1882,
+     1883,  1884,  1887,  1885,  1880,  1885,  1888,  1878,  1869,  1889,
+     1890,  1891,  1892,  1893,  1892,  1894,  1895,  1896,  1889,  1897,
+     1898,  1899,  1900,  1901,  1902,  1902,  1903,  1904,  1906,  1907,
+     1908,  1893,  1909,  1910,  1911,  1912,  1913,  1914,  1915,  1916,
+     1917,  1918,  1919,  1920,  1921,  1921,  1921,  1922,  1921,  1923,
+     1924,  1921,  1925,  1926,  1909,  1927,  1929,  1930,  1931,  1932,
+     1933,  1929,  1930,  1934,  1935,  1936,  1937,  1938,  1939,  1933,
+     1940,  1941,  1942,  1943,  1944,  1936,  1941,  1945,  1946,  1947,
+
+     1950,  1940,  1951,  1952,  1954,  1955,  1956,  1957,  1958,  1959,
+     1960,  1961,  1944,  1961,  1962,  1963,  1964,  1965,  1957,  1966,
+     1967,  1968,  1970,  1971,  1972,  1973,  1974,  1975,  1977,  1978,
+     1979,  1980,  1981,  1970,  1982,  1983,  1984,  1985,  1986,  1987,
+     1988,  1989,  1991,  1992,  1993,  1977,  1994,  1995,  1997,  1998,
+     1999,  2000,  2001,  2002,  2004,  2001,  2005,  2006,  2008,  2009,
+     2010,  1986,  1998,  1995,  2011,  2007,  2012,  2005,  2007,  2013,
+     2014,  2012,  2015,  2016,  2017,  2018,  2019,  2020,  2021,  2022,
+     2023,  2024,  2025,  2026,  2027,  2029,  2014,  2025,  2030,  2024,
+     2031,  2032,  2015,  2030,  2033,  2035,  2032,  2036,  2037,  2038,
+
+     2041,  2039,  2036,  2039,  2041,  2042,  2043,  2044,  2045,  2046,
+     2038,  2047,  2046,  2048,  2050,  2051,  2052,  2053,  2054,  2055,
+     2056,  2057,  2059,  2058,  2060,  2061,  2062,  2064,  2065,  2066,
+     2057,  2068,  2069,  2070,  2071,  2053,  2072,  2055,  2058,  2073,
+     2074,  2075,  2076,  2077,  2078,  2080,  2068,  2082,  2083,  2084,
+     2086,  2087,  2088,  2089,  2078,  2090,  2091,  2092,  2093,  2094,
+     2095,  2096,  2097,  2098,  2099,  2100,  2101,  2102,  2103,  2104,
+     2105,  2107,  2108,  2109,  2110,  2105,  2097,  2111,  2112,  2113,
+     2114,  2115,  2107,  2116,  2119,  2099,  2121,  2122,  2123,  2125,
+     2116,  2126,  2127,  2128,  2129,  2130,  2130,  2122,  2125,  2131,
+
+     2132,  2134,  2114,  2135,  2132,  2137,  2139,  2128,  2138,  2138,
+     2140,  2141,  2142,  2143,  2140,  2144,  2145,  2146,  2147,  2137,
+     2148,  2149,  2150,  2151,  2152,  2153,  2154,  2156,  2157,  2158,
+     2159,  2160,  2161,  2162,  2141,  2163,  2152,  2160,  2164,  2154,
+     2166,  2167,  2168,  2163,  2169,  2170,  2171,  2173,  2175,  2176,
+     2177,  2178,  2179,  2180,  2182,  2183,  2184,  2185,  2186,  2187,
+     2188,  2189,  2190,  2183,  2191,  2192,  2193,  2194,  2195,  2197,
+     2196,  2198,  2179,  2196,  2199,  2201,  2198,  2202,  2203,  2204,
+     2205,  2207,  2206,  2208,  2209,  2210,  2199,  2206,  2211,  2213,
+     2212,  2214,  2215,  2216,  2217,  2218,  2219,  2205,  2212,  2221,
+
+     2222,  2223,  2224,  2222,  2225,  2226,  2227,  2228,  2229,  2225,
+     2231,  2232,  2233,  2235,  2236,  2237,  2238,  2239,  2240,  2241,
+     2242,  2224,  2243,  2241,  2244,  2245,  2246,  2248,  2249,  2250,
+     2251,  2252,  2253,  2254,  2260,  2258,  2261,  2242,  2262,  2263,
+     2266,  2260,  2264,  2267,  2265,  2268,  2254,  2258,  2258,  2264,
+     2265,  2269,  2270,  2272,  2273,  2274,  2275,  2276,  2277,  2278,
+     2279,  2266,  2280,  2281,  2282,  2276,  2275,  2283,  2284,  2285,
+     2286,  2287,  2288,  2284,  2289,  2292,  2293,  2294,  2295,  2296,
+     2288,  2297,  2298,  2299,  2300,  2301,  2302,  2303,  2304,  2305,
+     2298,  2294,  2297,  2307,  2308,  2309,  2310,  2312,  2313,  2314,
+
+     2315,  2316,  2294,  2317,  2314,  2318,  2319,  2320,  2321,  2322,
+     2315,  2323,  2318,  2324,  2325,  2326,  2327,  2328,  2329,  2330,
+     2331,  2332,  2326,  2333,  2335,  2336,  2321,  2337,  2338,  2339,
+     2331,  2340,  2341,  2342,  2343,  2345,  2347,  2348,  2335,  2349,
+     2349,  2341,  2350,  2329,  2351,  2352,  2353,  2353,  2354,  2355,
+     2350,  2356,  2348,  2357,  2339,  2358,  2359,  2360,  2361,  2362,
+     2363,  2364,  2365,  2366,  2367,  2368,  2366,  2369,  2371,  2358,
+     2372,  2373,  2374,  2375,  2376,  2377,  2378,  2379,  2372,  2380,
+     2380,  2381,  2382,  2383,  2384,  2385,  2386,  2387,  2388,  2389,
+     2390,  2392,  2388,  2387,  2393,  2394,  2395,  2396,  2397,  2398,
+
+     2399,  2400,  2401,  2402,  2403,  2404,  2399,  2405,  2407,  2408,
+     2409,  2410,  2412,  2413,  2414,  2416,  2396,  2401,  2415,  2417,
+     2405,  2418,  2419,  2420,  2422,  2423,  2424,  2425,  2426,  2427,
+     2428,  2413,  2429,  2430,  2415,  2431,  2432,  2424,  2433,  2435,
+     2436,  2437,  2438,  2428,  2439,  2440,  2430,  2441,  2442,  2443,
+     2444,  2442,  2446,  2433,  2447,  2433,  2448,  2449,  2450,  2429,
+     2451,  2441,  2452,  2453,  2454,  2455,  2456,  2457,  2458,  2459,
+     2460,  2461,  2462,  2459,  2463,  2464,  2440,  2465,  2466,  2467,
+     2468,  2469,  2470,  2471,  2472,  2473,  2474,  2477,  2479,  2475,
+     2480,  2481,  2482,  2483,  2484,  2485,  2486,  2472,  2465,  2475,
+
+     2482,  2487,  2488,  2490,  2491,  2492,  2488,  2493,  2488,  2494,
+     2495,  2498,  2497,  2499,  2490,  2497,  2500,  2502,  2503,  2504,
+     2505,  2506,  2507,  2509,  2510,  2495,  2511,  2512,  2513,  2514,
+     2515,  2516,  2517,  2518,  2519,  2520,  2521,  2522,  2523,  2524,
+     2526,  2527,  2528,  2526,  2529,  2530,  2531,  2532,  2533,  2534,
+     2535,  2537,  2538,  2535,  2539,  2540,  2541,  2542,  2543,  2544,
+     2520,  2545,  2546,  2547,  2545,  2548,  2549,  2550,  2552,  2553,
+     2554,  2555,  2556,  2557,  2558,  2546,  2560,  2558,  2562,  2563,
+     2564,  2565,  2553,  2566,  2567,  2570,  2556,  2550,  2571,  2572,
+     2573,  2574,  2576,  2578,  2580,  2582,  2583,  2586,  2587,  2588,
+
+     2589,  2590,  2591,  2592,  2594,  2595,  2597,  2598,  2566,  2599,
+     2600,  2601,  2576,  2600,  2603,  2604,  2605,  2606,  2608,  2610,
+     2611,  2612,  2613,  2615,  2616,  2617,  2618,  2620,  2603,  2621,
+     2622,  2623,  2624,  2625,  2626,  2613,  2627,  2628,  2629,  2630,
+     2631,  2632,  2633,  2627,  2634,  2632,  2635,  2636,  2637,  2638,
+     2639,  2640,  2641,  2642,  2643,  2644,  2645,  2646,  2647,  2648,
+     2649,  2650,  2651,  2652,  2653,  2654,  2655,  2657,  2656,  2649,
+     2658,  2659,  2660,  2661,  2663,  2664,  2665,  2666,  2660,  2651,
+     2656,  2667,  2668,  2669,  2670,  2671,  2672,  2673,  2674,  2675,
+     2676,  2677,  2678,  2679,  2674,  2680,  2681,  2682,  2673,  2683,
+
+     2684,  2685,  2686,  2687,  2676,  2688,  2681,  2690,  2691,  2692,
+     2693,  2694,  2695,  2682,  2696,  2697,  2677,  2698,  2693,  2699,
+     2700,  2702,  2704,  2705,  2694,  2706,  2706,  2707,  2708,  2710,
+     2711,  2712,  2713,  2714,  2715,  2716,  2717,  2718,  2719,  2720,
+     2722,  2723,  2724,  2725,  2726,  2728,  2729,  2730,  2731,  2732,
+     2733,  2732,  2734,  2735,  2736,  2737,  2738,  2739,  2740,  2741,
+     2736,  2742,  2742,  2743,  2744,  2745,  2746,  2747,  2748,  2749,
+     2750,  2751,  2745,  2752,  2753,  2754,  2755,  2756,  2757,  2758,
+     2759,  2761,  2762,  2748,  2764,  2765,  2767,  2766,  2752,  2766,
+     2768,  2769,  2770,  2771,  2773,  2775,  2776,  2777,  2778,  2779,
+
+     2775,  2780,  2781,  2782,  2783,  2784,  2786,  2787,  2788,  2789,
+     2791,  2792,  2793,  2794,  2796,  2782,  2797,  2798,  2799,  2800,
+     2801,  2784,  2802,  2803,  2804,  2805,  2806,  2807,  2808,  2814,
+     2815,  2816,  2817,  2815,  2818,  2819,  2820,  2814,  2821,  2805,
+     2822,  2823,  2824,  2825,  2827,  2830,  2831,  2832,  2833,  2834,
+     2834,  2835,  2836,  2837,  2838,  2839,  2840,  2842,  2841,  2843,
+     2844,  2846,  2847,  2848,  2849,  2850,  2851,  2852,  2852,  2832,
+     2841,  2853,  2854,  2855,  2856,  2857,  2858,  2859,  2860,  2861,
+     2862,  2863,  2860,  2864,  2858,  2865,  2866,  2867,  2868,  2869,
+     2872,  2873,  2872,  2865,  2874,  2875,  2876,  2877,  2878,  2862,
+
+     2875,  2879,  2880,  2881,  2882,  2883,  2884,  2885,  2886,  2887,
+     2888,  2889,  2891,  2892,  2893,  2895,  2897,  2898,  2899,  2900,
+     2885,  2901,  2902,  2903,  2904,  2907,  2908,  2909,  2912,  2913,
+     2914,  2915,  2916,  2917,  2918,  2919,  2920,  2913,  2921,  2909,
+     2922,  2915,  2912,  2923,  2925,  2927,  2929,  2930,  2931,  2932,
+     2933,  2934,  2935,  2936,  2938,  2939,  2940,  2942,  2939,  2943,
+     2945,  2946,  2947,  2948,  2949,  2951,  2952,  2953,  2954,  2956,
+     2946,  2957,  2948,  2958,  2959,  2961,  2963,  2964,  2965,  2966,
+     2967,  2969,  2970,  2972,  2966,  2973,  2974,  2975,  2976,  2978,
+     2979,  2965,  2980,  2982,  2983,  2984,  2985,  2986,  2987,  2989,
+
+     2990,  2991,  2992,  2992,  2993,  2994,  2995,  2996,  2997,  2998,
+     2999,  3000,  3003,  3004,  3005,  3006,  3008,  3009,  3010,  3011,
+     3012,  3013,  3009,  3014,  3015,  3016,  3017,  3013,  3018,  3021,
+     2998,  3023,  3003,  3024,  3026,  3027,  3028,  3029,  3029,  3030,
+     3031,  3032,  3010,  3024,  3033,  3034,  3035,  3036,  3037,  3038,
+     3039,  3040,  3041,  3042,  3043,  3036,  3040,  3041,  3044,  3045,
+     3046,  3047,  3048,  3049,  3050,  3048,  3051,  3052,  3053,  3054,
+     3055,  3056,  3057,  3058,  3060,  3061,  3062,  3063,  3064,  3066,
+     3067,  3055,  3068,  3069,  3067,  3071,  3072,  3051,  3073,  3074,
+     3075,  3077,  3078,  3079,  3080,  3081,  3082,  3083,  3084,  3086,
+
+     3083,  3085,  3084,  3087,  3080,  3086,  3085,  3088,  3092,  3093,
+     3094,  3096,  3097,  3098,  3099,  3101,  3102,  3103,  3098,  3106,
+     3107,  3108,  3111,  3112,  3103,  3113,  3114,  3116,  3112,  3119,
+     3120,  3121,  3122,  3124,  3125,  3127,  3126,  3129,  3130,  3131,
+     3132,  3133,  3134,  3111,  3126,  3135,  3137,  3138,  3135,  3139,
+     3140,  3141,  3142,  3143,  3122,  3144,  3146,  3147,  3148,  3149,
+     3150,  3151,  3152,  3153,  3154,  3155,  3156,  3157,  3143,  3159,
+     3160,  3161,  3162,  3163,  3164,  3165,  3167,  3169,  3171,  3172,
+     3173,  3174,  3175,  3176,  3177,  3159,  3178,  3179,  3180,  3181,
+     3164,  3182,  3183,  3175,  3184,  3187,  3189,  3190,  3192,  3194,
+
+     3196,  3177,  3197,  3198,  3199,  3200,  3201,  3203,  3204,  3205,
+     3206,  3207,  3208,  3207,  3210,  3211,  3212,  3213,  3182,  3217,
+     3218,  3219,  3222,  3221,  3211,  3221,  3223,  3224,  3225,  3224,
+     3226,  3227,  3228,  3229,  3230,  3232,  3227,  3234,  3235,  3236,
+     3237,  3238,  3239,  3241,  3242,  3243,  3244,  3228,  3245,  3246,
+     3226,  3250,  3251,  3237,  3253,  3254,  3255,  3256,  3257,  3259,
+     3260,  3261,  3262,  3243,  3263,  3264,  3264,  3257,  3265,  3267,
+     3268,  3269,  3270,  3271,  3272,  3273,  3273,  3274,  3276,  3277,
+     3278,  3270,  3279,  3280,  3281,  3282,  3283,  3284,  3285,  3286,
+     3287,  3269,  3289,  3290,  3293,  3295,  3296,  3279,  3297,  3298,
+
+     3299,  3302,  3285,  3300,  3303,  3304,  3305,  3306,  3295,  3307,
+     3300,  3308,  3309,  3311,  3312,  3313,  3314,  3317,  3318,  3320,
+     3317,  3321,  3306,  3322,  3324,  3325,  3326,  3327,  3328,  3329,
+     3330,  3328,  3333,  3334,  3335,  3336,  3337,  3333,  3338,  3339,
+     3327,  3340,  3342,  3343,  3344,  3345,  3347,  3347,  3340,  3348,
+     3349,  3349,  3350,  3351,  3353,  3348,  3354,  3355,  3356,  3358,
+     3359,  3360,  3363,  3364,  3359,  3365,  3369,  3370,  3371,  3372,
+     3374,  3375,  3376,  3376,  3378,  3360,  3377,  3377,  3379,  3379,
+     3381,  3383,  3384,  3385,  3386,  3387,  3384,  3390,  3391,  3376,
+     3392,  3387,  3393,  3394,  3397,  3398,  3399,  3401,  3402,  3403,
+
+     3403,  3405,  3406,  3407,  3408,  3409,  3410,  3411,  3412,  3399,
+     3413,  3397,  3414,  3410,  3415,  3416,  3417,  3415,  3418,  3419,
+     3416,  3420,  3421,  3420,  3422,  3423,  3417,  3424,  3425,  3426,
+     3427,  3428,  3429,  3430,  3433,  3435,  3426,  3436,  3438,  3440,
+     3441,  3442,  3443,  3445,  3446,  3423,  3447,  3448,  3449,  3451,
+     3452,  3453,  3455,  3454,  3457,  3458,  3459,  3455,  3459,  3460,
+     3461,  3462,  3463,  3464,  3465,  3449,  3454,  3467,  3468,  3462,
+     3469,  3472,  3473,  3474,  3473,  3475,  3476,  3478,  3479,  3480,
+     3481,  3482,  3483,  3484,  3472,  3486,  3487,  3490,  3486,  3491,
+     3494,  3495,  3490,  3504,  3480,  3505,  3507,  3508,  3509,  3511,
+
+     3484,  3512,  3514,  3515,  3516,  3517,  3519,  3520,  3522,  3523,
+     3524,  3525,  3526,  3523,  3527,  3528,  3514,  3529,  3530,  3531,
+     3532,  3525,  3533,  3534,  3535,  3536,  3517,  3537,  3538,  3540,
+     3535,  3541,  3542,  3547,  3548,  3549,  3550,  3551,  3552,  3553,
+     3554,  3555,  3532,  3556,  3557,  3558,  3559,  3560,  3561,  3562,
+     3563,  3564,  3565,  3566,  3537,  3567,  3568,  3569,  3571,  3572,
+     3563,  3573,  3574,  3576,  3577,  3579,  3582,  3579,  3583,  3584,
+     3584,  3585,  3586,  3587,  3588,  3589,  3590,  3591,  3592,  3594,
+     3597,  3598,  3600,  3601,  3602,  3604,  3605,  3602,  3606,  3589,
+     3607,  3608,  3609,  3610,  3611,  3612,  3615,  3616,  3617,  3618,
+
+     3619,  3620,  3597,  3621,  3622,  3623,  3624,  3625,  3626,  3627,
+     3629,  3630,  3631,  3632,  3634,  3635,  3636,  3637,  3638,  3639,
+     3640,  3641,  3643,  3646,  3647,  3648,  3649,  3647,  3650,  3636,
+     3651,  3652,  3653,  3654,  3656,  3647,  3657,  3658,  3659,  3660,
+     3661,  3662,  3663,  3664,  3665,  3666,  3667,  3656,  3666,  3668,
+     3669,  3670,  3671,  3672,  3674,  3675,  3677,  3678,  3679,  3680,
+     3681,  3683,  3684,  3685,  3686,  3687,  3688,  3690,  3691,  3692,
+     3694,  3697,  3698,  3699,  3700,  3701,     0,  3704,  3704,  3704,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704,
+     3704,  3704,  3704,  3704,  3704,  3704,  3704,  3704
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -3250,7 +3020,7 @@ static void config_end_include(void)
         }
 #endif
 
-#line 3251 "<stdout>"
+#line 3021 "<stdout>"
 #define YY_NO_INPUT 1
 #line 191 "./util/configlexer.lex"
 #ifndef YY_NO_UNPUT
@@ -3259,9 +3029,9 @@ static void config_end_include(void)
 #ifndef YY_NO_INPUT
 #define YY_NO_INPUT 1
 #endif
-#line 3260 "<stdout>"
+#line 3030 "<stdout>"
 
-#line 3262 "<stdout>"
+#line 3032 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -3485,7 +3255,7 @@ YY_DECL
 	{
 #line 211 "./util/configlexer.lex"
 
-#line 3486 "<stdout>"
+#line 3256 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -3518,13 +3288,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 3439 )
+				if ( yy_current_state >= 3705 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 6714 );
+		while ( yy_base[yy_current_state] != 5278 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -3654,47 +3424,47 @@ YY_RULE_SETUP
 case 21:
 YY_RULE_SETUP
 #line 235 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_MSS) }
+{ YDVAR(1, VAR_TCP_UPSTREAM_POOL) }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 236 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_TCP_MSS) }
+{ YDVAR(1, VAR_TCP_MSS) }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 237 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_IDLE_TIMEOUT) }
+{ YDVAR(1, VAR_OUTGOING_TCP_MSS) }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 238 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_REUSE_TCP_QUERIES) }
+{ YDVAR(1, VAR_TCP_IDLE_TIMEOUT) }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 239 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_REUSE_TIMEOUT) }
+{ YDVAR(1, VAR_MAX_REUSE_TCP_QUERIES) }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 240 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_AUTH_QUERY_TIMEOUT) }
+{ YDVAR(1, VAR_TCP_REUSE_TIMEOUT) }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 241 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_TCP_KEEPALIVE) }
+{ YDVAR(1, VAR_TCP_AUTH_QUERY_TIMEOUT) }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 242 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_TCP_KEEPALIVE_TIMEOUT) }
+{ YDVAR(1, VAR_EDNS_TCP_KEEPALIVE) }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 243 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_EDNS_TCP_KEEPALIVE_TIMEOUT) }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
@@ -3704,7 +3474,7 @@ YY_RULE_SETUP
 case 31:
 YY_RULE_SETUP
 #line 245 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
+{ YDVAR(1, VAR_SSL_UPSTREAM) }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
@@ -3714,7 +3484,7 @@ YY_RULE_SETUP
 case 33:
 YY_RULE_SETUP
 #line 247 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
+{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
@@ -3724,7 +3494,7 @@ YY_RULE_SETUP
 case 35:
 YY_RULE_SETUP
 #line 249 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_PORT) }
+{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
@@ -3734,7 +3504,7 @@ YY_RULE_SETUP
 case 37:
 YY_RULE_SETUP
 #line 251 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_CERT_BUNDLE) }
+{ YDVAR(1, VAR_SSL_PORT) }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
@@ -3744,12 +3514,12 @@ YY_RULE_SETUP
 case 39:
 YY_RULE_SETUP
 #line 253 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_WIN_CERT) }
+{ YDVAR(1, VAR_TLS_CERT_BUNDLE) }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 254 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_ADDITIONAL_PORT) }
+{ YDVAR(1, VAR_TLS_WIN_CERT) }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
@@ -3769,1429 +3539,1559 @@ YY_RULE_SETUP
 case 44:
 YY_RULE_SETUP
 #line 258 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_SESSION_TICKET_KEYS) }
+{ YDVAR(1, VAR_TLS_ADDITIONAL_PORT) }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 259 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_CIPHERS) }
+{ YDVAR(1, VAR_TLS_SESSION_TICKET_KEYS) }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 260 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_CIPHERSUITES) }
+{ YDVAR(1, VAR_TLS_CIPHERS) }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 261 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_USE_SNI) }
+{ YDVAR(1, VAR_TLS_CIPHERSUITES) }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 262 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTPS_PORT) }
+{ YDVAR(1, VAR_TLS_USE_SNI) }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 263 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_ENDPOINT) }
+{ YDVAR(1, VAR_TLS_UPSTREAM_RESUME) }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 264 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_MAX_STREAMS) }
+{ YDVAR(1, VAR_TLS_UPSTREAM_EARLY_DATA) }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 265 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_QUERY_BUFFER_SIZE) }
+{ YDVAR(1, VAR_TLS_USE_KTLS) }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 266 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_RESPONSE_BUFFER_SIZE) }
+{ YDVAR(1, VAR_HTTPS_PORT) }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 267 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_NODELAY) }
+{ YDVAR(1, VAR_HTTP_ENDPOINT) }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 268 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_NOTLS_DOWNSTREAM) }
+{ YDVAR(1, VAR_HTTP_MAX_STREAMS) }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 269 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSTEMD) }
+{ YDVAR(1, VAR_HTTP_QUERY_BUFFER_SIZE) }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 270 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_DAEMONIZE) }
+{ YDVAR(1, VAR_HTTP_RESPONSE_BUFFER_SIZE) }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 271 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_HTTP_NODELAY) }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 272 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_HTTP_NOTLS_DOWNSTREAM) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 273 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
+{ YDVAR(1, VAR_USE_SYSTEMD) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 274 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
+{ YDVAR(1, VAR_DO_DAEMONIZE) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 275 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_RCVBUF) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 276 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_SNDBUF) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 277 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_REUSEPORT) }
+{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 278 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_TRANSPARENT) }
+{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 279 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_FREEBIND) }
+{ YDVAR(1, VAR_SO_RCVBUF) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 280 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_DSCP) }
+{ YDVAR(1, VAR_SO_SNDBUF) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 281 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CHROOT) }
+{ YDVAR(1, VAR_SO_REUSEPORT) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 282 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USERNAME) }
+{ YDVAR(1, VAR_WORKER_CPU_AFFINITY) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 283 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DIRECTORY) }
+{ YDVAR(1, VAR_NUMA_AWARE) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOGFILE) }
+{ YDVAR(1, VAR_IP_TRANSPARENT) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PIDFILE) }
+{ YDVAR(1, VAR_IP_FREEBIND) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_HINTS) }
+{ YDVAR(1, VAR_IP_DSCP) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STREAM_WAIT_SIZE) }
+{ YDVAR(1, VAR_CHROOT) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
+{ YDVAR(1, VAR_USERNAME) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
+{ YDVAR(1, VAR_DIRECTORY) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
+{ YDVAR(1, VAR_LOGFILE) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
+{ YDVAR(1, VAR_PIDFILE) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
+{ YDVAR(1, VAR_CACHE_SNAPSHOT_FILE) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
+{ YDVAR(1, VAR_ROOT_HINTS) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_TTL) }
+{ YDVAR(1, VAR_STREAM_WAIT_SIZE) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
+{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MIN_TTL) }
+{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_HOST_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_LAME_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
+{ YDVAR(1, VAR_MSG_CACHE_POLICY) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
+{ YDVAR(1, VAR_MSG_CACHE_WIRE_IMAGE) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 301 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
+{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 302 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
+{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 303 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_KEEP_PROBING) }
+{ YDVAR(1, VAR_RRSET_CACHE_POLICY) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_CACHE_MAX_TTL) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_CACHE_MIN_TTL) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 307 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UDP_CONNECT) }
+{ YDVAR(1, VAR_INFRA_HOST_TTL) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 308 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_INFRA_LAME_TTL) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_INFRA_CACHE_POLICY) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 312 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 314 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_INFRA_KEEP_PROBING) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_INFRA_SELECT_PERCENTILE) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_UDP_HEDGE) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_UDP_HEDGE_PERCENTILE) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 318 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_UDP_HEDGE_MAX_RATE) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 319 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_UDP_CONNECT) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_UDP_BATCH_SIZE) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DENY_ANY) }
+{ YDVAR(1, VAR_UDP_UPSTREAM_BATCH) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_UDP_CONNECT_POOL) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_UDP_CONNECT_REUSE) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_USE_IO_URING) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 328 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 329 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 330 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 331 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_NO_CACHE) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 332 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 333 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 334 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 335 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 336 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 337 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 338 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_NO_CACHE) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 339 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 340 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 341 "./util/configlexer.lex"
-{ YDVAR(0, VAR_AUTH_ZONE) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 342 "./util/configlexer.lex"
-{ YDVAR(0, VAR_RPZ) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 343 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TAGS) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 344 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_ACTION_OVERRIDE) }
+{ YDVAR(1, VAR_SHARED_INFLIGHT) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 345 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_CNAME_OVERRIDE) }
+{ YDVAR(2, VAR_PRIORITY_CLASS) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 346 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_LOG) }
+{ YDVAR(1, VAR_DENY_ANY) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 347 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_LOG_NAME) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 348 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ZONEFILE) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 349 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MASTER) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 350 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MASTER) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 351 "./util/configlexer.lex"
-{ YDVAR(1, VAR_URL) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 352 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ALLOW_NOTIFY) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 353 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
+{ YDVAR(1, VAR_STUB_NO_CACHE) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 354 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 355 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FALLBACK_ENABLED) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 356 "./util/configlexer.lex"
-{ YDVAR(0, VAR_VIEW) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 357 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VIEW_FIRST) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 358 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 359 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 360 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_FORWARD_NO_CACHE) }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 361 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 362 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 363 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
+{ YDVAR(0, VAR_AUTH_ZONE) }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 364 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
+{ YDVAR(0, VAR_RPZ) }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 365 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_TAGS) }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 366 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
+{ YDVAR(1, VAR_RPZ_ACTION_OVERRIDE) }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 367 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_RPZ_CNAME_OVERRIDE) }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 368 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV6) }
+{ YDVAR(1, VAR_RPZ_LOG) }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 369 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV4) }
+{ YDVAR(1, VAR_RPZ_LOG_NAME) }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 370 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV6) }
+{ YDVAR(1, VAR_ZONEFILE) }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 371 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_MASTER) }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 372 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_MASTER) }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 373 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
+{ YDVAR(1, VAR_URL) }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 374 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_ALLOW_NOTIFY) }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 375 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 376 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_FOR_UPSTREAM) }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 377 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_FALLBACK_ENABLED) }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 378 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(0, VAR_VIEW) }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 379 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_VIEW_FIRST) }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 380 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 381 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 382 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 383 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
+{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 384 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_KEY_SENTINEL) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 385 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 386 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 387 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 388 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 389 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
 #line 390 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 391 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
+{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV4) }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 392 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV6) }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 393 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 394 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_TTL) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 395 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_TTL_RESET) }
+{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 396 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_REPLY_TTL) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 397 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_CLIENT_TIMEOUT) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 398 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_ORIGINAL_TTL) }
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 399 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_DSA) }
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 400 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_SHA1) }
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 401 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 402 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 403 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
 #line 404 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 405 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
-#line 407 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ZONEMD_PERMISSIVE_MODE) }
+#line 406 "./util/configlexer.lex"
+{ YDVAR(1, VAR_ROOT_KEY_SENTINEL) }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
-#line 408 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ZONEMD_REJECT_ABSENCE) }
+#line 407 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
-#line 409 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 408 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
-#line 410 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 409 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
-#line 411 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 410 "./util/configlexer.lex"
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
-#line 412 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
+#line 411 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
-#line 413 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 412 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
-#line 414 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_IDENTITY) }
+#line 413 "./util/configlexer.lex"
+{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
-#line 415 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+#line 414 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
-#line 416 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+#line 415 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
-#line 417 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_REPLIES) }
+#line 416 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED_TTL) }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
-#line 418 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TAG_QUERYREPLY) }
+#line 417 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED_TTL_RESET) }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
-#line 419 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_LOCAL_ACTIONS) }
+#line 418 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED_REPLY_TTL) }
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
-#line 420 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_SERVFAIL) }
+#line 419 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED_CLIENT_TIMEOUT) }
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
-#line 421 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+#line 420 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_ORIGINAL_TTL) }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
-#line 422 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+#line 421 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_DSA) }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
-#line 423 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+#line 422 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_SHA1) }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
-#line 424 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+#line 423 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
-#line 425 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
+#line 424 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_VERIFY_THREADS) }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
-#line 426 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+#line 425 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
-#line 427 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+#line 426 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
-#line 428 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+#line 427 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_POLICY) }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
-#line 429 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_ENABLE) }
+#line 428 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
-#line 430 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_KEY) }
+#line 429 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 431 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+{ YDVAR(1, VAR_ZONEMD_PERMISSIVE_MODE) }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 432 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+{ YDVAR(1, VAR_ZONEMD_REJECT_ABSENCE) }
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 433 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 434 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 435 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 436 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 437 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 438 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+{ YDVAR(1, VAR_LOG_IDENTITY) }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
 #line 439 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
 #line 440 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
 #line 441 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_LOG_REPLIES) }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
 #line 442 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DYNLIB_FILE) }
+{ YDVAR(1, VAR_LOG_TAG_QUERYREPLY) }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
 #line 443 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DYNLIB) }
+{ YDVAR(1, VAR_LOG_LOCAL_ACTIONS) }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
 #line 444 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_LOG_SERVFAIL) }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
 #line 445 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
 #line 446 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
 #line 447 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNKNOWN_SERVER_TIME_LIMIT) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
 #line 448 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
 #line 449 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_PREFIX) }
+{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
 #line 450 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
 #line 451 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_IGNORE_AAAA) }
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
 #line 452 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEFINE_TAG) }
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
 #line 453 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+{ YDVAR(1, VAR_SHM_ENABLE) }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
 #line 454 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+{ YDVAR(1, VAR_SHM_KEY) }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
 #line 455 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
 #line 456 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
 #line 457 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
 #line 458 "./util/configlexer.lex"
-{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+{ YDVAR(1, VAR_CONTROL_PORT) }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
 #line 459 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSTAP) }
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
 #line 460 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
 #line 461 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_BIDIRECTIONAL) }
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
 	YY_BREAK
 case 247:
 YY_RULE_SETUP
 #line 462 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
 #line 463 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IP) }
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
 #line 464 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_TLS) }
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
 #line 465 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_TLS_SERVER_NAME) }
+{ YDVAR(0, VAR_PYTHON) }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
 #line 466 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_TLS_CERT_BUNDLE) }
+{ YDVAR(1, VAR_DYNLIB_FILE) }
 	YY_BREAK
 case 252:
 YY_RULE_SETUP
 #line 467 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_TLS_CLIENT_KEY_FILE) }
+{ YDVAR(0, VAR_DYNLIB) }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
+#line 468 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+	YY_BREAK
+case 254:
+YY_RULE_SETUP
 #line 469 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+	YY_BREAK
+case 255:
+YY_RULE_SETUP
+#line 470 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+	YY_BREAK
+case 256:
+YY_RULE_SETUP
+#line 471 "./util/configlexer.lex"
+{ YDVAR(1, VAR_UNKNOWN_SERVER_TIME_LIMIT) }
+	YY_BREAK
+case 257:
+YY_RULE_SETUP
+#line 472 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+	YY_BREAK
+case 258:
+YY_RULE_SETUP
+#line 473 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_PREFIX) }
+	YY_BREAK
+case 259:
+YY_RULE_SETUP
+#line 474 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+	YY_BREAK
+case 260:
+YY_RULE_SETUP
+#line 475 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_IGNORE_AAAA) }
+	YY_BREAK
+case 261:
+YY_RULE_SETUP
+#line 476 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DEFINE_TAG) }
+	YY_BREAK
+case 262:
+YY_RULE_SETUP
+#line 477 "./util/configlexer.lex"
+{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+	YY_BREAK
+case 263:
+YY_RULE_SETUP
+#line 478 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+	YY_BREAK
+case 264:
+YY_RULE_SETUP
+#line 479 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+	YY_BREAK
+case 265:
+YY_RULE_SETUP
+#line 480 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+	YY_BREAK
+case 266:
+YY_RULE_SETUP
+#line 481 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+	YY_BREAK
+case 267:
+YY_RULE_SETUP
+#line 482 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_PRIORITY_CLASS) }
+	YY_BREAK
+case 268:
+YY_RULE_SETUP
+#line 483 "./util/configlexer.lex"
+{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+	YY_BREAK
+case 269:
+YY_RULE_SETUP
+#line 484 "./util/configlexer.lex"
+{ YDVAR(0, VAR_DNSTAP) }
+	YY_BREAK
+case 270:
+YY_RULE_SETUP
+#line 485 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+	YY_BREAK
+case 271:
+YY_RULE_SETUP
+#line 486 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_BIDIRECTIONAL) }
+	YY_BREAK
+case 272:
+YY_RULE_SETUP
+#line 487 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+	YY_BREAK
+case 273:
+YY_RULE_SETUP
+#line 488 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IP) }
+	YY_BREAK
+case 274:
+YY_RULE_SETUP
+#line 489 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_TLS) }
+	YY_BREAK
+case 275:
+YY_RULE_SETUP
+#line 490 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_TLS_SERVER_NAME) }
+	YY_BREAK
+case 276:
+YY_RULE_SETUP
+#line 491 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_TLS_CERT_BUNDLE) }
+	YY_BREAK
+case 277:
+YY_RULE_SETUP
+#line 492 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_TLS_CLIENT_KEY_FILE) }
+	YY_BREAK
+case 278:
+YY_RULE_SETUP
+#line 494 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_TLS_CLIENT_CERT_FILE) }
 	YY_BREAK
-case 254:
+case 279:
 YY_RULE_SETUP
-#line 471 "./util/configlexer.lex"
+#line 496 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
 	YY_BREAK
-case 255:
+case 280:
 YY_RULE_SETUP
-#line 472 "./util/configlexer.lex"
+#line 497 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
 	YY_BREAK
-case 256:
+case 281:
 YY_RULE_SETUP
-#line 473 "./util/configlexer.lex"
+#line 498 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_IDENTITY) }
 	YY_BREAK
-case 257:
+case 282:
 YY_RULE_SETUP
-#line 474 "./util/configlexer.lex"
+#line 499 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSTAP_VERSION) }
 	YY_BREAK
-case 258:
+case 283:
 YY_RULE_SETUP
-#line 475 "./util/configlexer.lex"
+#line 500 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
 	YY_BREAK
-case 259:
+case 284:
 YY_RULE_SETUP
-#line 477 "./util/configlexer.lex"
+#line 502 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 260:
+case 285:
 YY_RULE_SETUP
-#line 479 "./util/configlexer.lex"
+#line 504 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
-case 261:
+case 286:
 YY_RULE_SETUP
-#line 481 "./util/configlexer.lex"
+#line 506 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 262:
+case 287:
 YY_RULE_SETUP
-#line 483 "./util/configlexer.lex"
+#line 508 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
-case 263:
+case 288:
 YY_RULE_SETUP
-#line 485 "./util/configlexer.lex"
+#line 510 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 264:
+case 289:
 YY_RULE_SETUP
-#line 487 "./util/configlexer.lex"
+#line 512 "./util/configlexer.lex"
 { YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
 	YY_BREAK
-case 265:
+case 290:
 YY_RULE_SETUP
-#line 488 "./util/configlexer.lex"
+#line 513 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT) }
 	YY_BREAK
-case 266:
+case 291:
 YY_RULE_SETUP
-#line 489 "./util/configlexer.lex"
+#line 514 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
-case 267:
+case 292:
 YY_RULE_SETUP
-#line 490 "./util/configlexer.lex"
+#line 515 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
 	YY_BREAK
-case 268:
+case 293:
 YY_RULE_SETUP
-#line 491 "./util/configlexer.lex"
+#line 516 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
-case 269:
+case 294:
 YY_RULE_SETUP
-#line 492 "./util/configlexer.lex"
+#line 517 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
 	YY_BREAK
-case 270:
+case 295:
 YY_RULE_SETUP
-#line 493 "./util/configlexer.lex"
+#line 518 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
-case 271:
+case 296:
 YY_RULE_SETUP
-#line 494 "./util/configlexer.lex"
+#line 519 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
-case 272:
+case 297:
 YY_RULE_SETUP
-#line 495 "./util/configlexer.lex"
+#line 520 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
-case 273:
+case 298:
 YY_RULE_SETUP
-#line 496 "./util/configlexer.lex"
+#line 521 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 274:
+case 299:
 YY_RULE_SETUP
-#line 497 "./util/configlexer.lex"
+#line 522 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 275:
+case 300:
 YY_RULE_SETUP
-#line 498 "./util/configlexer.lex"
+#line 523 "./util/configlexer.lex"
 { YDVAR(1, VAR_LOW_RTT) }
 	YY_BREAK
-case 276:
+case 301:
 YY_RULE_SETUP
-#line 499 "./util/configlexer.lex"
+#line 524 "./util/configlexer.lex"
 { YDVAR(1, VAR_FAST_SERVER_NUM) }
 	YY_BREAK
-case 277:
+case 302:
 YY_RULE_SETUP
-#line 500 "./util/configlexer.lex"
+#line 525 "./util/configlexer.lex"
 { YDVAR(1, VAR_FAST_SERVER_PERMIL) }
 	YY_BREAK
-case 278:
+case 303:
 YY_RULE_SETUP
-#line 501 "./util/configlexer.lex"
+#line 526 "./util/configlexer.lex"
 { YDVAR(1, VAR_FAST_SERVER_PERMIL) }
 	YY_BREAK
-case 279:
+case 304:
 YY_RULE_SETUP
-#line 502 "./util/configlexer.lex"
+#line 527 "./util/configlexer.lex"
 { YDVAR(1, VAR_FAST_SERVER_PERMIL) }
 	YY_BREAK
-case 280:
+case 305:
 YY_RULE_SETUP
-#line 503 "./util/configlexer.lex"
+#line 528 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_TAG) }
 	YY_BREAK
-case 281:
+case 306:
 YY_RULE_SETUP
-#line 504 "./util/configlexer.lex"
+#line 529 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP) }
 	YY_BREAK
-case 282:
+case 307:
 YY_RULE_SETUP
-#line 505 "./util/configlexer.lex"
+#line 530 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_DATA) }
 	YY_BREAK
-case 283:
+case 308:
 YY_RULE_SETUP
-#line 506 "./util/configlexer.lex"
+#line 531 "./util/configlexer.lex"
 { YDVAR(0, VAR_DNSCRYPT) }
 	YY_BREAK
-case 284:
+case 309:
 YY_RULE_SETUP
-#line 507 "./util/configlexer.lex"
+#line 532 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_ENABLE) }
 	YY_BREAK
-case 285:
+case 310:
 YY_RULE_SETUP
-#line 508 "./util/configlexer.lex"
+#line 533 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PORT) }
 	YY_BREAK
-case 286:
+case 311:
 YY_RULE_SETUP
-#line 509 "./util/configlexer.lex"
+#line 534 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
 	YY_BREAK
-case 287:
+case 312:
 YY_RULE_SETUP
-#line 510 "./util/configlexer.lex"
+#line 535 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
 	YY_BREAK
-case 288:
+case 313:
 YY_RULE_SETUP
-#line 511 "./util/configlexer.lex"
+#line 536 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
 	YY_BREAK
-case 289:
+case 314:
 YY_RULE_SETUP
-#line 512 "./util/configlexer.lex"
+#line 537 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT_ROTATED) }
 	YY_BREAK
-case 290:
+case 315:
 YY_RULE_SETUP
-#line 513 "./util/configlexer.lex"
+#line 538 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE) }
 	YY_BREAK
-case 291:
+case 316:
 YY_RULE_SETUP
-#line 515 "./util/configlexer.lex"
+#line 540 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS) }
 	YY_BREAK
-case 292:
+case 317:
 YY_RULE_SETUP
-#line 517 "./util/configlexer.lex"
+#line 542 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SIZE) }
 	YY_BREAK
-case 293:
+case 318:
 YY_RULE_SETUP
-#line 518 "./util/configlexer.lex"
+#line 543 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SLABS) }
 	YY_BREAK
-case 294:
+case 319:
 YY_RULE_SETUP
-#line 519 "./util/configlexer.lex"
+#line 544 "./util/configlexer.lex"
 { YDVAR(1, VAR_PAD_RESPONSES) }
 	YY_BREAK
-case 295:
+case 320:
 YY_RULE_SETUP
-#line 520 "./util/configlexer.lex"
+#line 545 "./util/configlexer.lex"
 { YDVAR(1, VAR_PAD_RESPONSES_BLOCK_SIZE) }
 	YY_BREAK
-case 296:
+case 321:
 YY_RULE_SETUP
-#line 521 "./util/configlexer.lex"
+#line 546 "./util/configlexer.lex"
 { YDVAR(1, VAR_PAD_QUERIES) }
 	YY_BREAK
-case 297:
+case 322:
 YY_RULE_SETUP
-#line 522 "./util/configlexer.lex"
+#line 547 "./util/configlexer.lex"
 { YDVAR(1, VAR_PAD_QUERIES_BLOCK_SIZE) }
 	YY_BREAK
-case 298:
+case 323:
 YY_RULE_SETUP
-#line 523 "./util/configlexer.lex"
+#line 548 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_ENABLED) }
 	YY_BREAK
-case 299:
+case 324:
 YY_RULE_SETUP
-#line 524 "./util/configlexer.lex"
+#line 549 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_IGNORE_BOGUS) }
 	YY_BREAK
-case 300:
+case 325:
 YY_RULE_SETUP
-#line 525 "./util/configlexer.lex"
+#line 550 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_HOOK) }
 	YY_BREAK
-case 301:
+case 326:
 YY_RULE_SETUP
-#line 526 "./util/configlexer.lex"
+#line 551 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_MAX_TTL) }
 	YY_BREAK
-case 302:
+case 327:
 YY_RULE_SETUP
-#line 527 "./util/configlexer.lex"
+#line 552 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_WHITELIST) }
 	YY_BREAK
-case 303:
+case 328:
 YY_RULE_SETUP
-#line 528 "./util/configlexer.lex"
+#line 553 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_WHITELIST) }
 	YY_BREAK
-case 304:
+case 329:
 YY_RULE_SETUP
-#line 529 "./util/configlexer.lex"
+#line 554 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_STRICT) }
 	YY_BREAK
-case 305:
+case 330:
 YY_RULE_SETUP
-#line 530 "./util/configlexer.lex"
+#line 555 "./util/configlexer.lex"
 { YDVAR(0, VAR_CACHEDB) }
 	YY_BREAK
-case 306:
+case 331:
 YY_RULE_SETUP
-#line 531 "./util/configlexer.lex"
+#line 556 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_BACKEND) }
 	YY_BREAK
-case 307:
+case 332:
 YY_RULE_SETUP
-#line 532 "./util/configlexer.lex"
+#line 557 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_SECRETSEED) }
 	YY_BREAK
-case 308:
+case 333:
 YY_RULE_SETUP
-#line 533 "./util/configlexer.lex"
+#line 558 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISHOST) }
 	YY_BREAK
-case 309:
+case 334:
 YY_RULE_SETUP
-#line 534 "./util/configlexer.lex"
+#line 559 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISPORT) }
 	YY_BREAK
-case 310:
+case 335:
 YY_RULE_SETUP
-#line 535 "./util/configlexer.lex"
+#line 560 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISTIMEOUT) }
 	YY_BREAK
-case 311:
+case 336:
 YY_RULE_SETUP
-#line 536 "./util/configlexer.lex"
+#line 561 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISEXPIRERECORDS) }
 	YY_BREAK
-case 312:
+case 337:
 YY_RULE_SETUP
-#line 537 "./util/configlexer.lex"
+#line 562 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_REDISASYNC) }
+	YY_BREAK
+case 338:
+YY_RULE_SETUP
+#line 563 "./util/configlexer.lex"
 { YDVAR(0, VAR_IPSET) }
 	YY_BREAK
-case 313:
+case 339:
 YY_RULE_SETUP
-#line 538 "./util/configlexer.lex"
+#line 564 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSET_NAME_V4) }
 	YY_BREAK
-case 314:
+case 340:
 YY_RULE_SETUP
-#line 539 "./util/configlexer.lex"
+#line 565 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSET_NAME_V6) }
 	YY_BREAK
-case 315:
+case 341:
 YY_RULE_SETUP
-#line 540 "./util/configlexer.lex"
+#line 566 "./util/configlexer.lex"
 { YDVAR(1, VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM) }
 	YY_BREAK
-case 316:
+case 342:
 YY_RULE_SETUP
-#line 541 "./util/configlexer.lex"
+#line 567 "./util/configlexer.lex"
 { YDVAR(2, VAR_TCP_CONNECTION_LIMIT) }
 	YY_BREAK
-case 317:
+case 343:
 YY_RULE_SETUP
-#line 542 "./util/configlexer.lex"
+#line 568 "./util/configlexer.lex"
 { YDVAR(2, VAR_EDNS_CLIENT_STRING) }
 	YY_BREAK
-case 318:
+case 344:
 YY_RULE_SETUP
-#line 543 "./util/configlexer.lex"
+#line 569 "./util/configlexer.lex"
 { YDVAR(1, VAR_EDNS_CLIENT_STRING_OPCODE) }
 	YY_BREAK
-case 319:
+case 345:
 YY_RULE_SETUP
-#line 544 "./util/configlexer.lex"
+#line 570 "./util/configlexer.lex"
 { YDVAR(1, VAR_NSID ) }
 	YY_BREAK
-case 320:
-/* rule 320 can match eol */
+case 346:
+/* rule 346 can match eol */
 YY_RULE_SETUP
-#line 545 "./util/configlexer.lex"
+#line 571 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
 /* Quoted strings. Strip leading and ending quotes */
-case 321:
+case 347:
 YY_RULE_SETUP
-#line 548 "./util/configlexer.lex"
+#line 574 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 549 "./util/configlexer.lex"
+#line 575 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 322:
+case 348:
 YY_RULE_SETUP
-#line 554 "./util/configlexer.lex"
+#line 580 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 323:
-/* rule 323 can match eol */
+case 349:
+/* rule 349 can match eol */
 YY_RULE_SETUP
-#line 555 "./util/configlexer.lex"
+#line 581 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 324:
+case 350:
 YY_RULE_SETUP
-#line 557 "./util/configlexer.lex"
+#line 583 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -5204,34 +5104,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 325:
+case 351:
 YY_RULE_SETUP
-#line 569 "./util/configlexer.lex"
+#line 595 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 570 "./util/configlexer.lex"
+#line 596 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 326:
+case 352:
 YY_RULE_SETUP
-#line 575 "./util/configlexer.lex"
+#line 601 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 327:
-/* rule 327 can match eol */
+case 353:
+/* rule 353 can match eol */
 YY_RULE_SETUP
-#line 576 "./util/configlexer.lex"
+#line 602 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 328:
+case 354:
 YY_RULE_SETUP
-#line 578 "./util/configlexer.lex"
+#line 604 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -5244,38 +5144,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 329:
+case 355:
 YY_RULE_SETUP
-#line 590 "./util/configlexer.lex"
+#line 616 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 592 "./util/configlexer.lex"
+#line 618 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 330:
+case 356:
 YY_RULE_SETUP
-#line 596 "./util/configlexer.lex"
+#line 622 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 331:
-/* rule 331 can match eol */
+case 357:
+/* rule 357 can match eol */
 YY_RULE_SETUP
-#line 597 "./util/configlexer.lex"
+#line 623 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 332:
+case 358:
 YY_RULE_SETUP
-#line 598 "./util/configlexer.lex"
+#line 624 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 333:
+case 359:
 YY_RULE_SETUP
-#line 599 "./util/configlexer.lex"
+#line 625 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext, 0);
@@ -5283,27 +5183,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 604 "./util/configlexer.lex"
+#line 630 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 334:
+case 360:
 YY_RULE_SETUP
-#line 608 "./util/configlexer.lex"
+#line 634 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 335:
-/* rule 335 can match eol */
+case 361:
+/* rule 361 can match eol */
 YY_RULE_SETUP
-#line 609 "./util/configlexer.lex"
+#line 635 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 336:
+case 362:
 YY_RULE_SETUP
-#line 611 "./util/configlexer.lex"
+#line 637 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -5313,7 +5213,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 617 "./util/configlexer.lex"
+#line 643 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -5328,39 +5228,39 @@ case YY_STATE_EOF(val):
 }
 	YY_BREAK
 /* include-toplevel: directive */
-case 337:
+case 363:
 YY_RULE_SETUP
-#line 631 "./util/configlexer.lex"
+#line 657 "./util/configlexer.lex"
 {
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include_toplevel);
 }
 	YY_BREAK
 case YY_STATE_EOF(include_toplevel):
-#line 634 "./util/configlexer.lex"
+#line 660 "./util/configlexer.lex"
 {
 	yyerror("EOF inside include_toplevel directive");
 	BEGIN(inc_prev);
 }
 	YY_BREAK
-case 338:
+case 364:
 YY_RULE_SETUP
-#line 638 "./util/configlexer.lex"
+#line 664 "./util/configlexer.lex"
 { LEXOUT(("ITSP ")); /* ignore */ }
 	YY_BREAK
-case 339:
-/* rule 339 can match eol */
+case 365:
+/* rule 365 can match eol */
 YY_RULE_SETUP
-#line 639 "./util/configlexer.lex"
+#line 665 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
-case 340:
+case 366:
 YY_RULE_SETUP
-#line 640 "./util/configlexer.lex"
+#line 666 "./util/configlexer.lex"
 { LEXOUT(("ITQS ")); BEGIN(include_toplevel_quoted); }
 	YY_BREAK
-case 341:
+case 367:
 YY_RULE_SETUP
-#line 641 "./util/configlexer.lex"
+#line 667 "./util/configlexer.lex"
 {
 	LEXOUT(("ITunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext, 1);
@@ -5369,29 +5269,29 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_toplevel_quoted):
-#line 647 "./util/configlexer.lex"
+#line 673 "./util/configlexer.lex"
 {
 	yyerror("EOF inside quoted string");
 	BEGIN(inc_prev);
 }
 	YY_BREAK
-case 342:
+case 368:
 YY_RULE_SETUP
-#line 651 "./util/configlexer.lex"
+#line 677 "./util/configlexer.lex"
 { LEXOUT(("ITSTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 343:
-/* rule 343 can match eol */
+case 369:
+/* rule 369 can match eol */
 YY_RULE_SETUP
-#line 652 "./util/configlexer.lex"
+#line 678 "./util/configlexer.lex"
 {
 	yyerror("newline before \" in include name");
 	cfg_parser->line++; BEGIN(inc_prev);
 }
 	YY_BREAK
-case 344:
+case 370:
 YY_RULE_SETUP
-#line 656 "./util/configlexer.lex"
+#line 682 "./util/configlexer.lex"
 {
 	LEXOUT(("ITQE "));
 	yytext[yyleng - 1] = '\0';
@@ -5400,33 +5300,33 @@ YY_RULE_SETUP
 	return (VAR_FORCE_TOPLEVEL);
 }
 	YY_BREAK
-case 345:
+case 371:
 YY_RULE_SETUP
-#line 664 "./util/configlexer.lex"
+#line 690 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 346:
+case 372:
 YY_RULE_SETUP
-#line 668 "./util/configlexer.lex"
+#line 694 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 347:
+case 373:
 YY_RULE_SETUP
-#line 672 "./util/configlexer.lex"
+#line 698 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 348:
+case 374:
 YY_RULE_SETUP
-#line 676 "./util/configlexer.lex"
+#line 702 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 5427 "<stdout>"
+#line 5327 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5721,7 +5621,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 3439 )
+			if ( yy_current_state >= 3705 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5749,11 +5649,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 3439 )
+		if ( yy_current_state >= 3705 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 3438);
+	yy_is_jam = (yy_current_state == 3704);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
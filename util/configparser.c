@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.6.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -45,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.6.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -119,679 +119,7 @@ extern struct config_parser_state* cfg_parser;
 #  endif
 # endif
 
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token kinds.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    YYEMPTY = -2,
-    YYEOF = 0,                     /* "end of file"  */
-    YYerror = 256,                 /* error  */
-    YYUNDEF = 257,                 /* "invalid token"  */
-    SPACE = 258,                   /* SPACE  */
-    LETTER = 259,                  /* LETTER  */
-    NEWLINE = 260,                 /* NEWLINE  */
-    COMMENT = 261,                 /* COMMENT  */
-    COLON = 262,                   /* COLON  */
-    ANY = 263,                     /* ANY  */
-    ZONESTR = 264,                 /* ZONESTR  */
-    STRING_ARG = 265,              /* STRING_ARG  */
-    VAR_FORCE_TOPLEVEL = 266,      /* VAR_FORCE_TOPLEVEL  */
-    VAR_SERVER = 267,              /* VAR_SERVER  */
-    VAR_VERBOSITY = 268,           /* VAR_VERBOSITY  */
-    VAR_NUM_THREADS = 269,         /* VAR_NUM_THREADS  */
-    VAR_PORT = 270,                /* VAR_PORT  */
-    VAR_OUTGOING_RANGE = 271,      /* VAR_OUTGOING_RANGE  */
-    VAR_INTERFACE = 272,           /* VAR_INTERFACE  */
-    VAR_PREFER_IP4 = 273,          /* VAR_PREFER_IP4  */
-    VAR_DO_IP4 = 274,              /* VAR_DO_IP4  */
-    VAR_DO_IP6 = 275,              /* VAR_DO_IP6  */
-    VAR_PREFER_IP6 = 276,          /* VAR_PREFER_IP6  */
-    VAR_DO_UDP = 277,              /* VAR_DO_UDP  */
-    VAR_DO_TCP = 278,              /* VAR_DO_TCP  */
-    VAR_TCP_MSS = 279,             /* VAR_TCP_MSS  */
-    VAR_OUTGOING_TCP_MSS = 280,    /* VAR_OUTGOING_TCP_MSS  */
-    VAR_TCP_IDLE_TIMEOUT = 281,    /* VAR_TCP_IDLE_TIMEOUT  */
-    VAR_EDNS_TCP_KEEPALIVE = 282,  /* VAR_EDNS_TCP_KEEPALIVE  */
-    VAR_EDNS_TCP_KEEPALIVE_TIMEOUT = 283, /* VAR_EDNS_TCP_KEEPALIVE_TIMEOUT  */
-    VAR_CHROOT = 284,              /* VAR_CHROOT  */
-    VAR_USERNAME = 285,            /* VAR_USERNAME  */
-    VAR_DIRECTORY = 286,           /* VAR_DIRECTORY  */
-    VAR_LOGFILE = 287,             /* VAR_LOGFILE  */
-    VAR_PIDFILE = 288,             /* VAR_PIDFILE  */
-    VAR_MSG_CACHE_SIZE = 289,      /* VAR_MSG_CACHE_SIZE  */
-    VAR_MSG_CACHE_SLABS = 290,     /* VAR_MSG_CACHE_SLABS  */
-    VAR_NUM_QUERIES_PER_THREAD = 291, /* VAR_NUM_QUERIES_PER_THREAD  */
-    VAR_RRSET_CACHE_SIZE = 292,    /* VAR_RRSET_CACHE_SIZE  */
-    VAR_RRSET_CACHE_SLABS = 293,   /* VAR_RRSET_CACHE_SLABS  */
-    VAR_OUTGOING_NUM_TCP = 294,    /* VAR_OUTGOING_NUM_TCP  */
-    VAR_INFRA_HOST_TTL = 295,      /* VAR_INFRA_HOST_TTL  */
-    VAR_INFRA_LAME_TTL = 296,      /* VAR_INFRA_LAME_TTL  */
-    VAR_INFRA_CACHE_SLABS = 297,   /* VAR_INFRA_CACHE_SLABS  */
-    VAR_INFRA_CACHE_NUMHOSTS = 298, /* VAR_INFRA_CACHE_NUMHOSTS  */
-    VAR_INFRA_CACHE_LAME_SIZE = 299, /* VAR_INFRA_CACHE_LAME_SIZE  */
-    VAR_NAME = 300,                /* VAR_NAME  */
-    VAR_STUB_ZONE = 301,           /* VAR_STUB_ZONE  */
-    VAR_STUB_HOST = 302,           /* VAR_STUB_HOST  */
-    VAR_STUB_ADDR = 303,           /* VAR_STUB_ADDR  */
-    VAR_TARGET_FETCH_POLICY = 304, /* VAR_TARGET_FETCH_POLICY  */
-    VAR_HARDEN_SHORT_BUFSIZE = 305, /* VAR_HARDEN_SHORT_BUFSIZE  */
-    VAR_HARDEN_LARGE_QUERIES = 306, /* VAR_HARDEN_LARGE_QUERIES  */
-    VAR_FORWARD_ZONE = 307,        /* VAR_FORWARD_ZONE  */
-    VAR_FORWARD_HOST = 308,        /* VAR_FORWARD_HOST  */
-    VAR_FORWARD_ADDR = 309,        /* VAR_FORWARD_ADDR  */
-    VAR_DO_NOT_QUERY_ADDRESS = 310, /* VAR_DO_NOT_QUERY_ADDRESS  */
-    VAR_HIDE_IDENTITY = 311,       /* VAR_HIDE_IDENTITY  */
-    VAR_HIDE_VERSION = 312,        /* VAR_HIDE_VERSION  */
-    VAR_IDENTITY = 313,            /* VAR_IDENTITY  */
-    VAR_VERSION = 314,             /* VAR_VERSION  */
-    VAR_HARDEN_GLUE = 315,         /* VAR_HARDEN_GLUE  */
-    VAR_MODULE_CONF = 316,         /* VAR_MODULE_CONF  */
-    VAR_TRUST_ANCHOR_FILE = 317,   /* VAR_TRUST_ANCHOR_FILE  */
-    VAR_TRUST_ANCHOR = 318,        /* VAR_TRUST_ANCHOR  */
-    VAR_VAL_OVERRIDE_DATE = 319,   /* VAR_VAL_OVERRIDE_DATE  */
-    VAR_BOGUS_TTL = 320,           /* VAR_BOGUS_TTL  */
-    VAR_VAL_CLEAN_ADDITIONAL = 321, /* VAR_VAL_CLEAN_ADDITIONAL  */
-    VAR_VAL_PERMISSIVE_MODE = 322, /* VAR_VAL_PERMISSIVE_MODE  */
-    VAR_INCOMING_NUM_TCP = 323,    /* VAR_INCOMING_NUM_TCP  */
-    VAR_MSG_BUFFER_SIZE = 324,     /* VAR_MSG_BUFFER_SIZE  */
-    VAR_KEY_CACHE_SIZE = 325,      /* VAR_KEY_CACHE_SIZE  */
-    VAR_KEY_CACHE_SLABS = 326,     /* VAR_KEY_CACHE_SLABS  */
-    VAR_TRUSTED_KEYS_FILE = 327,   /* VAR_TRUSTED_KEYS_FILE  */
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 328, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
-    VAR_USE_SYSLOG = 329,          /* VAR_USE_SYSLOG  */
-    VAR_OUTGOING_INTERFACE = 330,  /* VAR_OUTGOING_INTERFACE  */
-    VAR_ROOT_HINTS = 331,          /* VAR_ROOT_HINTS  */
-    VAR_DO_NOT_QUERY_LOCALHOST = 332, /* VAR_DO_NOT_QUERY_LOCALHOST  */
-    VAR_CACHE_MAX_TTL = 333,       /* VAR_CACHE_MAX_TTL  */
-    VAR_HARDEN_DNSSEC_STRIPPED = 334, /* VAR_HARDEN_DNSSEC_STRIPPED  */
-    VAR_ACCESS_CONTROL = 335,      /* VAR_ACCESS_CONTROL  */
-    VAR_LOCAL_ZONE = 336,          /* VAR_LOCAL_ZONE  */
-    VAR_LOCAL_DATA = 337,          /* VAR_LOCAL_DATA  */
-    VAR_INTERFACE_AUTOMATIC = 338, /* VAR_INTERFACE_AUTOMATIC  */
-    VAR_STATISTICS_INTERVAL = 339, /* VAR_STATISTICS_INTERVAL  */
-    VAR_DO_DAEMONIZE = 340,        /* VAR_DO_DAEMONIZE  */
-    VAR_USE_CAPS_FOR_ID = 341,     /* VAR_USE_CAPS_FOR_ID  */
-    VAR_STATISTICS_CUMULATIVE = 342, /* VAR_STATISTICS_CUMULATIVE  */
-    VAR_OUTGOING_PORT_PERMIT = 343, /* VAR_OUTGOING_PORT_PERMIT  */
-    VAR_OUTGOING_PORT_AVOID = 344, /* VAR_OUTGOING_PORT_AVOID  */
-    VAR_DLV_ANCHOR_FILE = 345,     /* VAR_DLV_ANCHOR_FILE  */
-    VAR_DLV_ANCHOR = 346,          /* VAR_DLV_ANCHOR  */
-    VAR_NEG_CACHE_SIZE = 347,      /* VAR_NEG_CACHE_SIZE  */
-    VAR_HARDEN_REFERRAL_PATH = 348, /* VAR_HARDEN_REFERRAL_PATH  */
-    VAR_PRIVATE_ADDRESS = 349,     /* VAR_PRIVATE_ADDRESS  */
-    VAR_PRIVATE_DOMAIN = 350,      /* VAR_PRIVATE_DOMAIN  */
-    VAR_REMOTE_CONTROL = 351,      /* VAR_REMOTE_CONTROL  */
-    VAR_CONTROL_ENABLE = 352,      /* VAR_CONTROL_ENABLE  */
-    VAR_CONTROL_INTERFACE = 353,   /* VAR_CONTROL_INTERFACE  */
-    VAR_CONTROL_PORT = 354,        /* VAR_CONTROL_PORT  */
-    VAR_SERVER_KEY_FILE = 355,     /* VAR_SERVER_KEY_FILE  */
-    VAR_SERVER_CERT_FILE = 356,    /* VAR_SERVER_CERT_FILE  */
-    VAR_CONTROL_KEY_FILE = 357,    /* VAR_CONTROL_KEY_FILE  */
-    VAR_CONTROL_CERT_FILE = 358,   /* VAR_CONTROL_CERT_FILE  */
-    VAR_CONTROL_USE_CERT = 359,    /* VAR_CONTROL_USE_CERT  */
-    VAR_TCP_REUSE_TIMEOUT = 360,   /* VAR_TCP_REUSE_TIMEOUT  */
-    VAR_MAX_REUSE_TCP_QUERIES = 361, /* VAR_MAX_REUSE_TCP_QUERIES  */
-    VAR_EXTENDED_STATISTICS = 362, /* VAR_EXTENDED_STATISTICS  */
-    VAR_LOCAL_DATA_PTR = 363,      /* VAR_LOCAL_DATA_PTR  */
-    VAR_JOSTLE_TIMEOUT = 364,      /* VAR_JOSTLE_TIMEOUT  */
-    VAR_STUB_PRIME = 365,          /* VAR_STUB_PRIME  */
-    VAR_UNWANTED_REPLY_THRESHOLD = 366, /* VAR_UNWANTED_REPLY_THRESHOLD  */
-    VAR_LOG_TIME_ASCII = 367,      /* VAR_LOG_TIME_ASCII  */
-    VAR_DOMAIN_INSECURE = 368,     /* VAR_DOMAIN_INSECURE  */
-    VAR_PYTHON = 369,              /* VAR_PYTHON  */
-    VAR_PYTHON_SCRIPT = 370,       /* VAR_PYTHON_SCRIPT  */
-    VAR_VAL_SIG_SKEW_MIN = 371,    /* VAR_VAL_SIG_SKEW_MIN  */
-    VAR_VAL_SIG_SKEW_MAX = 372,    /* VAR_VAL_SIG_SKEW_MAX  */
-    VAR_CACHE_MIN_TTL = 373,       /* VAR_CACHE_MIN_TTL  */
-    VAR_VAL_LOG_LEVEL = 374,       /* VAR_VAL_LOG_LEVEL  */
-    VAR_AUTO_TRUST_ANCHOR_FILE = 375, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
-    VAR_KEEP_MISSING = 376,        /* VAR_KEEP_MISSING  */
-    VAR_ADD_HOLDDOWN = 377,        /* VAR_ADD_HOLDDOWN  */
-    VAR_DEL_HOLDDOWN = 378,        /* VAR_DEL_HOLDDOWN  */
-    VAR_SO_RCVBUF = 379,           /* VAR_SO_RCVBUF  */
-    VAR_EDNS_BUFFER_SIZE = 380,    /* VAR_EDNS_BUFFER_SIZE  */
-    VAR_PREFETCH = 381,            /* VAR_PREFETCH  */
-    VAR_PREFETCH_KEY = 382,        /* VAR_PREFETCH_KEY  */
-    VAR_SO_SNDBUF = 383,           /* VAR_SO_SNDBUF  */
-    VAR_SO_REUSEPORT = 384,        /* VAR_SO_REUSEPORT  */
-    VAR_HARDEN_BELOW_NXDOMAIN = 385, /* VAR_HARDEN_BELOW_NXDOMAIN  */
-    VAR_IGNORE_CD_FLAG = 386,      /* VAR_IGNORE_CD_FLAG  */
-    VAR_LOG_QUERIES = 387,         /* VAR_LOG_QUERIES  */
-    VAR_LOG_REPLIES = 388,         /* VAR_LOG_REPLIES  */
-    VAR_LOG_LOCAL_ACTIONS = 389,   /* VAR_LOG_LOCAL_ACTIONS  */
-    VAR_TCP_UPSTREAM = 390,        /* VAR_TCP_UPSTREAM  */
-    VAR_SSL_UPSTREAM = 391,        /* VAR_SSL_UPSTREAM  */
-    VAR_TCP_AUTH_QUERY_TIMEOUT = 392, /* VAR_TCP_AUTH_QUERY_TIMEOUT  */
-    VAR_SSL_SERVICE_KEY = 393,     /* VAR_SSL_SERVICE_KEY  */
-    VAR_SSL_SERVICE_PEM = 394,     /* VAR_SSL_SERVICE_PEM  */
-    VAR_SSL_PORT = 395,            /* VAR_SSL_PORT  */
-    VAR_FORWARD_FIRST = 396,       /* VAR_FORWARD_FIRST  */
-    VAR_STUB_SSL_UPSTREAM = 397,   /* VAR_STUB_SSL_UPSTREAM  */
-    VAR_FORWARD_SSL_UPSTREAM = 398, /* VAR_FORWARD_SSL_UPSTREAM  */
-    VAR_TLS_CERT_BUNDLE = 399,     /* VAR_TLS_CERT_BUNDLE  */
-    VAR_HTTPS_PORT = 400,          /* VAR_HTTPS_PORT  */
-    VAR_HTTP_ENDPOINT = 401,       /* VAR_HTTP_ENDPOINT  */
-    VAR_HTTP_MAX_STREAMS = 402,    /* VAR_HTTP_MAX_STREAMS  */
-    VAR_HTTP_QUERY_BUFFER_SIZE = 403, /* VAR_HTTP_QUERY_BUFFER_SIZE  */
-    VAR_HTTP_RESPONSE_BUFFER_SIZE = 404, /* VAR_HTTP_RESPONSE_BUFFER_SIZE  */
-    VAR_HTTP_NODELAY = 405,        /* VAR_HTTP_NODELAY  */
-    VAR_HTTP_NOTLS_DOWNSTREAM = 406, /* VAR_HTTP_NOTLS_DOWNSTREAM  */
-    VAR_STUB_FIRST = 407,          /* VAR_STUB_FIRST  */
-    VAR_MINIMAL_RESPONSES = 408,   /* VAR_MINIMAL_RESPONSES  */
-    VAR_RRSET_ROUNDROBIN = 409,    /* VAR_RRSET_ROUNDROBIN  */
-    VAR_MAX_UDP_SIZE = 410,        /* VAR_MAX_UDP_SIZE  */
-    VAR_DELAY_CLOSE = 411,         /* VAR_DELAY_CLOSE  */
-    VAR_UDP_CONNECT = 412,         /* VAR_UDP_CONNECT  */
-    VAR_UNBLOCK_LAN_ZONES = 413,   /* VAR_UNBLOCK_LAN_ZONES  */
-    VAR_INSECURE_LAN_ZONES = 414,  /* VAR_INSECURE_LAN_ZONES  */
-    VAR_INFRA_CACHE_MIN_RTT = 415, /* VAR_INFRA_CACHE_MIN_RTT  */
-    VAR_INFRA_KEEP_PROBING = 416,  /* VAR_INFRA_KEEP_PROBING  */
-    VAR_DNS64_PREFIX = 417,        /* VAR_DNS64_PREFIX  */
-    VAR_DNS64_SYNTHALL = 418,      /* VAR_DNS64_SYNTHALL  */
-    VAR_DNS64_IGNORE_AAAA = 419,   /* VAR_DNS64_IGNORE_AAAA  */
-    VAR_DNSTAP = 420,              /* VAR_DNSTAP  */
-    VAR_DNSTAP_ENABLE = 421,       /* VAR_DNSTAP_ENABLE  */
-    VAR_DNSTAP_SOCKET_PATH = 422,  /* VAR_DNSTAP_SOCKET_PATH  */
-    VAR_DNSTAP_IP = 423,           /* VAR_DNSTAP_IP  */
-    VAR_DNSTAP_TLS = 424,          /* VAR_DNSTAP_TLS  */
-    VAR_DNSTAP_TLS_SERVER_NAME = 425, /* VAR_DNSTAP_TLS_SERVER_NAME  */
-    VAR_DNSTAP_TLS_CERT_BUNDLE = 426, /* VAR_DNSTAP_TLS_CERT_BUNDLE  */
-    VAR_DNSTAP_TLS_CLIENT_KEY_FILE = 427, /* VAR_DNSTAP_TLS_CLIENT_KEY_FILE  */
-    VAR_DNSTAP_TLS_CLIENT_CERT_FILE = 428, /* VAR_DNSTAP_TLS_CLIENT_CERT_FILE  */
-    VAR_DNSTAP_SEND_IDENTITY = 429, /* VAR_DNSTAP_SEND_IDENTITY  */
-    VAR_DNSTAP_SEND_VERSION = 430, /* VAR_DNSTAP_SEND_VERSION  */
-    VAR_DNSTAP_BIDIRECTIONAL = 431, /* VAR_DNSTAP_BIDIRECTIONAL  */
-    VAR_DNSTAP_IDENTITY = 432,     /* VAR_DNSTAP_IDENTITY  */
-    VAR_DNSTAP_VERSION = 433,      /* VAR_DNSTAP_VERSION  */
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 434, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 435, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 436, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 437, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 438, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 439, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
-    VAR_RESPONSE_IP_TAG = 440,     /* VAR_RESPONSE_IP_TAG  */
-    VAR_RESPONSE_IP = 441,         /* VAR_RESPONSE_IP  */
-    VAR_RESPONSE_IP_DATA = 442,    /* VAR_RESPONSE_IP_DATA  */
-    VAR_HARDEN_ALGO_DOWNGRADE = 443, /* VAR_HARDEN_ALGO_DOWNGRADE  */
-    VAR_IP_TRANSPARENT = 444,      /* VAR_IP_TRANSPARENT  */
-    VAR_IP_DSCP = 445,             /* VAR_IP_DSCP  */
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 446, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
-    VAR_IP_RATELIMIT = 447,        /* VAR_IP_RATELIMIT  */
-    VAR_IP_RATELIMIT_SLABS = 448,  /* VAR_IP_RATELIMIT_SLABS  */
-    VAR_IP_RATELIMIT_SIZE = 449,   /* VAR_IP_RATELIMIT_SIZE  */
-    VAR_RATELIMIT = 450,           /* VAR_RATELIMIT  */
-    VAR_RATELIMIT_SLABS = 451,     /* VAR_RATELIMIT_SLABS  */
-    VAR_RATELIMIT_SIZE = 452,      /* VAR_RATELIMIT_SIZE  */
-    VAR_RATELIMIT_FOR_DOMAIN = 453, /* VAR_RATELIMIT_FOR_DOMAIN  */
-    VAR_RATELIMIT_BELOW_DOMAIN = 454, /* VAR_RATELIMIT_BELOW_DOMAIN  */
-    VAR_IP_RATELIMIT_FACTOR = 455, /* VAR_IP_RATELIMIT_FACTOR  */
-    VAR_RATELIMIT_FACTOR = 456,    /* VAR_RATELIMIT_FACTOR  */
-    VAR_SEND_CLIENT_SUBNET = 457,  /* VAR_SEND_CLIENT_SUBNET  */
-    VAR_CLIENT_SUBNET_ZONE = 458,  /* VAR_CLIENT_SUBNET_ZONE  */
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 459, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
-    VAR_CLIENT_SUBNET_OPCODE = 460, /* VAR_CLIENT_SUBNET_OPCODE  */
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 461, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 462, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
-    VAR_MIN_CLIENT_SUBNET_IPV4 = 463, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
-    VAR_MIN_CLIENT_SUBNET_IPV6 = 464, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
-    VAR_MAX_ECS_TREE_SIZE_IPV4 = 465, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
-    VAR_MAX_ECS_TREE_SIZE_IPV6 = 466, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
-    VAR_CAPS_WHITELIST = 467,      /* VAR_CAPS_WHITELIST  */
-    VAR_CACHE_MAX_NEGATIVE_TTL = 468, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
-    VAR_PERMIT_SMALL_HOLDDOWN = 469, /* VAR_PERMIT_SMALL_HOLDDOWN  */
-    VAR_QNAME_MINIMISATION = 470,  /* VAR_QNAME_MINIMISATION  */
-    VAR_QNAME_MINIMISATION_STRICT = 471, /* VAR_QNAME_MINIMISATION_STRICT  */
-    VAR_IP_FREEBIND = 472,         /* VAR_IP_FREEBIND  */
-    VAR_DEFINE_TAG = 473,          /* VAR_DEFINE_TAG  */
-    VAR_LOCAL_ZONE_TAG = 474,      /* VAR_LOCAL_ZONE_TAG  */
-    VAR_ACCESS_CONTROL_TAG = 475,  /* VAR_ACCESS_CONTROL_TAG  */
-    VAR_LOCAL_ZONE_OVERRIDE = 476, /* VAR_LOCAL_ZONE_OVERRIDE  */
-    VAR_ACCESS_CONTROL_TAG_ACTION = 477, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
-    VAR_ACCESS_CONTROL_TAG_DATA = 478, /* VAR_ACCESS_CONTROL_TAG_DATA  */
-    VAR_VIEW = 479,                /* VAR_VIEW  */
-    VAR_ACCESS_CONTROL_VIEW = 480, /* VAR_ACCESS_CONTROL_VIEW  */
-    VAR_VIEW_FIRST = 481,          /* VAR_VIEW_FIRST  */
-    VAR_SERVE_EXPIRED = 482,       /* VAR_SERVE_EXPIRED  */
-    VAR_SERVE_EXPIRED_TTL = 483,   /* VAR_SERVE_EXPIRED_TTL  */
-    VAR_SERVE_EXPIRED_TTL_RESET = 484, /* VAR_SERVE_EXPIRED_TTL_RESET  */
-    VAR_SERVE_EXPIRED_REPLY_TTL = 485, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
-    VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 486, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
-    VAR_SERVE_ORIGINAL_TTL = 487,  /* VAR_SERVE_ORIGINAL_TTL  */
-    VAR_FAKE_DSA = 488,            /* VAR_FAKE_DSA  */
-    VAR_FAKE_SHA1 = 489,           /* VAR_FAKE_SHA1  */
-    VAR_LOG_IDENTITY = 490,        /* VAR_LOG_IDENTITY  */
-    VAR_HIDE_TRUSTANCHOR = 491,    /* VAR_HIDE_TRUSTANCHOR  */
-    VAR_TRUST_ANCHOR_SIGNALING = 492, /* VAR_TRUST_ANCHOR_SIGNALING  */
-    VAR_AGGRESSIVE_NSEC = 493,     /* VAR_AGGRESSIVE_NSEC  */
-    VAR_USE_SYSTEMD = 494,         /* VAR_USE_SYSTEMD  */
-    VAR_SHM_ENABLE = 495,          /* VAR_SHM_ENABLE  */
-    VAR_SHM_KEY = 496,             /* VAR_SHM_KEY  */
-    VAR_ROOT_KEY_SENTINEL = 497,   /* VAR_ROOT_KEY_SENTINEL  */
-    VAR_DNSCRYPT = 498,            /* VAR_DNSCRYPT  */
-    VAR_DNSCRYPT_ENABLE = 499,     /* VAR_DNSCRYPT_ENABLE  */
-    VAR_DNSCRYPT_PORT = 500,       /* VAR_DNSCRYPT_PORT  */
-    VAR_DNSCRYPT_PROVIDER = 501,   /* VAR_DNSCRYPT_PROVIDER  */
-    VAR_DNSCRYPT_SECRET_KEY = 502, /* VAR_DNSCRYPT_SECRET_KEY  */
-    VAR_DNSCRYPT_PROVIDER_CERT = 503, /* VAR_DNSCRYPT_PROVIDER_CERT  */
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 504, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 505, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 506, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 507, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 508, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
-    VAR_PAD_RESPONSES = 509,       /* VAR_PAD_RESPONSES  */
-    VAR_PAD_RESPONSES_BLOCK_SIZE = 510, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
-    VAR_PAD_QUERIES = 511,         /* VAR_PAD_QUERIES  */
-    VAR_PAD_QUERIES_BLOCK_SIZE = 512, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
-    VAR_IPSECMOD_ENABLED = 513,    /* VAR_IPSECMOD_ENABLED  */
-    VAR_IPSECMOD_HOOK = 514,       /* VAR_IPSECMOD_HOOK  */
-    VAR_IPSECMOD_IGNORE_BOGUS = 515, /* VAR_IPSECMOD_IGNORE_BOGUS  */
-    VAR_IPSECMOD_MAX_TTL = 516,    /* VAR_IPSECMOD_MAX_TTL  */
-    VAR_IPSECMOD_WHITELIST = 517,  /* VAR_IPSECMOD_WHITELIST  */
-    VAR_IPSECMOD_STRICT = 518,     /* VAR_IPSECMOD_STRICT  */
-    VAR_CACHEDB = 519,             /* VAR_CACHEDB  */
-    VAR_CACHEDB_BACKEND = 520,     /* VAR_CACHEDB_BACKEND  */
-    VAR_CACHEDB_SECRETSEED = 521,  /* VAR_CACHEDB_SECRETSEED  */
-    VAR_CACHEDB_REDISHOST = 522,   /* VAR_CACHEDB_REDISHOST  */
-    VAR_CACHEDB_REDISPORT = 523,   /* VAR_CACHEDB_REDISPORT  */
-    VAR_CACHEDB_REDISTIMEOUT = 524, /* VAR_CACHEDB_REDISTIMEOUT  */
-    VAR_CACHEDB_REDISEXPIRERECORDS = 525, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 526, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
-    VAR_FOR_UPSTREAM = 527,        /* VAR_FOR_UPSTREAM  */
-    VAR_AUTH_ZONE = 528,           /* VAR_AUTH_ZONE  */
-    VAR_ZONEFILE = 529,            /* VAR_ZONEFILE  */
-    VAR_MASTER = 530,              /* VAR_MASTER  */
-    VAR_URL = 531,                 /* VAR_URL  */
-    VAR_FOR_DOWNSTREAM = 532,      /* VAR_FOR_DOWNSTREAM  */
-    VAR_FALLBACK_ENABLED = 533,    /* VAR_FALLBACK_ENABLED  */
-    VAR_TLS_ADDITIONAL_PORT = 534, /* VAR_TLS_ADDITIONAL_PORT  */
-    VAR_LOW_RTT = 535,             /* VAR_LOW_RTT  */
-    VAR_LOW_RTT_PERMIL = 536,      /* VAR_LOW_RTT_PERMIL  */
-    VAR_FAST_SERVER_PERMIL = 537,  /* VAR_FAST_SERVER_PERMIL  */
-    VAR_FAST_SERVER_NUM = 538,     /* VAR_FAST_SERVER_NUM  */
-    VAR_ALLOW_NOTIFY = 539,        /* VAR_ALLOW_NOTIFY  */
-    VAR_TLS_WIN_CERT = 540,        /* VAR_TLS_WIN_CERT  */
-    VAR_TCP_CONNECTION_LIMIT = 541, /* VAR_TCP_CONNECTION_LIMIT  */
-    VAR_FORWARD_NO_CACHE = 542,    /* VAR_FORWARD_NO_CACHE  */
-    VAR_STUB_NO_CACHE = 543,       /* VAR_STUB_NO_CACHE  */
-    VAR_LOG_SERVFAIL = 544,        /* VAR_LOG_SERVFAIL  */
-    VAR_DENY_ANY = 545,            /* VAR_DENY_ANY  */
-    VAR_UNKNOWN_SERVER_TIME_LIMIT = 546, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
-    VAR_LOG_TAG_QUERYREPLY = 547,  /* VAR_LOG_TAG_QUERYREPLY  */
-    VAR_STREAM_WAIT_SIZE = 548,    /* VAR_STREAM_WAIT_SIZE  */
-    VAR_TLS_CIPHERS = 549,         /* VAR_TLS_CIPHERS  */
-    VAR_TLS_CIPHERSUITES = 550,    /* VAR_TLS_CIPHERSUITES  */
-    VAR_TLS_USE_SNI = 551,         /* VAR_TLS_USE_SNI  */
-    VAR_IPSET = 552,               /* VAR_IPSET  */
-    VAR_IPSET_NAME_V4 = 553,       /* VAR_IPSET_NAME_V4  */
-    VAR_IPSET_NAME_V6 = 554,       /* VAR_IPSET_NAME_V6  */
-    VAR_TLS_SESSION_TICKET_KEYS = 555, /* VAR_TLS_SESSION_TICKET_KEYS  */
-    VAR_RPZ = 556,                 /* VAR_RPZ  */
-    VAR_TAGS = 557,                /* VAR_TAGS  */
-    VAR_RPZ_ACTION_OVERRIDE = 558, /* VAR_RPZ_ACTION_OVERRIDE  */
-    VAR_RPZ_CNAME_OVERRIDE = 559,  /* VAR_RPZ_CNAME_OVERRIDE  */
-    VAR_RPZ_LOG = 560,             /* VAR_RPZ_LOG  */
-    VAR_RPZ_LOG_NAME = 561,        /* VAR_RPZ_LOG_NAME  */
-    VAR_DYNLIB = 562,              /* VAR_DYNLIB  */
-    VAR_DYNLIB_FILE = 563,         /* VAR_DYNLIB_FILE  */
-    VAR_EDNS_CLIENT_STRING = 564,  /* VAR_EDNS_CLIENT_STRING  */
-    VAR_EDNS_CLIENT_STRING_OPCODE = 565, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
-    VAR_NSID = 566,                /* VAR_NSID  */
-    VAR_ZONEMD_PERMISSIVE_MODE = 567, /* VAR_ZONEMD_PERMISSIVE_MODE  */
-    VAR_ZONEMD_REJECT_ABSENCE = 568 /* VAR_ZONEMD_REJECT_ABSENCE  */
-  };
-  typedef enum yytokentype yytoken_kind_t;
-#endif
-/* Token kinds.  */
-#define YYEOF 0
-#define YYerror 256
-#define YYUNDEF 257
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_FORCE_TOPLEVEL 266
-#define VAR_SERVER 267
-#define VAR_VERBOSITY 268
-#define VAR_NUM_THREADS 269
-#define VAR_PORT 270
-#define VAR_OUTGOING_RANGE 271
-#define VAR_INTERFACE 272
-#define VAR_PREFER_IP4 273
-#define VAR_DO_IP4 274
-#define VAR_DO_IP6 275
-#define VAR_PREFER_IP6 276
-#define VAR_DO_UDP 277
-#define VAR_DO_TCP 278
-#define VAR_TCP_MSS 279
-#define VAR_OUTGOING_TCP_MSS 280
-#define VAR_TCP_IDLE_TIMEOUT 281
-#define VAR_EDNS_TCP_KEEPALIVE 282
-#define VAR_EDNS_TCP_KEEPALIVE_TIMEOUT 283
-#define VAR_CHROOT 284
-#define VAR_USERNAME 285
-#define VAR_DIRECTORY 286
-#define VAR_LOGFILE 287
-#define VAR_PIDFILE 288
-#define VAR_MSG_CACHE_SIZE 289
-#define VAR_MSG_CACHE_SLABS 290
-#define VAR_NUM_QUERIES_PER_THREAD 291
-#define VAR_RRSET_CACHE_SIZE 292
-#define VAR_RRSET_CACHE_SLABS 293
-#define VAR_OUTGOING_NUM_TCP 294
-#define VAR_INFRA_HOST_TTL 295
-#define VAR_INFRA_LAME_TTL 296
-#define VAR_INFRA_CACHE_SLABS 297
-#define VAR_INFRA_CACHE_NUMHOSTS 298
-#define VAR_INFRA_CACHE_LAME_SIZE 299
-#define VAR_NAME 300
-#define VAR_STUB_ZONE 301
-#define VAR_STUB_HOST 302
-#define VAR_STUB_ADDR 303
-#define VAR_TARGET_FETCH_POLICY 304
-#define VAR_HARDEN_SHORT_BUFSIZE 305
-#define VAR_HARDEN_LARGE_QUERIES 306
-#define VAR_FORWARD_ZONE 307
-#define VAR_FORWARD_HOST 308
-#define VAR_FORWARD_ADDR 309
-#define VAR_DO_NOT_QUERY_ADDRESS 310
-#define VAR_HIDE_IDENTITY 311
-#define VAR_HIDE_VERSION 312
-#define VAR_IDENTITY 313
-#define VAR_VERSION 314
-#define VAR_HARDEN_GLUE 315
-#define VAR_MODULE_CONF 316
-#define VAR_TRUST_ANCHOR_FILE 317
-#define VAR_TRUST_ANCHOR 318
-#define VAR_VAL_OVERRIDE_DATE 319
-#define VAR_BOGUS_TTL 320
-#define VAR_VAL_CLEAN_ADDITIONAL 321
-#define VAR_VAL_PERMISSIVE_MODE 322
-#define VAR_INCOMING_NUM_TCP 323
-#define VAR_MSG_BUFFER_SIZE 324
-#define VAR_KEY_CACHE_SIZE 325
-#define VAR_KEY_CACHE_SLABS 326
-#define VAR_TRUSTED_KEYS_FILE 327
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 328
-#define VAR_USE_SYSLOG 329
-#define VAR_OUTGOING_INTERFACE 330
-#define VAR_ROOT_HINTS 331
-#define VAR_DO_NOT_QUERY_LOCALHOST 332
-#define VAR_CACHE_MAX_TTL 333
-#define VAR_HARDEN_DNSSEC_STRIPPED 334
-#define VAR_ACCESS_CONTROL 335
-#define VAR_LOCAL_ZONE 336
-#define VAR_LOCAL_DATA 337
-#define VAR_INTERFACE_AUTOMATIC 338
-#define VAR_STATISTICS_INTERVAL 339
-#define VAR_DO_DAEMONIZE 340
-#define VAR_USE_CAPS_FOR_ID 341
-#define VAR_STATISTICS_CUMULATIVE 342
-#define VAR_OUTGOING_PORT_PERMIT 343
-#define VAR_OUTGOING_PORT_AVOID 344
-#define VAR_DLV_ANCHOR_FILE 345
-#define VAR_DLV_ANCHOR 346
-#define VAR_NEG_CACHE_SIZE 347
-#define VAR_HARDEN_REFERRAL_PATH 348
-#define VAR_PRIVATE_ADDRESS 349
-#define VAR_PRIVATE_DOMAIN 350
-#define VAR_REMOTE_CONTROL 351
-#define VAR_CONTROL_ENABLE 352
-#define VAR_CONTROL_INTERFACE 353
-#define VAR_CONTROL_PORT 354
-#define VAR_SERVER_KEY_FILE 355
-#define VAR_SERVER_CERT_FILE 356
-#define VAR_CONTROL_KEY_FILE 357
-#define VAR_CONTROL_CERT_FILE 358
-#define VAR_CONTROL_USE_CERT 359
-#define VAR_TCP_REUSE_TIMEOUT 360
-#define VAR_MAX_REUSE_TCP_QUERIES 361
-#define VAR_EXTENDED_STATISTICS 362
-#define VAR_LOCAL_DATA_PTR 363
-#define VAR_JOSTLE_TIMEOUT 364
-#define VAR_STUB_PRIME 365
-#define VAR_UNWANTED_REPLY_THRESHOLD 366
-#define VAR_LOG_TIME_ASCII 367
-#define VAR_DOMAIN_INSECURE 368
-#define VAR_PYTHON 369
-#define VAR_PYTHON_SCRIPT 370
-#define VAR_VAL_SIG_SKEW_MIN 371
-#define VAR_VAL_SIG_SKEW_MAX 372
-#define VAR_CACHE_MIN_TTL 373
-#define VAR_VAL_LOG_LEVEL 374
-#define VAR_AUTO_TRUST_ANCHOR_FILE 375
-#define VAR_KEEP_MISSING 376
-#define VAR_ADD_HOLDDOWN 377
-#define VAR_DEL_HOLDDOWN 378
-#define VAR_SO_RCVBUF 379
-#define VAR_EDNS_BUFFER_SIZE 380
-#define VAR_PREFETCH 381
-#define VAR_PREFETCH_KEY 382
-#define VAR_SO_SNDBUF 383
-#define VAR_SO_REUSEPORT 384
-#define VAR_HARDEN_BELOW_NXDOMAIN 385
-#define VAR_IGNORE_CD_FLAG 386
-#define VAR_LOG_QUERIES 387
-#define VAR_LOG_REPLIES 388
-#define VAR_LOG_LOCAL_ACTIONS 389
-#define VAR_TCP_UPSTREAM 390
-#define VAR_SSL_UPSTREAM 391
-#define VAR_TCP_AUTH_QUERY_TIMEOUT 392
-#define VAR_SSL_SERVICE_KEY 393
-#define VAR_SSL_SERVICE_PEM 394
-#define VAR_SSL_PORT 395
-#define VAR_FORWARD_FIRST 396
-#define VAR_STUB_SSL_UPSTREAM 397
-#define VAR_FORWARD_SSL_UPSTREAM 398
-#define VAR_TLS_CERT_BUNDLE 399
-#define VAR_HTTPS_PORT 400
-#define VAR_HTTP_ENDPOINT 401
-#define VAR_HTTP_MAX_STREAMS 402
-#define VAR_HTTP_QUERY_BUFFER_SIZE 403
-#define VAR_HTTP_RESPONSE_BUFFER_SIZE 404
-#define VAR_HTTP_NODELAY 405
-#define VAR_HTTP_NOTLS_DOWNSTREAM 406
-#define VAR_STUB_FIRST 407
-#define VAR_MINIMAL_RESPONSES 408
-#define VAR_RRSET_ROUNDROBIN 409
-#define VAR_MAX_UDP_SIZE 410
-#define VAR_DELAY_CLOSE 411
-#define VAR_UDP_CONNECT 412
-#define VAR_UNBLOCK_LAN_ZONES 413
-#define VAR_INSECURE_LAN_ZONES 414
-#define VAR_INFRA_CACHE_MIN_RTT 415
-#define VAR_INFRA_KEEP_PROBING 416
-#define VAR_DNS64_PREFIX 417
-#define VAR_DNS64_SYNTHALL 418
-#define VAR_DNS64_IGNORE_AAAA 419
-#define VAR_DNSTAP 420
-#define VAR_DNSTAP_ENABLE 421
-#define VAR_DNSTAP_SOCKET_PATH 422
-#define VAR_DNSTAP_IP 423
-#define VAR_DNSTAP_TLS 424
-#define VAR_DNSTAP_TLS_SERVER_NAME 425
-#define VAR_DNSTAP_TLS_CERT_BUNDLE 426
-#define VAR_DNSTAP_TLS_CLIENT_KEY_FILE 427
-#define VAR_DNSTAP_TLS_CLIENT_CERT_FILE 428
-#define VAR_DNSTAP_SEND_IDENTITY 429
-#define VAR_DNSTAP_SEND_VERSION 430
-#define VAR_DNSTAP_BIDIRECTIONAL 431
-#define VAR_DNSTAP_IDENTITY 432
-#define VAR_DNSTAP_VERSION 433
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 434
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 435
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 436
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 437
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 438
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 439
-#define VAR_RESPONSE_IP_TAG 440
-#define VAR_RESPONSE_IP 441
-#define VAR_RESPONSE_IP_DATA 442
-#define VAR_HARDEN_ALGO_DOWNGRADE 443
-#define VAR_IP_TRANSPARENT 444
-#define VAR_IP_DSCP 445
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 446
-#define VAR_IP_RATELIMIT 447
-#define VAR_IP_RATELIMIT_SLABS 448
-#define VAR_IP_RATELIMIT_SIZE 449
-#define VAR_RATELIMIT 450
-#define VAR_RATELIMIT_SLABS 451
-#define VAR_RATELIMIT_SIZE 452
-#define VAR_RATELIMIT_FOR_DOMAIN 453
-#define VAR_RATELIMIT_BELOW_DOMAIN 454
-#define VAR_IP_RATELIMIT_FACTOR 455
-#define VAR_RATELIMIT_FACTOR 456
-#define VAR_SEND_CLIENT_SUBNET 457
-#define VAR_CLIENT_SUBNET_ZONE 458
-#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 459
-#define VAR_CLIENT_SUBNET_OPCODE 460
-#define VAR_MAX_CLIENT_SUBNET_IPV4 461
-#define VAR_MAX_CLIENT_SUBNET_IPV6 462
-#define VAR_MIN_CLIENT_SUBNET_IPV4 463
-#define VAR_MIN_CLIENT_SUBNET_IPV6 464
-#define VAR_MAX_ECS_TREE_SIZE_IPV4 465
-#define VAR_MAX_ECS_TREE_SIZE_IPV6 466
-#define VAR_CAPS_WHITELIST 467
-#define VAR_CACHE_MAX_NEGATIVE_TTL 468
-#define VAR_PERMIT_SMALL_HOLDDOWN 469
-#define VAR_QNAME_MINIMISATION 470
-#define VAR_QNAME_MINIMISATION_STRICT 471
-#define VAR_IP_FREEBIND 472
-#define VAR_DEFINE_TAG 473
-#define VAR_LOCAL_ZONE_TAG 474
-#define VAR_ACCESS_CONTROL_TAG 475
-#define VAR_LOCAL_ZONE_OVERRIDE 476
-#define VAR_ACCESS_CONTROL_TAG_ACTION 477
-#define VAR_ACCESS_CONTROL_TAG_DATA 478
-#define VAR_VIEW 479
-#define VAR_ACCESS_CONTROL_VIEW 480
-#define VAR_VIEW_FIRST 481
-#define VAR_SERVE_EXPIRED 482
-#define VAR_SERVE_EXPIRED_TTL 483
-#define VAR_SERVE_EXPIRED_TTL_RESET 484
-#define VAR_SERVE_EXPIRED_REPLY_TTL 485
-#define VAR_SERVE_EXPIRED_CLIENT_TIMEOUT 486
-#define VAR_SERVE_ORIGINAL_TTL 487
-#define VAR_FAKE_DSA 488
-#define VAR_FAKE_SHA1 489
-#define VAR_LOG_IDENTITY 490
-#define VAR_HIDE_TRUSTANCHOR 491
-#define VAR_TRUST_ANCHOR_SIGNALING 492
-#define VAR_AGGRESSIVE_NSEC 493
-#define VAR_USE_SYSTEMD 494
-#define VAR_SHM_ENABLE 495
-#define VAR_SHM_KEY 496
-#define VAR_ROOT_KEY_SENTINEL 497
-#define VAR_DNSCRYPT 498
-#define VAR_DNSCRYPT_ENABLE 499
-#define VAR_DNSCRYPT_PORT 500
-#define VAR_DNSCRYPT_PROVIDER 501
-#define VAR_DNSCRYPT_SECRET_KEY 502
-#define VAR_DNSCRYPT_PROVIDER_CERT 503
-#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 504
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 505
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 506
-#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 507
-#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 508
-#define VAR_PAD_RESPONSES 509
-#define VAR_PAD_RESPONSES_BLOCK_SIZE 510
-#define VAR_PAD_QUERIES 511
-#define VAR_PAD_QUERIES_BLOCK_SIZE 512
-#define VAR_IPSECMOD_ENABLED 513
-#define VAR_IPSECMOD_HOOK 514
-#define VAR_IPSECMOD_IGNORE_BOGUS 515
-#define VAR_IPSECMOD_MAX_TTL 516
-#define VAR_IPSECMOD_WHITELIST 517
-#define VAR_IPSECMOD_STRICT 518
-#define VAR_CACHEDB 519
-#define VAR_CACHEDB_BACKEND 520
-#define VAR_CACHEDB_SECRETSEED 521
-#define VAR_CACHEDB_REDISHOST 522
-#define VAR_CACHEDB_REDISPORT 523
-#define VAR_CACHEDB_REDISTIMEOUT 524
-#define VAR_CACHEDB_REDISEXPIRERECORDS 525
-#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 526
-#define VAR_FOR_UPSTREAM 527
-#define VAR_AUTH_ZONE 528
-#define VAR_ZONEFILE 529
-#define VAR_MASTER 530
-#define VAR_URL 531
-#define VAR_FOR_DOWNSTREAM 532
-#define VAR_FALLBACK_ENABLED 533
-#define VAR_TLS_ADDITIONAL_PORT 534
-#define VAR_LOW_RTT 535
-#define VAR_LOW_RTT_PERMIL 536
-#define VAR_FAST_SERVER_PERMIL 537
-#define VAR_FAST_SERVER_NUM 538
-#define VAR_ALLOW_NOTIFY 539
-#define VAR_TLS_WIN_CERT 540
-#define VAR_TCP_CONNECTION_LIMIT 541
-#define VAR_FORWARD_NO_CACHE 542
-#define VAR_STUB_NO_CACHE 543
-#define VAR_LOG_SERVFAIL 544
-#define VAR_DENY_ANY 545
-#define VAR_UNKNOWN_SERVER_TIME_LIMIT 546
-#define VAR_LOG_TAG_QUERYREPLY 547
-#define VAR_STREAM_WAIT_SIZE 548
-#define VAR_TLS_CIPHERS 549
-#define VAR_TLS_CIPHERSUITES 550
-#define VAR_TLS_USE_SNI 551
-#define VAR_IPSET 552
-#define VAR_IPSET_NAME_V4 553
-#define VAR_IPSET_NAME_V6 554
-#define VAR_TLS_SESSION_TICKET_KEYS 555
-#define VAR_RPZ 556
-#define VAR_TAGS 557
-#define VAR_RPZ_ACTION_OVERRIDE 558
-#define VAR_RPZ_CNAME_OVERRIDE 559
-#define VAR_RPZ_LOG 560
-#define VAR_RPZ_LOG_NAME 561
-#define VAR_DYNLIB 562
-#define VAR_DYNLIB_FILE 563
-#define VAR_EDNS_CLIENT_STRING 564
-#define VAR_EDNS_CLIENT_STRING_OPCODE 565
-#define VAR_NSID 566
-#define VAR_ZONEMD_PERMISSIVE_MODE 567
-#define VAR_ZONEMD_REJECT_ABSENCE 568
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-union YYSTYPE
-{
-#line 66 "./util/configparser.y"
-
-	char*	str;
-
-#line 782 "util/configparser.c"
-
-};
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
-
-
-extern YYSTYPE yylval;
-
-int yyparse (void);
-
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
+#include "configparser.h"
 /* Symbol kind.  */
 enum yysymbol_kind_t
 {
@@ -916,539 +244,591 @@ enum yysymbol_kind_t
   YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 117,     /* VAR_VAL_SIG_SKEW_MAX  */
   YYSYMBOL_VAR_CACHE_MIN_TTL = 118,        /* VAR_CACHE_MIN_TTL  */
   YYSYMBOL_VAR_VAL_LOG_LEVEL = 119,        /* VAR_VAL_LOG_LEVEL  */
-  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 120, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
-  YYSYMBOL_VAR_KEEP_MISSING = 121,         /* VAR_KEEP_MISSING  */
-  YYSYMBOL_VAR_ADD_HOLDDOWN = 122,         /* VAR_ADD_HOLDDOWN  */
-  YYSYMBOL_VAR_DEL_HOLDDOWN = 123,         /* VAR_DEL_HOLDDOWN  */
-  YYSYMBOL_VAR_SO_RCVBUF = 124,            /* VAR_SO_RCVBUF  */
-  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 125,     /* VAR_EDNS_BUFFER_SIZE  */
-  YYSYMBOL_VAR_PREFETCH = 126,             /* VAR_PREFETCH  */
-  YYSYMBOL_VAR_PREFETCH_KEY = 127,         /* VAR_PREFETCH_KEY  */
-  YYSYMBOL_VAR_SO_SNDBUF = 128,            /* VAR_SO_SNDBUF  */
-  YYSYMBOL_VAR_SO_REUSEPORT = 129,         /* VAR_SO_REUSEPORT  */
-  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 130, /* VAR_HARDEN_BELOW_NXDOMAIN  */
-  YYSYMBOL_VAR_IGNORE_CD_FLAG = 131,       /* VAR_IGNORE_CD_FLAG  */
-  YYSYMBOL_VAR_LOG_QUERIES = 132,          /* VAR_LOG_QUERIES  */
-  YYSYMBOL_VAR_LOG_REPLIES = 133,          /* VAR_LOG_REPLIES  */
-  YYSYMBOL_VAR_LOG_LOCAL_ACTIONS = 134,    /* VAR_LOG_LOCAL_ACTIONS  */
-  YYSYMBOL_VAR_TCP_UPSTREAM = 135,         /* VAR_TCP_UPSTREAM  */
-  YYSYMBOL_VAR_SSL_UPSTREAM = 136,         /* VAR_SSL_UPSTREAM  */
-  YYSYMBOL_VAR_TCP_AUTH_QUERY_TIMEOUT = 137, /* VAR_TCP_AUTH_QUERY_TIMEOUT  */
-  YYSYMBOL_VAR_SSL_SERVICE_KEY = 138,      /* VAR_SSL_SERVICE_KEY  */
-  YYSYMBOL_VAR_SSL_SERVICE_PEM = 139,      /* VAR_SSL_SERVICE_PEM  */
-  YYSYMBOL_VAR_SSL_PORT = 140,             /* VAR_SSL_PORT  */
-  YYSYMBOL_VAR_FORWARD_FIRST = 141,        /* VAR_FORWARD_FIRST  */
-  YYSYMBOL_VAR_STUB_SSL_UPSTREAM = 142,    /* VAR_STUB_SSL_UPSTREAM  */
-  YYSYMBOL_VAR_FORWARD_SSL_UPSTREAM = 143, /* VAR_FORWARD_SSL_UPSTREAM  */
-  YYSYMBOL_VAR_TLS_CERT_BUNDLE = 144,      /* VAR_TLS_CERT_BUNDLE  */
-  YYSYMBOL_VAR_HTTPS_PORT = 145,           /* VAR_HTTPS_PORT  */
-  YYSYMBOL_VAR_HTTP_ENDPOINT = 146,        /* VAR_HTTP_ENDPOINT  */
-  YYSYMBOL_VAR_HTTP_MAX_STREAMS = 147,     /* VAR_HTTP_MAX_STREAMS  */
-  YYSYMBOL_VAR_HTTP_QUERY_BUFFER_SIZE = 148, /* VAR_HTTP_QUERY_BUFFER_SIZE  */
-  YYSYMBOL_VAR_HTTP_RESPONSE_BUFFER_SIZE = 149, /* VAR_HTTP_RESPONSE_BUFFER_SIZE  */
-  YYSYMBOL_VAR_HTTP_NODELAY = 150,         /* VAR_HTTP_NODELAY  */
-  YYSYMBOL_VAR_HTTP_NOTLS_DOWNSTREAM = 151, /* VAR_HTTP_NOTLS_DOWNSTREAM  */
-  YYSYMBOL_VAR_STUB_FIRST = 152,           /* VAR_STUB_FIRST  */
-  YYSYMBOL_VAR_MINIMAL_RESPONSES = 153,    /* VAR_MINIMAL_RESPONSES  */
-  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 154,     /* VAR_RRSET_ROUNDROBIN  */
-  YYSYMBOL_VAR_MAX_UDP_SIZE = 155,         /* VAR_MAX_UDP_SIZE  */
-  YYSYMBOL_VAR_DELAY_CLOSE = 156,          /* VAR_DELAY_CLOSE  */
-  YYSYMBOL_VAR_UDP_CONNECT = 157,          /* VAR_UDP_CONNECT  */
-  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 158,    /* VAR_UNBLOCK_LAN_ZONES  */
-  YYSYMBOL_VAR_INSECURE_LAN_ZONES = 159,   /* VAR_INSECURE_LAN_ZONES  */
-  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 160,  /* VAR_INFRA_CACHE_MIN_RTT  */
-  YYSYMBOL_VAR_INFRA_KEEP_PROBING = 161,   /* VAR_INFRA_KEEP_PROBING  */
-  YYSYMBOL_VAR_DNS64_PREFIX = 162,         /* VAR_DNS64_PREFIX  */
-  YYSYMBOL_VAR_DNS64_SYNTHALL = 163,       /* VAR_DNS64_SYNTHALL  */
-  YYSYMBOL_VAR_DNS64_IGNORE_AAAA = 164,    /* VAR_DNS64_IGNORE_AAAA  */
-  YYSYMBOL_VAR_DNSTAP = 165,               /* VAR_DNSTAP  */
-  YYSYMBOL_VAR_DNSTAP_ENABLE = 166,        /* VAR_DNSTAP_ENABLE  */
-  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 167,   /* VAR_DNSTAP_SOCKET_PATH  */
-  YYSYMBOL_VAR_DNSTAP_IP = 168,            /* VAR_DNSTAP_IP  */
-  YYSYMBOL_VAR_DNSTAP_TLS = 169,           /* VAR_DNSTAP_TLS  */
-  YYSYMBOL_VAR_DNSTAP_TLS_SERVER_NAME = 170, /* VAR_DNSTAP_TLS_SERVER_NAME  */
-  YYSYMBOL_VAR_DNSTAP_TLS_CERT_BUNDLE = 171, /* VAR_DNSTAP_TLS_CERT_BUNDLE  */
-  YYSYMBOL_VAR_DNSTAP_TLS_CLIENT_KEY_FILE = 172, /* VAR_DNSTAP_TLS_CLIENT_KEY_FILE  */
-  YYSYMBOL_VAR_DNSTAP_TLS_CLIENT_CERT_FILE = 173, /* VAR_DNSTAP_TLS_CLIENT_CERT_FILE  */
-  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 174, /* VAR_DNSTAP_SEND_IDENTITY  */
-  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 175,  /* VAR_DNSTAP_SEND_VERSION  */
-  YYSYMBOL_VAR_DNSTAP_BIDIRECTIONAL = 176, /* VAR_DNSTAP_BIDIRECTIONAL  */
-  YYSYMBOL_VAR_DNSTAP_IDENTITY = 177,      /* VAR_DNSTAP_IDENTITY  */
-  YYSYMBOL_VAR_DNSTAP_VERSION = 178,       /* VAR_DNSTAP_VERSION  */
-  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 179, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
-  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 180, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
-  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 181, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
-  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 182, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
-  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 183, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
-  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 184, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
-  YYSYMBOL_VAR_RESPONSE_IP_TAG = 185,      /* VAR_RESPONSE_IP_TAG  */
-  YYSYMBOL_VAR_RESPONSE_IP = 186,          /* VAR_RESPONSE_IP  */
-  YYSYMBOL_VAR_RESPONSE_IP_DATA = 187,     /* VAR_RESPONSE_IP_DATA  */
-  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 188, /* VAR_HARDEN_ALGO_DOWNGRADE  */
-  YYSYMBOL_VAR_IP_TRANSPARENT = 189,       /* VAR_IP_TRANSPARENT  */
-  YYSYMBOL_VAR_IP_DSCP = 190,              /* VAR_IP_DSCP  */
-  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 191, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
-  YYSYMBOL_VAR_IP_RATELIMIT = 192,         /* VAR_IP_RATELIMIT  */
-  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 193,   /* VAR_IP_RATELIMIT_SLABS  */
-  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 194,    /* VAR_IP_RATELIMIT_SIZE  */
-  YYSYMBOL_VAR_RATELIMIT = 195,            /* VAR_RATELIMIT  */
-  YYSYMBOL_VAR_RATELIMIT_SLABS = 196,      /* VAR_RATELIMIT_SLABS  */
-  YYSYMBOL_VAR_RATELIMIT_SIZE = 197,       /* VAR_RATELIMIT_SIZE  */
-  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 198, /* VAR_RATELIMIT_FOR_DOMAIN  */
-  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 199, /* VAR_RATELIMIT_BELOW_DOMAIN  */
-  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 200,  /* VAR_IP_RATELIMIT_FACTOR  */
-  YYSYMBOL_VAR_RATELIMIT_FACTOR = 201,     /* VAR_RATELIMIT_FACTOR  */
-  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 202,   /* VAR_SEND_CLIENT_SUBNET  */
-  YYSYMBOL_VAR_CLIENT_SUBNET_ZONE = 203,   /* VAR_CLIENT_SUBNET_ZONE  */
-  YYSYMBOL_VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 204, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
-  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 205, /* VAR_CLIENT_SUBNET_OPCODE  */
-  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 206, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
-  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 207, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
-  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV4 = 208, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
-  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV6 = 209, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
-  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV4 = 210, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
-  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV6 = 211, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
-  YYSYMBOL_VAR_CAPS_WHITELIST = 212,       /* VAR_CAPS_WHITELIST  */
-  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 213, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
-  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 214, /* VAR_PERMIT_SMALL_HOLDDOWN  */
-  YYSYMBOL_VAR_QNAME_MINIMISATION = 215,   /* VAR_QNAME_MINIMISATION  */
-  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 216, /* VAR_QNAME_MINIMISATION_STRICT  */
-  YYSYMBOL_VAR_IP_FREEBIND = 217,          /* VAR_IP_FREEBIND  */
-  YYSYMBOL_VAR_DEFINE_TAG = 218,           /* VAR_DEFINE_TAG  */
-  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 219,       /* VAR_LOCAL_ZONE_TAG  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 220,   /* VAR_ACCESS_CONTROL_TAG  */
-  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 221,  /* VAR_LOCAL_ZONE_OVERRIDE  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 222, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 223, /* VAR_ACCESS_CONTROL_TAG_DATA  */
-  YYSYMBOL_VAR_VIEW = 224,                 /* VAR_VIEW  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 225,  /* VAR_ACCESS_CONTROL_VIEW  */
-  YYSYMBOL_VAR_VIEW_FIRST = 226,           /* VAR_VIEW_FIRST  */
-  YYSYMBOL_VAR_SERVE_EXPIRED = 227,        /* VAR_SERVE_EXPIRED  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_TTL = 228,    /* VAR_SERVE_EXPIRED_TTL  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_TTL_RESET = 229, /* VAR_SERVE_EXPIRED_TTL_RESET  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_REPLY_TTL = 230, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 231, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
-  YYSYMBOL_VAR_SERVE_ORIGINAL_TTL = 232,   /* VAR_SERVE_ORIGINAL_TTL  */
-  YYSYMBOL_VAR_FAKE_DSA = 233,             /* VAR_FAKE_DSA  */
-  YYSYMBOL_VAR_FAKE_SHA1 = 234,            /* VAR_FAKE_SHA1  */
-  YYSYMBOL_VAR_LOG_IDENTITY = 235,         /* VAR_LOG_IDENTITY  */
-  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 236,     /* VAR_HIDE_TRUSTANCHOR  */
-  YYSYMBOL_VAR_TRUST_ANCHOR_SIGNALING = 237, /* VAR_TRUST_ANCHOR_SIGNALING  */
-  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 238,      /* VAR_AGGRESSIVE_NSEC  */
-  YYSYMBOL_VAR_USE_SYSTEMD = 239,          /* VAR_USE_SYSTEMD  */
-  YYSYMBOL_VAR_SHM_ENABLE = 240,           /* VAR_SHM_ENABLE  */
-  YYSYMBOL_VAR_SHM_KEY = 241,              /* VAR_SHM_KEY  */
-  YYSYMBOL_VAR_ROOT_KEY_SENTINEL = 242,    /* VAR_ROOT_KEY_SENTINEL  */
-  YYSYMBOL_VAR_DNSCRYPT = 243,             /* VAR_DNSCRYPT  */
-  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 244,      /* VAR_DNSCRYPT_ENABLE  */
-  YYSYMBOL_VAR_DNSCRYPT_PORT = 245,        /* VAR_DNSCRYPT_PORT  */
-  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 246,    /* VAR_DNSCRYPT_PROVIDER  */
-  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 247,  /* VAR_DNSCRYPT_SECRET_KEY  */
-  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 248, /* VAR_DNSCRYPT_PROVIDER_CERT  */
-  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 249, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
-  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 250, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
-  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 251, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
-  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SIZE = 252, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
-  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SLABS = 253, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
-  YYSYMBOL_VAR_PAD_RESPONSES = 254,        /* VAR_PAD_RESPONSES  */
-  YYSYMBOL_VAR_PAD_RESPONSES_BLOCK_SIZE = 255, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
-  YYSYMBOL_VAR_PAD_QUERIES = 256,          /* VAR_PAD_QUERIES  */
-  YYSYMBOL_VAR_PAD_QUERIES_BLOCK_SIZE = 257, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
-  YYSYMBOL_VAR_IPSECMOD_ENABLED = 258,     /* VAR_IPSECMOD_ENABLED  */
-  YYSYMBOL_VAR_IPSECMOD_HOOK = 259,        /* VAR_IPSECMOD_HOOK  */
-  YYSYMBOL_VAR_IPSECMOD_IGNORE_BOGUS = 260, /* VAR_IPSECMOD_IGNORE_BOGUS  */
-  YYSYMBOL_VAR_IPSECMOD_MAX_TTL = 261,     /* VAR_IPSECMOD_MAX_TTL  */
-  YYSYMBOL_VAR_IPSECMOD_WHITELIST = 262,   /* VAR_IPSECMOD_WHITELIST  */
-  YYSYMBOL_VAR_IPSECMOD_STRICT = 263,      /* VAR_IPSECMOD_STRICT  */
-  YYSYMBOL_VAR_CACHEDB = 264,              /* VAR_CACHEDB  */
-  YYSYMBOL_VAR_CACHEDB_BACKEND = 265,      /* VAR_CACHEDB_BACKEND  */
-  YYSYMBOL_VAR_CACHEDB_SECRETSEED = 266,   /* VAR_CACHEDB_SECRETSEED  */
-  YYSYMBOL_VAR_CACHEDB_REDISHOST = 267,    /* VAR_CACHEDB_REDISHOST  */
-  YYSYMBOL_VAR_CACHEDB_REDISPORT = 268,    /* VAR_CACHEDB_REDISPORT  */
-  YYSYMBOL_VAR_CACHEDB_REDISTIMEOUT = 269, /* VAR_CACHEDB_REDISTIMEOUT  */
-  YYSYMBOL_VAR_CACHEDB_REDISEXPIRERECORDS = 270, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
-  YYSYMBOL_VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 271, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
-  YYSYMBOL_VAR_FOR_UPSTREAM = 272,         /* VAR_FOR_UPSTREAM  */
-  YYSYMBOL_VAR_AUTH_ZONE = 273,            /* VAR_AUTH_ZONE  */
-  YYSYMBOL_VAR_ZONEFILE = 274,             /* VAR_ZONEFILE  */
-  YYSYMBOL_VAR_MASTER = 275,               /* VAR_MASTER  */
-  YYSYMBOL_VAR_URL = 276,                  /* VAR_URL  */
-  YYSYMBOL_VAR_FOR_DOWNSTREAM = 277,       /* VAR_FOR_DOWNSTREAM  */
-  YYSYMBOL_VAR_FALLBACK_ENABLED = 278,     /* VAR_FALLBACK_ENABLED  */
-  YYSYMBOL_VAR_TLS_ADDITIONAL_PORT = 279,  /* VAR_TLS_ADDITIONAL_PORT  */
-  YYSYMBOL_VAR_LOW_RTT = 280,              /* VAR_LOW_RTT  */
-  YYSYMBOL_VAR_LOW_RTT_PERMIL = 281,       /* VAR_LOW_RTT_PERMIL  */
-  YYSYMBOL_VAR_FAST_SERVER_PERMIL = 282,   /* VAR_FAST_SERVER_PERMIL  */
-  YYSYMBOL_VAR_FAST_SERVER_NUM = 283,      /* VAR_FAST_SERVER_NUM  */
-  YYSYMBOL_VAR_ALLOW_NOTIFY = 284,         /* VAR_ALLOW_NOTIFY  */
-  YYSYMBOL_VAR_TLS_WIN_CERT = 285,         /* VAR_TLS_WIN_CERT  */
-  YYSYMBOL_VAR_TCP_CONNECTION_LIMIT = 286, /* VAR_TCP_CONNECTION_LIMIT  */
-  YYSYMBOL_VAR_FORWARD_NO_CACHE = 287,     /* VAR_FORWARD_NO_CACHE  */
-  YYSYMBOL_VAR_STUB_NO_CACHE = 288,        /* VAR_STUB_NO_CACHE  */
-  YYSYMBOL_VAR_LOG_SERVFAIL = 289,         /* VAR_LOG_SERVFAIL  */
-  YYSYMBOL_VAR_DENY_ANY = 290,             /* VAR_DENY_ANY  */
-  YYSYMBOL_VAR_UNKNOWN_SERVER_TIME_LIMIT = 291, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
-  YYSYMBOL_VAR_LOG_TAG_QUERYREPLY = 292,   /* VAR_LOG_TAG_QUERYREPLY  */
-  YYSYMBOL_VAR_STREAM_WAIT_SIZE = 293,     /* VAR_STREAM_WAIT_SIZE  */
-  YYSYMBOL_VAR_TLS_CIPHERS = 294,          /* VAR_TLS_CIPHERS  */
-  YYSYMBOL_VAR_TLS_CIPHERSUITES = 295,     /* VAR_TLS_CIPHERSUITES  */
-  YYSYMBOL_VAR_TLS_USE_SNI = 296,          /* VAR_TLS_USE_SNI  */
-  YYSYMBOL_VAR_IPSET = 297,                /* VAR_IPSET  */
-  YYSYMBOL_VAR_IPSET_NAME_V4 = 298,        /* VAR_IPSET_NAME_V4  */
-  YYSYMBOL_VAR_IPSET_NAME_V6 = 299,        /* VAR_IPSET_NAME_V6  */
-  YYSYMBOL_VAR_TLS_SESSION_TICKET_KEYS = 300, /* VAR_TLS_SESSION_TICKET_KEYS  */
-  YYSYMBOL_VAR_RPZ = 301,                  /* VAR_RPZ  */
-  YYSYMBOL_VAR_TAGS = 302,                 /* VAR_TAGS  */
-  YYSYMBOL_VAR_RPZ_ACTION_OVERRIDE = 303,  /* VAR_RPZ_ACTION_OVERRIDE  */
-  YYSYMBOL_VAR_RPZ_CNAME_OVERRIDE = 304,   /* VAR_RPZ_CNAME_OVERRIDE  */
-  YYSYMBOL_VAR_RPZ_LOG = 305,              /* VAR_RPZ_LOG  */
-  YYSYMBOL_VAR_RPZ_LOG_NAME = 306,         /* VAR_RPZ_LOG_NAME  */
-  YYSYMBOL_VAR_DYNLIB = 307,               /* VAR_DYNLIB  */
-  YYSYMBOL_VAR_DYNLIB_FILE = 308,          /* VAR_DYNLIB_FILE  */
-  YYSYMBOL_VAR_EDNS_CLIENT_STRING = 309,   /* VAR_EDNS_CLIENT_STRING  */
-  YYSYMBOL_VAR_EDNS_CLIENT_STRING_OPCODE = 310, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
-  YYSYMBOL_VAR_NSID = 311,                 /* VAR_NSID  */
-  YYSYMBOL_VAR_ZONEMD_PERMISSIVE_MODE = 312, /* VAR_ZONEMD_PERMISSIVE_MODE  */
-  YYSYMBOL_VAR_ZONEMD_REJECT_ABSENCE = 313, /* VAR_ZONEMD_REJECT_ABSENCE  */
-  YYSYMBOL_YYACCEPT = 314,                 /* $accept  */
-  YYSYMBOL_toplevelvars = 315,             /* toplevelvars  */
-  YYSYMBOL_toplevelvar = 316,              /* toplevelvar  */
-  YYSYMBOL_force_toplevel = 317,           /* force_toplevel  */
-  YYSYMBOL_serverstart = 318,              /* serverstart  */
-  YYSYMBOL_contents_server = 319,          /* contents_server  */
-  YYSYMBOL_content_server = 320,           /* content_server  */
-  YYSYMBOL_stubstart = 321,                /* stubstart  */
-  YYSYMBOL_contents_stub = 322,            /* contents_stub  */
-  YYSYMBOL_content_stub = 323,             /* content_stub  */
-  YYSYMBOL_forwardstart = 324,             /* forwardstart  */
-  YYSYMBOL_contents_forward = 325,         /* contents_forward  */
-  YYSYMBOL_content_forward = 326,          /* content_forward  */
-  YYSYMBOL_viewstart = 327,                /* viewstart  */
-  YYSYMBOL_contents_view = 328,            /* contents_view  */
-  YYSYMBOL_content_view = 329,             /* content_view  */
-  YYSYMBOL_authstart = 330,                /* authstart  */
-  YYSYMBOL_contents_auth = 331,            /* contents_auth  */
-  YYSYMBOL_content_auth = 332,             /* content_auth  */
-  YYSYMBOL_rpz_tag = 333,                  /* rpz_tag  */
-  YYSYMBOL_rpz_action_override = 334,      /* rpz_action_override  */
-  YYSYMBOL_rpz_cname_override = 335,       /* rpz_cname_override  */
-  YYSYMBOL_rpz_log = 336,                  /* rpz_log  */
-  YYSYMBOL_rpz_log_name = 337,             /* rpz_log_name  */
-  YYSYMBOL_rpzstart = 338,                 /* rpzstart  */
-  YYSYMBOL_contents_rpz = 339,             /* contents_rpz  */
-  YYSYMBOL_content_rpz = 340,              /* content_rpz  */
-  YYSYMBOL_server_num_threads = 341,       /* server_num_threads  */
-  YYSYMBOL_server_verbosity = 342,         /* server_verbosity  */
-  YYSYMBOL_server_statistics_interval = 343, /* server_statistics_interval  */
-  YYSYMBOL_server_statistics_cumulative = 344, /* server_statistics_cumulative  */
-  YYSYMBOL_server_extended_statistics = 345, /* server_extended_statistics  */
-  YYSYMBOL_server_shm_enable = 346,        /* server_shm_enable  */
-  YYSYMBOL_server_shm_key = 347,           /* server_shm_key  */
-  YYSYMBOL_server_port = 348,              /* server_port  */
-  YYSYMBOL_server_send_client_subnet = 349, /* server_send_client_subnet  */
-  YYSYMBOL_server_client_subnet_zone = 350, /* server_client_subnet_zone  */
-  YYSYMBOL_server_client_subnet_always_forward = 351, /* server_client_subnet_always_forward  */
-  YYSYMBOL_server_client_subnet_opcode = 352, /* server_client_subnet_opcode  */
-  YYSYMBOL_server_max_client_subnet_ipv4 = 353, /* server_max_client_subnet_ipv4  */
-  YYSYMBOL_server_max_client_subnet_ipv6 = 354, /* server_max_client_subnet_ipv6  */
-  YYSYMBOL_server_min_client_subnet_ipv4 = 355, /* server_min_client_subnet_ipv4  */
-  YYSYMBOL_server_min_client_subnet_ipv6 = 356, /* server_min_client_subnet_ipv6  */
-  YYSYMBOL_server_max_ecs_tree_size_ipv4 = 357, /* server_max_ecs_tree_size_ipv4  */
-  YYSYMBOL_server_max_ecs_tree_size_ipv6 = 358, /* server_max_ecs_tree_size_ipv6  */
-  YYSYMBOL_server_interface = 359,         /* server_interface  */
-  YYSYMBOL_server_outgoing_interface = 360, /* server_outgoing_interface  */
-  YYSYMBOL_server_outgoing_range = 361,    /* server_outgoing_range  */
-  YYSYMBOL_server_outgoing_port_permit = 362, /* server_outgoing_port_permit  */
-  YYSYMBOL_server_outgoing_port_avoid = 363, /* server_outgoing_port_avoid  */
-  YYSYMBOL_server_outgoing_num_tcp = 364,  /* server_outgoing_num_tcp  */
-  YYSYMBOL_server_incoming_num_tcp = 365,  /* server_incoming_num_tcp  */
-  YYSYMBOL_server_interface_automatic = 366, /* server_interface_automatic  */
-  YYSYMBOL_server_do_ip4 = 367,            /* server_do_ip4  */
-  YYSYMBOL_server_do_ip6 = 368,            /* server_do_ip6  */
-  YYSYMBOL_server_do_udp = 369,            /* server_do_udp  */
-  YYSYMBOL_server_do_tcp = 370,            /* server_do_tcp  */
-  YYSYMBOL_server_prefer_ip4 = 371,        /* server_prefer_ip4  */
-  YYSYMBOL_server_prefer_ip6 = 372,        /* server_prefer_ip6  */
-  YYSYMBOL_server_tcp_mss = 373,           /* server_tcp_mss  */
-  YYSYMBOL_server_outgoing_tcp_mss = 374,  /* server_outgoing_tcp_mss  */
-  YYSYMBOL_server_tcp_idle_timeout = 375,  /* server_tcp_idle_timeout  */
-  YYSYMBOL_server_max_reuse_tcp_queries = 376, /* server_max_reuse_tcp_queries  */
-  YYSYMBOL_server_tcp_reuse_timeout = 377, /* server_tcp_reuse_timeout  */
-  YYSYMBOL_server_tcp_auth_query_timeout = 378, /* server_tcp_auth_query_timeout  */
-  YYSYMBOL_server_tcp_keepalive = 379,     /* server_tcp_keepalive  */
-  YYSYMBOL_server_tcp_keepalive_timeout = 380, /* server_tcp_keepalive_timeout  */
-  YYSYMBOL_server_tcp_upstream = 381,      /* server_tcp_upstream  */
-  YYSYMBOL_server_udp_upstream_without_downstream = 382, /* server_udp_upstream_without_downstream  */
-  YYSYMBOL_server_ssl_upstream = 383,      /* server_ssl_upstream  */
-  YYSYMBOL_server_ssl_service_key = 384,   /* server_ssl_service_key  */
-  YYSYMBOL_server_ssl_service_pem = 385,   /* server_ssl_service_pem  */
-  YYSYMBOL_server_ssl_port = 386,          /* server_ssl_port  */
-  YYSYMBOL_server_tls_cert_bundle = 387,   /* server_tls_cert_bundle  */
-  YYSYMBOL_server_tls_win_cert = 388,      /* server_tls_win_cert  */
-  YYSYMBOL_server_tls_additional_port = 389, /* server_tls_additional_port  */
-  YYSYMBOL_server_tls_ciphers = 390,       /* server_tls_ciphers  */
-  YYSYMBOL_server_tls_ciphersuites = 391,  /* server_tls_ciphersuites  */
-  YYSYMBOL_server_tls_session_ticket_keys = 392, /* server_tls_session_ticket_keys  */
-  YYSYMBOL_server_tls_use_sni = 393,       /* server_tls_use_sni  */
-  YYSYMBOL_server_https_port = 394,        /* server_https_port  */
-  YYSYMBOL_server_http_endpoint = 395,     /* server_http_endpoint  */
-  YYSYMBOL_server_http_max_streams = 396,  /* server_http_max_streams  */
-  YYSYMBOL_server_http_query_buffer_size = 397, /* server_http_query_buffer_size  */
-  YYSYMBOL_server_http_response_buffer_size = 398, /* server_http_response_buffer_size  */
-  YYSYMBOL_server_http_nodelay = 399,      /* server_http_nodelay  */
-  YYSYMBOL_server_http_notls_downstream = 400, /* server_http_notls_downstream  */
-  YYSYMBOL_server_use_systemd = 401,       /* server_use_systemd  */
-  YYSYMBOL_server_do_daemonize = 402,      /* server_do_daemonize  */
-  YYSYMBOL_server_use_syslog = 403,        /* server_use_syslog  */
-  YYSYMBOL_server_log_time_ascii = 404,    /* server_log_time_ascii  */
-  YYSYMBOL_server_log_queries = 405,       /* server_log_queries  */
-  YYSYMBOL_server_log_replies = 406,       /* server_log_replies  */
-  YYSYMBOL_server_log_tag_queryreply = 407, /* server_log_tag_queryreply  */
-  YYSYMBOL_server_log_servfail = 408,      /* server_log_servfail  */
-  YYSYMBOL_server_log_local_actions = 409, /* server_log_local_actions  */
-  YYSYMBOL_server_chroot = 410,            /* server_chroot  */
-  YYSYMBOL_server_username = 411,          /* server_username  */
-  YYSYMBOL_server_directory = 412,         /* server_directory  */
-  YYSYMBOL_server_logfile = 413,           /* server_logfile  */
-  YYSYMBOL_server_pidfile = 414,           /* server_pidfile  */
-  YYSYMBOL_server_root_hints = 415,        /* server_root_hints  */
-  YYSYMBOL_server_dlv_anchor_file = 416,   /* server_dlv_anchor_file  */
-  YYSYMBOL_server_dlv_anchor = 417,        /* server_dlv_anchor  */
-  YYSYMBOL_server_auto_trust_anchor_file = 418, /* server_auto_trust_anchor_file  */
-  YYSYMBOL_server_trust_anchor_file = 419, /* server_trust_anchor_file  */
-  YYSYMBOL_server_trusted_keys_file = 420, /* server_trusted_keys_file  */
-  YYSYMBOL_server_trust_anchor = 421,      /* server_trust_anchor  */
-  YYSYMBOL_server_trust_anchor_signaling = 422, /* server_trust_anchor_signaling  */
-  YYSYMBOL_server_root_key_sentinel = 423, /* server_root_key_sentinel  */
-  YYSYMBOL_server_domain_insecure = 424,   /* server_domain_insecure  */
-  YYSYMBOL_server_hide_identity = 425,     /* server_hide_identity  */
-  YYSYMBOL_server_hide_version = 426,      /* server_hide_version  */
-  YYSYMBOL_server_hide_trustanchor = 427,  /* server_hide_trustanchor  */
-  YYSYMBOL_server_identity = 428,          /* server_identity  */
-  YYSYMBOL_server_version = 429,           /* server_version  */
-  YYSYMBOL_server_nsid = 430,              /* server_nsid  */
-  YYSYMBOL_server_so_rcvbuf = 431,         /* server_so_rcvbuf  */
-  YYSYMBOL_server_so_sndbuf = 432,         /* server_so_sndbuf  */
-  YYSYMBOL_server_so_reuseport = 433,      /* server_so_reuseport  */
-  YYSYMBOL_server_ip_transparent = 434,    /* server_ip_transparent  */
-  YYSYMBOL_server_ip_freebind = 435,       /* server_ip_freebind  */
-  YYSYMBOL_server_ip_dscp = 436,           /* server_ip_dscp  */
-  YYSYMBOL_server_stream_wait_size = 437,  /* server_stream_wait_size  */
-  YYSYMBOL_server_edns_buffer_size = 438,  /* server_edns_buffer_size  */
-  YYSYMBOL_server_msg_buffer_size = 439,   /* server_msg_buffer_size  */
-  YYSYMBOL_server_msg_cache_size = 440,    /* server_msg_cache_size  */
-  YYSYMBOL_server_msg_cache_slabs = 441,   /* server_msg_cache_slabs  */
-  YYSYMBOL_server_num_queries_per_thread = 442, /* server_num_queries_per_thread  */
-  YYSYMBOL_server_jostle_timeout = 443,    /* server_jostle_timeout  */
-  YYSYMBOL_server_delay_close = 444,       /* server_delay_close  */
-  YYSYMBOL_server_udp_connect = 445,       /* server_udp_connect  */
-  YYSYMBOL_server_unblock_lan_zones = 446, /* server_unblock_lan_zones  */
-  YYSYMBOL_server_insecure_lan_zones = 447, /* server_insecure_lan_zones  */
-  YYSYMBOL_server_rrset_cache_size = 448,  /* server_rrset_cache_size  */
-  YYSYMBOL_server_rrset_cache_slabs = 449, /* server_rrset_cache_slabs  */
-  YYSYMBOL_server_infra_host_ttl = 450,    /* server_infra_host_ttl  */
-  YYSYMBOL_server_infra_lame_ttl = 451,    /* server_infra_lame_ttl  */
-  YYSYMBOL_server_infra_cache_numhosts = 452, /* server_infra_cache_numhosts  */
-  YYSYMBOL_server_infra_cache_lame_size = 453, /* server_infra_cache_lame_size  */
-  YYSYMBOL_server_infra_cache_slabs = 454, /* server_infra_cache_slabs  */
-  YYSYMBOL_server_infra_cache_min_rtt = 455, /* server_infra_cache_min_rtt  */
-  YYSYMBOL_server_infra_keep_probing = 456, /* server_infra_keep_probing  */
-  YYSYMBOL_server_target_fetch_policy = 457, /* server_target_fetch_policy  */
-  YYSYMBOL_server_harden_short_bufsize = 458, /* server_harden_short_bufsize  */
-  YYSYMBOL_server_harden_large_queries = 459, /* server_harden_large_queries  */
-  YYSYMBOL_server_harden_glue = 460,       /* server_harden_glue  */
-  YYSYMBOL_server_harden_dnssec_stripped = 461, /* server_harden_dnssec_stripped  */
-  YYSYMBOL_server_harden_below_nxdomain = 462, /* server_harden_below_nxdomain  */
-  YYSYMBOL_server_harden_referral_path = 463, /* server_harden_referral_path  */
-  YYSYMBOL_server_harden_algo_downgrade = 464, /* server_harden_algo_downgrade  */
-  YYSYMBOL_server_use_caps_for_id = 465,   /* server_use_caps_for_id  */
-  YYSYMBOL_server_caps_whitelist = 466,    /* server_caps_whitelist  */
-  YYSYMBOL_server_private_address = 467,   /* server_private_address  */
-  YYSYMBOL_server_private_domain = 468,    /* server_private_domain  */
-  YYSYMBOL_server_prefetch = 469,          /* server_prefetch  */
-  YYSYMBOL_server_prefetch_key = 470,      /* server_prefetch_key  */
-  YYSYMBOL_server_deny_any = 471,          /* server_deny_any  */
-  YYSYMBOL_server_unwanted_reply_threshold = 472, /* server_unwanted_reply_threshold  */
-  YYSYMBOL_server_do_not_query_address = 473, /* server_do_not_query_address  */
-  YYSYMBOL_server_do_not_query_localhost = 474, /* server_do_not_query_localhost  */
-  YYSYMBOL_server_access_control = 475,    /* server_access_control  */
-  YYSYMBOL_server_module_conf = 476,       /* server_module_conf  */
-  YYSYMBOL_server_val_override_date = 477, /* server_val_override_date  */
-  YYSYMBOL_server_val_sig_skew_min = 478,  /* server_val_sig_skew_min  */
-  YYSYMBOL_server_val_sig_skew_max = 479,  /* server_val_sig_skew_max  */
-  YYSYMBOL_server_cache_max_ttl = 480,     /* server_cache_max_ttl  */
-  YYSYMBOL_server_cache_max_negative_ttl = 481, /* server_cache_max_negative_ttl  */
-  YYSYMBOL_server_cache_min_ttl = 482,     /* server_cache_min_ttl  */
-  YYSYMBOL_server_bogus_ttl = 483,         /* server_bogus_ttl  */
-  YYSYMBOL_server_val_clean_additional = 484, /* server_val_clean_additional  */
-  YYSYMBOL_server_val_permissive_mode = 485, /* server_val_permissive_mode  */
-  YYSYMBOL_server_aggressive_nsec = 486,   /* server_aggressive_nsec  */
-  YYSYMBOL_server_ignore_cd_flag = 487,    /* server_ignore_cd_flag  */
-  YYSYMBOL_server_serve_expired = 488,     /* server_serve_expired  */
-  YYSYMBOL_server_serve_expired_ttl = 489, /* server_serve_expired_ttl  */
-  YYSYMBOL_server_serve_expired_ttl_reset = 490, /* server_serve_expired_ttl_reset  */
-  YYSYMBOL_server_serve_expired_reply_ttl = 491, /* server_serve_expired_reply_ttl  */
-  YYSYMBOL_server_serve_expired_client_timeout = 492, /* server_serve_expired_client_timeout  */
-  YYSYMBOL_server_serve_original_ttl = 493, /* server_serve_original_ttl  */
-  YYSYMBOL_server_fake_dsa = 494,          /* server_fake_dsa  */
-  YYSYMBOL_server_fake_sha1 = 495,         /* server_fake_sha1  */
-  YYSYMBOL_server_val_log_level = 496,     /* server_val_log_level  */
-  YYSYMBOL_server_val_nsec3_keysize_iterations = 497, /* server_val_nsec3_keysize_iterations  */
-  YYSYMBOL_server_zonemd_permissive_mode = 498, /* server_zonemd_permissive_mode  */
-  YYSYMBOL_server_add_holddown = 499,      /* server_add_holddown  */
-  YYSYMBOL_server_del_holddown = 500,      /* server_del_holddown  */
-  YYSYMBOL_server_keep_missing = 501,      /* server_keep_missing  */
-  YYSYMBOL_server_permit_small_holddown = 502, /* server_permit_small_holddown  */
-  YYSYMBOL_server_key_cache_size = 503,    /* server_key_cache_size  */
-  YYSYMBOL_server_key_cache_slabs = 504,   /* server_key_cache_slabs  */
-  YYSYMBOL_server_neg_cache_size = 505,    /* server_neg_cache_size  */
-  YYSYMBOL_server_local_zone = 506,        /* server_local_zone  */
-  YYSYMBOL_server_local_data = 507,        /* server_local_data  */
-  YYSYMBOL_server_local_data_ptr = 508,    /* server_local_data_ptr  */
-  YYSYMBOL_server_minimal_responses = 509, /* server_minimal_responses  */
-  YYSYMBOL_server_rrset_roundrobin = 510,  /* server_rrset_roundrobin  */
-  YYSYMBOL_server_unknown_server_time_limit = 511, /* server_unknown_server_time_limit  */
-  YYSYMBOL_server_max_udp_size = 512,      /* server_max_udp_size  */
-  YYSYMBOL_server_dns64_prefix = 513,      /* server_dns64_prefix  */
-  YYSYMBOL_server_dns64_synthall = 514,    /* server_dns64_synthall  */
-  YYSYMBOL_server_dns64_ignore_aaaa = 515, /* server_dns64_ignore_aaaa  */
-  YYSYMBOL_server_define_tag = 516,        /* server_define_tag  */
-  YYSYMBOL_server_local_zone_tag = 517,    /* server_local_zone_tag  */
-  YYSYMBOL_server_access_control_tag = 518, /* server_access_control_tag  */
-  YYSYMBOL_server_access_control_tag_action = 519, /* server_access_control_tag_action  */
-  YYSYMBOL_server_access_control_tag_data = 520, /* server_access_control_tag_data  */
-  YYSYMBOL_server_local_zone_override = 521, /* server_local_zone_override  */
-  YYSYMBOL_server_access_control_view = 522, /* server_access_control_view  */
-  YYSYMBOL_server_response_ip_tag = 523,   /* server_response_ip_tag  */
-  YYSYMBOL_server_ip_ratelimit = 524,      /* server_ip_ratelimit  */
-  YYSYMBOL_server_ratelimit = 525,         /* server_ratelimit  */
-  YYSYMBOL_server_ip_ratelimit_size = 526, /* server_ip_ratelimit_size  */
-  YYSYMBOL_server_ratelimit_size = 527,    /* server_ratelimit_size  */
-  YYSYMBOL_server_ip_ratelimit_slabs = 528, /* server_ip_ratelimit_slabs  */
-  YYSYMBOL_server_ratelimit_slabs = 529,   /* server_ratelimit_slabs  */
-  YYSYMBOL_server_ratelimit_for_domain = 530, /* server_ratelimit_for_domain  */
-  YYSYMBOL_server_ratelimit_below_domain = 531, /* server_ratelimit_below_domain  */
-  YYSYMBOL_server_ip_ratelimit_factor = 532, /* server_ip_ratelimit_factor  */
-  YYSYMBOL_server_ratelimit_factor = 533,  /* server_ratelimit_factor  */
-  YYSYMBOL_server_low_rtt = 534,           /* server_low_rtt  */
-  YYSYMBOL_server_fast_server_num = 535,   /* server_fast_server_num  */
-  YYSYMBOL_server_fast_server_permil = 536, /* server_fast_server_permil  */
-  YYSYMBOL_server_qname_minimisation = 537, /* server_qname_minimisation  */
-  YYSYMBOL_server_qname_minimisation_strict = 538, /* server_qname_minimisation_strict  */
-  YYSYMBOL_server_pad_responses = 539,     /* server_pad_responses  */
-  YYSYMBOL_server_pad_responses_block_size = 540, /* server_pad_responses_block_size  */
-  YYSYMBOL_server_pad_queries = 541,       /* server_pad_queries  */
-  YYSYMBOL_server_pad_queries_block_size = 542, /* server_pad_queries_block_size  */
-  YYSYMBOL_server_ipsecmod_enabled = 543,  /* server_ipsecmod_enabled  */
-  YYSYMBOL_server_ipsecmod_ignore_bogus = 544, /* server_ipsecmod_ignore_bogus  */
-  YYSYMBOL_server_ipsecmod_hook = 545,     /* server_ipsecmod_hook  */
-  YYSYMBOL_server_ipsecmod_max_ttl = 546,  /* server_ipsecmod_max_ttl  */
-  YYSYMBOL_server_ipsecmod_whitelist = 547, /* server_ipsecmod_whitelist  */
-  YYSYMBOL_server_ipsecmod_strict = 548,   /* server_ipsecmod_strict  */
-  YYSYMBOL_server_edns_client_string = 549, /* server_edns_client_string  */
-  YYSYMBOL_server_edns_client_string_opcode = 550, /* server_edns_client_string_opcode  */
-  YYSYMBOL_stub_name = 551,                /* stub_name  */
-  YYSYMBOL_stub_host = 552,                /* stub_host  */
-  YYSYMBOL_stub_addr = 553,                /* stub_addr  */
-  YYSYMBOL_stub_first = 554,               /* stub_first  */
-  YYSYMBOL_stub_no_cache = 555,            /* stub_no_cache  */
-  YYSYMBOL_stub_ssl_upstream = 556,        /* stub_ssl_upstream  */
-  YYSYMBOL_stub_prime = 557,               /* stub_prime  */
-  YYSYMBOL_forward_name = 558,             /* forward_name  */
-  YYSYMBOL_forward_host = 559,             /* forward_host  */
-  YYSYMBOL_forward_addr = 560,             /* forward_addr  */
-  YYSYMBOL_forward_first = 561,            /* forward_first  */
-  YYSYMBOL_forward_no_cache = 562,         /* forward_no_cache  */
-  YYSYMBOL_forward_ssl_upstream = 563,     /* forward_ssl_upstream  */
-  YYSYMBOL_auth_name = 564,                /* auth_name  */
-  YYSYMBOL_auth_zonefile = 565,            /* auth_zonefile  */
-  YYSYMBOL_auth_master = 566,              /* auth_master  */
-  YYSYMBOL_auth_url = 567,                 /* auth_url  */
-  YYSYMBOL_auth_allow_notify = 568,        /* auth_allow_notify  */
-  YYSYMBOL_auth_zonemd_reject_absence = 569, /* auth_zonemd_reject_absence  */
-  YYSYMBOL_auth_for_downstream = 570,      /* auth_for_downstream  */
-  YYSYMBOL_auth_for_upstream = 571,        /* auth_for_upstream  */
-  YYSYMBOL_auth_fallback_enabled = 572,    /* auth_fallback_enabled  */
-  YYSYMBOL_view_name = 573,                /* view_name  */
-  YYSYMBOL_view_local_zone = 574,          /* view_local_zone  */
-  YYSYMBOL_view_response_ip = 575,         /* view_response_ip  */
-  YYSYMBOL_view_response_ip_data = 576,    /* view_response_ip_data  */
-  YYSYMBOL_view_local_data = 577,          /* view_local_data  */
-  YYSYMBOL_view_local_data_ptr = 578,      /* view_local_data_ptr  */
-  YYSYMBOL_view_first = 579,               /* view_first  */
-  YYSYMBOL_rcstart = 580,                  /* rcstart  */
-  YYSYMBOL_contents_rc = 581,              /* contents_rc  */
-  YYSYMBOL_content_rc = 582,               /* content_rc  */
-  YYSYMBOL_rc_control_enable = 583,        /* rc_control_enable  */
-  YYSYMBOL_rc_control_port = 584,          /* rc_control_port  */
-  YYSYMBOL_rc_control_interface = 585,     /* rc_control_interface  */
-  YYSYMBOL_rc_control_use_cert = 586,      /* rc_control_use_cert  */
-  YYSYMBOL_rc_server_key_file = 587,       /* rc_server_key_file  */
-  YYSYMBOL_rc_server_cert_file = 588,      /* rc_server_cert_file  */
-  YYSYMBOL_rc_control_key_file = 589,      /* rc_control_key_file  */
-  YYSYMBOL_rc_control_cert_file = 590,     /* rc_control_cert_file  */
-  YYSYMBOL_dtstart = 591,                  /* dtstart  */
-  YYSYMBOL_contents_dt = 592,              /* contents_dt  */
-  YYSYMBOL_content_dt = 593,               /* content_dt  */
-  YYSYMBOL_dt_dnstap_enable = 594,         /* dt_dnstap_enable  */
-  YYSYMBOL_dt_dnstap_bidirectional = 595,  /* dt_dnstap_bidirectional  */
-  YYSYMBOL_dt_dnstap_socket_path = 596,    /* dt_dnstap_socket_path  */
-  YYSYMBOL_dt_dnstap_ip = 597,             /* dt_dnstap_ip  */
-  YYSYMBOL_dt_dnstap_tls = 598,            /* dt_dnstap_tls  */
-  YYSYMBOL_dt_dnstap_tls_server_name = 599, /* dt_dnstap_tls_server_name  */
-  YYSYMBOL_dt_dnstap_tls_cert_bundle = 600, /* dt_dnstap_tls_cert_bundle  */
-  YYSYMBOL_dt_dnstap_tls_client_key_file = 601, /* dt_dnstap_tls_client_key_file  */
-  YYSYMBOL_dt_dnstap_tls_client_cert_file = 602, /* dt_dnstap_tls_client_cert_file  */
-  YYSYMBOL_dt_dnstap_send_identity = 603,  /* dt_dnstap_send_identity  */
-  YYSYMBOL_dt_dnstap_send_version = 604,   /* dt_dnstap_send_version  */
-  YYSYMBOL_dt_dnstap_identity = 605,       /* dt_dnstap_identity  */
-  YYSYMBOL_dt_dnstap_version = 606,        /* dt_dnstap_version  */
-  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 607, /* dt_dnstap_log_resolver_query_messages  */
-  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 608, /* dt_dnstap_log_resolver_response_messages  */
-  YYSYMBOL_dt_dnstap_log_client_query_messages = 609, /* dt_dnstap_log_client_query_messages  */
-  YYSYMBOL_dt_dnstap_log_client_response_messages = 610, /* dt_dnstap_log_client_response_messages  */
-  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 611, /* dt_dnstap_log_forwarder_query_messages  */
-  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 612, /* dt_dnstap_log_forwarder_response_messages  */
-  YYSYMBOL_pythonstart = 613,              /* pythonstart  */
-  YYSYMBOL_contents_py = 614,              /* contents_py  */
-  YYSYMBOL_content_py = 615,               /* content_py  */
-  YYSYMBOL_py_script = 616,                /* py_script  */
-  YYSYMBOL_dynlibstart = 617,              /* dynlibstart  */
-  YYSYMBOL_contents_dl = 618,              /* contents_dl  */
-  YYSYMBOL_content_dl = 619,               /* content_dl  */
-  YYSYMBOL_dl_file = 620,                  /* dl_file  */
-  YYSYMBOL_server_disable_dnssec_lame_check = 621, /* server_disable_dnssec_lame_check  */
-  YYSYMBOL_server_log_identity = 622,      /* server_log_identity  */
-  YYSYMBOL_server_response_ip = 623,       /* server_response_ip  */
-  YYSYMBOL_server_response_ip_data = 624,  /* server_response_ip_data  */
-  YYSYMBOL_dnscstart = 625,                /* dnscstart  */
-  YYSYMBOL_contents_dnsc = 626,            /* contents_dnsc  */
-  YYSYMBOL_content_dnsc = 627,             /* content_dnsc  */
-  YYSYMBOL_dnsc_dnscrypt_enable = 628,     /* dnsc_dnscrypt_enable  */
-  YYSYMBOL_dnsc_dnscrypt_port = 629,       /* dnsc_dnscrypt_port  */
-  YYSYMBOL_dnsc_dnscrypt_provider = 630,   /* dnsc_dnscrypt_provider  */
-  YYSYMBOL_dnsc_dnscrypt_provider_cert = 631, /* dnsc_dnscrypt_provider_cert  */
-  YYSYMBOL_dnsc_dnscrypt_provider_cert_rotated = 632, /* dnsc_dnscrypt_provider_cert_rotated  */
-  YYSYMBOL_dnsc_dnscrypt_secret_key = 633, /* dnsc_dnscrypt_secret_key  */
-  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_size = 634, /* dnsc_dnscrypt_shared_secret_cache_size  */
-  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_slabs = 635, /* dnsc_dnscrypt_shared_secret_cache_slabs  */
-  YYSYMBOL_dnsc_dnscrypt_nonce_cache_size = 636, /* dnsc_dnscrypt_nonce_cache_size  */
-  YYSYMBOL_dnsc_dnscrypt_nonce_cache_slabs = 637, /* dnsc_dnscrypt_nonce_cache_slabs  */
-  YYSYMBOL_cachedbstart = 638,             /* cachedbstart  */
-  YYSYMBOL_contents_cachedb = 639,         /* contents_cachedb  */
-  YYSYMBOL_content_cachedb = 640,          /* content_cachedb  */
-  YYSYMBOL_cachedb_backend_name = 641,     /* cachedb_backend_name  */
-  YYSYMBOL_cachedb_secret_seed = 642,      /* cachedb_secret_seed  */
-  YYSYMBOL_redis_server_host = 643,        /* redis_server_host  */
-  YYSYMBOL_redis_server_port = 644,        /* redis_server_port  */
-  YYSYMBOL_redis_timeout = 645,            /* redis_timeout  */
-  YYSYMBOL_redis_expire_records = 646,     /* redis_expire_records  */
-  YYSYMBOL_server_tcp_connection_limit = 647, /* server_tcp_connection_limit  */
-  YYSYMBOL_ipsetstart = 648,               /* ipsetstart  */
-  YYSYMBOL_contents_ipset = 649,           /* contents_ipset  */
-  YYSYMBOL_content_ipset = 650,            /* content_ipset  */
-  YYSYMBOL_ipset_name_v4 = 651,            /* ipset_name_v4  */
-  YYSYMBOL_ipset_name_v6 = 652             /* ipset_name_v6  */
+  YYSYMBOL_VAR_VAL_VERIFY_THREADS = 120,   /* VAR_VAL_VERIFY_THREADS  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 121, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 122,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 123,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 124,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 125,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 126,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 127,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 128,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 129,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 130,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 131, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 132,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 133,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_LOG_REPLIES = 134,          /* VAR_LOG_REPLIES  */
+  YYSYMBOL_VAR_LOG_LOCAL_ACTIONS = 135,    /* VAR_LOG_LOCAL_ACTIONS  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 136,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 137,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_TCP_AUTH_QUERY_TIMEOUT = 138, /* VAR_TCP_AUTH_QUERY_TIMEOUT  */
+  YYSYMBOL_VAR_TCP_UPSTREAM_POOL = 139,    /* VAR_TCP_UPSTREAM_POOL  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 140,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 141,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 142,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 143,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_SSL_UPSTREAM = 144,    /* VAR_STUB_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_FORWARD_SSL_UPSTREAM = 145, /* VAR_FORWARD_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_TLS_CERT_BUNDLE = 146,      /* VAR_TLS_CERT_BUNDLE  */
+  YYSYMBOL_VAR_HTTPS_PORT = 147,           /* VAR_HTTPS_PORT  */
+  YYSYMBOL_VAR_HTTP_ENDPOINT = 148,        /* VAR_HTTP_ENDPOINT  */
+  YYSYMBOL_VAR_HTTP_MAX_STREAMS = 149,     /* VAR_HTTP_MAX_STREAMS  */
+  YYSYMBOL_VAR_HTTP_QUERY_BUFFER_SIZE = 150, /* VAR_HTTP_QUERY_BUFFER_SIZE  */
+  YYSYMBOL_VAR_HTTP_RESPONSE_BUFFER_SIZE = 151, /* VAR_HTTP_RESPONSE_BUFFER_SIZE  */
+  YYSYMBOL_VAR_HTTP_NODELAY = 152,         /* VAR_HTTP_NODELAY  */
+  YYSYMBOL_VAR_HTTP_NOTLS_DOWNSTREAM = 153, /* VAR_HTTP_NOTLS_DOWNSTREAM  */
+  YYSYMBOL_VAR_STUB_FIRST = 154,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 155,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 156,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 157,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 158,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_UDP_CONNECT = 159,          /* VAR_UDP_CONNECT  */
+  YYSYMBOL_VAR_UDP_BATCH_SIZE = 160,       /* VAR_UDP_BATCH_SIZE  */
+  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 161,    /* VAR_UNBLOCK_LAN_ZONES  */
+  YYSYMBOL_VAR_INSECURE_LAN_ZONES = 162,   /* VAR_INSECURE_LAN_ZONES  */
+  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 163,  /* VAR_INFRA_CACHE_MIN_RTT  */
+  YYSYMBOL_VAR_INFRA_KEEP_PROBING = 164,   /* VAR_INFRA_KEEP_PROBING  */
+  YYSYMBOL_VAR_UDP_HEDGE = 165,            /* VAR_UDP_HEDGE  */
+  YYSYMBOL_VAR_UDP_HEDGE_PERCENTILE = 166, /* VAR_UDP_HEDGE_PERCENTILE  */
+  YYSYMBOL_VAR_UDP_HEDGE_MAX_RATE = 167,   /* VAR_UDP_HEDGE_MAX_RATE  */
+  YYSYMBOL_VAR_INFRA_SELECT_PERCENTILE = 168, /* VAR_INFRA_SELECT_PERCENTILE  */
+  YYSYMBOL_VAR_UDP_UPSTREAM_BATCH = 169,   /* VAR_UDP_UPSTREAM_BATCH  */
+  YYSYMBOL_VAR_UDP_CONNECT_POOL = 170,     /* VAR_UDP_CONNECT_POOL  */
+  YYSYMBOL_VAR_UDP_CONNECT_REUSE = 171,    /* VAR_UDP_CONNECT_REUSE  */
+  YYSYMBOL_VAR_USE_IO_URING = 172,         /* VAR_USE_IO_URING  */
+  YYSYMBOL_VAR_DNS64_PREFIX = 173,         /* VAR_DNS64_PREFIX  */
+  YYSYMBOL_VAR_DNS64_SYNTHALL = 174,       /* VAR_DNS64_SYNTHALL  */
+  YYSYMBOL_VAR_DNS64_IGNORE_AAAA = 175,    /* VAR_DNS64_IGNORE_AAAA  */
+  YYSYMBOL_VAR_DNSTAP = 176,               /* VAR_DNSTAP  */
+  YYSYMBOL_VAR_DNSTAP_ENABLE = 177,        /* VAR_DNSTAP_ENABLE  */
+  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 178,   /* VAR_DNSTAP_SOCKET_PATH  */
+  YYSYMBOL_VAR_DNSTAP_IP = 179,            /* VAR_DNSTAP_IP  */
+  YYSYMBOL_VAR_DNSTAP_TLS = 180,           /* VAR_DNSTAP_TLS  */
+  YYSYMBOL_VAR_DNSTAP_TLS_SERVER_NAME = 181, /* VAR_DNSTAP_TLS_SERVER_NAME  */
+  YYSYMBOL_VAR_DNSTAP_TLS_CERT_BUNDLE = 182, /* VAR_DNSTAP_TLS_CERT_BUNDLE  */
+  YYSYMBOL_VAR_DNSTAP_TLS_CLIENT_KEY_FILE = 183, /* VAR_DNSTAP_TLS_CLIENT_KEY_FILE  */
+  YYSYMBOL_VAR_DNSTAP_TLS_CLIENT_CERT_FILE = 184, /* VAR_DNSTAP_TLS_CLIENT_CERT_FILE  */
+  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 185, /* VAR_DNSTAP_SEND_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 186,  /* VAR_DNSTAP_SEND_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_BIDIRECTIONAL = 187, /* VAR_DNSTAP_BIDIRECTIONAL  */
+  YYSYMBOL_VAR_DNSTAP_IDENTITY = 188,      /* VAR_DNSTAP_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_VERSION = 189,       /* VAR_DNSTAP_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 190, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 191, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 192, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 193, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 194, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 195, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_RESPONSE_IP_TAG = 196,      /* VAR_RESPONSE_IP_TAG  */
+  YYSYMBOL_VAR_RESPONSE_IP = 197,          /* VAR_RESPONSE_IP  */
+  YYSYMBOL_VAR_RESPONSE_IP_DATA = 198,     /* VAR_RESPONSE_IP_DATA  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 199, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 200,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_IP_DSCP = 201,              /* VAR_IP_DSCP  */
+  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 202, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+  YYSYMBOL_VAR_IP_RATELIMIT = 203,         /* VAR_IP_RATELIMIT  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 204,   /* VAR_IP_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 205,    /* VAR_IP_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT = 206,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 207,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 208,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 209, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 210, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 211,  /* VAR_IP_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 212,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 213,   /* VAR_SEND_CLIENT_SUBNET  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ZONE = 214,   /* VAR_CLIENT_SUBNET_ZONE  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 215, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 216, /* VAR_CLIENT_SUBNET_OPCODE  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 217, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 218, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV4 = 219, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV6 = 220, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV4 = 221, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
+  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV6 = 222, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 223,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 224, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 225, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION = 226,   /* VAR_QNAME_MINIMISATION  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 227, /* VAR_QNAME_MINIMISATION_STRICT  */
+  YYSYMBOL_VAR_IP_FREEBIND = 228,          /* VAR_IP_FREEBIND  */
+  YYSYMBOL_VAR_DEFINE_TAG = 229,           /* VAR_DEFINE_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 230,       /* VAR_LOCAL_ZONE_TAG  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 231,   /* VAR_ACCESS_CONTROL_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 232,  /* VAR_LOCAL_ZONE_OVERRIDE  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 233, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 234, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+  YYSYMBOL_VAR_VIEW = 235,                 /* VAR_VIEW  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 236,  /* VAR_ACCESS_CONTROL_VIEW  */
+  YYSYMBOL_VAR_VIEW_FIRST = 237,           /* VAR_VIEW_FIRST  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 238,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_TTL = 239,    /* VAR_SERVE_EXPIRED_TTL  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_TTL_RESET = 240, /* VAR_SERVE_EXPIRED_TTL_RESET  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_REPLY_TTL = 241, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 242, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
+  YYSYMBOL_VAR_SERVE_ORIGINAL_TTL = 243,   /* VAR_SERVE_ORIGINAL_TTL  */
+  YYSYMBOL_VAR_FAKE_DSA = 244,             /* VAR_FAKE_DSA  */
+  YYSYMBOL_VAR_FAKE_SHA1 = 245,            /* VAR_FAKE_SHA1  */
+  YYSYMBOL_VAR_LOG_IDENTITY = 246,         /* VAR_LOG_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 247,     /* VAR_HIDE_TRUSTANCHOR  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_SIGNALING = 248, /* VAR_TRUST_ANCHOR_SIGNALING  */
+  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 249,      /* VAR_AGGRESSIVE_NSEC  */
+  YYSYMBOL_VAR_USE_SYSTEMD = 250,          /* VAR_USE_SYSTEMD  */
+  YYSYMBOL_VAR_SHM_ENABLE = 251,           /* VAR_SHM_ENABLE  */
+  YYSYMBOL_VAR_SHM_KEY = 252,              /* VAR_SHM_KEY  */
+  YYSYMBOL_VAR_ROOT_KEY_SENTINEL = 253,    /* VAR_ROOT_KEY_SENTINEL  */
+  YYSYMBOL_VAR_DNSCRYPT = 254,             /* VAR_DNSCRYPT  */
+  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 255,      /* VAR_DNSCRYPT_ENABLE  */
+  YYSYMBOL_VAR_DNSCRYPT_PORT = 256,        /* VAR_DNSCRYPT_PORT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 257,    /* VAR_DNSCRYPT_PROVIDER  */
+  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 258,  /* VAR_DNSCRYPT_SECRET_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 259, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 260, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 261, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 262, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SIZE = 263, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SLABS = 264, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+  YYSYMBOL_VAR_PAD_RESPONSES = 265,        /* VAR_PAD_RESPONSES  */
+  YYSYMBOL_VAR_PAD_RESPONSES_BLOCK_SIZE = 266, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
+  YYSYMBOL_VAR_PAD_QUERIES = 267,          /* VAR_PAD_QUERIES  */
+  YYSYMBOL_VAR_PAD_QUERIES_BLOCK_SIZE = 268, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
+  YYSYMBOL_VAR_IPSECMOD_ENABLED = 269,     /* VAR_IPSECMOD_ENABLED  */
+  YYSYMBOL_VAR_IPSECMOD_HOOK = 270,        /* VAR_IPSECMOD_HOOK  */
+  YYSYMBOL_VAR_IPSECMOD_IGNORE_BOGUS = 271, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+  YYSYMBOL_VAR_IPSECMOD_MAX_TTL = 272,     /* VAR_IPSECMOD_MAX_TTL  */
+  YYSYMBOL_VAR_IPSECMOD_WHITELIST = 273,   /* VAR_IPSECMOD_WHITELIST  */
+  YYSYMBOL_VAR_IPSECMOD_STRICT = 274,      /* VAR_IPSECMOD_STRICT  */
+  YYSYMBOL_VAR_CACHEDB = 275,              /* VAR_CACHEDB  */
+  YYSYMBOL_VAR_CACHEDB_BACKEND = 276,      /* VAR_CACHEDB_BACKEND  */
+  YYSYMBOL_VAR_CACHEDB_SECRETSEED = 277,   /* VAR_CACHEDB_SECRETSEED  */
+  YYSYMBOL_VAR_CACHEDB_REDISHOST = 278,    /* VAR_CACHEDB_REDISHOST  */
+  YYSYMBOL_VAR_CACHEDB_REDISPORT = 279,    /* VAR_CACHEDB_REDISPORT  */
+  YYSYMBOL_VAR_CACHEDB_REDISTIMEOUT = 280, /* VAR_CACHEDB_REDISTIMEOUT  */
+  YYSYMBOL_VAR_CACHEDB_REDISEXPIRERECORDS = 281, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
+  YYSYMBOL_VAR_CACHEDB_REDISASYNC = 282,   /* VAR_CACHEDB_REDISASYNC  */
+  YYSYMBOL_VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 283, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+  YYSYMBOL_VAR_FOR_UPSTREAM = 284,         /* VAR_FOR_UPSTREAM  */
+  YYSYMBOL_VAR_AUTH_ZONE = 285,            /* VAR_AUTH_ZONE  */
+  YYSYMBOL_VAR_ZONEFILE = 286,             /* VAR_ZONEFILE  */
+  YYSYMBOL_VAR_MASTER = 287,               /* VAR_MASTER  */
+  YYSYMBOL_VAR_URL = 288,                  /* VAR_URL  */
+  YYSYMBOL_VAR_FOR_DOWNSTREAM = 289,       /* VAR_FOR_DOWNSTREAM  */
+  YYSYMBOL_VAR_FALLBACK_ENABLED = 290,     /* VAR_FALLBACK_ENABLED  */
+  YYSYMBOL_VAR_TLS_ADDITIONAL_PORT = 291,  /* VAR_TLS_ADDITIONAL_PORT  */
+  YYSYMBOL_VAR_LOW_RTT = 292,              /* VAR_LOW_RTT  */
+  YYSYMBOL_VAR_LOW_RTT_PERMIL = 293,       /* VAR_LOW_RTT_PERMIL  */
+  YYSYMBOL_VAR_FAST_SERVER_PERMIL = 294,   /* VAR_FAST_SERVER_PERMIL  */
+  YYSYMBOL_VAR_FAST_SERVER_NUM = 295,      /* VAR_FAST_SERVER_NUM  */
+  YYSYMBOL_VAR_ALLOW_NOTIFY = 296,         /* VAR_ALLOW_NOTIFY  */
+  YYSYMBOL_VAR_TLS_WIN_CERT = 297,         /* VAR_TLS_WIN_CERT  */
+  YYSYMBOL_VAR_TCP_CONNECTION_LIMIT = 298, /* VAR_TCP_CONNECTION_LIMIT  */
+  YYSYMBOL_VAR_FORWARD_NO_CACHE = 299,     /* VAR_FORWARD_NO_CACHE  */
+  YYSYMBOL_VAR_STUB_NO_CACHE = 300,        /* VAR_STUB_NO_CACHE  */
+  YYSYMBOL_VAR_LOG_SERVFAIL = 301,         /* VAR_LOG_SERVFAIL  */
+  YYSYMBOL_VAR_DENY_ANY = 302,             /* VAR_DENY_ANY  */
+  YYSYMBOL_VAR_UNKNOWN_SERVER_TIME_LIMIT = 303, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
+  YYSYMBOL_VAR_LOG_TAG_QUERYREPLY = 304,   /* VAR_LOG_TAG_QUERYREPLY  */
+  YYSYMBOL_VAR_STREAM_WAIT_SIZE = 305,     /* VAR_STREAM_WAIT_SIZE  */
+  YYSYMBOL_VAR_TLS_CIPHERS = 306,          /* VAR_TLS_CIPHERS  */
+  YYSYMBOL_VAR_TLS_CIPHERSUITES = 307,     /* VAR_TLS_CIPHERSUITES  */
+  YYSYMBOL_VAR_TLS_USE_SNI = 308,          /* VAR_TLS_USE_SNI  */
+  YYSYMBOL_VAR_TLS_UPSTREAM_RESUME = 309,  /* VAR_TLS_UPSTREAM_RESUME  */
+  YYSYMBOL_VAR_TLS_UPSTREAM_EARLY_DATA = 310, /* VAR_TLS_UPSTREAM_EARLY_DATA  */
+  YYSYMBOL_VAR_TLS_USE_KTLS = 311,         /* VAR_TLS_USE_KTLS  */
+  YYSYMBOL_VAR_SHARED_INFLIGHT = 312,      /* VAR_SHARED_INFLIGHT  */
+  YYSYMBOL_VAR_PRIORITY_CLASS = 313,       /* VAR_PRIORITY_CLASS  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_PRIORITY_CLASS = 314, /* VAR_ACCESS_CONTROL_PRIORITY_CLASS  */
+  YYSYMBOL_VAR_WORKER_CPU_AFFINITY = 315,  /* VAR_WORKER_CPU_AFFINITY  */
+  YYSYMBOL_VAR_NUMA_AWARE = 316,           /* VAR_NUMA_AWARE  */
+  YYSYMBOL_VAR_IPSET = 317,                /* VAR_IPSET  */
+  YYSYMBOL_VAR_IPSET_NAME_V4 = 318,        /* VAR_IPSET_NAME_V4  */
+  YYSYMBOL_VAR_IPSET_NAME_V6 = 319,        /* VAR_IPSET_NAME_V6  */
+  YYSYMBOL_VAR_TLS_SESSION_TICKET_KEYS = 320, /* VAR_TLS_SESSION_TICKET_KEYS  */
+  YYSYMBOL_VAR_RPZ = 321,                  /* VAR_RPZ  */
+  YYSYMBOL_VAR_TAGS = 322,                 /* VAR_TAGS  */
+  YYSYMBOL_VAR_RPZ_ACTION_OVERRIDE = 323,  /* VAR_RPZ_ACTION_OVERRIDE  */
+  YYSYMBOL_VAR_RPZ_CNAME_OVERRIDE = 324,   /* VAR_RPZ_CNAME_OVERRIDE  */
+  YYSYMBOL_VAR_RPZ_LOG = 325,              /* VAR_RPZ_LOG  */
+  YYSYMBOL_VAR_RPZ_LOG_NAME = 326,         /* VAR_RPZ_LOG_NAME  */
+  YYSYMBOL_VAR_DYNLIB = 327,               /* VAR_DYNLIB  */
+  YYSYMBOL_VAR_DYNLIB_FILE = 328,          /* VAR_DYNLIB_FILE  */
+  YYSYMBOL_VAR_EDNS_CLIENT_STRING = 329,   /* VAR_EDNS_CLIENT_STRING  */
+  YYSYMBOL_VAR_EDNS_CLIENT_STRING_OPCODE = 330, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
+  YYSYMBOL_VAR_NSID = 331,                 /* VAR_NSID  */
+  YYSYMBOL_VAR_ZONEMD_PERMISSIVE_MODE = 332, /* VAR_ZONEMD_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_ZONEMD_REJECT_ABSENCE = 333, /* VAR_ZONEMD_REJECT_ABSENCE  */
+  YYSYMBOL_VAR_CACHE_SNAPSHOT_FILE = 334,  /* VAR_CACHE_SNAPSHOT_FILE  */
+  YYSYMBOL_VAR_MSG_CACHE_POLICY = 335,     /* VAR_MSG_CACHE_POLICY  */
+  YYSYMBOL_VAR_RRSET_CACHE_POLICY = 336,   /* VAR_RRSET_CACHE_POLICY  */
+  YYSYMBOL_VAR_INFRA_CACHE_POLICY = 337,   /* VAR_INFRA_CACHE_POLICY  */
+  YYSYMBOL_VAR_KEY_CACHE_POLICY = 338,     /* VAR_KEY_CACHE_POLICY  */
+  YYSYMBOL_VAR_MSG_CACHE_WIRE_IMAGE = 339, /* VAR_MSG_CACHE_WIRE_IMAGE  */
+  YYSYMBOL_YYACCEPT = 340,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 341,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 342,              /* toplevelvar  */
+  YYSYMBOL_force_toplevel = 343,           /* force_toplevel  */
+  YYSYMBOL_serverstart = 344,              /* serverstart  */
+  YYSYMBOL_contents_server = 345,          /* contents_server  */
+  YYSYMBOL_content_server = 346,           /* content_server  */
+  YYSYMBOL_stubstart = 347,                /* stubstart  */
+  YYSYMBOL_contents_stub = 348,            /* contents_stub  */
+  YYSYMBOL_content_stub = 349,             /* content_stub  */
+  YYSYMBOL_forwardstart = 350,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 351,         /* contents_forward  */
+  YYSYMBOL_content_forward = 352,          /* content_forward  */
+  YYSYMBOL_viewstart = 353,                /* viewstart  */
+  YYSYMBOL_contents_view = 354,            /* contents_view  */
+  YYSYMBOL_content_view = 355,             /* content_view  */
+  YYSYMBOL_authstart = 356,                /* authstart  */
+  YYSYMBOL_contents_auth = 357,            /* contents_auth  */
+  YYSYMBOL_content_auth = 358,             /* content_auth  */
+  YYSYMBOL_rpz_tag = 359,                  /* rpz_tag  */
+  YYSYMBOL_rpz_action_override = 360,      /* rpz_action_override  */
+  YYSYMBOL_rpz_cname_override = 361,       /* rpz_cname_override  */
+  YYSYMBOL_rpz_log = 362,                  /* rpz_log  */
+  YYSYMBOL_rpz_log_name = 363,             /* rpz_log_name  */
+  YYSYMBOL_rpzstart = 364,                 /* rpzstart  */
+  YYSYMBOL_contents_rpz = 365,             /* contents_rpz  */
+  YYSYMBOL_content_rpz = 366,              /* content_rpz  */
+  YYSYMBOL_server_num_threads = 367,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 368,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 369, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 370, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 371, /* server_extended_statistics  */
+  YYSYMBOL_server_shm_enable = 372,        /* server_shm_enable  */
+  YYSYMBOL_server_shm_key = 373,           /* server_shm_key  */
+  YYSYMBOL_server_port = 374,              /* server_port  */
+  YYSYMBOL_server_send_client_subnet = 375, /* server_send_client_subnet  */
+  YYSYMBOL_server_client_subnet_zone = 376, /* server_client_subnet_zone  */
+  YYSYMBOL_server_client_subnet_always_forward = 377, /* server_client_subnet_always_forward  */
+  YYSYMBOL_server_client_subnet_opcode = 378, /* server_client_subnet_opcode  */
+  YYSYMBOL_server_max_client_subnet_ipv4 = 379, /* server_max_client_subnet_ipv4  */
+  YYSYMBOL_server_max_client_subnet_ipv6 = 380, /* server_max_client_subnet_ipv6  */
+  YYSYMBOL_server_min_client_subnet_ipv4 = 381, /* server_min_client_subnet_ipv4  */
+  YYSYMBOL_server_min_client_subnet_ipv6 = 382, /* server_min_client_subnet_ipv6  */
+  YYSYMBOL_server_max_ecs_tree_size_ipv4 = 383, /* server_max_ecs_tree_size_ipv4  */
+  YYSYMBOL_server_max_ecs_tree_size_ipv6 = 384, /* server_max_ecs_tree_size_ipv6  */
+  YYSYMBOL_server_interface = 385,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 386, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 387,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 388, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 389, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 390,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 391,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_interface_automatic = 392, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 393,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 394,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 395,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 396,            /* server_do_tcp  */
+  YYSYMBOL_server_prefer_ip4 = 397,        /* server_prefer_ip4  */
+  YYSYMBOL_server_prefer_ip6 = 398,        /* server_prefer_ip6  */
+  YYSYMBOL_server_tcp_mss = 399,           /* server_tcp_mss  */
+  YYSYMBOL_server_outgoing_tcp_mss = 400,  /* server_outgoing_tcp_mss  */
+  YYSYMBOL_server_tcp_idle_timeout = 401,  /* server_tcp_idle_timeout  */
+  YYSYMBOL_server_max_reuse_tcp_queries = 402, /* server_max_reuse_tcp_queries  */
+  YYSYMBOL_server_tcp_reuse_timeout = 403, /* server_tcp_reuse_timeout  */
+  YYSYMBOL_server_tcp_auth_query_timeout = 404, /* server_tcp_auth_query_timeout  */
+  YYSYMBOL_server_tcp_keepalive = 405,     /* server_tcp_keepalive  */
+  YYSYMBOL_server_tcp_keepalive_timeout = 406, /* server_tcp_keepalive_timeout  */
+  YYSYMBOL_server_tcp_upstream = 407,      /* server_tcp_upstream  */
+  YYSYMBOL_server_tcp_upstream_pool = 408, /* server_tcp_upstream_pool  */
+  YYSYMBOL_server_udp_upstream_without_downstream = 409, /* server_udp_upstream_without_downstream  */
+  YYSYMBOL_server_ssl_upstream = 410,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 411,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 412,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 413,          /* server_ssl_port  */
+  YYSYMBOL_server_tls_cert_bundle = 414,   /* server_tls_cert_bundle  */
+  YYSYMBOL_server_tls_win_cert = 415,      /* server_tls_win_cert  */
+  YYSYMBOL_server_tls_additional_port = 416, /* server_tls_additional_port  */
+  YYSYMBOL_server_tls_ciphers = 417,       /* server_tls_ciphers  */
+  YYSYMBOL_server_tls_ciphersuites = 418,  /* server_tls_ciphersuites  */
+  YYSYMBOL_server_tls_session_ticket_keys = 419, /* server_tls_session_ticket_keys  */
+  YYSYMBOL_server_tls_use_sni = 420,       /* server_tls_use_sni  */
+  YYSYMBOL_server_tls_upstream_resume = 421, /* server_tls_upstream_resume  */
+  YYSYMBOL_server_tls_upstream_early_data = 422, /* server_tls_upstream_early_data  */
+  YYSYMBOL_server_tls_use_ktls = 423,      /* server_tls_use_ktls  */
+  YYSYMBOL_server_https_port = 424,        /* server_https_port  */
+  YYSYMBOL_server_http_endpoint = 425,     /* server_http_endpoint  */
+  YYSYMBOL_server_http_max_streams = 426,  /* server_http_max_streams  */
+  YYSYMBOL_server_http_query_buffer_size = 427, /* server_http_query_buffer_size  */
+  YYSYMBOL_server_http_response_buffer_size = 428, /* server_http_response_buffer_size  */
+  YYSYMBOL_server_http_nodelay = 429,      /* server_http_nodelay  */
+  YYSYMBOL_server_http_notls_downstream = 430, /* server_http_notls_downstream  */
+  YYSYMBOL_server_use_systemd = 431,       /* server_use_systemd  */
+  YYSYMBOL_server_do_daemonize = 432,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 433,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 434,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 435,       /* server_log_queries  */
+  YYSYMBOL_server_log_replies = 436,       /* server_log_replies  */
+  YYSYMBOL_server_log_tag_queryreply = 437, /* server_log_tag_queryreply  */
+  YYSYMBOL_server_log_servfail = 438,      /* server_log_servfail  */
+  YYSYMBOL_server_log_local_actions = 439, /* server_log_local_actions  */
+  YYSYMBOL_server_chroot = 440,            /* server_chroot  */
+  YYSYMBOL_server_username = 441,          /* server_username  */
+  YYSYMBOL_server_directory = 442,         /* server_directory  */
+  YYSYMBOL_server_logfile = 443,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 444,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 445,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 446,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 447,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 448, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 449, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 450, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 451,      /* server_trust_anchor  */
+  YYSYMBOL_server_trust_anchor_signaling = 452, /* server_trust_anchor_signaling  */
+  YYSYMBOL_server_root_key_sentinel = 453, /* server_root_key_sentinel  */
+  YYSYMBOL_server_domain_insecure = 454,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 455,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 456,      /* server_hide_version  */
+  YYSYMBOL_server_hide_trustanchor = 457,  /* server_hide_trustanchor  */
+  YYSYMBOL_server_identity = 458,          /* server_identity  */
+  YYSYMBOL_server_version = 459,           /* server_version  */
+  YYSYMBOL_server_nsid = 460,              /* server_nsid  */
+  YYSYMBOL_server_so_rcvbuf = 461,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 462,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 463,      /* server_so_reuseport  */
+  YYSYMBOL_server_worker_cpu_affinity = 464, /* server_worker_cpu_affinity  */
+  YYSYMBOL_server_numa_aware = 465,        /* server_numa_aware  */
+  YYSYMBOL_server_ip_transparent = 466,    /* server_ip_transparent  */
+  YYSYMBOL_server_ip_freebind = 467,       /* server_ip_freebind  */
+  YYSYMBOL_server_ip_dscp = 468,           /* server_ip_dscp  */
+  YYSYMBOL_server_stream_wait_size = 469,  /* server_stream_wait_size  */
+  YYSYMBOL_server_edns_buffer_size = 470,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 471,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 472,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 473,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_msg_cache_policy = 474,  /* server_msg_cache_policy  */
+  YYSYMBOL_server_msg_cache_wire_image = 475, /* server_msg_cache_wire_image  */
+  YYSYMBOL_server_num_queries_per_thread = 476, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 477,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 478,       /* server_delay_close  */
+  YYSYMBOL_server_udp_connect = 479,       /* server_udp_connect  */
+  YYSYMBOL_server_udp_batch_size = 480,    /* server_udp_batch_size  */
+  YYSYMBOL_server_udp_upstream_batch = 481, /* server_udp_upstream_batch  */
+  YYSYMBOL_server_use_io_uring = 482,      /* server_use_io_uring  */
+  YYSYMBOL_server_udp_connect_pool = 483,  /* server_udp_connect_pool  */
+  YYSYMBOL_server_udp_connect_reuse = 484, /* server_udp_connect_reuse  */
+  YYSYMBOL_server_unblock_lan_zones = 485, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_insecure_lan_zones = 486, /* server_insecure_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 487,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 488, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_rrset_cache_policy = 489, /* server_rrset_cache_policy  */
+  YYSYMBOL_server_infra_host_ttl = 490,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 491,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 492, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_policy = 493, /* server_infra_cache_policy  */
+  YYSYMBOL_server_infra_cache_lame_size = 494, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 495, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_cache_snapshot_file = 496, /* server_cache_snapshot_file  */
+  YYSYMBOL_server_infra_cache_min_rtt = 497, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_infra_keep_probing = 498, /* server_infra_keep_probing  */
+  YYSYMBOL_server_udp_hedge = 499,         /* server_udp_hedge  */
+  YYSYMBOL_server_udp_hedge_percentile = 500, /* server_udp_hedge_percentile  */
+  YYSYMBOL_server_udp_hedge_max_rate = 501, /* server_udp_hedge_max_rate  */
+  YYSYMBOL_server_infra_select_percentile = 502, /* server_infra_select_percentile  */
+  YYSYMBOL_server_target_fetch_policy = 503, /* server_target_fetch_policy  */
+  YYSYMBOL_server_harden_short_bufsize = 504, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 505, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 506,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 507, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 508, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 509, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 510, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 511,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 512,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 513,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 514,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 515,          /* server_prefetch  */
+  YYSYMBOL_server_shared_inflight = 516,   /* server_shared_inflight  */
+  YYSYMBOL_server_prefetch_key = 517,      /* server_prefetch_key  */
+  YYSYMBOL_server_deny_any = 518,          /* server_deny_any  */
+  YYSYMBOL_server_unwanted_reply_threshold = 519, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 520, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 521, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 522,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 523,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 524, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 525,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 526,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 527,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 528, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 529,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 530,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 531, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 532, /* server_val_permissive_mode  */
+  YYSYMBOL_server_aggressive_nsec = 533,   /* server_aggressive_nsec  */
+  YYSYMBOL_server_ignore_cd_flag = 534,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_serve_expired = 535,     /* server_serve_expired  */
+  YYSYMBOL_server_serve_expired_ttl = 536, /* server_serve_expired_ttl  */
+  YYSYMBOL_server_serve_expired_ttl_reset = 537, /* server_serve_expired_ttl_reset  */
+  YYSYMBOL_server_serve_expired_reply_ttl = 538, /* server_serve_expired_reply_ttl  */
+  YYSYMBOL_server_serve_expired_client_timeout = 539, /* server_serve_expired_client_timeout  */
+  YYSYMBOL_server_serve_original_ttl = 540, /* server_serve_original_ttl  */
+  YYSYMBOL_server_fake_dsa = 541,          /* server_fake_dsa  */
+  YYSYMBOL_server_fake_sha1 = 542,         /* server_fake_sha1  */
+  YYSYMBOL_server_val_log_level = 543,     /* server_val_log_level  */
+  YYSYMBOL_server_val_verify_threads = 544, /* server_val_verify_threads  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 545, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_zonemd_permissive_mode = 546, /* server_zonemd_permissive_mode  */
+  YYSYMBOL_server_add_holddown = 547,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 548,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 549,      /* server_keep_missing  */
+  YYSYMBOL_server_permit_small_holddown = 550, /* server_permit_small_holddown  */
+  YYSYMBOL_server_key_cache_size = 551,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 552,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_key_cache_policy = 553,  /* server_key_cache_policy  */
+  YYSYMBOL_server_neg_cache_size = 554,    /* server_neg_cache_size  */
+  YYSYMBOL_server_local_zone = 555,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 556,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 557,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 558, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 559,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_unknown_server_time_limit = 560, /* server_unknown_server_time_limit  */
+  YYSYMBOL_server_max_udp_size = 561,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 562,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 563,    /* server_dns64_synthall  */
+  YYSYMBOL_server_dns64_ignore_aaaa = 564, /* server_dns64_ignore_aaaa  */
+  YYSYMBOL_server_define_tag = 565,        /* server_define_tag  */
+  YYSYMBOL_server_local_zone_tag = 566,    /* server_local_zone_tag  */
+  YYSYMBOL_server_access_control_tag = 567, /* server_access_control_tag  */
+  YYSYMBOL_server_access_control_tag_action = 568, /* server_access_control_tag_action  */
+  YYSYMBOL_server_access_control_tag_data = 569, /* server_access_control_tag_data  */
+  YYSYMBOL_server_local_zone_override = 570, /* server_local_zone_override  */
+  YYSYMBOL_server_access_control_view = 571, /* server_access_control_view  */
+  YYSYMBOL_server_priority_class = 572,    /* server_priority_class  */
+  YYSYMBOL_server_access_control_priority_class = 573, /* server_access_control_priority_class  */
+  YYSYMBOL_server_response_ip_tag = 574,   /* server_response_ip_tag  */
+  YYSYMBOL_server_ip_ratelimit = 575,      /* server_ip_ratelimit  */
+  YYSYMBOL_server_ratelimit = 576,         /* server_ratelimit  */
+  YYSYMBOL_server_ip_ratelimit_size = 577, /* server_ip_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_size = 578,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ip_ratelimit_slabs = 579, /* server_ip_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_slabs = 580,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 581, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 582, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ip_ratelimit_factor = 583, /* server_ip_ratelimit_factor  */
+  YYSYMBOL_server_ratelimit_factor = 584,  /* server_ratelimit_factor  */
+  YYSYMBOL_server_low_rtt = 585,           /* server_low_rtt  */
+  YYSYMBOL_server_fast_server_num = 586,   /* server_fast_server_num  */
+  YYSYMBOL_server_fast_server_permil = 587, /* server_fast_server_permil  */
+  YYSYMBOL_server_qname_minimisation = 588, /* server_qname_minimisation  */
+  YYSYMBOL_server_qname_minimisation_strict = 589, /* server_qname_minimisation_strict  */
+  YYSYMBOL_server_pad_responses = 590,     /* server_pad_responses  */
+  YYSYMBOL_server_pad_responses_block_size = 591, /* server_pad_responses_block_size  */
+  YYSYMBOL_server_pad_queries = 592,       /* server_pad_queries  */
+  YYSYMBOL_server_pad_queries_block_size = 593, /* server_pad_queries_block_size  */
+  YYSYMBOL_server_ipsecmod_enabled = 594,  /* server_ipsecmod_enabled  */
+  YYSYMBOL_server_ipsecmod_ignore_bogus = 595, /* server_ipsecmod_ignore_bogus  */
+  YYSYMBOL_server_ipsecmod_hook = 596,     /* server_ipsecmod_hook  */
+  YYSYMBOL_server_ipsecmod_max_ttl = 597,  /* server_ipsecmod_max_ttl  */
+  YYSYMBOL_server_ipsecmod_whitelist = 598, /* server_ipsecmod_whitelist  */
+  YYSYMBOL_server_ipsecmod_strict = 599,   /* server_ipsecmod_strict  */
+  YYSYMBOL_server_edns_client_string = 600, /* server_edns_client_string  */
+  YYSYMBOL_server_edns_client_string_opcode = 601, /* server_edns_client_string_opcode  */
+  YYSYMBOL_stub_name = 602,                /* stub_name  */
+  YYSYMBOL_stub_host = 603,                /* stub_host  */
+  YYSYMBOL_stub_addr = 604,                /* stub_addr  */
+  YYSYMBOL_stub_first = 605,               /* stub_first  */
+  YYSYMBOL_stub_no_cache = 606,            /* stub_no_cache  */
+  YYSYMBOL_stub_ssl_upstream = 607,        /* stub_ssl_upstream  */
+  YYSYMBOL_stub_prime = 608,               /* stub_prime  */
+  YYSYMBOL_forward_name = 609,             /* forward_name  */
+  YYSYMBOL_forward_host = 610,             /* forward_host  */
+  YYSYMBOL_forward_addr = 611,             /* forward_addr  */
+  YYSYMBOL_forward_first = 612,            /* forward_first  */
+  YYSYMBOL_forward_no_cache = 613,         /* forward_no_cache  */
+  YYSYMBOL_forward_ssl_upstream = 614,     /* forward_ssl_upstream  */
+  YYSYMBOL_auth_name = 615,                /* auth_name  */
+  YYSYMBOL_auth_zonefile = 616,            /* auth_zonefile  */
+  YYSYMBOL_auth_master = 617,              /* auth_master  */
+  YYSYMBOL_auth_url = 618,                 /* auth_url  */
+  YYSYMBOL_auth_allow_notify = 619,        /* auth_allow_notify  */
+  YYSYMBOL_auth_zonemd_reject_absence = 620, /* auth_zonemd_reject_absence  */
+  YYSYMBOL_auth_for_downstream = 621,      /* auth_for_downstream  */
+  YYSYMBOL_auth_for_upstream = 622,        /* auth_for_upstream  */
+  YYSYMBOL_auth_fallback_enabled = 623,    /* auth_fallback_enabled  */
+  YYSYMBOL_view_name = 624,                /* view_name  */
+  YYSYMBOL_view_local_zone = 625,          /* view_local_zone  */
+  YYSYMBOL_view_response_ip = 626,         /* view_response_ip  */
+  YYSYMBOL_view_response_ip_data = 627,    /* view_response_ip_data  */
+  YYSYMBOL_view_local_data = 628,          /* view_local_data  */
+  YYSYMBOL_view_local_data_ptr = 629,      /* view_local_data_ptr  */
+  YYSYMBOL_view_first = 630,               /* view_first  */
+  YYSYMBOL_rcstart = 631,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 632,              /* contents_rc  */
+  YYSYMBOL_content_rc = 633,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 634,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 635,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 636,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 637,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 638,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 639,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 640,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 641,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 642,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 643,              /* contents_dt  */
+  YYSYMBOL_content_dt = 644,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 645,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_bidirectional = 646,  /* dt_dnstap_bidirectional  */
+  YYSYMBOL_dt_dnstap_socket_path = 647,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_ip = 648,             /* dt_dnstap_ip  */
+  YYSYMBOL_dt_dnstap_tls = 649,            /* dt_dnstap_tls  */
+  YYSYMBOL_dt_dnstap_tls_server_name = 650, /* dt_dnstap_tls_server_name  */
+  YYSYMBOL_dt_dnstap_tls_cert_bundle = 651, /* dt_dnstap_tls_cert_bundle  */
+  YYSYMBOL_dt_dnstap_tls_client_key_file = 652, /* dt_dnstap_tls_client_key_file  */
+  YYSYMBOL_dt_dnstap_tls_client_cert_file = 653, /* dt_dnstap_tls_client_cert_file  */
+  YYSYMBOL_dt_dnstap_send_identity = 654,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 655,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 656,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 657,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 658, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 659, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 660, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 661, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 662, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 663, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_pythonstart = 664,              /* pythonstart  */
+  YYSYMBOL_contents_py = 665,              /* contents_py  */
+  YYSYMBOL_content_py = 666,               /* content_py  */
+  YYSYMBOL_py_script = 667,                /* py_script  */
+  YYSYMBOL_dynlibstart = 668,              /* dynlibstart  */
+  YYSYMBOL_contents_dl = 669,              /* contents_dl  */
+  YYSYMBOL_content_dl = 670,               /* content_dl  */
+  YYSYMBOL_dl_file = 671,                  /* dl_file  */
+  YYSYMBOL_server_disable_dnssec_lame_check = 672, /* server_disable_dnssec_lame_check  */
+  YYSYMBOL_server_log_identity = 673,      /* server_log_identity  */
+  YYSYMBOL_server_response_ip = 674,       /* server_response_ip  */
+  YYSYMBOL_server_response_ip_data = 675,  /* server_response_ip_data  */
+  YYSYMBOL_dnscstart = 676,                /* dnscstart  */
+  YYSYMBOL_contents_dnsc = 677,            /* contents_dnsc  */
+  YYSYMBOL_content_dnsc = 678,             /* content_dnsc  */
+  YYSYMBOL_dnsc_dnscrypt_enable = 679,     /* dnsc_dnscrypt_enable  */
+  YYSYMBOL_dnsc_dnscrypt_port = 680,       /* dnsc_dnscrypt_port  */
+  YYSYMBOL_dnsc_dnscrypt_provider = 681,   /* dnsc_dnscrypt_provider  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert = 682, /* dnsc_dnscrypt_provider_cert  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert_rotated = 683, /* dnsc_dnscrypt_provider_cert_rotated  */
+  YYSYMBOL_dnsc_dnscrypt_secret_key = 684, /* dnsc_dnscrypt_secret_key  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_size = 685, /* dnsc_dnscrypt_shared_secret_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_slabs = 686, /* dnsc_dnscrypt_shared_secret_cache_slabs  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_size = 687, /* dnsc_dnscrypt_nonce_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_slabs = 688, /* dnsc_dnscrypt_nonce_cache_slabs  */
+  YYSYMBOL_cachedbstart = 689,             /* cachedbstart  */
+  YYSYMBOL_contents_cachedb = 690,         /* contents_cachedb  */
+  YYSYMBOL_content_cachedb = 691,          /* content_cachedb  */
+  YYSYMBOL_cachedb_backend_name = 692,     /* cachedb_backend_name  */
+  YYSYMBOL_cachedb_secret_seed = 693,      /* cachedb_secret_seed  */
+  YYSYMBOL_redis_server_host = 694,        /* redis_server_host  */
+  YYSYMBOL_redis_server_port = 695,        /* redis_server_port  */
+  YYSYMBOL_redis_timeout = 696,            /* redis_timeout  */
+  YYSYMBOL_redis_expire_records = 697,     /* redis_expire_records  */
+  YYSYMBOL_redis_async = 698,              /* redis_async  */
+  YYSYMBOL_server_tcp_connection_limit = 699, /* server_tcp_connection_limit  */
+  YYSYMBOL_ipsetstart = 700,               /* ipsetstart  */
+  YYSYMBOL_contents_ipset = 701,           /* contents_ipset  */
+  YYSYMBOL_content_ipset = 702,            /* content_ipset  */
+  YYSYMBOL_ipset_name_v4 = 703,            /* ipset_name_v4  */
+  YYSYMBOL_ipset_name_v6 = 704             /* ipset_name_v6  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -1492,6 +872,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -1589,17 +981,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -1758,18 +1156,19 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   663
+#define YYLAST   719
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  314
+#define YYNTOKENS  340
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  339
+#define YYNNTS  365
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  654
+#define YYNRULES  706
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  972
+#define YYNSTATES  1052
 
-#define YYMAXUTOK   568
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   594
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -1839,79 +1238,87 @@ static const yytype_int16 yytranslate[] =
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   188,   188,   188,   189,   189,   190,   190,   191,   191,
-     191,   192,   192,   193,   193,   194,   194,   195,   197,   203,
-     208,   209,   210,   210,   210,   211,   211,   212,   212,   212,
-     213,   213,   214,   214,   214,   215,   215,   216,   216,   216,
-     217,   217,   217,   218,   218,   219,   219,   220,   220,   221,
-     221,   222,   222,   223,   223,   224,   224,   225,   225,   226,
-     226,   226,   227,   227,   227,   228,   228,   228,   229,   229,
-     230,   230,   231,   231,   232,   232,   233,   233,   233,   234,
-     234,   235,   235,   236,   236,   236,   237,   237,   238,   238,
-     239,   239,   240,   240,   240,   241,   241,   242,   242,   243,
-     243,   244,   244,   245,   245,   246,   246,   246,   247,   247,
-     248,   248,   248,   249,   249,   249,   250,   250,   250,   251,
-     251,   251,   251,   252,   253,   253,   253,   254,   254,   254,
-     255,   255,   256,   256,   257,   257,   257,   258,   258,   258,
-     259,   259,   260,   260,   260,   261,   261,   262,   262,   262,
-     263,   263,   264,   264,   265,   265,   266,   267,   267,   268,
-     268,   269,   269,   270,   271,   271,   272,   272,   273,   273,
-     274,   274,   275,   275,   276,   276,   276,   277,   277,   278,
-     278,   279,   279,   280,   281,   281,   282,   282,   283,   284,
-     284,   285,   285,   286,   286,   287,   287,   288,   288,   288,
-     289,   289,   289,   290,   290,   291,   292,   292,   293,   293,
-     294,   294,   295,   295,   296,   296,   296,   297,   297,   297,
-     298,   298,   298,   299,   299,   300,   300,   301,   301,   302,
-     302,   303,   303,   304,   304,   305,   305,   308,   320,   321,
-     322,   322,   322,   322,   322,   323,   323,   325,   337,   338,
-     339,   339,   339,   339,   340,   340,   342,   356,   357,   358,
-     358,   358,   358,   359,   359,   359,   361,   379,   380,   381,
-     381,   381,   381,   382,   382,   382,   383,   383,   386,   405,
-     422,   430,   440,   448,   465,   466,   467,   467,   467,   467,
-     467,   468,   468,   468,   469,   469,   471,   480,   489,   500,
-     509,   518,   527,   538,   547,   559,   573,   588,   599,   616,
-     633,   650,   667,   682,   697,   710,   725,   734,   743,   752,
-     761,   770,   779,   788,   797,   806,   815,   824,   833,   842,
-     851,   864,   875,   886,   897,   906,   919,   928,   937,   946,
-     953,   960,   969,   976,   985,   993,  1000,  1007,  1015,  1024,
-    1032,  1048,  1056,  1064,  1072,  1080,  1088,  1097,  1106,  1120,
-    1129,  1138,  1147,  1156,  1165,  1174,  1181,  1188,  1214,  1222,
-    1229,  1236,  1243,  1250,  1258,  1266,  1274,  1281,  1292,  1303,
-    1310,  1319,  1328,  1337,  1344,  1351,  1367,  1375,  1383,  1393,
-    1403,  1413,  1427,  1435,  1448,  1459,  1467,  1480,  1489,  1498,
-    1507,  1516,  1526,  1536,  1544,  1557,  1566,  1574,  1583,  1591,
-    1604,  1613,  1623,  1630,  1640,  1650,  1660,  1670,  1680,  1690,
-    1700,  1710,  1717,  1724,  1731,  1740,  1749,  1758,  1767,  1774,
-    1784,  1804,  1811,  1829,  1842,  1855,  1864,  1873,  1882,  1891,
-    1901,  1911,  1922,  1931,  1940,  1949,  1958,  1967,  1976,  1985,
-    1998,  2011,  2020,  2027,  2036,  2045,  2054,  2063,  2072,  2080,
-    2093,  2101,  2146,  2153,  2168,  2178,  2188,  2195,  2202,  2209,
-    2218,  2226,  2240,  2261,  2282,  2294,  2306,  2318,  2327,  2348,
-    2358,  2367,  2375,  2383,  2396,  2409,  2424,  2439,  2448,  2457,
-    2463,  2472,  2481,  2491,  2501,  2511,  2520,  2530,  2539,  2552,
-    2565,  2577,  2591,  2603,  2617,  2626,  2638,  2648,  2655,  2662,
-    2671,  2680,  2690,  2700,  2710,  2717,  2724,  2733,  2742,  2752,
-    2762,  2769,  2776,  2783,  2791,  2801,  2811,  2821,  2831,  2841,
-    2887,  2897,  2905,  2913,  2928,  2937,  2942,  2943,  2944,  2944,
-    2944,  2945,  2945,  2945,  2946,  2946,  2948,  2958,  2967,  2974,
-    2981,  2988,  2995,  3002,  3009,  3014,  3015,  3016,  3016,  3016,
-    3017,  3017,  3017,  3018,  3019,  3019,  3020,  3020,  3021,  3021,
-    3022,  3023,  3024,  3025,  3026,  3027,  3029,  3038,  3048,  3055,
-    3062,  3071,  3078,  3085,  3092,  3099,  3108,  3117,  3124,  3131,
-    3141,  3151,  3161,  3171,  3181,  3191,  3196,  3197,  3198,  3200,
-    3206,  3211,  3212,  3213,  3215,  3221,  3231,  3238,  3247,  3255,
-    3260,  3261,  3263,  3263,  3263,  3264,  3264,  3265,  3266,  3267,
-    3268,  3269,  3271,  3281,  3290,  3297,  3306,  3313,  3322,  3330,
-    3343,  3351,  3364,  3369,  3370,  3371,  3371,  3372,  3372,  3372,
-    3373,  3375,  3387,  3399,  3411,  3426,  3439,  3452,  3463,  3468,
-    3469,  3470,  3470,  3472,  3487
+       0,   198,   198,   198,   199,   199,   200,   200,   201,   201,
+     201,   202,   202,   203,   203,   204,   204,   205,   207,   213,
+     218,   219,   220,   220,   220,   221,   221,   222,   222,   222,
+     223,   223,   224,   224,   224,   225,   225,   226,   226,   226,
+     227,   227,   227,   228,   228,   229,   229,   230,   230,   231,
+     231,   232,   232,   233,   233,   234,   234,   235,   235,   236,
+     236,   236,   237,   237,   237,   238,   238,   238,   239,   239,
+     240,   240,   241,   241,   242,   242,   243,   243,   243,   244,
+     244,   245,   245,   246,   246,   246,   247,   247,   248,   248,
+     249,   249,   250,   250,   250,   251,   251,   252,   252,   253,
+     253,   254,   254,   255,   255,   256,   256,   256,   257,   258,
+     258,   259,   259,   259,   260,   260,   260,   261,   261,   261,
+     262,   262,   262,   262,   263,   264,   265,   265,   265,   266,
+     266,   266,   267,   267,   268,   268,   269,   269,   269,   270,
+     270,   270,   271,   271,   272,   272,   273,   274,   275,   276,
+     276,   276,   277,   277,   278,   278,   278,   279,   279,   279,
+     280,   280,   281,   281,   282,   282,   283,   283,   284,   285,
+     285,   286,   286,   287,   288,   288,   289,   289,   290,   290,
+     291,   292,   292,   293,   293,   294,   294,   295,   295,   296,
+     296,   297,   297,   297,   298,   298,   299,   299,   300,   300,
+     301,   302,   302,   303,   303,   304,   305,   305,   306,   306,
+     307,   307,   308,   308,   309,   309,   309,   310,   310,   310,
+     311,   311,   312,   313,   313,   314,   314,   315,   315,   316,
+     316,   317,   317,   317,   318,   318,   318,   319,   319,   319,
+     320,   320,   321,   321,   322,   322,   323,   323,   324,   324,
+     325,   325,   326,   326,   327,   327,   328,   328,   329,   329,
+     330,   330,   333,   345,   346,   347,   347,   347,   347,   347,
+     348,   348,   350,   362,   363,   364,   364,   364,   364,   365,
+     365,   367,   381,   382,   383,   383,   383,   383,   384,   384,
+     384,   386,   404,   405,   406,   406,   406,   406,   407,   407,
+     407,   408,   408,   411,   430,   447,   455,   465,   473,   490,
+     491,   492,   492,   492,   492,   492,   493,   493,   493,   494,
+     494,   496,   505,   514,   525,   534,   543,   552,   563,   572,
+     584,   598,   613,   624,   641,   658,   675,   692,   707,   722,
+     735,   750,   759,   768,   777,   786,   795,   804,   813,   822,
+     831,   840,   849,   858,   867,   876,   889,   900,   911,   922,
+     931,   944,   953,   962,   971,   980,   987,   994,  1003,  1010,
+    1019,  1027,  1034,  1041,  1049,  1058,  1068,  1078,  1087,  1095,
+    1111,  1119,  1127,  1135,  1143,  1151,  1160,  1169,  1183,  1192,
+    1201,  1210,  1219,  1228,  1237,  1244,  1251,  1277,  1285,  1292,
+    1299,  1306,  1313,  1321,  1329,  1337,  1344,  1355,  1366,  1373,
+    1382,  1391,  1400,  1407,  1414,  1430,  1438,  1446,  1456,  1466,
+    1475,  1485,  1495,  1509,  1517,  1530,  1541,  1549,  1562,  1574,
+    1584,  1593,  1602,  1611,  1620,  1631,  1641,  1650,  1661,  1670,
+    1680,  1690,  1698,  1711,  1723,  1732,  1740,  1749,  1761,  1769,
+    1782,  1789,  1798,  1808,  1817,  1826,  1837,  1848,  1855,  1865,
+    1875,  1885,  1895,  1905,  1915,  1925,  1935,  1942,  1949,  1956,
+    1965,  1974,  1983,  1992,  2001,  2008,  2018,  2038,  2045,  2063,
+    2076,  2089,  2098,  2107,  2116,  2125,  2135,  2145,  2156,  2165,
+    2174,  2183,  2192,  2201,  2210,  2219,  2232,  2245,  2254,  2265,
+    2272,  2281,  2290,  2299,  2308,  2317,  2325,  2338,  2350,  2358,
+    2403,  2410,  2425,  2435,  2445,  2452,  2459,  2466,  2475,  2483,
+    2497,  2518,  2539,  2551,  2563,  2575,  2584,  2601,  2611,  2632,
+    2642,  2651,  2659,  2667,  2680,  2693,  2708,  2723,  2732,  2741,
+    2747,  2756,  2765,  2775,  2785,  2795,  2804,  2814,  2823,  2836,
+    2849,  2861,  2875,  2887,  2901,  2910,  2922,  2932,  2939,  2946,
+    2955,  2964,  2974,  2984,  2994,  3001,  3008,  3017,  3026,  3036,
+    3046,  3053,  3060,  3067,  3075,  3085,  3095,  3105,  3115,  3125,
+    3171,  3181,  3189,  3197,  3212,  3221,  3226,  3227,  3228,  3228,
+    3228,  3229,  3229,  3229,  3230,  3230,  3232,  3242,  3251,  3258,
+    3265,  3272,  3279,  3286,  3293,  3298,  3299,  3300,  3300,  3300,
+    3301,  3301,  3301,  3302,  3303,  3303,  3304,  3304,  3305,  3305,
+    3306,  3307,  3308,  3309,  3310,  3311,  3313,  3322,  3332,  3339,
+    3346,  3355,  3362,  3369,  3376,  3383,  3392,  3401,  3408,  3415,
+    3425,  3435,  3445,  3455,  3465,  3475,  3480,  3481,  3482,  3484,
+    3490,  3495,  3496,  3497,  3499,  3505,  3515,  3522,  3531,  3539,
+    3544,  3545,  3547,  3547,  3547,  3548,  3548,  3549,  3550,  3551,
+    3552,  3553,  3555,  3565,  3574,  3581,  3590,  3597,  3606,  3614,
+    3627,  3635,  3648,  3653,  3654,  3655,  3655,  3656,  3656,  3656,
+    3657,  3657,  3659,  3671,  3683,  3695,  3710,  3723,  3736,  3749,
+    3760,  3765,  3766,  3767,  3767,  3769,  3784
 };
 #endif
 
@@ -1966,25 +1373,29 @@ static const char *const yytname[] =
   "VAR_UNWANTED_REPLY_THRESHOLD", "VAR_LOG_TIME_ASCII",
   "VAR_DOMAIN_INSECURE", "VAR_PYTHON", "VAR_PYTHON_SCRIPT",
   "VAR_VAL_SIG_SKEW_MIN", "VAR_VAL_SIG_SKEW_MAX", "VAR_CACHE_MIN_TTL",
-  "VAR_VAL_LOG_LEVEL", "VAR_AUTO_TRUST_ANCHOR_FILE", "VAR_KEEP_MISSING",
-  "VAR_ADD_HOLDDOWN", "VAR_DEL_HOLDDOWN", "VAR_SO_RCVBUF",
-  "VAR_EDNS_BUFFER_SIZE", "VAR_PREFETCH", "VAR_PREFETCH_KEY",
-  "VAR_SO_SNDBUF", "VAR_SO_REUSEPORT", "VAR_HARDEN_BELOW_NXDOMAIN",
-  "VAR_IGNORE_CD_FLAG", "VAR_LOG_QUERIES", "VAR_LOG_REPLIES",
-  "VAR_LOG_LOCAL_ACTIONS", "VAR_TCP_UPSTREAM", "VAR_SSL_UPSTREAM",
-  "VAR_TCP_AUTH_QUERY_TIMEOUT", "VAR_SSL_SERVICE_KEY",
-  "VAR_SSL_SERVICE_PEM", "VAR_SSL_PORT", "VAR_FORWARD_FIRST",
-  "VAR_STUB_SSL_UPSTREAM", "VAR_FORWARD_SSL_UPSTREAM",
-  "VAR_TLS_CERT_BUNDLE", "VAR_HTTPS_PORT", "VAR_HTTP_ENDPOINT",
-  "VAR_HTTP_MAX_STREAMS", "VAR_HTTP_QUERY_BUFFER_SIZE",
-  "VAR_HTTP_RESPONSE_BUFFER_SIZE", "VAR_HTTP_NODELAY",
-  "VAR_HTTP_NOTLS_DOWNSTREAM", "VAR_STUB_FIRST", "VAR_MINIMAL_RESPONSES",
-  "VAR_RRSET_ROUNDROBIN", "VAR_MAX_UDP_SIZE", "VAR_DELAY_CLOSE",
-  "VAR_UDP_CONNECT", "VAR_UNBLOCK_LAN_ZONES", "VAR_INSECURE_LAN_ZONES",
-  "VAR_INFRA_CACHE_MIN_RTT", "VAR_INFRA_KEEP_PROBING", "VAR_DNS64_PREFIX",
-  "VAR_DNS64_SYNTHALL", "VAR_DNS64_IGNORE_AAAA", "VAR_DNSTAP",
-  "VAR_DNSTAP_ENABLE", "VAR_DNSTAP_SOCKET_PATH", "VAR_DNSTAP_IP",
-  "VAR_DNSTAP_TLS", "VAR_DNSTAP_TLS_SERVER_NAME",
+  "VAR_VAL_LOG_LEVEL", "VAR_VAL_VERIFY_THREADS",
+  "VAR_AUTO_TRUST_ANCHOR_FILE", "VAR_KEEP_MISSING", "VAR_ADD_HOLDDOWN",
+  "VAR_DEL_HOLDDOWN", "VAR_SO_RCVBUF", "VAR_EDNS_BUFFER_SIZE",
+  "VAR_PREFETCH", "VAR_PREFETCH_KEY", "VAR_SO_SNDBUF", "VAR_SO_REUSEPORT",
+  "VAR_HARDEN_BELOW_NXDOMAIN", "VAR_IGNORE_CD_FLAG", "VAR_LOG_QUERIES",
+  "VAR_LOG_REPLIES", "VAR_LOG_LOCAL_ACTIONS", "VAR_TCP_UPSTREAM",
+  "VAR_SSL_UPSTREAM", "VAR_TCP_AUTH_QUERY_TIMEOUT",
+  "VAR_TCP_UPSTREAM_POOL", "VAR_SSL_SERVICE_KEY", "VAR_SSL_SERVICE_PEM",
+  "VAR_SSL_PORT", "VAR_FORWARD_FIRST", "VAR_STUB_SSL_UPSTREAM",
+  "VAR_FORWARD_SSL_UPSTREAM", "VAR_TLS_CERT_BUNDLE", "VAR_HTTPS_PORT",
+  "VAR_HTTP_ENDPOINT", "VAR_HTTP_MAX_STREAMS",
+  "VAR_HTTP_QUERY_BUFFER_SIZE", "VAR_HTTP_RESPONSE_BUFFER_SIZE",
+  "VAR_HTTP_NODELAY", "VAR_HTTP_NOTLS_DOWNSTREAM", "VAR_STUB_FIRST",
+  "VAR_MINIMAL_RESPONSES", "VAR_RRSET_ROUNDROBIN", "VAR_MAX_UDP_SIZE",
+  "VAR_DELAY_CLOSE", "VAR_UDP_CONNECT", "VAR_UDP_BATCH_SIZE",
+  "VAR_UNBLOCK_LAN_ZONES", "VAR_INSECURE_LAN_ZONES",
+  "VAR_INFRA_CACHE_MIN_RTT", "VAR_INFRA_KEEP_PROBING", "VAR_UDP_HEDGE",
+  "VAR_UDP_HEDGE_PERCENTILE", "VAR_UDP_HEDGE_MAX_RATE",
+  "VAR_INFRA_SELECT_PERCENTILE", "VAR_UDP_UPSTREAM_BATCH",
+  "VAR_UDP_CONNECT_POOL", "VAR_UDP_CONNECT_REUSE", "VAR_USE_IO_URING",
+  "VAR_DNS64_PREFIX", "VAR_DNS64_SYNTHALL", "VAR_DNS64_IGNORE_AAAA",
+  "VAR_DNSTAP", "VAR_DNSTAP_ENABLE", "VAR_DNSTAP_SOCKET_PATH",
+  "VAR_DNSTAP_IP", "VAR_DNSTAP_TLS", "VAR_DNSTAP_TLS_SERVER_NAME",
   "VAR_DNSTAP_TLS_CERT_BUNDLE", "VAR_DNSTAP_TLS_CLIENT_KEY_FILE",
   "VAR_DNSTAP_TLS_CLIENT_CERT_FILE", "VAR_DNSTAP_SEND_IDENTITY",
   "VAR_DNSTAP_SEND_VERSION", "VAR_DNSTAP_BIDIRECTIONAL",
@@ -2031,21 +1442,28 @@ static const char *const yytname[] =
   "VAR_IPSECMOD_WHITELIST", "VAR_IPSECMOD_STRICT", "VAR_CACHEDB",
   "VAR_CACHEDB_BACKEND", "VAR_CACHEDB_SECRETSEED", "VAR_CACHEDB_REDISHOST",
   "VAR_CACHEDB_REDISPORT", "VAR_CACHEDB_REDISTIMEOUT",
-  "VAR_CACHEDB_REDISEXPIRERECORDS", "VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM",
-  "VAR_FOR_UPSTREAM", "VAR_AUTH_ZONE", "VAR_ZONEFILE", "VAR_MASTER",
-  "VAR_URL", "VAR_FOR_DOWNSTREAM", "VAR_FALLBACK_ENABLED",
-  "VAR_TLS_ADDITIONAL_PORT", "VAR_LOW_RTT", "VAR_LOW_RTT_PERMIL",
-  "VAR_FAST_SERVER_PERMIL", "VAR_FAST_SERVER_NUM", "VAR_ALLOW_NOTIFY",
-  "VAR_TLS_WIN_CERT", "VAR_TCP_CONNECTION_LIMIT", "VAR_FORWARD_NO_CACHE",
-  "VAR_STUB_NO_CACHE", "VAR_LOG_SERVFAIL", "VAR_DENY_ANY",
-  "VAR_UNKNOWN_SERVER_TIME_LIMIT", "VAR_LOG_TAG_QUERYREPLY",
-  "VAR_STREAM_WAIT_SIZE", "VAR_TLS_CIPHERS", "VAR_TLS_CIPHERSUITES",
-  "VAR_TLS_USE_SNI", "VAR_IPSET", "VAR_IPSET_NAME_V4", "VAR_IPSET_NAME_V6",
-  "VAR_TLS_SESSION_TICKET_KEYS", "VAR_RPZ", "VAR_TAGS",
-  "VAR_RPZ_ACTION_OVERRIDE", "VAR_RPZ_CNAME_OVERRIDE", "VAR_RPZ_LOG",
-  "VAR_RPZ_LOG_NAME", "VAR_DYNLIB", "VAR_DYNLIB_FILE",
-  "VAR_EDNS_CLIENT_STRING", "VAR_EDNS_CLIENT_STRING_OPCODE", "VAR_NSID",
-  "VAR_ZONEMD_PERMISSIVE_MODE", "VAR_ZONEMD_REJECT_ABSENCE", "$accept",
+  "VAR_CACHEDB_REDISEXPIRERECORDS", "VAR_CACHEDB_REDISASYNC",
+  "VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM", "VAR_FOR_UPSTREAM",
+  "VAR_AUTH_ZONE", "VAR_ZONEFILE", "VAR_MASTER", "VAR_URL",
+  "VAR_FOR_DOWNSTREAM", "VAR_FALLBACK_ENABLED", "VAR_TLS_ADDITIONAL_PORT",
+  "VAR_LOW_RTT", "VAR_LOW_RTT_PERMIL", "VAR_FAST_SERVER_PERMIL",
+  "VAR_FAST_SERVER_NUM", "VAR_ALLOW_NOTIFY", "VAR_TLS_WIN_CERT",
+  "VAR_TCP_CONNECTION_LIMIT", "VAR_FORWARD_NO_CACHE", "VAR_STUB_NO_CACHE",
+  "VAR_LOG_SERVFAIL", "VAR_DENY_ANY", "VAR_UNKNOWN_SERVER_TIME_LIMIT",
+  "VAR_LOG_TAG_QUERYREPLY", "VAR_STREAM_WAIT_SIZE", "VAR_TLS_CIPHERS",
+  "VAR_TLS_CIPHERSUITES", "VAR_TLS_USE_SNI", "VAR_TLS_UPSTREAM_RESUME",
+  "VAR_TLS_UPSTREAM_EARLY_DATA", "VAR_TLS_USE_KTLS", "VAR_SHARED_INFLIGHT",
+  "VAR_PRIORITY_CLASS", "VAR_ACCESS_CONTROL_PRIORITY_CLASS",
+  "VAR_WORKER_CPU_AFFINITY", "VAR_NUMA_AWARE", "VAR_IPSET",
+  "VAR_IPSET_NAME_V4", "VAR_IPSET_NAME_V6", "VAR_TLS_SESSION_TICKET_KEYS",
+  "VAR_RPZ", "VAR_TAGS", "VAR_RPZ_ACTION_OVERRIDE",
+  "VAR_RPZ_CNAME_OVERRIDE", "VAR_RPZ_LOG", "VAR_RPZ_LOG_NAME",
+  "VAR_DYNLIB", "VAR_DYNLIB_FILE", "VAR_EDNS_CLIENT_STRING",
+  "VAR_EDNS_CLIENT_STRING_OPCODE", "VAR_NSID",
+  "VAR_ZONEMD_PERMISSIVE_MODE", "VAR_ZONEMD_REJECT_ABSENCE",
+  "VAR_CACHE_SNAPSHOT_FILE", "VAR_MSG_CACHE_POLICY",
+  "VAR_RRSET_CACHE_POLICY", "VAR_INFRA_CACHE_POLICY",
+  "VAR_KEY_CACHE_POLICY", "VAR_MSG_CACHE_WIRE_IMAGE", "$accept",
   "toplevelvars", "toplevelvar", "force_toplevel", "serverstart",
   "contents_server", "content_server", "stubstart", "contents_stub",
   "content_stub", "forwardstart", "contents_forward", "content_forward",
@@ -2069,12 +1487,14 @@ static const char *const yytname[] =
   "server_tcp_idle_timeout", "server_max_reuse_tcp_queries",
   "server_tcp_reuse_timeout", "server_tcp_auth_query_timeout",
   "server_tcp_keepalive", "server_tcp_keepalive_timeout",
-  "server_tcp_upstream", "server_udp_upstream_without_downstream",
-  "server_ssl_upstream", "server_ssl_service_key",
-  "server_ssl_service_pem", "server_ssl_port", "server_tls_cert_bundle",
-  "server_tls_win_cert", "server_tls_additional_port",
-  "server_tls_ciphers", "server_tls_ciphersuites",
-  "server_tls_session_ticket_keys", "server_tls_use_sni",
+  "server_tcp_upstream", "server_tcp_upstream_pool",
+  "server_udp_upstream_without_downstream", "server_ssl_upstream",
+  "server_ssl_service_key", "server_ssl_service_pem", "server_ssl_port",
+  "server_tls_cert_bundle", "server_tls_win_cert",
+  "server_tls_additional_port", "server_tls_ciphers",
+  "server_tls_ciphersuites", "server_tls_session_ticket_keys",
+  "server_tls_use_sni", "server_tls_upstream_resume",
+  "server_tls_upstream_early_data", "server_tls_use_ktls",
   "server_https_port", "server_http_endpoint", "server_http_max_streams",
   "server_http_query_buffer_size", "server_http_response_buffer_size",
   "server_http_nodelay", "server_http_notls_downstream",
@@ -2090,47 +1510,58 @@ static const char *const yytname[] =
   "server_domain_insecure", "server_hide_identity", "server_hide_version",
   "server_hide_trustanchor", "server_identity", "server_version",
   "server_nsid", "server_so_rcvbuf", "server_so_sndbuf",
-  "server_so_reuseport", "server_ip_transparent", "server_ip_freebind",
-  "server_ip_dscp", "server_stream_wait_size", "server_edns_buffer_size",
+  "server_so_reuseport", "server_worker_cpu_affinity", "server_numa_aware",
+  "server_ip_transparent", "server_ip_freebind", "server_ip_dscp",
+  "server_stream_wait_size", "server_edns_buffer_size",
   "server_msg_buffer_size", "server_msg_cache_size",
-  "server_msg_cache_slabs", "server_num_queries_per_thread",
+  "server_msg_cache_slabs", "server_msg_cache_policy",
+  "server_msg_cache_wire_image", "server_num_queries_per_thread",
   "server_jostle_timeout", "server_delay_close", "server_udp_connect",
-  "server_unblock_lan_zones", "server_insecure_lan_zones",
-  "server_rrset_cache_size", "server_rrset_cache_slabs",
+  "server_udp_batch_size", "server_udp_upstream_batch",
+  "server_use_io_uring", "server_udp_connect_pool",
+  "server_udp_connect_reuse", "server_unblock_lan_zones",
+  "server_insecure_lan_zones", "server_rrset_cache_size",
+  "server_rrset_cache_slabs", "server_rrset_cache_policy",
   "server_infra_host_ttl", "server_infra_lame_ttl",
-  "server_infra_cache_numhosts", "server_infra_cache_lame_size",
-  "server_infra_cache_slabs", "server_infra_cache_min_rtt",
-  "server_infra_keep_probing", "server_target_fetch_policy",
+  "server_infra_cache_numhosts", "server_infra_cache_policy",
+  "server_infra_cache_lame_size", "server_infra_cache_slabs",
+  "server_cache_snapshot_file", "server_infra_cache_min_rtt",
+  "server_infra_keep_probing", "server_udp_hedge",
+  "server_udp_hedge_percentile", "server_udp_hedge_max_rate",
+  "server_infra_select_percentile", "server_target_fetch_policy",
   "server_harden_short_bufsize", "server_harden_large_queries",
   "server_harden_glue", "server_harden_dnssec_stripped",
   "server_harden_below_nxdomain", "server_harden_referral_path",
   "server_harden_algo_downgrade", "server_use_caps_for_id",
   "server_caps_whitelist", "server_private_address",
-  "server_private_domain", "server_prefetch", "server_prefetch_key",
-  "server_deny_any", "server_unwanted_reply_threshold",
-  "server_do_not_query_address", "server_do_not_query_localhost",
-  "server_access_control", "server_module_conf",
-  "server_val_override_date", "server_val_sig_skew_min",
-  "server_val_sig_skew_max", "server_cache_max_ttl",
-  "server_cache_max_negative_ttl", "server_cache_min_ttl",
-  "server_bogus_ttl", "server_val_clean_additional",
-  "server_val_permissive_mode", "server_aggressive_nsec",
-  "server_ignore_cd_flag", "server_serve_expired",
-  "server_serve_expired_ttl", "server_serve_expired_ttl_reset",
-  "server_serve_expired_reply_ttl", "server_serve_expired_client_timeout",
-  "server_serve_original_ttl", "server_fake_dsa", "server_fake_sha1",
-  "server_val_log_level", "server_val_nsec3_keysize_iterations",
+  "server_private_domain", "server_prefetch", "server_shared_inflight",
+  "server_prefetch_key", "server_deny_any",
+  "server_unwanted_reply_threshold", "server_do_not_query_address",
+  "server_do_not_query_localhost", "server_access_control",
+  "server_module_conf", "server_val_override_date",
+  "server_val_sig_skew_min", "server_val_sig_skew_max",
+  "server_cache_max_ttl", "server_cache_max_negative_ttl",
+  "server_cache_min_ttl", "server_bogus_ttl",
+  "server_val_clean_additional", "server_val_permissive_mode",
+  "server_aggressive_nsec", "server_ignore_cd_flag",
+  "server_serve_expired", "server_serve_expired_ttl",
+  "server_serve_expired_ttl_reset", "server_serve_expired_reply_ttl",
+  "server_serve_expired_client_timeout", "server_serve_original_ttl",
+  "server_fake_dsa", "server_fake_sha1", "server_val_log_level",
+  "server_val_verify_threads", "server_val_nsec3_keysize_iterations",
   "server_zonemd_permissive_mode", "server_add_holddown",
   "server_del_holddown", "server_keep_missing",
   "server_permit_small_holddown", "server_key_cache_size",
-  "server_key_cache_slabs", "server_neg_cache_size", "server_local_zone",
-  "server_local_data", "server_local_data_ptr", "server_minimal_responses",
+  "server_key_cache_slabs", "server_key_cache_policy",
+  "server_neg_cache_size", "server_local_zone", "server_local_data",
+  "server_local_data_ptr", "server_minimal_responses",
   "server_rrset_roundrobin", "server_unknown_server_time_limit",
   "server_max_udp_size", "server_dns64_prefix", "server_dns64_synthall",
   "server_dns64_ignore_aaaa", "server_define_tag", "server_local_zone_tag",
   "server_access_control_tag", "server_access_control_tag_action",
   "server_access_control_tag_data", "server_local_zone_override",
-  "server_access_control_view", "server_response_ip_tag",
+  "server_access_control_view", "server_priority_class",
+  "server_access_control_priority_class", "server_response_ip_tag",
   "server_ip_ratelimit", "server_ratelimit", "server_ip_ratelimit_size",
   "server_ratelimit_size", "server_ip_ratelimit_slabs",
   "server_ratelimit_slabs", "server_ratelimit_for_domain",
@@ -2179,8 +1610,8 @@ static const char *const yytname[] =
   "cachedbstart", "contents_cachedb", "content_cachedb",
   "cachedb_backend_name", "cachedb_secret_seed", "redis_server_host",
   "redis_server_port", "redis_timeout", "redis_expire_records",
-  "server_tcp_connection_limit", "ipsetstart", "contents_ipset",
-  "content_ipset", "ipset_name_v4", "ipset_name_v6", YY_NULLPTR
+  "redis_async", "server_tcp_connection_limit", "ipsetstart",
+  "contents_ipset", "content_ipset", "ipset_name_v4", "ipset_name_v6", YY_NULLPTR
 };
 
 static const char *
@@ -2190,47 +1621,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
-{
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
-     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
-     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
-     565,   566,   567,   568
-};
-#endif
-
-#define YYPACT_NINF (-299)
+#define YYPACT_NINF (-319)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -2240,119 +1631,127 @@ static const yytype_int16 yytoknum[] =
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -299,     0,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,   295,   -43,   -38,   -42,   -44,   -28,   -29,  -148,
-    -109,  -298,  -191,  -189,  -290,     3,     4,    27,    28,    31,
+    -319,     0,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,   315,   -42,   -38,   -43,   -44,   -31,   -28,  -160,
+    -111,  -318,  -202,  -199,  -310,     3,    26,    27,    30,    31,
       32,    33,    34,    35,    37,    38,    39,    40,    41,    53,
-      54,    55,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    87,    88,    90,    91,
-      92,    94,    96,    97,    98,   100,   101,   102,   103,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   132,   133,   136,   137,
-     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   152,   153,   154,   156,   157,   158,
-     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
-     169,   170,   171,   172,   173,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-     210,   211,   212,   213,   215,   216,   217,   219,   225,   226,
-     227,   228,   229,   231,   232,   234,   240,   241,   242,   243,
-     244,   245,   247,   248,   249,   250,   251,   252,   253,   255,
-     256,   257,   258,   260,   261,   262,   269,   270,   271,   272,
-     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
-     283,   284,   285,   286,   288,   289,   290,   292,   293,   294,
-     296,   330,   331,   332,   333,   337,   338,   339,   381,   382,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,   383,   384,   385,   386,
-     387,   388,   389,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,   395,   399,   400,   426,   427,   428,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,   437,   450,   451,   452,   453,   454,
-     455,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,   456,
-     457,   458,   459,   460,   461,   462,   463,   464,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,   465,   466,
-     467,   468,   469,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,   509,   511,   528,   529,   530,   531,
-     532,   533,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,   534,   535,   536,   537,   538,   549,   550,   551,   552,
-     553,   554,   555,   557,   558,   559,   560,   561,   562,   563,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-     566,  -299,  -299,   569,  -299,  -299,   572,   573,   582,   583,
-     584,   586,   587,   588,   589,   590,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,   591,   592,   593,
-     598,   599,   600,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-     601,   602,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,   603,   604,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,   605,   606,   607,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,   608,   609,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,   610,   611,
-     612,   613,   614,   615,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,   616,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,   617,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,   618,  -299,  -299,   619,   620,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-     621,   622,   623,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299
+      54,    56,    57,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    87,    88,    89,    90,    91,
+      93,    94,    96,    98,    99,   100,   101,   103,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   167,   168,   169,
+     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,   183,   185,   186,   187,   188,   189,   190,
+     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   223,   224,   226,   227,   228,   229,   231,   237,
+     238,   239,   240,   241,   243,   249,   250,   252,   253,   254,
+     256,   257,   258,   259,   260,   261,   262,   263,   264,   266,
+     267,   268,   269,   270,   271,   272,   273,   274,   276,   277,
+     278,   280,   286,   287,   288,   289,   290,   291,   292,   293,
+     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
+     304,   305,   306,   308,   309,   310,   312,   313,   314,   316,
+     350,   351,   352,   353,   357,   358,   359,   401,   402,   403,
+     404,   405,   406,   407,   408,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,   409,   415,   419,   420,
+     448,   449,   450,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,   459,   481,   482,   483,   484,   485,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,   486,   487,   488,   489,   490,   491,
+     492,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,   493,
+     494,   495,   496,   497,   498,   499,   500,   540,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,   542,   559,
+     560,   561,   562,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,   563,   564,   565,   566,   567,   568,
+     569,   580,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,   581,   582,   583,   584,   585,   586,   587,   589,   590,
+     591,   592,   593,   594,   595,   598,   601,   604,   605,   622,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+     623,  -319,  -319,   624,  -319,  -319,   626,   627,   628,   629,
+     630,   631,   632,   633,   638,   645,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,   646,   647,   648,
+     649,   650,   651,   652,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,   653,   654,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,   655,   656,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,   657,   658,   659,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+     660,   661,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,   662,   663,   664,   665,   666,   667,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,   668,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,   669,   670,  -319,  -319,  -319,   671,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,   672,  -319,  -319,   673,   674,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,   675,   676,
+     677,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,    18,    19,   237,   247,   535,   595,   554,
-     256,   609,   632,   266,   648,   283,   600,     3,    17,    21,
-     239,   249,   258,   268,   285,   537,   556,   597,   602,   611,
-     634,   650,     4,     5,     6,    10,    14,    15,     8,     9,
+       2,     0,     1,    18,    19,   262,   272,   585,   645,   604,
+     281,   659,   682,   291,   700,   308,   650,     3,    17,    21,
+     264,   274,   283,   293,   310,   587,   606,   647,   652,   661,
+     684,   702,     4,     5,     6,    10,    14,    15,     8,     9,
        7,    16,    11,    12,    13,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -2375,265 +1774,286 @@ static const yytype_int16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      20,    22,    23,    86,    89,    98,   200,   201,    24,   160,
-     161,   162,   163,   164,   165,   166,   167,   168,   169,    37,
-      77,    25,    90,    91,    48,    70,    85,    26,    27,    30,
-      31,    28,    29,    32,    33,    34,   234,   235,   236,    35,
-      36,   121,   212,   122,   124,   125,   126,   214,   219,   215,
-     226,   227,   228,   229,   127,   128,   129,   130,   131,   132,
-     133,   196,    87,    76,   102,   119,   120,   224,   221,   123,
-      38,    39,    40,    41,    42,    78,    92,    93,   108,    64,
-      74,    65,   204,   205,   103,    58,    59,   203,    60,    61,
-     232,   112,   116,   137,   147,   174,   150,   225,   113,    71,
-      43,    44,    45,   100,   138,   139,   140,   141,    46,    47,
-      49,    50,    52,    53,    51,   145,   151,    54,    55,    56,
-      62,    81,   117,    95,   146,    88,   170,    96,    97,   114,
-     115,   222,   101,    57,    79,    82,    63,    66,   104,   105,
-      80,   171,   106,    67,    68,    69,   213,   118,   188,   189,
-     190,   191,   192,   193,   194,   202,   107,    75,   233,   109,
-     110,   111,   172,    72,    73,    94,    83,    84,    99,   134,
-     135,   223,   136,   142,   143,   144,   175,   176,   178,   180,
-     181,   179,   182,   197,   148,   149,   154,   155,   152,   153,
-     156,   157,   159,   158,   216,   218,   217,   173,   183,   184,
-     185,   186,   187,   206,   208,   207,   209,   210,   211,   230,
-     231,   177,   195,   198,   199,   220,     0,     0,     0,     0,
-       0,     0,     0,   238,   240,   241,   242,   244,   245,   246,
-     243,     0,     0,     0,     0,     0,     0,   248,   250,   251,
-     252,   253,   254,   255,     0,     0,     0,     0,     0,     0,
-       0,   257,   259,   260,   263,   264,   261,   265,   262,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   267,   269,
-     270,   271,   272,   276,   277,   273,   274,   275,     0,     0,
-       0,     0,     0,   288,   292,   293,   294,   295,   284,   286,
-     287,   289,   290,   291,     0,     0,     0,     0,     0,     0,
-       0,     0,   536,   538,   540,   539,   545,   541,   542,   543,
-     544,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     555,   557,   559,   558,   560,   561,   562,   563,   564,   565,
-     566,   567,   568,   569,   570,   571,   572,   573,   574,   575,
-       0,   596,   598,     0,   601,   603,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   610,   612,   613,   614,
-     616,   617,   615,   618,   619,   620,   621,     0,     0,     0,
-       0,     0,     0,   633,   635,   636,   637,   638,   639,   640,
-       0,     0,   649,   651,   652,   297,   296,   303,   316,   314,
-     326,   322,   323,   327,   324,   325,   328,   329,   330,   334,
-     335,   365,   366,   367,   368,   369,   395,   396,   397,   403,
-     404,   319,   405,   406,   409,   407,   408,   412,   413,   414,
-     428,   380,   381,   383,   384,   415,   431,   374,   376,   432,
-     438,   439,   440,   320,   394,   458,   459,   375,   452,   358,
-     315,   370,   429,   435,   416,     0,     0,   462,   321,   298,
-     357,   420,   299,   317,   318,   371,   372,   460,   418,   422,
-     423,   332,   331,   300,   463,   398,   427,   359,   379,   433,
-     434,   437,   451,   373,   456,   454,   455,   386,   393,   424,
-     425,   387,   388,   417,   442,   360,   361,   364,   336,   338,
-     333,   339,   340,   341,   342,   349,   350,   351,   352,   353,
-     354,   355,   464,   465,   467,   399,   400,   401,   402,   410,
-     411,   468,   469,   470,     0,     0,     0,   419,   389,   391,
-     605,   479,   483,   481,   480,   484,   482,     0,     0,   487,
-     488,   304,   305,   306,   307,   308,   309,   310,   311,   312,
-     313,   421,   436,   457,   492,   493,   390,   471,     0,     0,
-       0,     0,     0,     0,   443,   444,   445,   446,   447,   448,
-     449,   450,   606,   382,   377,   441,   356,   301,   302,   378,
-     494,   495,   496,   497,   498,   500,   499,   501,   502,   503,
-     337,   344,   489,   491,   490,   343,     0,   363,   426,   466,
-     362,   392,   345,   346,   348,   347,     0,   505,   385,   453,
-     506,   507,   508,   512,   511,   509,   510,   513,   514,   515,
-     516,   518,   517,   528,     0,   532,   533,     0,     0,   534,
-     519,   526,   520,   521,   522,   525,   527,   523,   524,   278,
-     279,   280,   281,   282,   546,   548,   547,   550,   551,   552,
-     553,   549,   576,   578,   579,   580,   581,   582,   583,   584,
-     585,   586,   577,   587,   588,   589,   590,   591,   592,   593,
-     594,   599,   604,   622,   623,   624,   627,   625,   626,   628,
-     629,   630,   631,   641,   642,   643,   644,   645,   646,   653,
-     654,   430,   461,   478,   607,   608,   485,   486,   472,   473,
-       0,     0,     0,   477,   647,   504,   529,   530,   531,   476,
-     474,   475
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    20,    22,    23,    86,    89,
+      98,   217,   218,    24,   177,   178,   179,   180,   181,   182,
+     183,   184,   185,   186,    37,    77,    25,    90,    91,    48,
+      70,    85,    26,    27,    30,    31,    28,    29,    32,    33,
+      34,   259,   260,   261,    35,    36,   122,   124,   229,   123,
+     126,   127,   128,   231,   236,   232,   243,   244,   245,   246,
+     248,   249,   250,   129,   130,   131,   132,   133,   134,   135,
+     213,    87,    76,   102,   120,   121,   241,   238,   125,    38,
+      39,    40,    41,    42,    78,    92,    93,   109,    64,    74,
+      65,   221,   222,   103,    58,    59,   220,    60,    61,   257,
+     113,   117,   139,   254,   255,   154,   191,   157,   242,   114,
+      71,    43,    44,   164,   168,    45,   100,   140,   141,   142,
+     143,   146,   144,   145,   147,   148,    46,    47,   165,    49,
+      50,    52,   166,    53,    51,   159,   152,   158,   160,   161,
+     162,   163,    54,    55,    56,    62,    81,   118,    95,   153,
+      88,   187,    96,    97,   115,   251,   116,   239,   101,    57,
+      79,    82,    63,    66,   104,   105,    80,   188,   106,    67,
+      68,    69,   230,   119,   205,   206,   207,   208,   209,   210,
+     211,   219,   107,   108,    75,   258,   110,   111,   112,   189,
+      72,    73,   167,    94,    83,    84,    99,   136,   137,   240,
+     138,   149,   150,   151,   192,   193,   195,   197,   198,   196,
+     199,   252,   253,   214,   155,   156,   171,   172,   169,   170,
+     173,   174,   176,   175,   233,   235,   234,   190,   200,   201,
+     202,   203,   204,   223,   225,   224,   226,   227,   228,   247,
+     256,   194,   212,   215,   216,   237,     0,     0,     0,     0,
+       0,     0,     0,   263,   265,   266,   267,   269,   270,   271,
+     268,     0,     0,     0,     0,     0,     0,   273,   275,   276,
+     277,   278,   279,   280,     0,     0,     0,     0,     0,     0,
+       0,   282,   284,   285,   288,   289,   286,   290,   287,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   292,   294,
+     295,   296,   297,   301,   302,   298,   299,   300,     0,     0,
+       0,     0,     0,   313,   317,   318,   319,   320,   309,   311,
+     312,   314,   315,   316,     0,     0,     0,     0,     0,     0,
+       0,     0,   586,   588,   590,   589,   595,   591,   592,   593,
+     594,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     605,   607,   609,   608,   610,   611,   612,   613,   614,   615,
+     616,   617,   618,   619,   620,   621,   622,   623,   624,   625,
+       0,   646,   648,     0,   651,   653,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   660,   662,   663,   664,
+     666,   667,   665,   668,   669,   670,   671,     0,     0,     0,
+       0,     0,     0,     0,   683,   685,   686,   687,   688,   689,
+     690,   691,     0,     0,   701,   703,   704,   322,   321,   328,
+     341,   339,   351,   347,   348,   352,   349,   350,   353,   354,
+     355,   359,   360,   394,   395,   396,   397,   398,   426,   427,
+     430,   441,   442,   344,   444,   445,   449,   446,   448,   457,
+     458,   459,   474,   409,   410,   412,   413,   460,   477,   403,
+     405,   478,   484,   485,   486,   345,   425,   505,   506,   404,
+     499,   387,   340,   399,   475,   481,   461,     0,     0,   510,
+     346,   323,   386,   465,   324,   342,   343,   400,   401,   508,
+     463,   467,   468,   357,   356,   325,   511,   431,   473,   388,
+     408,   479,   480,   483,   497,   498,   402,   503,   501,   502,
+     415,   424,   469,   471,   416,   417,   462,   488,   389,   390,
+     393,   361,   364,   358,   362,   365,   366,   367,   368,   378,
+     379,   380,   381,   382,   383,   384,   512,   513,   515,   432,
+     433,   434,   439,   440,   451,   452,   453,   454,   455,   456,
+     435,   437,   438,   436,   516,   517,   518,     0,     0,     0,
+     464,   420,   422,   655,   529,   533,   531,   530,   534,   532,
+       0,     0,   537,   538,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   466,   482,   504,   542,   543,   421,
+     519,     0,     0,     0,     0,     0,     0,   489,   490,   491,
+     492,   493,   494,   495,   496,   656,   411,   406,   487,   385,
+     326,   327,   407,   544,   545,   546,   547,   548,   550,   549,
+     551,   552,   553,   363,   370,   539,   541,   540,   369,     0,
+     392,   472,   514,   391,   423,   371,   372,   374,   375,   376,
+     377,   470,     0,     0,   418,   419,   373,     0,   555,   414,
+     500,   450,   428,   443,   447,   507,   429,   556,   557,   558,
+     562,   561,   559,   560,   563,   564,   565,   566,   568,   567,
+     578,     0,   582,   583,     0,     0,   584,   569,   576,   570,
+     571,   572,   575,   577,   573,   574,   303,   304,   305,   306,
+     307,   596,   598,   597,   600,   601,   602,   603,   599,   626,
+     628,   629,   630,   631,   632,   633,   634,   635,   636,   627,
+     637,   638,   639,   640,   641,   642,   643,   644,   649,   654,
+     672,   673,   674,   677,   675,   676,   678,   679,   680,   681,
+     692,   693,   694,   695,   696,   697,   698,   705,   706,   476,
+     509,   528,   657,   658,   535,   536,   520,   521,     0,     0,
+       0,   525,   699,   526,   527,   554,   579,   580,   581,   524,
+     522,   523
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-     268,   597,   624,   625,   626,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,
-    -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299,  -299
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,   678,   679,   680,   681,   682,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,  -319,
+    -319,  -319,  -319,  -319,  -319
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    17,    18,    19,    32,   260,    20,    33,   483,
-      21,    34,   497,    22,    35,   511,    23,    36,   528,   543,
-     544,   545,   546,   547,    24,    37,   548,   261,   262,   263,
-     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
-     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
-     284,   285,   286,   287,   288,   289,   290,   291,   292,   293,
-     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
-     304,   305,   306,   307,   308,   309,   310,   311,   312,   313,
-     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
-     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
-     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
-     344,   345,   346,   347,   348,   349,   350,   351,   352,   353,
-     354,   355,   356,   357,   358,   359,   360,   361,   362,   363,
-     364,   365,   366,   367,   368,   369,   370,   371,   372,   373,
-     374,   375,   376,   377,   378,   379,   380,   381,   382,   383,
-     384,   385,   386,   387,   388,   389,   390,   391,   392,   393,
-     394,   395,   396,   397,   398,   399,   400,   401,   402,   403,
-     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
-     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
-     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
-     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
-     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
-     454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
-     464,   465,   466,   467,   468,   469,   470,   484,   485,   486,
-     487,   488,   489,   490,   498,   499,   500,   501,   502,   503,
-     529,   530,   531,   532,   533,   534,   535,   536,   537,   512,
-     513,   514,   515,   516,   517,   518,    25,    38,   562,   563,
-     564,   565,   566,   567,   568,   569,   570,    26,    39,   590,
-     591,   592,   593,   594,   595,   596,   597,   598,   599,   600,
-     601,   602,   603,   604,   605,   606,   607,   608,   609,    27,
-      40,   611,   612,    28,    41,   614,   615,   471,   472,   473,
-     474,    29,    42,   626,   627,   628,   629,   630,   631,   632,
-     633,   634,   635,   636,    30,    43,   643,   644,   645,   646,
-     647,   648,   649,   475,    31,    44,   652,   653,   654
+       0,     1,    17,    18,    19,    32,   285,    20,    33,   533,
+      21,    34,   547,    22,    35,   561,    23,    36,   578,   593,
+     594,   595,   596,   597,    24,    37,   598,   286,   287,   288,
+     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
+     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+     309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
+     319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,   358,
+     359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
+     369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
+     389,   390,   391,   392,   393,   394,   395,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,   435,   436,   437,   438,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   458,
+     459,   460,   461,   462,   463,   464,   465,   466,   467,   468,
+     469,   470,   471,   472,   473,   474,   475,   476,   477,   478,
+     479,   480,   481,   482,   483,   484,   485,   486,   487,   488,
+     489,   490,   491,   492,   493,   494,   495,   496,   497,   498,
+     499,   500,   501,   502,   503,   504,   505,   506,   507,   508,
+     509,   510,   511,   512,   513,   514,   515,   516,   517,   518,
+     519,   520,   534,   535,   536,   537,   538,   539,   540,   548,
+     549,   550,   551,   552,   553,   579,   580,   581,   582,   583,
+     584,   585,   586,   587,   562,   563,   564,   565,   566,   567,
+     568,    25,    38,   612,   613,   614,   615,   616,   617,   618,
+     619,   620,    26,    39,   640,   641,   642,   643,   644,   645,
+     646,   647,   648,   649,   650,   651,   652,   653,   654,   655,
+     656,   657,   658,   659,    27,    40,   661,   662,    28,    41,
+     664,   665,   521,   522,   523,   524,    29,    42,   676,   677,
+     678,   679,   680,   681,   682,   683,   684,   685,   686,    30,
+      43,   694,   695,   696,   697,   698,   699,   700,   701,   525,
+      31,    44,   704,   705,   706
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-       2,   519,   476,   504,   477,   478,   610,   491,   650,   651,
-     613,     3,     4,   655,   656,   492,   493,   519,   571,   572,
-     573,   574,   575,   576,   577,   578,   579,   580,   581,   582,
-     583,   584,   585,   586,   587,   588,   589,   657,   658,   505,
-     506,   659,   660,   661,   662,   663,     5,   664,   665,   666,
-     667,   668,     6,   616,   617,   618,   619,   620,   621,   622,
-     623,   624,   625,   669,   670,   671,   507,   479,   554,   555,
-     556,   557,   558,   559,   560,   561,   637,   638,   639,   640,
-     641,   642,   672,   673,   674,   675,   676,   677,   678,   679,
-     680,   681,   682,   683,   684,   685,     7,   686,   687,   480,
-     688,   689,   690,   494,   691,   495,   692,   693,   694,   481,
-     695,   696,   697,   698,     8,   699,   700,   701,   702,   703,
-     704,   705,   706,   707,   708,   709,   710,   711,   712,   713,
-     714,   715,   716,   717,   718,   719,   720,   721,   722,   723,
-     724,   725,   726,   727,   508,   509,   728,   729,   730,   731,
-     732,   733,   734,   735,   736,   737,   738,   739,   740,   741,
-     742,   743,   744,   745,   746,     9,   747,   748,   749,   750,
-     751,   752,   753,   754,   755,   756,   757,   758,   759,   760,
-     761,   762,   763,   764,   510,   765,   766,   767,   768,   769,
-     770,   771,   772,   773,   774,   775,   776,   777,   778,   779,
-     780,   781,   782,   783,   784,   785,   786,   787,   788,   789,
-     790,   791,   792,   793,   794,   795,   796,   797,   798,   799,
-     800,   801,   802,   803,    10,   804,   805,   806,   520,   807,
-     521,   522,   523,   524,   525,   808,   809,   810,   811,   812,
-     526,   813,   814,    11,   815,   482,   521,   522,   523,   496,
-     816,   817,   818,   819,   820,   821,   526,   822,   823,   824,
-     825,   826,   827,   828,    12,   829,   830,   831,   832,   527,
-     833,   834,   835,    13,   538,   539,   540,   541,   542,   836,
-     837,   838,   839,   840,   841,   842,   843,   844,   845,   846,
-     847,   848,   849,   850,   851,   852,   853,    14,   854,   855,
-     856,    15,   857,   858,   859,   549,   860,    16,    45,    46,
+       2,   569,   554,   526,   660,   527,   528,   541,   702,   703,
+     663,     3,     4,   707,   569,   542,   543,   621,   622,   623,
+     624,   625,   626,   627,   628,   629,   630,   631,   632,   633,
+     634,   635,   636,   637,   638,   639,   708,   709,   555,   556,
+     710,   711,   712,   713,   714,   715,     5,   716,   717,   718,
+     719,   720,     6,   666,   667,   668,   669,   670,   671,   672,
+     673,   674,   675,   721,   722,   557,   723,   724,   529,   604,
+     605,   606,   607,   608,   609,   610,   611,   687,   688,   689,
+     690,   691,   692,   693,   725,   726,   727,   728,   729,   730,
+     731,   732,   733,   734,   735,   736,     7,   737,   738,   739,
+     740,   741,   530,   742,   743,   544,   744,   545,   745,   746,
+     747,   748,   531,   749,     8,   750,   751,   752,   753,   754,
+     755,   756,   757,   758,   759,   760,   761,   762,   763,   764,
+     765,   766,   767,   768,   769,   770,   771,   772,   773,   774,
+     775,   776,   777,   778,   779,   780,   781,   782,   783,   784,
+     785,   786,   787,   788,   558,   559,   789,   790,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,   801,   802,
+     803,   804,   805,   806,   807,   808,     9,   809,   810,   811,
+     812,   813,   814,   815,   816,   817,   818,   819,   820,   821,
+     822,   823,   824,   825,   560,   826,   827,   828,   829,   830,
+     831,   832,   833,   834,   835,   836,   837,   838,   839,   840,
+     841,   842,   843,   844,   845,   846,   847,   848,   849,   850,
+     851,   852,   853,   854,   855,   856,   857,   858,   859,   860,
+     861,   862,   863,   864,   865,    10,   866,   867,   868,   869,
+     570,   870,   571,   572,   573,   574,   575,   871,   872,   873,
+     874,   875,   576,   876,    11,   571,   572,   573,   532,   877,
+     878,   546,   879,   880,   881,   576,   882,   883,   884,   885,
+     886,   887,   888,   889,   890,    12,   891,   892,   893,   894,
+     895,   896,   897,   898,   899,    13,   900,   901,   902,   577,
+     903,   588,   589,   590,   591,   592,   904,   905,   906,   907,
+     908,   909,   910,   911,   912,   913,   914,   915,   916,   917,
+     918,   919,   920,   921,   922,   923,   924,    14,   925,   926,
+     927,    15,   928,   929,   930,     0,   931,    16,    45,    46,
       47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
       57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
       67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
-     861,   862,   863,   864,    77,    78,    79,   865,   866,   867,
+     932,   933,   934,   935,    77,    78,    79,   936,   937,   938,
       80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
       90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
      100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
      110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,   868,   869,   870,   871,   872,   873,   874,   875,   876,
-     121,   122,   123,   124,   125,   877,   126,   127,   128,   878,
-     879,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     120,   939,   940,   941,   942,   943,   944,   945,   946,   947,
+     121,   122,   123,   124,   125,   948,   126,   127,   128,   949,
+     950,   129,   130,   131,   132,   133,   134,   135,   136,   137,
      138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   152,   153,   880,   881,   882,   154,
-     155,   156,   157,   158,   159,   160,   161,   883,   162,   163,
+     148,   149,   150,   151,   152,   153,   154,   155,   951,   952,
+     953,   156,   157,   158,   159,   160,   161,   162,   163,   954,
      164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
-     884,   885,   886,   887,   888,   889,   890,   891,   892,   893,
-     894,   895,   896,   897,   898,   899,   900,   901,   902,   903,
      174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   190,   191,   192,   193,
+     184,   955,   956,   957,   958,   959,   960,   961,   962,   963,
+     964,   965,   966,   967,   968,   969,   970,   971,   972,   973,
+     974,   185,   186,   187,   188,   189,   190,   191,   192,   193,
      194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   904,
-     213,   905,   214,   215,   216,   217,   218,   219,   220,   221,
-     222,   223,   224,   225,   226,   227,   228,   229,   906,   907,
-     908,   909,   910,   911,   912,   913,   914,   915,   916,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   917,
-     918,   919,   920,   921,   922,   923,   240,   924,   925,   926,
-     927,   928,   929,   930,   241,   242,   931,   243,   244,   932,
-     245,   246,   933,   934,   247,   248,   249,   250,   251,   252,
-     253,   254,   935,   936,   937,   255,   938,   939,   940,   941,
-     942,   943,   944,   945,   256,   257,   258,   259,   946,   947,
-     948,   949,   950,   951,   952,   953,   954,   955,   956,   957,
-     958,   959,   960,   961,   962,   963,   964,   965,   966,   967,
-     968,   969,   970,   971,   550,     0,     0,     0,     0,     0,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     975,   224,   976,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   977,
+     978,   979,   980,   981,   982,   983,   984,   985,   986,   987,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
+     988,   989,   990,   991,   992,   993,   994,   995,   251,   996,
+     997,   998,   999,  1000,  1001,  1002,   252,   253,  1003,   254,
+     255,  1004,   256,   257,  1005,  1006,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     272,   273,  1007,  1008,  1009,   274,  1010,  1011,  1012,  1013,
+    1014,  1015,  1016,  1017,   275,   276,   277,   278,  1018,   279,
+     280,   281,   282,   283,   284,  1019,  1020,  1021,  1022,  1023,
+    1024,  1025,  1026,  1027,  1028,  1029,  1030,  1031,  1032,  1033,
+    1034,  1035,  1036,  1037,  1038,  1039,  1040,  1041,  1042,  1043,
+    1044,  1045,  1046,  1047,  1048,  1049,  1050,  1051,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   551,   552,   553
+       0,     0,     0,     0,     0,   599,   600,   601,   602,   603
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    45,    45,    45,    47,    48,   115,    45,   298,   299,
-     308,    11,    12,    10,    10,    53,    54,    45,   166,   167,
-     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
-     178,   179,   180,   181,   182,   183,   184,    10,    10,    81,
-      82,    10,    10,    10,    10,    10,    46,    10,    10,    10,
-      10,    10,    52,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,    10,    10,    10,   108,   110,    97,    98,
-      99,   100,   101,   102,   103,   104,   265,   266,   267,   268,
-     269,   270,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    96,    10,    10,   142,
-      10,    10,    10,   141,    10,   143,    10,    10,    10,   152,
-      10,    10,    10,    10,   114,    10,    10,    10,    10,    10,
+       0,    45,    45,    45,   115,    47,    48,    45,   318,   319,
+     328,    11,    12,    10,    45,    53,    54,   177,   178,   179,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+     190,   191,   192,   193,   194,   195,    10,    10,    81,    82,
+      10,    10,    10,    10,    10,    10,    46,    10,    10,    10,
+      10,    10,    52,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,    10,    10,   108,    10,    10,   110,    97,
+      98,    99,   100,   101,   102,   103,   104,   276,   277,   278,
+     279,   280,   281,   282,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    96,    10,    10,    10,
+      10,    10,   144,    10,    10,   143,    10,   145,    10,    10,
+      10,    10,   154,    10,   114,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   186,   187,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,   165,    10,    10,    10,    10,
+      10,    10,    10,    10,   197,   198,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   226,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,   176,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,   237,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   224,    10,    10,    10,   272,    10,
-     274,   275,   276,   277,   278,    10,    10,    10,    10,    10,
-     284,    10,    10,   243,    10,   288,   274,   275,   276,   287,
-      10,    10,    10,    10,    10,    10,   284,    10,    10,    10,
-      10,    10,    10,    10,   264,    10,    10,    10,    10,   313,
-      10,    10,    10,   273,   302,   303,   304,   305,   306,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,   297,    10,    10,
-      10,   301,    10,    10,    10,    37,    10,   307,    13,    14,
+      10,    10,    10,    10,    10,   235,    10,    10,    10,    10,
+     284,    10,   286,   287,   288,   289,   290,    10,    10,    10,
+      10,    10,   296,    10,   254,   286,   287,   288,   300,    10,
+      10,   299,    10,    10,    10,   296,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,   275,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,   285,    10,    10,    10,   333,
+      10,   322,   323,   324,   325,   326,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,   317,    10,    10,
+      10,   321,    10,    10,    10,    -1,    10,   327,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
@@ -2646,41 +2066,44 @@ static const yytype_int16 yycheck[] =
      105,   106,   107,   108,   109,    10,   111,   112,   113,    10,
       10,   116,   117,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,    10,    10,    10,   144,
-     145,   146,   147,   148,   149,   150,   151,    10,   153,   154,
+     135,   136,   137,   138,   139,   140,   141,   142,    10,    10,
+      10,   146,   147,   148,   149,   150,   151,   152,   153,    10,
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
-     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+      10,   196,   197,   198,   199,   200,   201,   202,   203,   204,
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
-     215,   216,   217,   218,   219,   220,   221,   222,   223,    10,
-     225,    10,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237,   238,   239,   240,   241,   242,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,   254,
-     255,   256,   257,   258,   259,   260,   261,   262,   263,    10,
-      10,    10,    10,    10,    10,    10,   271,    10,    10,    10,
-      10,    10,    10,    10,   279,   280,    10,   282,   283,    10,
-     285,   286,    10,    10,   289,   290,   291,   292,   293,   294,
-     295,   296,    10,    10,    10,   300,    10,    10,    10,    10,
-      10,    10,    10,    10,   309,   310,   311,   312,    10,    10,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+      10,   236,    10,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+      10,    10,    10,    10,    10,    10,    10,    10,   283,    10,
+      10,    10,    10,    10,    10,    10,   291,   292,    10,   294,
+     295,    10,   297,   298,    10,    10,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,    10,    10,    10,   320,    10,    10,    10,    10,
+      10,    10,    10,    10,   329,   330,   331,   332,    10,   334,
+     335,   336,   337,   338,   339,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    37,    -1,    -1,    -1,    -1,    -1,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    37,    37,    37
+      -1,    -1,    -1,    -1,    -1,    37,    37,    37,    37,    37
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int16 yystos[] =
 {
-       0,   315,     0,    11,    12,    46,    52,    96,   114,   165,
-     224,   243,   264,   273,   297,   301,   307,   316,   317,   318,
-     321,   324,   327,   330,   338,   580,   591,   613,   617,   625,
-     638,   648,   319,   322,   325,   328,   331,   339,   581,   592,
-     614,   618,   626,   639,   649,    13,    14,    15,    16,    17,
+       0,   341,     0,    11,    12,    46,    52,    96,   114,   176,
+     235,   254,   275,   285,   317,   321,   327,   342,   343,   344,
+     347,   350,   353,   356,   364,   631,   642,   664,   668,   676,
+     689,   700,   345,   348,   351,   354,   357,   365,   632,   643,
+     665,   669,   677,   690,   701,    13,    14,    15,    16,    17,
       18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    40,    41,    42,    43,    44,    49,    50,    51,
@@ -2691,57 +2114,65 @@ static const yytype_int16 yystos[] =
       95,   105,   106,   107,   108,   109,   111,   112,   113,   116,
      117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
      127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   144,   145,   146,   147,   148,   149,
-     150,   151,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   162,   163,   164,   185,   186,   187,   188,   189,   190,
-     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
+     137,   138,   139,   140,   141,   142,   146,   147,   148,   149,
+     150,   151,   152,   153,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,   174,   175,   196,   197,   198,   199,   200,
      201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
      211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-     221,   222,   223,   225,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
-     271,   279,   280,   282,   283,   285,   286,   289,   290,   291,
-     292,   293,   294,   295,   296,   300,   309,   310,   311,   312,
-     320,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
-     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
-     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
-     380,   381,   382,   383,   384,   385,   386,   387,   388,   389,
-     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-     400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
-     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
-     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
-     430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
-     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
-     450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
-     460,   461,   462,   463,   464,   465,   466,   467,   468,   469,
-     470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
-     480,   481,   482,   483,   484,   485,   486,   487,   488,   489,
-     490,   491,   492,   493,   494,   495,   496,   497,   498,   499,
-     500,   501,   502,   503,   504,   505,   506,   507,   508,   509,
-     510,   511,   512,   513,   514,   515,   516,   517,   518,   519,
-     520,   521,   522,   523,   524,   525,   526,   527,   528,   529,
-     530,   531,   532,   533,   534,   535,   536,   537,   538,   539,
-     540,   541,   542,   543,   544,   545,   546,   547,   548,   549,
-     550,   621,   622,   623,   624,   647,    45,    47,    48,   110,
-     142,   152,   288,   323,   551,   552,   553,   554,   555,   556,
-     557,    45,    53,    54,   141,   143,   287,   326,   558,   559,
-     560,   561,   562,   563,    45,    81,    82,   108,   186,   187,
-     226,   329,   573,   574,   575,   576,   577,   578,   579,    45,
-     272,   274,   275,   276,   277,   278,   284,   313,   332,   564,
-     565,   566,   567,   568,   569,   570,   571,   572,   302,   303,
-     304,   305,   306,   333,   334,   335,   336,   337,   340,   564,
-     565,   566,   567,   568,    97,    98,    99,   100,   101,   102,
-     103,   104,   582,   583,   584,   585,   586,   587,   588,   589,
-     590,   166,   167,   168,   169,   170,   171,   172,   173,   174,
-     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-     593,   594,   595,   596,   597,   598,   599,   600,   601,   602,
-     603,   604,   605,   606,   607,   608,   609,   610,   611,   612,
-     115,   615,   616,   308,   619,   620,   244,   245,   246,   247,
-     248,   249,   250,   251,   252,   253,   627,   628,   629,   630,
-     631,   632,   633,   634,   635,   636,   637,   265,   266,   267,
-     268,   269,   270,   640,   641,   642,   643,   644,   645,   646,
-     298,   299,   650,   651,   652,    10,    10,    10,    10,    10,
+     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,   236,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   265,   266,   267,   268,   269,   270,   271,   272,   273,
+     274,   283,   291,   292,   294,   295,   297,   298,   301,   302,
+     303,   304,   305,   306,   307,   308,   309,   310,   311,   312,
+     313,   314,   315,   316,   320,   329,   330,   331,   332,   334,
+     335,   336,   337,   338,   339,   346,   367,   368,   369,   370,
+     371,   372,   373,   374,   375,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   385,   386,   387,   388,   389,   390,
+     391,   392,   393,   394,   395,   396,   397,   398,   399,   400,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   458,   459,   460,
+     461,   462,   463,   464,   465,   466,   467,   468,   469,   470,
+     471,   472,   473,   474,   475,   476,   477,   478,   479,   480,
+     481,   482,   483,   484,   485,   486,   487,   488,   489,   490,
+     491,   492,   493,   494,   495,   496,   497,   498,   499,   500,
+     501,   502,   503,   504,   505,   506,   507,   508,   509,   510,
+     511,   512,   513,   514,   515,   516,   517,   518,   519,   520,
+     521,   522,   523,   524,   525,   526,   527,   528,   529,   530,
+     531,   532,   533,   534,   535,   536,   537,   538,   539,   540,
+     541,   542,   543,   544,   545,   546,   547,   548,   549,   550,
+     551,   552,   553,   554,   555,   556,   557,   558,   559,   560,
+     561,   562,   563,   564,   565,   566,   567,   568,   569,   570,
+     571,   572,   573,   574,   575,   576,   577,   578,   579,   580,
+     581,   582,   583,   584,   585,   586,   587,   588,   589,   590,
+     591,   592,   593,   594,   595,   596,   597,   598,   599,   600,
+     601,   672,   673,   674,   675,   699,    45,    47,    48,   110,
+     144,   154,   300,   349,   602,   603,   604,   605,   606,   607,
+     608,    45,    53,    54,   143,   145,   299,   352,   609,   610,
+     611,   612,   613,   614,    45,    81,    82,   108,   197,   198,
+     237,   355,   624,   625,   626,   627,   628,   629,   630,    45,
+     284,   286,   287,   288,   289,   290,   296,   333,   358,   615,
+     616,   617,   618,   619,   620,   621,   622,   623,   322,   323,
+     324,   325,   326,   359,   360,   361,   362,   363,   366,   615,
+     616,   617,   618,   619,    97,    98,    99,   100,   101,   102,
+     103,   104,   633,   634,   635,   636,   637,   638,   639,   640,
+     641,   177,   178,   179,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     644,   645,   646,   647,   648,   649,   650,   651,   652,   653,
+     654,   655,   656,   657,   658,   659,   660,   661,   662,   663,
+     115,   666,   667,   328,   670,   671,   255,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   678,   679,   680,   681,
+     682,   683,   684,   685,   686,   687,   688,   276,   277,   278,
+     279,   280,   281,   282,   691,   692,   693,   694,   695,   696,
+     697,   698,   318,   319,   702,   703,   704,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -2776,78 +2207,83 @@ static const yytype_int16 yystos[] =
       10,    10
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   314,   315,   315,   316,   316,   316,   316,   316,   316,
-     316,   316,   316,   316,   316,   316,   316,   316,   317,   318,
-     319,   319,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   321,   322,   322,
-     323,   323,   323,   323,   323,   323,   323,   324,   325,   325,
-     326,   326,   326,   326,   326,   326,   327,   328,   328,   329,
-     329,   329,   329,   329,   329,   329,   330,   331,   331,   332,
-     332,   332,   332,   332,   332,   332,   332,   332,   333,   334,
-     335,   336,   337,   338,   339,   339,   340,   340,   340,   340,
-     340,   340,   340,   340,   340,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
-     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
-     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
-     565,   566,   567,   568,   569,   570,   571,   572,   573,   574,
-     575,   576,   577,   578,   579,   580,   581,   581,   582,   582,
-     582,   582,   582,   582,   582,   582,   583,   584,   585,   586,
-     587,   588,   589,   590,   591,   592,   592,   593,   593,   593,
-     593,   593,   593,   593,   593,   593,   593,   593,   593,   593,
-     593,   593,   593,   593,   593,   593,   594,   595,   596,   597,
-     598,   599,   600,   601,   602,   603,   604,   605,   606,   607,
-     608,   609,   610,   611,   612,   613,   614,   614,   615,   616,
-     617,   618,   618,   619,   620,   621,   622,   623,   624,   625,
-     626,   626,   627,   627,   627,   627,   627,   627,   627,   627,
-     627,   627,   628,   629,   630,   631,   632,   633,   634,   635,
-     636,   637,   638,   639,   639,   640,   640,   640,   640,   640,
-     640,   641,   642,   643,   644,   645,   646,   647,   648,   649,
-     649,   650,   650,   651,   652
+       0,   340,   341,   341,   342,   342,   342,   342,   342,   342,
+     342,   342,   342,   342,   342,   342,   342,   342,   343,   344,
+     345,   345,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
+     346,   346,   347,   348,   348,   349,   349,   349,   349,   349,
+     349,   349,   350,   351,   351,   352,   352,   352,   352,   352,
+     352,   353,   354,   354,   355,   355,   355,   355,   355,   355,
+     355,   356,   357,   357,   358,   358,   358,   358,   358,   358,
+     358,   358,   358,   359,   360,   361,   362,   363,   364,   365,
+     365,   366,   366,   366,   366,   366,   366,   366,   366,   366,
+     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
+     396,   397,   398,   399,   400,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
+     466,   467,   468,   469,   470,   471,   472,   473,   474,   475,
+     476,   477,   478,   479,   480,   481,   482,   483,   484,   485,
+     486,   487,   488,   489,   490,   491,   492,   493,   494,   495,
+     496,   497,   498,   499,   500,   501,   502,   503,   504,   505,
+     506,   507,   508,   509,   510,   511,   512,   513,   514,   515,
+     516,   517,   518,   519,   520,   521,   522,   523,   524,   525,
+     526,   527,   528,   529,   530,   531,   532,   533,   534,   535,
+     536,   537,   538,   539,   540,   541,   542,   543,   544,   545,
+     546,   547,   548,   549,   550,   551,   552,   553,   554,   555,
+     556,   557,   558,   559,   560,   561,   562,   563,   564,   565,
+     566,   567,   568,   569,   570,   571,   572,   573,   574,   575,
+     576,   577,   578,   579,   580,   581,   582,   583,   584,   585,
+     586,   587,   588,   589,   590,   591,   592,   593,   594,   595,
+     596,   597,   598,   599,   600,   601,   602,   603,   604,   605,
+     606,   607,   608,   609,   610,   611,   612,   613,   614,   615,
+     616,   617,   618,   619,   620,   621,   622,   623,   624,   625,
+     626,   627,   628,   629,   630,   631,   632,   632,   633,   633,
+     633,   633,   633,   633,   633,   633,   634,   635,   636,   637,
+     638,   639,   640,   641,   642,   643,   643,   644,   644,   644,
+     644,   644,   644,   644,   644,   644,   644,   644,   644,   644,
+     644,   644,   644,   644,   644,   644,   645,   646,   647,   648,
+     649,   650,   651,   652,   653,   654,   655,   656,   657,   658,
+     659,   660,   661,   662,   663,   664,   665,   665,   666,   667,
+     668,   669,   669,   670,   671,   672,   673,   674,   675,   676,
+     677,   677,   678,   678,   678,   678,   678,   678,   678,   678,
+     678,   678,   679,   680,   681,   682,   683,   684,   685,   686,
+     687,   688,   689,   690,   690,   691,   691,   691,   691,   691,
+     691,   691,   692,   693,   694,   695,   696,   697,   698,   699,
+     700,   701,   701,   702,   702,   703,   704
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
@@ -2873,13 +2309,18 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     2,     0,
-       1,     1,     1,     1,     1,     1,     1,     1,     2,     0,
-       1,     1,     1,     1,     1,     1,     1,     2,     0,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     0,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
-       2,     2,     2,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     0,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     0,     1,     1,     1,     1,     1,
+       1,     1,     2,     0,     1,     1,     1,     1,     1,     1,
+       1,     1,     2,     0,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     2,     2,     2,     2,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -2892,12 +2333,12 @@ static const yytype_int8 yyr2[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     3,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     3,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     3,     3,     4,     4,     4,     3,     3,     2,
+       3,     3,     4,     4,     4,     3,     3,     3,     3,     2,
        2,     2,     2,     2,     2,     3,     3,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
@@ -2914,8 +2355,8 @@ static const yytype_int8 yyr2[] =
        2,     0,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
-       1,     2,     2,     2,     2,     2,     2,     3,     1,     2,
-       0,     1,     1,     2,     2
+       1,     1,     2,     2,     2,     2,     2,     2,     2,     3,
+       1,     2,     0,     1,     1,     2,     2
 };
 
 
@@ -2927,6 +2368,7 @@ enum { YYENOMEM = -2 };
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -2967,10 +2409,7 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-# ifndef YY_LOCATION_PRINT
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
+
 
 
 # define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
@@ -2994,15 +2433,11 @@ yy_symbol_value_print (FILE *yyo,
                        yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yykind < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yykind], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yykind);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -3116,18 +2551,18 @@ static void
 yydestruct (const char *yymsg,
             yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
   YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yykind);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -3145,34 +2580,30 @@ int yynerrs;
 int
 yyparse (void)
 {
-    yy_state_fast_t yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
     /* Their size.  */
-    YYPTRDIFF_T yystacksize;
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The state stack.  */
+    /* The state stack: array, bottom, top.  */
     yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
   /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
+  /* Lookahead symbol kind.  */
   yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
@@ -3186,18 +2617,10 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yynerrs = 0;
-  yystate = 0;
-  yyerrstatus = 0;
-
-  yystacksize = YYINITDEPTH;
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
 
@@ -3223,7 +2646,7 @@ yysetstate:
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -3251,7 +2674,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -3262,7 +2685,7 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -3284,6 +2707,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -3395,24 +2819,24 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 18:
-#line 198 "./util/configparser.y"
+  case 18: /* force_toplevel: VAR_FORCE_TOPLEVEL  */
+#line 208 "./util/configparser.y"
         {
 		OUTYY(("\nP(force-toplevel)\n"));
 	}
-#line 3404 "util/configparser.c"
+#line 2828 "util/configparser.c"
     break;
 
-  case 19:
-#line 204 "./util/configparser.y"
+  case 19: /* serverstart: VAR_SERVER  */
+#line 214 "./util/configparser.y"
         { 
 		OUTYY(("\nP(server:)\n"));
 	}
-#line 3412 "util/configparser.c"
+#line 2836 "util/configparser.c"
     break;
 
-  case 237:
-#line 309 "./util/configparser.y"
+  case 262: /* stubstart: VAR_STUB_ZONE  */
+#line 334 "./util/configparser.y"
         {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
@@ -3423,11 +2847,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3427 "util/configparser.c"
+#line 2851 "util/configparser.c"
     break;
 
-  case 247:
-#line 326 "./util/configparser.y"
+  case 272: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 351 "./util/configparser.y"
         {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
@@ -3438,11 +2862,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3442 "util/configparser.c"
+#line 2866 "util/configparser.c"
     break;
 
-  case 256:
-#line 343 "./util/configparser.y"
+  case 281: /* viewstart: VAR_VIEW  */
+#line 368 "./util/configparser.y"
         {
 		struct config_view* s;
 		OUTYY(("\nP(view:)\n")); 
@@ -3455,11 +2879,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3459 "util/configparser.c"
+#line 2883 "util/configparser.c"
     break;
 
-  case 266:
-#line 362 "./util/configparser.y"
+  case 291: /* authstart: VAR_AUTH_ZONE  */
+#line 387 "./util/configparser.y"
         {
 		struct config_auth* s;
 		OUTYY(("\nP(auth_zone:)\n")); 
@@ -3476,11 +2900,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3480 "util/configparser.c"
+#line 2904 "util/configparser.c"
     break;
 
-  case 278:
-#line 387 "./util/configparser.y"
+  case 303: /* rpz_tag: VAR_TAGS STRING_ARG  */
+#line 412 "./util/configparser.y"
         {
 		uint8_t* bitlist;
 		size_t len = 0;
@@ -3497,11 +2921,11 @@ yyreduce:
 
 		}
 	}
-#line 3501 "util/configparser.c"
+#line 2925 "util/configparser.c"
     break;
 
-  case 279:
-#line 406 "./util/configparser.y"
+  case 304: /* rpz_action_override: VAR_RPZ_ACTION_OVERRIDE STRING_ARG  */
+#line 431 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_action_override:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "nxdomain")!=0 && strcmp((yyvsp[0].str), "nodata")!=0 &&
@@ -3516,21 +2940,21 @@ yyreduce:
 			cfg_parser->cfg->auths->rpz_action_override = (yyvsp[0].str);
 		}
 	}
-#line 3520 "util/configparser.c"
+#line 2944 "util/configparser.c"
     break;
 
-  case 280:
-#line 423 "./util/configparser.y"
+  case 305: /* rpz_cname_override: VAR_RPZ_CNAME_OVERRIDE STRING_ARG  */
+#line 448 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_cname_override:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->rpz_cname);
 		cfg_parser->cfg->auths->rpz_cname = (yyvsp[0].str);
 	}
-#line 3530 "util/configparser.c"
+#line 2954 "util/configparser.c"
     break;
 
-  case 281:
-#line 431 "./util/configparser.y"
+  case 306: /* rpz_log: VAR_RPZ_LOG STRING_ARG  */
+#line 456 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_log:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3538,21 +2962,21 @@ yyreduce:
 		else cfg_parser->cfg->auths->rpz_log = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3542 "util/configparser.c"
+#line 2966 "util/configparser.c"
     break;
 
-  case 282:
-#line 441 "./util/configparser.y"
+  case 307: /* rpz_log_name: VAR_RPZ_LOG_NAME STRING_ARG  */
+#line 466 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_log_name:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->rpz_log_name);
 		cfg_parser->cfg->auths->rpz_log_name = (yyvsp[0].str);
 	}
-#line 3552 "util/configparser.c"
+#line 2976 "util/configparser.c"
     break;
 
-  case 283:
-#line 449 "./util/configparser.y"
+  case 308: /* rpzstart: VAR_RPZ  */
+#line 474 "./util/configparser.y"
         {
 		struct config_auth* s;
 		OUTYY(("\nP(rpz:)\n")); 
@@ -3568,11 +2992,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3572 "util/configparser.c"
+#line 2996 "util/configparser.c"
     break;
 
-  case 296:
-#line 472 "./util/configparser.y"
+  case 321: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 497 "./util/configparser.y"
         { 
 		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3580,11 +3004,11 @@ yyreduce:
 		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3584 "util/configparser.c"
+#line 3008 "util/configparser.c"
     break;
 
-  case 297:
-#line 481 "./util/configparser.y"
+  case 322: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 506 "./util/configparser.y"
         { 
 		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3592,11 +3016,11 @@ yyreduce:
 		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3596 "util/configparser.c"
+#line 3020 "util/configparser.c"
     break;
 
-  case 298:
-#line 490 "./util/configparser.y"
+  case 323: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 515 "./util/configparser.y"
         { 
 		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
@@ -3606,11 +3030,11 @@ yyreduce:
 		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3610 "util/configparser.c"
+#line 3034 "util/configparser.c"
     break;
 
-  case 299:
-#line 501 "./util/configparser.y"
+  case 324: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 526 "./util/configparser.y"
         {
 		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3618,11 +3042,11 @@ yyreduce:
 		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3622 "util/configparser.c"
+#line 3046 "util/configparser.c"
     break;
 
-  case 300:
-#line 510 "./util/configparser.y"
+  case 325: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 535 "./util/configparser.y"
         {
 		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3630,11 +3054,11 @@ yyreduce:
 		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3634 "util/configparser.c"
+#line 3058 "util/configparser.c"
     break;
 
-  case 301:
-#line 519 "./util/configparser.y"
+  case 326: /* server_shm_enable: VAR_SHM_ENABLE STRING_ARG  */
+#line 544 "./util/configparser.y"
         {
 		OUTYY(("P(server_shm_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3642,11 +3066,11 @@ yyreduce:
 		else cfg_parser->cfg->shm_enable = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3646 "util/configparser.c"
+#line 3070 "util/configparser.c"
     break;
 
-  case 302:
-#line 528 "./util/configparser.y"
+  case 327: /* server_shm_key: VAR_SHM_KEY STRING_ARG  */
+#line 553 "./util/configparser.y"
         { 
 		OUTYY(("P(server_shm_key:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
@@ -3656,11 +3080,11 @@ yyreduce:
 		else cfg_parser->cfg->shm_key = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3660 "util/configparser.c"
+#line 3084 "util/configparser.c"
     break;
 
-  case 303:
-#line 539 "./util/configparser.y"
+  case 328: /* server_port: VAR_PORT STRING_ARG  */
+#line 564 "./util/configparser.y"
         {
 		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -3668,11 +3092,11 @@ yyreduce:
 		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3672 "util/configparser.c"
+#line 3096 "util/configparser.c"
     break;
 
-  case 304:
-#line 548 "./util/configparser.y"
+  case 329: /* server_send_client_subnet: VAR_SEND_CLIENT_SUBNET STRING_ARG  */
+#line 573 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_send_client_subnet:%s)\n", (yyvsp[0].str)));
@@ -3683,11 +3107,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 3687 "util/configparser.c"
+#line 3111 "util/configparser.c"
     break;
 
-  case 305:
-#line 560 "./util/configparser.y"
+  case 330: /* server_client_subnet_zone: VAR_CLIENT_SUBNET_ZONE STRING_ARG  */
+#line 585 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_zone:%s)\n", (yyvsp[0].str)));
@@ -3699,11 +3123,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 3703 "util/configparser.c"
+#line 3127 "util/configparser.c"
     break;
 
-  case 306:
-#line 574 "./util/configparser.y"
+  case 331: /* server_client_subnet_always_forward: VAR_CLIENT_SUBNET_ALWAYS_FORWARD STRING_ARG  */
+#line 599 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_always_forward:%s)\n", (yyvsp[0].str)));
@@ -3717,11 +3141,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3721 "util/configparser.c"
+#line 3145 "util/configparser.c"
     break;
 
-  case 307:
-#line 589 "./util/configparser.y"
+  case 332: /* server_client_subnet_opcode: VAR_CLIENT_SUBNET_OPCODE STRING_ARG  */
+#line 614 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(client_subnet_opcode:%s)\n", (yyvsp[0].str)));
@@ -3731,11 +3155,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3735 "util/configparser.c"
+#line 3159 "util/configparser.c"
     break;
 
-  case 308:
-#line 600 "./util/configparser.y"
+  case 333: /* server_max_client_subnet_ipv4: VAR_MAX_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 625 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
@@ -3751,11 +3175,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3755 "util/configparser.c"
+#line 3179 "util/configparser.c"
     break;
 
-  case 309:
-#line 617 "./util/configparser.y"
+  case 334: /* server_max_client_subnet_ipv6: VAR_MAX_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 642 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
@@ -3771,11 +3195,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3775 "util/configparser.c"
+#line 3199 "util/configparser.c"
     break;
 
-  case 310:
-#line 634 "./util/configparser.y"
+  case 335: /* server_min_client_subnet_ipv4: VAR_MIN_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 659 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(min_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
@@ -3791,11 +3215,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3795 "util/configparser.c"
+#line 3219 "util/configparser.c"
     break;
 
-  case 311:
-#line 651 "./util/configparser.y"
+  case 336: /* server_min_client_subnet_ipv6: VAR_MIN_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 676 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(min_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
@@ -3811,11 +3235,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3815 "util/configparser.c"
+#line 3239 "util/configparser.c"
     break;
 
-  case 312:
-#line 668 "./util/configparser.y"
+  case 337: /* server_max_ecs_tree_size_ipv4: VAR_MAX_ECS_TREE_SIZE_IPV4 STRING_ARG  */
+#line 693 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_ecs_tree_size_ipv4:%s)\n", (yyvsp[0].str)));
@@ -3829,11 +3253,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3833 "util/configparser.c"
+#line 3257 "util/configparser.c"
     break;
 
-  case 313:
-#line 683 "./util/configparser.y"
+  case 338: /* server_max_ecs_tree_size_ipv6: VAR_MAX_ECS_TREE_SIZE_IPV6 STRING_ARG  */
+#line 708 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_ecs_tree_size_ipv6:%s)\n", (yyvsp[0].str)));
@@ -3847,11 +3271,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3851 "util/configparser.c"
+#line 3275 "util/configparser.c"
     break;
 
-  case 314:
-#line 698 "./util/configparser.y"
+  case 339: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 723 "./util/configparser.y"
         {
 		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
@@ -3863,11 +3287,11 @@ yyreduce:
 		else
 			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
-#line 3867 "util/configparser.c"
+#line 3291 "util/configparser.c"
     break;
 
-  case 315:
-#line 711 "./util/configparser.y"
+  case 340: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 736 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
@@ -3881,11 +3305,11 @@ yyreduce:
 			cfg_parser->cfg->out_ifs[
 				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
-#line 3885 "util/configparser.c"
+#line 3309 "util/configparser.c"
     break;
 
-  case 316:
-#line 726 "./util/configparser.y"
+  case 341: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 751 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -3893,11 +3317,11 @@ yyreduce:
 		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3897 "util/configparser.c"
+#line 3321 "util/configparser.c"
     break;
 
-  case 317:
-#line 735 "./util/configparser.y"
+  case 342: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 760 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 1, 
@@ -3905,11 +3329,11 @@ yyreduce:
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 3909 "util/configparser.c"
+#line 3333 "util/configparser.c"
     break;
 
-  case 318:
-#line 744 "./util/configparser.y"
+  case 343: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 769 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 0, 
@@ -3917,11 +3341,11 @@ yyreduce:
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 3921 "util/configparser.c"
+#line 3345 "util/configparser.c"
     break;
 
-  case 319:
-#line 753 "./util/configparser.y"
+  case 344: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 778 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3929,11 +3353,11 @@ yyreduce:
 		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3933 "util/configparser.c"
+#line 3357 "util/configparser.c"
     break;
 
-  case 320:
-#line 762 "./util/configparser.y"
+  case 345: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 787 "./util/configparser.y"
         {
 		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3941,11 +3365,11 @@ yyreduce:
 		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3945 "util/configparser.c"
+#line 3369 "util/configparser.c"
     break;
 
-  case 321:
-#line 771 "./util/configparser.y"
+  case 346: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 796 "./util/configparser.y"
         {
 		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3953,11 +3377,11 @@ yyreduce:
 		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3957 "util/configparser.c"
+#line 3381 "util/configparser.c"
     break;
 
-  case 322:
-#line 780 "./util/configparser.y"
+  case 347: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 805 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3965,11 +3389,11 @@ yyreduce:
 		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3969 "util/configparser.c"
+#line 3393 "util/configparser.c"
     break;
 
-  case 323:
-#line 789 "./util/configparser.y"
+  case 348: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 814 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3977,11 +3401,11 @@ yyreduce:
 		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3981 "util/configparser.c"
+#line 3405 "util/configparser.c"
     break;
 
-  case 324:
-#line 798 "./util/configparser.y"
+  case 349: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 823 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3989,11 +3413,11 @@ yyreduce:
 		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3993 "util/configparser.c"
+#line 3417 "util/configparser.c"
     break;
 
-  case 325:
-#line 807 "./util/configparser.y"
+  case 350: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 832 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4001,11 +3425,11 @@ yyreduce:
 		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4005 "util/configparser.c"
+#line 3429 "util/configparser.c"
     break;
 
-  case 326:
-#line 816 "./util/configparser.y"
+  case 351: /* server_prefer_ip4: VAR_PREFER_IP4 STRING_ARG  */
+#line 841 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefer_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4013,11 +3437,11 @@ yyreduce:
 		else cfg_parser->cfg->prefer_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4017 "util/configparser.c"
+#line 3441 "util/configparser.c"
     break;
 
-  case 327:
-#line 825 "./util/configparser.y"
+  case 352: /* server_prefer_ip6: VAR_PREFER_IP6 STRING_ARG  */
+#line 850 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefer_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4025,11 +3449,11 @@ yyreduce:
 		else cfg_parser->cfg->prefer_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4029 "util/configparser.c"
+#line 3453 "util/configparser.c"
     break;
 
-  case 328:
-#line 834 "./util/configparser.y"
+  case 353: /* server_tcp_mss: VAR_TCP_MSS STRING_ARG  */
+#line 859 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_mss:%s)\n", (yyvsp[0].str)));
                 if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4037,11 +3461,11 @@ yyreduce:
                 else cfg_parser->cfg->tcp_mss = atoi((yyvsp[0].str));
                 free((yyvsp[0].str));
 	}
-#line 4041 "util/configparser.c"
+#line 3465 "util/configparser.c"
     break;
 
-  case 329:
-#line 843 "./util/configparser.y"
+  case 354: /* server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG  */
+#line 868 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_tcp_mss:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4049,11 +3473,11 @@ yyreduce:
 		else cfg_parser->cfg->outgoing_tcp_mss = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4053 "util/configparser.c"
+#line 3477 "util/configparser.c"
     break;
 
-  case 330:
-#line 852 "./util/configparser.y"
+  case 355: /* server_tcp_idle_timeout: VAR_TCP_IDLE_TIMEOUT STRING_ARG  */
+#line 877 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_idle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4065,11 +3489,11 @@ yyreduce:
 		else cfg_parser->cfg->tcp_idle_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4069 "util/configparser.c"
+#line 3493 "util/configparser.c"
     break;
 
-  case 331:
-#line 865 "./util/configparser.y"
+  case 356: /* server_max_reuse_tcp_queries: VAR_MAX_REUSE_TCP_QUERIES STRING_ARG  */
+#line 890 "./util/configparser.y"
         {
 		OUTYY(("P(server_max_reuse_tcp_queries:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4079,11 +3503,11 @@ yyreduce:
 		else cfg_parser->cfg->max_reuse_tcp_queries = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4083 "util/configparser.c"
+#line 3507 "util/configparser.c"
     break;
 
-  case 332:
-#line 876 "./util/configparser.y"
+  case 357: /* server_tcp_reuse_timeout: VAR_TCP_REUSE_TIMEOUT STRING_ARG  */
+#line 901 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_reuse_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4093,11 +3517,11 @@ yyreduce:
 		else cfg_parser->cfg->tcp_reuse_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4097 "util/configparser.c"
+#line 3521 "util/configparser.c"
     break;
 
-  case 333:
-#line 887 "./util/configparser.y"
+  case 358: /* server_tcp_auth_query_timeout: VAR_TCP_AUTH_QUERY_TIMEOUT STRING_ARG  */
+#line 912 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_auth_query_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4107,11 +3531,11 @@ yyreduce:
 		else cfg_parser->cfg->tcp_auth_query_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4111 "util/configparser.c"
+#line 3535 "util/configparser.c"
     break;
 
-  case 334:
-#line 898 "./util/configparser.y"
+  case 359: /* server_tcp_keepalive: VAR_EDNS_TCP_KEEPALIVE STRING_ARG  */
+#line 923 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_keepalive:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4119,11 +3543,11 @@ yyreduce:
 		else cfg_parser->cfg->do_tcp_keepalive = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4123 "util/configparser.c"
+#line 3547 "util/configparser.c"
     break;
 
-  case 335:
-#line 907 "./util/configparser.y"
+  case 360: /* server_tcp_keepalive_timeout: VAR_EDNS_TCP_KEEPALIVE_TIMEOUT STRING_ARG  */
+#line 932 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_keepalive_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4135,11 +3559,11 @@ yyreduce:
 		else cfg_parser->cfg->tcp_keepalive_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4139 "util/configparser.c"
+#line 3563 "util/configparser.c"
     break;
 
-  case 336:
-#line 920 "./util/configparser.y"
+  case 361: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 945 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4147,11 +3571,23 @@ yyreduce:
 		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4151 "util/configparser.c"
+#line 3575 "util/configparser.c"
     break;
 
-  case 337:
-#line 929 "./util/configparser.y"
+  case 362: /* server_tcp_upstream_pool: VAR_TCP_UPSTREAM_POOL STRING_ARG  */
+#line 954 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tcp_upstream_pool:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_upstream_pool = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3587 "util/configparser.c"
+    break;
+
+  case 363: /* server_udp_upstream_without_downstream: VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM STRING_ARG  */
+#line 963 "./util/configparser.y"
         {
 		OUTYY(("P(server_udp_upstream_without_downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4159,11 +3595,11 @@ yyreduce:
 		else cfg_parser->cfg->udp_upstream_without_downstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4163 "util/configparser.c"
+#line 3599 "util/configparser.c"
     break;
 
-  case 338:
-#line 938 "./util/configparser.y"
+  case 364: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 972 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4171,31 +3607,31 @@ yyreduce:
 		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4175 "util/configparser.c"
+#line 3611 "util/configparser.c"
     break;
 
-  case 339:
-#line 947 "./util/configparser.y"
+  case 365: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 981 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
 		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
-#line 4185 "util/configparser.c"
+#line 3621 "util/configparser.c"
     break;
 
-  case 340:
-#line 954 "./util/configparser.y"
+  case 366: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 988 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
 		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
-#line 4195 "util/configparser.c"
+#line 3631 "util/configparser.c"
     break;
 
-  case 341:
-#line 961 "./util/configparser.y"
+  case 367: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 995 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4203,21 +3639,21 @@ yyreduce:
 		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4207 "util/configparser.c"
+#line 3643 "util/configparser.c"
     break;
 
-  case 342:
-#line 970 "./util/configparser.y"
+  case 368: /* server_tls_cert_bundle: VAR_TLS_CERT_BUNDLE STRING_ARG  */
+#line 1004 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_cert_bundle:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_cert_bundle);
 		cfg_parser->cfg->tls_cert_bundle = (yyvsp[0].str);
 	}
-#line 4217 "util/configparser.c"
+#line 3653 "util/configparser.c"
     break;
 
-  case 343:
-#line 977 "./util/configparser.y"
+  case 369: /* server_tls_win_cert: VAR_TLS_WIN_CERT STRING_ARG  */
+#line 1011 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_win_cert:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4225,53 +3661,53 @@ yyreduce:
 		else cfg_parser->cfg->tls_win_cert = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4229 "util/configparser.c"
+#line 3665 "util/configparser.c"
     break;
 
-  case 344:
-#line 986 "./util/configparser.y"
+  case 370: /* server_tls_additional_port: VAR_TLS_ADDITIONAL_PORT STRING_ARG  */
+#line 1020 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_additional_port:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->tls_additional_port,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4240 "util/configparser.c"
+#line 3676 "util/configparser.c"
     break;
 
-  case 345:
-#line 994 "./util/configparser.y"
+  case 371: /* server_tls_ciphers: VAR_TLS_CIPHERS STRING_ARG  */
+#line 1028 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_ciphers:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_ciphers);
 		cfg_parser->cfg->tls_ciphers = (yyvsp[0].str);
 	}
-#line 4250 "util/configparser.c"
+#line 3686 "util/configparser.c"
     break;
 
-  case 346:
-#line 1001 "./util/configparser.y"
+  case 372: /* server_tls_ciphersuites: VAR_TLS_CIPHERSUITES STRING_ARG  */
+#line 1035 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_ciphersuites:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_ciphersuites);
 		cfg_parser->cfg->tls_ciphersuites = (yyvsp[0].str);
 	}
-#line 4260 "util/configparser.c"
+#line 3696 "util/configparser.c"
     break;
 
-  case 347:
-#line 1008 "./util/configparser.y"
+  case 373: /* server_tls_session_ticket_keys: VAR_TLS_SESSION_TICKET_KEYS STRING_ARG  */
+#line 1042 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_session_ticket_keys:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append(&cfg_parser->cfg->tls_session_ticket_keys,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4271 "util/configparser.c"
+#line 3707 "util/configparser.c"
     break;
 
-  case 348:
-#line 1016 "./util/configparser.y"
+  case 374: /* server_tls_use_sni: VAR_TLS_USE_SNI STRING_ARG  */
+#line 1050 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_use_sni:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4279,11 +3715,49 @@ yyreduce:
 		else cfg_parser->cfg->tls_use_sni = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4283 "util/configparser.c"
+#line 3719 "util/configparser.c"
+    break;
+
+  case 375: /* server_tls_upstream_resume: VAR_TLS_UPSTREAM_RESUME STRING_ARG  */
+#line 1059 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tls_upstream_resume:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_upstream_resume =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3732 "util/configparser.c"
+    break;
+
+  case 376: /* server_tls_upstream_early_data: VAR_TLS_UPSTREAM_EARLY_DATA STRING_ARG  */
+#line 1069 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tls_upstream_early_data:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_upstream_early_data =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3745 "util/configparser.c"
+    break;
+
+  case 377: /* server_tls_use_ktls: VAR_TLS_USE_KTLS STRING_ARG  */
+#line 1079 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tls_use_ktls:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_use_ktls = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3757 "util/configparser.c"
     break;
 
-  case 349:
-#line 1025 "./util/configparser.y"
+  case 378: /* server_https_port: VAR_HTTPS_PORT STRING_ARG  */
+#line 1088 "./util/configparser.y"
         {
 		OUTYY(("P(server_https_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4291,11 +3765,11 @@ yyreduce:
 		else cfg_parser->cfg->https_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4295 "util/configparser.c"
+#line 3769 "util/configparser.c"
     break;
 
-  case 350:
-#line 1033 "./util/configparser.y"
+  case 379: /* server_http_endpoint: VAR_HTTP_ENDPOINT STRING_ARG  */
+#line 1096 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_endpoint:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->http_endpoint);
@@ -4311,11 +3785,11 @@ yyreduce:
 			cfg_parser->cfg->http_endpoint = (yyvsp[0].str);
 		}
 	}
-#line 4315 "util/configparser.c"
+#line 3789 "util/configparser.c"
     break;
 
-  case 351:
-#line 1049 "./util/configparser.y"
+  case 380: /* server_http_max_streams: VAR_HTTP_MAX_STREAMS STRING_ARG  */
+#line 1112 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_max_streams:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4323,11 +3797,11 @@ yyreduce:
 		else cfg_parser->cfg->http_max_streams = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4327 "util/configparser.c"
+#line 3801 "util/configparser.c"
     break;
 
-  case 352:
-#line 1057 "./util/configparser.y"
+  case 381: /* server_http_query_buffer_size: VAR_HTTP_QUERY_BUFFER_SIZE STRING_ARG  */
+#line 1120 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_query_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str),
@@ -4335,11 +3809,11 @@ yyreduce:
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4339 "util/configparser.c"
+#line 3813 "util/configparser.c"
     break;
 
-  case 353:
-#line 1065 "./util/configparser.y"
+  case 382: /* server_http_response_buffer_size: VAR_HTTP_RESPONSE_BUFFER_SIZE STRING_ARG  */
+#line 1128 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_response_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str),
@@ -4347,11 +3821,11 @@ yyreduce:
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4351 "util/configparser.c"
+#line 3825 "util/configparser.c"
     break;
 
-  case 354:
-#line 1073 "./util/configparser.y"
+  case 383: /* server_http_nodelay: VAR_HTTP_NODELAY STRING_ARG  */
+#line 1136 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_nodelay:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4359,11 +3833,11 @@ yyreduce:
 		else cfg_parser->cfg->http_nodelay = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4363 "util/configparser.c"
+#line 3837 "util/configparser.c"
     break;
 
-  case 355:
-#line 1081 "./util/configparser.y"
+  case 384: /* server_http_notls_downstream: VAR_HTTP_NOTLS_DOWNSTREAM STRING_ARG  */
+#line 1144 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_notls_downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4371,11 +3845,11 @@ yyreduce:
 		else cfg_parser->cfg->http_notls_downstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4375 "util/configparser.c"
+#line 3849 "util/configparser.c"
     break;
 
-  case 356:
-#line 1089 "./util/configparser.y"
+  case 385: /* server_use_systemd: VAR_USE_SYSTEMD STRING_ARG  */
+#line 1152 "./util/configparser.y"
         {
 		OUTYY(("P(server_use_systemd:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4383,11 +3857,11 @@ yyreduce:
 		else cfg_parser->cfg->use_systemd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4387 "util/configparser.c"
+#line 3861 "util/configparser.c"
     break;
 
-  case 357:
-#line 1098 "./util/configparser.y"
+  case 386: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 1161 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4395,11 +3869,11 @@ yyreduce:
 		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4399 "util/configparser.c"
+#line 3873 "util/configparser.c"
     break;
 
-  case 358:
-#line 1107 "./util/configparser.y"
+  case 387: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 1170 "./util/configparser.y"
         {
 		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4412,11 +3886,11 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 4416 "util/configparser.c"
+#line 3890 "util/configparser.c"
     break;
 
-  case 359:
-#line 1121 "./util/configparser.y"
+  case 388: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 1184 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4424,11 +3898,11 @@ yyreduce:
 		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4428 "util/configparser.c"
+#line 3902 "util/configparser.c"
     break;
 
-  case 360:
-#line 1130 "./util/configparser.y"
+  case 389: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 1193 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4436,11 +3910,11 @@ yyreduce:
 		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4440 "util/configparser.c"
+#line 3914 "util/configparser.c"
     break;
 
-  case 361:
-#line 1139 "./util/configparser.y"
+  case 390: /* server_log_replies: VAR_LOG_REPLIES STRING_ARG  */
+#line 1202 "./util/configparser.y"
   {
   	OUTYY(("P(server_log_replies:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4448,11 +3922,11 @@ yyreduce:
   	else cfg_parser->cfg->log_replies = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 4452 "util/configparser.c"
+#line 3926 "util/configparser.c"
     break;
 
-  case 362:
-#line 1148 "./util/configparser.y"
+  case 391: /* server_log_tag_queryreply: VAR_LOG_TAG_QUERYREPLY STRING_ARG  */
+#line 1211 "./util/configparser.y"
   {
   	OUTYY(("P(server_log_tag_queryreply:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4460,11 +3934,11 @@ yyreduce:
   	else cfg_parser->cfg->log_tag_queryreply = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 4464 "util/configparser.c"
+#line 3938 "util/configparser.c"
     break;
 
-  case 363:
-#line 1157 "./util/configparser.y"
+  case 392: /* server_log_servfail: VAR_LOG_SERVFAIL STRING_ARG  */
+#line 1220 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_servfail:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4472,11 +3946,11 @@ yyreduce:
 		else cfg_parser->cfg->log_servfail = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4476 "util/configparser.c"
+#line 3950 "util/configparser.c"
     break;
 
-  case 364:
-#line 1166 "./util/configparser.y"
+  case 393: /* server_log_local_actions: VAR_LOG_LOCAL_ACTIONS STRING_ARG  */
+#line 1229 "./util/configparser.y"
   {
   	OUTYY(("P(server_log_local_actions:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4484,31 +3958,31 @@ yyreduce:
   	else cfg_parser->cfg->log_local_actions = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 4488 "util/configparser.c"
+#line 3962 "util/configparser.c"
     break;
 
-  case 365:
-#line 1175 "./util/configparser.y"
+  case 394: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 1238 "./util/configparser.y"
         {
 		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
 		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
-#line 4498 "util/configparser.c"
+#line 3972 "util/configparser.c"
     break;
 
-  case 366:
-#line 1182 "./util/configparser.y"
+  case 395: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 1245 "./util/configparser.y"
         {
 		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
 		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
-#line 4508 "util/configparser.c"
+#line 3982 "util/configparser.c"
     break;
 
-  case 367:
-#line 1189 "./util/configparser.y"
+  case 396: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 1252 "./util/configparser.y"
         {
 		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
@@ -4533,105 +4007,105 @@ yyreduce:
 			}
 		}
 	}
-#line 4537 "util/configparser.c"
+#line 4011 "util/configparser.c"
     break;
 
-  case 368:
-#line 1215 "./util/configparser.y"
+  case 397: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 1278 "./util/configparser.y"
         {
 		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
 		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
-#line 4548 "util/configparser.c"
+#line 4022 "util/configparser.c"
     break;
 
-  case 369:
-#line 1223 "./util/configparser.y"
+  case 398: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 1286 "./util/configparser.y"
         {
 		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
 		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
-#line 4558 "util/configparser.c"
+#line 4032 "util/configparser.c"
     break;
 
-  case 370:
-#line 1230 "./util/configparser.y"
+  case 399: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 1293 "./util/configparser.y"
         {
 		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4568 "util/configparser.c"
+#line 4042 "util/configparser.c"
     break;
 
-  case 371:
-#line 1237 "./util/configparser.y"
+  case 400: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 1300 "./util/configparser.y"
         {
 		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		log_warn("option dlv-anchor-file ignored: DLV is decommissioned");
 		free((yyvsp[0].str));
 	}
-#line 4578 "util/configparser.c"
+#line 4052 "util/configparser.c"
     break;
 
-  case 372:
-#line 1244 "./util/configparser.y"
+  case 401: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 1307 "./util/configparser.y"
         {
 		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
 		log_warn("option dlv-anchor ignored: DLV is decommissioned");
 		free((yyvsp[0].str));
 	}
-#line 4588 "util/configparser.c"
+#line 4062 "util/configparser.c"
     break;
 
-  case 373:
-#line 1251 "./util/configparser.y"
+  case 402: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 1314 "./util/configparser.y"
         {
 		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4599 "util/configparser.c"
+#line 4073 "util/configparser.c"
     break;
 
-  case 374:
-#line 1259 "./util/configparser.y"
+  case 403: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 1322 "./util/configparser.y"
         {
 		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4610 "util/configparser.c"
+#line 4084 "util/configparser.c"
     break;
 
-  case 375:
-#line 1267 "./util/configparser.y"
+  case 404: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 1330 "./util/configparser.y"
         {
 		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4621 "util/configparser.c"
+#line 4095 "util/configparser.c"
     break;
 
-  case 376:
-#line 1275 "./util/configparser.y"
+  case 405: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 1338 "./util/configparser.y"
         {
 		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4631 "util/configparser.c"
+#line 4105 "util/configparser.c"
     break;
 
-  case 377:
-#line 1282 "./util/configparser.y"
+  case 406: /* server_trust_anchor_signaling: VAR_TRUST_ANCHOR_SIGNALING STRING_ARG  */
+#line 1345 "./util/configparser.y"
         {
 		OUTYY(("P(server_trust_anchor_signaling:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4641,11 +4115,11 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4645 "util/configparser.c"
+#line 4119 "util/configparser.c"
     break;
 
-  case 378:
-#line 1293 "./util/configparser.y"
+  case 407: /* server_root_key_sentinel: VAR_ROOT_KEY_SENTINEL STRING_ARG  */
+#line 1356 "./util/configparser.y"
         {
 		OUTYY(("P(server_root_key_sentinel:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4655,21 +4129,21 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4659 "util/configparser.c"
+#line 4133 "util/configparser.c"
     break;
 
-  case 379:
-#line 1304 "./util/configparser.y"
+  case 408: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 1367 "./util/configparser.y"
         {
 		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4669 "util/configparser.c"
+#line 4143 "util/configparser.c"
     break;
 
-  case 380:
-#line 1311 "./util/configparser.y"
+  case 409: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 1374 "./util/configparser.y"
         {
 		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4677,11 +4151,11 @@ yyreduce:
 		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4681 "util/configparser.c"
+#line 4155 "util/configparser.c"
     break;
 
-  case 381:
-#line 1320 "./util/configparser.y"
+  case 410: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 1383 "./util/configparser.y"
         {
 		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4689,11 +4163,11 @@ yyreduce:
 		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4693 "util/configparser.c"
+#line 4167 "util/configparser.c"
     break;
 
-  case 382:
-#line 1329 "./util/configparser.y"
+  case 411: /* server_hide_trustanchor: VAR_HIDE_TRUSTANCHOR STRING_ARG  */
+#line 1392 "./util/configparser.y"
         {
 		OUTYY(("P(server_hide_trustanchor:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4701,31 +4175,31 @@ yyreduce:
 		else cfg_parser->cfg->hide_trustanchor = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4705 "util/configparser.c"
+#line 4179 "util/configparser.c"
     break;
 
-  case 383:
-#line 1338 "./util/configparser.y"
+  case 412: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 1401 "./util/configparser.y"
         {
 		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
 		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
-#line 4715 "util/configparser.c"
+#line 4189 "util/configparser.c"
     break;
 
-  case 384:
-#line 1345 "./util/configparser.y"
+  case 413: /* server_version: VAR_VERSION STRING_ARG  */
+#line 1408 "./util/configparser.y"
         {
 		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
 		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
-#line 4725 "util/configparser.c"
+#line 4199 "util/configparser.c"
     break;
 
-  case 385:
-#line 1352 "./util/configparser.y"
+  case 414: /* server_nsid: VAR_NSID STRING_ARG  */
+#line 1415 "./util/configparser.y"
         {
 		OUTYY(("P(server_nsid:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->nsid_cfg_str);
@@ -4740,33 +4214,33 @@ yyreduce:
 			yyerror("the NSID must be either a hex string or an "
 			    "ascii character string prepended with ascii_.");
 	}
-#line 4744 "util/configparser.c"
+#line 4218 "util/configparser.c"
     break;
 
-  case 386:
-#line 1368 "./util/configparser.y"
+  case 415: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 1431 "./util/configparser.y"
         {
 		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 4755 "util/configparser.c"
+#line 4229 "util/configparser.c"
     break;
 
-  case 387:
-#line 1376 "./util/configparser.y"
+  case 416: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 1439 "./util/configparser.y"
         {
 		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 4766 "util/configparser.c"
+#line 4240 "util/configparser.c"
     break;
 
-  case 388:
-#line 1384 "./util/configparser.y"
+  case 417: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 1447 "./util/configparser.y"
     {
         OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4775,11 +4249,36 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 4779 "util/configparser.c"
+#line 4253 "util/configparser.c"
     break;
 
-  case 389:
-#line 1394 "./util/configparser.y"
+  case 418: /* server_worker_cpu_affinity: VAR_WORKER_CPU_AFFINITY STRING_ARG  */
+#line 1457 "./util/configparser.y"
+        {
+		OUTYY(("P(server_worker_cpu_affinity:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->worker_cpu_affinity =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4266 "util/configparser.c"
+    break;
+
+  case 419: /* server_numa_aware: VAR_NUMA_AWARE STRING_ARG  */
+#line 1467 "./util/configparser.y"
+        {
+		OUTYY(("P(server_numa_aware:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->numa_aware = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4278 "util/configparser.c"
+    break;
+
+  case 420: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 1476 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4788,11 +4287,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 4792 "util/configparser.c"
+#line 4291 "util/configparser.c"
     break;
 
-  case 390:
-#line 1404 "./util/configparser.y"
+  case 421: /* server_ip_freebind: VAR_IP_FREEBIND STRING_ARG  */
+#line 1486 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_freebind:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4801,11 +4300,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 4805 "util/configparser.c"
+#line 4304 "util/configparser.c"
     break;
 
-  case 391:
-#line 1414 "./util/configparser.y"
+  case 422: /* server_ip_dscp: VAR_IP_DSCP STRING_ARG  */
+#line 1496 "./util/configparser.y"
         {
 		OUTYY(("P(server_ip_dscp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4818,22 +4317,22 @@ yyreduce:
 			cfg_parser->cfg->ip_dscp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4822 "util/configparser.c"
+#line 4321 "util/configparser.c"
     break;
 
-  case 392:
-#line 1428 "./util/configparser.y"
+  case 423: /* server_stream_wait_size: VAR_STREAM_WAIT_SIZE STRING_ARG  */
+#line 1510 "./util/configparser.y"
         {
 		OUTYY(("P(server_stream_wait_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->stream_wait_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4833 "util/configparser.c"
+#line 4332 "util/configparser.c"
     break;
 
-  case 393:
-#line 1436 "./util/configparser.y"
+  case 424: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 1518 "./util/configparser.y"
         {
 		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4845,11 +4344,11 @@ yyreduce:
 		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4849 "util/configparser.c"
+#line 4348 "util/configparser.c"
     break;
 
-  case 394:
-#line 1449 "./util/configparser.y"
+  case 425: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 1531 "./util/configparser.y"
         {
 		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4859,22 +4358,22 @@ yyreduce:
 		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4863 "util/configparser.c"
+#line 4362 "util/configparser.c"
     break;
 
-  case 395:
-#line 1460 "./util/configparser.y"
+  case 426: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 1542 "./util/configparser.y"
         {
 		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4874 "util/configparser.c"
+#line 4373 "util/configparser.c"
     break;
 
-  case 396:
-#line 1468 "./util/configparser.y"
+  case 427: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 1550 "./util/configparser.y"
         {
 		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4886,11 +4385,39 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4890 "util/configparser.c"
+#line 4389 "util/configparser.c"
     break;
 
-  case 397:
-#line 1481 "./util/configparser.y"
+  case 428: /* server_msg_cache_policy: VAR_MSG_CACHE_POLICY STRING_ARG  */
+#line 1563 "./util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_policy:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "lru") != 0 && strcmp((yyvsp[0].str), "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->msg_cache_policy);
+			cfg_parser->cfg->msg_cache_policy = (yyvsp[0].str);
+		}
+	}
+#line 4404 "util/configparser.c"
+    break;
+
+  case 429: /* server_msg_cache_wire_image: VAR_MSG_CACHE_WIRE_IMAGE STRING_ARG  */
+#line 1575 "./util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_wire_image:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->msg_cache_wire_image =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4417 "util/configparser.c"
+    break;
+
+  case 430: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 1585 "./util/configparser.y"
         {
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4898,11 +4425,11 @@ yyreduce:
 		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4902 "util/configparser.c"
+#line 4429 "util/configparser.c"
     break;
 
-  case 398:
-#line 1490 "./util/configparser.y"
+  case 431: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 1594 "./util/configparser.y"
         {
 		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4910,11 +4437,11 @@ yyreduce:
 		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4914 "util/configparser.c"
+#line 4441 "util/configparser.c"
     break;
 
-  case 399:
-#line 1499 "./util/configparser.y"
+  case 432: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 1603 "./util/configparser.y"
         {
 		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4922,11 +4449,11 @@ yyreduce:
 		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4926 "util/configparser.c"
+#line 4453 "util/configparser.c"
     break;
 
-  case 400:
-#line 1508 "./util/configparser.y"
+  case 433: /* server_udp_connect: VAR_UDP_CONNECT STRING_ARG  */
+#line 1612 "./util/configparser.y"
         {
 		OUTYY(("P(server_udp_connect:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4934,11 +4461,76 @@ yyreduce:
 		else cfg_parser->cfg->udp_connect = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4938 "util/configparser.c"
+#line 4465 "util/configparser.c"
+    break;
+
+  case 434: /* server_udp_batch_size: VAR_UDP_BATCH_SIZE STRING_ARG  */
+#line 1621 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_batch_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->udp_batch_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4479 "util/configparser.c"
+    break;
+
+  case 435: /* server_udp_upstream_batch: VAR_UDP_UPSTREAM_BATCH STRING_ARG  */
+#line 1632 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_upstream_batch:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->udp_upstream_batch =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4492 "util/configparser.c"
     break;
 
-  case 401:
-#line 1517 "./util/configparser.y"
+  case 436: /* server_use_io_uring: VAR_USE_IO_URING STRING_ARG  */
+#line 1642 "./util/configparser.y"
+        {
+		OUTYY(("P(server_use_io_uring:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->use_io_uring = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4504 "util/configparser.c"
+    break;
+
+  case 437: /* server_udp_connect_pool: VAR_UDP_CONNECT_POOL STRING_ARG  */
+#line 1651 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_connect_pool:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->udp_connect_pool = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4518 "util/configparser.c"
+    break;
+
+  case 438: /* server_udp_connect_reuse: VAR_UDP_CONNECT_REUSE STRING_ARG  */
+#line 1662 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_connect_reuse:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->udp_connect_reuse = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4530 "util/configparser.c"
+    break;
+
+  case 439: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 1671 "./util/configparser.y"
         {
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4947,11 +4539,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4951 "util/configparser.c"
+#line 4543 "util/configparser.c"
     break;
 
-  case 402:
-#line 1527 "./util/configparser.y"
+  case 440: /* server_insecure_lan_zones: VAR_INSECURE_LAN_ZONES STRING_ARG  */
+#line 1681 "./util/configparser.y"
         {
 		OUTYY(("P(server_insecure_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4960,22 +4552,22 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4964 "util/configparser.c"
+#line 4556 "util/configparser.c"
     break;
 
-  case 403:
-#line 1537 "./util/configparser.y"
+  case 441: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 1691 "./util/configparser.y"
         {
 		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4975 "util/configparser.c"
+#line 4567 "util/configparser.c"
     break;
 
-  case 404:
-#line 1545 "./util/configparser.y"
+  case 442: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 1699 "./util/configparser.y"
         {
 		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4987,11 +4579,26 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4991 "util/configparser.c"
+#line 4583 "util/configparser.c"
+    break;
+
+  case 443: /* server_rrset_cache_policy: VAR_RRSET_CACHE_POLICY STRING_ARG  */
+#line 1712 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrset_cache_policy:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "lru") != 0 && strcmp((yyvsp[0].str), "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->rrset_cache_policy);
+			cfg_parser->cfg->rrset_cache_policy = (yyvsp[0].str);
+		}
+	}
+#line 4598 "util/configparser.c"
     break;
 
-  case 405:
-#line 1558 "./util/configparser.y"
+  case 444: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 1724 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4999,22 +4606,22 @@ yyreduce:
 		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5003 "util/configparser.c"
+#line 4610 "util/configparser.c"
     break;
 
-  case 406:
-#line 1567 "./util/configparser.y"
+  case 445: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 1733 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
 			"removed, use infra-host-ttl)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5014 "util/configparser.c"
+#line 4621 "util/configparser.c"
     break;
 
-  case 407:
-#line 1575 "./util/configparser.y"
+  case 446: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 1741 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5022,22 +4629,37 @@ yyreduce:
 		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5026 "util/configparser.c"
+#line 4633 "util/configparser.c"
     break;
 
-  case 408:
-#line 1584 "./util/configparser.y"
+  case 447: /* server_infra_cache_policy: VAR_INFRA_CACHE_POLICY STRING_ARG  */
+#line 1750 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_policy:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "lru") != 0 && strcmp((yyvsp[0].str), "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->infra_cache_policy);
+			cfg_parser->cfg->infra_cache_policy = (yyvsp[0].str);
+		}
+	}
+#line 4648 "util/configparser.c"
+    break;
+
+  case 448: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 1762 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
 			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5037 "util/configparser.c"
+#line 4659 "util/configparser.c"
     break;
 
-  case 409:
-#line 1592 "./util/configparser.y"
+  case 449: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 1770 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5049,11 +4671,21 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5053 "util/configparser.c"
+#line 4675 "util/configparser.c"
+    break;
+
+  case 450: /* server_cache_snapshot_file: VAR_CACHE_SNAPSHOT_FILE STRING_ARG  */
+#line 1783 "./util/configparser.y"
+        {
+		OUTYY(("P(server_cache_snapshot_file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->cache_snapshot_file);
+		cfg_parser->cfg->cache_snapshot_file = (yyvsp[0].str);
+	}
+#line 4685 "util/configparser.c"
     break;
 
-  case 410:
-#line 1605 "./util/configparser.y"
+  case 451: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 1790 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5061,11 +4693,11 @@ yyreduce:
 		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5065 "util/configparser.c"
+#line 4697 "util/configparser.c"
     break;
 
-  case 411:
-#line 1614 "./util/configparser.y"
+  case 452: /* server_infra_keep_probing: VAR_INFRA_KEEP_PROBING STRING_ARG  */
+#line 1799 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_keep_probing:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5074,21 +4706,73 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5078 "util/configparser.c"
+#line 4710 "util/configparser.c"
     break;
 
-  case 412:
-#line 1624 "./util/configparser.y"
+  case 453: /* server_udp_hedge: VAR_UDP_HEDGE STRING_ARG  */
+#line 1809 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_hedge:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->udp_hedge = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4722 "util/configparser.c"
+    break;
+
+  case 454: /* server_udp_hedge_percentile: VAR_UDP_HEDGE_PERCENTILE STRING_ARG  */
+#line 1818 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_hedge_percentile:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) < 50 || atoi((yyvsp[0].str)) > 99)
+			yyerror("expected a percentile from 50 to 99");
+		else cfg_parser->cfg->udp_hedge_percentile = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4734 "util/configparser.c"
+    break;
+
+  case 455: /* server_udp_hedge_max_rate: VAR_UDP_HEDGE_MAX_RATE STRING_ARG  */
+#line 1827 "./util/configparser.y"
+        {
+		OUTYY(("P(server_udp_hedge_max_rate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 100)
+			yyerror("expected a percentage from 0 to 100");
+		else cfg_parser->cfg->udp_hedge_max_rate = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4748 "util/configparser.c"
+    break;
+
+  case 456: /* server_infra_select_percentile: VAR_INFRA_SELECT_PERCENTILE STRING_ARG  */
+#line 1838 "./util/configparser.y"
+        {
+		OUTYY(("P(server_infra_select_percentile:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) != 0 && (atoi((yyvsp[0].str)) < 50 || atoi((yyvsp[0].str)) > 99))
+			yyerror("expected 0 or a percentile from 50 to 99");
+		else cfg_parser->cfg->infra_select_percentile = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4762 "util/configparser.c"
+    break;
+
+  case 457: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1849 "./util/configparser.y"
         {
 		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
 		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
-#line 5088 "util/configparser.c"
+#line 4772 "util/configparser.c"
     break;
 
-  case 413:
-#line 1631 "./util/configparser.y"
+  case 458: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1856 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5097,11 +4781,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5101 "util/configparser.c"
+#line 4785 "util/configparser.c"
     break;
 
-  case 414:
-#line 1641 "./util/configparser.y"
+  case 459: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1866 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5110,11 +4794,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5114 "util/configparser.c"
+#line 4798 "util/configparser.c"
     break;
 
-  case 415:
-#line 1651 "./util/configparser.y"
+  case 460: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1876 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5123,11 +4807,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5127 "util/configparser.c"
+#line 4811 "util/configparser.c"
     break;
 
-  case 416:
-#line 1661 "./util/configparser.y"
+  case 461: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1886 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5136,11 +4820,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5140 "util/configparser.c"
+#line 4824 "util/configparser.c"
     break;
 
-  case 417:
-#line 1671 "./util/configparser.y"
+  case 462: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1896 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5149,11 +4833,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5153 "util/configparser.c"
+#line 4837 "util/configparser.c"
     break;
 
-  case 418:
-#line 1681 "./util/configparser.y"
+  case 463: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1906 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5162,11 +4846,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5166 "util/configparser.c"
+#line 4850 "util/configparser.c"
     break;
 
-  case 419:
-#line 1691 "./util/configparser.y"
+  case 464: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1916 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5175,11 +4859,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5179 "util/configparser.c"
+#line 4863 "util/configparser.c"
     break;
 
-  case 420:
-#line 1701 "./util/configparser.y"
+  case 465: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1926 "./util/configparser.y"
         {
 		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5188,41 +4872,41 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5192 "util/configparser.c"
+#line 4876 "util/configparser.c"
     break;
 
-  case 421:
-#line 1711 "./util/configparser.y"
+  case 466: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1936 "./util/configparser.y"
         {
 		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5202 "util/configparser.c"
+#line 4886 "util/configparser.c"
     break;
 
-  case 422:
-#line 1718 "./util/configparser.y"
+  case 467: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1943 "./util/configparser.y"
         {
 		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5212 "util/configparser.c"
+#line 4896 "util/configparser.c"
     break;
 
-  case 423:
-#line 1725 "./util/configparser.y"
+  case 468: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1950 "./util/configparser.y"
         {
 		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5222 "util/configparser.c"
+#line 4906 "util/configparser.c"
     break;
 
-  case 424:
-#line 1732 "./util/configparser.y"
+  case 469: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1957 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5230,11 +4914,23 @@ yyreduce:
 		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5234 "util/configparser.c"
+#line 4918 "util/configparser.c"
     break;
 
-  case 425:
-#line 1741 "./util/configparser.y"
+  case 470: /* server_shared_inflight: VAR_SHARED_INFLIGHT STRING_ARG  */
+#line 1966 "./util/configparser.y"
+        {
+		OUTYY(("P(server_shared_inflight:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->shared_inflight = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4930 "util/configparser.c"
+    break;
+
+  case 471: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1975 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5242,11 +4938,11 @@ yyreduce:
 		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5246 "util/configparser.c"
+#line 4942 "util/configparser.c"
     break;
 
-  case 426:
-#line 1750 "./util/configparser.y"
+  case 472: /* server_deny_any: VAR_DENY_ANY STRING_ARG  */
+#line 1984 "./util/configparser.y"
         {
 		OUTYY(("P(server_deny_any:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5254,11 +4950,11 @@ yyreduce:
 		else cfg_parser->cfg->deny_any = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5258 "util/configparser.c"
+#line 4954 "util/configparser.c"
     break;
 
-  case 427:
-#line 1759 "./util/configparser.y"
+  case 473: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1993 "./util/configparser.y"
         {
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5266,21 +4962,21 @@ yyreduce:
 		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5270 "util/configparser.c"
+#line 4966 "util/configparser.c"
     break;
 
-  case 428:
-#line 1768 "./util/configparser.y"
+  case 474: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 2002 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5280 "util/configparser.c"
+#line 4976 "util/configparser.c"
     break;
 
-  case 429:
-#line 1775 "./util/configparser.y"
+  case 475: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 2009 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5289,11 +4985,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5293 "util/configparser.c"
+#line 4989 "util/configparser.c"
     break;
 
-  case 430:
-#line 1785 "./util/configparser.y"
+  case 476: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 2019 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
@@ -5312,21 +5008,21 @@ yyreduce:
 				fatal_exit("out of memory adding acl");
 		}
 	}
-#line 5316 "util/configparser.c"
+#line 5012 "util/configparser.c"
     break;
 
-  case 431:
-#line 1805 "./util/configparser.y"
+  case 477: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 2039 "./util/configparser.y"
         {
 		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
 		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
-#line 5326 "util/configparser.c"
+#line 5022 "util/configparser.c"
     break;
 
-  case 432:
-#line 1812 "./util/configparser.y"
+  case 478: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 2046 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
@@ -5343,11 +5039,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5347 "util/configparser.c"
+#line 5043 "util/configparser.c"
     break;
 
-  case 433:
-#line 1830 "./util/configparser.y"
+  case 479: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 2064 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
@@ -5359,11 +5055,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5363 "util/configparser.c"
+#line 5059 "util/configparser.c"
     break;
 
-  case 434:
-#line 1843 "./util/configparser.y"
+  case 480: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 2077 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
@@ -5375,11 +5071,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5379 "util/configparser.c"
+#line 5075 "util/configparser.c"
     break;
 
-  case 435:
-#line 1856 "./util/configparser.y"
+  case 481: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 2090 "./util/configparser.y"
         {
 		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5387,11 +5083,11 @@ yyreduce:
 		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5391 "util/configparser.c"
+#line 5087 "util/configparser.c"
     break;
 
-  case 436:
-#line 1865 "./util/configparser.y"
+  case 482: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 2099 "./util/configparser.y"
         {
 		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5399,11 +5095,11 @@ yyreduce:
 		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5403 "util/configparser.c"
+#line 5099 "util/configparser.c"
     break;
 
-  case 437:
-#line 1874 "./util/configparser.y"
+  case 483: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 2108 "./util/configparser.y"
         {
 		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5411,11 +5107,11 @@ yyreduce:
 		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5415 "util/configparser.c"
+#line 5111 "util/configparser.c"
     break;
 
-  case 438:
-#line 1883 "./util/configparser.y"
+  case 484: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 2117 "./util/configparser.y"
         {
 		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5423,11 +5119,11 @@ yyreduce:
 		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5427 "util/configparser.c"
+#line 5123 "util/configparser.c"
     break;
 
-  case 439:
-#line 1892 "./util/configparser.y"
+  case 485: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 2126 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5436,11 +5132,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5440 "util/configparser.c"
+#line 5136 "util/configparser.c"
     break;
 
-  case 440:
-#line 1902 "./util/configparser.y"
+  case 486: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 2136 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5449,11 +5145,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5453 "util/configparser.c"
+#line 5149 "util/configparser.c"
     break;
 
-  case 441:
-#line 1912 "./util/configparser.y"
+  case 487: /* server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG  */
+#line 2146 "./util/configparser.y"
         {
 		OUTYY(("P(server_aggressive_nsec:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5463,11 +5159,11 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5467 "util/configparser.c"
+#line 5163 "util/configparser.c"
     break;
 
-  case 442:
-#line 1923 "./util/configparser.y"
+  case 488: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 2157 "./util/configparser.y"
         {
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5475,11 +5171,11 @@ yyreduce:
 		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5479 "util/configparser.c"
+#line 5175 "util/configparser.c"
     break;
 
-  case 443:
-#line 1932 "./util/configparser.y"
+  case 489: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 2166 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5487,11 +5183,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5491 "util/configparser.c"
+#line 5187 "util/configparser.c"
     break;
 
-  case 444:
-#line 1941 "./util/configparser.y"
+  case 490: /* server_serve_expired_ttl: VAR_SERVE_EXPIRED_TTL STRING_ARG  */
+#line 2175 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5499,11 +5195,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5503 "util/configparser.c"
+#line 5199 "util/configparser.c"
     break;
 
-  case 445:
-#line 1950 "./util/configparser.y"
+  case 491: /* server_serve_expired_ttl_reset: VAR_SERVE_EXPIRED_TTL_RESET STRING_ARG  */
+#line 2184 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_ttl_reset:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5511,11 +5207,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_ttl_reset = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5515 "util/configparser.c"
+#line 5211 "util/configparser.c"
     break;
 
-  case 446:
-#line 1959 "./util/configparser.y"
+  case 492: /* server_serve_expired_reply_ttl: VAR_SERVE_EXPIRED_REPLY_TTL STRING_ARG  */
+#line 2193 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_reply_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5523,11 +5219,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_reply_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5527 "util/configparser.c"
+#line 5223 "util/configparser.c"
     break;
 
-  case 447:
-#line 1968 "./util/configparser.y"
+  case 493: /* server_serve_expired_client_timeout: VAR_SERVE_EXPIRED_CLIENT_TIMEOUT STRING_ARG  */
+#line 2202 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_client_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5535,11 +5231,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_client_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5539 "util/configparser.c"
+#line 5235 "util/configparser.c"
     break;
 
-  case 448:
-#line 1977 "./util/configparser.y"
+  case 494: /* server_serve_original_ttl: VAR_SERVE_ORIGINAL_TTL STRING_ARG  */
+#line 2211 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_original_ttl:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5547,11 +5243,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_original_ttl = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5551 "util/configparser.c"
+#line 5247 "util/configparser.c"
     break;
 
-  case 449:
-#line 1986 "./util/configparser.y"
+  case 495: /* server_fake_dsa: VAR_FAKE_DSA STRING_ARG  */
+#line 2220 "./util/configparser.y"
         {
 		OUTYY(("P(server_fake_dsa:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5563,11 +5259,11 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 5567 "util/configparser.c"
+#line 5263 "util/configparser.c"
     break;
 
-  case 450:
-#line 1999 "./util/configparser.y"
+  case 496: /* server_fake_sha1: VAR_FAKE_SHA1 STRING_ARG  */
+#line 2233 "./util/configparser.y"
         {
 		OUTYY(("P(server_fake_sha1:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5579,11 +5275,11 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 5583 "util/configparser.c"
+#line 5279 "util/configparser.c"
     break;
 
-  case 451:
-#line 2012 "./util/configparser.y"
+  case 497: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 2246 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5591,21 +5287,35 @@ yyreduce:
 		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5595 "util/configparser.c"
+#line 5291 "util/configparser.c"
+    break;
+
+  case 498: /* server_val_verify_threads: VAR_VAL_VERIFY_THREADS STRING_ARG  */
+#line 2255 "./util/configparser.y"
+        {
+		OUTYY(("P(server_val_verify_threads:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->val_verify_threads = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 5305 "util/configparser.c"
     break;
 
-  case 452:
-#line 2021 "./util/configparser.y"
+  case 499: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 2266 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
 		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
-#line 5605 "util/configparser.c"
+#line 5315 "util/configparser.c"
     break;
 
-  case 453:
-#line 2028 "./util/configparser.y"
+  case 500: /* server_zonemd_permissive_mode: VAR_ZONEMD_PERMISSIVE_MODE STRING_ARG  */
+#line 2273 "./util/configparser.y"
         {
 		OUTYY(("P(server_zonemd_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5613,11 +5323,11 @@ yyreduce:
 		else	cfg_parser->cfg->zonemd_permissive_mode = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5617 "util/configparser.c"
+#line 5327 "util/configparser.c"
     break;
 
-  case 454:
-#line 2037 "./util/configparser.y"
+  case 501: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 2282 "./util/configparser.y"
         {
 		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5625,11 +5335,11 @@ yyreduce:
 		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5629 "util/configparser.c"
+#line 5339 "util/configparser.c"
     break;
 
-  case 455:
-#line 2046 "./util/configparser.y"
+  case 502: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 2291 "./util/configparser.y"
         {
 		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5637,11 +5347,11 @@ yyreduce:
 		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5641 "util/configparser.c"
+#line 5351 "util/configparser.c"
     break;
 
-  case 456:
-#line 2055 "./util/configparser.y"
+  case 503: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 2300 "./util/configparser.y"
         {
 		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5649,11 +5359,11 @@ yyreduce:
 		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5653 "util/configparser.c"
+#line 5363 "util/configparser.c"
     break;
 
-  case 457:
-#line 2064 "./util/configparser.y"
+  case 504: /* server_permit_small_holddown: VAR_PERMIT_SMALL_HOLDDOWN STRING_ARG  */
+#line 2309 "./util/configparser.y"
         {
 		OUTYY(("P(server_permit_small_holddown:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5662,22 +5372,22 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5666 "util/configparser.c"
+#line 5376 "util/configparser.c"
     break;
 
-  case 458:
-#line 2073 "./util/configparser.y"
+  case 505: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 2318 "./util/configparser.y"
         {
 		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 5677 "util/configparser.c"
+#line 5387 "util/configparser.c"
     break;
 
-  case 459:
-#line 2081 "./util/configparser.y"
+  case 506: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 2326 "./util/configparser.y"
         {
 		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5689,22 +5399,37 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5693 "util/configparser.c"
+#line 5403 "util/configparser.c"
+    break;
+
+  case 507: /* server_key_cache_policy: VAR_KEY_CACHE_POLICY STRING_ARG  */
+#line 2339 "./util/configparser.y"
+        {
+		OUTYY(("P(server_key_cache_policy:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "lru") != 0 && strcmp((yyvsp[0].str), "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free((yyvsp[0].str));
+		} else {
+			free(cfg_parser->cfg->key_cache_policy);
+			cfg_parser->cfg->key_cache_policy = (yyvsp[0].str);
+		}
+	}
+#line 5418 "util/configparser.c"
     break;
 
-  case 460:
-#line 2094 "./util/configparser.y"
+  case 508: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 2351 "./util/configparser.y"
         {
 		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 5704 "util/configparser.c"
+#line 5429 "util/configparser.c"
     break;
 
-  case 461:
-#line 2102 "./util/configparser.y"
+  case 509: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2359 "./util/configparser.y"
         {
 		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
@@ -5748,21 +5473,21 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 5752 "util/configparser.c"
+#line 5477 "util/configparser.c"
     break;
 
-  case 462:
-#line 2147 "./util/configparser.y"
+  case 510: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2404 "./util/configparser.y"
         {
 		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
-#line 5762 "util/configparser.c"
+#line 5487 "util/configparser.c"
     break;
 
-  case 463:
-#line 2154 "./util/configparser.y"
+  case 511: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2411 "./util/configparser.y"
         {
 		char* ptr;
 		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
@@ -5776,11 +5501,11 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 5780 "util/configparser.c"
+#line 5505 "util/configparser.c"
     break;
 
-  case 464:
-#line 2169 "./util/configparser.y"
+  case 512: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 2426 "./util/configparser.y"
         {
 		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5789,11 +5514,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5793 "util/configparser.c"
+#line 5518 "util/configparser.c"
     break;
 
-  case 465:
-#line 2179 "./util/configparser.y"
+  case 513: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 2436 "./util/configparser.y"
         {
 		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5802,41 +5527,41 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5806 "util/configparser.c"
+#line 5531 "util/configparser.c"
     break;
 
-  case 466:
-#line 2189 "./util/configparser.y"
+  case 514: /* server_unknown_server_time_limit: VAR_UNKNOWN_SERVER_TIME_LIMIT STRING_ARG  */
+#line 2446 "./util/configparser.y"
         {
 		OUTYY(("P(server_unknown_server_time_limit:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->unknown_server_time_limit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5816 "util/configparser.c"
+#line 5541 "util/configparser.c"
     break;
 
-  case 467:
-#line 2196 "./util/configparser.y"
+  case 515: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 2453 "./util/configparser.y"
         {
 		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5826 "util/configparser.c"
+#line 5551 "util/configparser.c"
     break;
 
-  case 468:
-#line 2203 "./util/configparser.y"
+  case 516: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 2460 "./util/configparser.y"
         {
 		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
 		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
-#line 5836 "util/configparser.c"
+#line 5561 "util/configparser.c"
     break;
 
-  case 469:
-#line 2210 "./util/configparser.y"
+  case 517: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 2467 "./util/configparser.y"
         {
 		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5844,22 +5569,22 @@ yyreduce:
 		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5848 "util/configparser.c"
+#line 5573 "util/configparser.c"
     break;
 
-  case 470:
-#line 2219 "./util/configparser.y"
+  case 518: /* server_dns64_ignore_aaaa: VAR_DNS64_IGNORE_AAAA STRING_ARG  */
+#line 2476 "./util/configparser.y"
         {
 		OUTYY(("P(dns64_ignore_aaaa:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dns64_ignore_aaaa,
 			(yyvsp[0].str)))
 			fatal_exit("out of memory adding dns64-ignore-aaaa");
 	}
-#line 5859 "util/configparser.c"
+#line 5584 "util/configparser.c"
     break;
 
-  case 471:
-#line 2227 "./util/configparser.y"
+  case 519: /* server_define_tag: VAR_DEFINE_TAG STRING_ARG  */
+#line 2484 "./util/configparser.y"
         {
 		char* p, *s = (yyvsp[0].str);
 		OUTYY(("P(server_define_tag:%s)\n", (yyvsp[0].str)));
@@ -5872,11 +5597,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5876 "util/configparser.c"
+#line 5601 "util/configparser.c"
     break;
 
-  case 472:
-#line 2241 "./util/configparser.y"
+  case 520: /* server_local_zone_tag: VAR_LOCAL_ZONE_TAG STRING_ARG STRING_ARG  */
+#line 2498 "./util/configparser.y"
         {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
@@ -5896,11 +5621,11 @@ yyreduce:
 			}
 		}
 	}
-#line 5900 "util/configparser.c"
+#line 5625 "util/configparser.c"
     break;
 
-  case 473:
-#line 2262 "./util/configparser.y"
+  case 521: /* server_access_control_tag: VAR_ACCESS_CONTROL_TAG STRING_ARG STRING_ARG  */
+#line 2519 "./util/configparser.y"
         {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
@@ -5920,11 +5645,11 @@ yyreduce:
 			}
 		}
 	}
-#line 5924 "util/configparser.c"
+#line 5649 "util/configparser.c"
     break;
 
-  case 474:
-#line 2283 "./util/configparser.y"
+  case 522: /* server_access_control_tag_action: VAR_ACCESS_CONTROL_TAG_ACTION STRING_ARG STRING_ARG STRING_ARG  */
+#line 2540 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control_tag_action:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_actions,
@@ -5935,11 +5660,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 5939 "util/configparser.c"
+#line 5664 "util/configparser.c"
     break;
 
-  case 475:
-#line 2295 "./util/configparser.y"
+  case 523: /* server_access_control_tag_data: VAR_ACCESS_CONTROL_TAG_DATA STRING_ARG STRING_ARG STRING_ARG  */
+#line 2552 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control_tag_data:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_datas,
@@ -5950,11 +5675,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 5954 "util/configparser.c"
+#line 5679 "util/configparser.c"
     break;
 
-  case 476:
-#line 2307 "./util/configparser.y"
+  case 524: /* server_local_zone_override: VAR_LOCAL_ZONE_OVERRIDE STRING_ARG STRING_ARG STRING_ARG  */
+#line 2564 "./util/configparser.y"
         {
 		OUTYY(("P(server_local_zone_override:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->local_zone_overrides,
@@ -5965,11 +5690,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 5969 "util/configparser.c"
+#line 5694 "util/configparser.c"
     break;
 
-  case 477:
-#line 2319 "./util/configparser.y"
+  case 525: /* server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG  */
+#line 2576 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control_view:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_view,
@@ -5977,11 +5702,44 @@ yyreduce:
 			yyerror("out of memory");
 		}
 	}
-#line 5981 "util/configparser.c"
+#line 5706 "util/configparser.c"
     break;
 
-  case 478:
-#line 2328 "./util/configparser.y"
+  case 526: /* server_priority_class: VAR_PRIORITY_CLASS STRING_ARG STRING_ARG  */
+#line 2585 "./util/configparser.y"
+        {
+		OUTYY(("P(server_priority_class:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
+			yyerror("percent number expected");
+			free((yyvsp[-1].str));
+			free((yyvsp[0].str));
+		} else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 100) {
+			yyerror("percent must be 0 to 100");
+			free((yyvsp[-1].str));
+			free((yyvsp[0].str));
+		} else if(!cfg_str2list_insert(
+			&cfg_parser->cfg->priority_class, (yyvsp[-1].str), (yyvsp[0].str))) {
+			yyerror("out of memory");
+		}
+	}
+#line 5726 "util/configparser.c"
+    break;
+
+  case 527: /* server_access_control_priority_class: VAR_ACCESS_CONTROL_PRIORITY_CLASS STRING_ARG STRING_ARG  */
+#line 2602 "./util/configparser.y"
+        {
+		OUTYY(("P(server_access_control_priority_class:%s %s)\n",
+			(yyvsp[-1].str), (yyvsp[0].str)));
+		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_priority_class,
+			(yyvsp[-1].str), (yyvsp[0].str))) {
+			yyerror("out of memory");
+		}
+	}
+#line 5739 "util/configparser.c"
+    break;
+
+  case 528: /* server_response_ip_tag: VAR_RESPONSE_IP_TAG STRING_ARG STRING_ARG  */
+#line 2612 "./util/configparser.y"
         {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
@@ -6001,11 +5759,11 @@ yyreduce:
 			}
 		}
 	}
-#line 6005 "util/configparser.c"
+#line 5763 "util/configparser.c"
     break;
 
-  case 479:
-#line 2349 "./util/configparser.y"
+  case 529: /* server_ip_ratelimit: VAR_IP_RATELIMIT STRING_ARG  */
+#line 2633 "./util/configparser.y"
         { 
 		OUTYY(("P(server_ip_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6013,11 +5771,11 @@ yyreduce:
 		else cfg_parser->cfg->ip_ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6017 "util/configparser.c"
+#line 5775 "util/configparser.c"
     break;
 
-  case 480:
-#line 2359 "./util/configparser.y"
+  case 530: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 2643 "./util/configparser.y"
         { 
 		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6025,33 +5783,33 @@ yyreduce:
 		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6029 "util/configparser.c"
+#line 5787 "util/configparser.c"
     break;
 
-  case 481:
-#line 2368 "./util/configparser.y"
+  case 531: /* server_ip_ratelimit_size: VAR_IP_RATELIMIT_SIZE STRING_ARG  */
+#line 2652 "./util/configparser.y"
   {
   	OUTYY(("P(server_ip_ratelimit_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ip_ratelimit_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 6040 "util/configparser.c"
+#line 5798 "util/configparser.c"
     break;
 
-  case 482:
-#line 2376 "./util/configparser.y"
+  case 532: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 2660 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 6051 "util/configparser.c"
+#line 5809 "util/configparser.c"
     break;
 
-  case 483:
-#line 2384 "./util/configparser.y"
+  case 533: /* server_ip_ratelimit_slabs: VAR_IP_RATELIMIT_SLABS STRING_ARG  */
+#line 2668 "./util/configparser.y"
   {
   	OUTYY(("P(server_ip_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
@@ -6063,11 +5821,11 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 6067 "util/configparser.c"
+#line 5825 "util/configparser.c"
     break;
 
-  case 484:
-#line 2397 "./util/configparser.y"
+  case 534: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 2681 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -6079,11 +5837,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 6083 "util/configparser.c"
+#line 5841 "util/configparser.c"
     break;
 
-  case 485:
-#line 2410 "./util/configparser.y"
+  case 535: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 2694 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
@@ -6097,11 +5855,11 @@ yyreduce:
 					"ratelimit-for-domain");
 		}
 	}
-#line 6101 "util/configparser.c"
+#line 5859 "util/configparser.c"
     break;
 
-  case 486:
-#line 2425 "./util/configparser.y"
+  case 536: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 2709 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
@@ -6115,11 +5873,11 @@ yyreduce:
 					"ratelimit-below-domain");
 		}
 	}
-#line 6119 "util/configparser.c"
+#line 5877 "util/configparser.c"
     break;
 
-  case 487:
-#line 2440 "./util/configparser.y"
+  case 537: /* server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG  */
+#line 2724 "./util/configparser.y"
   { 
   	OUTYY(("P(server_ip_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
   	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6127,11 +5885,11 @@ yyreduce:
   	else cfg_parser->cfg->ip_ratelimit_factor = atoi((yyvsp[0].str));
   	free((yyvsp[0].str));
 	}
-#line 6131 "util/configparser.c"
+#line 5889 "util/configparser.c"
     break;
 
-  case 488:
-#line 2449 "./util/configparser.y"
+  case 538: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 2733 "./util/configparser.y"
         { 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6139,20 +5897,20 @@ yyreduce:
 		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6143 "util/configparser.c"
+#line 5901 "util/configparser.c"
     break;
 
-  case 489:
-#line 2458 "./util/configparser.y"
+  case 539: /* server_low_rtt: VAR_LOW_RTT STRING_ARG  */
+#line 2742 "./util/configparser.y"
         { 
 		OUTYY(("P(low-rtt option is deprecated, use fast-server-num instead)\n"));
 		free((yyvsp[0].str));
 	}
-#line 6152 "util/configparser.c"
+#line 5910 "util/configparser.c"
     break;
 
-  case 490:
-#line 2464 "./util/configparser.y"
+  case 540: /* server_fast_server_num: VAR_FAST_SERVER_NUM STRING_ARG  */
+#line 2748 "./util/configparser.y"
         { 
 		OUTYY(("P(server_fast_server_num:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) <= 0)
@@ -6160,11 +5918,11 @@ yyreduce:
 		else cfg_parser->cfg->fast_server_num = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6164 "util/configparser.c"
+#line 5922 "util/configparser.c"
     break;
 
-  case 491:
-#line 2473 "./util/configparser.y"
+  case 541: /* server_fast_server_permil: VAR_FAST_SERVER_PERMIL STRING_ARG  */
+#line 2757 "./util/configparser.y"
         { 
 		OUTYY(("P(server_fast_server_permil:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6172,11 +5930,11 @@ yyreduce:
 		else cfg_parser->cfg->fast_server_permil = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6176 "util/configparser.c"
+#line 5934 "util/configparser.c"
     break;
 
-  case 492:
-#line 2482 "./util/configparser.y"
+  case 542: /* server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG  */
+#line 2766 "./util/configparser.y"
         {
 		OUTYY(("P(server_qname_minimisation:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6185,11 +5943,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6189 "util/configparser.c"
+#line 5947 "util/configparser.c"
     break;
 
-  case 493:
-#line 2492 "./util/configparser.y"
+  case 543: /* server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG  */
+#line 2776 "./util/configparser.y"
         {
 		OUTYY(("P(server_qname_minimisation_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6198,11 +5956,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6202 "util/configparser.c"
+#line 5960 "util/configparser.c"
     break;
 
-  case 494:
-#line 2502 "./util/configparser.y"
+  case 544: /* server_pad_responses: VAR_PAD_RESPONSES STRING_ARG  */
+#line 2786 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6211,11 +5969,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6215 "util/configparser.c"
+#line 5973 "util/configparser.c"
     break;
 
-  case 495:
-#line 2512 "./util/configparser.y"
+  case 545: /* server_pad_responses_block_size: VAR_PAD_RESPONSES_BLOCK_SIZE STRING_ARG  */
+#line 2796 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_responses_block_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -6223,11 +5981,11 @@ yyreduce:
 		else cfg_parser->cfg->pad_responses_block_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6227 "util/configparser.c"
+#line 5985 "util/configparser.c"
     break;
 
-  case 496:
-#line 2521 "./util/configparser.y"
+  case 546: /* server_pad_queries: VAR_PAD_QUERIES STRING_ARG  */
+#line 2805 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6236,11 +5994,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6240 "util/configparser.c"
+#line 5998 "util/configparser.c"
     break;
 
-  case 497:
-#line 2531 "./util/configparser.y"
+  case 547: /* server_pad_queries_block_size: VAR_PAD_QUERIES_BLOCK_SIZE STRING_ARG  */
+#line 2815 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_queries_block_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -6248,11 +6006,11 @@ yyreduce:
 		else cfg_parser->cfg->pad_queries_block_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6252 "util/configparser.c"
+#line 6010 "util/configparser.c"
     break;
 
-  case 498:
-#line 2540 "./util/configparser.y"
+  case 548: /* server_ipsecmod_enabled: VAR_IPSECMOD_ENABLED STRING_ARG  */
+#line 2824 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_enabled:%s)\n", (yyvsp[0].str)));
@@ -6264,11 +6022,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 6268 "util/configparser.c"
+#line 6026 "util/configparser.c"
     break;
 
-  case 499:
-#line 2553 "./util/configparser.y"
+  case 549: /* server_ipsecmod_ignore_bogus: VAR_IPSECMOD_IGNORE_BOGUS STRING_ARG  */
+#line 2837 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_ignore_bogus:%s)\n", (yyvsp[0].str)));
@@ -6280,11 +6038,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 6284 "util/configparser.c"
+#line 6042 "util/configparser.c"
     break;
 
-  case 500:
-#line 2566 "./util/configparser.y"
+  case 550: /* server_ipsecmod_hook: VAR_IPSECMOD_HOOK STRING_ARG  */
+#line 2850 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_hook:%s)\n", (yyvsp[0].str)));
@@ -6295,11 +6053,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6299 "util/configparser.c"
+#line 6057 "util/configparser.c"
     break;
 
-  case 501:
-#line 2578 "./util/configparser.y"
+  case 551: /* server_ipsecmod_max_ttl: VAR_IPSECMOD_MAX_TTL STRING_ARG  */
+#line 2862 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_max_ttl:%s)\n", (yyvsp[0].str)));
@@ -6312,11 +6070,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6316 "util/configparser.c"
+#line 6074 "util/configparser.c"
     break;
 
-  case 502:
-#line 2592 "./util/configparser.y"
+  case 552: /* server_ipsecmod_whitelist: VAR_IPSECMOD_WHITELIST STRING_ARG  */
+#line 2876 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_whitelist:%s)\n", (yyvsp[0].str)));
@@ -6327,11 +6085,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6331 "util/configparser.c"
+#line 6089 "util/configparser.c"
     break;
 
-  case 503:
-#line 2604 "./util/configparser.y"
+  case 553: /* server_ipsecmod_strict: VAR_IPSECMOD_STRICT STRING_ARG  */
+#line 2888 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_strict:%s)\n", (yyvsp[0].str)));
@@ -6344,11 +6102,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6348 "util/configparser.c"
+#line 6106 "util/configparser.c"
     break;
 
-  case 504:
-#line 2618 "./util/configparser.y"
+  case 554: /* server_edns_client_string: VAR_EDNS_CLIENT_STRING STRING_ARG STRING_ARG  */
+#line 2902 "./util/configparser.y"
         {
 		OUTYY(("P(server_edns_client_string:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(
@@ -6356,11 +6114,11 @@ yyreduce:
 			fatal_exit("out of memory adding "
 				"edns-client-string");
 	}
-#line 6360 "util/configparser.c"
+#line 6118 "util/configparser.c"
     break;
 
-  case 505:
-#line 2627 "./util/configparser.y"
+  case 555: /* server_edns_client_string_opcode: VAR_EDNS_CLIENT_STRING_OPCODE STRING_ARG  */
+#line 2911 "./util/configparser.y"
         {
 		OUTYY(("P(edns_client_string_opcode:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6371,11 +6129,11 @@ yyreduce:
 		free((yyvsp[0].str));
 
 	}
-#line 6375 "util/configparser.c"
+#line 6133 "util/configparser.c"
     break;
 
-  case 506:
-#line 2639 "./util/configparser.y"
+  case 556: /* stub_name: VAR_NAME STRING_ARG  */
+#line 2923 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
@@ -6384,31 +6142,31 @@ yyreduce:
 		free(cfg_parser->cfg->stubs->name);
 		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
-#line 6388 "util/configparser.c"
+#line 6146 "util/configparser.c"
     break;
 
-  case 507:
-#line 2649 "./util/configparser.y"
+  case 557: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 2933 "./util/configparser.y"
         {
 		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6398 "util/configparser.c"
+#line 6156 "util/configparser.c"
     break;
 
-  case 508:
-#line 2656 "./util/configparser.y"
+  case 558: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 2940 "./util/configparser.y"
         {
 		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6408 "util/configparser.c"
+#line 6166 "util/configparser.c"
     break;
 
-  case 509:
-#line 2663 "./util/configparser.y"
+  case 559: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 2947 "./util/configparser.y"
         {
 		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6416,11 +6174,11 @@ yyreduce:
 		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6420 "util/configparser.c"
+#line 6178 "util/configparser.c"
     break;
 
-  case 510:
-#line 2672 "./util/configparser.y"
+  case 560: /* stub_no_cache: VAR_STUB_NO_CACHE STRING_ARG  */
+#line 2956 "./util/configparser.y"
         {
 		OUTYY(("P(stub-no-cache:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6428,11 +6186,11 @@ yyreduce:
 		else cfg_parser->cfg->stubs->no_cache=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6432 "util/configparser.c"
+#line 6190 "util/configparser.c"
     break;
 
-  case 511:
-#line 2681 "./util/configparser.y"
+  case 561: /* stub_ssl_upstream: VAR_STUB_SSL_UPSTREAM STRING_ARG  */
+#line 2965 "./util/configparser.y"
         {
 		OUTYY(("P(stub-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6441,11 +6199,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6445 "util/configparser.c"
+#line 6203 "util/configparser.c"
     break;
 
-  case 512:
-#line 2691 "./util/configparser.y"
+  case 562: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 2975 "./util/configparser.y"
         {
 		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6454,11 +6212,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6458 "util/configparser.c"
+#line 6216 "util/configparser.c"
     break;
 
-  case 513:
-#line 2701 "./util/configparser.y"
+  case 563: /* forward_name: VAR_NAME STRING_ARG  */
+#line 2985 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
@@ -6467,31 +6225,31 @@ yyreduce:
 		free(cfg_parser->cfg->forwards->name);
 		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
-#line 6471 "util/configparser.c"
+#line 6229 "util/configparser.c"
     break;
 
-  case 514:
-#line 2711 "./util/configparser.y"
+  case 564: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 2995 "./util/configparser.y"
         {
 		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6481 "util/configparser.c"
+#line 6239 "util/configparser.c"
     break;
 
-  case 515:
-#line 2718 "./util/configparser.y"
+  case 565: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 3002 "./util/configparser.y"
         {
 		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6491 "util/configparser.c"
+#line 6249 "util/configparser.c"
     break;
 
-  case 516:
-#line 2725 "./util/configparser.y"
+  case 566: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 3009 "./util/configparser.y"
         {
 		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6499,11 +6257,11 @@ yyreduce:
 		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6503 "util/configparser.c"
+#line 6261 "util/configparser.c"
     break;
 
-  case 517:
-#line 2734 "./util/configparser.y"
+  case 567: /* forward_no_cache: VAR_FORWARD_NO_CACHE STRING_ARG  */
+#line 3018 "./util/configparser.y"
         {
 		OUTYY(("P(forward-no-cache:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6511,11 +6269,11 @@ yyreduce:
 		else cfg_parser->cfg->forwards->no_cache=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6515 "util/configparser.c"
+#line 6273 "util/configparser.c"
     break;
 
-  case 518:
-#line 2743 "./util/configparser.y"
+  case 568: /* forward_ssl_upstream: VAR_FORWARD_SSL_UPSTREAM STRING_ARG  */
+#line 3027 "./util/configparser.y"
         {
 		OUTYY(("P(forward-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6524,11 +6282,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6528 "util/configparser.c"
+#line 6286 "util/configparser.c"
     break;
 
-  case 519:
-#line 2753 "./util/configparser.y"
+  case 569: /* auth_name: VAR_NAME STRING_ARG  */
+#line 3037 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->auths->name)
@@ -6537,52 +6295,52 @@ yyreduce:
 		free(cfg_parser->cfg->auths->name);
 		cfg_parser->cfg->auths->name = (yyvsp[0].str);
 	}
-#line 6541 "util/configparser.c"
+#line 6299 "util/configparser.c"
     break;
 
-  case 520:
-#line 2763 "./util/configparser.y"
+  case 570: /* auth_zonefile: VAR_ZONEFILE STRING_ARG  */
+#line 3047 "./util/configparser.y"
         {
 		OUTYY(("P(zonefile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->zonefile);
 		cfg_parser->cfg->auths->zonefile = (yyvsp[0].str);
 	}
-#line 6551 "util/configparser.c"
+#line 6309 "util/configparser.c"
     break;
 
-  case 521:
-#line 2770 "./util/configparser.y"
+  case 571: /* auth_master: VAR_MASTER STRING_ARG  */
+#line 3054 "./util/configparser.y"
         {
 		OUTYY(("P(master:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->masters, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6561 "util/configparser.c"
+#line 6319 "util/configparser.c"
     break;
 
-  case 522:
-#line 2777 "./util/configparser.y"
+  case 572: /* auth_url: VAR_URL STRING_ARG  */
+#line 3061 "./util/configparser.y"
         {
 		OUTYY(("P(url:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->urls, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6571 "util/configparser.c"
+#line 6329 "util/configparser.c"
     break;
 
-  case 523:
-#line 2784 "./util/configparser.y"
+  case 573: /* auth_allow_notify: VAR_ALLOW_NOTIFY STRING_ARG  */
+#line 3068 "./util/configparser.y"
         {
 		OUTYY(("P(allow-notify:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->allow_notify,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6582 "util/configparser.c"
+#line 6340 "util/configparser.c"
     break;
 
-  case 524:
-#line 2792 "./util/configparser.y"
+  case 574: /* auth_zonemd_reject_absence: VAR_ZONEMD_REJECT_ABSENCE STRING_ARG  */
+#line 3076 "./util/configparser.y"
         {
 		OUTYY(("P(zonemd-reject-absence:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6591,11 +6349,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6595 "util/configparser.c"
+#line 6353 "util/configparser.c"
     break;
 
-  case 525:
-#line 2802 "./util/configparser.y"
+  case 575: /* auth_for_downstream: VAR_FOR_DOWNSTREAM STRING_ARG  */
+#line 3086 "./util/configparser.y"
         {
 		OUTYY(("P(for-downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6604,11 +6362,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6608 "util/configparser.c"
+#line 6366 "util/configparser.c"
     break;
 
-  case 526:
-#line 2812 "./util/configparser.y"
+  case 576: /* auth_for_upstream: VAR_FOR_UPSTREAM STRING_ARG  */
+#line 3096 "./util/configparser.y"
         {
 		OUTYY(("P(for-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6617,11 +6375,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6621 "util/configparser.c"
+#line 6379 "util/configparser.c"
     break;
 
-  case 527:
-#line 2822 "./util/configparser.y"
+  case 577: /* auth_fallback_enabled: VAR_FALLBACK_ENABLED STRING_ARG  */
+#line 3106 "./util/configparser.y"
         {
 		OUTYY(("P(fallback-enabled:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6630,11 +6388,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6634 "util/configparser.c"
+#line 6392 "util/configparser.c"
     break;
 
-  case 528:
-#line 2832 "./util/configparser.y"
+  case 578: /* view_name: VAR_NAME STRING_ARG  */
+#line 3116 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->views->name)
@@ -6643,11 +6401,11 @@ yyreduce:
 		free(cfg_parser->cfg->views->name);
 		cfg_parser->cfg->views->name = (yyvsp[0].str);
 	}
-#line 6647 "util/configparser.c"
+#line 6405 "util/configparser.c"
     break;
 
-  case 529:
-#line 2842 "./util/configparser.y"
+  case 579: /* view_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 3126 "./util/configparser.y"
         {
 		OUTYY(("P(view_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
@@ -6692,11 +6450,11 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 6696 "util/configparser.c"
+#line 6454 "util/configparser.c"
     break;
 
-  case 530:
-#line 2888 "./util/configparser.y"
+  case 580: /* view_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 3172 "./util/configparser.y"
         {
 		OUTYY(("P(view_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
@@ -6705,33 +6463,33 @@ yyreduce:
 			fatal_exit("out of memory adding per-view "
 				"response-ip action");
 	}
-#line 6709 "util/configparser.c"
+#line 6467 "util/configparser.c"
     break;
 
-  case 531:
-#line 2898 "./util/configparser.y"
+  case 581: /* view_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 3182 "./util/configparser.y"
         {
 		OUTYY(("P(view_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(
 			&cfg_parser->cfg->views->respip_data, (yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 6720 "util/configparser.c"
+#line 6478 "util/configparser.c"
     break;
 
-  case 532:
-#line 2906 "./util/configparser.y"
+  case 582: /* view_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 3190 "./util/configparser.y"
         {
 		OUTYY(("P(view_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->views->local_data, (yyvsp[0].str))) {
 			fatal_exit("out of memory adding local-data");
 		}
 	}
-#line 6731 "util/configparser.c"
+#line 6489 "util/configparser.c"
     break;
 
-  case 533:
-#line 2914 "./util/configparser.y"
+  case 583: /* view_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 3198 "./util/configparser.y"
         {
 		char* ptr;
 		OUTYY(("P(view_local_data_ptr:%s)\n", (yyvsp[0].str)));
@@ -6745,11 +6503,11 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 6749 "util/configparser.c"
+#line 6507 "util/configparser.c"
     break;
 
-  case 534:
-#line 2929 "./util/configparser.y"
+  case 584: /* view_first: VAR_VIEW_FIRST STRING_ARG  */
+#line 3213 "./util/configparser.y"
         {
 		OUTYY(("P(view-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6757,19 +6515,19 @@ yyreduce:
 		else cfg_parser->cfg->views->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6761 "util/configparser.c"
+#line 6519 "util/configparser.c"
     break;
 
-  case 535:
-#line 2938 "./util/configparser.y"
+  case 585: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 3222 "./util/configparser.y"
         { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
-#line 6769 "util/configparser.c"
+#line 6527 "util/configparser.c"
     break;
 
-  case 546:
-#line 2949 "./util/configparser.y"
+  case 596: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 3233 "./util/configparser.y"
         {
 		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6778,11 +6536,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6782 "util/configparser.c"
+#line 6540 "util/configparser.c"
     break;
 
-  case 547:
-#line 2959 "./util/configparser.y"
+  case 597: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 3243 "./util/configparser.y"
         {
 		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -6790,79 +6548,79 @@ yyreduce:
 		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6794 "util/configparser.c"
+#line 6552 "util/configparser.c"
     break;
 
-  case 548:
-#line 2968 "./util/configparser.y"
+  case 598: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 3252 "./util/configparser.y"
         {
 		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6804 "util/configparser.c"
+#line 6562 "util/configparser.c"
     break;
 
-  case 549:
-#line 2975 "./util/configparser.y"
+  case 599: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 3259 "./util/configparser.y"
         {
 		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->control_use_cert = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6814 "util/configparser.c"
+#line 6572 "util/configparser.c"
     break;
 
-  case 550:
-#line 2982 "./util/configparser.y"
+  case 600: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 3266 "./util/configparser.y"
         {
 		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
 		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
-#line 6824 "util/configparser.c"
+#line 6582 "util/configparser.c"
     break;
 
-  case 551:
-#line 2989 "./util/configparser.y"
+  case 601: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 3273 "./util/configparser.y"
         {
 		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
 		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
-#line 6834 "util/configparser.c"
+#line 6592 "util/configparser.c"
     break;
 
-  case 552:
-#line 2996 "./util/configparser.y"
+  case 602: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 3280 "./util/configparser.y"
         {
 		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
 		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
-#line 6844 "util/configparser.c"
+#line 6602 "util/configparser.c"
     break;
 
-  case 553:
-#line 3003 "./util/configparser.y"
+  case 603: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 3287 "./util/configparser.y"
         {
 		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
 		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
-#line 6854 "util/configparser.c"
+#line 6612 "util/configparser.c"
     break;
 
-  case 554:
-#line 3010 "./util/configparser.y"
+  case 604: /* dtstart: VAR_DNSTAP  */
+#line 3294 "./util/configparser.y"
         {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
-#line 6862 "util/configparser.c"
+#line 6620 "util/configparser.c"
     break;
 
-  case 576:
-#line 3030 "./util/configparser.y"
+  case 626: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 3314 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6870,11 +6628,11 @@ yyreduce:
 		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6874 "util/configparser.c"
+#line 6632 "util/configparser.c"
     break;
 
-  case 577:
-#line 3039 "./util/configparser.y"
+  case 627: /* dt_dnstap_bidirectional: VAR_DNSTAP_BIDIRECTIONAL STRING_ARG  */
+#line 3323 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_bidirectional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6883,31 +6641,31 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6887 "util/configparser.c"
+#line 6645 "util/configparser.c"
     break;
 
-  case 578:
-#line 3049 "./util/configparser.y"
+  case 628: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 3333 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
 		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
-#line 6897 "util/configparser.c"
+#line 6655 "util/configparser.c"
     break;
 
-  case 579:
-#line 3056 "./util/configparser.y"
+  case 629: /* dt_dnstap_ip: VAR_DNSTAP_IP STRING_ARG  */
+#line 3340 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_ip:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_ip);
 		cfg_parser->cfg->dnstap_ip = (yyvsp[0].str);
 	}
-#line 6907 "util/configparser.c"
+#line 6665 "util/configparser.c"
     break;
 
-  case 580:
-#line 3063 "./util/configparser.y"
+  case 630: /* dt_dnstap_tls: VAR_DNSTAP_TLS STRING_ARG  */
+#line 3347 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6915,51 +6673,51 @@ yyreduce:
 		else cfg_parser->cfg->dnstap_tls = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6919 "util/configparser.c"
+#line 6677 "util/configparser.c"
     break;
 
-  case 581:
-#line 3072 "./util/configparser.y"
+  case 631: /* dt_dnstap_tls_server_name: VAR_DNSTAP_TLS_SERVER_NAME STRING_ARG  */
+#line 3356 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_server_name:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_server_name);
 		cfg_parser->cfg->dnstap_tls_server_name = (yyvsp[0].str);
 	}
-#line 6929 "util/configparser.c"
+#line 6687 "util/configparser.c"
     break;
 
-  case 582:
-#line 3079 "./util/configparser.y"
+  case 632: /* dt_dnstap_tls_cert_bundle: VAR_DNSTAP_TLS_CERT_BUNDLE STRING_ARG  */
+#line 3363 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_cert_bundle:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_cert_bundle);
 		cfg_parser->cfg->dnstap_tls_cert_bundle = (yyvsp[0].str);
 	}
-#line 6939 "util/configparser.c"
+#line 6697 "util/configparser.c"
     break;
 
-  case 583:
-#line 3086 "./util/configparser.y"
+  case 633: /* dt_dnstap_tls_client_key_file: VAR_DNSTAP_TLS_CLIENT_KEY_FILE STRING_ARG  */
+#line 3370 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_client_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_client_key_file);
 		cfg_parser->cfg->dnstap_tls_client_key_file = (yyvsp[0].str);
 	}
-#line 6949 "util/configparser.c"
+#line 6707 "util/configparser.c"
     break;
 
-  case 584:
-#line 3093 "./util/configparser.y"
+  case 634: /* dt_dnstap_tls_client_cert_file: VAR_DNSTAP_TLS_CLIENT_CERT_FILE STRING_ARG  */
+#line 3377 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_client_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_client_cert_file);
 		cfg_parser->cfg->dnstap_tls_client_cert_file = (yyvsp[0].str);
 	}
-#line 6959 "util/configparser.c"
+#line 6717 "util/configparser.c"
     break;
 
-  case 585:
-#line 3100 "./util/configparser.y"
+  case 635: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 3384 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6967,11 +6725,11 @@ yyreduce:
 		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6971 "util/configparser.c"
+#line 6729 "util/configparser.c"
     break;
 
-  case 586:
-#line 3109 "./util/configparser.y"
+  case 636: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 3393 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6979,31 +6737,31 @@ yyreduce:
 		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6983 "util/configparser.c"
+#line 6741 "util/configparser.c"
     break;
 
-  case 587:
-#line 3118 "./util/configparser.y"
+  case 637: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 3402 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
 		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
-#line 6993 "util/configparser.c"
+#line 6751 "util/configparser.c"
     break;
 
-  case 588:
-#line 3125 "./util/configparser.y"
+  case 638: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 3409 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
 		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
-#line 7003 "util/configparser.c"
+#line 6761 "util/configparser.c"
     break;
 
-  case 589:
-#line 3132 "./util/configparser.y"
+  case 639: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 3416 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7012,11 +6770,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7016 "util/configparser.c"
+#line 6774 "util/configparser.c"
     break;
 
-  case 590:
-#line 3142 "./util/configparser.y"
+  case 640: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 3426 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7025,11 +6783,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7029 "util/configparser.c"
+#line 6787 "util/configparser.c"
     break;
 
-  case 591:
-#line 3152 "./util/configparser.y"
+  case 641: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 3436 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7038,11 +6796,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7042 "util/configparser.c"
+#line 6800 "util/configparser.c"
     break;
 
-  case 592:
-#line 3162 "./util/configparser.y"
+  case 642: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 3446 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7051,11 +6809,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7055 "util/configparser.c"
+#line 6813 "util/configparser.c"
     break;
 
-  case 593:
-#line 3172 "./util/configparser.y"
+  case 643: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 3456 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7064,11 +6822,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7068 "util/configparser.c"
+#line 6826 "util/configparser.c"
     break;
 
-  case 594:
-#line 3182 "./util/configparser.y"
+  case 644: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 3466 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7077,47 +6835,47 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7081 "util/configparser.c"
+#line 6839 "util/configparser.c"
     break;
 
-  case 595:
-#line 3192 "./util/configparser.y"
+  case 645: /* pythonstart: VAR_PYTHON  */
+#line 3476 "./util/configparser.y"
         { 
 		OUTYY(("\nP(python:)\n")); 
 	}
-#line 7089 "util/configparser.c"
+#line 6847 "util/configparser.c"
     break;
 
-  case 599:
-#line 3201 "./util/configparser.y"
+  case 649: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 3485 "./util/configparser.y"
         {
 		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append_ex(&cfg_parser->cfg->python_script, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 7099 "util/configparser.c"
+#line 6857 "util/configparser.c"
     break;
 
-  case 600:
-#line 3207 "./util/configparser.y"
+  case 650: /* dynlibstart: VAR_DYNLIB  */
+#line 3491 "./util/configparser.y"
         { 
 		OUTYY(("\nP(dynlib:)\n")); 
 	}
-#line 7107 "util/configparser.c"
+#line 6865 "util/configparser.c"
     break;
 
-  case 604:
-#line 3216 "./util/configparser.y"
+  case 654: /* dl_file: VAR_DYNLIB_FILE STRING_ARG  */
+#line 3500 "./util/configparser.y"
         {
 		OUTYY(("P(dynlib-file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append_ex(&cfg_parser->cfg->dynlib_file, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 7117 "util/configparser.c"
+#line 6875 "util/configparser.c"
     break;
 
-  case 605:
-#line 3222 "./util/configparser.y"
+  case 655: /* server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG  */
+#line 3506 "./util/configparser.y"
         {
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", (yyvsp[0].str)));
 		if (strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7126,21 +6884,21 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7130 "util/configparser.c"
+#line 6888 "util/configparser.c"
     break;
 
-  case 606:
-#line 3232 "./util/configparser.y"
+  case 656: /* server_log_identity: VAR_LOG_IDENTITY STRING_ARG  */
+#line 3516 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->log_identity);
 		cfg_parser->cfg->log_identity = (yyvsp[0].str);
 	}
-#line 7140 "util/configparser.c"
+#line 6898 "util/configparser.c"
     break;
 
-  case 607:
-#line 3239 "./util/configparser.y"
+  case 657: /* server_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 3523 "./util/configparser.y"
         {
 		OUTYY(("P(server_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
@@ -7148,30 +6906,30 @@ yyreduce:
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip");
 	}
-#line 7152 "util/configparser.c"
+#line 6910 "util/configparser.c"
     break;
 
-  case 608:
-#line 3248 "./util/configparser.y"
+  case 658: /* server_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 3532 "./util/configparser.y"
         {
 		OUTYY(("P(server_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->respip_data,
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 7163 "util/configparser.c"
+#line 6921 "util/configparser.c"
     break;
 
-  case 609:
-#line 3256 "./util/configparser.y"
+  case 659: /* dnscstart: VAR_DNSCRYPT  */
+#line 3540 "./util/configparser.y"
         {
 		OUTYY(("\nP(dnscrypt:)\n"));
 	}
-#line 7171 "util/configparser.c"
+#line 6929 "util/configparser.c"
     break;
 
-  case 622:
-#line 3272 "./util/configparser.y"
+  case 672: /* dnsc_dnscrypt_enable: VAR_DNSCRYPT_ENABLE STRING_ARG  */
+#line 3556 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7179,11 +6937,11 @@ yyreduce:
 		else cfg_parser->cfg->dnscrypt = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7183 "util/configparser.c"
+#line 6941 "util/configparser.c"
     break;
 
-  case 623:
-#line 3282 "./util/configparser.y"
+  case 673: /* dnsc_dnscrypt_port: VAR_DNSCRYPT_PORT STRING_ARG  */
+#line 3566 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -7191,21 +6949,21 @@ yyreduce:
 		else cfg_parser->cfg->dnscrypt_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 7195 "util/configparser.c"
+#line 6953 "util/configparser.c"
     break;
 
-  case 624:
-#line 3291 "./util/configparser.y"
+  case 674: /* dnsc_dnscrypt_provider: VAR_DNSCRYPT_PROVIDER STRING_ARG  */
+#line 3575 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_provider:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnscrypt_provider);
 		cfg_parser->cfg->dnscrypt_provider = (yyvsp[0].str);
 	}
-#line 7205 "util/configparser.c"
+#line 6963 "util/configparser.c"
     break;
 
-  case 625:
-#line 3298 "./util/configparser.y"
+  case 675: /* dnsc_dnscrypt_provider_cert: VAR_DNSCRYPT_PROVIDER_CERT STRING_ARG  */
+#line 3582 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
@@ -7213,21 +6971,21 @@ yyreduce:
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert");
 	}
-#line 7217 "util/configparser.c"
+#line 6975 "util/configparser.c"
     break;
 
-  case 626:
-#line 3307 "./util/configparser.y"
+  case 676: /* dnsc_dnscrypt_provider_cert_rotated: VAR_DNSCRYPT_PROVIDER_CERT_ROTATED STRING_ARG  */
+#line 3591 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert_rotated:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert_rotated, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert-rotated");
 	}
-#line 7227 "util/configparser.c"
+#line 6985 "util/configparser.c"
     break;
 
-  case 627:
-#line 3314 "./util/configparser.y"
+  case 677: /* dnsc_dnscrypt_secret_key: VAR_DNSCRYPT_SECRET_KEY STRING_ARG  */
+#line 3598 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_secret_key:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
@@ -7235,22 +6993,22 @@ yyreduce:
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-secret-key");
 	}
-#line 7239 "util/configparser.c"
+#line 6997 "util/configparser.c"
     break;
 
-  case 628:
-#line 3323 "./util/configparser.y"
+  case 678: /* dnsc_dnscrypt_shared_secret_cache_size: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE STRING_ARG  */
+#line 3607 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_shared_secret_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_shared_secret_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 7250 "util/configparser.c"
+#line 7008 "util/configparser.c"
     break;
 
-  case 629:
-#line 3331 "./util/configparser.y"
+  case 679: /* dnsc_dnscrypt_shared_secret_cache_slabs: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS STRING_ARG  */
+#line 3615 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_shared_secret_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
@@ -7262,22 +7020,22 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 7266 "util/configparser.c"
+#line 7024 "util/configparser.c"
     break;
 
-  case 630:
-#line 3344 "./util/configparser.y"
+  case 680: /* dnsc_dnscrypt_nonce_cache_size: VAR_DNSCRYPT_NONCE_CACHE_SIZE STRING_ARG  */
+#line 3628 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_nonce_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_nonce_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 7277 "util/configparser.c"
+#line 7035 "util/configparser.c"
     break;
 
-  case 631:
-#line 3352 "./util/configparser.y"
+  case 681: /* dnsc_dnscrypt_nonce_cache_slabs: VAR_DNSCRYPT_NONCE_CACHE_SLABS STRING_ARG  */
+#line 3636 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_nonce_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
@@ -7289,19 +7047,19 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 7293 "util/configparser.c"
+#line 7051 "util/configparser.c"
     break;
 
-  case 632:
-#line 3365 "./util/configparser.y"
+  case 682: /* cachedbstart: VAR_CACHEDB  */
+#line 3649 "./util/configparser.y"
         {
 		OUTYY(("\nP(cachedb:)\n"));
 	}
-#line 7301 "util/configparser.c"
+#line 7059 "util/configparser.c"
     break;
 
-  case 641:
-#line 3376 "./util/configparser.y"
+  case 692: /* cachedb_backend_name: VAR_CACHEDB_BACKEND STRING_ARG  */
+#line 3660 "./util/configparser.y"
         {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(backend:%s)\n", (yyvsp[0].str)));
@@ -7312,11 +7070,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 7316 "util/configparser.c"
+#line 7074 "util/configparser.c"
     break;
 
-  case 642:
-#line 3388 "./util/configparser.y"
+  case 693: /* cachedb_secret_seed: VAR_CACHEDB_SECRETSEED STRING_ARG  */
+#line 3672 "./util/configparser.y"
         {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(secret-seed:%s)\n", (yyvsp[0].str)));
@@ -7327,11 +7085,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 7331 "util/configparser.c"
+#line 7089 "util/configparser.c"
     break;
 
-  case 643:
-#line 3400 "./util/configparser.y"
+  case 694: /* redis_server_host: VAR_CACHEDB_REDISHOST STRING_ARG  */
+#line 3684 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_server_host:%s)\n", (yyvsp[0].str)));
@@ -7342,11 +7100,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 7346 "util/configparser.c"
+#line 7104 "util/configparser.c"
     break;
 
-  case 644:
-#line 3412 "./util/configparser.y"
+  case 695: /* redis_server_port: VAR_CACHEDB_REDISPORT STRING_ARG  */
+#line 3696 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		int port;
@@ -7360,11 +7118,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 7364 "util/configparser.c"
+#line 7122 "util/configparser.c"
     break;
 
-  case 645:
-#line 3427 "./util/configparser.y"
+  case 696: /* redis_timeout: VAR_CACHEDB_REDISTIMEOUT STRING_ARG  */
+#line 3711 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_timeout:%s)\n", (yyvsp[0].str)));
@@ -7376,11 +7134,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 7380 "util/configparser.c"
+#line 7138 "util/configparser.c"
     break;
 
-  case 646:
-#line 3440 "./util/configparser.y"
+  case 697: /* redis_expire_records: VAR_CACHEDB_REDISEXPIRERECORDS STRING_ARG  */
+#line 3724 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_expire_records:%s)\n", (yyvsp[0].str)));
@@ -7392,11 +7150,27 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 7396 "util/configparser.c"
+#line 7154 "util/configparser.c"
+    break;
+
+  case 698: /* redis_async: VAR_CACHEDB_REDISASYNC STRING_ARG  */
+#line 3737 "./util/configparser.y"
+        {
+	#ifdef USE_CACHEDB
+		OUTYY(("P(redis_async:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->redis_async = (strcmp((yyvsp[0].str), "yes")==0);
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free((yyvsp[0].str));
+	}
+#line 7170 "util/configparser.c"
     break;
 
-  case 647:
-#line 3453 "./util/configparser.y"
+  case 699: /* server_tcp_connection_limit: VAR_TCP_CONNECTION_LIMIT STRING_ARG STRING_ARG  */
+#line 3750 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_connection_limit:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if (atoi((yyvsp[0].str)) < 0)
@@ -7406,19 +7180,19 @@ yyreduce:
 				fatal_exit("out of memory adding tcp connection limit");
 		}
 	}
-#line 7410 "util/configparser.c"
+#line 7184 "util/configparser.c"
     break;
 
-  case 648:
-#line 3464 "./util/configparser.y"
+  case 700: /* ipsetstart: VAR_IPSET  */
+#line 3761 "./util/configparser.y"
                 {
 			OUTYY(("\nP(ipset:)\n"));
 		}
-#line 7418 "util/configparser.c"
+#line 7192 "util/configparser.c"
     break;
 
-  case 653:
-#line 3473 "./util/configparser.y"
+  case 705: /* ipset_name_v4: VAR_IPSET_NAME_V4 STRING_ARG  */
+#line 3770 "./util/configparser.y"
                 {
 		#ifdef USE_IPSET
 			OUTYY(("P(name-v4:%s)\n", (yyvsp[0].str)));
@@ -7432,11 +7206,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		#endif
 		}
-#line 7436 "util/configparser.c"
+#line 7210 "util/configparser.c"
     break;
 
-  case 654:
-#line 3488 "./util/configparser.y"
+  case 706: /* ipset_name_v6: VAR_IPSET_NAME_V6 STRING_ARG  */
+#line 3785 "./util/configparser.y"
         {
 		#ifdef USE_IPSET
 			OUTYY(("P(name-v6:%s)\n", (yyvsp[0].str)));
@@ -7450,11 +7224,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		#endif
 		}
-#line 7454 "util/configparser.c"
+#line 7228 "util/configparser.c"
     break;
 
 
-#line 7458 "util/configparser.c"
+#line 7232 "util/configparser.c"
 
       default: break;
     }
@@ -7536,6 +7310,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -7596,7 +7371,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -7604,24 +7379,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -7648,7 +7421,7 @@ yyreturn:
   return yyresult;
 }
 
-#line 3502 "./util/configparser.y"
+#line 3799 "./util/configparser.y"
 
 
 /* parse helper routines could be here */
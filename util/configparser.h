@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.6.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -171,204 +171,231 @@ extern int yydebug;
     VAR_VAL_SIG_SKEW_MAX = 372,    /* VAR_VAL_SIG_SKEW_MAX  */
     VAR_CACHE_MIN_TTL = 373,       /* VAR_CACHE_MIN_TTL  */
     VAR_VAL_LOG_LEVEL = 374,       /* VAR_VAL_LOG_LEVEL  */
-    VAR_AUTO_TRUST_ANCHOR_FILE = 375, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
-    VAR_KEEP_MISSING = 376,        /* VAR_KEEP_MISSING  */
-    VAR_ADD_HOLDDOWN = 377,        /* VAR_ADD_HOLDDOWN  */
-    VAR_DEL_HOLDDOWN = 378,        /* VAR_DEL_HOLDDOWN  */
-    VAR_SO_RCVBUF = 379,           /* VAR_SO_RCVBUF  */
-    VAR_EDNS_BUFFER_SIZE = 380,    /* VAR_EDNS_BUFFER_SIZE  */
-    VAR_PREFETCH = 381,            /* VAR_PREFETCH  */
-    VAR_PREFETCH_KEY = 382,        /* VAR_PREFETCH_KEY  */
-    VAR_SO_SNDBUF = 383,           /* VAR_SO_SNDBUF  */
-    VAR_SO_REUSEPORT = 384,        /* VAR_SO_REUSEPORT  */
-    VAR_HARDEN_BELOW_NXDOMAIN = 385, /* VAR_HARDEN_BELOW_NXDOMAIN  */
-    VAR_IGNORE_CD_FLAG = 386,      /* VAR_IGNORE_CD_FLAG  */
-    VAR_LOG_QUERIES = 387,         /* VAR_LOG_QUERIES  */
-    VAR_LOG_REPLIES = 388,         /* VAR_LOG_REPLIES  */
-    VAR_LOG_LOCAL_ACTIONS = 389,   /* VAR_LOG_LOCAL_ACTIONS  */
-    VAR_TCP_UPSTREAM = 390,        /* VAR_TCP_UPSTREAM  */
-    VAR_SSL_UPSTREAM = 391,        /* VAR_SSL_UPSTREAM  */
-    VAR_TCP_AUTH_QUERY_TIMEOUT = 392, /* VAR_TCP_AUTH_QUERY_TIMEOUT  */
-    VAR_SSL_SERVICE_KEY = 393,     /* VAR_SSL_SERVICE_KEY  */
-    VAR_SSL_SERVICE_PEM = 394,     /* VAR_SSL_SERVICE_PEM  */
-    VAR_SSL_PORT = 395,            /* VAR_SSL_PORT  */
-    VAR_FORWARD_FIRST = 396,       /* VAR_FORWARD_FIRST  */
-    VAR_STUB_SSL_UPSTREAM = 397,   /* VAR_STUB_SSL_UPSTREAM  */
-    VAR_FORWARD_SSL_UPSTREAM = 398, /* VAR_FORWARD_SSL_UPSTREAM  */
-    VAR_TLS_CERT_BUNDLE = 399,     /* VAR_TLS_CERT_BUNDLE  */
-    VAR_HTTPS_PORT = 400,          /* VAR_HTTPS_PORT  */
-    VAR_HTTP_ENDPOINT = 401,       /* VAR_HTTP_ENDPOINT  */
-    VAR_HTTP_MAX_STREAMS = 402,    /* VAR_HTTP_MAX_STREAMS  */
-    VAR_HTTP_QUERY_BUFFER_SIZE = 403, /* VAR_HTTP_QUERY_BUFFER_SIZE  */
-    VAR_HTTP_RESPONSE_BUFFER_SIZE = 404, /* VAR_HTTP_RESPONSE_BUFFER_SIZE  */
-    VAR_HTTP_NODELAY = 405,        /* VAR_HTTP_NODELAY  */
-    VAR_HTTP_NOTLS_DOWNSTREAM = 406, /* VAR_HTTP_NOTLS_DOWNSTREAM  */
-    VAR_STUB_FIRST = 407,          /* VAR_STUB_FIRST  */
-    VAR_MINIMAL_RESPONSES = 408,   /* VAR_MINIMAL_RESPONSES  */
-    VAR_RRSET_ROUNDROBIN = 409,    /* VAR_RRSET_ROUNDROBIN  */
-    VAR_MAX_UDP_SIZE = 410,        /* VAR_MAX_UDP_SIZE  */
-    VAR_DELAY_CLOSE = 411,         /* VAR_DELAY_CLOSE  */
-    VAR_UDP_CONNECT = 412,         /* VAR_UDP_CONNECT  */
-    VAR_UNBLOCK_LAN_ZONES = 413,   /* VAR_UNBLOCK_LAN_ZONES  */
-    VAR_INSECURE_LAN_ZONES = 414,  /* VAR_INSECURE_LAN_ZONES  */
-    VAR_INFRA_CACHE_MIN_RTT = 415, /* VAR_INFRA_CACHE_MIN_RTT  */
-    VAR_INFRA_KEEP_PROBING = 416,  /* VAR_INFRA_KEEP_PROBING  */
-    VAR_DNS64_PREFIX = 417,        /* VAR_DNS64_PREFIX  */
-    VAR_DNS64_SYNTHALL = 418,      /* VAR_DNS64_SYNTHALL  */
-    VAR_DNS64_IGNORE_AAAA = 419,   /* VAR_DNS64_IGNORE_AAAA  */
-    VAR_DNSTAP = 420,              /* VAR_DNSTAP  */
-    VAR_DNSTAP_ENABLE = 421,       /* VAR_DNSTAP_ENABLE  */
-    VAR_DNSTAP_SOCKET_PATH = 422,  /* VAR_DNSTAP_SOCKET_PATH  */
-    VAR_DNSTAP_IP = 423,           /* VAR_DNSTAP_IP  */
-    VAR_DNSTAP_TLS = 424,          /* VAR_DNSTAP_TLS  */
-    VAR_DNSTAP_TLS_SERVER_NAME = 425, /* VAR_DNSTAP_TLS_SERVER_NAME  */
-    VAR_DNSTAP_TLS_CERT_BUNDLE = 426, /* VAR_DNSTAP_TLS_CERT_BUNDLE  */
-    VAR_DNSTAP_TLS_CLIENT_KEY_FILE = 427, /* VAR_DNSTAP_TLS_CLIENT_KEY_FILE  */
-    VAR_DNSTAP_TLS_CLIENT_CERT_FILE = 428, /* VAR_DNSTAP_TLS_CLIENT_CERT_FILE  */
-    VAR_DNSTAP_SEND_IDENTITY = 429, /* VAR_DNSTAP_SEND_IDENTITY  */
-    VAR_DNSTAP_SEND_VERSION = 430, /* VAR_DNSTAP_SEND_VERSION  */
-    VAR_DNSTAP_BIDIRECTIONAL = 431, /* VAR_DNSTAP_BIDIRECTIONAL  */
-    VAR_DNSTAP_IDENTITY = 432,     /* VAR_DNSTAP_IDENTITY  */
-    VAR_DNSTAP_VERSION = 433,      /* VAR_DNSTAP_VERSION  */
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 434, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 435, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 436, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 437, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 438, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 439, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
-    VAR_RESPONSE_IP_TAG = 440,     /* VAR_RESPONSE_IP_TAG  */
-    VAR_RESPONSE_IP = 441,         /* VAR_RESPONSE_IP  */
-    VAR_RESPONSE_IP_DATA = 442,    /* VAR_RESPONSE_IP_DATA  */
-    VAR_HARDEN_ALGO_DOWNGRADE = 443, /* VAR_HARDEN_ALGO_DOWNGRADE  */
-    VAR_IP_TRANSPARENT = 444,      /* VAR_IP_TRANSPARENT  */
-    VAR_IP_DSCP = 445,             /* VAR_IP_DSCP  */
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 446, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
-    VAR_IP_RATELIMIT = 447,        /* VAR_IP_RATELIMIT  */
-    VAR_IP_RATELIMIT_SLABS = 448,  /* VAR_IP_RATELIMIT_SLABS  */
-    VAR_IP_RATELIMIT_SIZE = 449,   /* VAR_IP_RATELIMIT_SIZE  */
-    VAR_RATELIMIT = 450,           /* VAR_RATELIMIT  */
-    VAR_RATELIMIT_SLABS = 451,     /* VAR_RATELIMIT_SLABS  */
-    VAR_RATELIMIT_SIZE = 452,      /* VAR_RATELIMIT_SIZE  */
-    VAR_RATELIMIT_FOR_DOMAIN = 453, /* VAR_RATELIMIT_FOR_DOMAIN  */
-    VAR_RATELIMIT_BELOW_DOMAIN = 454, /* VAR_RATELIMIT_BELOW_DOMAIN  */
-    VAR_IP_RATELIMIT_FACTOR = 455, /* VAR_IP_RATELIMIT_FACTOR  */
-    VAR_RATELIMIT_FACTOR = 456,    /* VAR_RATELIMIT_FACTOR  */
-    VAR_SEND_CLIENT_SUBNET = 457,  /* VAR_SEND_CLIENT_SUBNET  */
-    VAR_CLIENT_SUBNET_ZONE = 458,  /* VAR_CLIENT_SUBNET_ZONE  */
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 459, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
-    VAR_CLIENT_SUBNET_OPCODE = 460, /* VAR_CLIENT_SUBNET_OPCODE  */
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 461, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 462, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
-    VAR_MIN_CLIENT_SUBNET_IPV4 = 463, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
-    VAR_MIN_CLIENT_SUBNET_IPV6 = 464, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
-    VAR_MAX_ECS_TREE_SIZE_IPV4 = 465, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
-    VAR_MAX_ECS_TREE_SIZE_IPV6 = 466, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
-    VAR_CAPS_WHITELIST = 467,      /* VAR_CAPS_WHITELIST  */
-    VAR_CACHE_MAX_NEGATIVE_TTL = 468, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
-    VAR_PERMIT_SMALL_HOLDDOWN = 469, /* VAR_PERMIT_SMALL_HOLDDOWN  */
-    VAR_QNAME_MINIMISATION = 470,  /* VAR_QNAME_MINIMISATION  */
-    VAR_QNAME_MINIMISATION_STRICT = 471, /* VAR_QNAME_MINIMISATION_STRICT  */
-    VAR_IP_FREEBIND = 472,         /* VAR_IP_FREEBIND  */
-    VAR_DEFINE_TAG = 473,          /* VAR_DEFINE_TAG  */
-    VAR_LOCAL_ZONE_TAG = 474,      /* VAR_LOCAL_ZONE_TAG  */
-    VAR_ACCESS_CONTROL_TAG = 475,  /* VAR_ACCESS_CONTROL_TAG  */
-    VAR_LOCAL_ZONE_OVERRIDE = 476, /* VAR_LOCAL_ZONE_OVERRIDE  */
-    VAR_ACCESS_CONTROL_TAG_ACTION = 477, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
-    VAR_ACCESS_CONTROL_TAG_DATA = 478, /* VAR_ACCESS_CONTROL_TAG_DATA  */
-    VAR_VIEW = 479,                /* VAR_VIEW  */
-    VAR_ACCESS_CONTROL_VIEW = 480, /* VAR_ACCESS_CONTROL_VIEW  */
-    VAR_VIEW_FIRST = 481,          /* VAR_VIEW_FIRST  */
-    VAR_SERVE_EXPIRED = 482,       /* VAR_SERVE_EXPIRED  */
-    VAR_SERVE_EXPIRED_TTL = 483,   /* VAR_SERVE_EXPIRED_TTL  */
-    VAR_SERVE_EXPIRED_TTL_RESET = 484, /* VAR_SERVE_EXPIRED_TTL_RESET  */
-    VAR_SERVE_EXPIRED_REPLY_TTL = 485, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
-    VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 486, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
-    VAR_SERVE_ORIGINAL_TTL = 487,  /* VAR_SERVE_ORIGINAL_TTL  */
-    VAR_FAKE_DSA = 488,            /* VAR_FAKE_DSA  */
-    VAR_FAKE_SHA1 = 489,           /* VAR_FAKE_SHA1  */
-    VAR_LOG_IDENTITY = 490,        /* VAR_LOG_IDENTITY  */
-    VAR_HIDE_TRUSTANCHOR = 491,    /* VAR_HIDE_TRUSTANCHOR  */
-    VAR_TRUST_ANCHOR_SIGNALING = 492, /* VAR_TRUST_ANCHOR_SIGNALING  */
-    VAR_AGGRESSIVE_NSEC = 493,     /* VAR_AGGRESSIVE_NSEC  */
-    VAR_USE_SYSTEMD = 494,         /* VAR_USE_SYSTEMD  */
-    VAR_SHM_ENABLE = 495,          /* VAR_SHM_ENABLE  */
-    VAR_SHM_KEY = 496,             /* VAR_SHM_KEY  */
-    VAR_ROOT_KEY_SENTINEL = 497,   /* VAR_ROOT_KEY_SENTINEL  */
-    VAR_DNSCRYPT = 498,            /* VAR_DNSCRYPT  */
-    VAR_DNSCRYPT_ENABLE = 499,     /* VAR_DNSCRYPT_ENABLE  */
-    VAR_DNSCRYPT_PORT = 500,       /* VAR_DNSCRYPT_PORT  */
-    VAR_DNSCRYPT_PROVIDER = 501,   /* VAR_DNSCRYPT_PROVIDER  */
-    VAR_DNSCRYPT_SECRET_KEY = 502, /* VAR_DNSCRYPT_SECRET_KEY  */
-    VAR_DNSCRYPT_PROVIDER_CERT = 503, /* VAR_DNSCRYPT_PROVIDER_CERT  */
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 504, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 505, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 506, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 507, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 508, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
-    VAR_PAD_RESPONSES = 509,       /* VAR_PAD_RESPONSES  */
-    VAR_PAD_RESPONSES_BLOCK_SIZE = 510, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
-    VAR_PAD_QUERIES = 511,         /* VAR_PAD_QUERIES  */
-    VAR_PAD_QUERIES_BLOCK_SIZE = 512, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
-    VAR_IPSECMOD_ENABLED = 513,    /* VAR_IPSECMOD_ENABLED  */
-    VAR_IPSECMOD_HOOK = 514,       /* VAR_IPSECMOD_HOOK  */
-    VAR_IPSECMOD_IGNORE_BOGUS = 515, /* VAR_IPSECMOD_IGNORE_BOGUS  */
-    VAR_IPSECMOD_MAX_TTL = 516,    /* VAR_IPSECMOD_MAX_TTL  */
-    VAR_IPSECMOD_WHITELIST = 517,  /* VAR_IPSECMOD_WHITELIST  */
-    VAR_IPSECMOD_STRICT = 518,     /* VAR_IPSECMOD_STRICT  */
-    VAR_CACHEDB = 519,             /* VAR_CACHEDB  */
-    VAR_CACHEDB_BACKEND = 520,     /* VAR_CACHEDB_BACKEND  */
-    VAR_CACHEDB_SECRETSEED = 521,  /* VAR_CACHEDB_SECRETSEED  */
-    VAR_CACHEDB_REDISHOST = 522,   /* VAR_CACHEDB_REDISHOST  */
-    VAR_CACHEDB_REDISPORT = 523,   /* VAR_CACHEDB_REDISPORT  */
-    VAR_CACHEDB_REDISTIMEOUT = 524, /* VAR_CACHEDB_REDISTIMEOUT  */
-    VAR_CACHEDB_REDISEXPIRERECORDS = 525, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 526, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
-    VAR_FOR_UPSTREAM = 527,        /* VAR_FOR_UPSTREAM  */
-    VAR_AUTH_ZONE = 528,           /* VAR_AUTH_ZONE  */
-    VAR_ZONEFILE = 529,            /* VAR_ZONEFILE  */
-    VAR_MASTER = 530,              /* VAR_MASTER  */
-    VAR_URL = 531,                 /* VAR_URL  */
-    VAR_FOR_DOWNSTREAM = 532,      /* VAR_FOR_DOWNSTREAM  */
-    VAR_FALLBACK_ENABLED = 533,    /* VAR_FALLBACK_ENABLED  */
-    VAR_TLS_ADDITIONAL_PORT = 534, /* VAR_TLS_ADDITIONAL_PORT  */
-    VAR_LOW_RTT = 535,             /* VAR_LOW_RTT  */
-    VAR_LOW_RTT_PERMIL = 536,      /* VAR_LOW_RTT_PERMIL  */
-    VAR_FAST_SERVER_PERMIL = 537,  /* VAR_FAST_SERVER_PERMIL  */
-    VAR_FAST_SERVER_NUM = 538,     /* VAR_FAST_SERVER_NUM  */
-    VAR_ALLOW_NOTIFY = 539,        /* VAR_ALLOW_NOTIFY  */
-    VAR_TLS_WIN_CERT = 540,        /* VAR_TLS_WIN_CERT  */
-    VAR_TCP_CONNECTION_LIMIT = 541, /* VAR_TCP_CONNECTION_LIMIT  */
-    VAR_FORWARD_NO_CACHE = 542,    /* VAR_FORWARD_NO_CACHE  */
-    VAR_STUB_NO_CACHE = 543,       /* VAR_STUB_NO_CACHE  */
-    VAR_LOG_SERVFAIL = 544,        /* VAR_LOG_SERVFAIL  */
-    VAR_DENY_ANY = 545,            /* VAR_DENY_ANY  */
-    VAR_UNKNOWN_SERVER_TIME_LIMIT = 546, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
-    VAR_LOG_TAG_QUERYREPLY = 547,  /* VAR_LOG_TAG_QUERYREPLY  */
-    VAR_STREAM_WAIT_SIZE = 548,    /* VAR_STREAM_WAIT_SIZE  */
-    VAR_TLS_CIPHERS = 549,         /* VAR_TLS_CIPHERS  */
-    VAR_TLS_CIPHERSUITES = 550,    /* VAR_TLS_CIPHERSUITES  */
-    VAR_TLS_USE_SNI = 551,         /* VAR_TLS_USE_SNI  */
-    VAR_IPSET = 552,               /* VAR_IPSET  */
-    VAR_IPSET_NAME_V4 = 553,       /* VAR_IPSET_NAME_V4  */
-    VAR_IPSET_NAME_V6 = 554,       /* VAR_IPSET_NAME_V6  */
-    VAR_TLS_SESSION_TICKET_KEYS = 555, /* VAR_TLS_SESSION_TICKET_KEYS  */
-    VAR_RPZ = 556,                 /* VAR_RPZ  */
-    VAR_TAGS = 557,                /* VAR_TAGS  */
-    VAR_RPZ_ACTION_OVERRIDE = 558, /* VAR_RPZ_ACTION_OVERRIDE  */
-    VAR_RPZ_CNAME_OVERRIDE = 559,  /* VAR_RPZ_CNAME_OVERRIDE  */
-    VAR_RPZ_LOG = 560,             /* VAR_RPZ_LOG  */
-    VAR_RPZ_LOG_NAME = 561,        /* VAR_RPZ_LOG_NAME  */
-    VAR_DYNLIB = 562,              /* VAR_DYNLIB  */
-    VAR_DYNLIB_FILE = 563,         /* VAR_DYNLIB_FILE  */
-    VAR_EDNS_CLIENT_STRING = 564,  /* VAR_EDNS_CLIENT_STRING  */
-    VAR_EDNS_CLIENT_STRING_OPCODE = 565, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
-    VAR_NSID = 566,                /* VAR_NSID  */
-    VAR_ZONEMD_PERMISSIVE_MODE = 567, /* VAR_ZONEMD_PERMISSIVE_MODE  */
-    VAR_ZONEMD_REJECT_ABSENCE = 568 /* VAR_ZONEMD_REJECT_ABSENCE  */
+    VAR_VAL_VERIFY_THREADS = 375,  /* VAR_VAL_VERIFY_THREADS  */
+    VAR_AUTO_TRUST_ANCHOR_FILE = 376, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+    VAR_KEEP_MISSING = 377,        /* VAR_KEEP_MISSING  */
+    VAR_ADD_HOLDDOWN = 378,        /* VAR_ADD_HOLDDOWN  */
+    VAR_DEL_HOLDDOWN = 379,        /* VAR_DEL_HOLDDOWN  */
+    VAR_SO_RCVBUF = 380,           /* VAR_SO_RCVBUF  */
+    VAR_EDNS_BUFFER_SIZE = 381,    /* VAR_EDNS_BUFFER_SIZE  */
+    VAR_PREFETCH = 382,            /* VAR_PREFETCH  */
+    VAR_PREFETCH_KEY = 383,        /* VAR_PREFETCH_KEY  */
+    VAR_SO_SNDBUF = 384,           /* VAR_SO_SNDBUF  */
+    VAR_SO_REUSEPORT = 385,        /* VAR_SO_REUSEPORT  */
+    VAR_HARDEN_BELOW_NXDOMAIN = 386, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+    VAR_IGNORE_CD_FLAG = 387,      /* VAR_IGNORE_CD_FLAG  */
+    VAR_LOG_QUERIES = 388,         /* VAR_LOG_QUERIES  */
+    VAR_LOG_REPLIES = 389,         /* VAR_LOG_REPLIES  */
+    VAR_LOG_LOCAL_ACTIONS = 390,   /* VAR_LOG_LOCAL_ACTIONS  */
+    VAR_TCP_UPSTREAM = 391,        /* VAR_TCP_UPSTREAM  */
+    VAR_SSL_UPSTREAM = 392,        /* VAR_SSL_UPSTREAM  */
+    VAR_TCP_AUTH_QUERY_TIMEOUT = 393, /* VAR_TCP_AUTH_QUERY_TIMEOUT  */
+    VAR_TCP_UPSTREAM_POOL = 394,   /* VAR_TCP_UPSTREAM_POOL  */
+    VAR_SSL_SERVICE_KEY = 395,     /* VAR_SSL_SERVICE_KEY  */
+    VAR_SSL_SERVICE_PEM = 396,     /* VAR_SSL_SERVICE_PEM  */
+    VAR_SSL_PORT = 397,            /* VAR_SSL_PORT  */
+    VAR_FORWARD_FIRST = 398,       /* VAR_FORWARD_FIRST  */
+    VAR_STUB_SSL_UPSTREAM = 399,   /* VAR_STUB_SSL_UPSTREAM  */
+    VAR_FORWARD_SSL_UPSTREAM = 400, /* VAR_FORWARD_SSL_UPSTREAM  */
+    VAR_TLS_CERT_BUNDLE = 401,     /* VAR_TLS_CERT_BUNDLE  */
+    VAR_HTTPS_PORT = 402,          /* VAR_HTTPS_PORT  */
+    VAR_HTTP_ENDPOINT = 403,       /* VAR_HTTP_ENDPOINT  */
+    VAR_HTTP_MAX_STREAMS = 404,    /* VAR_HTTP_MAX_STREAMS  */
+    VAR_HTTP_QUERY_BUFFER_SIZE = 405, /* VAR_HTTP_QUERY_BUFFER_SIZE  */
+    VAR_HTTP_RESPONSE_BUFFER_SIZE = 406, /* VAR_HTTP_RESPONSE_BUFFER_SIZE  */
+    VAR_HTTP_NODELAY = 407,        /* VAR_HTTP_NODELAY  */
+    VAR_HTTP_NOTLS_DOWNSTREAM = 408, /* VAR_HTTP_NOTLS_DOWNSTREAM  */
+    VAR_STUB_FIRST = 409,          /* VAR_STUB_FIRST  */
+    VAR_MINIMAL_RESPONSES = 410,   /* VAR_MINIMAL_RESPONSES  */
+    VAR_RRSET_ROUNDROBIN = 411,    /* VAR_RRSET_ROUNDROBIN  */
+    VAR_MAX_UDP_SIZE = 412,        /* VAR_MAX_UDP_SIZE  */
+    VAR_DELAY_CLOSE = 413,         /* VAR_DELAY_CLOSE  */
+    VAR_UDP_CONNECT = 414,         /* VAR_UDP_CONNECT  */
+    VAR_UDP_BATCH_SIZE = 415,      /* VAR_UDP_BATCH_SIZE  */
+    VAR_UNBLOCK_LAN_ZONES = 416,   /* VAR_UNBLOCK_LAN_ZONES  */
+    VAR_INSECURE_LAN_ZONES = 417,  /* VAR_INSECURE_LAN_ZONES  */
+    VAR_INFRA_CACHE_MIN_RTT = 418, /* VAR_INFRA_CACHE_MIN_RTT  */
+    VAR_INFRA_KEEP_PROBING = 419,  /* VAR_INFRA_KEEP_PROBING  */
+    VAR_UDP_HEDGE = 420,           /* VAR_UDP_HEDGE  */
+    VAR_UDP_HEDGE_PERCENTILE = 421, /* VAR_UDP_HEDGE_PERCENTILE  */
+    VAR_UDP_HEDGE_MAX_RATE = 422,  /* VAR_UDP_HEDGE_MAX_RATE  */
+    VAR_INFRA_SELECT_PERCENTILE = 423, /* VAR_INFRA_SELECT_PERCENTILE  */
+    VAR_UDP_UPSTREAM_BATCH = 424,  /* VAR_UDP_UPSTREAM_BATCH  */
+    VAR_UDP_CONNECT_POOL = 425,    /* VAR_UDP_CONNECT_POOL  */
+    VAR_UDP_CONNECT_REUSE = 426,   /* VAR_UDP_CONNECT_REUSE  */
+    VAR_USE_IO_URING = 427,        /* VAR_USE_IO_URING  */
+    VAR_DNS64_PREFIX = 428,        /* VAR_DNS64_PREFIX  */
+    VAR_DNS64_SYNTHALL = 429,      /* VAR_DNS64_SYNTHALL  */
+    VAR_DNS64_IGNORE_AAAA = 430,   /* VAR_DNS64_IGNORE_AAAA  */
+    VAR_DNSTAP = 431,              /* VAR_DNSTAP  */
+    VAR_DNSTAP_ENABLE = 432,       /* VAR_DNSTAP_ENABLE  */
+    VAR_DNSTAP_SOCKET_PATH = 433,  /* VAR_DNSTAP_SOCKET_PATH  */
+    VAR_DNSTAP_IP = 434,           /* VAR_DNSTAP_IP  */
+    VAR_DNSTAP_TLS = 435,          /* VAR_DNSTAP_TLS  */
+    VAR_DNSTAP_TLS_SERVER_NAME = 436, /* VAR_DNSTAP_TLS_SERVER_NAME  */
+    VAR_DNSTAP_TLS_CERT_BUNDLE = 437, /* VAR_DNSTAP_TLS_CERT_BUNDLE  */
+    VAR_DNSTAP_TLS_CLIENT_KEY_FILE = 438, /* VAR_DNSTAP_TLS_CLIENT_KEY_FILE  */
+    VAR_DNSTAP_TLS_CLIENT_CERT_FILE = 439, /* VAR_DNSTAP_TLS_CLIENT_CERT_FILE  */
+    VAR_DNSTAP_SEND_IDENTITY = 440, /* VAR_DNSTAP_SEND_IDENTITY  */
+    VAR_DNSTAP_SEND_VERSION = 441, /* VAR_DNSTAP_SEND_VERSION  */
+    VAR_DNSTAP_BIDIRECTIONAL = 442, /* VAR_DNSTAP_BIDIRECTIONAL  */
+    VAR_DNSTAP_IDENTITY = 443,     /* VAR_DNSTAP_IDENTITY  */
+    VAR_DNSTAP_VERSION = 444,      /* VAR_DNSTAP_VERSION  */
+    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 445, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 446, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 447, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 448, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 449, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 450, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+    VAR_RESPONSE_IP_TAG = 451,     /* VAR_RESPONSE_IP_TAG  */
+    VAR_RESPONSE_IP = 452,         /* VAR_RESPONSE_IP  */
+    VAR_RESPONSE_IP_DATA = 453,    /* VAR_RESPONSE_IP_DATA  */
+    VAR_HARDEN_ALGO_DOWNGRADE = 454, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+    VAR_IP_TRANSPARENT = 455,      /* VAR_IP_TRANSPARENT  */
+    VAR_IP_DSCP = 456,             /* VAR_IP_DSCP  */
+    VAR_DISABLE_DNSSEC_LAME_CHECK = 457, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+    VAR_IP_RATELIMIT = 458,        /* VAR_IP_RATELIMIT  */
+    VAR_IP_RATELIMIT_SLABS = 459,  /* VAR_IP_RATELIMIT_SLABS  */
+    VAR_IP_RATELIMIT_SIZE = 460,   /* VAR_IP_RATELIMIT_SIZE  */
+    VAR_RATELIMIT = 461,           /* VAR_RATELIMIT  */
+    VAR_RATELIMIT_SLABS = 462,     /* VAR_RATELIMIT_SLABS  */
+    VAR_RATELIMIT_SIZE = 463,      /* VAR_RATELIMIT_SIZE  */
+    VAR_RATELIMIT_FOR_DOMAIN = 464, /* VAR_RATELIMIT_FOR_DOMAIN  */
+    VAR_RATELIMIT_BELOW_DOMAIN = 465, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+    VAR_IP_RATELIMIT_FACTOR = 466, /* VAR_IP_RATELIMIT_FACTOR  */
+    VAR_RATELIMIT_FACTOR = 467,    /* VAR_RATELIMIT_FACTOR  */
+    VAR_SEND_CLIENT_SUBNET = 468,  /* VAR_SEND_CLIENT_SUBNET  */
+    VAR_CLIENT_SUBNET_ZONE = 469,  /* VAR_CLIENT_SUBNET_ZONE  */
+    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 470, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+    VAR_CLIENT_SUBNET_OPCODE = 471, /* VAR_CLIENT_SUBNET_OPCODE  */
+    VAR_MAX_CLIENT_SUBNET_IPV4 = 472, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+    VAR_MAX_CLIENT_SUBNET_IPV6 = 473, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+    VAR_MIN_CLIENT_SUBNET_IPV4 = 474, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
+    VAR_MIN_CLIENT_SUBNET_IPV6 = 475, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
+    VAR_MAX_ECS_TREE_SIZE_IPV4 = 476, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
+    VAR_MAX_ECS_TREE_SIZE_IPV6 = 477, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
+    VAR_CAPS_WHITELIST = 478,      /* VAR_CAPS_WHITELIST  */
+    VAR_CACHE_MAX_NEGATIVE_TTL = 479, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+    VAR_PERMIT_SMALL_HOLDDOWN = 480, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+    VAR_QNAME_MINIMISATION = 481,  /* VAR_QNAME_MINIMISATION  */
+    VAR_QNAME_MINIMISATION_STRICT = 482, /* VAR_QNAME_MINIMISATION_STRICT  */
+    VAR_IP_FREEBIND = 483,         /* VAR_IP_FREEBIND  */
+    VAR_DEFINE_TAG = 484,          /* VAR_DEFINE_TAG  */
+    VAR_LOCAL_ZONE_TAG = 485,      /* VAR_LOCAL_ZONE_TAG  */
+    VAR_ACCESS_CONTROL_TAG = 486,  /* VAR_ACCESS_CONTROL_TAG  */
+    VAR_LOCAL_ZONE_OVERRIDE = 487, /* VAR_LOCAL_ZONE_OVERRIDE  */
+    VAR_ACCESS_CONTROL_TAG_ACTION = 488, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+    VAR_ACCESS_CONTROL_TAG_DATA = 489, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+    VAR_VIEW = 490,                /* VAR_VIEW  */
+    VAR_ACCESS_CONTROL_VIEW = 491, /* VAR_ACCESS_CONTROL_VIEW  */
+    VAR_VIEW_FIRST = 492,          /* VAR_VIEW_FIRST  */
+    VAR_SERVE_EXPIRED = 493,       /* VAR_SERVE_EXPIRED  */
+    VAR_SERVE_EXPIRED_TTL = 494,   /* VAR_SERVE_EXPIRED_TTL  */
+    VAR_SERVE_EXPIRED_TTL_RESET = 495, /* VAR_SERVE_EXPIRED_TTL_RESET  */
+    VAR_SERVE_EXPIRED_REPLY_TTL = 496, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
+    VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 497, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
+    VAR_SERVE_ORIGINAL_TTL = 498,  /* VAR_SERVE_ORIGINAL_TTL  */
+    VAR_FAKE_DSA = 499,            /* VAR_FAKE_DSA  */
+    VAR_FAKE_SHA1 = 500,           /* VAR_FAKE_SHA1  */
+    VAR_LOG_IDENTITY = 501,        /* VAR_LOG_IDENTITY  */
+    VAR_HIDE_TRUSTANCHOR = 502,    /* VAR_HIDE_TRUSTANCHOR  */
+    VAR_TRUST_ANCHOR_SIGNALING = 503, /* VAR_TRUST_ANCHOR_SIGNALING  */
+    VAR_AGGRESSIVE_NSEC = 504,     /* VAR_AGGRESSIVE_NSEC  */
+    VAR_USE_SYSTEMD = 505,         /* VAR_USE_SYSTEMD  */
+    VAR_SHM_ENABLE = 506,          /* VAR_SHM_ENABLE  */
+    VAR_SHM_KEY = 507,             /* VAR_SHM_KEY  */
+    VAR_ROOT_KEY_SENTINEL = 508,   /* VAR_ROOT_KEY_SENTINEL  */
+    VAR_DNSCRYPT = 509,            /* VAR_DNSCRYPT  */
+    VAR_DNSCRYPT_ENABLE = 510,     /* VAR_DNSCRYPT_ENABLE  */
+    VAR_DNSCRYPT_PORT = 511,       /* VAR_DNSCRYPT_PORT  */
+    VAR_DNSCRYPT_PROVIDER = 512,   /* VAR_DNSCRYPT_PROVIDER  */
+    VAR_DNSCRYPT_SECRET_KEY = 513, /* VAR_DNSCRYPT_SECRET_KEY  */
+    VAR_DNSCRYPT_PROVIDER_CERT = 514, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 515, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 516, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 517, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 518, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 519, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+    VAR_PAD_RESPONSES = 520,       /* VAR_PAD_RESPONSES  */
+    VAR_PAD_RESPONSES_BLOCK_SIZE = 521, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
+    VAR_PAD_QUERIES = 522,         /* VAR_PAD_QUERIES  */
+    VAR_PAD_QUERIES_BLOCK_SIZE = 523, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
+    VAR_IPSECMOD_ENABLED = 524,    /* VAR_IPSECMOD_ENABLED  */
+    VAR_IPSECMOD_HOOK = 525,       /* VAR_IPSECMOD_HOOK  */
+    VAR_IPSECMOD_IGNORE_BOGUS = 526, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+    VAR_IPSECMOD_MAX_TTL = 527,    /* VAR_IPSECMOD_MAX_TTL  */
+    VAR_IPSECMOD_WHITELIST = 528,  /* VAR_IPSECMOD_WHITELIST  */
+    VAR_IPSECMOD_STRICT = 529,     /* VAR_IPSECMOD_STRICT  */
+    VAR_CACHEDB = 530,             /* VAR_CACHEDB  */
+    VAR_CACHEDB_BACKEND = 531,     /* VAR_CACHEDB_BACKEND  */
+    VAR_CACHEDB_SECRETSEED = 532,  /* VAR_CACHEDB_SECRETSEED  */
+    VAR_CACHEDB_REDISHOST = 533,   /* VAR_CACHEDB_REDISHOST  */
+    VAR_CACHEDB_REDISPORT = 534,   /* VAR_CACHEDB_REDISPORT  */
+    VAR_CACHEDB_REDISTIMEOUT = 535, /* VAR_CACHEDB_REDISTIMEOUT  */
+    VAR_CACHEDB_REDISEXPIRERECORDS = 536, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
+    VAR_CACHEDB_REDISASYNC = 537,  /* VAR_CACHEDB_REDISASYNC  */
+    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 538, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+    VAR_FOR_UPSTREAM = 539,        /* VAR_FOR_UPSTREAM  */
+    VAR_AUTH_ZONE = 540,           /* VAR_AUTH_ZONE  */
+    VAR_ZONEFILE = 541,            /* VAR_ZONEFILE  */
+    VAR_MASTER = 542,              /* VAR_MASTER  */
+    VAR_URL = 543,                 /* VAR_URL  */
+    VAR_FOR_DOWNSTREAM = 544,      /* VAR_FOR_DOWNSTREAM  */
+    VAR_FALLBACK_ENABLED = 545,    /* VAR_FALLBACK_ENABLED  */
+    VAR_TLS_ADDITIONAL_PORT = 546, /* VAR_TLS_ADDITIONAL_PORT  */
+    VAR_LOW_RTT = 547,             /* VAR_LOW_RTT  */
+    VAR_LOW_RTT_PERMIL = 548,      /* VAR_LOW_RTT_PERMIL  */
+    VAR_FAST_SERVER_PERMIL = 549,  /* VAR_FAST_SERVER_PERMIL  */
+    VAR_FAST_SERVER_NUM = 550,     /* VAR_FAST_SERVER_NUM  */
+    VAR_ALLOW_NOTIFY = 551,        /* VAR_ALLOW_NOTIFY  */
+    VAR_TLS_WIN_CERT = 552,        /* VAR_TLS_WIN_CERT  */
+    VAR_TCP_CONNECTION_LIMIT = 553, /* VAR_TCP_CONNECTION_LIMIT  */
+    VAR_FORWARD_NO_CACHE = 554,    /* VAR_FORWARD_NO_CACHE  */
+    VAR_STUB_NO_CACHE = 555,       /* VAR_STUB_NO_CACHE  */
+    VAR_LOG_SERVFAIL = 556,        /* VAR_LOG_SERVFAIL  */
+    VAR_DENY_ANY = 557,            /* VAR_DENY_ANY  */
+    VAR_UNKNOWN_SERVER_TIME_LIMIT = 558, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
+    VAR_LOG_TAG_QUERYREPLY = 559,  /* VAR_LOG_TAG_QUERYREPLY  */
+    VAR_STREAM_WAIT_SIZE = 560,    /* VAR_STREAM_WAIT_SIZE  */
+    VAR_TLS_CIPHERS = 561,         /* VAR_TLS_CIPHERS  */
+    VAR_TLS_CIPHERSUITES = 562,    /* VAR_TLS_CIPHERSUITES  */
+    VAR_TLS_USE_SNI = 563,         /* VAR_TLS_USE_SNI  */
+    VAR_TLS_UPSTREAM_RESUME = 564, /* VAR_TLS_UPSTREAM_RESUME  */
+    VAR_TLS_UPSTREAM_EARLY_DATA = 565, /* VAR_TLS_UPSTREAM_EARLY_DATA  */
+    VAR_TLS_USE_KTLS = 566,        /* VAR_TLS_USE_KTLS  */
+    VAR_SHARED_INFLIGHT = 567,     /* VAR_SHARED_INFLIGHT  */
+    VAR_PRIORITY_CLASS = 568,      /* VAR_PRIORITY_CLASS  */
+    VAR_ACCESS_CONTROL_PRIORITY_CLASS = 569, /* VAR_ACCESS_CONTROL_PRIORITY_CLASS  */
+    VAR_WORKER_CPU_AFFINITY = 570, /* VAR_WORKER_CPU_AFFINITY  */
+    VAR_NUMA_AWARE = 571,          /* VAR_NUMA_AWARE  */
+    VAR_IPSET = 572,               /* VAR_IPSET  */
+    VAR_IPSET_NAME_V4 = 573,       /* VAR_IPSET_NAME_V4  */
+    VAR_IPSET_NAME_V6 = 574,       /* VAR_IPSET_NAME_V6  */
+    VAR_TLS_SESSION_TICKET_KEYS = 575, /* VAR_TLS_SESSION_TICKET_KEYS  */
+    VAR_RPZ = 576,                 /* VAR_RPZ  */
+    VAR_TAGS = 577,                /* VAR_TAGS  */
+    VAR_RPZ_ACTION_OVERRIDE = 578, /* VAR_RPZ_ACTION_OVERRIDE  */
+    VAR_RPZ_CNAME_OVERRIDE = 579,  /* VAR_RPZ_CNAME_OVERRIDE  */
+    VAR_RPZ_LOG = 580,             /* VAR_RPZ_LOG  */
+    VAR_RPZ_LOG_NAME = 581,        /* VAR_RPZ_LOG_NAME  */
+    VAR_DYNLIB = 582,              /* VAR_DYNLIB  */
+    VAR_DYNLIB_FILE = 583,         /* VAR_DYNLIB_FILE  */
+    VAR_EDNS_CLIENT_STRING = 584,  /* VAR_EDNS_CLIENT_STRING  */
+    VAR_EDNS_CLIENT_STRING_OPCODE = 585, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
+    VAR_NSID = 586,                /* VAR_NSID  */
+    VAR_ZONEMD_PERMISSIVE_MODE = 587, /* VAR_ZONEMD_PERMISSIVE_MODE  */
+    VAR_ZONEMD_REJECT_ABSENCE = 588, /* VAR_ZONEMD_REJECT_ABSENCE  */
+    VAR_CACHE_SNAPSHOT_FILE = 589, /* VAR_CACHE_SNAPSHOT_FILE  */
+    VAR_MSG_CACHE_POLICY = 590,    /* VAR_MSG_CACHE_POLICY  */
+    VAR_RRSET_CACHE_POLICY = 591,  /* VAR_RRSET_CACHE_POLICY  */
+    VAR_INFRA_CACHE_POLICY = 592,  /* VAR_INFRA_CACHE_POLICY  */
+    VAR_KEY_CACHE_POLICY = 593,    /* VAR_KEY_CACHE_POLICY  */
+    VAR_MSG_CACHE_WIRE_IMAGE = 594 /* VAR_MSG_CACHE_WIRE_IMAGE  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
 /* Token kinds.  */
+#define YYEMPTY -2
 #define YYEOF 0
 #define YYerror 256
 #define YYUNDEF 257
@@ -489,200 +516,226 @@ extern int yydebug;
 #define VAR_VAL_SIG_SKEW_MAX 372
 #define VAR_CACHE_MIN_TTL 373
 #define VAR_VAL_LOG_LEVEL 374
-#define VAR_AUTO_TRUST_ANCHOR_FILE 375
-#define VAR_KEEP_MISSING 376
-#define VAR_ADD_HOLDDOWN 377
-#define VAR_DEL_HOLDDOWN 378
-#define VAR_SO_RCVBUF 379
-#define VAR_EDNS_BUFFER_SIZE 380
-#define VAR_PREFETCH 381
-#define VAR_PREFETCH_KEY 382
-#define VAR_SO_SNDBUF 383
-#define VAR_SO_REUSEPORT 384
-#define VAR_HARDEN_BELOW_NXDOMAIN 385
-#define VAR_IGNORE_CD_FLAG 386
-#define VAR_LOG_QUERIES 387
-#define VAR_LOG_REPLIES 388
-#define VAR_LOG_LOCAL_ACTIONS 389
-#define VAR_TCP_UPSTREAM 390
-#define VAR_SSL_UPSTREAM 391
-#define VAR_TCP_AUTH_QUERY_TIMEOUT 392
-#define VAR_SSL_SERVICE_KEY 393
-#define VAR_SSL_SERVICE_PEM 394
-#define VAR_SSL_PORT 395
-#define VAR_FORWARD_FIRST 396
-#define VAR_STUB_SSL_UPSTREAM 397
-#define VAR_FORWARD_SSL_UPSTREAM 398
-#define VAR_TLS_CERT_BUNDLE 399
-#define VAR_HTTPS_PORT 400
-#define VAR_HTTP_ENDPOINT 401
-#define VAR_HTTP_MAX_STREAMS 402
-#define VAR_HTTP_QUERY_BUFFER_SIZE 403
-#define VAR_HTTP_RESPONSE_BUFFER_SIZE 404
-#define VAR_HTTP_NODELAY 405
-#define VAR_HTTP_NOTLS_DOWNSTREAM 406
-#define VAR_STUB_FIRST 407
-#define VAR_MINIMAL_RESPONSES 408
-#define VAR_RRSET_ROUNDROBIN 409
-#define VAR_MAX_UDP_SIZE 410
-#define VAR_DELAY_CLOSE 411
-#define VAR_UDP_CONNECT 412
-#define VAR_UNBLOCK_LAN_ZONES 413
-#define VAR_INSECURE_LAN_ZONES 414
-#define VAR_INFRA_CACHE_MIN_RTT 415
-#define VAR_INFRA_KEEP_PROBING 416
-#define VAR_DNS64_PREFIX 417
-#define VAR_DNS64_SYNTHALL 418
-#define VAR_DNS64_IGNORE_AAAA 419
-#define VAR_DNSTAP 420
-#define VAR_DNSTAP_ENABLE 421
-#define VAR_DNSTAP_SOCKET_PATH 422
-#define VAR_DNSTAP_IP 423
-#define VAR_DNSTAP_TLS 424
-#define VAR_DNSTAP_TLS_SERVER_NAME 425
-#define VAR_DNSTAP_TLS_CERT_BUNDLE 426
-#define VAR_DNSTAP_TLS_CLIENT_KEY_FILE 427
-#define VAR_DNSTAP_TLS_CLIENT_CERT_FILE 428
-#define VAR_DNSTAP_SEND_IDENTITY 429
-#define VAR_DNSTAP_SEND_VERSION 430
-#define VAR_DNSTAP_BIDIRECTIONAL 431
-#define VAR_DNSTAP_IDENTITY 432
-#define VAR_DNSTAP_VERSION 433
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 434
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 435
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 436
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 437
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 438
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 439
-#define VAR_RESPONSE_IP_TAG 440
-#define VAR_RESPONSE_IP 441
-#define VAR_RESPONSE_IP_DATA 442
-#define VAR_HARDEN_ALGO_DOWNGRADE 443
-#define VAR_IP_TRANSPARENT 444
-#define VAR_IP_DSCP 445
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 446
-#define VAR_IP_RATELIMIT 447
-#define VAR_IP_RATELIMIT_SLABS 448
-#define VAR_IP_RATELIMIT_SIZE 449
-#define VAR_RATELIMIT 450
-#define VAR_RATELIMIT_SLABS 451
-#define VAR_RATELIMIT_SIZE 452
-#define VAR_RATELIMIT_FOR_DOMAIN 453
-#define VAR_RATELIMIT_BELOW_DOMAIN 454
-#define VAR_IP_RATELIMIT_FACTOR 455
-#define VAR_RATELIMIT_FACTOR 456
-#define VAR_SEND_CLIENT_SUBNET 457
-#define VAR_CLIENT_SUBNET_ZONE 458
-#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 459
-#define VAR_CLIENT_SUBNET_OPCODE 460
-#define VAR_MAX_CLIENT_SUBNET_IPV4 461
-#define VAR_MAX_CLIENT_SUBNET_IPV6 462
-#define VAR_MIN_CLIENT_SUBNET_IPV4 463
-#define VAR_MIN_CLIENT_SUBNET_IPV6 464
-#define VAR_MAX_ECS_TREE_SIZE_IPV4 465
-#define VAR_MAX_ECS_TREE_SIZE_IPV6 466
-#define VAR_CAPS_WHITELIST 467
-#define VAR_CACHE_MAX_NEGATIVE_TTL 468
-#define VAR_PERMIT_SMALL_HOLDDOWN 469
-#define VAR_QNAME_MINIMISATION 470
-#define VAR_QNAME_MINIMISATION_STRICT 471
-#define VAR_IP_FREEBIND 472
-#define VAR_DEFINE_TAG 473
-#define VAR_LOCAL_ZONE_TAG 474
-#define VAR_ACCESS_CONTROL_TAG 475
-#define VAR_LOCAL_ZONE_OVERRIDE 476
-#define VAR_ACCESS_CONTROL_TAG_ACTION 477
-#define VAR_ACCESS_CONTROL_TAG_DATA 478
-#define VAR_VIEW 479
-#define VAR_ACCESS_CONTROL_VIEW 480
-#define VAR_VIEW_FIRST 481
-#define VAR_SERVE_EXPIRED 482
-#define VAR_SERVE_EXPIRED_TTL 483
-#define VAR_SERVE_EXPIRED_TTL_RESET 484
-#define VAR_SERVE_EXPIRED_REPLY_TTL 485
-#define VAR_SERVE_EXPIRED_CLIENT_TIMEOUT 486
-#define VAR_SERVE_ORIGINAL_TTL 487
-#define VAR_FAKE_DSA 488
-#define VAR_FAKE_SHA1 489
-#define VAR_LOG_IDENTITY 490
-#define VAR_HIDE_TRUSTANCHOR 491
-#define VAR_TRUST_ANCHOR_SIGNALING 492
-#define VAR_AGGRESSIVE_NSEC 493
-#define VAR_USE_SYSTEMD 494
-#define VAR_SHM_ENABLE 495
-#define VAR_SHM_KEY 496
-#define VAR_ROOT_KEY_SENTINEL 497
-#define VAR_DNSCRYPT 498
-#define VAR_DNSCRYPT_ENABLE 499
-#define VAR_DNSCRYPT_PORT 500
-#define VAR_DNSCRYPT_PROVIDER 501
-#define VAR_DNSCRYPT_SECRET_KEY 502
-#define VAR_DNSCRYPT_PROVIDER_CERT 503
-#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 504
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 505
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 506
-#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 507
-#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 508
-#define VAR_PAD_RESPONSES 509
-#define VAR_PAD_RESPONSES_BLOCK_SIZE 510
-#define VAR_PAD_QUERIES 511
-#define VAR_PAD_QUERIES_BLOCK_SIZE 512
-#define VAR_IPSECMOD_ENABLED 513
-#define VAR_IPSECMOD_HOOK 514
-#define VAR_IPSECMOD_IGNORE_BOGUS 515
-#define VAR_IPSECMOD_MAX_TTL 516
-#define VAR_IPSECMOD_WHITELIST 517
-#define VAR_IPSECMOD_STRICT 518
-#define VAR_CACHEDB 519
-#define VAR_CACHEDB_BACKEND 520
-#define VAR_CACHEDB_SECRETSEED 521
-#define VAR_CACHEDB_REDISHOST 522
-#define VAR_CACHEDB_REDISPORT 523
-#define VAR_CACHEDB_REDISTIMEOUT 524
-#define VAR_CACHEDB_REDISEXPIRERECORDS 525
-#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 526
-#define VAR_FOR_UPSTREAM 527
-#define VAR_AUTH_ZONE 528
-#define VAR_ZONEFILE 529
-#define VAR_MASTER 530
-#define VAR_URL 531
-#define VAR_FOR_DOWNSTREAM 532
-#define VAR_FALLBACK_ENABLED 533
-#define VAR_TLS_ADDITIONAL_PORT 534
-#define VAR_LOW_RTT 535
-#define VAR_LOW_RTT_PERMIL 536
-#define VAR_FAST_SERVER_PERMIL 537
-#define VAR_FAST_SERVER_NUM 538
-#define VAR_ALLOW_NOTIFY 539
-#define VAR_TLS_WIN_CERT 540
-#define VAR_TCP_CONNECTION_LIMIT 541
-#define VAR_FORWARD_NO_CACHE 542
-#define VAR_STUB_NO_CACHE 543
-#define VAR_LOG_SERVFAIL 544
-#define VAR_DENY_ANY 545
-#define VAR_UNKNOWN_SERVER_TIME_LIMIT 546
-#define VAR_LOG_TAG_QUERYREPLY 547
-#define VAR_STREAM_WAIT_SIZE 548
-#define VAR_TLS_CIPHERS 549
-#define VAR_TLS_CIPHERSUITES 550
-#define VAR_TLS_USE_SNI 551
-#define VAR_IPSET 552
-#define VAR_IPSET_NAME_V4 553
-#define VAR_IPSET_NAME_V6 554
-#define VAR_TLS_SESSION_TICKET_KEYS 555
-#define VAR_RPZ 556
-#define VAR_TAGS 557
-#define VAR_RPZ_ACTION_OVERRIDE 558
-#define VAR_RPZ_CNAME_OVERRIDE 559
-#define VAR_RPZ_LOG 560
-#define VAR_RPZ_LOG_NAME 561
-#define VAR_DYNLIB 562
-#define VAR_DYNLIB_FILE 563
-#define VAR_EDNS_CLIENT_STRING 564
-#define VAR_EDNS_CLIENT_STRING_OPCODE 565
-#define VAR_NSID 566
-#define VAR_ZONEMD_PERMISSIVE_MODE 567
-#define VAR_ZONEMD_REJECT_ABSENCE 568
+#define VAR_VAL_VERIFY_THREADS 375
+#define VAR_AUTO_TRUST_ANCHOR_FILE 376
+#define VAR_KEEP_MISSING 377
+#define VAR_ADD_HOLDDOWN 378
+#define VAR_DEL_HOLDDOWN 379
+#define VAR_SO_RCVBUF 380
+#define VAR_EDNS_BUFFER_SIZE 381
+#define VAR_PREFETCH 382
+#define VAR_PREFETCH_KEY 383
+#define VAR_SO_SNDBUF 384
+#define VAR_SO_REUSEPORT 385
+#define VAR_HARDEN_BELOW_NXDOMAIN 386
+#define VAR_IGNORE_CD_FLAG 387
+#define VAR_LOG_QUERIES 388
+#define VAR_LOG_REPLIES 389
+#define VAR_LOG_LOCAL_ACTIONS 390
+#define VAR_TCP_UPSTREAM 391
+#define VAR_SSL_UPSTREAM 392
+#define VAR_TCP_AUTH_QUERY_TIMEOUT 393
+#define VAR_TCP_UPSTREAM_POOL 394
+#define VAR_SSL_SERVICE_KEY 395
+#define VAR_SSL_SERVICE_PEM 396
+#define VAR_SSL_PORT 397
+#define VAR_FORWARD_FIRST 398
+#define VAR_STUB_SSL_UPSTREAM 399
+#define VAR_FORWARD_SSL_UPSTREAM 400
+#define VAR_TLS_CERT_BUNDLE 401
+#define VAR_HTTPS_PORT 402
+#define VAR_HTTP_ENDPOINT 403
+#define VAR_HTTP_MAX_STREAMS 404
+#define VAR_HTTP_QUERY_BUFFER_SIZE 405
+#define VAR_HTTP_RESPONSE_BUFFER_SIZE 406
+#define VAR_HTTP_NODELAY 407
+#define VAR_HTTP_NOTLS_DOWNSTREAM 408
+#define VAR_STUB_FIRST 409
+#define VAR_MINIMAL_RESPONSES 410
+#define VAR_RRSET_ROUNDROBIN 411
+#define VAR_MAX_UDP_SIZE 412
+#define VAR_DELAY_CLOSE 413
+#define VAR_UDP_CONNECT 414
+#define VAR_UDP_BATCH_SIZE 415
+#define VAR_UNBLOCK_LAN_ZONES 416
+#define VAR_INSECURE_LAN_ZONES 417
+#define VAR_INFRA_CACHE_MIN_RTT 418
+#define VAR_INFRA_KEEP_PROBING 419
+#define VAR_UDP_HEDGE 420
+#define VAR_UDP_HEDGE_PERCENTILE 421
+#define VAR_UDP_HEDGE_MAX_RATE 422
+#define VAR_INFRA_SELECT_PERCENTILE 423
+#define VAR_UDP_UPSTREAM_BATCH 424
+#define VAR_UDP_CONNECT_POOL 425
+#define VAR_UDP_CONNECT_REUSE 426
+#define VAR_USE_IO_URING 427
+#define VAR_DNS64_PREFIX 428
+#define VAR_DNS64_SYNTHALL 429
+#define VAR_DNS64_IGNORE_AAAA 430
+#define VAR_DNSTAP 431
+#define VAR_DNSTAP_ENABLE 432
+#define VAR_DNSTAP_SOCKET_PATH 433
+#define VAR_DNSTAP_IP 434
+#define VAR_DNSTAP_TLS 435
+#define VAR_DNSTAP_TLS_SERVER_NAME 436
+#define VAR_DNSTAP_TLS_CERT_BUNDLE 437
+#define VAR_DNSTAP_TLS_CLIENT_KEY_FILE 438
+#define VAR_DNSTAP_TLS_CLIENT_CERT_FILE 439
+#define VAR_DNSTAP_SEND_IDENTITY 440
+#define VAR_DNSTAP_SEND_VERSION 441
+#define VAR_DNSTAP_BIDIRECTIONAL 442
+#define VAR_DNSTAP_IDENTITY 443
+#define VAR_DNSTAP_VERSION 444
+#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 445
+#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 446
+#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 447
+#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 448
+#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 449
+#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 450
+#define VAR_RESPONSE_IP_TAG 451
+#define VAR_RESPONSE_IP 452
+#define VAR_RESPONSE_IP_DATA 453
+#define VAR_HARDEN_ALGO_DOWNGRADE 454
+#define VAR_IP_TRANSPARENT 455
+#define VAR_IP_DSCP 456
+#define VAR_DISABLE_DNSSEC_LAME_CHECK 457
+#define VAR_IP_RATELIMIT 458
+#define VAR_IP_RATELIMIT_SLABS 459
+#define VAR_IP_RATELIMIT_SIZE 460
+#define VAR_RATELIMIT 461
+#define VAR_RATELIMIT_SLABS 462
+#define VAR_RATELIMIT_SIZE 463
+#define VAR_RATELIMIT_FOR_DOMAIN 464
+#define VAR_RATELIMIT_BELOW_DOMAIN 465
+#define VAR_IP_RATELIMIT_FACTOR 466
+#define VAR_RATELIMIT_FACTOR 467
+#define VAR_SEND_CLIENT_SUBNET 468
+#define VAR_CLIENT_SUBNET_ZONE 469
+#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 470
+#define VAR_CLIENT_SUBNET_OPCODE 471
+#define VAR_MAX_CLIENT_SUBNET_IPV4 472
+#define VAR_MAX_CLIENT_SUBNET_IPV6 473
+#define VAR_MIN_CLIENT_SUBNET_IPV4 474
+#define VAR_MIN_CLIENT_SUBNET_IPV6 475
+#define VAR_MAX_ECS_TREE_SIZE_IPV4 476
+#define VAR_MAX_ECS_TREE_SIZE_IPV6 477
+#define VAR_CAPS_WHITELIST 478
+#define VAR_CACHE_MAX_NEGATIVE_TTL 479
+#define VAR_PERMIT_SMALL_HOLDDOWN 480
+#define VAR_QNAME_MINIMISATION 481
+#define VAR_QNAME_MINIMISATION_STRICT 482
+#define VAR_IP_FREEBIND 483
+#define VAR_DEFINE_TAG 484
+#define VAR_LOCAL_ZONE_TAG 485
+#define VAR_ACCESS_CONTROL_TAG 486
+#define VAR_LOCAL_ZONE_OVERRIDE 487
+#define VAR_ACCESS_CONTROL_TAG_ACTION 488
+#define VAR_ACCESS_CONTROL_TAG_DATA 489
+#define VAR_VIEW 490
+#define VAR_ACCESS_CONTROL_VIEW 491
+#define VAR_VIEW_FIRST 492
+#define VAR_SERVE_EXPIRED 493
+#define VAR_SERVE_EXPIRED_TTL 494
+#define VAR_SERVE_EXPIRED_TTL_RESET 495
+#define VAR_SERVE_EXPIRED_REPLY_TTL 496
+#define VAR_SERVE_EXPIRED_CLIENT_TIMEOUT 497
+#define VAR_SERVE_ORIGINAL_TTL 498
+#define VAR_FAKE_DSA 499
+#define VAR_FAKE_SHA1 500
+#define VAR_LOG_IDENTITY 501
+#define VAR_HIDE_TRUSTANCHOR 502
+#define VAR_TRUST_ANCHOR_SIGNALING 503
+#define VAR_AGGRESSIVE_NSEC 504
+#define VAR_USE_SYSTEMD 505
+#define VAR_SHM_ENABLE 506
+#define VAR_SHM_KEY 507
+#define VAR_ROOT_KEY_SENTINEL 508
+#define VAR_DNSCRYPT 509
+#define VAR_DNSCRYPT_ENABLE 510
+#define VAR_DNSCRYPT_PORT 511
+#define VAR_DNSCRYPT_PROVIDER 512
+#define VAR_DNSCRYPT_SECRET_KEY 513
+#define VAR_DNSCRYPT_PROVIDER_CERT 514
+#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 515
+#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 516
+#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 517
+#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 518
+#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 519
+#define VAR_PAD_RESPONSES 520
+#define VAR_PAD_RESPONSES_BLOCK_SIZE 521
+#define VAR_PAD_QUERIES 522
+#define VAR_PAD_QUERIES_BLOCK_SIZE 523
+#define VAR_IPSECMOD_ENABLED 524
+#define VAR_IPSECMOD_HOOK 525
+#define VAR_IPSECMOD_IGNORE_BOGUS 526
+#define VAR_IPSECMOD_MAX_TTL 527
+#define VAR_IPSECMOD_WHITELIST 528
+#define VAR_IPSECMOD_STRICT 529
+#define VAR_CACHEDB 530
+#define VAR_CACHEDB_BACKEND 531
+#define VAR_CACHEDB_SECRETSEED 532
+#define VAR_CACHEDB_REDISHOST 533
+#define VAR_CACHEDB_REDISPORT 534
+#define VAR_CACHEDB_REDISTIMEOUT 535
+#define VAR_CACHEDB_REDISEXPIRERECORDS 536
+#define VAR_CACHEDB_REDISASYNC 537
+#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 538
+#define VAR_FOR_UPSTREAM 539
+#define VAR_AUTH_ZONE 540
+#define VAR_ZONEFILE 541
+#define VAR_MASTER 542
+#define VAR_URL 543
+#define VAR_FOR_DOWNSTREAM 544
+#define VAR_FALLBACK_ENABLED 545
+#define VAR_TLS_ADDITIONAL_PORT 546
+#define VAR_LOW_RTT 547
+#define VAR_LOW_RTT_PERMIL 548
+#define VAR_FAST_SERVER_PERMIL 549
+#define VAR_FAST_SERVER_NUM 550
+#define VAR_ALLOW_NOTIFY 551
+#define VAR_TLS_WIN_CERT 552
+#define VAR_TCP_CONNECTION_LIMIT 553
+#define VAR_FORWARD_NO_CACHE 554
+#define VAR_STUB_NO_CACHE 555
+#define VAR_LOG_SERVFAIL 556
+#define VAR_DENY_ANY 557
+#define VAR_UNKNOWN_SERVER_TIME_LIMIT 558
+#define VAR_LOG_TAG_QUERYREPLY 559
+#define VAR_STREAM_WAIT_SIZE 560
+#define VAR_TLS_CIPHERS 561
+#define VAR_TLS_CIPHERSUITES 562
+#define VAR_TLS_USE_SNI 563
+#define VAR_TLS_UPSTREAM_RESUME 564
+#define VAR_TLS_UPSTREAM_EARLY_DATA 565
+#define VAR_TLS_USE_KTLS 566
+#define VAR_SHARED_INFLIGHT 567
+#define VAR_PRIORITY_CLASS 568
+#define VAR_ACCESS_CONTROL_PRIORITY_CLASS 569
+#define VAR_WORKER_CPU_AFFINITY 570
+#define VAR_NUMA_AWARE 571
+#define VAR_IPSET 572
+#define VAR_IPSET_NAME_V4 573
+#define VAR_IPSET_NAME_V6 574
+#define VAR_TLS_SESSION_TICKET_KEYS 575
+#define VAR_RPZ 576
+#define VAR_TAGS 577
+#define VAR_RPZ_ACTION_OVERRIDE 578
+#define VAR_RPZ_CNAME_OVERRIDE 579
+#define VAR_RPZ_LOG 580
+#define VAR_RPZ_LOG_NAME 581
+#define VAR_DYNLIB 582
+#define VAR_DYNLIB_FILE 583
+#define VAR_EDNS_CLIENT_STRING 584
+#define VAR_EDNS_CLIENT_STRING_OPCODE 585
+#define VAR_NSID 586
+#define VAR_ZONEMD_PERMISSIVE_MODE 587
+#define VAR_ZONEMD_REJECT_ABSENCE 588
+#define VAR_CACHE_SNAPSHOT_FILE 589
+#define VAR_MSG_CACHE_POLICY 590
+#define VAR_RRSET_CACHE_POLICY 591
+#define VAR_INFRA_CACHE_POLICY 592
+#define VAR_KEY_CACHE_POLICY 593
+#define VAR_MSG_CACHE_WIRE_IMAGE 594
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -692,7 +745,7 @@ union YYSTYPE
 
 	char*	str;
 
-#line 696 "util/configparser.h"
+#line 749 "util/configparser.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -703,6 +756,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
@@ -105,20 +105,25 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_STUB_PRIME VAR_UNWANTED_REPLY_THRESHOLD VAR_LOG_TIME_ASCII
 %token VAR_DOMAIN_INSECURE VAR_PYTHON VAR_PYTHON_SCRIPT VAR_VAL_SIG_SKEW_MIN
 %token VAR_VAL_SIG_SKEW_MAX VAR_CACHE_MIN_TTL VAR_VAL_LOG_LEVEL
+%token VAR_VAL_VERIFY_THREADS
 %token VAR_AUTO_TRUST_ANCHOR_FILE VAR_KEEP_MISSING VAR_ADD_HOLDDOWN 
 %token VAR_DEL_HOLDDOWN VAR_SO_RCVBUF VAR_EDNS_BUFFER_SIZE VAR_PREFETCH
 %token VAR_PREFETCH_KEY VAR_SO_SNDBUF VAR_SO_REUSEPORT VAR_HARDEN_BELOW_NXDOMAIN
 %token VAR_IGNORE_CD_FLAG VAR_LOG_QUERIES VAR_LOG_REPLIES VAR_LOG_LOCAL_ACTIONS
 %token VAR_TCP_UPSTREAM VAR_SSL_UPSTREAM VAR_TCP_AUTH_QUERY_TIMEOUT
+%token VAR_TCP_UPSTREAM_POOL
 %token VAR_SSL_SERVICE_KEY VAR_SSL_SERVICE_PEM VAR_SSL_PORT VAR_FORWARD_FIRST
 %token VAR_STUB_SSL_UPSTREAM VAR_FORWARD_SSL_UPSTREAM VAR_TLS_CERT_BUNDLE
 %token VAR_HTTPS_PORT VAR_HTTP_ENDPOINT VAR_HTTP_MAX_STREAMS
 %token VAR_HTTP_QUERY_BUFFER_SIZE VAR_HTTP_RESPONSE_BUFFER_SIZE
 %token VAR_HTTP_NODELAY VAR_HTTP_NOTLS_DOWNSTREAM
 %token VAR_STUB_FIRST VAR_MINIMAL_RESPONSES VAR_RRSET_ROUNDROBIN
-%token VAR_MAX_UDP_SIZE VAR_DELAY_CLOSE VAR_UDP_CONNECT
+%token VAR_MAX_UDP_SIZE VAR_DELAY_CLOSE VAR_UDP_CONNECT VAR_UDP_BATCH_SIZE
 %token VAR_UNBLOCK_LAN_ZONES VAR_INSECURE_LAN_ZONES
 %token VAR_INFRA_CACHE_MIN_RTT VAR_INFRA_KEEP_PROBING
+%token VAR_UDP_HEDGE VAR_UDP_HEDGE_PERCENTILE VAR_UDP_HEDGE_MAX_RATE
+%token VAR_INFRA_SELECT_PERCENTILE VAR_UDP_UPSTREAM_BATCH
+%token VAR_UDP_CONNECT_POOL VAR_UDP_CONNECT_REUSE VAR_USE_IO_URING
 %token VAR_DNS64_PREFIX VAR_DNS64_SYNTHALL VAR_DNS64_IGNORE_AAAA
 %token VAR_DNSTAP VAR_DNSTAP_ENABLE VAR_DNSTAP_SOCKET_PATH VAR_DNSTAP_IP
 %token VAR_DNSTAP_TLS VAR_DNSTAP_TLS_SERVER_NAME VAR_DNSTAP_TLS_CERT_BUNDLE
@@ -168,7 +173,7 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_IPSECMOD_MAX_TTL VAR_IPSECMOD_WHITELIST VAR_IPSECMOD_STRICT
 %token VAR_CACHEDB VAR_CACHEDB_BACKEND VAR_CACHEDB_SECRETSEED
 %token VAR_CACHEDB_REDISHOST VAR_CACHEDB_REDISPORT VAR_CACHEDB_REDISTIMEOUT
-%token VAR_CACHEDB_REDISEXPIRERECORDS
+%token VAR_CACHEDB_REDISEXPIRERECORDS VAR_CACHEDB_REDISASYNC
 %token VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM VAR_FOR_UPSTREAM
 %token VAR_AUTH_ZONE VAR_ZONEFILE VAR_MASTER VAR_URL VAR_FOR_DOWNSTREAM
 %token VAR_FALLBACK_ENABLED VAR_TLS_ADDITIONAL_PORT VAR_LOW_RTT VAR_LOW_RTT_PERMIL
@@ -177,12 +182,17 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_FORWARD_NO_CACHE VAR_STUB_NO_CACHE VAR_LOG_SERVFAIL VAR_DENY_ANY
 %token VAR_UNKNOWN_SERVER_TIME_LIMIT VAR_LOG_TAG_QUERYREPLY
 %token VAR_STREAM_WAIT_SIZE VAR_TLS_CIPHERS VAR_TLS_CIPHERSUITES VAR_TLS_USE_SNI
+%token VAR_TLS_UPSTREAM_RESUME VAR_TLS_UPSTREAM_EARLY_DATA VAR_TLS_USE_KTLS
+%token VAR_SHARED_INFLIGHT VAR_PRIORITY_CLASS VAR_ACCESS_CONTROL_PRIORITY_CLASS
+%token VAR_WORKER_CPU_AFFINITY VAR_NUMA_AWARE
 %token VAR_IPSET VAR_IPSET_NAME_V4 VAR_IPSET_NAME_V6
 %token VAR_TLS_SESSION_TICKET_KEYS VAR_RPZ VAR_TAGS VAR_RPZ_ACTION_OVERRIDE
 %token VAR_RPZ_CNAME_OVERRIDE VAR_RPZ_LOG VAR_RPZ_LOG_NAME
 %token VAR_DYNLIB VAR_DYNLIB_FILE VAR_EDNS_CLIENT_STRING
 %token VAR_EDNS_CLIENT_STRING_OPCODE VAR_NSID
 %token VAR_ZONEMD_PERMISSIVE_MODE VAR_ZONEMD_REJECT_ABSENCE
+%token VAR_CACHE_SNAPSHOT_FILE VAR_MSG_CACHE_POLICY VAR_RRSET_CACHE_POLICY
+%token VAR_INFRA_CACHE_POLICY VAR_KEY_CACHE_POLICY VAR_MSG_CACHE_WIRE_IMAGE
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -244,11 +254,13 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_unwanted_reply_threshold | server_log_time_ascii | 
 	server_domain_insecure | server_val_sig_skew_min | 
 	server_val_sig_skew_max | server_cache_min_ttl | server_val_log_level |
+	server_val_verify_threads |
 	server_auto_trust_anchor_file | server_add_holddown | 
 	server_del_holddown | server_keep_missing | server_so_rcvbuf |
 	server_edns_buffer_size | server_prefetch | server_prefetch_key |
 	server_so_sndbuf | server_harden_below_nxdomain | server_ignore_cd_flag |
 	server_log_queries | server_log_replies | server_tcp_upstream | server_ssl_upstream |
+	server_tcp_upstream_pool |
 	server_log_local_actions |
 	server_ssl_service_key | server_ssl_service_pem | server_ssl_port |
 	server_https_port | server_http_endpoint | server_http_max_streams |
@@ -256,11 +268,20 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_http_nodelay | server_http_notls_downstream |
 	server_minimal_responses | server_rrset_roundrobin | server_max_udp_size |
 	server_so_reuseport | server_delay_close | server_udp_connect |
-	server_unblock_lan_zones | server_insecure_lan_zones |
+	server_udp_batch_size | server_udp_upstream_batch |
+	server_udp_connect_pool | server_udp_connect_reuse |
+	server_use_io_uring |
+	server_unblock_lan_zones |
+	server_insecure_lan_zones |
 	server_dns64_prefix | server_dns64_synthall | server_dns64_ignore_aaaa |
 	server_infra_cache_min_rtt | server_harden_algo_downgrade |
 	server_ip_transparent | server_ip_ratelimit | server_ratelimit |
-	server_ip_dscp | server_infra_keep_probing |
+	server_ip_dscp | server_infra_keep_probing | server_cache_snapshot_file |
+	server_udp_hedge | server_udp_hedge_percentile |
+	server_udp_hedge_max_rate | server_infra_select_percentile |
+	server_msg_cache_policy | server_rrset_cache_policy |
+	server_infra_cache_policy | server_key_cache_policy |
+	server_msg_cache_wire_image |
 	server_ip_ratelimit_slabs | server_ratelimit_slabs |
 	server_ip_ratelimit_size | server_ratelimit_size |
 	server_ratelimit_for_domain |
@@ -300,6 +321,10 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_stream_wait_size | server_tls_ciphers |
 	server_tls_ciphersuites | server_tls_session_ticket_keys |
 	server_tls_use_sni | server_edns_client_string |
+	server_tls_upstream_resume | server_tls_upstream_early_data |
+	server_tls_use_ktls | server_shared_inflight |
+	server_priority_class | server_access_control_priority_class |
+	server_worker_cpu_affinity | server_numa_aware |
 	server_edns_client_string_opcode | server_nsid |
 	server_zonemd_permissive_mode | server_max_reuse_tcp_queries |
 	server_tcp_reuse_timeout | server_tcp_auth_query_timeout
@@ -925,6 +950,15 @@ server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG
 		free($2);
 	}
 	;
+server_tcp_upstream_pool: VAR_TCP_UPSTREAM_POOL STRING_ARG
+	{
+		OUTYY(("P(server_tcp_upstream_pool:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tcp_upstream_pool = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_udp_upstream_without_downstream: VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM STRING_ARG
 	{
 		OUTYY(("P(server_udp_upstream_without_downstream:%s)\n", $2));
@@ -1021,6 +1055,35 @@ server_tls_use_sni: VAR_TLS_USE_SNI STRING_ARG
 		free($2);
 	}
 	;
+server_tls_upstream_resume: VAR_TLS_UPSTREAM_RESUME STRING_ARG
+	{
+		OUTYY(("P(server_tls_upstream_resume:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_upstream_resume =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_tls_upstream_early_data: VAR_TLS_UPSTREAM_EARLY_DATA STRING_ARG
+	{
+		OUTYY(("P(server_tls_upstream_early_data:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_upstream_early_data =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_tls_use_ktls: VAR_TLS_USE_KTLS STRING_ARG
+	{
+		OUTYY(("P(server_tls_use_ktls:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_use_ktls = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_https_port: VAR_HTTPS_PORT STRING_ARG
 	{
 		OUTYY(("P(server_https_port:%s)\n", $2));
@@ -1390,6 +1453,25 @@ server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG
         free($2);
     }
     ;
+server_worker_cpu_affinity: VAR_WORKER_CPU_AFFINITY STRING_ARG
+	{
+		OUTYY(("P(server_worker_cpu_affinity:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->worker_cpu_affinity =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_numa_aware: VAR_NUMA_AWARE STRING_ARG
+	{
+		OUTYY(("P(server_numa_aware:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->numa_aware = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG
     {
         OUTYY(("P(server_ip_transparent:%s)\n", $2));
@@ -1477,6 +1559,28 @@ server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_msg_cache_policy: VAR_MSG_CACHE_POLICY STRING_ARG
+	{
+		OUTYY(("P(server_msg_cache_policy:%s)\n", $2));
+		if(strcmp($2, "lru") != 0 && strcmp($2, "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->msg_cache_policy);
+			cfg_parser->cfg->msg_cache_policy = $2;
+		}
+	}
+	;
+server_msg_cache_wire_image: VAR_MSG_CACHE_WIRE_IMAGE STRING_ARG
+	{
+		OUTYY(("P(server_msg_cache_wire_image:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->msg_cache_wire_image =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG
 	{
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", $2));
@@ -1513,6 +1617,56 @@ server_udp_connect: VAR_UDP_CONNECT STRING_ARG
 		free($2);
 	}
 	;
+server_udp_batch_size: VAR_UDP_BATCH_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_udp_batch_size:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->udp_batch_size = atoi($2);
+		free($2);
+	}
+	;
+server_udp_upstream_batch: VAR_UDP_UPSTREAM_BATCH STRING_ARG
+	{
+		OUTYY(("P(server_udp_upstream_batch:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->udp_upstream_batch =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_use_io_uring: VAR_USE_IO_URING STRING_ARG
+	{
+		OUTYY(("P(server_use_io_uring:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->use_io_uring = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_udp_connect_pool: VAR_UDP_CONNECT_POOL STRING_ARG
+	{
+		OUTYY(("P(server_udp_connect_pool:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->udp_connect_pool = atoi($2);
+		free($2);
+	}
+	;
+server_udp_connect_reuse: VAR_UDP_CONNECT_REUSE STRING_ARG
+	{
+		OUTYY(("P(server_udp_connect_reuse:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->udp_connect_reuse = atoi($2);
+		free($2);
+	}
+	;
 server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG
 	{
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", $2));
@@ -1554,6 +1708,18 @@ server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_rrset_cache_policy: VAR_RRSET_CACHE_POLICY STRING_ARG
+	{
+		OUTYY(("P(server_rrset_cache_policy:%s)\n", $2));
+		if(strcmp($2, "lru") != 0 && strcmp($2, "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->rrset_cache_policy);
+			cfg_parser->cfg->rrset_cache_policy = $2;
+		}
+	}
+	;
 server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG
 	{
 		OUTYY(("P(server_infra_host_ttl:%s)\n", $2));
@@ -1580,6 +1746,18 @@ server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG
 		free($2);
 	}
 	;
+server_infra_cache_policy: VAR_INFRA_CACHE_POLICY STRING_ARG
+	{
+		OUTYY(("P(server_infra_cache_policy:%s)\n", $2));
+		if(strcmp($2, "lru") != 0 && strcmp($2, "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->infra_cache_policy);
+			cfg_parser->cfg->infra_cache_policy = $2;
+		}
+	}
+	;
 server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG
 	{
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", $2));
@@ -1601,6 +1779,13 @@ server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_cache_snapshot_file: VAR_CACHE_SNAPSHOT_FILE STRING_ARG
+	{
+		OUTYY(("P(server_cache_snapshot_file:%s)\n", $2));
+		free(cfg_parser->cfg->cache_snapshot_file);
+		cfg_parser->cfg->cache_snapshot_file = $2;
+	}
+	;
 server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG
 	{
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", $2));
@@ -1620,6 +1805,46 @@ server_infra_keep_probing: VAR_INFRA_KEEP_PROBING STRING_ARG
 		free($2);
 	}
 	;
+server_udp_hedge: VAR_UDP_HEDGE STRING_ARG
+	{
+		OUTYY(("P(server_udp_hedge:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->udp_hedge = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_udp_hedge_percentile: VAR_UDP_HEDGE_PERCENTILE STRING_ARG
+	{
+		OUTYY(("P(server_udp_hedge_percentile:%s)\n", $2));
+		if(atoi($2) < 50 || atoi($2) > 99)
+			yyerror("expected a percentile from 50 to 99");
+		else cfg_parser->cfg->udp_hedge_percentile = atoi($2);
+		free($2);
+	}
+	;
+server_udp_hedge_max_rate: VAR_UDP_HEDGE_MAX_RATE STRING_ARG
+	{
+		OUTYY(("P(server_udp_hedge_max_rate:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 100)
+			yyerror("expected a percentage from 0 to 100");
+		else cfg_parser->cfg->udp_hedge_max_rate = atoi($2);
+		free($2);
+	}
+	;
+server_infra_select_percentile: VAR_INFRA_SELECT_PERCENTILE STRING_ARG
+	{
+		OUTYY(("P(server_infra_select_percentile:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) != 0 && (atoi($2) < 50 || atoi($2) > 99))
+			yyerror("expected 0 or a percentile from 50 to 99");
+		else cfg_parser->cfg->infra_select_percentile = atoi($2);
+		free($2);
+	}
+	;
 server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG
 	{
 		OUTYY(("P(server_target_fetch_policy:%s)\n", $2));
@@ -1737,6 +1962,15 @@ server_prefetch: VAR_PREFETCH STRING_ARG
 		free($2);
 	}
 	;
+server_shared_inflight: VAR_SHARED_INFLIGHT STRING_ARG
+	{
+		OUTYY(("P(server_shared_inflight:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->shared_inflight = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG
 	{
 		OUTYY(("P(server_prefetch_key:%s)\n", $2));
@@ -2017,6 +2251,17 @@ server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG
 		free($2);
 	}
 	;
+server_val_verify_threads: VAR_VAL_VERIFY_THREADS STRING_ARG
+	{
+		OUTYY(("P(server_val_verify_threads:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->val_verify_threads = atoi($2);
+		free($2);
+	}
+	;
 server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG
 	{
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", $2));
@@ -2090,6 +2335,18 @@ server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_key_cache_policy: VAR_KEY_CACHE_POLICY STRING_ARG
+	{
+		OUTYY(("P(server_key_cache_policy:%s)\n", $2));
+		if(strcmp($2, "lru") != 0 && strcmp($2, "sieve") != 0) {
+			yyerror("expected lru or sieve");
+			free($2);
+		} else {
+			free(cfg_parser->cfg->key_cache_policy);
+			cfg_parser->cfg->key_cache_policy = $2;
+		}
+	}
+	;
 server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG
 	{
 		OUTYY(("P(server_neg_cache_size:%s)\n", $2));
@@ -2324,6 +2581,33 @@ server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG
 		}
 	}
 	;
+server_priority_class: VAR_PRIORITY_CLASS STRING_ARG STRING_ARG
+	{
+		OUTYY(("P(server_priority_class:%s %s)\n", $2, $3));
+		if(atoi($3) == 0 && strcmp($3, "0") != 0) {
+			yyerror("percent number expected");
+			free($2);
+			free($3);
+		} else if(atoi($3) < 0 || atoi($3) > 100) {
+			yyerror("percent must be 0 to 100");
+			free($2);
+			free($3);
+		} else if(!cfg_str2list_insert(
+			&cfg_parser->cfg->priority_class, $2, $3)) {
+			yyerror("out of memory");
+		}
+	}
+	;
+server_access_control_priority_class: VAR_ACCESS_CONTROL_PRIORITY_CLASS STRING_ARG STRING_ARG
+	{
+		OUTYY(("P(server_access_control_priority_class:%s %s)\n",
+			$2, $3));
+		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_priority_class,
+			$2, $3)) {
+			yyerror("out of memory");
+		}
+	}
+	;
 server_response_ip_tag: VAR_RESPONSE_IP_TAG STRING_ARG STRING_ARG
 	{
 		size_t len = 0;
@@ -3370,7 +3654,7 @@ contents_cachedb: contents_cachedb content_cachedb
 	| ;
 content_cachedb: cachedb_backend_name | cachedb_secret_seed |
 	redis_server_host | redis_server_port | redis_timeout |
-	redis_expire_records
+	redis_expire_records | redis_async
 	;
 cachedb_backend_name: VAR_CACHEDB_BACKEND STRING_ARG
 	{
@@ -3449,6 +3733,19 @@ redis_expire_records: VAR_CACHEDB_REDISEXPIRERECORDS STRING_ARG
 		free($2);
 	}
 	;
+redis_async: VAR_CACHEDB_REDISASYNC STRING_ARG
+	{
+	#ifdef USE_CACHEDB
+		OUTYY(("P(redis_async:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->redis_async = (strcmp($2, "yes")==0);
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free($2);
+	}
+	;
 server_tcp_connection_limit: VAR_TCP_CONNECTION_LIMIT STRING_ARG STRING_ARG
 	{
 		OUTYY(("P(server_tcp_connection_limit:%s %s)\n", $2, $3));
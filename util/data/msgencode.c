@@ -444,12 +444,59 @@ rrset_belongs_in_reply(sldns_pkt_section s, uint16_t rrtype, uint16_t qtype,
 	return 1;
 }
 
+/** records the RRs while a message is encoded, to build a wire image */
+struct wire_record {
+	/** the recorded RRs */
+	struct reply_wire_rr* rrs;
+	/** number of recorded RRs */
+	size_t num;
+	/** allocated size of the rrs array */
+	size_t max;
+	/** if the message was encoded completely, without truncation */
+	int complete;
+};
+
+/** record an RR in the wire record, at the position of its TTL */
+static void
+wire_record_rr(struct wire_record* rec, size_t pos, size_t set, size_t rr)
+{
+	struct reply_wire_rr* r;
+	log_assert(rec->num < rec->max);
+	if(rec->num >= rec->max)
+		return;
+	r = &rec->rrs[rec->num++];
+	r->pos = pos;
+	r->set = set;
+	r->rr = rr;
+}
+
+/** Determine relative time adjustment for TTL values.
+ * For an rrset with a fixed TTL, use the rrset's TTL as given. */
+static time_t
+rrset_ttl_adjust(struct ub_packed_rrset_key* key,
+	struct packed_rrset_data* data, time_t timenow)
+{
+	if((key->rk.flags & PACKED_RRSET_FIXEDTTL) != 0)
+		return 0;
+	return SERVE_ORIGINAL_TTL ? data->ttl_add : timenow;
+}
+
+/** the TTL value to put in the packet for the RR TTL */
+static uint32_t
+rr_ttl_value(time_t rr_ttl, time_t adjust)
+{
+	if(rr_ttl < adjust)
+		return SERVE_EXPIRED?SERVE_EXPIRED_REPLY_TTL:0;
+	return (uint32_t)(rr_ttl-adjust);
+}
+
 /** store rrset in buffer in wireformat, return RETVAL_* */
 static int
 packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt, 
 	uint16_t* num_rrs, time_t timenow, struct regional* region,
 	int do_data, int do_sig, struct compress_tree_node** tree,
-	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
+	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset,
+	struct wire_record* rec, size_t setidx)
 {
 	size_t i, j, owner_pos;
 	int r, owner_labs;
@@ -464,13 +511,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 
 	owner_labs = dname_count_labels(key->rk.dname);
 	owner_pos = sldns_buffer_position(pkt);
-
-	/** Determine relative time adjustment for TTL values.
-	 * For an rrset with a fixed TTL, use the rrset's TTL as given. */
-	if((key->rk.flags & PACKED_RRSET_FIXEDTTL) != 0)
-		adjust = 0;
-	else
-		adjust = SERVE_ORIGINAL_TTL ? data->ttl_add : timenow;
+	adjust = rrset_ttl_adjust(key, data, timenow);
 
 	if(do_data) {
 		const sldns_rr_descriptor* c = type_rdata_compressable(key);
@@ -483,10 +524,11 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 				return r;
 			sldns_buffer_write(pkt, &key->rk.type, 2);
 			sldns_buffer_write(pkt, &key->rk.rrset_class, 2);
-			if(data->rr_ttl[j] < adjust)
-				sldns_buffer_write_u32(pkt,
-					SERVE_EXPIRED?SERVE_EXPIRED_REPLY_TTL:0);
-			else	sldns_buffer_write_u32(pkt, data->rr_ttl[j]-adjust);
+			if(rec)
+				wire_record_rr(rec, sldns_buffer_position(pkt),
+					setidx, j);
+			sldns_buffer_write_u32(pkt,
+				rr_ttl_value(data->rr_ttl[j], adjust));
 			if(c) {
 				if((r=compress_rdata(pkt, data->rr_data[j],
 					data->rr_len[j], region, tree, c))
@@ -520,10 +562,11 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 			}
 			sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_RRSIG);
 			sldns_buffer_write(pkt, &key->rk.rrset_class, 2);
-			if(data->rr_ttl[i] < adjust)
-				sldns_buffer_write_u32(pkt,
-					SERVE_EXPIRED?SERVE_EXPIRED_REPLY_TTL:0);
-			else	sldns_buffer_write_u32(pkt, data->rr_ttl[i]-adjust);
+			if(rec)
+				wire_record_rr(rec, sldns_buffer_position(pkt),
+					setidx, i);
+			sldns_buffer_write_u32(pkt,
+				rr_ttl_value(data->rr_ttl[i], adjust));
 			/* rrsig rdata cannot be compressed, perform 100+ byte
 			 * memcopy. */
 			sldns_buffer_write(pkt, data->rr_data[i],
@@ -544,7 +587,8 @@ static int
 insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	sldns_buffer* pkt, size_t rrsets_before, time_t timenow, 
 	struct regional* region, struct compress_tree_node** tree,
-	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
+	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset,
+	struct wire_record* rec)
 {
 	int r;
 	size_t i, setstart;
@@ -560,7 +604,8 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
 				pkt, num_rrs, timenow, region, 1, 1, tree,
-				s, qtype, dnssec, rr_offset))
+				s, qtype, dnssec, rr_offset, rec,
+				rrsets_before+i))
 				!= RETVAL_OK) {
 				/* Bad, but if due to size must set TC bit */
 				/* trim off the rrset neatly. */
@@ -573,7 +618,8 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
 				pkt, num_rrs, timenow, region, 1, 0, tree,
-				s, qtype, dnssec, rr_offset))
+				s, qtype, dnssec, rr_offset, rec,
+				rrsets_before+i))
 				!= RETVAL_OK) {
 				sldns_buffer_set_position(pkt, setstart);
 				return r;
@@ -584,7 +630,8 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
 				pkt, num_rrs, timenow, region, 0, 1, tree,
-				s, qtype, dnssec, rr_offset))
+				s, qtype, dnssec, rr_offset, rec,
+				rrsets_before+i))
 				!= RETVAL_OK) {
 				sldns_buffer_set_position(pkt, setstart);
 				return r;
@@ -668,10 +715,12 @@ negative_answer(struct reply_info* rep) {
 	return 1;
 }
 
-int
-reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
+/** encode the reply, like reply_info_encode, and record the RRs if rec */
+static int
+reply_info_encode_rec(struct query_info* qinfo, struct reply_info* rep,
 	uint16_t id, uint16_t flags, sldns_buffer* buffer, time_t timenow,
-	struct regional* region, uint16_t udpsize, int dnssec, int minimise)
+	struct regional* region, uint16_t udpsize, int dnssec, int minimise,
+	struct wire_record* rec)
 {
 	uint16_t ancount=0, nscount=0, arcount=0;
 	struct compress_tree_node* tree = 0;
@@ -723,7 +772,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 		arep.rrsets = &qinfo->local_alias->rrset;
 		if((r=insert_section(&arep, 1, &ancount, buffer, 0,
 			timezero, region, &tree, LDNS_SECTION_ANSWER,
-			qinfo->qtype, dnssec, rr_offset)) != RETVAL_OK) {
+			qinfo->qtype, dnssec, rr_offset, NULL)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* create truncated message */
 				sldns_buffer_write_u16_at(buffer, 6, ancount);
@@ -738,7 +787,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	/* insert answer section */
 	if((r=insert_section(rep, rep->an_numrrsets, &ancount, buffer,
 		0, timenow, region, &tree, LDNS_SECTION_ANSWER, qinfo->qtype,
-		dnssec, rr_offset)) != RETVAL_OK) {
+		dnssec, rr_offset, rec)) != RETVAL_OK) {
 		if(r == RETVAL_TRUNC) {
 			/* create truncated message */
 			sldns_buffer_write_u16_at(buffer, 6, ancount);
@@ -756,7 +805,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 		if((r=insert_section(rep, rep->ns_numrrsets, &nscount, buffer,
 			rep->an_numrrsets, timenow, region, &tree,
 			LDNS_SECTION_AUTHORITY, qinfo->qtype,
-			dnssec, rr_offset)) != RETVAL_OK) {
+			dnssec, rr_offset, rec)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* create truncated message */
 				sldns_buffer_write_u16_at(buffer, 8, nscount);
@@ -773,7 +822,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 			if((r=insert_section(rep, rep->ar_numrrsets, &arcount, buffer,
 				rep->an_numrrsets + rep->ns_numrrsets, timenow, region,
 				&tree, LDNS_SECTION_ADDITIONAL, qinfo->qtype,
-				dnssec, rr_offset)) != RETVAL_OK) {
+				dnssec, rr_offset, rec)) != RETVAL_OK) {
 				if(r == RETVAL_TRUNC) {
 					/* no need to set TC bit, this is the additional */
 					sldns_buffer_write_u16_at(buffer, 10, arcount);
@@ -786,9 +835,20 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 		}
 	}
 	sldns_buffer_flip(buffer);
+	if(rec)
+		rec->complete = 1;
 	return 1;
 }
 
+int
+reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
+	uint16_t id, uint16_t flags, sldns_buffer* buffer, time_t timenow,
+	struct regional* region, uint16_t udpsize, int dnssec, int minimise)
+{
+	return reply_info_encode_rec(qinfo, rep, id, flags, buffer, timenow,
+		region, udpsize, dnssec, minimise, NULL);
+}
+
 uint16_t
 calc_edns_field_size(struct edns_data* edns)
 {
@@ -874,15 +934,12 @@ attach_edns_record(sldns_buffer* pkt, struct edns_data* edns)
 	attach_edns_record_max_msg_sz(pkt, edns, edns->udp_size);
 }
 
-int 
-reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep, 
-	uint16_t id, uint16_t qflags, sldns_buffer* pkt, time_t timenow,
-	int cached, struct regional* region, uint16_t udpsize, 
-	struct edns_data* edns, int dnssec, int secure)
+/** the flags for an answer from the reply, host order */
+static uint16_t
+answer_flags(struct query_info* qinf, struct reply_info* rep,
+	uint16_t qflags, int cached, int dnssec, int secure)
 {
 	uint16_t flags;
-	unsigned int attach_edns = 0;
-
 	if(!cached || rep->authoritative) {
 		/* original flags, copy RD and CD bits from query. */
 		flags = rep->flags | (qflags & (BIT_RD|BIT_CD)); 
@@ -902,24 +959,215 @@ reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep,
 		flags &= ~BIT_AD;
 	}
 	log_assert(flags & BIT_QR); /* QR bit must be on in our replies */
-	if(udpsize < LDNS_HEADER_SIZE)
+	return flags;
+}
+
+/** fit the udpsize to the buffer and reserve space for the edns record,
+ * returns the octets reserved in attach_edns. false if too small. */
+static int
+answer_reserve_edns(sldns_buffer* pkt, struct edns_data* edns,
+	uint16_t* udpsize, unsigned int* attach_edns)
+{
+	if(*udpsize < LDNS_HEADER_SIZE)
 		return 0;
-	if(sldns_buffer_capacity(pkt) < udpsize)
-		udpsize = sldns_buffer_capacity(pkt);
-	if(udpsize < LDNS_HEADER_SIZE + calc_edns_field_size(edns)) {
+	if(sldns_buffer_capacity(pkt) < *udpsize)
+		*udpsize = sldns_buffer_capacity(pkt);
+	if(*udpsize < LDNS_HEADER_SIZE + calc_edns_field_size(edns)) {
 		/* packet too small to contain edns, omit it. */
-		attach_edns = 0;
+		*attach_edns = 0;
 	} else {
 		/* reserve space for edns record */
-		attach_edns = (unsigned int)calc_edns_field_size(edns);
-		udpsize -= attach_edns;
+		*attach_edns = (unsigned int)calc_edns_field_size(edns);
+		*udpsize -= *attach_edns;
+	}
+	return 1;
+}
+
+/** create the wire image from the recorded encode in the buffer */
+static struct reply_wire*
+reply_wire_create(struct wire_record* rec, struct query_info* qinf,
+	struct reply_info* rep, sldns_buffer* pkt, int dnssec, int minimise)
+{
+	struct reply_wire* w;
+	size_t i, len = sldns_buffer_limit(pkt);
+	size_t s = sizeof(*w) + sizeof(struct reply_wire_set)*rep->rrset_count
+		+ sizeof(struct reply_wire_rr)*rec->num + len;
+	w = (struct reply_wire*)malloc(s);
+	if(!w)
+		return NULL;
+	w->mem = s;
+	w->len = len;
+	w->qname_len = qinf->qname_len;
+	w->qtype = qinf->qtype;
+	w->qclass = qinf->qclass;
+	w->flags = rep->flags;
+	w->dnssec = (dnssec?1:0);
+	w->minimise = minimise;
+	w->multi_rr = 0;
+	w->an_numrrsets = rep->an_numrrsets;
+	w->ns_numrrsets = rep->ns_numrrsets;
+	w->set_count = rep->rrset_count;
+	w->sets = (struct reply_wire_set*)(w+1);
+	w->rr_count = rec->num;
+	w->rrs = (struct reply_wire_rr*)(w->sets + rep->rrset_count);
+	w->pkt = (uint8_t*)(w->rrs + rec->num);
+	for(i=0; i<rep->rrset_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->rrsets[i]->entry.data;
+		w->sets[i].key = rep->rrsets[i];
+		w->sets[i].id = rep->rrsets[i]->id;
+		w->sets[i].stamp = d->stamp;
+		if(d->count > 1)
+			w->multi_rr = 1;
+	}
+	memcpy(w->rrs, rec->rrs, sizeof(struct reply_wire_rr)*rec->num);
+	memcpy(w->pkt, sldns_buffer_begin(pkt), len);
+	return w;
+}
+
+/** check that the wire image is still the answer for the reply */
+static int
+reply_wire_check(struct reply_wire* w, struct query_info* qinf,
+	struct reply_info* rep, int dnssec)
+{
+	size_t i;
+	if(w->dnssec != (dnssec?1:0) || w->minimise != MINIMAL_RESPONSES ||
+		w->qname_len != qinf->qname_len || w->qtype != qinf->qtype ||
+		w->qclass != qinf->qclass || w->flags != rep->flags ||
+		w->set_count != rep->rrset_count ||
+		w->an_numrrsets != rep->an_numrrsets ||
+		w->ns_numrrsets != rep->ns_numrrsets ||
+		qinf->local_alias || (RRSET_ROUNDROBIN && w->multi_rr))
+		return 0;
+	for(i=0; i<w->set_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->rrsets[i]->entry.data;
+		/* the rrset data can be updated for the same rrset id,
+		 * the stamp changes when the rdata changes */
+		if(w->sets[i].key != rep->rrsets[i] ||
+			w->sets[i].id != rep->rrsets[i]->id ||
+			w->sets[i].stamp != d->stamp)
+			return 0;
 	}
+	return 1;
+}
+
+/** encode the answer, and create a wire image of it if wire is not NULL */
+static int
+answer_encode(struct query_info* qinf, struct reply_info* rep, 
+	uint16_t id, uint16_t qflags, sldns_buffer* pkt, time_t timenow,
+	int cached, struct regional* region, uint16_t udpsize, 
+	struct edns_data* edns, int dnssec, int secure,
+	struct reply_wire** wire)
+{
+	uint16_t flags;
+	unsigned int attach_edns = 0;
+	struct wire_record rec, *recp = NULL;
+
+	flags = answer_flags(qinf, rep, qflags, cached, dnssec, secure);
+	if(!answer_reserve_edns(pkt, edns, &udpsize, &attach_edns))
+		return 0;
 
-	if(!reply_info_encode(qinf, rep, id, flags, pkt, timenow, region,
-		udpsize, dnssec, MINIMAL_RESPONSES)) {
+	if(wire) {
+		*wire = NULL;
+		if(!qinf->local_alias && rep->qdcount == 1) {
+			size_t i;
+			int multi_rr = 0, unstamped = 0;
+			memset(&rec, 0, sizeof(rec));
+			for(i=0; i<rep->rrset_count; i++) {
+				struct packed_rrset_data* d = (struct
+					packed_rrset_data*)rep->rrsets[i]->
+					entry.data;
+				rec.max += d->count + d->rrsig_count;
+				if(d->count > 1)
+					multi_rr = 1;
+				if(d->stamp == 0)
+					unstamped = 1;
+			}
+			/* the roundrobin order is different for every
+			 * answer, unless the rrsets have one RR */
+			if((!RRSET_ROUNDROBIN || !multi_rr) && !unstamped)
+				rec.rrs = (struct reply_wire_rr*)regional_alloc(
+					region, sizeof(struct reply_wire_rr)*
+					(rec.max?rec.max:1));
+			if(rec.rrs)
+				recp = &rec;
+		}
+	}
+	if(!reply_info_encode_rec(qinf, rep, id, flags, pkt, timenow, region,
+		udpsize, dnssec, MINIMAL_RESPONSES, recp)) {
 		log_err("reply encode: out of memory");
 		return 0;
 	}
+	if(recp && rec.complete)
+		*wire = reply_wire_create(&rec, qinf, rep, pkt, dnssec,
+			MINIMAL_RESPONSES);
+	if(attach_edns && sldns_buffer_capacity(pkt) >=
+		sldns_buffer_limit(pkt)+attach_edns)
+		attach_edns_record_max_msg_sz(pkt, edns, udpsize+attach_edns);
+	return 1;
+}
+
+int 
+reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep, 
+	uint16_t id, uint16_t qflags, sldns_buffer* pkt, time_t timenow,
+	int cached, struct regional* region, uint16_t udpsize, 
+	struct edns_data* edns, int dnssec, int secure)
+{
+	return answer_encode(qinf, rep, id, qflags, pkt, timenow, cached,
+		region, udpsize, edns, dnssec, secure, NULL);
+}
+
+int
+reply_info_answer_encode_wire(struct query_info* qinf,
+	struct reply_info* rep, uint16_t id, uint16_t qflags,
+	sldns_buffer* pkt, time_t timenow, int cached,
+	struct regional* region, uint16_t udpsize, struct edns_data* edns,
+	int dnssec, int secure, struct reply_wire** wire)
+{
+	return answer_encode(qinf, rep, id, qflags, pkt, timenow, cached,
+		region, udpsize, edns, dnssec, secure, wire);
+}
+
+int
+reply_wire_answer_encode(struct reply_wire* w, struct query_info* qinf,
+	struct reply_info* rep, uint16_t id, uint16_t qflags,
+	sldns_buffer* pkt, time_t timenow, int cached, uint16_t udpsize,
+	struct edns_data* edns, int dnssec, int secure)
+{
+	uint16_t flags;
+	unsigned int attach_edns = 0;
+	uint8_t* p;
+	size_t i, qend;
+
+	if(!reply_wire_check(w, qinf, rep, dnssec))
+		return -1;
+	flags = answer_flags(qinf, rep, qflags, cached, dnssec, secure);
+	if(!answer_reserve_edns(pkt, edns, &udpsize, &attach_edns) ||
+		w->len > udpsize)
+		return 0; /* encode it, with truncation */
+
+	sldns_buffer_clear(pkt);
+	p = sldns_buffer_begin(pkt);
+	memmove(p, &id, sizeof(id));
+	sldns_buffer_write_u16_at(pkt, 2, flags);
+	memcpy(p+4, w->pkt+4, LDNS_HEADER_SIZE-4);
+	/* the query name keeps the case of the query, it may already be
+	 * in the buffer */
+	if(qinf->qname != p+LDNS_HEADER_SIZE)
+		memmove(p+LDNS_HEADER_SIZE, qinf->qname, w->qname_len);
+	qend = LDNS_HEADER_SIZE + w->qname_len;
+	memcpy(p+qend, w->pkt+qend, w->len-qend);
+	for(i=0; i<w->rr_count; i++) {
+		struct reply_wire_rr* r = &w->rrs[i];
+		struct ub_packed_rrset_key* k = rep->rrsets[r->set];
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			k->entry.data;
+		sldns_write_uint32(p+r->pos, rr_ttl_value(d->rr_ttl[r->rr],
+			rrset_ttl_adjust(k, d, timenow)));
+	}
+	sldns_buffer_set_position(pkt, w->len);
+	sldns_buffer_flip(pkt);
 	if(attach_edns && sldns_buffer_capacity(pkt) >=
 		sldns_buffer_limit(pkt)+attach_edns)
 		attach_edns_record_max_msg_sz(pkt, edns, udpsize+attach_edns);
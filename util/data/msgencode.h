@@ -42,6 +42,7 @@
 
 #ifndef UTIL_DATA_MSGENCODE_H
 #define UTIL_DATA_MSGENCODE_H
+#include "util/data/packed_rrset.h"
 struct sldns_buffer;
 struct query_info;
 struct reply_info;
@@ -71,6 +72,128 @@ int reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep,
 	int cached, struct regional* region, uint16_t udpsize, 
 	struct edns_data* edns, int dnssec, int secure);
 
+/**
+ * An rrset that a wire image was built from. Checked against the reply
+ * before the image is used.
+ */
+struct reply_wire_set {
+	/** the rrset key */
+	struct ub_packed_rrset_key* key;
+	/** the id of the key when the image was built */
+	rrset_id_type id;
+	/** the stamp of the rrset data when the image was built */
+	rrset_id_type stamp;
+};
+
+/**
+ * An RR in a wire image, with the position of its TTL.
+ */
+struct reply_wire_rr {
+	/** position of the TTL in the packet image */
+	size_t pos;
+	/** index of the rrset in the reply */
+	size_t set;
+	/** index of the RR in the rrset data */
+	size_t rr;
+};
+
+/**
+ * Prebuilt wire image of an encoded answer, without the EDNS record.
+ * For a cache reply the image is copied, the ID, flags and query name
+ * are patched and the TTLs are rewritten from the rrset data. It is
+ * allocated as one block, so it can be deleted with free().
+ */
+struct reply_wire {
+	/** allocated size of the image, counted in the cache size */
+	size_t mem;
+	/** length of the packet image */
+	size_t len;
+	/** length of the query name */
+	size_t qname_len;
+	/** query type, host order */
+	uint16_t qtype;
+	/** query class, host order */
+	uint16_t qclass;
+	/** flags of the reply_info when the image was built */
+	uint16_t flags;
+	/** if DNSSEC records were included */
+	int dnssec;
+	/** if the answer was a minimal response */
+	int minimise;
+	/** if an rrset has more than one RR, so that rrset roundrobin
+	 * changes the order of the RRs */
+	int multi_rr;
+	/** number of answer section rrsets of the reply_info */
+	size_t an_numrrsets;
+	/** number of authority section rrsets of the reply_info */
+	size_t ns_numrrsets;
+	/** number of rrsets of the reply_info */
+	size_t set_count;
+	/** the rrsets of the reply_info, in message order */
+	struct reply_wire_set* sets;
+	/** number of RRs in the image */
+	size_t rr_count;
+	/** the RRs in the image */
+	struct reply_wire_rr* rrs;
+	/** the packet image */
+	uint8_t* pkt;
+};
+
+/**
+ * Generate answer from reply_info, like reply_info_answer_encode, and
+ * build a wire image of it for reply_wire_answer_encode.
+ * The rrsets of the reply must be locked.
+ * @param qinf: query information that provides query section in packet.
+ * @param rep: reply to fill in.
+ * @param id: id word from the query.
+ * @param qflags: flags word from the query.
+ * @param dest: buffer to put message into; will truncate if it does not fit.
+ * @param timenow: time to subtract.
+ * @param cached: set true if a cached reply (so no AA bit).
+ * @param region: where to allocate temp variables (for compression).
+ * @param udpsize: size of the answer, 512, from EDNS, or 64k for TCP.
+ * @param edns: EDNS data included in the answer, NULL for none.
+ * @param dnssec: if 0 DNSSEC records are omitted from the answer.
+ * @param secure: if 1, the AD bit is set in the reply.
+ * @param wire: returns the wire image, malloced, or NULL if none was
+ *	made. No image is made for truncated answers, local aliases,
+ *	rrset roundrobin of rrsets with more than one RR, rrset data that
+ *	is not stamped by the rrset cache, or when out of memory.
+ * @return: 0 on error (server failure).
+ */
+int reply_info_answer_encode_wire(struct query_info* qinf,
+	struct reply_info* rep, uint16_t id, uint16_t qflags,
+	struct sldns_buffer* dest, time_t timenow, int cached,
+	struct regional* region, uint16_t udpsize, struct edns_data* edns,
+	int dnssec, int secure, struct reply_wire** wire);
+
+/**
+ * Generate answer from the wire image of a reply_info. The output is
+ * the same as that of reply_info_answer_encode.
+ * The rrsets of the reply must be locked.
+ * @param w: the wire image.
+ * @param qinf: query information, the query name is copied from it.
+ * @param rep: the reply that the image is for; it is checked with the
+ *	rrset ids and data stamps that the rrsets and their data are the
+ *	same as when the image was built.
+ * @param id: id word from the query.
+ * @param qflags: flags word from the query.
+ * @param dest: buffer to put message into.
+ * @param timenow: time to subtract.
+ * @param cached: set true if a cached reply (so no AA bit).
+ * @param udpsize: size of the answer, 512, from EDNS, or 64k for TCP.
+ * @param edns: EDNS data included in the answer, NULL for none.
+ * @param dnssec: if 0 DNSSEC records are omitted from the answer.
+ * @param secure: if 1, the AD bit is set in the reply.
+ * @return 1 if the answer is encoded, 0 if the image does not fit in
+ *	the udpsize, and -1 if the image is stale for the reply. For 0 and
+ *	-1 the caller encodes with reply_info_answer_encode.
+ */
+int reply_wire_answer_encode(struct reply_wire* w, struct query_info* qinf,
+	struct reply_info* rep, uint16_t id, uint16_t qflags,
+	struct sldns_buffer* dest, time_t timenow, int cached,
+	uint16_t udpsize, struct edns_data* edns, int dnssec, int secure);
+
 /**
  * Regenerate the wireformat from the stored msg reply.
  * If the buffer is too small then the message is truncated at a whole
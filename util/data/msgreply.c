@@ -118,6 +118,9 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
 	rep->rrset_count = total;
 	rep->security = sec;
 	rep->authoritative = 0;
+	rep->wire[0] = NULL;
+	rep->wire[1] = NULL;
+	rep->wire_mem = 0;
 	/* array starts after the refs */
 	if(region)
 		rep->rrsets = (struct ub_packed_rrset_key**)&(rep->ref[0]);
@@ -279,6 +282,7 @@ parse_rr_copy(sldns_buffer* pkt, struct rrset_parse* pset,
 	data->rrsig_count = pset->rrsig_count;
 	data->trust = rrset_trust_none;
 	data->security = sec_status_unchecked;
+	data->stamp = 0;
 	/* layout: struct - rr_len - rr_data - rr_ttl - rdata - rrsig */
 	data->rr_len = (size_t*)((uint8_t*)data + 
 		sizeof(struct packed_rrset_data));
@@ -607,6 +611,7 @@ msgreply_sizefunc(void* k, void* d)
 		- sizeof(struct rrset_ref);
 	s += r->rrset_count * sizeof(struct rrset_ref);
 	s += r->rrset_count * sizeof(struct ub_packed_rrset_key*);
+	s += r->wire_mem;
 	return s;
 }
 
@@ -623,9 +628,55 @@ void
 reply_info_delete(void* d, void* ATTR_UNUSED(arg))
 {
 	struct reply_info* r = (struct reply_info*)d;
+	free(r->wire[0]);
+	free(r->wire[1]);
 	free(r);
 }
 
+struct reply_wire*
+reply_info_get_wire(struct reply_info* rep, int dnssec)
+{
+#if defined(HAVE_STDATOMIC_H)
+	return atomic_load_explicit(&rep->wire[dnssec?1:0],
+		memory_order_acquire);
+#elif defined(__ATOMIC_ACQUIRE)
+	return __atomic_load_n(&rep->wire[dnssec?1:0], __ATOMIC_ACQUIRE);
+#else
+	return rep->wire[dnssec?1:0];
+#endif
+}
+
+int
+reply_info_attach_wire(struct reply_info* rep, struct reply_wire* w)
+{
+	struct reply_wire* expected = NULL;
+#if defined(HAVE_STDATOMIC_H)
+	return atomic_compare_exchange_strong_explicit(&rep->wire[w->dnssec],
+		&expected, w, memory_order_release, memory_order_relaxed);
+#elif defined(__ATOMIC_RELEASE)
+	return __atomic_compare_exchange_n(&rep->wire[w->dnssec], &expected,
+		w, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+#else
+	(void)rep;
+	(void)expected;
+	return 0;
+#endif
+}
+
+struct reply_wire*
+reply_info_set_wire(struct reply_info* rep, struct reply_wire* w)
+{
+	struct reply_wire* old = reply_info_get_wire(rep, w->dnssec);
+#if defined(HAVE_STDATOMIC_H)
+	atomic_store_explicit(&rep->wire[w->dnssec], w, memory_order_release);
+#elif defined(__ATOMIC_RELEASE)
+	__atomic_store_n(&rep->wire[w->dnssec], w, __ATOMIC_RELEASE);
+#else
+	rep->wire[w->dnssec] = w;
+#endif
+	return old;
+}
+
 hashvalue_type
 query_info_hash(struct query_info *q, uint16_t flags)
 {
@@ -53,11 +53,22 @@ struct edns_option;
 struct inplace_cb;
 struct module_qstate;
 struct module_env;
+struct reply_wire;
 struct msg_parse;
 struct rrset_parse;
 struct local_rrset;
 struct dns_msg;
 
+#ifdef HAVE_STDATOMIC_H
+/** pointer to a wire image of a reply, it is attached with a compare
+ * and swap and read with acquire ordering */
+typedef struct reply_wire* _Atomic reply_wire_ptr_type;
+#else
+/** pointer to a wire image of a reply, without stdatomic the compiler
+ * atomic builtins, if any, are used for it */
+typedef struct reply_wire* volatile reply_wire_ptr_type;
+#endif
+
 /** calculate the prefetch TTL as 90% of original. Calculation
  * without numerical overflow (uin32_t) */
 #define PREFETCH_TTL_CALC(ttl) ((ttl) - (ttl)/10)
@@ -192,6 +203,21 @@ struct reply_info {
 	 */
 	struct ub_packed_rrset_key** rrsets;
 
+	/**
+	 * Prebuilt wire images of the encoded answer, or NULL if none.
+	 * Indexed by the DNSSEC OK bit of the query. Only used for entries
+	 * in the message cache; an empty slot is filled under the read lock
+	 * of the cache entry with reply_info_attach_wire, a stale image is
+	 * replaced under the write lock. Freed with the reply_info.
+	 */
+	reply_wire_ptr_type wire[2];
+
+	/**
+	 * Memory of the wire images that is counted in the cache size,
+	 * changed with the lock of the hashtable.
+	 */
+	size_t wire_mem;
+
 	/** 
 	 * Packed array of ids (see counts) and pointers to packed_rrset_key.
 	 * The number equals ancount+nscount+arcount RRsets. 
@@ -339,6 +365,36 @@ void query_entry_delete(void *q, void* arg);
 /** delete reply_info data structure */
 void reply_info_delete(void* d, void* arg);
 
+/**
+ * Get the wire image of a reply in the message cache.
+ * @param rep: the reply, its cache entry is locked.
+ * @param dnssec: the DNSSEC OK bit of the query.
+ * @return the image or NULL if none.
+ */
+struct reply_wire* reply_info_get_wire(struct reply_info* rep, int dnssec);
+
+/**
+ * Attach a wire image to a reply in the message cache that has no image
+ * for the DNSSEC OK bit of the image. The cache entry can be read locked.
+ * @param rep: the reply.
+ * @param w: the image, on success it is owned by the reply.
+ * @return false if the reply already has an image, or the compare and
+ *	swap is not available. The caller then replaces it under the
+ *	write lock of the cache entry, with reply_info_set_wire.
+ */
+int reply_info_attach_wire(struct reply_info* rep, struct reply_wire* w);
+
+/**
+ * Set the wire image of a reply in the message cache, the cache entry
+ * is write locked.
+ * @param rep: the reply.
+ * @param w: the image, it is owned by the reply.
+ * @return the previous image for the DNSSEC OK bit of the image, or NULL.
+ *	The caller frees it.
+ */
+struct reply_wire* reply_info_set_wire(struct reply_info* rep,
+	struct reply_wire* w);
+
 /** calculate hash value of query_info, lowercases the qname,
  * uses CD flag for AAAA qtype */
 hashvalue_type query_info_hash(struct query_info *q, uint16_t flags);
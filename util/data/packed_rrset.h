@@ -247,6 +247,9 @@ struct packed_rrset_data {
 	enum rrset_trust trust; 
 	/** security status of the rrset data */
 	enum sec_status security;
+	/** stamp of the rdata, set by the rrset cache when the data is
+	 * stored; it changes when the rdata changes, 0 if not stamped */
+	rrset_id_type stamp;
 	/** length of every rr's rdata, rr_len[i] is size of rr_data[i]. */
 	size_t* rr_len;
 	/** ttl of every rr. rr_ttl[i] ttl of rr i. */
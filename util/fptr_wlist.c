@@ -46,6 +46,7 @@
 #include "config.h"
 #include "util/fptr_wlist.h"
 #include "util/mini_event.h"
+#include "util/uring_event.h"
 #include "services/outside_network.h"
 #include "services/mesh.h"
 #include "services/localzone.h"
@@ -63,6 +64,9 @@
 #include "validator/val_kentry.h"
 #include "validator/val_neg.h"
 #include "validator/autotrust.h"
+#include "validator/val_pool.h"
+#include "services/inflight.h"
+#include "services/outnet_pool.h"
 #include "util/data/msgreply.h"
 #include "util/data/packed_rrset.h"
 #include "util/storage/slabhash.h"
@@ -86,6 +90,7 @@
 #endif
 #ifdef USE_CACHEDB
 #include "cachedb/cachedb.h"
+#include "cachedb/redis.h"
 #endif
 #ifdef USE_IPSECMOD
 #include "ipsecmod/ipsecmod.h"
@@ -127,8 +132,11 @@ int
 fptr_whitelist_comm_timer(void (*fptr)(void*))
 {
 	if(fptr == &pending_udp_timer_cb) return 1;
+	else if(fptr == &serviced_hedge_timer_cb) return 1;
 	else if(fptr == &outnet_tcptimer) return 1;
 	else if(fptr == &pending_udp_timer_delay_cb) return 1;
+	else if(fptr == &pending_udp_send_error_cb) return 1;
+	else if(fptr == &outnet_udp_send_timer_cb) return 1;
 	else if(fptr == &worker_stat_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
 #ifdef UB_ON_WINDOWS
@@ -140,6 +148,12 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 	else if(fptr == &mesh_serve_expired_callback) return 1;
 #ifdef USE_DNSTAP
 	else if(fptr == &mq_wakeup_cb) return 1;
+#endif
+#ifdef USE_CACHEDB
+	else if(fptr == &testframe_async_timer_cb) return 1;
+#endif
+#if defined(USE_CACHEDB) && defined(USE_REDIS)
+	else if(fptr == &redis_async_timer_cb) return 1;
 #endif
 	return 0;
 }
@@ -186,6 +200,9 @@ fptr_whitelist_event(void (*fptr)(int, short, void *))
 	else if(fptr == &dtio_tap_callback) return 1;
 	else if(fptr == &dtio_mainfdcallback) return 1;
 #endif
+#if defined(USE_CACHEDB) && defined(USE_REDIS)
+	else if(fptr == &redis_async_event_cb) return 1;
+#endif
 #ifdef UB_ON_WINDOWS
 	else if(fptr == &worker_win_stop_cb) return 1;
 #endif
@@ -196,6 +213,7 @@ int
 fptr_whitelist_pending_udp(comm_point_callback_type *fptr)
 {
 	if(fptr == &serviced_udp_callback) return 1;
+	else if(fptr == &serviced_hedge_callback) return 1;
 	return 0;
 }
 
@@ -203,6 +221,7 @@ int
 fptr_whitelist_pending_tcp(comm_point_callback_type *fptr)
 {
 	if(fptr == &serviced_tcp_callback) return 1;
+	else if(fptr == &outnet_pool_tcp_cb) return 1;
 	return 0;
 }
 
@@ -219,6 +238,7 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 {
 	if(fptr == &mesh_state_compare) return 1;
 	else if(fptr == &mesh_state_ref_compare) return 1;
+	else if(fptr == &mesh_state_run_compare) return 1;
 	else if(fptr == &addr_tree_compare) return 1;
 	else if(fptr == &local_zone_cmp) return 1;
 	else if(fptr == &local_data_cmp) return 1;
@@ -227,11 +247,16 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 	else if(fptr == &serviced_cmp) return 1;
 	else if(fptr == &reuse_cmp) return 1;
 	else if(fptr == &reuse_id_cmp) return 1;
+	else if(fptr == &tls_session_cmp) return 1;
+	else if(fptr == &inflight_entry_cmp) return 1;
 	else if(fptr == &name_tree_compare) return 1;
 	else if(fptr == &order_lock_cmp) return 1;
 	else if(fptr == &codeline_cmp) return 1;
 	else if(fptr == &nsec3_hash_cmp) return 1;
 	else if(fptr == &mini_ev_cmp) return 1;
+#ifdef USE_IO_URING
+	else if(fptr == &uring_ev_cmp) return 1;
+#endif
 	else if(fptr == &anchor_cmp) return 1;
 	else if(fptr == &canonical_tree_compare) return 1;
 	else if(fptr == &context_query_cmp) return 1;
@@ -336,6 +361,7 @@ fptr_whitelist_modenv_send_query(struct outbound_entry* (*fptr)(
 	struct query_info* qinfo, uint16_t flags, int dnssec, int want_dnssec,
 	int nocaps, struct sockaddr_storage* addr, socklen_t addrlen,
 	uint8_t* zone, size_t zonelen, int ssl_upstream, char* tls_auth_name,
+	struct sockaddr_storage* hedge_addr, socklen_t hedge_addrlen,
 	struct module_qstate* q))
 {
 	if(fptr == &worker_send_query) return 1;
@@ -568,6 +594,11 @@ int fptr_whitelist_tube_listen(tube_callback_type* fptr)
 {
 	if(fptr == &worker_handle_control_cmd) return 1;
 	else if(fptr == &libworker_handle_control_cmd) return 1;
+	else if(fptr == &val_pool_conn_handle) return 1;
+	else if(fptr == &auth_parse_conn_handle) return 1;
+	else if(fptr == &inflight_conn_handle) return 1;
+	else if(fptr == &outnet_pool_handle) return 1;
+	else if(fptr == &outnet_pool_conn_handle) return 1;
 	return 0;
 }
 
@@ -213,6 +213,7 @@ int fptr_whitelist_modenv_send_query(struct outbound_entry* (*fptr)(
 	struct query_info* qinfo, uint16_t flags, int dnssec, int want_dnssec,
 	int nocaps, struct sockaddr_storage* addr, socklen_t addrlen,
 	uint8_t* zone, size_t zonelen, int ssl_upstream, char* tls_auth_name,
+	struct sockaddr_storage* hedge_addr, socklen_t hedge_addrlen,
 	struct module_qstate* q));
 
 /**
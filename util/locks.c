@@ -262,3 +262,80 @@ void ub_thread_join(ub_thread_type thr)
 	}
 }
 #endif /* HAVE_WINDOWS_THREADS */
+
+/** size of a lock in lock_thr_rw, rounded up to the cache line */
+#define LOCK_THR_RW_SIZE ((sizeof(lock_rw_type)+LOCK_THR_RW_LINE-1)/ \
+	LOCK_THR_RW_LINE*LOCK_THR_RW_LINE)
+/** the lock with the index in lock_thr_rw */
+#define LOCK_THR_RW_GET(l, i) \
+	((lock_rw_type*)((l)->locks + (size_t)(i)*LOCK_THR_RW_SIZE))
+
+int
+lock_thr_rw_init(struct lock_thr_rw* lock, int num)
+{
+	int i;
+	size_t off;
+	if(num < 1)
+		num = 1;
+	lock->mem = malloc((size_t)num*LOCK_THR_RW_SIZE + LOCK_THR_RW_LINE);
+	if(!lock->mem) {
+		lock->locks = NULL;
+		lock->num = 0;
+		return 0;
+	}
+	/* start the first lock on a cache line */
+	off = (size_t)lock->mem % LOCK_THR_RW_LINE;
+	lock->locks = (uint8_t*)lock->mem + (off?LOCK_THR_RW_LINE-off:0);
+	lock->num = num;
+	for(i=0; i<num; i++) {
+		lock_rw_init(LOCK_THR_RW_GET(lock, i));
+	}
+	return 1;
+}
+
+void
+lock_thr_rw_destroy(struct lock_thr_rw* lock)
+{
+	int i;
+	if(!lock->mem)
+		return;
+	for(i=0; i<lock->num; i++) {
+		lock_rw_destroy(LOCK_THR_RW_GET(lock, i));
+	}
+	free(lock->mem);
+	lock->mem = NULL;
+	lock->locks = NULL;
+	lock->num = 0;
+}
+
+void
+lock_thr_rw_rdlock(struct lock_thr_rw* lock, int thr)
+{
+	unsigned i = (unsigned)thr % (unsigned)lock->num;
+	lock_rw_rdlock(LOCK_THR_RW_GET(lock, i));
+}
+
+void
+lock_thr_rw_rdunlock(struct lock_thr_rw* lock, int thr)
+{
+	unsigned i = (unsigned)thr % (unsigned)lock->num;
+	lock_rw_unlock(LOCK_THR_RW_GET(lock, i));
+}
+
+void
+lock_thr_rw_wrlock(struct lock_thr_rw* lock)
+{
+	int i;
+	for(i=0; i<lock->num; i++) {
+		lock_rw_wrlock(LOCK_THR_RW_GET(lock, i));
+	}
+}
+
+void
+lock_thr_rw_wrunlock(struct lock_thr_rw* lock)
+{
+	int i;
+	for(i=lock->num-1; i>=0; i--) {
+		lock_rw_unlock(LOCK_THR_RW_GET(lock, i));
+	}
+}
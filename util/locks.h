@@ -51,6 +51,8 @@
  *     This lock is meant for non performance sensitive uses.
  *   o lock_quick: speed lock. For performance sensitive locking of critical
  *     sections. Could be implemented by a mutex or a spinlock.
+ *   o lock_thr_rw: lock_rw with a lock per thread for the readers, for data
+ *     that is read by every query and seldom changed.
  * 
  * Also thread creation and deletion functions are defined here.
  */
@@ -310,4 +312,70 @@ void ub_thread_blocksigs(void);
  */
 void ub_thread_sig_unblock(int sig);
 
+/** storage class of a variable with a copy for every thread, it is cheaper
+ * to read than a thread key.  Not defined if the compiler has none. */
+#if !defined(HAVE_PTHREAD) && !defined(HAVE_SOLARIS_THREADS) && \
+	!defined(HAVE_WINDOWS_THREADS)
+#define UB_THREAD_LOCAL /* no threads, a static variable */
+#elif defined(__GNUC__)
+#define UB_THREAD_LOCAL __thread
+#endif
+
+/** alignment of the locks in lock_thr_rw, the size of a cache line */
+#define LOCK_THR_RW_LINE 64
+
+/**
+ * Reader-writer lock with a lock_rw for every thread.  A reader locks only
+ * the lock of its own thread, so that readers on different threads do not
+ * write to the same cache line.  A writer locks all of them, in order.
+ */
+struct lock_thr_rw {
+	/** the locks, every one on its own cache line */
+	uint8_t* locks;
+	/** the allocated memory for the locks */
+	void* mem;
+	/** number of locks */
+	int num;
+};
+
+/**
+ * Init lock_thr_rw.
+ * @param lock: the lock to init.
+ * @param num: number of threads that read, the number of locks.
+ * @return false on malloc failure.
+ */
+int lock_thr_rw_init(struct lock_thr_rw* lock, int num);
+
+/**
+ * Destroy lock_thr_rw.
+ * @param lock: the lock to destroy.
+ */
+void lock_thr_rw_destroy(struct lock_thr_rw* lock);
+
+/**
+ * Lock for reading, by a thread.
+ * @param lock: the lock.
+ * @param thr: the thread number, that picks the lock of the thread.
+ */
+void lock_thr_rw_rdlock(struct lock_thr_rw* lock, int thr);
+
+/**
+ * Unlock after reading, by a thread.
+ * @param lock: the lock.
+ * @param thr: the thread number, the same as for the rdlock.
+ */
+void lock_thr_rw_rdunlock(struct lock_thr_rw* lock, int thr);
+
+/**
+ * Lock for writing, this locks the locks of all the threads.
+ * @param lock: the lock.
+ */
+void lock_thr_rw_wrlock(struct lock_thr_rw* lock);
+
+/**
+ * Unlock after writing.
+ * @param lock: the lock.
+ */
+void lock_thr_rw_wrunlock(struct lock_thr_rw* lock);
+
 #endif /* UTIL_LOCKS_H */
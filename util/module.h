@@ -175,6 +175,8 @@ struct mesh_area;
 struct mesh_state;
 struct val_anchors;
 struct val_neg_cache;
+struct val_pool_conn;
+struct auth_parse_conn;
 struct iter_forwards;
 struct iter_hints;
 struct respip_set;
@@ -357,6 +359,9 @@ struct module_env {
 	 * @param ssl_upstream: use SSL for upstream queries.
 	 * @param tls_auth_name: if ssl_upstream, use this name with TLS
 	 * 	authentication.
+	 * @param hedge_addr: server to send a hedged UDP query to when the
+	 *	answer is late, or NULL.
+	 * @param hedge_addrlen: length of hedge_addr.
 	 * @param q: wich query state to reactivate upon return.
 	 * @return: false on failure (memory or socket related). no query was
 	 *	sent. Or returns an outbound entry with qsent and qstate set.
@@ -367,7 +372,8 @@ struct module_env {
 		uint16_t flags, int dnssec, int want_dnssec, int nocaps,
 		struct sockaddr_storage* addr, socklen_t addrlen,
 		uint8_t* zone, size_t zonelen, int ssl_upstream,
-		char* tls_auth_name, struct module_qstate* q);
+		char* tls_auth_name, struct sockaddr_storage* hedge_addr,
+		socklen_t hedge_addrlen, struct module_qstate* q);
 
 	/**
 	 * Detach-subqueries.
@@ -507,6 +513,12 @@ struct module_env {
 	 * data structure. 
 	 */
 	struct iter_hints* hints;
+	/** connection of this thread to the signature verify threads of
+	 * the validator, NULL if signatures are verified on this thread */
+	struct val_pool_conn* val_pool;
+	/** connection of this thread to the zone transfer parse threads,
+	 * NULL if transfers are parsed on this thread */
+	struct auth_parse_conn* auth_parse;
 	/** module specific data. indexed by module id. */
 	void* modinfo[MAX_MODULE];
 
@@ -1223,6 +1223,17 @@ void* connect_sslctx_create(char* key, char* pem, char* verifypem, int wincert)
 #endif
 }
 
+int sslctx_enable_ktls(void* sslctx)
+{
+#if defined(HAVE_SSL) && defined(SSL_OP_ENABLE_KTLS)
+	SSL_CTX_set_options((SSL_CTX*)sslctx, SSL_OP_ENABLE_KTLS);
+	return 1;
+#else
+	(void)sslctx;
+	return 0;
+#endif
+}
+
 void* incoming_ssl_fd(void* sslctx, int fd)
 {
 #ifdef HAVE_SSL
@@ -428,6 +428,14 @@ void* listen_sslctx_create(char* key, char* pem, char* verifypem);
  */
 void* connect_sslctx_create(char* key, char* pem, char* verifypem, int wincert);
 
+/**
+ * Ask for the kernel to do the TLS records (kTLS) on the connections of
+ * the SSL context, once the handshake is done.
+ * @param sslctx: the SSL_CTX.
+ * @return false if the SSL library does not support it.
+ */
+int sslctx_enable_ktls(void* sslctx);
+
 /**
  * accept a new fd and wrap it in a BIO in SSL
  * @param sslctx: the SSL_CTX to use (from listen_sslctx_create()).
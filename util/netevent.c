@@ -107,6 +107,13 @@
 #define NUM_UDP_PER_SELECT 1
 #endif
 
+#if defined(HAVE_RECVMMSG) && defined(HAVE_SENDMMSG) && !defined(NONBLOCKING_IS_BROKEN)
+/** recvmmsg and sendmmsg are used to read and write UDP in batches */
+#define USE_UDP_BATCH 1
+#endif
+/** max number of datagrams in one recvmmsg or sendmmsg call */
+#define UDP_BATCH_MAX 64
+
 /**
  * The internal event structure for keeping ub_event info for the event.
  * Possibly other structures (list, tree) this is part of.
@@ -132,8 +139,63 @@ struct internal_base {
 	struct ub_event* slow_accept;
 	/** true if slow_accept is enabled */
 	int slow_accept_enabled;
+	/** number of datagrams per UDP batch, 0 if batching is off */
+	int udp_batch_num;
+#ifdef USE_UDP_BATCH
+	/** the UDP batch buffers, allocated when first used */
+	struct udp_batch* udp_batch;
+#endif
+	/** counters for batched UDP reads and writes */
+	struct comm_udp_batch_stats udp_batch_stats;
+};
+
+#ifdef USE_UDP_BATCH
+/** control message storage for one datagram */
+union udp_ancil_buf {
+	/** header, for alignment */
+	struct cmsghdr hdr;
+	/** the storage */
+	char buf[256];
 };
 
+/**
+ * The buffers for batched UDP reads and writes, one per comm_base.
+ * The datagrams are received in slots and copied into the commpoint
+ * buffer one by one for the callback.  Immediate replies are copied
+ * into the send buffer and written with one sendmmsg at the end.
+ */
+struct udp_batch {
+	/** number of datagrams per batch */
+	int num;
+	/** size of one receive slot, and of the send buffer */
+	size_t slotsize;
+	/** receive slots, num times slotsize bytes */
+	uint8_t* recvbuf;
+	/** message headers for recvmmsg */
+	struct mmsghdr rmsg[UDP_BATCH_MAX];
+	/** io vectors for recvmmsg */
+	struct iovec riov[UDP_BATCH_MAX];
+	/** source addresses of received datagrams */
+	struct sockaddr_storage raddr[UDP_BATCH_MAX];
+	/** ancillary data of received datagrams */
+	union udp_ancil_buf rctl[UDP_BATCH_MAX];
+	/** number of replies queued for sendmmsg */
+	int sendnum;
+	/** bytes used in the send buffer */
+	size_t sendused;
+	/** the reply data, slotsize bytes */
+	uint8_t* sendbuf;
+	/** message headers for sendmmsg */
+	struct mmsghdr smsg[UDP_BATCH_MAX];
+	/** io vectors for sendmmsg */
+	struct iovec siov[UDP_BATCH_MAX];
+	/** destination addresses of the replies */
+	struct sockaddr_storage saddr[UDP_BATCH_MAX];
+	/** ancillary data of the replies */
+	union udp_ancil_buf sctl[UDP_BATCH_MAX];
+};
+#endif /* USE_UDP_BATCH */
+
 /**
  * Internal timer structure, to store timer event in.
  */
@@ -166,6 +228,19 @@ static struct comm_point* comm_point_create_tcp_handler(
 
 /* -------- End of local definitions -------- */
 
+#ifdef USE_UDP_BATCH
+/** delete the UDP batch buffers */
+static void
+udp_batch_delete(struct udp_batch* ub)
+{
+	if(!ub)
+		return;
+	free(ub->recvbuf);
+	free(ub->sendbuf);
+	free(ub);
+}
+#endif /* USE_UDP_BATCH */
+
 struct comm_base* 
 comm_base_create(int sigs)
 {
@@ -222,6 +297,9 @@ comm_base_delete(struct comm_base* b)
 	}
 	ub_event_base_free(b->eb->base);
 	b->eb->base = NULL;
+#ifdef USE_UDP_BATCH
+	udp_batch_delete(b->eb->udp_batch);
+#endif
 	free(b->eb);
 	free(b);
 }
@@ -238,10 +316,36 @@ comm_base_delete_no_base(struct comm_base* b)
 		ub_event_free(b->eb->slow_accept);
 	}
 	b->eb->base = NULL;
+#ifdef USE_UDP_BATCH
+	udp_batch_delete(b->eb->udp_batch);
+#endif
 	free(b->eb);
 	free(b);
 }
 
+void
+comm_base_set_udp_batch(struct comm_base* b, int num)
+{
+#ifdef USE_UDP_BATCH
+	if(num > UDP_BATCH_MAX)
+		num = UDP_BATCH_MAX;
+	if(num <= 1)
+		num = 0;
+	b->eb->udp_batch_num = num;
+	udp_batch_delete(b->eb->udp_batch);
+	b->eb->udp_batch = NULL;
+#else
+	(void)b;
+	(void)num;
+#endif
+}
+
+struct comm_udp_batch_stats*
+comm_base_udp_batch_stats(struct comm_base* b)
+{
+	return &b->eb->udp_batch_stats;
+}
+
 void 
 comm_base_timept(struct comm_base* b, time_t** tt, struct timeval** tv)
 {
@@ -411,6 +515,89 @@ comm_point_send_udp_msg(struct comm_point *c, sldns_buffer* packet,
 	return 1;
 }
 
+int
+comm_point_send_udp_msgs(struct comm_point* c, struct comm_udp_msg* msgs,
+	int num, int is_connected)
+{
+#ifdef USE_UDP_BATCH
+	struct comm_udp_batch_stats* st = &c->ev->base->eb->udp_batch_stats;
+	struct mmsghdr mmsg[UDP_BATCH_MAX];
+	struct iovec iov[UDP_BATCH_MAX];
+	int done = 0, n, i, sent, total = 0;
+	log_assert(c->fd != -1);
+	while(done < num) {
+		n = num - done;
+		if(n > UDP_BATCH_MAX)
+			n = UDP_BATCH_MAX;
+		memset(mmsg, 0, sizeof(mmsg[0])*(size_t)n);
+		for(i=0; i<n; i++) {
+			iov[i].iov_base = msgs[done+i].data;
+			iov[i].iov_len = msgs[done+i].len;
+			mmsg[i].msg_hdr.msg_iov = &iov[i];
+			mmsg[i].msg_hdr.msg_iovlen = 1;
+			if(!is_connected) {
+				mmsg[i].msg_hdr.msg_name = msgs[done+i].addr;
+				mmsg[i].msg_hdr.msg_namelen =
+					msgs[done+i].addrlen;
+			}
+			msgs[done+i].sent = 0;
+		}
+		sent = sendmmsg(c->fd, mmsg, (unsigned int)n, 0);
+		if(sent == -1 && (errno == EAGAIN ||
+#  ifdef EWOULDBLOCK
+			errno == EWOULDBLOCK ||
+#  endif
+			errno == ENOBUFS)) {
+			/* try again and block, waiting for IO to complete */
+			int e;
+			fd_set_block(c->fd);
+			sent = sendmmsg(c->fd, mmsg, (unsigned int)n, 0);
+			e = errno;
+			fd_set_nonblock(c->fd);
+			errno = e;
+		}
+		if(sent == -1) {
+			/* the first datagram failed, skip it */
+			if(udp_send_errno_needs_log((struct sockaddr*)
+				msgs[done].addr, msgs[done].addrlen)) {
+				verbose(VERB_OPS, "sendmmsg failed: %s",
+					sock_strerror(errno));
+				log_addr(VERB_OPS, "remote address is",
+					msgs[done].addr, msgs[done].addrlen);
+			}
+			done++;
+			continue;
+		}
+		st->out_calls++;
+		st->out_pkts += (size_t)sent;
+		for(i=0; i<sent; i++) {
+			if(mmsg[i].msg_len != iov[i].iov_len) {
+				log_err("sent %d in place of %d bytes",
+					(int)mmsg[i].msg_len,
+					(int)iov[i].iov_len);
+				continue;
+			}
+			msgs[done+i].sent = 1;
+			total++;
+		}
+		done += sent;
+	}
+	return total;
+#else
+	sldns_buffer packet;
+	int i, total = 0;
+	for(i=0; i<num; i++) {
+		sldns_buffer_init_frm_data(&packet, msgs[i].data, msgs[i].len);
+		msgs[i].sent = comm_point_send_udp_msg(c, &packet,
+			(struct sockaddr*)msgs[i].addr, msgs[i].addrlen,
+			is_connected);
+		if(msgs[i].sent)
+			total++;
+	}
+	return total;
+#endif /* USE_UDP_BATCH */
+}
+
 #if defined(AF_INET6) && defined(IPV6_PKTINFO) && (defined(HAVE_RECVMSG) || defined(HAVE_SENDMSG))
 /** print debug ancillary info */
 static void p_ancil(const char* str, struct comm_reply* r)
@@ -462,49 +649,22 @@ static void p_ancil(const char* str, struct comm_reply* r)
 }
 #endif /* AF_INET6 && IPV6_PKTINFO && HAVE_RECVMSG||HAVE_SENDMSG */
 
-/** send a UDP reply over specified interface*/
-static int
-comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
-	struct sockaddr* addr, socklen_t addrlen, struct comm_reply* r) 
-{
 #if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
-	ssize_t sent;
-	struct msghdr msg;
-	struct iovec iov[1];
-	union {
-		struct cmsghdr hdr;
-		char buf[256];
-	} control;
+/** set the source address of the reply in the control data of msg,
+ * msg_control has to point to a buffer of controlsize bytes. */
+static void
+udp_send_set_ancil(struct msghdr* msg, size_t controlsize,
+	struct comm_reply* r)
+{
 #ifndef S_SPLINT_S
 	struct cmsghdr *cmsg;
-#endif /* S_SPLINT_S */
-
-	log_assert(c->fd != -1);
-#ifdef UNBOUND_DEBUG
-	if(sldns_buffer_remaining(packet) == 0)
-		log_err("error: send empty UDP packet");
-#endif
-	log_assert(addr && addrlen > 0);
-
-	msg.msg_name = addr;
-	msg.msg_namelen = addrlen;
-	iov[0].iov_base = sldns_buffer_begin(packet);
-	iov[0].iov_len = sldns_buffer_remaining(packet);
-	msg.msg_iov = iov;
-	msg.msg_iovlen = 1;
-	msg.msg_control = control.buf;
-#ifndef S_SPLINT_S
-	msg.msg_controllen = sizeof(control.buf);
-#endif /* S_SPLINT_S */
-	msg.msg_flags = 0;
 
-#ifndef S_SPLINT_S
-	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg = CMSG_FIRSTHDR(msg);
 	if(r->srctype == 4) {
 #ifdef IP_PKTINFO
 		void* cmsg_data;
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control.buf));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
+		log_assert(msg->msg_controllen <= controlsize);
 		cmsg->cmsg_level = IPPROTO_IP;
 		cmsg->cmsg_type = IP_PKTINFO;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v4info,
@@ -514,8 +674,8 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		((struct in_pktinfo *) cmsg_data)->ipi_ifindex = 0;
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in_pktinfo));
 #elif defined(IP_SENDSRCADDR)
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in_addr));
-		log_assert(msg.msg_controllen <= sizeof(control.buf));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in_addr));
+		log_assert(msg->msg_controllen <= controlsize);
 		cmsg->cmsg_level = IPPROTO_IP;
 		cmsg->cmsg_type = IP_SENDSRCADDR;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v4addr,
@@ -523,12 +683,12 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in_addr));
 #else
 		verbose(VERB_ALGO, "no IP_PKTINFO or IP_SENDSRCADDR");
-		msg.msg_control = NULL;
+		msg->msg_control = NULL;
 #endif /* IP_PKTINFO or IP_SENDSRCADDR */
 	} else if(r->srctype == 6) {
 		void* cmsg_data;
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control.buf));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
+		log_assert(msg->msg_controllen <= controlsize);
 		cmsg->cmsg_level = IPPROTO_IPV6;
 		cmsg->cmsg_type = IPV6_PKTINFO;
 		memmove(CMSG_DATA(cmsg), &r->pktinfo.v6info,
@@ -539,14 +699,55 @@ comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in6_pktinfo));
 	} else {
 		/* try to pass all 0 to use default route */
-		msg.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
-		log_assert(msg.msg_controllen <= sizeof(control.buf));
+		msg->msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
+		log_assert(msg->msg_controllen <= controlsize);
 		cmsg->cmsg_level = IPPROTO_IPV6;
 		cmsg->cmsg_type = IPV6_PKTINFO;
 		memset(CMSG_DATA(cmsg), 0, sizeof(struct in6_pktinfo));
 		cmsg->cmsg_len = CMSG_LEN(sizeof(struct in6_pktinfo));
 	}
+#else
+	(void)msg;
+	(void)controlsize;
+	(void)r;
+#endif /* S_SPLINT_S */
+}
+#endif /* AF_INET6 && IPV6_PKTINFO && HAVE_SENDMSG */
+
+/** send a UDP reply over specified interface*/
+static int
+comm_point_send_udp_msg_if(struct comm_point *c, sldns_buffer* packet,
+	struct sockaddr* addr, socklen_t addrlen, struct comm_reply* r) 
+{
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
+	ssize_t sent;
+	struct msghdr msg;
+	struct iovec iov[1];
+	union {
+		struct cmsghdr hdr;
+		char buf[256];
+	} control;
+
+	log_assert(c->fd != -1);
+#ifdef UNBOUND_DEBUG
+	if(sldns_buffer_remaining(packet) == 0)
+		log_err("error: send empty UDP packet");
+#endif
+	log_assert(addr && addrlen > 0);
+
+	msg.msg_name = addr;
+	msg.msg_namelen = addrlen;
+	iov[0].iov_base = sldns_buffer_begin(packet);
+	iov[0].iov_len = sldns_buffer_remaining(packet);
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buf;
+#ifndef S_SPLINT_S
+	msg.msg_controllen = sizeof(control.buf);
 #endif /* S_SPLINT_S */
+	msg.msg_flags = 0;
+
+	udp_send_set_ancil(&msg, sizeof(control.buf), r);
 	if(verbosity >= VERB_ALGO)
 		p_ancil("send_udp over interface", r);
 	sent = sendmsg(c->fd, &msg, 0);
@@ -638,6 +839,339 @@ static int udp_recv_needs_log(int err)
 	return 1;
 }
 
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG)
+/** get the destination address of a query from the control data of msg */
+static void
+udp_recv_get_ancil(struct msghdr* msg, struct comm_reply* rep)
+{
+#ifndef S_SPLINT_S
+	struct cmsghdr* cmsg;
+	for(cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL;
+		cmsg = CMSG_NXTHDR(msg, cmsg)) {
+		if( cmsg->cmsg_level == IPPROTO_IPV6 &&
+			cmsg->cmsg_type == IPV6_PKTINFO) {
+			rep->srctype = 6;
+			memmove(&rep->pktinfo.v6info, CMSG_DATA(cmsg),
+				sizeof(struct in6_pktinfo));
+			break;
+#ifdef IP_PKTINFO
+		} else if( cmsg->cmsg_level == IPPROTO_IP &&
+			cmsg->cmsg_type == IP_PKTINFO) {
+			rep->srctype = 4;
+			memmove(&rep->pktinfo.v4info, CMSG_DATA(cmsg),
+				sizeof(struct in_pktinfo));
+			break;
+#elif defined(IP_RECVDSTADDR)
+		} else if( cmsg->cmsg_level == IPPROTO_IP &&
+			cmsg->cmsg_type == IP_RECVDSTADDR) {
+			rep->srctype = 4;
+			memmove(&rep->pktinfo.v4addr, CMSG_DATA(cmsg),
+				sizeof(struct in_addr));
+			break;
+#endif /* IP_PKTINFO or IP_RECVDSTADDR */
+		}
+	}
+	if(verbosity >= VERB_ALGO)
+		p_ancil("receive_udp on interface", rep);
+#else
+	(void)msg;
+	(void)rep;
+#endif /* S_SPLINT_S */
+}
+#endif /* AF_INET6 && IPV6_PKTINFO && HAVE_RECVMSG */
+
+#ifdef USE_UDP_BATCH
+/** get the UDP batch buffers for the commpoint, NULL if batching is off */
+static struct udp_batch*
+udp_batch_get(struct comm_point* c)
+{
+	struct internal_base* eb = c->ev->base->eb;
+	size_t slotsize = sldns_buffer_capacity(c->buffer);
+	struct udp_batch* ub = eb->udp_batch;
+	if(eb->udp_batch_num == 0)
+		return NULL;
+	if(ub && ub->slotsize >= slotsize)
+		return ub;
+	udp_batch_delete(ub);
+	eb->udp_batch = NULL;
+	ub = (struct udp_batch*)calloc(1, sizeof(*ub));
+	if(!ub) {
+		log_err("out of memory for UDP batch, batching disabled");
+		eb->udp_batch_num = 0;
+		return NULL;
+	}
+	ub->num = eb->udp_batch_num;
+	ub->slotsize = slotsize;
+	ub->recvbuf = (uint8_t*)malloc(slotsize*(size_t)ub->num);
+	ub->sendbuf = (uint8_t*)malloc(slotsize);
+	if(!ub->recvbuf || !ub->sendbuf) {
+		log_err("out of memory for UDP batch, batching disabled");
+		udp_batch_delete(ub);
+		eb->udp_batch_num = 0;
+		return NULL;
+	}
+	eb->udp_batch = ub;
+	return ub;
+}
+
+/** send the queued replies with sendmmsg */
+static void
+udp_batch_flush(struct comm_point* c, int fd, struct udp_batch* ub)
+{
+	struct comm_udp_batch_stats* st = &c->ev->base->eb->udp_batch_stats;
+	int done = 0, sent, i;
+	while(done < ub->sendnum) {
+		sent = sendmmsg(fd, ub->smsg+done,
+			(unsigned int)(ub->sendnum-done), 0);
+		if(sent == -1 && (errno == EAGAIN ||
+#  ifdef EWOULDBLOCK
+			errno == EWOULDBLOCK ||
+#  endif
+			errno == ENOBUFS)) {
+			/* try again and block, waiting for IO to complete,
+			 * like for a single reply */
+			int e;
+			fd_set_block(fd);
+			sent = sendmmsg(fd, ub->smsg+done,
+				(unsigned int)(ub->sendnum-done), 0);
+			e = errno;
+			fd_set_nonblock(fd);
+			errno = e;
+		}
+		if(sent == -1) {
+			/* the first datagram failed, skip it */
+			struct msghdr* msg = &ub->smsg[done].msg_hdr;
+			if(udp_send_errno_needs_log((struct sockaddr*)
+				msg->msg_name, msg->msg_namelen)) {
+				verbose(VERB_OPS, "sendmmsg failed: %s",
+					sock_strerror(errno));
+				log_addr(VERB_OPS, "remote address is",
+					(struct sockaddr_storage*)msg->msg_name,
+					msg->msg_namelen);
+			}
+			done++;
+			continue;
+		}
+		st->send_calls++;
+		st->send_pkts += (size_t)sent;
+		for(i=done; i<done+sent; i++) {
+			if(ub->smsg[i].msg_len != ub->siov[i].iov_len)
+				log_err("sent %d in place of %d bytes",
+					(int)ub->smsg[i].msg_len,
+					(int)ub->siov[i].iov_len);
+		}
+		done += sent;
+	}
+	ub->sendnum = 0;
+	ub->sendused = 0;
+}
+
+/** queue an immediate reply for sendmmsg */
+static void
+udp_batch_queue(struct comm_point* c, int fd, struct udp_batch* ub,
+	sldns_buffer* packet, struct comm_reply* rep, int ancil)
+{
+	size_t len = sldns_buffer_remaining(packet);
+	struct msghdr* msg;
+	if(len > ub->slotsize) {
+		/* does not fit in the send buffer, send it by itself */
+		(void)comm_point_send_udp_msg(c, packet,
+			(struct sockaddr*)&rep->addr, rep->addrlen, 0);
+		return;
+	}
+	if(ub->sendnum >= ub->num || len > ub->slotsize - ub->sendused)
+		udp_batch_flush(c, fd, ub);
+#ifdef UNBOUND_DEBUG
+	if(len == 0)
+		log_err("error: send empty UDP packet");
+#endif
+	memmove(ub->sendbuf+ub->sendused, sldns_buffer_begin(packet), len);
+	memmove(&ub->saddr[ub->sendnum], &rep->addr, rep->addrlen);
+	ub->siov[ub->sendnum].iov_base = ub->sendbuf+ub->sendused;
+	ub->siov[ub->sendnum].iov_len = len;
+	msg = &ub->smsg[ub->sendnum].msg_hdr;
+	memset(msg, 0, sizeof(*msg));
+	msg->msg_name = &ub->saddr[ub->sendnum];
+	msg->msg_namelen = rep->addrlen;
+	msg->msg_iov = &ub->siov[ub->sendnum];
+	msg->msg_iovlen = 1;
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
+	if(ancil) {
+		msg->msg_control = ub->sctl[ub->sendnum].buf;
+		msg->msg_controllen = sizeof(ub->sctl[ub->sendnum].buf);
+		udp_send_set_ancil(msg, sizeof(ub->sctl[ub->sendnum].buf),
+			rep);
+		if(verbosity >= VERB_ALGO)
+			p_ancil("send_udp over interface", rep);
+	}
+#else
+	(void)ancil;
+#endif
+	ub->sendused += len;
+	ub->sendnum++;
+}
+
+/**
+ * Read datagrams with recvmmsg and pass them to the commpoint callback
+ * one by one.  Immediate replies are written with sendmmsg afterwards.
+ * @param c: the UDP commpoint.
+ * @param fd: its file descriptor.
+ * @param ub: the batch buffers.
+ * @param ancil: if true the destination address is read and set on
+ * 	the replies, for interface-automatic.
+ */
+static void
+comm_point_udp_batch_callback(struct comm_point* c, int fd,
+	struct udp_batch* ub, int ancil)
+{
+	struct comm_udp_batch_stats* st = &c->ev->base->eb->udp_batch_stats;
+	struct comm_reply rep;
+	struct msghdr* msg;
+	sldns_buffer* buffer;
+	int i, n, want, todo = NUM_UDP_PER_SELECT;
+
+	ub->sendnum = 0;
+	ub->sendused = 0;
+	while(todo > 0) {
+		want = (todo < ub->num)?todo:ub->num;
+		for(i=0; i<want; i++) {
+			msg = &ub->rmsg[i].msg_hdr;
+			ub->riov[i].iov_base = ub->recvbuf + ub->slotsize*i;
+			ub->riov[i].iov_len = ub->slotsize;
+			memset(msg, 0, sizeof(*msg));
+			msg->msg_name = &ub->raddr[i];
+			msg->msg_namelen = (socklen_t)sizeof(ub->raddr[i]);
+			msg->msg_iov = &ub->riov[i];
+			msg->msg_iovlen = 1;
+			if(ancil) {
+				msg->msg_control = ub->rctl[i].buf;
+				msg->msg_controllen = sizeof(ub->rctl[i].buf);
+			}
+		}
+		n = recvmmsg(fd, ub->rmsg, (unsigned int)want, 0, NULL);
+		if(n == -1) {
+			if(errno != EAGAIN && errno != EINTR
+				&& udp_recv_needs_log(errno))
+				log_err("recvmmsg %d failed: %s",
+					fd, strerror(errno));
+			break;
+		}
+		st->recv_calls++;
+		st->recv_pkts += (size_t)n;
+		for(i=0; i<n; i++) {
+			msg = &ub->rmsg[i].msg_hdr;
+			rep.c = c;
+			sldns_buffer_clear(c->buffer);
+			sldns_buffer_write(c->buffer, ub->riov[i].iov_base,
+				ub->rmsg[i].msg_len);
+			sldns_buffer_flip(c->buffer);
+			memmove(&rep.addr, &ub->raddr[i], msg->msg_namelen);
+			rep.addrlen = msg->msg_namelen;
+			rep.srctype = 0;
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG)
+			if(ancil)
+				udp_recv_get_ancil(msg, &rep);
+#endif
+			fptr_ok(fptr_whitelist_comm_point(c->callback));
+			if((*c->callback)(c, c->cb_arg, NETEVENT_NOERROR, &rep)) {
+				/* queue the immediate reply */
+#ifdef USE_DNSCRYPT
+				buffer = ancil?c->buffer:c->dnscrypt_buffer;
+#else
+				buffer = c->buffer;
+#endif
+				udp_batch_queue(c, fd, ub, buffer, &rep, ancil);
+			}
+			if(!rep.c || rep.c->fd != fd) {
+				/* commpoint closed to -1 or reused for another
+				 * UDP port, drop the rest of the batch */
+				ub->sendnum = 0;
+				ub->sendused = 0;
+				return;
+			}
+		}
+		todo -= n;
+		if(n < want)
+			break; /* no more datagrams waiting */
+	}
+	udp_batch_flush(c, fd, ub);
+}
+#endif /* USE_UDP_BATCH */
+
+/**
+ * Handle a datagram that the event base has read for the commpoint.  The
+ * immediate reply is queued on the event base, that sends it with its
+ * other requests.
+ * @param c: the UDP commpoint.
+ * @param fd: its file descriptor.
+ * @param msg: the datagram, with the payload in msg_iov[0].
+ * @param ancil: if true the destination address is read and set on
+ * 	the reply, for interface-automatic.
+ */
+static void
+comm_point_udp_recvmsg_callback(struct comm_point* c, int fd,
+	struct msghdr* msg, int ancil)
+{
+	struct comm_reply rep;
+	struct msghdr smsg;
+	struct iovec iov[1];
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
+	union {
+		struct cmsghdr hdr;
+		char buf[256];
+	} control;
+#endif
+	sldns_buffer* buffer;
+
+	if(msg->msg_iov[0].iov_len > sldns_buffer_capacity(c->buffer) ||
+		msg->msg_namelen > (socklen_t)sizeof(rep.addr))
+		return;
+	rep.c = c;
+	sldns_buffer_clear(c->buffer);
+	sldns_buffer_write(c->buffer, msg->msg_iov[0].iov_base,
+		msg->msg_iov[0].iov_len);
+	sldns_buffer_flip(c->buffer);
+	memmove(&rep.addr, msg->msg_name, msg->msg_namelen);
+	rep.addrlen = msg->msg_namelen;
+	rep.srctype = 0;
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_RECVMSG)
+	if(ancil)
+		udp_recv_get_ancil(msg, &rep);
+#endif
+	fptr_ok(fptr_whitelist_comm_point(c->callback));
+	if(!(*c->callback)(c, c->cb_arg, NETEVENT_NOERROR, &rep))
+		return;
+	/* queue the immediate reply */
+#ifdef USE_DNSCRYPT
+	buffer = ancil?c->buffer:c->dnscrypt_buffer;
+#else
+	buffer = c->buffer;
+#endif
+	memset(&smsg, 0, sizeof(smsg));
+	smsg.msg_name = &rep.addr;
+	smsg.msg_namelen = rep.addrlen;
+	iov[0].iov_base = sldns_buffer_begin(buffer);
+	iov[0].iov_len = sldns_buffer_remaining(buffer);
+	smsg.msg_iov = iov;
+	smsg.msg_iovlen = 1;
+#if defined(AF_INET6) && defined(IPV6_PKTINFO) && defined(HAVE_SENDMSG)
+	if(ancil) {
+		smsg.msg_control = control.buf;
+		smsg.msg_controllen = sizeof(control.buf);
+		udp_send_set_ancil(&smsg, sizeof(control.buf), &rep);
+		if(verbosity >= VERB_ALGO)
+			p_ancil("send_udp over interface", &rep);
+	}
+#endif
+	if(ub_event_base_sendmsg(c->ev->base->eb->base, fd, &smsg))
+		return;
+	if(ancil)
+		(void)comm_point_send_udp_msg_if(c, buffer,
+			(struct sockaddr*)&rep.addr, rep.addrlen, &rep);
+	else	(void)comm_point_send_udp_msg(c, buffer,
+			(struct sockaddr*)&rep.addr, rep.addrlen, 0);
+}
+
 void 
 comm_point_udp_ancil_callback(int fd, short event, void* arg)
 {
@@ -651,9 +1185,10 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		char buf[256];
 	} ancil;
 	int i;
-#ifndef S_SPLINT_S
-	struct cmsghdr* cmsg;
-#endif /* S_SPLINT_S */
+	struct msghdr* rmsg;
+#ifdef USE_UDP_BATCH
+	struct udp_batch* ub;
+#endif
 
 	rep.c = (struct comm_point*)arg;
 	log_assert(rep.c->type == comm_udp);
@@ -662,6 +1197,16 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	ub_comm_base_now(rep.c->ev->base);
+	if((rmsg = ub_event_base_recvmsg(rep.c->ev->base->eb->base))) {
+		comm_point_udp_recvmsg_callback(rep.c, fd, rmsg, 1);
+		return;
+	}
+#ifdef USE_UDP_BATCH
+	if((ub = udp_batch_get(rep.c)) != NULL) {
+		comm_point_udp_batch_callback(rep.c, fd, ub, 1);
+		return;
+	}
+#endif
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
@@ -690,35 +1235,7 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 		sldns_buffer_skip(rep.c->buffer, rcv);
 		sldns_buffer_flip(rep.c->buffer);
 		rep.srctype = 0;
-#ifndef S_SPLINT_S
-		for(cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL;
-			cmsg = CMSG_NXTHDR(&msg, cmsg)) {
-			if( cmsg->cmsg_level == IPPROTO_IPV6 &&
-				cmsg->cmsg_type == IPV6_PKTINFO) {
-				rep.srctype = 6;
-				memmove(&rep.pktinfo.v6info, CMSG_DATA(cmsg),
-					sizeof(struct in6_pktinfo));
-				break;
-#ifdef IP_PKTINFO
-			} else if( cmsg->cmsg_level == IPPROTO_IP &&
-				cmsg->cmsg_type == IP_PKTINFO) {
-				rep.srctype = 4;
-				memmove(&rep.pktinfo.v4info, CMSG_DATA(cmsg),
-					sizeof(struct in_pktinfo));
-				break;
-#elif defined(IP_RECVDSTADDR)
-			} else if( cmsg->cmsg_level == IPPROTO_IP &&
-				cmsg->cmsg_type == IP_RECVDSTADDR) {
-				rep.srctype = 4;
-				memmove(&rep.pktinfo.v4addr, CMSG_DATA(cmsg),
-					sizeof(struct in_addr));
-				break;
-#endif /* IP_PKTINFO or IP_RECVDSTADDR */
-			}
-		}
-		if(verbosity >= VERB_ALGO)
-			p_ancil("receive_udp on interface", &rep);
-#endif /* S_SPLINT_S */
+		udp_recv_get_ancil(&msg, &rep);
 		fptr_ok(fptr_whitelist_comm_point(rep.c->callback));
 		if((*rep.c->callback)(rep.c, rep.c->cb_arg, NETEVENT_NOERROR, &rep)) {
 			/* send back immediate reply */
@@ -744,6 +1261,10 @@ comm_point_udp_callback(int fd, short event, void* arg)
 	ssize_t rcv;
 	int i;
 	struct sldns_buffer *buffer;
+	struct msghdr* rmsg;
+#ifdef USE_UDP_BATCH
+	struct udp_batch* ub;
+#endif
 
 	rep.c = (struct comm_point*)arg;
 	log_assert(rep.c->type == comm_udp);
@@ -752,6 +1273,16 @@ comm_point_udp_callback(int fd, short event, void* arg)
 		return;
 	log_assert(rep.c && rep.c->buffer && rep.c->fd == fd);
 	ub_comm_base_now(rep.c->ev->base);
+	if((rmsg = ub_event_base_recvmsg(rep.c->ev->base->eb->base))) {
+		comm_point_udp_recvmsg_callback(rep.c, fd, rmsg, 0);
+		return;
+	}
+#ifdef USE_UDP_BATCH
+	if((ub = udp_batch_get(rep.c)) != NULL) {
+		comm_point_udp_batch_callback(rep.c, fd, ub, 0);
+		return;
+	}
+#endif
 	for(i=0; i<NUM_UDP_PER_SELECT; i++) {
 		sldns_buffer_clear(rep.c->buffer);
 		rep.addrlen = (socklen_t)sizeof(rep.addr);
@@ -803,6 +1334,27 @@ int adjusted_tcp_timeout(struct comm_point* c)
 	return c->tcp_timeout_msec;
 }
 
+int comm_point_tls_msg_pending(struct comm_point* c)
+{
+#ifdef HAVE_SSL
+	uint16_t len;
+	int pending;
+	if(!c->ssl || c->ssl_shake_state != comm_ssl_shake_none)
+		return 0;
+	pending = SSL_pending(c->ssl);
+	if(pending < (int)sizeof(len))
+		return 0;
+	ERR_clear_error();
+	if(SSL_peek(c->ssl, (void*)&len, (int)sizeof(len)) !=
+		(int)sizeof(len))
+		return 0;
+	return (size_t)pending >= sizeof(len) + (size_t)ntohs(len);
+#else
+	(void)c;
+	return 0;
+#endif /* HAVE_SSL */
+}
+
 /** Use a new tcp handler for new query fd, set to read query */
 static void
 setup_tcp_handler(struct comm_point* c, int fd, int cur, int max) 
@@ -817,6 +1369,7 @@ setup_tcp_handler(struct comm_point* c, int fd, int cur, int max)
 #endif
 	c->tcp_is_reading = 1;
 	c->tcp_byte_count = 0;
+	c->tcp_write_prefixed = 0;
 	/* if more than half the tcp handlers are in use, use a shorter
 	 * timeout for this TCP connection, we need to make space for
 	 * other connections to be able to get attention */
@@ -857,12 +1410,18 @@ int comm_point_perform_accept(struct comm_point* c,
 {
 	int new_fd;
 	*addrlen = (socklen_t)sizeof(*addr);
+	/* the event base can have accepted it already */
+	if(!ub_event_base_accept(c->ev->base->eb->base, &new_fd, addr,
+		addrlen)) {
 #ifndef HAVE_ACCEPT4
-	new_fd = accept(c->fd, (struct sockaddr*)addr, addrlen);
+		new_fd = accept(c->fd, (struct sockaddr*)addr, addrlen);
 #else
-	/* SOCK_NONBLOCK saves extra calls to fcntl for the same result */
-	new_fd = accept4(c->fd, (struct sockaddr*)addr, addrlen, SOCK_NONBLOCK);
+		/* SOCK_NONBLOCK saves extra calls to fcntl for the same
+		 * result */
+		new_fd = accept4(c->fd, (struct sockaddr*)addr, addrlen,
+			SOCK_NONBLOCK);
 #endif
+	}
 	if(new_fd == -1) {
 #ifndef USE_WINSOCK
 		/* EINTR is signal interrupt. others are closed connection. */
@@ -1065,6 +1624,9 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 		c_hdl->ev->ev = ub_event_new(c_hdl->ev->base->eb->base, -1,
 			UB_EV_PERSIST | UB_EV_READ | UB_EV_TIMEOUT,
 			comm_point_tcp_handle_callback, c_hdl);
+		/* the fd is closed by comm_point_close */
+		if(c_hdl->ev->ev)
+			ub_event_stream(c_hdl->ev->ev);
 	}
 	if(!c_hdl->ev->ev) {
 		log_warn("could not ub_event_new, dropped tcp");
@@ -1133,6 +1695,7 @@ tcp_callback_writer(struct comm_point* c)
 	if(!c->tcp_write_and_read) {
 		sldns_buffer_clear(c->buffer);
 		c->tcp_byte_count = 0;
+		c->tcp_write_prefixed = 0;
 	}
 	if(c->tcp_do_toggle_rw)
 		c->tcp_is_reading = 1;
@@ -1206,8 +1769,65 @@ squelch_err_ssl_handshake(unsigned long err)
 }
 #endif /* HAVE_SSL */
 
-/** continue ssl handshake */
+#ifdef HAVE_SSL_WRITE_EARLY_DATA
+/**
+ * Write the packet of an outgoing stream as TLS 1.3 early data, before the
+ * handshake is done.
+ * @param c: comm point in write and read mode, with the resumed session.
+ * @return 0 on error, 1 when written or when it is not possible and the
+ *	packet is written after the handshake, 2 when it waits for the socket.
+ */
+static int
+ssl_write_early_data(struct comm_point* c)
+{
+	uint8_t buf[LDNS_RR_BUF_SIZE];
+	uint16_t len;
+	size_t written = 0;
+	int r;
+	if(!c->tcp_write_and_read || !c->tcp_write_pkt ||
+		c->tcp_write_byte_count != 0 ||
+		c->tcp_write_pkt_len + 2 > sizeof(buf)) {
+		c->ssl_early_data = 0;
+		return 1;
+	}
+	/* combine the tcp length and the query, it is written at once */
+	len = htons(c->tcp_write_pkt_len);
+	memmove(buf, &len, sizeof(uint16_t));
+	memmove(buf+sizeof(uint16_t), c->tcp_write_pkt, c->tcp_write_pkt_len);
+	ERR_clear_error();
+	r = SSL_write_early_data(c->ssl, buf, c->tcp_write_pkt_len + 2,
+		&written);
+	if(r != 1) {
+		int want = SSL_get_error(c->ssl, r);
+		if(want == SSL_ERROR_WANT_READ) {
+			c->ssl_shake_state = comm_ssl_shake_read;
+			comm_point_listen_for_rw(c, 1, 0);
+			return 2;
+		} else if(want == SSL_ERROR_WANT_WRITE) {
+			c->ssl_shake_state = comm_ssl_shake_write;
+			comm_point_listen_for_rw(c, 0, 1);
+			return 2;
+		}
+		log_crypto_err("could not SSL_write_early_data");
+		return 0;
+	}
+	c->tcp_write_byte_count = written;
+	c->ssl_early_data = 2;
+	return 1;
+}
+#endif /* HAVE_SSL_WRITE_EARLY_DATA */
+
 #ifdef HAVE_SSL
+/** true if the packet of a write and read stream is written as early data
+ * and the handshake is done, but the write callback is not done yet */
+static int
+ssl_early_data_written(struct comm_point* c)
+{
+	return c->tcp_write_and_read && c->tcp_write_pkt &&
+		c->tcp_write_byte_count == c->tcp_write_pkt_len + 2;
+}
+
+/** continue ssl handshake */
 static int
 ssl_handshake(struct comm_point* c)
 {
@@ -1224,6 +1844,13 @@ ssl_handshake(struct comm_point* c)
 		c->ssl_shake_state = comm_ssl_shake_none;
 		return 1;
 	}
+#ifdef HAVE_SSL_WRITE_EARLY_DATA
+	if(c->ssl_early_data == 1) {
+		r = ssl_write_early_data(c);
+		if(r != 1)
+			return (r == 2);
+	}
+#endif
 
 	ERR_clear_error();
 	r = SSL_do_handshake(c->ssl);
@@ -1313,6 +1940,24 @@ ssl_handshake(struct comm_point* c)
 		log_addr(VERB_ALGO, "SSL connection", &c->repinfo.addr,
 			c->repinfo.addrlen);
 	}
+#ifdef HAVE_SSL_WRITE_EARLY_DATA
+	if(c->ssl_early_data == 2) {
+		if(SSL_get_early_data_status(c->ssl) !=
+			SSL_EARLY_DATA_ACCEPTED) {
+			/* the server did not take it, write it again */
+			verbose(VERB_ALGO, "SSL early data rejected");
+			c->tcp_write_byte_count = 0;
+		}
+		c->ssl_early_data = 0;
+	}
+#endif
+
+#ifdef SSL_OP_ENABLE_KTLS
+	/* see if the kernel has taken over the sending of TLS records */
+	c->ssl_ktls = (BIO_get_ktls_send(SSL_get_wbio(c->ssl)) != 0);
+	if(c->ssl_ktls)
+		verbose(VERB_ALGO, "SSL connection uses kTLS to send");
+#endif
 
 #ifdef HAVE_SSL_GET0_ALPN_SELECTED
 	/* check if http2 use is negotiated */
@@ -1352,6 +1997,11 @@ ssl_handle_read(struct comm_point* c)
 		if(c->ssl_shake_state != comm_ssl_shake_none)
 			return 1;
 	}
+	if(ssl_early_data_written(c)) {
+		/* the write is done before the answer is read */
+		tcp_callback_writer(c);
+		return 1;
+	}
 	if(c->tcp_byte_count < sizeof(uint16_t)) {
 		/* read length bytes */
 		ERR_clear_error();
@@ -1455,6 +2105,12 @@ ssl_handle_write(struct comm_point* c)
 		if(c->ssl_shake_state != comm_ssl_shake_none)
 			return 1;
 	}
+	if(ssl_early_data_written(c)) {
+		tcp_callback_writer(c);
+		return 1;
+	}
+	if(c->tcp_write_prefixed && c->tcp_byte_count == 0)
+		c->tcp_byte_count = sizeof(uint16_t); /* lengths are in buffer */
 	/* ignore return, if fails we may simply block */
 	(void)SSL_set_mode(c->ssl, (long)SSL_MODE_ENABLE_PARTIAL_WRITE);
 	if((c->tcp_write_and_read?c->tcp_write_byte_count:c->tcp_byte_count) < sizeof(uint16_t)) {
@@ -1743,6 +2399,32 @@ comm_point_tcp_handle_read(int fd, struct comm_point* c, int short_ok)
 	return 1;
 }
 
+/**
+ * Queue the write of the whole buffer on the event base, that sends it
+ * with its other requests.
+ * @param fd: file descriptor of socket.
+ * @param c: comm point to write buffer out of.
+ * @param buffer: the buffer, with the position at the start.
+ * @return 1 if queued, 0 if it has to be written here, -1 if an earlier
+ *	write is still in progress.
+ */
+static int
+tcp_queue_write(int fd, struct comm_point* c, struct sldns_buffer* buffer)
+{
+	uint16_t len = htons(sldns_buffer_limit(buffer));
+	struct iovec iov[2];
+	int n = 0;
+	if(!c->tcp_write_prefixed) {
+		iov[n].iov_base = (uint8_t*)&len;
+		iov[n].iov_len = sizeof(uint16_t);
+		n++;
+	}
+	iov[n].iov_base = sldns_buffer_begin(buffer);
+	iov[n].iov_len = sldns_buffer_limit(buffer);
+	n++;
+	return ub_event_base_send(c->ev->base->eb->base, fd, iov, n);
+}
+
 /** 
  * Handle tcp writing callback. 
  * @param fd: file descriptor of socket.
@@ -1803,9 +2485,26 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 			return 0;
 		}
 	}
-	if(c->ssl)
+	/* with kTLS the kernel makes the records, write like plain TCP */
+	if(c->ssl && !(c->ssl_ktls &&
+		c->ssl_shake_state == comm_ssl_shake_none))
 		return ssl_handle_it(c, 1);
 
+	if(!c->ssl && !c->tcp_write_and_read && c->tcp_byte_count == 0 &&
+		sldns_buffer_position(buffer) == 0) {
+		switch(tcp_queue_write(fd, c, buffer)) {
+		case 1:
+			tcp_callback_writer(c);
+			return 1;
+		case -1:
+			/* the write event fires when the earlier write is
+			 * done */
+			return 1;
+		default:
+			break;
+		}
+	}
+
 #ifdef USE_MSG_FASTOPEN
 	/* Only try this on first use of a connection that uses tfo, 
 	   otherwise fall through to normal write */
@@ -1893,6 +2592,8 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 	}
 #endif /* USE_MSG_FASTOPEN */
 
+	if(c->tcp_write_prefixed && c->tcp_byte_count == 0)
+		c->tcp_byte_count = sizeof(uint16_t); /* lengths are in buffer */
 	if((c->tcp_write_and_read?c->tcp_write_byte_count:c->tcp_byte_count) < sizeof(uint16_t)) {
 		uint16_t len = htons(c->tcp_write_and_read?c->tcp_write_pkt_len:sldns_buffer_limit(buffer));
 #ifdef HAVE_WRITEV
@@ -3272,6 +3973,10 @@ comm_point_create_udp(struct comm_base *base, int fd, sldns_buffer* buffer,
 		comm_point_delete(c);
 		return NULL;
 	}
+	/* a listening socket, the event base can read the queries */
+	if(socket && fd != -1)
+		ub_event_recv_datagrams(c->ev->ev,
+			sldns_buffer_capacity(buffer));
 	if(fd!=-1 && ub_event_add(c->ev->ev, c->timeout) != 0 ) {
 		log_err("could not add udp event");
 		comm_point_delete(c);
@@ -3333,6 +4038,10 @@ comm_point_create_udp_ancil(struct comm_base *base, int fd,
 		comm_point_delete(c);
 		return NULL;
 	}
+	/* a listening socket, the event base can read the queries */
+	if(socket && fd != -1)
+		ub_event_recv_datagrams(c->ev->ev,
+			sldns_buffer_capacity(buffer));
 	if(fd!=-1 && ub_event_add(c->ev->ev, c->timeout) != 0 ) {
 		log_err("could not add udp event");
 		comm_point_delete(c);
@@ -3622,6 +4331,8 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num,
 		comm_point_delete(c);
 		return NULL;
 	}
+	/* the event base can accept the connections */
+	ub_event_accept_conns(c->ev->ev);
 	if (ub_event_add(c->ev->ev, c->timeout) != 0) {
 		log_err("could not add tcpacc event");
 		comm_point_delete(c);
@@ -3945,6 +4656,7 @@ comm_point_close(struct comm_point* c)
 			ub_winsock_tcp_wouldblock(c->ev->ev, UB_EV_READ);
 			ub_winsock_tcp_wouldblock(c->ev->ev, UB_EV_WRITE);
 		}
+		ub_event_base_close_fd(c->ev->base->eb->base, c->fd);
 		verbose(VERB_ALGO, "close fd %d", c->fd);
 		sock_close(c->fd);
 	}
@@ -4139,6 +4851,7 @@ comm_point_start_listening(struct comm_point* c, int newfd, int msec)
 	if(newfd != -1) {
 		if(c->fd != -1 && c->fd != newfd) {
 			verbose(5, "cpsl close of fd %d for %d", c->fd, newfd);
+			ub_event_base_close_fd(c->ev->base->eb->base, c->fd);
 			sock_close(c->fd);
 		}
 		c->fd = newfd;
@@ -103,6 +103,40 @@ typedef int comm_point_callback_type(struct comm_point*, void*, int,
 /** timeout to slow accept calls when not possible, in msec. */
 #define NETEVENT_SLOW_ACCEPT_TIME 2000
 
+/**
+ * Counters for batched UDP reads and writes, per comm_base.
+ */
+struct comm_udp_batch_stats {
+	/** number of recvmmsg calls that returned datagrams */
+	size_t recv_calls;
+	/** number of datagrams read with recvmmsg */
+	size_t recv_pkts;
+	/** number of sendmmsg calls */
+	size_t send_calls;
+	/** number of datagrams written with sendmmsg */
+	size_t send_pkts;
+	/** number of sendmmsg calls for queries to upstream servers */
+	size_t out_calls;
+	/** number of queries to upstream servers written with sendmmsg */
+	size_t out_pkts;
+};
+
+/**
+ * A datagram to send with comm_point_send_udp_msgs.
+ */
+struct comm_udp_msg {
+	/** the datagram contents */
+	uint8_t* data;
+	/** length of the datagram */
+	size_t len;
+	/** destination address */
+	struct sockaddr_storage* addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** set to true if the datagram was sent */
+	int sent;
+};
+
 /**
  * A communication point dispatcher. Thread specific.
  */
@@ -186,6 +220,9 @@ struct comm_point {
 	int tcp_is_reading;
 	/** The current read/write count for TCP */
 	size_t tcp_byte_count;
+	/** The buffer to write holds one or more messages that each have
+	 * their length in front already, write it out as it is */
+	int tcp_write_prefixed;
 	/** parent communication point (for TCP sockets) */
 	struct comm_point* tcp_parent;
 	/** sockaddr from peer, for TCP handlers */
@@ -219,6 +256,13 @@ struct comm_point {
 		/** ssl_read wants to write */
 		comm_ssl_shake_hs_write
 	} ssl_shake_state;
+	/** TLS 1.3 early data, for outgoing streams in write and read mode:
+	 * 0 not used, 1 the packet is written as early data with the
+	 * handshake, 2 it has been written as early data */
+	int ssl_early_data;
+	/** the kernel sends the TLS records (kTLS), after the handshake the
+	 * data is written to the fd directly */
+	int ssl_ktls;
 
 	/* -------- HTTP ------- */
 	/** Do not allow connection to use HTTP version lower than this. 0=no
@@ -451,6 +495,22 @@ void comm_base_delete_no_base(struct comm_base* b);
  */
 void comm_base_delete(struct comm_base* b);
 
+/**
+ * Set the number of datagrams that UDP commpoints read with recvmmsg and
+ * write with sendmmsg per system call.  Without recvmmsg and sendmmsg
+ * support this does nothing.
+ * @param b: the communication base.
+ * @param num: datagrams per batch, 0 or 1 reads them one by one.
+ */
+void comm_base_set_udp_batch(struct comm_base* b, int num);
+
+/**
+ * Get the UDP batch counters of the comm base.
+ * @param b: the communication base.
+ * @return pointer to the counters, the caller may reset them.
+ */
+struct comm_udp_batch_stats* comm_base_udp_batch_stats(struct comm_base* b);
+
 /**
  * Obtain two pointers. The pointers never change (until base_delete()).
  * The pointers point to time values that are updated regularly.
@@ -647,6 +707,20 @@ void comm_point_drop_reply(struct comm_reply* repinfo);
 int comm_point_send_udp_msg(struct comm_point* c, struct sldns_buffer* packet,
 	struct sockaddr* addr, socklen_t addrlen,int is_connected);
 
+/**
+ * Send several udp messages over a commpoint, with sendmmsg system calls
+ * if available.  Used for queries to upstream servers.
+ * @param c: commpoint to send them from.
+ * @param msgs: the datagrams.  The sent flag is set for the datagrams
+ * 	that were sent.
+ * @param num: number of datagrams in msgs.
+ * @param is_connected: if the UDP socket is connect()ed, then the
+ * 	destination address is not passed to the system call.
+ * @return: the number of datagrams that were sent.
+ */
+int comm_point_send_udp_msgs(struct comm_point* c, struct comm_udp_msg* msgs,
+	int num, int is_connected);
+
 /**
  * Stop listening for input on the commpoint. No callbacks will happen.
  * @param c: commpoint to disable. The fd is not closed.
@@ -680,6 +754,14 @@ void comm_point_listen_for_rw(struct comm_point* c, int rd, int wr);
  */
 int adjusted_tcp_timeout(struct comm_point* c);
 
+/**
+ * See if the next message on the TLS stream has been read into the TLS
+ * buffers already, whole, so that reading it does not wait for the socket.
+ * @param c: the TCP commpoint.
+ * @return true if the length and the message are in the buffers.
+ */
+int comm_point_tls_msg_pending(struct comm_point* c);
+
 /**
  * Get size of memory used by comm point.
  * For TCP handlers this includes subhandlers.
@@ -58,9 +58,96 @@ calc_rto(const struct rtt_info* rtt)
 	return rto;
 }
 
+/** get the histogram bucket for a roundtrip time */
+static int
+rtt_hist_bucket(int ms)
+{
+	int k = 1;
+	if(ms < 2)
+		return 0;
+	while(k < RTT_HIST_BUCKETS/2 && ms >= (2<<k))
+		k++;
+	if(k == RTT_HIST_BUCKETS/2)
+		return RTT_HIST_BUCKETS-1;
+	/* lower or upper half of [2^k, 2^(k+1)) */
+	return 2*k - 1 + (ms >= (1<<k) + (1<<(k-1)));
+}
+
+int
+rtt_hist_bucket_low(int i)
+{
+	int k = (i+1)/2;
+	if(i <= 0)
+		return 0;
+	if((i+1)%2)
+		return (1<<k) + (1<<(k-1));
+	return (1<<k);
+}
+
+/** make room in the histogram for a new observation, by halving the
+ * weights when it is full, the older observations fade out that way */
+static void
+rtt_hist_decay(struct rtt_hist* hist)
+{
+	int i;
+	if(hist->total + RTT_HIST_ONE <= RTT_HIST_MAX)
+		return;
+	hist->total = 0;
+	for(i=0; i<RTT_HIST_BUCKETS; i++) {
+		hist->bucket[i] /= 2;
+		hist->total += hist->bucket[i];
+	}
+	hist->lost /= 2;
+	hist->total += hist->lost;
+}
+
+/** add an answered query to the histogram */
+static void
+rtt_hist_add(struct rtt_hist* hist, int ms)
+{
+	rtt_hist_decay(hist);
+	hist->bucket[rtt_hist_bucket(ms)] += RTT_HIST_ONE;
+	hist->total += RTT_HIST_ONE;
+}
+
+/** add a query that timed out to the histogram */
+static void
+rtt_hist_lost(struct rtt_hist* hist)
+{
+	rtt_hist_decay(hist);
+	hist->lost += RTT_HIST_ONE;
+	hist->total += RTT_HIST_ONE;
+}
+
+int
+rtt_hist_percentile(const struct rtt_hist* hist, int percentile, int lostval)
+{
+	int i, answered = hist->total - hist->lost;
+	int total = (lostval == -1?answered:hist->total);
+	int target, cum = 0, low, high;
+	if(answered < RTT_HIST_MIN*RTT_HIST_ONE)
+		return -1;
+	target = (total*percentile + 99)/100;
+	for(i=0; i<RTT_HIST_BUCKETS; i++) {
+		if(hist->bucket[i] == 0 || cum + hist->bucket[i] < target) {
+			cum += hist->bucket[i];
+			continue;
+		}
+		/* interpolate within the bucket */
+		low = rtt_hist_bucket_low(i);
+		if(i == RTT_HIST_BUCKETS-1)
+			return low;
+		high = rtt_hist_bucket_low(i+1);
+		return low + (high-low)*(target-cum)/hist->bucket[i];
+	}
+	/* the percentile is in the queries that timed out */
+	return lostval;
+}
+
 void 
 rtt_init(struct rtt_info* rtt)
 {
+	memset(&rtt->hist, 0, sizeof(rtt->hist));
 	rtt->srtt = 0;
 	rtt->rttvar = UNKNOWN_SERVER_NICENESS/4;
 	rtt->rto = calc_rto(rtt);
@@ -94,11 +181,15 @@ rtt_update(struct rtt_info* rtt, int ms)
 		delta = -delta; /* |delta| */
 	rtt->rttvar += (delta - rtt->rttvar) / 4; /* h = 1/4 */
 	rtt->rto = calc_rto(rtt);
+	rtt_hist_add(&rtt->hist, ms);
 }
 
 void 
 rtt_lost(struct rtt_info* rtt, int orig)
 {
+	/* every query that timed out counts for the distribution */
+	rtt_hist_lost(&rtt->hist);
+
 	/* exponential backoff */
 
 	/* if a query succeeded and put down the rto meanwhile, ignore this */
@@ -120,3 +211,53 @@ int rtt_notimeout(const struct rtt_info* rtt)
 {
 	return calc_rto(rtt);
 }
+
+/** normal distribution quantiles, in hundredths, for percentiles */
+static const struct {
+	int pct;
+	int z;
+} rtt_quantiles[] = { {50, 0}, {60, 25}, {70, 52}, {75, 67}, {80, 84},
+	{85, 104}, {90, 128}, {95, 164}, {97, 188}, {98, 205}, {99, 233} };
+
+/** estimate a percentile from srtt and rttvar */
+static int
+rtt_normal_percentile(const struct rtt_info* rtt, int percentile)
+{
+	size_t i, n = sizeof(rtt_quantiles)/sizeof(rtt_quantiles[0]);
+	int z = rtt_quantiles[n-1].z;
+	if(percentile <= rtt_quantiles[0].pct)
+		return rtt->srtt;
+	for(i=1; i<n; i++) {
+		if(percentile <= rtt_quantiles[i].pct) {
+			/* interpolate between the table entries */
+			z = rtt_quantiles[i-1].z + (rtt_quantiles[i].z -
+				rtt_quantiles[i-1].z) * (percentile -
+				rtt_quantiles[i-1].pct) / (rtt_quantiles[i].pct -
+				rtt_quantiles[i-1].pct);
+			break;
+		}
+	}
+	/* the standard deviation is about 1.25 times the mean deviation */
+	return rtt->srtt + z * rtt->rttvar * 5 / 400;
+}
+
+int rtt_percentile(const struct rtt_info* rtt, int percentile)
+{
+	int v = rtt_hist_percentile(&rtt->hist, percentile, -1);
+	if(v == -1)
+		return rtt_normal_percentile(rtt, percentile);
+	return v;
+}
+
+int rtt_select_percentile(const struct rtt_info* rtt, int percentile)
+{
+	int v;
+	if(calc_rto(rtt) != rtt->rto) {
+		/* timeout fallback has happened */
+		return rtt->rto;
+	}
+	v = rtt_hist_percentile(&rtt->hist, percentile, rtt->rto);
+	if(v == -1)
+		return rtt_normal_percentile(rtt, percentile);
+	return v;
+}
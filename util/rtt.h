@@ -43,6 +43,32 @@
 #ifndef UTIL_RTT_H
 #define UTIL_RTT_H
 
+/** number of buckets in the rtt histogram; two buckets per power of two,
+ * the first bucket holds 0 and 1 msec, the last bucket holds everything
+ * from 4096 msec and up */
+#define RTT_HIST_BUCKETS 24
+/** weight that one observation adds to the histogram */
+#define RTT_HIST_ONE 16
+/** when the total weight exceeds this, the histogram decays by half */
+#define RTT_HIST_MAX (64*RTT_HIST_ONE)
+/** number of answered observations needed before percentiles are taken
+ * from the histogram */
+#define RTT_HIST_MIN 4
+
+/**
+ * Decaying histogram of roundtrip times, with logarithmic buckets.
+ * Weights are halved when the total grows too large, so the histogram
+ * reflects the last 32 to 64 observations.
+ */
+struct rtt_hist {
+	/** weight per bucket of answered queries */
+	uint16_t bucket[RTT_HIST_BUCKETS];
+	/** weight of queries that timed out */
+	uint16_t lost;
+	/** total weight, of the buckets and the lost queries */
+	uint16_t total;
+};
+
 /**
  * RTT information. Keeps packet Round Trip Time.
  */
@@ -53,6 +79,8 @@ struct rtt_info {
 	int rttvar;
 	/** current RTO in use, in milliseconds */
 	int rto;
+	/** distribution of the roundtrip times */
+	struct rtt_hist hist;
 };
 
 /** min retransmit timeout value, in milliseconds */
@@ -104,4 +132,43 @@ void rtt_update(struct rtt_info* rtt, int ms);
  */
 void rtt_lost(struct rtt_info* rtt, int orig);
 
+/**
+ * Estimate a percentile of the roundtrip time distribution of answered
+ * queries.  Taken from the histogram if it has enough observations,
+ * otherwise from the smoothed rtt and mean deviation, assuming a normal
+ * distribution.
+ * @param rtt: round trip statistics structure.
+ * @param percentile: the percentile, 50 to 99.
+ * @return: value in msec.
+ */
+int rtt_percentile(const struct rtt_info* rtt, int percentile);
+
+/**
+ * Get a percentile of the roundtrip time to use for server selection.
+ * Queries that timed out count as taking the current timeout.
+ * Like rtt_unclamped, recent timeouts are reflected in the value.
+ * @param rtt: round trip statistics structure.
+ * @param percentile: the percentile, 50 to 99.
+ * @return: value to use in milliseconds.
+ */
+int rtt_select_percentile(const struct rtt_info* rtt, int percentile);
+
+/**
+ * Get a percentile from the histogram.
+ * @param hist: the histogram.
+ * @param percentile: the percentile, 1 to 100.
+ * @param lostval: the value for queries that timed out, or -1 to
+ * 	only use the answered queries.
+ * @return: value in msec, or -1 if there are not enough observations.
+ */
+int rtt_hist_percentile(const struct rtt_hist* hist, int percentile,
+	int lostval);
+
+/**
+ * Get the lowest roundtrip time that falls in a histogram bucket.
+ * @param i: bucket number, 0 .. RTT_HIST_BUCKETS-1.
+ * @return: value in msec.
+ */
+int rtt_hist_bucket_low(int i);
+
 #endif /* UTIL_RTT_H */
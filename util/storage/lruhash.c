@@ -44,6 +44,44 @@
 #include "util/storage/lruhash.h"
 #include "util/fptr_wlist.h"
 
+#ifdef UB_THREAD_LOCAL
+/** the NUMA node of the thread, it is read on every lookup hit */
+static UB_THREAD_LOCAL int thread_node = 0;
+#else
+/** key for the NUMA node of the thread */
+static ub_thread_key_type nodekey;
+#endif
+/** if the nodes of the threads are kept */
+static int node_kept = 0;
+
+/** read the lookup array of the table, lookups do this without the
+ * hashtable lock, the acquire pairs with the release in lookup_store */
+static struct lruhash_array*
+lookup_load(struct lruhash* table)
+{
+#if defined(HAVE_STDATOMIC_H)
+	return atomic_load_explicit(&table->lookup, memory_order_acquire);
+#elif defined(__ATOMIC_ACQUIRE)
+	return __atomic_load_n(&table->lookup, __ATOMIC_ACQUIRE);
+#else
+	return table->lookup;
+#endif
+}
+
+/** publish a new lookup array, the stores that filled it in are visible
+ * to lookups that read the pointer. Called with the hashtable lock */
+static void
+lookup_store(struct lruhash* table, struct lruhash_array* lookup)
+{
+#if defined(HAVE_STDATOMIC_H)
+	atomic_store_explicit(&table->lookup, lookup, memory_order_release);
+#elif defined(__ATOMIC_RELEASE)
+	__atomic_store_n(&table->lookup, lookup, __ATOMIC_RELEASE);
+#else
+	table->lookup = lookup;
+#endif
+}
+
 void
 bin_init(struct lruhash_bin* array, size_t size)
 {
@@ -66,6 +104,7 @@ lruhash_create(size_t start_size, size_t maxmem,
 {
 	struct lruhash* table = (struct lruhash*)calloc(1, 
 		sizeof(struct lruhash));
+	struct lruhash_array* lookup;
 	if(!table)
 		return NULL;
 	lock_quick_init(&table->lock);
@@ -82,12 +121,19 @@ lruhash_create(size_t start_size, size_t maxmem,
 	table->space_used = 0;
 	table->space_max = maxmem;
 	table->array = calloc(table->size, sizeof(struct lruhash_bin));
-	if(!table->array) {
+	lookup = calloc(1, sizeof(struct lruhash_array));
+	if(!table->array || !lookup) {
 		lock_quick_destroy(&table->lock);
+		free(table->array);
+		free(lookup);
 		free(table);
 		return NULL;
 	}
 	bin_init(table->array, table->size);
+	lookup->size = table->size;
+	lookup->size_mask = table->size_mask;
+	lookup->bins = table->array;
+	lookup_store(table, lookup);
 	lock_protect(&table->lock, table, sizeof(*table));
 	lock_protect(&table->lock, table->array, 
 		table->size*sizeof(struct lruhash_bin));
@@ -130,8 +176,13 @@ bin_split(struct lruhash* table, struct lruhash_bin* newa,
 	/* LRU list is not changed */
 	for(i=0; i<table->size; i++)
 	{
+		/* the old bin stays locked, until the new array is in use */
 		lock_quick_lock(&table->array[i].lock);
 		p = table->array[i].overflow_list;
+		table->array[i].overflow_list = NULL;
+		table->num_hits += table->array[i].num_hits;
+		table->num_misses += table->array[i].num_misses;
+		table->num_remote += table->array[i].num_remote;
 		/* lock both destination bins */
 		lock_quick_lock(&newa[i].lock);
 		lock_quick_lock(&newa[newbit|i].lock);
@@ -145,7 +196,6 @@ bin_split(struct lruhash* table, struct lruhash_bin* newa,
 		}
 		lock_quick_unlock(&newa[i].lock);
 		lock_quick_unlock(&newa[newbit|i].lock);
-		lock_quick_unlock(&table->array[i].lock);
 	}
 }
 
@@ -153,6 +203,7 @@ void
 lruhash_delete(struct lruhash* table)
 {
 	size_t i;
+	struct lruhash_array* a, *na;
 	if(!table)
 		return;
 	/* delete lock on hashtable to force check its OK */
@@ -160,6 +211,17 @@ lruhash_delete(struct lruhash* table)
 	for(i=0; i<table->size; i++)
 		bin_delete(table, &table->array[i]);
 	free(table->array);
+	/* the retired arrays are empty, their entries moved on */
+	a = lookup_load(table)->retired;
+	while(a) {
+		na = a->retired;
+		for(i=0; i<a->size; i++)
+			lock_quick_destroy(&a->bins[i].lock);
+		free(a->bins);
+		free(a);
+		a = na;
+	}
+	free(lookup_load(table));
 	free(table);
 }
 
@@ -178,26 +240,67 @@ bin_overflow_remove(struct lruhash_bin* bin, struct lruhash_entry* entry)
 	}
 }
 
+/**
+ * Select the entry to remove, with the eviction policy of the table.
+ * Referenced entries get a second chance, at most once around the table,
+ * so that lookups that keep referencing do not stall the reclaim.
+ * Caller must hold hash table lock, and the table must not be empty.
+ * @param table: hash table.
+ * @return the entry to remove.
+ */
+static struct lruhash_entry*
+reclaim_select(struct lruhash* table)
+{
+	struct lruhash_entry* d, *newest;
+	size_t n = table->num;
+	if(table->policy == lruhash_policy_sieve) {
+		/* the hand clears reference bits, and does not move
+		 * entries, on its way from old to new entries. It skips
+		 * the newest entry, that may have just been inserted. */
+		d = table->sieve_hand;
+		if(!d || d == table->lru_start)
+			d = table->lru_end;
+		while(d->lru_ref && n--) {
+			d->lru_ref = 0;
+			d = d->lru_prev;
+			if(d == table->lru_start)
+				d = table->lru_end;
+		}
+		table->sieve_hand = d->lru_prev;
+		return d;
+	}
+	/* referenced by a lookup since it was last here; move it
+	 * to the front. The newest entry, that may have just been
+	 * inserted, is not referenced yet; it is moved to the front
+	 * as well, so that it is not evicted when all the older
+	 * entries are referenced. */
+	newest = table->lru_start;
+	d = table->lru_end;
+	while((d->lru_ref || d == newest) && n--) {
+		d->lru_ref = 0;
+		lru_touch(table, d);
+		d = table->lru_end;
+	}
+	return d;
+}
+
 void 
 reclaim_space(struct lruhash* table, struct lruhash_entry** list)
 {
 	struct lruhash_entry* d;
 	struct lruhash_bin* bin;
 	log_assert(table);
-	/* does not delete MRU entry, so table will not be empty. */
+	/* does not delete the last entry, so table will not be empty. */
 	while(table->num > 1 && table->space_used > table->space_max) {
 		/* notice that since we hold the hashtable lock, nobody
 		   can change the lru chain. So it cannot be deleted underneath
 		   us. We still need the hashbin and entry write lock to make 
 		   sure we flush all users away from the entry. 
 		   which is unlikely, since it is LRU, if someone got a rdlock
-		   it would be moved to front, but to be sure. */
-		d = table->lru_end;
-		/* specialised, delete from end of double linked list,
-		   and we know num>1, so there is a previous lru entry. */
-		log_assert(d && d->lru_prev);
-		table->lru_end = d->lru_prev;
-		d->lru_prev->lru_next = NULL;
+		   it would have gotten a second chance, but to be sure. */
+		d = reclaim_select(table);
+		log_assert(d);
+		lru_remove(table, d);
 		/* schedule entry for deletion */
 		bin = &table->array[d->hash & table->size_mask];
 		table->num --;
@@ -230,35 +333,48 @@ bin_find_entry(struct lruhash* table,
 void 
 table_grow(struct lruhash* table)
 {
-	struct lruhash_bin* newa;
+	struct lruhash_bin* newa, *olda;
+	struct lruhash_array* newlookup;
 	int newmask;
-	size_t i;
+	size_t i, oldsize;
 	if(table->size_mask == (int)(((size_t)-1)>>1)) {
 		log_err("hash array malloc: size_t too small");
 		return;
 	}
 	/* try to allocate new array, if not fail */
 	newa = calloc(table->size*2, sizeof(struct lruhash_bin));
-	if(!newa) {
+	newlookup = calloc(1, sizeof(struct lruhash_array));
+	if(!newa || !newlookup) {
 		log_err("hash grow: malloc failed");
+		free(newa);
+		free(newlookup);
 		/* continue with smaller array. Though its slower. */
 		return;
 	}
 	bin_init(newa, table->size*2);
 	newmask = (table->size_mask << 1) | 1;
 	bin_split(table, newa, newmask);
-	/* delete the old bins */
+	/* the old bins are empty and locked, lookups waiting on them
+	 * see the new lookup array when they get the lock, and retry.
+	 * They are not deleted, a lookup may still look at them. */
 	lock_unprotect(&table->lock, table->array);
-	for(i=0; i<table->size; i++) {
-		lock_quick_destroy(&table->array[i].lock);
-	}
-	free(table->array);
+	olda = table->array;
+	oldsize = table->size;
 	
 	table->size *= 2;
 	table->size_mask = newmask;
 	table->array = newa;
+	newlookup->size = table->size;
+	newlookup->size_mask = table->size_mask;
+	newlookup->bins = table->array;
+	newlookup->retired = lookup_load(table);
+	/* publish the filled in array, with the bins split into it */
+	lookup_store(table, newlookup);
 	lock_protect(&table->lock, table->array, 
 		table->size*sizeof(struct lruhash_bin));
+	for(i=0; i<oldsize; i++) {
+		lock_quick_unlock(&olda[i].lock);
+	}
 	return;
 }
 
@@ -276,6 +392,8 @@ lru_front(struct lruhash* table, struct lruhash_entry* entry)
 void 
 lru_remove(struct lruhash* table, struct lruhash_entry* entry)
 {
+	if(entry == table->sieve_hand)
+		table->sieve_hand = entry->lru_prev;
 	if(entry->lru_prev)
 		entry->lru_prev->lru_next = entry->lru_next;
 	else	table->lru_start = entry->lru_next;
@@ -288,6 +406,11 @@ void
 lru_touch(struct lruhash* table, struct lruhash_entry* entry)
 {
 	log_assert(table && entry);
+	if(table->policy == lruhash_policy_sieve) {
+		/* sieve does not move entries */
+		entry->lru_ref = 1;
+		return;
+	}
 	if(entry == table->lru_start)
 		return; /* nothing to do */
 	/* remove from current lru position */
@@ -319,6 +442,8 @@ lruhash_insert(struct lruhash* table, hashvalue_type hash,
 	/* see if entry exists already */
 	if(!(found=bin_find_entry(table, bin, hash, entry->key))) {
 		/* if not: add to bin */
+		entry->lru_ref = 0;
+		entry->node = (uint8_t)lruhash_thread_node();
 		entry->overflow_next = bin->overflow_list;
 		bin->overflow_list = entry;
 		lru_front(table, entry);
@@ -357,14 +482,26 @@ lruhash_lookup(struct lruhash* table, hashvalue_type hash, void* key, int wr)
 {
 	struct lruhash_entry* entry;
 	struct lruhash_bin* bin;
+	struct lruhash_array* lookup;
 	fptr_ok(fptr_whitelist_hash_compfunc(table->compfunc));
 
-	lock_quick_lock(&table->lock);
-	bin = &table->array[hash & table->size_mask];
-	lock_quick_lock(&bin->lock);
-	if((entry=bin_find_entry(table, bin, hash, key)))
-		lru_touch(table, entry);
-	lock_quick_unlock(&table->lock);
+	/* no hashtable lock; if the table grew before we got the bin lock,
+	 * the bin is empty and the lookup array changed, try again */
+	while(1) {
+		lookup = lookup_load(table);
+		bin = &lookup->bins[hash & lookup->size_mask];
+		lock_quick_lock(&bin->lock);
+		if(lookup == lookup_load(table))
+			break;
+		lock_quick_unlock(&bin->lock);
+	}
+	if((entry=bin_find_entry(table, bin, hash, key))) {
+		entry->lru_ref = 1;
+		bin->num_hits++;
+		if(node_kept &&
+			entry->node != (uint8_t)lruhash_thread_node())
+			bin->num_remote++;
+	} else	bin->num_misses++;
 
 	if(entry) {
 		if(wr)	{ lock_rw_wrlock(&entry->lock); }
@@ -374,6 +511,43 @@ lruhash_lookup(struct lruhash* table, hashvalue_type hash, void* key, int wr)
 	return entry;
 }
 
+void
+lruhash_update_entry_size(struct lruhash* table, hashvalue_type hash,
+	void* key, void* data, size_t* size, int diff, void* cb_arg)
+{
+	struct lruhash_bin* bin;
+	struct lruhash_entry* found, *reclaimlist = NULL;
+	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
+	fptr_ok(fptr_whitelist_hash_deldatafunc(table->deldatafunc));
+	fptr_ok(fptr_whitelist_hash_compfunc(table->compfunc));
+	fptr_ok(fptr_whitelist_hash_markdelfunc(table->markdelfunc));
+	if(cb_arg == NULL) cb_arg = table->cb_arg;
+
+	lock_quick_lock(&table->lock);
+	bin = &table->array[hash & table->size_mask];
+	lock_quick_lock(&bin->lock);
+	/* the data is changed with the hashtable lock, if it is not the
+	 * same, it was replaced or deleted and counted already */
+	if((found=bin_find_entry(table, bin, hash, key)) &&
+		found->data == data) {
+		*size += diff;
+		table->space_used += diff;
+	}
+	lock_quick_unlock(&bin->lock);
+	if(table->space_used > table->space_max)
+		reclaim_space(table, &reclaimlist);
+	lock_quick_unlock(&table->lock);
+
+	/* finish reclaim if any (outside of critical region) */
+	while(reclaimlist) {
+		struct lruhash_entry* n = reclaimlist->overflow_next;
+		void* d = reclaimlist->data;
+		(*table->delkeyfunc)(reclaimlist->key, cb_arg);
+		(*table->deldatafunc)(d, cb_arg);
+		reclaimlist = n;
+	}
+}
+
 void 
 lruhash_remove(struct lruhash* table, hashvalue_type hash, void* key)
 {
@@ -450,6 +624,7 @@ lruhash_clear(struct lruhash* table)
 	}
 	table->lru_start = NULL;
 	table->lru_end = NULL;
+	table->sieve_hand = NULL;
 	table->num = 0;
 	table->space_used = 0;
 	lock_quick_unlock(&table->lock);
@@ -493,6 +668,7 @@ size_t
 lruhash_get_mem(struct lruhash* table)
 {
 	size_t s;
+	struct lruhash_array* a;
 	lock_quick_lock(&table->lock);
 	s = sizeof(struct lruhash) + table->space_used;
 #ifdef USE_THREAD_DEBUG
@@ -507,6 +683,15 @@ lruhash_get_mem(struct lruhash* table)
 		s += (table->size)*(sizeof(struct lruhash_bin) + 
 			lock_get_mem(&table->array[0].lock));
 #endif
+	/* the current lookup array, and the retired ones with their bins */
+	a = lookup_load(table);
+	s += sizeof(struct lruhash_array);
+	for(a = a->retired; a; a = a->retired) {
+		s += sizeof(struct lruhash_array);
+		if(a->size != 0)
+			s += (a->size)*(sizeof(struct lruhash_bin) +
+				lock_get_mem(&a->bins[0].lock));
+	}
 	lock_quick_unlock(&table->lock);
 	s += lock_get_mem(&table->lock);
 	return s;
@@ -520,6 +705,91 @@ lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md)
 	lock_quick_unlock(&table->lock);
 }
 
+void
+lruhash_set_policy(struct lruhash* table, enum lruhash_policy policy)
+{
+	lock_quick_lock(&table->lock);
+	table->policy = policy;
+	table->sieve_hand = NULL;
+	lock_quick_unlock(&table->lock);
+}
+
+enum lruhash_policy
+lruhash_policy_from_str(const char* str)
+{
+	if(str && strcmp(str, "sieve") == 0)
+		return lruhash_policy_sieve;
+	return lruhash_policy_lru;
+}
+
+void
+lruhash_get_hits(struct lruhash* table, size_t* hits, size_t* misses,
+	size_t* remote, int reset)
+{
+	size_t i;
+	lock_quick_lock(&table->lock);
+	*hits = table->num_hits;
+	*misses = table->num_misses;
+	*remote = table->num_remote;
+	if(reset) {
+		table->num_hits = 0;
+		table->num_misses = 0;
+		table->num_remote = 0;
+	}
+	for(i=0; i<table->size; i++) {
+		lock_quick_lock(&table->array[i].lock);
+		*hits += table->array[i].num_hits;
+		*misses += table->array[i].num_misses;
+		*remote += table->array[i].num_remote;
+		if(reset) {
+			table->array[i].num_hits = 0;
+			table->array[i].num_misses = 0;
+			table->array[i].num_remote = 0;
+		}
+		lock_quick_unlock(&table->array[i].lock);
+	}
+	lock_quick_unlock(&table->lock);
+}
+
+void
+lruhash_thread_node_init(void)
+{
+	if(node_kept)
+		return;
+#ifndef UB_THREAD_LOCAL
+	ub_thread_key_create(&nodekey, NULL);
+#endif
+	node_kept = 1;
+}
+
+void
+lruhash_thread_node_set(int* node)
+{
+	if(!node_kept)
+		return;
+#ifdef UB_THREAD_LOCAL
+	thread_node = node?*node:0;
+#else
+	ub_thread_key_set(nodekey, node);
+#endif
+}
+
+int
+lruhash_thread_node(void)
+{
+#ifndef UB_THREAD_LOCAL
+	int* node;
+#endif
+	if(!node_kept)
+		return 0;
+#ifdef UB_THREAD_LOCAL
+	return thread_node;
+#else
+	node = (int*)ub_thread_key_get(nodekey);
+	return node?*node:0;
+#endif
+}
+
 void 
 lruhash_traverse(struct lruhash* h, int wr, 
 	void (*func)(struct lruhash_entry*, void*), void* arg)
@@ -553,6 +823,8 @@ void
 lru_demote(struct lruhash* table, struct lruhash_entry* entry)
 {
 	log_assert(table && entry);
+	/* no second chance from an earlier lookup */
+	entry->lru_ref = 0;
 	if (entry == table->lru_end)
 		return; /* nothing to do */
 	/* remove from current lru position */
@@ -600,6 +872,8 @@ lruhash_insert_or_retrieve(struct lruhash* table, hashvalue_type hash,
 	else
 	{
 		/* if not: add to bin */
+		entry->lru_ref = 0;
+		entry->node = (uint8_t)lruhash_thread_node();
 		entry->overflow_next = bin->overflow_list;
 		bin->overflow_list = entry;
 		lru_front(table, entry);
@@ -42,24 +42,35 @@
  * to make space for new entries.
  *
  * The locking strategy is as follows:
- * 	o since (almost) every read also implies a LRU update, the
- *	  hashtable lock is a spinlock, not rwlock.
+ *	o the hashtable lock is a spinlock, not rwlock. It is taken by
+ *	  insert, remove and the other changes, not by lookups.
  *	o the idea is to move every thread through the hash lock quickly,
  *	  so that the next thread can access the lookup table.
  *	o User performs hash function.
  *
  * For read:
- *	o lock hashtable.
- *		o lookup hash bin.
- *		o lock hash bin.
- *			o find entry (if failed, unlock hash, unl bin, exit).
- *			o swizzle pointers for LRU update.
- *		o unlock hashtable.
+ *	o read the lookup array pointer (without hashtable lock).
+ *	o lookup hash bin.
+ *	o lock hash bin.
+ *		o if the lookup array was replaced meanwhile, because the
+ *		  table grew, unlock the bin and start again.
+ *		o find entry (if failed, unl bin, exit).
+ *		o set the reference bit of the entry.
  *		o lock entry (rwlock).
- *		o unlock hash bin.
- *		o work on entry.
+ *	o unlock hash bin.
+ *	o work on entry.
  *	o unlock entry.
  *
+ * Lookups do not move entries in the LRU list, since that needs the
+ * hashtable lock. They set a reference bit on the entry, and when
+ * space is reclaimed a referenced entry at the end of the LRU list
+ * gets a second chance: its bit is cleared and it is moved to the front
+ * (the CLOCK approximation of LRU).
+ * When the table grows, the bins of the old array are locked while the
+ * entries are moved, and the old array is kept until the table is
+ * deleted, so that a lookup that still holds a pointer to it does not
+ * touch freed memory.
+ *
  * To update an entry, gain writelock and change the entry.
  * (the entry must keep the same hashvalue, so a data update.)
  * (you cannot upgrade a readlock to a writelock, because the item may
@@ -107,6 +118,9 @@
 #ifndef UTIL_STORAGE_LRUHASH_H
 #define UTIL_STORAGE_LRUHASH_H
 #include "util/locks.h"
+#ifdef HAVE_STDATOMIC_H
+#include <stdatomic.h>
+#endif
 struct lruhash_bin;
 struct lruhash_entry;
 
@@ -118,6 +132,21 @@ struct lruhash_entry;
 /** the type of a hash value */
 typedef uint32_t hashvalue_type;
 
+/**
+ * Eviction policy of the hash table, it picks the entry that is removed
+ * when space is needed.
+ */
+enum lruhash_policy {
+	/** least recently used. Lookups set the reference bit and the
+	 * entry is moved to the front when it reaches the end of the list. */
+	lruhash_policy_lru = 0,
+	/** SIEVE. Entries stay in insertion order, a hand walks from old
+	 * to new and clears reference bits until it finds an entry that
+	 * was not referenced. Entries that are not looked up again after
+	 * insertion, like a sweep of random names, are removed first. */
+	lruhash_policy_sieve
+};
+
 /** 
  * Type of function that calculates the size of an entry.
  * Result must include the size of struct lruhash_entry. 
@@ -141,6 +170,31 @@ typedef void (*lruhash_deldatafunc_type)(void*, void*);
  * called: func(key) */
 typedef void (*lruhash_markdelfunc_type)(void*);
 
+/**
+ * Lookup array of a hash table, with its size. Lookups use it without
+ * the hashtable lock, so it is replaced, not changed, when the table grows.
+ */
+struct lruhash_array {
+	/** the size of the lookup array */
+	size_t size;
+	/** size bitmask - since size is a power of 2 */
+	int size_mask;
+	/** lookup array of bins */
+	struct lruhash_bin* bins;
+	/** older, retired, lookup arrays; freed when the table is deleted */
+	struct lruhash_array* retired;
+};
+
+#ifdef HAVE_STDATOMIC_H
+/** pointer to the lookup array, stored with release and read with acquire
+ * ordering, so that a lookup sees the filled in array */
+typedef struct lruhash_array* _Atomic lruhash_array_ptr_type;
+#else
+/** pointer to the lookup array, without stdatomic the compiler atomic
+ * builtins, if any, are used for it */
+typedef struct lruhash_array* volatile lruhash_array_ptr_type;
+#endif
+
 /**
  * Hash table that keeps LRU list of entries.
  */
@@ -166,6 +220,9 @@ struct lruhash {
 	int size_mask;
 	/** lookup array of bins */
 	struct lruhash_bin* array;
+	/** the lookup array as used by lookups, that do not take the
+	 * hashtable lock. Has the same bins, size and mask as above. */
+	lruhash_array_ptr_type lookup;
 
 	/** the lru list, start and end, noncyclical double linked list. */
 	struct lruhash_entry* lru_start;
@@ -178,6 +235,18 @@ struct lruhash {
 	size_t space_used;
 	/** the amount of space the hash table is maximally allowed to use. */
 	size_t space_max;
+
+	/** the eviction policy */
+	enum lruhash_policy policy;
+	/** the SIEVE hand, the next entry to look at for eviction, it
+	 * moves towards lru_start. NULL starts again at lru_end. */
+	struct lruhash_entry* sieve_hand;
+	/** lookup hits counted in bins that are no longer in use */
+	size_t num_hits;
+	/** lookup misses counted in bins that are no longer in use */
+	size_t num_misses;
+	/** remote node hits counted in bins that are no longer in use */
+	size_t num_remote;
 };
 
 /**
@@ -191,6 +260,13 @@ struct lruhash_bin {
 	lock_quick_type lock;
 	/** linked list of overflow entries */
 	struct lruhash_entry* overflow_list;
+	/** number of lookups that found an entry in this bin */
+	size_t num_hits;
+	/** number of lookups that found no entry in this bin */
+	size_t num_misses;
+	/** number of hits on entries that a thread of another NUMA node
+	 * stored */
+	size_t num_remote;
 };
 
 /**
@@ -216,6 +292,12 @@ struct lruhash_entry {
 	struct lruhash_entry* lru_prev;
 	/** hash value of the key. It may not change, until entry deleted. */
 	hashvalue_type hash;
+	/** reference bit, set by lookups, cleared when the entry gets a
+	 * second chance at the end of the lru list. */
+	volatile uint8_t lru_ref;
+	/** the NUMA node of the thread that stored the entry, the memory
+	 * of the entry is on that node */
+	uint8_t node;
 	/** key */
 	void* key;
 	/** data */
@@ -288,8 +370,28 @@ void lruhash_insert(struct lruhash* table, hashvalue_type hash,
 struct lruhash_entry* lruhash_lookup(struct lruhash* table,
 	hashvalue_type hash, void* key, int wr);
 
+/**
+ * Change the size of the data of an entry, that the size function returns.
+ * The entry must not be locked by the caller. If the entry is not in the
+ * table with the data any more, nothing is changed, because the size was
+ * subtracted when the data was replaced or deleted.
+ * If necessary the least recently used entries are deleted to make space.
+ * @param table: hash table.
+ * @param hash: hash of key.
+ * @param key: what to look for.
+ * @param data: the data of the entry.
+ * @param size: the part of the data size that is changed, it is updated
+ *	with the hashtable lock, so that the size function and the space
+ *	used by the table stay the same.
+ * @param diff: the change in size, can be negative.
+ * @param cb_override: if not NULL overrides the cb_arg for deletefunc.
+ */
+void lruhash_update_entry_size(struct lruhash* table, hashvalue_type hash,
+	void* key, void* data, size_t* size, int diff, void* cb_override);
+
 /**
  * Touch entry, so it becomes the most recently used in the LRU list.
+ * With the sieve policy the entry is not moved, but marked as referenced.
  * Caller must hold hash table lock. The entry must be inserted already.
  * @param table: hash table.
  * @param entry: entry to make first in LRU.
@@ -301,6 +403,52 @@ void lru_touch(struct lruhash* table, struct lruhash_entry* entry);
  */
 void lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md);
 
+/**
+ * Set the eviction policy of the table. The entries stay, the policy
+ * applies from the next reclaim onwards.
+ * @param table: hash table.
+ * @param policy: the eviction policy.
+ */
+void lruhash_set_policy(struct lruhash* table, enum lruhash_policy policy);
+
+/**
+ * Get the eviction policy from its name in the config file.
+ * @param str: "lru" or "sieve".
+ * @return the policy, lru if the name is NULL or not known.
+ */
+enum lruhash_policy lruhash_policy_from_str(const char* str);
+
+/**
+ * Get the number of lookups that found an entry, and that did not.
+ * @param table: hash table.
+ * @param hits: number of hits is returned.
+ * @param misses: number of misses is returned.
+ * @param remote: number of the hits on entries of another NUMA node
+ *	than the thread that looked them up.
+ * @param reset: if true, the counters are set back to zero.
+ */
+void lruhash_get_hits(struct lruhash* table, size_t* hits, size_t* misses,
+	size_t* remote, int reset);
+
+/**
+ * Start to keep the NUMA node of the threads, for the entries they
+ * store and the remote hits.  Call it before the threads are started.
+ */
+void lruhash_thread_node_init(void);
+
+/**
+ * Set the NUMA node of the thread that calls it.
+ * @param node: the node, NULL for node 0.  It is owned by the caller, and
+ *	must continue to exist if the compiler has no thread local variables.
+ */
+void lruhash_thread_node_set(int* node);
+
+/**
+ * Get the NUMA node of the thread that calls it.
+ * @return the node, 0 if not set.
+ */
+int lruhash_thread_node(void);
+
 /************************* getdns functions ************************/
 /*** these are used by getdns only and not by unbound. ***/
 
@@ -374,9 +522,10 @@ void bin_overflow_remove(struct lruhash_bin* bin,
 /**
  * Split hash bin into two new ones. Based on increased size_mask.
  * Caller must hold hash table lock.
- * At the end the routine acquires all hashbin locks (in the old array).
+ * At the end the routine holds all hashbin locks (in the old array).
  * This makes it wait for other threads to finish with the bins.
- * So the bins are ready to be deleted after this function.
+ * The old bins are emptied, the caller publishes the new array and
+ * then unlocks the old bins.
  * @param table: hash table with function pointers.
  * @param newa: new increased array.
  * @param newmask: new lookup mask.
@@ -386,6 +535,8 @@ void bin_split(struct lruhash* table, struct lruhash_bin* newa,
 
 /** 
  * Try to make space available by deleting old entries.
+ * Entries with the reference bit set get a second chance, they are moved
+ * to the front of the lru list instead.
  * Assumes that the lock on the hashtable is being held by caller.
  * Caller must not hold bin locks.
  * @param table: hash table.
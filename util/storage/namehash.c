@@ -0,0 +1,224 @@
+/*
+ * util/storage/namehash.c - hash index of domain names.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a hash index of domain names, that is kept next to
+ * a name sorted rbtree for fast exact and closest encloser lookups.
+ */
+#include "config.h"
+#include <ctype.h>
+#include "util/storage/namehash.h"
+#include "util/data/dname.h"
+#include "util/log.h"
+
+/** compute the hash value for a name and class, case insensitive.
+ * This is not the lookup3 hash, because that is seeded at startup, after
+ * zones may have been loaded, and the index must hash the same for its
+ * lifetime.  FNV-1a over the lowercased name, with a final mix so that
+ * the low bits, that pick the slot, depend on all of the input. */
+static hashvalue_type
+name_hash_calc(uint8_t* name, uint16_t dclass)
+{
+	uint32_t h = 2166136261u ^ (uint32_t)dclass;
+	uint8_t lablen;
+	while((lablen = *name++) != 0) {
+		h = (h ^ lablen) * 16777619u;
+		while(lablen--) {
+			h = (h ^ (uint8_t)tolower((unsigned char)*name)) *
+				16777619u;
+			name++;
+		}
+	}
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return (hashvalue_type)h;
+}
+
+void
+name_hash_init(struct name_hash* h)
+{
+	h->table = NULL;
+	h->size = 0;
+	h->count = 0;
+	h->failed = 0;
+}
+
+void
+name_hash_clear(struct name_hash* h)
+{
+	free(h->table);
+	name_hash_init(h);
+}
+
+int
+name_hash_usable(struct name_hash* h)
+{
+	return !h->failed;
+}
+
+/** put an entry in the table, it is known not to be present and there
+ * is an empty slot */
+static void
+name_hash_put(struct name_hash_entry* table, size_t size,
+	struct name_hash_entry* e)
+{
+	size_t i = ((size_t)e->hash) & (size-1);
+	while(table[i].item)
+		i = (i+1) & (size-1);
+	table[i] = *e;
+}
+
+/** grow the table to make room, false on malloc failure */
+static int
+name_hash_grow(struct name_hash* h)
+{
+	size_t i, newsize = (h->size?h->size*2:NAME_HASH_MIN_SIZE);
+	struct name_hash_entry* t = (struct name_hash_entry*)calloc(newsize,
+		sizeof(*t));
+	if(!t)
+		return 0;
+	for(i=0; i<h->size; i++) {
+		if(h->table[i].item)
+			name_hash_put(t, newsize, &h->table[i]);
+	}
+	free(h->table);
+	h->table = t;
+	h->size = newsize;
+	return 1;
+}
+
+void
+name_hash_insert(struct name_hash* h, uint8_t* name, uint16_t dclass,
+	void* item)
+{
+	struct name_hash_entry e;
+	if(h->failed)
+		return;
+	/* keep the load at most 3/4 */
+	if((h->count+1)*4 > h->size*3) {
+		if(!name_hash_grow(h)) {
+			log_err("out of memory for name hash index, "
+				"using the tree");
+			free(h->table);
+			h->table = NULL;
+			h->size = 0;
+			h->count = 0;
+			h->failed = 1;
+			return;
+		}
+	}
+	e.item = item;
+	e.name = name;
+	e.hash = name_hash_calc(name, dclass);
+	e.dclass = dclass;
+	name_hash_put(h->table, h->size, &e);
+	h->count++;
+}
+
+/** find the slot of a name, false if not present */
+static int
+name_hash_find_slot(struct name_hash* h, uint8_t* name, uint16_t dclass,
+	size_t* slot)
+{
+	hashvalue_type hash;
+	size_t i;
+	if(!h->table)
+		return 0;
+	hash = name_hash_calc(name, dclass);
+	i = ((size_t)hash) & (h->size-1);
+	while(h->table[i].item) {
+		if(h->table[i].hash == hash && h->table[i].dclass == dclass &&
+			query_dname_compare(h->table[i].name, name) == 0) {
+			*slot = i;
+			return 1;
+		}
+		i = (i+1) & (h->size-1);
+	}
+	return 0;
+}
+
+void
+name_hash_remove(struct name_hash* h, uint8_t* name, uint16_t dclass)
+{
+	size_t i, j, home;
+	if(h->failed || !name_hash_find_slot(h, name, dclass, &i))
+		return;
+	/* backward shift deletion, move later entries of the probe
+	 * sequence into the hole, so that lookups stay correct without
+	 * tombstones */
+	j = i;
+	for(;;) {
+		h->table[i].item = NULL;
+		for(;;) {
+			j = (j+1) & (h->size-1);
+			if(!h->table[j].item) {
+				h->count--;
+				return;
+			}
+			home = ((size_t)h->table[j].hash) & (h->size-1);
+			/* the entry at j can move to i if its home slot is
+			 * not cyclically in (i, j] */
+			if(i <= j) {
+				if(home <= i || home > j)
+					break;
+			} else {
+				if(home <= i && home > j)
+					break;
+			}
+		}
+		h->table[i] = h->table[j];
+		i = j;
+	}
+}
+
+void*
+name_hash_lookup(struct name_hash* h, uint8_t* name, uint16_t dclass)
+{
+	size_t i;
+	if(!name_hash_find_slot(h, name, dclass, &i))
+		return NULL;
+	return h->table[i].item;
+}
+
+size_t
+name_hash_get_mem(struct name_hash* h)
+{
+	return h->size * sizeof(struct name_hash_entry);
+}
@@ -0,0 +1,146 @@
+/*
+ * util/storage/namehash.h - hash index of domain names.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a hash index of domain names.  It is kept next to
+ * a name sorted rbtree, so that exact name lookups, and the closest
+ * encloser search by going up label by label, do not have to walk the
+ * tree.  The rbtree stays the owner of the elements, and it is still
+ * used for ordered lookups (less or equal, next and previous).
+ *
+ * The index is open addressing with linear probing.  If memory for the
+ * index cannot be allocated, the index is disabled until it is cleared,
+ * and callers fall back to the rbtree.
+ */
+
+#ifndef UTIL_STORAGE_NAMEHASH_H
+#define UTIL_STORAGE_NAMEHASH_H
+#include "util/storage/lruhash.h"
+
+/** initial number of slots in the name hash */
+#define NAME_HASH_MIN_SIZE 64
+
+/**
+ * Slot in the name hash.
+ */
+struct name_hash_entry {
+	/** the element, or NULL if the slot is empty */
+	void* item;
+	/** name of the element, in uncompressed wireformat, points into
+	 * the element */
+	uint8_t* name;
+	/** hash value of name and class */
+	hashvalue_type hash;
+	/** class of the name (host order) */
+	uint16_t dclass;
+};
+
+/**
+ * Hash index of domain names.
+ */
+struct name_hash {
+	/** array of slots, NULL if there is no index */
+	struct name_hash_entry* table;
+	/** number of slots, power of two */
+	size_t size;
+	/** number of elements in the table */
+	size_t count;
+	/** if an allocation failed, the index is not complete and it is
+	 * not used until it is cleared */
+	int failed;
+};
+
+/**
+ * Init a name hash to be empty.
+ * @param h: name hash.
+ */
+void name_hash_init(struct name_hash* h);
+
+/**
+ * Delete the contents of a name hash, it is empty afterwards.  The
+ * elements themselves are not touched.  This also makes a failed index
+ * usable again, call it when the tree it indexes has been emptied.
+ * @param h: name hash.
+ */
+void name_hash_clear(struct name_hash* h);
+
+/**
+ * Check if the name hash can be used for lookups.
+ * @param h: name hash.
+ * @return true if the index is complete.  If false, lookups have to
+ *	use the tree.
+ */
+int name_hash_usable(struct name_hash* h);
+
+/**
+ * Insert an element into the name hash.  The name must not be in
+ * the hash already.  If memory runs out, the index is disabled.
+ * @param h: name hash.
+ * @param name: name of the element, wireformat, it must stay allocated
+ *	while the element is in the hash.
+ * @param dclass: class of the name.
+ * @param item: the element.
+ */
+void name_hash_insert(struct name_hash* h, uint8_t* name, uint16_t dclass,
+	void* item);
+
+/**
+ * Remove an element from the name hash.
+ * @param h: name hash.
+ * @param name: name of the element, wireformat.
+ * @param dclass: class of the name.
+ */
+void name_hash_remove(struct name_hash* h, uint8_t* name, uint16_t dclass);
+
+/**
+ * Lookup exact match in the name hash.  Names are compared case
+ * insensitive.
+ * @param h: name hash, it must be usable.
+ * @param name: wireformat name.
+ * @param dclass: class of the name.
+ * @return element or NULL if not found.
+ */
+void* name_hash_lookup(struct name_hash* h, uint8_t* name, uint16_t dclass);
+
+/**
+ * Get memory in use by the name hash.
+ * @param h: name hash.
+ * @return bytes in use, not including the struct itself.
+ */
+size_t name_hash_get_mem(struct name_hash* h);
+
+#endif /* UTIL_STORAGE_NAMEHASH_H */
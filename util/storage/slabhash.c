@@ -125,6 +125,13 @@ struct lruhash_entry* slabhash_lookup(struct slabhash* sl,
 	return lruhash_lookup(sl->array[slab_idx(sl, hash)], hash, key, wr);
 }
 
+void slabhash_update_entry_size(struct slabhash* sl, hashvalue_type hash,
+	void* key, void* data, size_t* size, int diff, void* arg)
+{
+	lruhash_update_entry_size(sl->array[slab_idx(sl, hash)], hash, key,
+		data, size, diff, arg);
+}
+
 void slabhash_remove(struct slabhash* sl, hashvalue_type hash, void* key)
 {
 	lruhash_remove(sl->array[slab_idx(sl, hash)], hash, key);
@@ -223,6 +230,29 @@ void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_type md)
 	}
 }
 
+void slabhash_set_policy(struct slabhash* sl, enum lruhash_policy policy)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++) {
+		lruhash_set_policy(sl->array[i], policy);
+	}
+}
+
+void slabhash_get_hits(struct slabhash* sl, size_t* hits, size_t* misses,
+	size_t* remote, int reset)
+{
+	size_t i, h, m, r;
+	*hits = 0;
+	*misses = 0;
+	*remote = 0;
+	for(i=0; i<sl->size; i++) {
+		lruhash_get_hits(sl->array[i], &h, &m, &r, reset);
+		*hits += h;
+		*misses += m;
+		*remote += r;
+	}
+}
+
 void slabhash_traverse(struct slabhash* sh, int wr,
 	void (*func)(struct lruhash_entry*, void*), void* arg)
 {
@@ -128,6 +128,19 @@ void slabhash_insert(struct slabhash* table, hashvalue_type hash,
 struct lruhash_entry* slabhash_lookup(struct slabhash* table, 
 	hashvalue_type hash, void* key, int wr);
 
+/**
+ * Change the size of the data of an entry. Uses lruhash_update_entry_size.
+ * @param table: hash table.
+ * @param hash: hash of key.
+ * @param key: what to look for.
+ * @param data: the data of the entry.
+ * @param size: the part of the data size that is changed.
+ * @param diff: the change in size, can be negative.
+ * @param cb_override: if not NULL overrides the cb_arg for deletefunc.
+ */
+void slabhash_update_entry_size(struct slabhash* table, hashvalue_type hash,
+	void* key, void* data, size_t* size, int diff, void* cb_override);
+
 /**
  * Remove entry from hashtable. Does nothing if not found in hashtable.
  * Delfunc is called for the entry. Uses lruhash_remove.
@@ -183,6 +196,24 @@ struct lruhash* slabhash_gettable(struct slabhash* table, hashvalue_type hash);
  */
 void slabhash_setmarkdel(struct slabhash* table, lruhash_markdelfunc_type md);
 
+/**
+ * Set the eviction policy of all the tables.
+ * @param table: slabbed hash table.
+ * @param policy: the eviction policy.
+ */
+void slabhash_set_policy(struct slabhash* table, enum lruhash_policy policy);
+
+/**
+ * Get the lookup hits and misses, summed over the slabs.
+ * @param table: slabbed hash table.
+ * @param hits: number of lookups that found an entry.
+ * @param misses: number of lookups that did not.
+ * @param remote: number of hits on entries of another NUMA node.
+ * @param reset: if true, the counters are set back to zero.
+ */
+void slabhash_get_hits(struct slabhash* table, size_t* hits, size_t* misses,
+	size_t* remote, int reset);
+
 /**
  * Traverse a slabhash.
  * @param table: slabbed hash table.
@@ -46,6 +46,7 @@
 #include "util/log.h"
 #include "util/netevent.h"
 #include "util/tube.h"
+#include "util/uring_event.h"
 
 /* We define libevent structures here to hide the libevent stuff. */
 
@@ -143,6 +144,28 @@ static void (*NATIVE_BITS_CB(void (*cb)(int, short, void*)))(int, short, void*)
 #define AS_EVENT(x) ((struct event*)x)
 #define AS_UB_EVENT(x) ((struct ub_event*)x)
 
+#ifdef USE_IO_URING
+/** if the event bases and events are from the io_uring event base */
+static int ub_event_uring = 0;
+#define AS_URING_BASE(x) ((struct uring_event_base*)x)
+#define AS_URING_EVENT(x) ((struct uring_event*)x)
+#endif
+
+int
+ub_event_use_io_uring(int on)
+{
+#ifdef USE_IO_URING
+	if(on && !uring_event_probe()) {
+		ub_event_uring = 0;
+		return 0;
+	}
+	ub_event_uring = on;
+	return 1;
+#else
+	return !on;
+#endif
+}
+
 const char* ub_event_get_version(void)
 {
 	return event_get_version();
@@ -167,6 +190,14 @@ void
 ub_get_event_sys(struct ub_event_base* base, const char** n, const char** s,
 	const char** m)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring && base) {
+		*n = "uring-event";
+		*s = "internal";
+		*m = uring_event_get_method(AS_URING_BASE(base));
+		return;
+	}
+#endif
 #ifdef USE_WINSOCK
 	(void)base;
 	*n = "event";
@@ -212,6 +243,11 @@ ub_default_event_base(int sigs, time_t* time_secs, struct timeval* time_tv)
 	void* base;
 
 	(void)base;
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return AS_UB_EVENT_BASE(uring_event_base_create(time_secs,
+			time_tv));
+#endif
 #ifdef USE_MINI_EVENT
 	(void)sigs;
 	/* use mini event time-sharing feature */
@@ -262,6 +298,12 @@ ub_libevent_get_event_base(struct ub_event_base* base)
 void
 ub_event_base_free(struct ub_event_base* base)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring) {
+		uring_event_base_free(AS_URING_BASE(base));
+		return;
+	}
+#endif
 #ifdef USE_MINI_EVENT
 	event_base_free(AS_EVENT_BASE(base));
 #elif defined(HAVE_EVENT_BASE_FREE) && defined(HAVE_EVENT_BASE_ONCE)
@@ -277,12 +319,20 @@ ub_event_base_free(struct ub_event_base* base)
 int
 ub_event_base_dispatch(struct ub_event_base* base)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_base_dispatch(AS_URING_BASE(base));
+#endif
 	return event_base_dispatch(AS_EVENT_BASE(base));
 }
 
 int
 ub_event_base_loopexit(struct ub_event_base* base)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_base_loopexit(AS_URING_BASE(base));
+#endif
 	return event_base_loopexit(AS_EVENT_BASE(base), NULL);
 }
 
@@ -290,8 +340,14 @@ struct ub_event*
 ub_event_new(struct ub_event_base* base, int fd, short bits,
 	void (*cb)(int, short, void*), void* arg)
 {
-	struct event *ev = (struct event*)calloc(1, sizeof(struct event));
+	struct event *ev;
 
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return AS_UB_EVENT(uring_event_new(AS_URING_BASE(base), fd,
+			bits, cb, arg));
+#endif
+	ev = (struct event*)calloc(1, sizeof(struct event));
 	if (!ev)
 		return NULL;
 
@@ -314,8 +370,14 @@ struct ub_event*
 ub_signal_new(struct ub_event_base* base, int fd,
 	void (*cb)(int, short, void*), void* arg)
 {
-	struct event *ev = (struct event*)calloc(1, sizeof(struct event));
+	struct event *ev;
 
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return AS_UB_EVENT(uring_signal_new(AS_URING_BASE(base), fd,
+			cb, arg));
+#endif
+	ev = (struct event*)calloc(1, sizeof(struct event));
 	if (!ev)
 		return NULL;
 
@@ -361,24 +423,48 @@ ub_winsock_register_wsaevent(struct ub_event_base* base, void* wsaevent,
 void
 ub_event_add_bits(struct ub_event* ev, short bits)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring) {
+		uring_event_add_bits(AS_URING_EVENT(ev), bits);
+		return;
+	}
+#endif
 	AS_EVENT(ev)->ev_events |= NATIVE_BITS(bits);
 }
 
 void
 ub_event_del_bits(struct ub_event* ev, short bits)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring) {
+		uring_event_del_bits(AS_URING_EVENT(ev), bits);
+		return;
+	}
+#endif
 	AS_EVENT(ev)->ev_events &= ~NATIVE_BITS(bits);
 }
 
 void
 ub_event_set_fd(struct ub_event* ev, int fd)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring) {
+		uring_event_set_fd(AS_URING_EVENT(ev), fd);
+		return;
+	}
+#endif
 	AS_EVENT(ev)->ev_fd = fd;
 }
 
 void
 ub_event_free(struct ub_event* ev)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring) {
+		uring_event_free(AS_URING_EVENT(ev));
+		return;
+	}
+#endif
 	if (ev)
 		free(AS_EVENT(ev));
 }
@@ -386,12 +472,20 @@ ub_event_free(struct ub_event* ev)
 int
 ub_event_add(struct ub_event* ev, struct timeval* tv)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_add(AS_URING_EVENT(ev), tv);
+#endif
 	return event_add(AS_EVENT(ev), tv);
 }
 
 int
 ub_event_del(struct ub_event* ev)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_del(AS_URING_EVENT(ev));
+#endif
 	return event_del(AS_EVENT(ev));
 }
 
@@ -399,6 +493,11 @@ int
 ub_timer_add(struct ub_event* ev, struct ub_event_base* base,
 	void (*cb)(int, short, void*), void* arg, struct timeval* tv)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_timer_add(AS_URING_EVENT(ev), AS_URING_BASE(base),
+			cb, arg, tv);
+#endif
 	event_set(AS_EVENT(ev), -1, EV_TIMEOUT, NATIVE_BITS_CB(cb), arg);
 	if (event_base_set(AS_EVENT_BASE(base), AS_EVENT(ev)) != 0)
 		return -1;
@@ -408,18 +507,30 @@ ub_timer_add(struct ub_event* ev, struct ub_event_base* base,
 int
 ub_timer_del(struct ub_event* ev)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_del(AS_URING_EVENT(ev));
+#endif
 	return evtimer_del(AS_EVENT(ev));
 }
 
 int
 ub_signal_add(struct ub_event* ev, struct timeval* tv)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_signal_add(AS_URING_EVENT(ev));
+#endif
 	return signal_add(AS_EVENT(ev), tv);
 }
 
 int
 ub_signal_del(struct ub_event* ev)
 {
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_signal_del(AS_URING_EVENT(ev));
+#endif
 	return signal_del(AS_EVENT(ev));
 }
 
@@ -447,6 +558,11 @@ ub_winsock_tcp_wouldblock(struct ub_event* ev, int eventbits)
 
 void ub_comm_base_now(struct comm_base* cb)
 {
+#ifdef USE_IO_URING
+	/** the io_uring base updates the time when it blocks. */
+	if(ub_event_uring)
+		return;
+#endif
 #ifdef USE_MINI_EVENT
 /** minievent updates the time when it blocks. */
 	(void)cb; /* nothing to do */
@@ -464,3 +580,109 @@ void ub_comm_base_now(struct comm_base* cb)
 #endif /* USE_MINI_EVENT */
 }
 
+
+void
+ub_event_recv_datagrams(struct ub_event* ev, size_t bufsize)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		uring_event_recv_datagrams(AS_URING_EVENT(ev), bufsize);
+#else
+	(void)ev;
+	(void)bufsize;
+#endif
+}
+
+struct msghdr*
+ub_event_base_recvmsg(struct ub_event_base* base)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_base_recvmsg(AS_URING_BASE(base));
+#else
+	(void)base;
+#endif
+	return NULL;
+}
+
+int
+ub_event_base_sendmsg(struct ub_event_base* base, int fd, struct msghdr* msg)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_base_sendmsg(AS_URING_BASE(base), fd, msg);
+#else
+	(void)base;
+	(void)fd;
+	(void)msg;
+#endif
+	return 0;
+}
+
+void
+ub_event_accept_conns(struct ub_event* ev)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		uring_event_accept_conns(AS_URING_EVENT(ev));
+#else
+	(void)ev;
+#endif
+}
+
+int
+ub_event_base_accept(struct ub_event_base* base, int* fd,
+	struct sockaddr_storage* addr, socklen_t* addrlen)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_base_accept(AS_URING_BASE(base), fd, addr,
+			addrlen);
+#else
+	(void)base;
+	(void)fd;
+	(void)addr;
+	(void)addrlen;
+#endif
+	return 0;
+}
+
+void
+ub_event_stream(struct ub_event* ev)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		uring_event_stream(AS_URING_EVENT(ev));
+#else
+	(void)ev;
+#endif
+}
+
+int
+ub_event_base_send(struct ub_event_base* base, int fd, struct iovec* iov,
+	int iovcnt)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		return uring_event_base_send(AS_URING_BASE(base), fd, iov,
+			iovcnt);
+#else
+	(void)base;
+	(void)fd;
+	(void)iov;
+	(void)iovcnt;
+#endif
+	return 0;
+}
+
+void
+ub_event_base_close_fd(struct ub_event_base* base, int fd)
+{
+#ifdef USE_IO_URING
+	if(ub_event_uring)
+		uring_event_base_close_fd(AS_URING_BASE(base), fd);
+#else
+	(void)base;
+	(void)fd;
+#endif
+}
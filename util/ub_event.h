@@ -47,6 +47,9 @@ struct ub_event_base;
 struct ub_event;
 struct comm_base;
 struct event_base;
+struct msghdr;
+struct iovec;
+struct sockaddr_storage;
 
 /** event timeout */
 #define UB_EV_TIMEOUT      0x01
@@ -124,4 +127,40 @@ void ub_winsock_tcp_wouldblock(struct ub_event*, int bits);
 /** Equip the comm_base with the current time */
 void ub_comm_base_now(struct comm_base* cb);
 
+/** Select the io_uring event base for the default event bases that are
+ * created after this, or the compiled in event base.  Returns false if
+ * io_uring is not available.  Do not change it while event bases exist.
+ */
+int ub_event_use_io_uring(int on);
+/** Have the event base read the datagrams for the UDP event, if it can,
+ * into buffers of the given message buffer size.  Set it before the event
+ * is added. */
+void ub_event_recv_datagrams(struct ub_event*, size_t bufsize);
+/** The datagram that the event base has read for the callback that runs
+ * now, with the payload in msg_iov[0], or NULL if the callback has to read
+ * the fd itself. */
+struct msghdr* ub_event_base_recvmsg(struct ub_event_base*);
+/** Queue a datagram on the event base to be sent with its other requests,
+ * the message is copied.  Returns false if the caller has to send it. */
+int ub_event_base_sendmsg(struct ub_event_base*, int fd, struct msghdr*);
+/** Have the event base accept the connections for the TCP accept event, if
+ * it can.  Set it before the event is added. */
+void ub_event_accept_conns(struct ub_event*);
+/** The connection that the event base has accepted for the callback that
+ * runs now.  Returns false if the callback has to accept it itself, else
+ * the fd is returned, or -1 with errno set, and the address. */
+int ub_event_base_accept(struct ub_event_base*, int* fd,
+	struct sockaddr_storage* addr, socklen_t* addrlen);
+/** Mark the event as the event of a TCP stream, of which the fd is closed
+ * after ub_event_base_close_fd.  The event base can then queue the writes
+ * with ub_event_base_send. */
+void ub_event_stream(struct ub_event*);
+/** Queue a write on the stream of the event for the fd, the data is copied.
+ * Returns 1 if queued, 0 if the caller has to write it, and -1 if an earlier
+ * write is still in progress, the write event then fires after that. */
+int ub_event_base_send(struct ub_event_base*, int fd, struct iovec* iov,
+	int iovcnt);
+/** Tell the event base that the fd is going to be closed. */
+void ub_event_base_close_fd(struct ub_event_base*, int fd);
+
 #endif /* UB_EVENT_H */
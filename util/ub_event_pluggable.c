@@ -692,3 +692,61 @@ void ub_comm_base_now(struct comm_base* cb)
 #endif
 }
 
+
+int
+ub_event_use_io_uring(int on)
+{
+	/* the pluggable event bases are given by the application */
+	return !on;
+}
+
+void
+ub_event_recv_datagrams(struct ub_event* ATTR_UNUSED(ev),
+	size_t ATTR_UNUSED(bufsize))
+{
+}
+
+struct msghdr*
+ub_event_base_recvmsg(struct ub_event_base* ATTR_UNUSED(base))
+{
+	return NULL;
+}
+
+int
+ub_event_base_sendmsg(struct ub_event_base* ATTR_UNUSED(base),
+	int ATTR_UNUSED(fd), struct msghdr* ATTR_UNUSED(msg))
+{
+	return 0;
+}
+
+void
+ub_event_accept_conns(struct ub_event* ATTR_UNUSED(ev))
+{
+}
+
+int
+ub_event_base_accept(struct ub_event_base* ATTR_UNUSED(base),
+	int* ATTR_UNUSED(fd), struct sockaddr_storage* ATTR_UNUSED(addr),
+	socklen_t* ATTR_UNUSED(addrlen))
+{
+	return 0;
+}
+
+void
+ub_event_stream(struct ub_event* ATTR_UNUSED(ev))
+{
+}
+
+int
+ub_event_base_send(struct ub_event_base* ATTR_UNUSED(base),
+	int ATTR_UNUSED(fd), struct iovec* ATTR_UNUSED(iov),
+	int ATTR_UNUSED(iovcnt))
+{
+	return 0;
+}
+
+void
+ub_event_base_close_fd(struct ub_event_base* ATTR_UNUSED(base),
+	int ATTR_UNUSED(fd))
+{
+}
@@ -0,0 +1,1541 @@
+/*
+ * util/uring_event.c - event base on Linux io_uring.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * This file implements the event base on Linux io_uring, see
+ * uring_event.h for the design.
+ */
+
+#include "config.h"
+#ifdef HAVE_TIME_H
+#include <time.h>
+#endif
+#include <sys/time.h>
+#include "util/uring_event.h"
+
+#ifdef USE_IO_URING
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <endian.h>
+#include "util/ub_event.h"
+#include "util/rbtree.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/fptr_wlist.h"
+
+/** number of submission queue entries, the completion queue is larger */
+#define URING_SQ_ENTRIES 1024
+/** max number of completions handled before the timeouts are checked */
+#define URING_CQ_BATCH 1024
+/** max number of receive buffers in the provided buffer ring, a power of 2 */
+#define URING_RECV_BUFS 256
+/** min number of receive buffers, when they are large */
+#define URING_RECV_BUFS_MIN 16
+/** the memory for the receive buffers is kept below this, if it can */
+#define URING_RECV_MEM (4*1024*1024)
+/** the buffer group id of the receive buffers */
+#define URING_RECV_BGID 1
+/** size of the control data space of a datagram */
+#define URING_CTL_SIZE 64
+/** number of send slots */
+#define URING_SEND_SLOTS 256
+/** max payload of a queued datagram, larger ones are sent by the caller,
+ * larger stream writes are copied to allocated space */
+#define URING_SEND_DATA 4096
+/** max number of signals to support */
+#define URING_MAX_SIG 32
+
+/** user_data of a request that is not looked at, like removals */
+#define URING_UD_NONE 0
+/** user_data type of a poll request */
+#define URING_UD_POLL 1
+/** user_data type of a multishot recvmsg request */
+#define URING_UD_RECV 2
+/** user_data type of a sendmsg request */
+#define URING_UD_SEND 3
+/** user_data type of an accept request */
+#define URING_UD_ACCEPT 4
+/** user_data with type, generation and fd, or slot number for sends */
+#define URING_UD(type, gen, fd) (((uint64_t)(type)<<56) | \
+	(((uint64_t)(gen)&0xffffff)<<32) | (uint64_t)(uint32_t)(fd))
+
+/** the address of a connection accepted by the base */
+struct uring_accept {
+	/** the address of the remote end */
+	struct sockaddr_storage addr;
+	/** length of the address */
+	socklen_t addrlen;
+};
+
+/** the state of a file descriptor in the base */
+struct uring_fd {
+	/** the active event for the fd, or NULL */
+	struct uring_event* ev;
+	/** user_data of the armed poll, recvmsg or accept request, 0 if
+	 * none */
+	uint64_t armed;
+	/** the UB_EV_READ and UB_EV_WRITE bits of the armed poll request */
+	short armed_bits;
+	/** generation of the requests for the fd, for stale completions */
+	uint32_t gen;
+	/** if the recvmsg or accept request failed, the fd is polled
+	 * instead */
+	int no_recv;
+	/** if the poll of the deleted stream event is kept armed until the
+	 * next submit, for when the event is added again */
+	int kept;
+	/** if the fd is in the list of kept polls */
+	int kept_listed;
+	/** the send slot + 1 of the stream write in progress, or 0 */
+	int send_slot;
+	/** the number of submits when the stream write was queued */
+	unsigned send_submit;
+	/** the address storage for the accept request, allocated when
+	 * first used */
+	struct uring_accept* acc;
+};
+
+/** a datagram queued for sending */
+struct uring_send {
+	/** the message for the sendmsg request */
+	struct msghdr msg;
+	/** the io vector of the message */
+	struct iovec iov;
+	/** the destination address */
+	struct sockaddr_storage addr;
+	/** the control data */
+	union {
+		/** header, for alignment */
+		struct cmsghdr hdr;
+		/** the storage */
+		char buf[URING_CTL_SIZE];
+	} ctl;
+	/** the socket */
+	int fd;
+	/** if it is a write on a stream, of the fd's send_slot */
+	int stream;
+	/** next free slot, or -1 */
+	int next;
+	/** the allocated payload of a large stream write, or NULL */
+	uint8_t* ext;
+	/** the payload */
+	uint8_t data[URING_SEND_DATA];
+};
+
+/** io_uring event base */
+struct uring_event_base {
+	/** the io_uring file descriptor */
+	int ringfd;
+	/** the mmapped submission queue ring */
+	void* sq_ring;
+	/** size of the sq ring mmap */
+	size_t sq_ring_sz;
+	/** the mmapped completion queue ring, if not the same as sq_ring */
+	void* cq_ring;
+	/** size of the cq ring mmap */
+	size_t cq_ring_sz;
+	/** the mmapped submission queue entries */
+	struct io_uring_sqe* sqes;
+	/** size of the sqes mmap */
+	size_t sqes_sz;
+	/** sq head, written by the kernel */
+	unsigned* sq_head;
+	/** sq tail, written by us */
+	unsigned* sq_tail;
+	/** mask for sq positions */
+	unsigned sq_mask;
+	/** number of sq entries */
+	unsigned sq_entries;
+	/** the tail with the entries that are not yet published */
+	unsigned sq_local_tail;
+	/** cq head, written by us */
+	unsigned* cq_head;
+	/** cq tail, written by the kernel */
+	unsigned* cq_tail;
+	/** mask for cq positions */
+	unsigned cq_mask;
+	/** the completion queue entries */
+	struct io_uring_cqe* cqes;
+
+	/** array of 0 - capfd of the fd states */
+	struct uring_fd* fds;
+	/** capacity, size of the fds array */
+	int capfd;
+	/** timeouts, sorted by time (absolute) and ptr */
+	rbtree_type* times;
+	/** array of 0 - URING_MAX_SIG of ptr to event for it */
+	struct uring_event** signals;
+	/** the fds with kept polls, that are removed at the next submit */
+	int* kept;
+	/** number of fds in the kept list */
+	int kept_num;
+	/** capacity of the kept list */
+	int kept_cap;
+	/** the number of submits, to see if a request has been submitted */
+	unsigned submits;
+	/** if we need to exit */
+	int need_to_exit;
+	/** where to store time in seconds */
+	time_t* time_secs;
+	/** where to store time in microseconds */
+	struct timeval* time_tv;
+
+	/** if the provided buffer ring is registered */
+	int recv_ok;
+	/** if registering the buffer ring has been tried */
+	int recv_tried;
+	/** the provided buffer ring */
+	struct io_uring_buf_ring* br;
+	/** size of the buffer ring mmap */
+	size_t br_sz;
+	/** the tail of the buffer ring */
+	uint16_t br_tail;
+	/** the number of receive buffers, a power of 2 */
+	int recv_num;
+	/** the receive buffers */
+	uint8_t* recvbuf;
+	/** size of one receive buffer */
+	size_t recv_bufsize;
+	/** max payload of a datagram in a receive buffer, the message
+	 * buffer size of the UDP ports that are read by the base */
+	size_t recv_datalen;
+	/** the message for the multishot recvmsg, it sets the space for
+	 * the address and the control data in the buffers */
+	struct msghdr rmsg;
+	/** the datagram for the callback that runs now */
+	struct msghdr cur;
+	/** the io vector of the datagram for the callback */
+	struct iovec cur_iov;
+	/** if cur has a datagram */
+	int has_cur;
+
+	/** send slots, allocated when first used */
+	struct uring_send* sends;
+	/** first free send slot, or -1 */
+	int send_free;
+	/** if stream writes can be queued, the kernel then completes them
+	 * whole with MSG_WAITALL */
+	int stream_ok;
+
+	/** if the callback that runs now has an accepted connection */
+	int has_acc;
+	/** the accepted fd for the callback, or -1 on error */
+	int acc_fd;
+	/** the error of the accept, if acc_fd is -1 */
+	int acc_err;
+	/** the address of the accepted connection */
+	struct uring_accept* acc_cur;
+};
+
+/** io_uring event */
+struct uring_event {
+	/** node in the timeout rbtree, key is the event */
+	rbnode_type node;
+	/** is event active */
+	int added;
+	/** is the event in the timeout tree */
+	int in_times;
+	/** the base it belongs to */
+	struct uring_event_base* base;
+	/** fd to poll or -1 for timeouts. signal number for sigs. */
+	int fd;
+	/** the UB_EV bits the event is interested in */
+	short events;
+	/** absolute timeout */
+	struct timeval timeout;
+	/** callback to call: fd, eventbits, userarg */
+	void (*cb)(int, short, void*);
+	/** callback user arg */
+	void* arg;
+	/** if the base reads the datagrams for the event */
+	int recv;
+	/** if the base accepts the connections for the event */
+	int accept;
+	/** if the event is for a stream, that is closed with
+	 * uring_event_base_close_fd */
+	int stream;
+};
+
+/** load a ring position that is written by the kernel */
+static unsigned
+ring_load(unsigned* p)
+{
+	return atomic_load_explicit((_Atomic unsigned*)p,
+		memory_order_acquire);
+}
+
+/** store a ring position, the kernel can then read the entries */
+static void
+ring_store(unsigned* p, unsigned v)
+{
+	atomic_store_explicit((_Atomic unsigned*)p, v, memory_order_release);
+}
+
+/** the io_uring_setup system call */
+static int
+sys_uring_setup(unsigned entries, struct io_uring_params* p)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+/** the io_uring_enter system call */
+static int
+sys_uring_enter(int fd, unsigned submit, unsigned min, unsigned flags,
+	void* arg, size_t argsz)
+{
+	return (int)syscall(__NR_io_uring_enter, fd, submit, min, flags,
+		arg, argsz);
+}
+
+/** the io_uring_register system call */
+static int
+sys_uring_register(int fd, unsigned op, void* arg, unsigned nr)
+{
+	return (int)syscall(__NR_io_uring_register, fd, op, arg, nr);
+}
+
+/** create the ring, returns fd or -1 */
+static int
+uring_setup(struct io_uring_params* p)
+{
+	int fd;
+	memset(p, 0, sizeof(*p));
+	p->flags = IORING_SETUP_CQSIZE;
+	p->cq_entries = URING_SQ_ENTRIES*4;
+#if defined(IORING_SETUP_SUBMIT_ALL) && defined(IORING_SETUP_COOP_TASKRUN)
+	p->flags |= IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+	fd = sys_uring_setup(URING_SQ_ENTRIES, p);
+	if(fd != -1 || errno != EINVAL)
+		return fd;
+	/* older kernel, without these flags */
+	memset(p, 0, sizeof(*p));
+	p->flags = IORING_SETUP_CQSIZE;
+	p->cq_entries = URING_SQ_ENTRIES*4;
+#endif
+	fd = sys_uring_setup(URING_SQ_ENTRIES, p);
+	return fd;
+}
+
+int
+uring_event_probe(void)
+{
+	struct io_uring_params p;
+	int fd = uring_setup(&p);
+	if(fd == -1) {
+		verbose(VERB_ALGO, "io_uring_setup: %s", strerror(errno));
+		return 0;
+	}
+	close(fd);
+	if(!(p.features & IORING_FEAT_EXT_ARG)) {
+		verbose(VERB_ALGO, "io_uring: kernel has no IORING_FEAT_EXT_ARG");
+		return 0;
+	}
+	return 1;
+}
+
+/** see if the kernel completes stream writes whole with MSG_WAITALL,
+ * it does since it has IORING_OP_SENDMSG_ZC, that is an enum value, the
+ * header has it since IORING_SETUP_DEFER_TASKRUN */
+static int
+uring_probe_stream(struct uring_event_base* base)
+{
+#ifdef IORING_SETUP_DEFER_TASKRUN
+	size_t len = sizeof(struct io_uring_probe) +
+		256*sizeof(struct io_uring_probe_op);
+	struct io_uring_probe* p = (struct io_uring_probe*)calloc(1, len);
+	int ok;
+	if(!p)
+		return 0;
+	if(sys_uring_register(base->ringfd, IORING_REGISTER_PROBE, p, 256)
+		== -1) {
+		free(p);
+		return 0;
+	}
+	ok = (p->ops_len > IORING_OP_SENDMSG_ZC &&
+		(p->ops[IORING_OP_SENDMSG_ZC].flags & IO_URING_OP_SUPPORTED));
+	free(p);
+	return ok;
+#else
+	(void)base;
+	return 0;
+#endif
+}
+
+/** set time */
+static int
+settime(struct uring_event_base* base)
+{
+	if(gettimeofday(base->time_tv, NULL) < 0) {
+		return -1;
+	}
+#ifndef S_SPLINT_S
+	*base->time_secs = (time_t)base->time_tv->tv_sec;
+#endif
+	return 0;
+}
+
+/** compare events in tree, based on timevalue, ptr for uniqueness */
+int
+uring_ev_cmp(const void* a, const void* b)
+{
+	const struct uring_event *e = (const struct uring_event*)a;
+	const struct uring_event *f = (const struct uring_event*)b;
+	if(e->timeout.tv_sec < f->timeout.tv_sec)
+		return -1;
+	if(e->timeout.tv_sec > f->timeout.tv_sec)
+		return 1;
+	if(e->timeout.tv_usec < f->timeout.tv_usec)
+		return -1;
+	if(e->timeout.tv_usec > f->timeout.tv_usec)
+		return 1;
+	if(e < f)
+		return -1;
+	if(e > f)
+		return 1;
+	return 0;
+}
+
+/** map the rings of the io_uring fd */
+static int
+uring_map(struct uring_event_base* base, struct io_uring_params* p)
+{
+	unsigned* array;
+	unsigned i;
+	base->sq_ring_sz = p->sq_off.array + p->sq_entries*sizeof(unsigned);
+	base->cq_ring_sz = p->cq_off.cqes +
+		p->cq_entries*sizeof(struct io_uring_cqe);
+	if((p->features & IORING_FEAT_SINGLE_MMAP)) {
+		if(base->cq_ring_sz > base->sq_ring_sz)
+			base->sq_ring_sz = base->cq_ring_sz;
+		base->cq_ring_sz = 0;
+	}
+	base->sq_ring = mmap(NULL, base->sq_ring_sz, PROT_READ|PROT_WRITE,
+		MAP_SHARED|MAP_POPULATE, base->ringfd, IORING_OFF_SQ_RING);
+	if(base->sq_ring == MAP_FAILED) {
+		base->sq_ring = NULL;
+		return 0;
+	}
+	if(base->cq_ring_sz) {
+		base->cq_ring = mmap(NULL, base->cq_ring_sz,
+			PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE,
+			base->ringfd, IORING_OFF_CQ_RING);
+		if(base->cq_ring == MAP_FAILED) {
+			base->cq_ring = NULL;
+			return 0;
+		}
+	}
+	base->sqes_sz = p->sq_entries*sizeof(struct io_uring_sqe);
+	base->sqes = (struct io_uring_sqe*)mmap(NULL, base->sqes_sz,
+		PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, base->ringfd,
+		IORING_OFF_SQES);
+	if(base->sqes == MAP_FAILED) {
+		base->sqes = NULL;
+		return 0;
+	}
+	base->sq_head = (unsigned*)((uint8_t*)base->sq_ring+p->sq_off.head);
+	base->sq_tail = (unsigned*)((uint8_t*)base->sq_ring+p->sq_off.tail);
+	base->sq_mask = *(unsigned*)((uint8_t*)base->sq_ring +
+		p->sq_off.ring_mask);
+	base->sq_entries = p->sq_entries;
+	base->sq_local_tail = *base->sq_tail;
+	/* the entries are used in order */
+	array = (unsigned*)((uint8_t*)base->sq_ring+p->sq_off.array);
+	for(i=0; i<p->sq_entries; i++)
+		array[i] = i;
+	if(!base->cq_ring_sz) {
+		base->cq_head = (unsigned*)((uint8_t*)base->sq_ring +
+			p->cq_off.head);
+		base->cq_tail = (unsigned*)((uint8_t*)base->sq_ring +
+			p->cq_off.tail);
+		base->cq_mask = *(unsigned*)((uint8_t*)base->sq_ring +
+			p->cq_off.ring_mask);
+		base->cqes = (struct io_uring_cqe*)((uint8_t*)base->sq_ring +
+			p->cq_off.cqes);
+	} else {
+		base->cq_head = (unsigned*)((uint8_t*)base->cq_ring +
+			p->cq_off.head);
+		base->cq_tail = (unsigned*)((uint8_t*)base->cq_ring +
+			p->cq_off.tail);
+		base->cq_mask = *(unsigned*)((uint8_t*)base->cq_ring +
+			p->cq_off.ring_mask);
+		base->cqes = (struct io_uring_cqe*)((uint8_t*)base->cq_ring +
+			p->cq_off.cqes);
+	}
+	return 1;
+}
+
+struct uring_event_base*
+uring_event_base_create(time_t* time_secs, struct timeval* time_tv)
+{
+	struct io_uring_params p;
+	struct uring_event_base* base = (struct uring_event_base*)calloc(1,
+		sizeof(*base));
+	if(!base)
+		return NULL;
+	base->time_secs = time_secs;
+	base->time_tv = time_tv;
+	base->send_free = -1;
+	base->acc_fd = -1;
+	base->ringfd = uring_setup(&p);
+	if(base->ringfd == -1) {
+		log_err("io_uring_setup: %s", strerror(errno));
+		free(base);
+		return NULL;
+	}
+	if(!(p.features & IORING_FEAT_EXT_ARG)) {
+		log_err("io_uring: kernel has no IORING_FEAT_EXT_ARG");
+		uring_event_base_free(base);
+		return NULL;
+	}
+	if(!uring_map(base, &p)) {
+		log_err("io_uring mmap: %s", strerror(errno));
+		uring_event_base_free(base);
+		return NULL;
+	}
+	if(settime(base) < 0) {
+		uring_event_base_free(base);
+		return NULL;
+	}
+	base->stream_ok = uring_probe_stream(base);
+	base->times = rbtree_create(uring_ev_cmp);
+	base->signals = (struct uring_event**)calloc(URING_MAX_SIG,
+		sizeof(struct uring_event*));
+	if(!base->times || !base->signals) {
+		uring_event_base_free(base);
+		return NULL;
+	}
+	return base;
+}
+
+/** which base gets to handle signals */
+static struct uring_event_base* signal_base = NULL;
+
+void
+uring_event_base_free(struct uring_event_base* base)
+{
+	int i;
+	if(!base)
+		return;
+	if(signal_base == base)
+		signal_base = NULL;
+	/* closing the ring cancels the requests, the buffers are freed
+	 * after that */
+	if(base->ringfd != -1)
+		close(base->ringfd);
+	if(base->sqes)
+		munmap(base->sqes, base->sqes_sz);
+	if(base->cq_ring)
+		munmap(base->cq_ring, base->cq_ring_sz);
+	if(base->sq_ring)
+		munmap(base->sq_ring, base->sq_ring_sz);
+	if(base->br)
+		munmap(base->br, base->br_sz);
+	free(base->recvbuf);
+	if(base->sends) {
+		for(i=0; i<URING_SEND_SLOTS; i++)
+			free(base->sends[i].ext);
+		free(base->sends);
+	}
+	for(i=0; i<base->capfd; i++)
+		free(base->fds[i].acc);
+	free(base->fds);
+	free(base->kept);
+	free(base->times);
+	free(base->signals);
+	free(base);
+}
+
+const char*
+uring_event_get_method(struct uring_event_base* ATTR_UNUSED(base))
+{
+	return "io_uring";
+}
+
+/** submit the queued entries, without waiting */
+static void
+uring_submit(struct uring_event_base* base)
+{
+	unsigned submit;
+	ring_store(base->sq_tail, base->sq_local_tail);
+	submit = base->sq_local_tail - ring_load(base->sq_head);
+	base->submits++;
+	if(sys_uring_enter(base->ringfd, submit, 0, 0, NULL, 0) == -1
+		&& errno != EAGAIN && errno != EBUSY && errno != EINTR)
+		log_err("io_uring_enter: %s", strerror(errno));
+}
+
+/** get a submission queue entry, NULL if the queue stays full */
+static struct io_uring_sqe*
+uring_get_sqe(struct uring_event_base* base)
+{
+	struct io_uring_sqe* sqe;
+	if(base->sq_local_tail - ring_load(base->sq_head) >=
+		base->sq_entries) {
+		uring_submit(base);
+		if(base->sq_local_tail - ring_load(base->sq_head) >=
+			base->sq_entries) {
+			log_err("io_uring: submission queue is full");
+			return NULL;
+		}
+	}
+	sqe = &base->sqes[base->sq_local_tail & base->sq_mask];
+	memset(sqe, 0, sizeof(*sqe));
+	base->sq_local_tail++;
+	return sqe;
+}
+
+/** make room in the fds array for fd */
+static int
+uring_fd_grow(struct uring_event_base* base, int fd)
+{
+	int newcap = base->capfd?base->capfd:64;
+	struct uring_fd* fds;
+	if(fd < base->capfd)
+		return 1;
+	while(newcap <= fd)
+		newcap *= 2;
+	fds = (struct uring_fd*)realloc(base->fds,
+		sizeof(struct uring_fd)*(size_t)newcap);
+	if(!fds) {
+		log_err("io_uring: out of memory for fd %d", fd);
+		return 0;
+	}
+	memset(&fds[base->capfd], 0,
+		sizeof(struct uring_fd)*(size_t)(newcap-base->capfd));
+	base->fds = fds;
+	base->capfd = newcap;
+	return 1;
+}
+
+/** set the poll mask of the sqe, it is word-reversed on big endian */
+static void
+uring_sqe_poll_mask(struct io_uring_sqe* sqe, uint32_t mask)
+{
+#if defined(__BYTE_ORDER) && defined(__BIG_ENDIAN) && __BYTE_ORDER == __BIG_ENDIAN
+	mask = (mask << 16) | (mask >> 16);
+#endif
+	sqe->poll32_events = mask;
+}
+
+/** arm a request for the active event on the fd */
+static void
+uring_arm(struct uring_event_base* base, int fd)
+{
+	struct uring_fd* f = &base->fds[fd];
+	struct uring_event* ev = f->ev;
+	short bits = ev->events&(UB_EV_READ|UB_EV_WRITE);
+	struct io_uring_sqe* sqe;
+	if(f->send_slot && (bits&UB_EV_WRITE))
+		return; /* armed when the queued write is done */
+	if(ev->accept && !f->acc && !f->no_recv) {
+		f->acc = (struct uring_accept*)calloc(1, sizeof(*f->acc));
+		if(!f->acc)
+			f->no_recv = 1;
+	}
+	if(!(sqe = uring_get_sqe(base)))
+		return;
+	f->gen++;
+	f->armed_bits = 0;
+	sqe->fd = fd;
+	if(ev->accept && !f->no_recv && bits == UB_EV_READ) {
+		/* accept the connection, with its address */
+		sqe->opcode = IORING_OP_ACCEPT;
+		f->acc->addrlen = (socklen_t)sizeof(f->acc->addr);
+		sqe->addr = (uint64_t)(uintptr_t)&f->acc->addr;
+		sqe->off = (uint64_t)(uintptr_t)&f->acc->addrlen;
+		sqe->accept_flags = SOCK_NONBLOCK;
+		f->armed = URING_UD(URING_UD_ACCEPT, f->gen, fd);
+		sqe->user_data = f->armed;
+		return;
+	}
+#ifdef IORING_RECV_MULTISHOT
+	if(ev->recv && base->recv_ok && !f->no_recv && bits == UB_EV_READ) {
+		/* read datagrams into the provided buffers until cancelled */
+		sqe->opcode = IORING_OP_RECVMSG;
+		sqe->addr = (uint64_t)(uintptr_t)&base->rmsg;
+		sqe->len = 1;
+		sqe->ioprio = IORING_RECV_MULTISHOT;
+		sqe->flags = IOSQE_BUFFER_SELECT;
+		sqe->buf_group = URING_RECV_BGID;
+		f->armed = URING_UD(URING_UD_RECV, f->gen, fd);
+		sqe->user_data = f->armed;
+		return;
+	}
+#endif
+	sqe->opcode = IORING_OP_POLL_ADD;
+	uring_sqe_poll_mask(sqe, ((bits&UB_EV_READ)?POLLIN:0) |
+		((bits&UB_EV_WRITE)?POLLOUT:0));
+	f->armed = URING_UD(URING_UD_POLL, f->gen, fd);
+	f->armed_bits = bits;
+	sqe->user_data = f->armed;
+}
+
+/** remove the armed request of the fd */
+static void
+uring_disarm(struct uring_event_base* base, int fd)
+{
+	struct uring_fd* f = &base->fds[fd];
+	struct io_uring_sqe* sqe;
+	if(!f->armed)
+		return;
+	/* a completion that is already queued is ignored, because it
+	 * has the old user_data */
+	sqe = uring_get_sqe(base);
+	if(sqe) {
+		if((f->armed>>56) == URING_UD_POLL)
+			sqe->opcode = IORING_OP_POLL_REMOVE;
+		else	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+		sqe->fd = -1;
+		sqe->addr = f->armed;
+		sqe->user_data = URING_UD_NONE;
+	}
+	f->armed = 0;
+	f->kept = 0;
+}
+
+/** keep the poll of the deleted stream event armed until the next submit,
+ * so that the TCP handlers that set a new timeout, or toggle and come
+ * back, do not remove it and poll again */
+static void
+uring_keep(struct uring_event_base* base, int fd)
+{
+	struct uring_fd* f = &base->fds[fd];
+	if(!f->kept_listed) {
+		if(base->kept_num == base->kept_cap) {
+			int newcap = base->kept_cap?base->kept_cap*2:64;
+			int* k = (int*)realloc(base->kept,
+				sizeof(int)*(size_t)newcap);
+			if(!k) {
+				uring_disarm(base, fd);
+				return;
+			}
+			base->kept = k;
+			base->kept_cap = newcap;
+		}
+		base->kept[base->kept_num++] = fd;
+		f->kept_listed = 1;
+	}
+	f->kept = 1;
+}
+
+/** remove the kept polls that have not been used again */
+static void
+uring_kept_remove(struct uring_event_base* base)
+{
+	int i;
+	for(i=0; i<base->kept_num; i++) {
+		struct uring_fd* f = &base->fds[base->kept[i]];
+		f->kept_listed = 0;
+		if(f->kept && !f->ev)
+			uring_disarm(base, base->kept[i]);
+		f->kept = 0;
+	}
+	base->kept_num = 0;
+}
+
+/** publish the queued entries, submit them and wait for completions */
+static int
+uring_submit_wait(struct uring_event_base* base, struct timeval* wait)
+{
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	unsigned submit;
+	ring_store(base->sq_tail, base->sq_local_tail);
+	submit = base->sq_local_tail - ring_load(base->sq_head);
+	base->submits++;
+	memset(&arg, 0, sizeof(arg));
+#ifndef S_SPLINT_S
+	if(wait->tv_sec != (time_t)-1) {
+		ts.tv_sec = wait->tv_sec;
+		ts.tv_nsec = (long long)wait->tv_usec*1000;
+		arg.ts = (uint64_t)(uintptr_t)&ts;
+	}
+#endif
+	if(sys_uring_enter(base->ringfd, submit, 1,
+		IORING_ENTER_GETEVENTS|IORING_ENTER_EXT_ARG, &arg,
+		sizeof(arg)) == -1) {
+		int e = errno;
+		if(settime(base) < 0)
+			return -1;
+		errno = e;
+		if(e == ETIME || e == EINTR || e == EAGAIN || e == EBUSY)
+			return 0;
+		log_err("io_uring_enter: %s", strerror(e));
+		return -1;
+	}
+	if(settime(base) < 0)
+		return -1;
+	return 0;
+}
+
+/** call timeouts handlers, and return how long to wait for next one or -1 */
+static void
+handle_timeouts(struct uring_event_base* base, struct timeval* now,
+	struct timeval* wait)
+{
+	struct uring_event* p;
+#ifndef S_SPLINT_S
+	wait->tv_sec = (time_t)-1;
+#endif
+
+	while((rbnode_type*)(p = (struct uring_event*)rbtree_first(base->times))
+		!=RBTREE_NULL) {
+#ifndef S_SPLINT_S
+		if(p->timeout.tv_sec > now->tv_sec ||
+			(p->timeout.tv_sec==now->tv_sec &&
+		 	p->timeout.tv_usec > now->tv_usec)) {
+			/* there is a next larger timeout. wait for it */
+			wait->tv_sec = p->timeout.tv_sec - now->tv_sec;
+			if(now->tv_usec > p->timeout.tv_usec) {
+				wait->tv_sec--;
+				wait->tv_usec = 1000000 - (now->tv_usec -
+					p->timeout.tv_usec);
+			} else {
+				wait->tv_usec = p->timeout.tv_usec
+					- now->tv_usec;
+			}
+			return;
+		}
+#endif
+		/* event times out, remove it */
+		(void)rbtree_delete(base->times, p);
+		p->in_times = 0;
+		p->events &= ~UB_EV_TIMEOUT;
+		fptr_ok(fptr_whitelist_event(p->cb));
+		(*p->cb)(p->fd, UB_EV_TIMEOUT, p->arg);
+	}
+}
+
+/** handle the completion of a poll request */
+static void
+handle_poll(struct uring_event_base* base, uint64_t ud, int res)
+{
+	int fd = (int)(uint32_t)ud;
+	struct uring_fd* f;
+	struct uring_event* ev;
+	short bits = 0;
+	if(fd < 0 || fd >= base->capfd)
+		return;
+	f = &base->fds[fd];
+	if(f->armed != ud)
+		return; /* stale, the event was deleted */
+	f->armed = 0;
+	if(!(ev = f->ev))
+		return;
+	if(res < 0) {
+		/* the event stays inactive until it is added again */
+		verbose(VERB_ALGO, "io_uring poll fd %d: %s", fd,
+			strerror(-res));
+		return;
+	}
+	if((res&(POLLIN|POLLERR|POLLHUP)))
+		bits |= UB_EV_READ;
+	if((res&(POLLOUT|POLLERR|POLLHUP)))
+		bits |= UB_EV_WRITE;
+	bits &= ev->events;
+	if(bits) {
+		fptr_ok(fptr_whitelist_event(ev->cb));
+		(*ev->cb)(ev->fd, bits, ev->arg);
+	}
+	/* the poll is one shot, arm it again if the event is still
+	 * active, so it fires again if the fd is still ready */
+	f = &base->fds[fd];
+	if(f->ev && !f->armed)
+		uring_arm(base, fd);
+}
+
+/** handle the completion of an accept request */
+static void
+handle_accept(struct uring_event_base* base, uint64_t ud, int res)
+{
+	int fd = (int)(uint32_t)ud;
+	struct uring_fd* f;
+	struct uring_event* ev;
+	if(fd < 0 || fd >= base->capfd || base->fds[fd].armed != ud) {
+		/* stale, the event was deleted, drop the connection */
+		if(res >= 0)
+			close(res);
+		return;
+	}
+	f = &base->fds[fd];
+	f->armed = 0;
+	ev = f->ev;
+	if(res == -EINVAL || res == -EOPNOTSUPP) {
+		verbose(VERB_ALGO, "io_uring accept fd %d: %s, poll it "
+			"instead", fd, strerror(-res));
+		f->no_recv = 1;
+	} else if(!ev) {
+		if(res >= 0)
+			close(res);
+	} else {
+		/* the callback takes the connection, or gets the error,
+		 * with uring_event_base_accept */
+		base->has_acc = 1;
+		base->acc_fd = (res < 0)?-1:res;
+		base->acc_err = (res < 0)?-res:0;
+		base->acc_cur = f->acc;
+		fptr_ok(fptr_whitelist_event(ev->cb));
+		(*ev->cb)(ev->fd, UB_EV_READ, ev->arg);
+		if(base->has_acc && base->acc_fd != -1)
+			close(base->acc_fd);
+		base->has_acc = 0;
+		base->acc_fd = -1;
+	}
+	f = &base->fds[fd];
+	if(f->ev && !f->armed)
+		uring_arm(base, fd);
+}
+
+#ifdef IORING_RECV_MULTISHOT
+/** give a receive buffer back to the kernel */
+static void
+uring_recvbuf_add(struct uring_event_base* base, int bid)
+{
+	struct io_uring_buf* b = &base->br->bufs[base->br_tail &
+		(base->recv_num-1)];
+	b->addr = (uint64_t)(uintptr_t)(base->recvbuf +
+		base->recv_bufsize*(size_t)bid);
+	b->len = (uint32_t)base->recv_bufsize;
+	b->bid = (uint16_t)bid;
+	base->br_tail++;
+	atomic_store_explicit((_Atomic uint16_t*)&base->br->tail,
+		base->br_tail, memory_order_release);
+}
+
+/** register the provided buffer ring, when first used, with buffers for
+ * datagrams of datalen.  Returns false if the base cannot read datagrams
+ * of that size. */
+static int
+uring_recv_setup(struct uring_event_base* base, size_t datalen)
+{
+	struct io_uring_buf_reg reg;
+	int i;
+	if(base->recv_tried)
+		return base->recv_ok && datalen <= base->recv_datalen;
+	base->recv_tried = 1;
+	base->recv_datalen = datalen;
+	base->recv_bufsize = sizeof(struct io_uring_recvmsg_out) +
+		sizeof(struct sockaddr_storage) + URING_CTL_SIZE + datalen;
+	/* fewer buffers when they are large, they are given back after
+	 * every datagram */
+	base->recv_num = URING_RECV_BUFS;
+	while(base->recv_num > URING_RECV_BUFS_MIN &&
+		base->recv_bufsize*(size_t)base->recv_num > URING_RECV_MEM)
+		base->recv_num /= 2;
+	base->br_sz = (size_t)base->recv_num*sizeof(struct io_uring_buf);
+	base->br = (struct io_uring_buf_ring*)mmap(NULL, base->br_sz,
+		PROT_READ|PROT_WRITE, MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
+	if(base->br == MAP_FAILED) {
+		base->br = NULL;
+		log_err("io_uring: mmap buffer ring: %s", strerror(errno));
+		return 0;
+	}
+	base->recvbuf = (uint8_t*)malloc(base->recv_bufsize *
+		(size_t)base->recv_num);
+	if(!base->recvbuf) {
+		log_err("io_uring: out of memory for receive buffers");
+		return 0;
+	}
+	memset(&reg, 0, sizeof(reg));
+	reg.ring_addr = (uint64_t)(uintptr_t)base->br;
+	reg.ring_entries = (uint32_t)base->recv_num;
+	reg.bgid = URING_RECV_BGID;
+	if(sys_uring_register(base->ringfd, IORING_REGISTER_PBUF_RING,
+		&reg, 1) == -1) {
+		verbose(VERB_ALGO, "io_uring: no provided buffer ring, the "
+			"UDP sockets are polled: %s", strerror(errno));
+		return 0;
+	}
+	for(i=0; i<base->recv_num; i++)
+		uring_recvbuf_add(base, i);
+	memset(&base->rmsg, 0, sizeof(base->rmsg));
+	base->rmsg.msg_namelen = (socklen_t)sizeof(struct sockaddr_storage);
+	base->rmsg.msg_controllen = URING_CTL_SIZE;
+	base->recv_ok = 1;
+	return 1;
+}
+
+/** pass a received datagram to the callback of the event */
+static void
+uring_recv_datagram(struct uring_event_base* base, struct uring_event* ev,
+	int bid, int res)
+{
+	uint8_t* buf = base->recvbuf + base->recv_bufsize*(size_t)bid;
+	struct io_uring_recvmsg_out* out = (struct io_uring_recvmsg_out*)buf;
+	struct msghdr* m = &base->cur;
+	if((size_t)res < sizeof(*out))
+		return;
+	memset(m, 0, sizeof(*m));
+	m->msg_name = buf + sizeof(*out);
+	m->msg_namelen = (socklen_t)out->namelen;
+	m->msg_control = (uint8_t*)m->msg_name + base->rmsg.msg_namelen;
+	m->msg_controllen = out->controllen;
+	base->cur_iov.iov_base = (uint8_t*)m->msg_control +
+		base->rmsg.msg_controllen;
+	/* a datagram larger than the message buffer is truncated, like
+	 * when the callback reads it from the fd */
+	base->cur_iov.iov_len = (out->payloadlen > base->recv_datalen)?
+		base->recv_datalen:out->payloadlen;
+	m->msg_iov = &base->cur_iov;
+	m->msg_iovlen = 1;
+	m->msg_flags = (int)out->flags;
+	base->has_cur = 1;
+	fptr_ok(fptr_whitelist_event(ev->cb));
+	(*ev->cb)(ev->fd, UB_EV_READ, ev->arg);
+	base->has_cur = 0;
+}
+
+/** handle the completion of a multishot recvmsg request */
+static void
+handle_recv(struct uring_event_base* base, uint64_t ud, int res,
+	uint32_t flags)
+{
+	int fd = (int)(uint32_t)ud;
+	int bid = -1;
+	struct uring_fd* f;
+	if((flags & IORING_CQE_F_BUFFER))
+		bid = (int)(flags >> IORING_CQE_BUFFER_SHIFT);
+	if(fd < 0 || fd >= base->capfd || base->fds[fd].armed != ud) {
+		/* stale, the event was deleted */
+		if(bid != -1)
+			uring_recvbuf_add(base, bid);
+		return;
+	}
+	f = &base->fds[fd];
+	if(!(flags & IORING_CQE_F_MORE))
+		f->armed = 0; /* the request has ended */
+	if(res < 0) {
+		/* ENOBUFS ends the request when all buffers are in use, it
+		 * is armed again below, other errors poll the fd */
+		if(res != -ENOBUFS) {
+			verbose(VERB_ALGO, "io_uring recvmsg fd %d: %s, "
+				"poll it instead", fd, strerror(-res));
+			f->no_recv = 1;
+			uring_disarm(base, fd);
+		}
+	} else if(bid != -1 && f->ev) {
+		uring_recv_datagram(base, f->ev, bid, res);
+	}
+	if(bid != -1)
+		uring_recvbuf_add(base, bid);
+	f = &base->fds[fd];
+	if(f->ev && !f->armed)
+		uring_arm(base, fd);
+}
+#endif /* IORING_RECV_MULTISHOT */
+
+/** handle the completion of a sendmsg request */
+static void
+handle_send(struct uring_event_base* base, int idx, int res)
+{
+	struct uring_send* s;
+	if(!base->sends || idx < 0 || idx >= URING_SEND_SLOTS)
+		return;
+	s = &base->sends[idx];
+	if(!s->stream && (res == -EAGAIN ||
+#ifdef EWOULDBLOCK
+		res == -EWOULDBLOCK ||
+#endif
+		res == -ENOBUFS)) {
+		/* try again and block, waiting for IO to complete,
+		 * like for a single reply */
+		ssize_t sent;
+		fd_set_block(s->fd);
+		sent = sendmsg(s->fd, &s->msg, 0);
+		res = (sent == -1)?-errno:(int)sent;
+		fd_set_nonblock(s->fd);
+	}
+	if(res < 0) {
+		verbose(VERB_ALGO, "io_uring sendmsg failed: %s",
+			strerror(-res));
+		if(!s->stream)
+			log_addr(VERB_ALGO, "remote address is", &s->addr,
+				s->msg.msg_namelen);
+	} else if((size_t)res != s->iov.iov_len) {
+		log_err("sent %d in place of %d bytes", res,
+			(int)s->iov.iov_len);
+	}
+	if(s->stream) {
+		/* the next write on the stream can be done */
+		struct uring_fd* f = (s->fd < base->capfd)?
+			&base->fds[s->fd]:NULL;
+		free(s->ext);
+		s->ext = NULL;
+		s->stream = 0;
+		if(f && f->send_slot == idx+1) {
+			f->send_slot = 0;
+			if(f->ev && !f->armed)
+				uring_arm(base, s->fd);
+		}
+	}
+	s->next = base->send_free;
+	base->send_free = idx;
+}
+
+/** handle the completions that are in the queue */
+static void
+handle_completions(struct uring_event_base* base)
+{
+	unsigned head = *base->cq_head;
+	struct io_uring_cqe* cqe;
+	uint64_t ud;
+	int res, n;
+	uint32_t flags;
+	for(n=0; n<URING_CQ_BATCH && !base->need_to_exit; n++) {
+		if(head == ring_load(base->cq_tail))
+			break;
+		cqe = &base->cqes[head & base->cq_mask];
+		ud = cqe->user_data;
+		res = cqe->res;
+		flags = cqe->flags;
+		/* free the entry before the callback, that can submit */
+		head++;
+		ring_store(base->cq_head, head);
+		switch((int)(ud>>56)) {
+		case URING_UD_POLL:
+			handle_poll(base, ud, res);
+			break;
+#ifdef IORING_RECV_MULTISHOT
+		case URING_UD_RECV:
+			handle_recv(base, ud, res, flags);
+			break;
+#endif
+		case URING_UD_SEND:
+			handle_send(base, (int)(uint32_t)ud, res);
+			break;
+		case URING_UD_ACCEPT:
+			handle_accept(base, ud, res);
+			break;
+		default:
+			/* results of removals */
+			break;
+		}
+	}
+	(void)flags;
+}
+
+int
+uring_event_base_dispatch(struct uring_event_base* base)
+{
+	struct timeval wait;
+	if(settime(base) < 0)
+		return -1;
+	while(!base->need_to_exit)
+	{
+		/* see if timeouts need handling */
+		handle_timeouts(base, base->time_tv, &wait);
+		if(base->need_to_exit)
+			return 0;
+		uring_kept_remove(base);
+		/* submit the queued requests and wait */
+		if(uring_submit_wait(base, &wait) < 0) {
+			if(base->need_to_exit)
+				return 0;
+			return -1;
+		}
+		handle_completions(base);
+	}
+	return 0;
+}
+
+int
+uring_event_base_loopexit(struct uring_event_base* base)
+{
+	base->need_to_exit = 1;
+	return 0;
+}
+
+struct uring_event*
+uring_event_new(struct uring_event_base* base, int fd, short bits,
+	void (*cb)(int, short, void*), void* arg)
+{
+	struct uring_event* ev = (struct uring_event*)calloc(1,
+		sizeof(*ev));
+	if(!ev)
+		return NULL;
+	ev->node.key = ev;
+	ev->base = base;
+	ev->fd = fd;
+	ev->events = bits;
+	ev->cb = cb;
+	fptr_ok(fptr_whitelist_event(ev->cb));
+	ev->arg = arg;
+	return ev;
+}
+
+struct uring_event*
+uring_signal_new(struct uring_event_base* base, int sig,
+	void (*cb)(int, short, void*), void* arg)
+{
+	return uring_event_new(base, sig, UB_EV_SIGNAL|UB_EV_PERSIST, cb,
+		arg);
+}
+
+void
+uring_event_add_bits(struct uring_event* ev, short bits)
+{
+	ev->events |= bits;
+}
+
+void
+uring_event_del_bits(struct uring_event* ev, short bits)
+{
+	ev->events &= ~bits;
+}
+
+void
+uring_event_set_fd(struct uring_event* ev, int fd)
+{
+	ev->fd = fd;
+}
+
+void
+uring_event_free(struct uring_event* ev)
+{
+	free(ev);
+}
+
+void
+uring_event_recv_datagrams(struct uring_event* ev, size_t datalen)
+{
+#ifdef IORING_RECV_MULTISHOT
+	if(uring_recv_setup(ev->base, datalen))
+		ev->recv = 1;
+#else
+	(void)ev;
+	(void)datalen;
+#endif
+}
+
+void
+uring_event_accept_conns(struct uring_event* ev)
+{
+	ev->accept = 1;
+}
+
+void
+uring_event_stream(struct uring_event* ev)
+{
+	ev->stream = 1;
+}
+
+int
+uring_event_add(struct uring_event* ev, struct timeval* tv)
+{
+	struct uring_event_base* base = ev->base;
+	if(ev->added)
+		uring_event_del(ev);
+	if((ev->events&(UB_EV_READ|UB_EV_WRITE)) && ev->fd != -1) {
+		struct uring_fd* f;
+		if(!uring_fd_grow(base, ev->fd))
+			return -1;
+		f = &base->fds[ev->fd];
+		if(f->kept && ev->stream && f->armed && f->armed_bits ==
+			(ev->events&(UB_EV_READ|UB_EV_WRITE))) {
+			/* the kept poll waits for the same */
+			f->kept = 0;
+			f->ev = ev;
+		} else {
+			if(f->armed)
+				uring_disarm(base, ev->fd);
+			f->kept = 0;
+			f->ev = ev;
+			f->no_recv = 0;
+			uring_arm(base, ev->fd);
+		}
+	}
+	if(tv && (ev->events&UB_EV_TIMEOUT)) {
+#ifndef S_SPLINT_S
+		struct timeval *now = base->time_tv;
+		ev->timeout.tv_sec = tv->tv_sec + now->tv_sec;
+		ev->timeout.tv_usec = tv->tv_usec + now->tv_usec;
+		while(ev->timeout.tv_usec >= 1000000) {
+			ev->timeout.tv_usec -= 1000000;
+			ev->timeout.tv_sec++;
+		}
+#endif
+		(void)rbtree_insert(base->times, &ev->node);
+		ev->in_times = 1;
+	}
+	ev->added = 1;
+	return 0;
+}
+
+int
+uring_event_del(struct uring_event* ev)
+{
+	struct uring_event_base* base = ev->base;
+	if(ev->in_times) {
+		(void)rbtree_delete(base->times, &ev->node);
+		ev->in_times = 0;
+	}
+	if(ev->fd != -1 && ev->fd < base->capfd &&
+		base->fds[ev->fd].ev == ev) {
+		struct uring_fd* f = &base->fds[ev->fd];
+		if(ev->stream && f->armed && (f->armed>>56) == URING_UD_POLL)
+			uring_keep(base, ev->fd);
+		else	uring_disarm(base, ev->fd);
+		base->fds[ev->fd].ev = NULL;
+	}
+	ev->added = 0;
+	return 0;
+}
+
+int
+uring_timer_add(struct uring_event* ev, struct uring_event_base* base,
+	void (*cb)(int, short, void*), void* arg, struct timeval* tv)
+{
+	if(ev->added)
+		uring_event_del(ev);
+	ev->base = base;
+	ev->fd = -1;
+	ev->events = UB_EV_TIMEOUT;
+	ev->cb = cb;
+	fptr_ok(fptr_whitelist_event(ev->cb));
+	ev->arg = arg;
+	return uring_event_add(ev, tv);
+}
+
+/** signal handler */
+static RETSIGTYPE
+uring_sigh(int sig)
+{
+	struct uring_event* ev;
+	if(!signal_base || sig < 0 || sig >= URING_MAX_SIG)
+		return;
+	ev = signal_base->signals[sig];
+	if(!ev)
+		return;
+	fptr_ok(fptr_whitelist_event(ev->cb));
+	(*ev->cb)(sig, UB_EV_SIGNAL, ev->arg);
+}
+
+int
+uring_signal_add(struct uring_event* ev)
+{
+	struct sigaction sa;
+	if(ev->fd == -1 || ev->fd >= URING_MAX_SIG)
+		return -1;
+	signal_base = ev->base;
+	ev->base->signals[ev->fd] = ev;
+	ev->added = 1;
+	/* without SA_RESTART, so that the signal interrupts the wait */
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = uring_sigh;
+	sigemptyset(&sa.sa_mask);
+	if(sigaction(ev->fd, &sa, NULL) == -1) {
+		return -1;
+	}
+	return 0;
+}
+
+int
+uring_signal_del(struct uring_event* ev)
+{
+	if(ev->fd == -1 || ev->fd >= URING_MAX_SIG)
+		return -1;
+	ev->base->signals[ev->fd] = NULL;
+	ev->added = 0;
+	return 0;
+}
+
+struct msghdr*
+uring_event_base_recvmsg(struct uring_event_base* base)
+{
+	if(!base->has_cur)
+		return NULL;
+	return &base->cur;
+}
+
+/** allocate the send slots, when first used */
+static int
+uring_send_slots(struct uring_event_base* base)
+{
+	int idx;
+	if(base->sends)
+		return 1;
+	base->sends = (struct uring_send*)calloc(URING_SEND_SLOTS,
+		sizeof(struct uring_send));
+	if(!base->sends)
+		return 0;
+	for(idx=0; idx<URING_SEND_SLOTS; idx++)
+		base->sends[idx].next = (idx+1<URING_SEND_SLOTS)?idx+1:-1;
+	base->send_free = 0;
+	return 1;
+}
+
+int
+uring_event_base_sendmsg(struct uring_event_base* base, int fd,
+	struct msghdr* msg)
+{
+	struct io_uring_sqe* sqe;
+	struct uring_send* s;
+	int idx;
+	size_t len;
+	if(msg->msg_iovlen != 1 || msg->msg_iov[0].iov_len > URING_SEND_DATA
+		|| msg->msg_namelen > (socklen_t)sizeof(s->addr)
+		|| msg->msg_controllen > sizeof(s->ctl.buf))
+		return 0;
+	if(!uring_send_slots(base))
+		return 0;
+	if(base->send_free == -1)
+		return 0; /* all slots in use, the caller sends it */
+	if(!(sqe = uring_get_sqe(base)))
+		return 0;
+	idx = base->send_free;
+	s = &base->sends[idx];
+	base->send_free = s->next;
+	len = msg->msg_iov[0].iov_len;
+	memmove(s->data, msg->msg_iov[0].iov_base, len);
+	s->iov.iov_base = s->data;
+	s->iov.iov_len = len;
+	memset(&s->msg, 0, sizeof(s->msg));
+	if(msg->msg_name && msg->msg_namelen) {
+		memmove(&s->addr, msg->msg_name, msg->msg_namelen);
+		s->msg.msg_name = &s->addr;
+		s->msg.msg_namelen = msg->msg_namelen;
+	}
+	s->msg.msg_iov = &s->iov;
+	s->msg.msg_iovlen = 1;
+	if(msg->msg_control && msg->msg_controllen) {
+		memmove(s->ctl.buf, msg->msg_control, msg->msg_controllen);
+		s->msg.msg_control = s->ctl.buf;
+		s->msg.msg_controllen = msg->msg_controllen;
+	}
+	s->fd = fd;
+	sqe->opcode = IORING_OP_SENDMSG;
+	sqe->fd = fd;
+	sqe->addr = (uint64_t)(uintptr_t)&s->msg;
+	sqe->len = 1;
+	sqe->user_data = URING_UD(URING_UD_SEND, 0, idx);
+	return 1;
+}
+
+int
+uring_event_base_send(struct uring_event_base* base, int fd,
+	struct iovec* iov, int iovcnt)
+{
+	struct io_uring_sqe* sqe;
+	struct uring_send* s;
+	struct uring_fd* f;
+	uint8_t* ext = NULL, *p;
+	size_t len = 0;
+	int i, idx;
+	if(!base->stream_ok || fd < 0 || fd >= base->capfd)
+		return 0;
+	f = &base->fds[fd];
+	if(f->send_slot)
+		return -1; /* one write at a time, they stay in order */
+	if(!f->ev || !f->ev->stream)
+		return 0;
+	for(i=0; i<iovcnt; i++)
+		len += iov[i].iov_len;
+	if(!uring_send_slots(base) || base->send_free == -1)
+		return 0;
+	if(len > URING_SEND_DATA && !(ext = (uint8_t*)malloc(len)))
+		return 0;
+	if(!(sqe = uring_get_sqe(base))) {
+		free(ext);
+		return 0;
+	}
+	idx = base->send_free;
+	s = &base->sends[idx];
+	base->send_free = s->next;
+	s->ext = ext;
+	p = ext?ext:s->data;
+	s->iov.iov_base = p;
+	s->iov.iov_len = len;
+	for(i=0; i<iovcnt; i++) {
+		memmove(p, iov[i].iov_base, iov[i].iov_len);
+		p += iov[i].iov_len;
+	}
+	memset(&s->msg, 0, sizeof(s->msg));
+	s->msg.msg_iov = &s->iov;
+	s->msg.msg_iovlen = 1;
+	s->fd = fd;
+	s->stream = 1;
+	sqe->opcode = IORING_OP_SENDMSG;
+	sqe->fd = fd;
+	sqe->addr = (uint64_t)(uintptr_t)&s->msg;
+	sqe->len = 1;
+	/* the kernel sends it whole, or fails */
+	sqe->msg_flags = MSG_WAITALL | MSG_NOSIGNAL;
+	sqe->user_data = URING_UD(URING_UD_SEND, 0, idx);
+	f->send_slot = idx+1;
+	f->send_submit = base->submits;
+	return 1;
+}
+
+int
+uring_event_base_accept(struct uring_event_base* base, int* fd,
+	struct sockaddr_storage* addr, socklen_t* addrlen)
+{
+	socklen_t len;
+	if(!base->has_acc)
+		return 0;
+	base->has_acc = 0;
+	*fd = base->acc_fd;
+	if(*fd == -1) {
+		errno = base->acc_err;
+		return 1;
+	}
+	len = base->acc_cur->addrlen;
+	if(len > *addrlen)
+		len = *addrlen;
+	memmove(addr, &base->acc_cur->addr, len);
+	*addrlen = len;
+	return 1;
+}
+
+void
+uring_event_base_close_fd(struct uring_event_base* base, int fd)
+{
+	struct uring_fd* f;
+	if(fd < 0 || fd >= base->capfd)
+		return;
+	f = &base->fds[fd];
+	if(f->kept)
+		uring_disarm(base, fd);
+	/* the kernel has the file when the write is submitted */
+	if(f->send_slot && f->send_submit == base->submits)
+		uring_submit(base);
+	f->send_slot = 0;
+}
+
+#endif /* USE_IO_URING */
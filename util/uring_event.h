@@ -0,0 +1,231 @@
+/*
+ * util/uring_event.h - event base on Linux io_uring.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * This file implements an event base with the ub_event semantics on the
+ * Linux io_uring interface, with the system calls and without liburing.
+ * The daemon uses it in place of the compiled in event base when
+ * use-io-uring is enabled.
+ *
+ * File descriptors are watched with one shot poll requests, that are
+ * armed again after the callback while the event is active, so events
+ * stay level triggered, like select and libevent.  The poll requests,
+ * and their removals, are queued and submitted together with the wait
+ * for completions, in one io_uring_enter call per loop.  Timeouts are
+ * kept in a redblack tree, the first one is the timeout of the wait.
+ *
+ * UDP events can have the base read the datagrams itself, with a multishot
+ * recvmsg request that takes buffers from a provided buffer ring.  The
+ * buffers are as large as the message buffer of the UDP ports.  The
+ * callback then gets one datagram at a time, and replies are copied into
+ * send slots and submitted with the next io_uring_enter.
+ *
+ * TCP accept events can have the base accept the connections, with an
+ * accept request in place of the poll.  Stream events, of the TCP
+ * handlers, keep their poll armed when they are deleted and added again
+ * before the next submit, like when only the timeout is set again, and
+ * their writes can be queued on the base, one at a time per stream, with
+ * a sendmsg request that the kernel completes whole.
+ *
+ * Signals are handled like in mini_event, one handler per signal.
+ */
+
+#ifndef UTIL_URING_EVENT_H
+#define UTIL_URING_EVENT_H
+
+#if defined(HAVE_LINUX_IO_URING_H) && defined(HAVE_SYS_MMAN_H) && \
+	defined(HAVE_STDATOMIC_H) && !defined(USE_WINSOCK)
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#  if defined(IORING_FEAT_EXT_ARG) && defined(__NR_io_uring_setup)
+/** the io_uring event base is compiled in */
+#define USE_IO_URING 1
+#  endif
+#endif
+
+#ifdef USE_IO_URING
+struct uring_event_base;
+struct uring_event;
+struct msghdr;
+struct iovec;
+struct sockaddr_storage;
+
+/**
+ * See if the kernel supports the features that the event base needs.
+ * @return false if io_uring cannot be used.
+ */
+int uring_event_probe(void);
+
+/**
+ * Create io_uring event base.
+ * @param time_secs: where to store the time in seconds.
+ * @param time_tv: where to store the time in microseconds.
+ * @return new base or NULL on failure.
+ */
+struct uring_event_base* uring_event_base_create(time_t* time_secs,
+	struct timeval* time_tv);
+
+/** free event base. Free events yourself */
+void uring_event_base_free(struct uring_event_base* base);
+
+/** run the loop until loopexit */
+int uring_event_base_dispatch(struct uring_event_base* base);
+
+/** exit that loop */
+int uring_event_base_loopexit(struct uring_event_base* base);
+
+/** get the method name, with or without datagram reads by the base */
+const char* uring_event_get_method(struct uring_event_base* base);
+
+/** create new event for fd, with UB_EV bits, callback and its arg */
+struct uring_event* uring_event_new(struct uring_event_base* base, int fd,
+	short bits, void (*cb)(int, short, void*), void* arg);
+
+/** create new signal event */
+struct uring_event* uring_signal_new(struct uring_event_base* base, int sig,
+	void (*cb)(int, short, void*), void* arg);
+
+/** add event bits, the event is not active */
+void uring_event_add_bits(struct uring_event* ev, short bits);
+
+/** remove event bits, the event is not active */
+void uring_event_del_bits(struct uring_event* ev, short bits);
+
+/** set the fd, the event is not active */
+void uring_event_set_fd(struct uring_event* ev, int fd);
+
+/** free the event, it has to be deleted first */
+void uring_event_free(struct uring_event* ev);
+
+/** activate the event, with the timeout if UB_EV_TIMEOUT is set */
+int uring_event_add(struct uring_event* ev, struct timeval* tv);
+
+/** deactivate the event */
+int uring_event_del(struct uring_event* ev);
+
+/** set the event to be a timer with callback and activate it */
+int uring_timer_add(struct uring_event* ev, struct uring_event_base* base,
+	void (*cb)(int, short, void*), void* arg, struct timeval* tv);
+
+/** compare events in tree, based on timevalue, ptr for uniqueness */
+int uring_ev_cmp(const void* a, const void* b);
+
+/** install the signal handler */
+int uring_signal_add(struct uring_event* ev);
+
+/** remove the signal handler */
+int uring_signal_del(struct uring_event* ev);
+
+/**
+ * Have the base read the datagrams for the UDP event, when the kernel
+ * supports it.  Set this before the event is added.
+ * @param ev: the event.
+ * @param datalen: the size of the message buffer, larger datagrams are
+ * 	truncated.  The first UDP event sets the size of the receive
+ * 	buffers, events with a larger buffer are polled.
+ */
+void uring_event_recv_datagrams(struct uring_event* ev, size_t datalen);
+
+/**
+ * Have the base accept the connections for the TCP accept event.  Set this
+ * before the event is added.
+ * @param ev: the event.
+ */
+void uring_event_accept_conns(struct uring_event* ev);
+
+/**
+ * Mark the event as the event of a stream, that is closed after
+ * uring_event_base_close_fd.  Its poll is then kept when it is deleted
+ * and added again, and its writes can be queued with uring_event_base_send.
+ * @param ev: the event.
+ */
+void uring_event_stream(struct uring_event* ev);
+
+/**
+ * The datagram that the base has read for the callback that runs now.
+ * @param base: the event base.
+ * @return the message, with the payload in msg_iov[0], or NULL if the
+ * 	callback has to read the fd itself.
+ */
+struct msghdr* uring_event_base_recvmsg(struct uring_event_base* base);
+
+/**
+ * Queue a datagram to be sent with the next submit.  The name, the
+ * control data and the payload in msg_iov[0] are copied.
+ * @param base: the event base.
+ * @param fd: the socket.
+ * @param msg: the message.
+ * @return false if it is not queued, and the caller has to send it.
+ */
+int uring_event_base_sendmsg(struct uring_event_base* base, int fd,
+	struct msghdr* msg);
+
+/**
+ * Queue a write on the stream of the active stream event for the fd, to be
+ * sent with the next submit.  The data is copied.
+ * @param base: the event base.
+ * @param fd: the socket.
+ * @param iov: the data.
+ * @param iovcnt: number of elements in iov.
+ * @return 1 if it is queued, 0 if the caller has to write it, and -1 if an
+ * 	earlier write is still in progress, the event for writing is then
+ * 	armed when that is done.
+ */
+int uring_event_base_send(struct uring_event_base* base, int fd,
+	struct iovec* iov, int iovcnt);
+
+/**
+ * The connection that the base has accepted for the callback that runs now.
+ * @param base: the event base.
+ * @param fd: the new fd is returned, or -1 with errno set if the accept
+ * 	failed.
+ * @param addr: the address of the remote end is returned.
+ * @param addrlen: the size of addr, the length of the address is returned.
+ * @return false if the callback has to accept it itself.
+ */
+int uring_event_base_accept(struct uring_event_base* base, int* fd,
+	struct sockaddr_storage* addr, socklen_t* addrlen);
+
+/**
+ * The fd is going to be closed, the base removes the kept poll of it, and
+ * submits the write on it that is queued.
+ * @param base: the event base.
+ * @param fd: the fd.
+ */
+void uring_event_base_close_fd(struct uring_event_base* base, int fd);
+#endif /* USE_IO_URING */
+
+#endif /* UTIL_URING_EVENT_H */
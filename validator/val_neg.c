@@ -95,17 +95,19 @@ struct val_neg_cache* val_neg_create(struct config_file* cfg, size_t maxiter)
 	neg->max = 1024*1024; /* 1 M is thousands of entries */
 	if(cfg) neg->max = cfg->neg_cache_size;
 	rbtree_init(&neg->tree, &val_neg_zone_compare);
-	lock_basic_init(&neg->lock);
-	lock_protect(&neg->lock, neg, sizeof(*neg));
+	lock_rw_init(&neg->lock);
+	lock_protect(&neg->lock, &neg->tree, sizeof(neg->tree));
+	lock_basic_init(&neg->lru_lock);
+	lock_protect(&neg->lru_lock, &neg->use, sizeof(neg->use));
 	return neg;
 }
 
 size_t val_neg_get_mem(struct val_neg_cache* neg)
 {
 	size_t result;
-	lock_basic_lock(&neg->lock);
+	lock_basic_lock(&neg->lru_lock);
 	result = sizeof(*neg) + neg->use;
-	lock_basic_unlock(&neg->lock);
+	lock_basic_unlock(&neg->lru_lock);
 	return result;
 }
 
@@ -125,6 +127,7 @@ neg_clear_zones(rbnode_type* n, void* ATTR_UNUSED(arg))
 	struct val_neg_zone* z = (struct val_neg_zone*)n;
 	/* delete all the rrset entries in the tree */
 	traverse_postorder(&z->tree, &neg_clear_datas, NULL);
+	lock_rw_destroy(&z->lock);
 	free(z->nsec3_salt);
 	free(z->name);
 	free(z);
@@ -133,7 +136,8 @@ neg_clear_zones(rbnode_type* n, void* ATTR_UNUSED(arg))
 void neg_cache_delete(struct val_neg_cache* neg)
 {
 	if(!neg) return;
-	lock_basic_destroy(&neg->lock);
+	lock_rw_destroy(&neg->lock);
+	lock_basic_destroy(&neg->lru_lock);
 	/* delete all the zones in the tree */
 	traverse_postorder(&neg->tree, &neg_clear_zones, NULL);
 	free(neg);
@@ -141,6 +145,7 @@ void neg_cache_delete(struct val_neg_cache* neg)
 
 /**
  * Put data element at the front of the LRU list.
+ * Needs the LRU lock.
  * @param neg: negative cache with LRU start and end.
  * @param data: this data is fronted.
  */
@@ -157,6 +162,7 @@ static void neg_lru_front(struct val_neg_cache* neg,
 
 /**
  * Remove data element from LRU list.
+ * Needs the LRU lock.
  * @param neg: negative cache with LRU start and end.
  * @param data: this data is removed from the list.
  */
@@ -173,6 +179,7 @@ static void neg_lru_remove(struct val_neg_cache* neg,
 
 /**
  * Touch LRU for data element, put it at the start of the LRU list.
+ * Needs the LRU lock.
  * @param neg: negative cache with LRU start and end.
  * @param data: this data is used.
  */
@@ -191,6 +198,7 @@ static void neg_lru_touch(struct val_neg_cache* neg,
  * Delete a zone element from the negative cache.
  * May delete other zone elements to keep tree coherent, or
  * only mark the element as 'not in use'.
+ * Needs the write lock on the cache.
  * @param neg: negative cache.
  * @param z: zone element to delete.
  */
@@ -215,7 +223,10 @@ static void neg_delete_zone(struct val_neg_cache* neg, struct val_neg_zone* z)
 	while(p && p->count == 0) {
 		np = p->parent;
 		(void)rbtree_delete(&neg->tree, &p->node);
+		lock_basic_lock(&neg->lru_lock);
 		neg->use -= p->len + sizeof(*p);
+		lock_basic_unlock(&neg->lru_lock);
+		lock_rw_destroy(&p->lock);
 		free(p->nsec3_salt);
 		free(p->name);
 		free(p);
@@ -234,8 +245,10 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 	el->in_use = 0;
 
 	/* remove it from the lru list */
+	lock_basic_lock(&neg->lru_lock);
 	neg_lru_remove(neg, el);
 	log_assert(neg->first != el && neg->last != el);
+	lock_basic_unlock(&neg->lru_lock);
 	
 	/* go up the tree and reduce counts */
 	p = el;
@@ -250,7 +263,9 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
 	while(p && p->count == 0) {
 		np = p->parent;
 		(void)rbtree_delete(&z->tree, &p->node);
+		lock_basic_lock(&neg->lru_lock);
 		neg->use -= p->len + sizeof(*p);
+		lock_basic_unlock(&neg->lru_lock);
 		free(p->name);
 		free(p);
 		p = np;
@@ -266,14 +281,21 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el)
  * Create more space in negative cache
  * The oldest elements are deleted until enough space is present.
  * Empty zones are deleted.
+ * Needs the write lock on the cache.
  * @param neg: negative cache.
  * @param need: how many bytes are needed.
  */
 static void neg_make_space(struct val_neg_cache* neg, size_t need)
 {
+	struct val_neg_data* last;
 	/* delete elements until enough space or its empty */
-	while(neg->last && neg->max < neg->use + need) {
-		neg_delete_data(neg, neg->last);
+	while(1) {
+		lock_basic_lock(&neg->lru_lock);
+		last = (neg->max < neg->use + need)?neg->last:NULL;
+		lock_basic_unlock(&neg->lru_lock);
+		if(!last)
+			break;
+		neg_delete_data(neg, last);
 	}
 }
 
@@ -465,6 +487,7 @@ static struct val_neg_zone* neg_setup_zone_node(
 	zone->dclass = dclass;
 
 	rbtree_init(&zone->tree, &val_neg_data_compare);
+	lock_rw_init(&zone->lock);
 	return zone;
 }
 
@@ -497,6 +520,7 @@ static struct val_neg_zone* neg_zone_chain(
 			struct val_neg_zone* p=first, *np;
 			while(p) {
 				np = p->parent;
+				lock_rw_destroy(&p->lock);
 				free(p->name);
 				free(p);
 				p = np;
@@ -551,7 +575,9 @@ struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
 	while(p) {
 		np = p->parent;
 		/* mem use */
+		lock_basic_lock(&neg->lru_lock);
 		neg->use += sizeof(struct val_neg_zone) + p->len;
+		lock_basic_unlock(&neg->lru_lock);
 		/* insert in tree */
 		(void)rbtree_insert(&neg->tree, &p->node);
 		/* last one needs proper parent pointer */
@@ -788,7 +814,9 @@ void neg_insert_data(struct val_neg_cache* neg,
 		while(p) {
 			np = p->parent;
 			/* mem use */
+			lock_basic_lock(&neg->lru_lock);
 			neg->use += sizeof(struct val_neg_data) + p->len;
+			lock_basic_unlock(&neg->lru_lock);
 			/* insert in tree */
 			p->zone = zone;
 			(void)rbtree_insert(&zone->tree, &p->node);
@@ -808,10 +836,14 @@ void neg_insert_data(struct val_neg_cache* neg,
 			p->count++;
 		}
 
+		lock_basic_lock(&neg->lru_lock);
 		neg_lru_front(neg, el);
+		lock_basic_unlock(&neg->lru_lock);
 	} else {
 		/* in use, bring to front, lru */
+		lock_basic_lock(&neg->lru_lock);
 		neg_lru_touch(neg, el);
+		lock_basic_unlock(&neg->lru_lock);
 	}
 
 	/* if nsec3 store last used parameters */
@@ -875,14 +907,126 @@ static uint8_t* reply_nsec_signer(struct reply_info* rep, size_t* signer_len,
 	return 0;
 }
 
+/**
+ * Insert the NSECs of the reply into the zone.
+ * @param neg: negative cache.
+ * @param zone: the zone, it is in use.
+ * @param rep: the reply.
+ * @param nsec3: if true, also insert NSEC3 records.
+ */
+static void neg_insert_rrsets(struct val_neg_cache* neg,
+	struct val_neg_zone* zone, struct reply_info* rep, int nsec3)
+{
+	size_t i;
+	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
+		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC &&
+			(!nsec3 || ntohs(rep->rrsets[i]->rk.type) !=
+			LDNS_RR_TYPE_NSEC3))
+			continue;
+		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
+			zone->name)) continue;
+		/* insert NSEC into this zone's tree */
+		neg_insert_data(neg, zone, rep->rrsets[i]);
+	}
+}
+
+/**
+ * Insert the NSECs of the reply into a zone that is in use, with the read
+ * lock on the cache and the write lock on the zone.  This is the common
+ * case, the validator inserts the NSECs of every answer, also when they
+ * come from the negative cache.  The other zones are not blocked.
+ * @param neg: negative cache.
+ * @param rep: the reply.
+ * @param nm: name of the zone.
+ * @param nm_len: length of nm.
+ * @param dclass: class of the zone.
+ * @param need: space needed.
+ * @param nsec3: if true, also insert NSEC3 records.
+ * @return false if the zone is not in use or there is not enough space,
+ * 	and the NSECs have to be inserted with the write lock on the cache.
+ */
+static int neg_insert_inuse(struct val_neg_cache* neg, struct reply_info* rep,
+	uint8_t* nm, size_t nm_len, uint16_t dclass, size_t need, int nsec3)
+{
+	struct val_neg_zone* zone;
+	lock_rw_rdlock(&neg->lock);
+	zone = neg_find_zone(neg, nm, nm_len, dclass);
+	if(!zone || !zone->in_use) {
+		lock_rw_unlock(&neg->lock);
+		return 0;
+	}
+	/* reserve the space, so that inserts in other zones cannot take it
+	 * at the same time, the space is made with the write lock */
+	lock_basic_lock(&neg->lru_lock);
+	if(neg->max < neg->use + need) {
+		lock_basic_unlock(&neg->lru_lock);
+		lock_rw_unlock(&neg->lock);
+		return 0;
+	}
+	neg->use += need;
+	lock_basic_unlock(&neg->lru_lock);
+
+	/* the zone stays in use, its NSECs are inserted, and the wipeout
+	 * of the elements between them does not delete the NSEC itself, so
+	 * the zone does not become empty */
+	lock_rw_wrlock(&zone->lock);
+	neg_insert_rrsets(neg, zone, rep, nsec3);
+	lock_rw_unlock(&zone->lock);
+
+	lock_basic_lock(&neg->lru_lock);
+	neg->use -= need;
+	lock_basic_unlock(&neg->lru_lock);
+	lock_rw_unlock(&neg->lock);
+	return 1;
+}
+
+/**
+ * Insert the NSECs of the reply into the zone, it is created if needed.
+ * @param neg: negative cache.
+ * @param rep: the reply.
+ * @param nm: name of the zone.
+ * @param nm_len: length of nm.
+ * @param dclass: class of the zone.
+ * @param nsec3: if true, also insert NSEC3 records.
+ */
+static void neg_insert_reply(struct val_neg_cache* neg, struct reply_info* rep,
+	uint8_t* nm, size_t nm_len, uint16_t dclass, int nsec3)
+{
+	struct val_neg_zone* zone;
+	/* ask for enough space to store all of it */
+	size_t need = calc_data_need(rep) + calc_zone_need(nm, nm_len);
+	if(neg_insert_inuse(neg, rep, nm, nm_len, dclass, need, nsec3))
+		return;
+
+	lock_rw_wrlock(&neg->lock);
+	neg_make_space(neg, need);
+
+	/* find or create the zone entry */
+	zone = neg_find_zone(neg, nm, nm_len, dclass);
+	if(!zone) {
+		if(!(zone = neg_create_zone(neg, nm, nm_len, dclass))) {
+			lock_rw_unlock(&neg->lock);
+			log_err("out of memory adding negative zone");
+			return;
+		}
+	}
+	val_neg_zone_take_inuse(zone);
+
+	/* insert the NSECs, no zone lock is needed with the write lock */
+	neg_insert_rrsets(neg, zone, rep, nsec3);
+	if(zone->tree.count == 0) {
+		/* remove empty zone if inserts failed */
+		neg_delete_zone(neg, zone);
+	}
+	lock_rw_unlock(&neg->lock);
+}
+
 void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 {
-	size_t i, need;
 	struct ub_packed_rrset_key* soa;
 	uint8_t* dname = NULL;
 	size_t dname_len;
 	uint16_t rrset_class;
-	struct val_neg_zone* zone;
 	/* see if secure nsecs inside */
 	if(!reply_has_nsec(rep))
 		return;
@@ -901,39 +1045,7 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 
 	log_nametypeclass(VERB_ALGO, "negcache insert for zone",
 		dname, LDNS_RR_TYPE_SOA, rrset_class);
-	
-	/* ask for enough space to store all of it */
-	need = calc_data_need(rep) + 
-		calc_zone_need(dname, dname_len);
-	lock_basic_lock(&neg->lock);
-	neg_make_space(neg, need);
-
-	/* find or create the zone entry */
-	zone = neg_find_zone(neg, dname, dname_len, rrset_class);
-	if(!zone) {
-		if(!(zone = neg_create_zone(neg, dname, dname_len,
-			rrset_class))) {
-			lock_basic_unlock(&neg->lock);
-			log_err("out of memory adding negative zone");
-			return;
-		}
-	}
-	val_neg_zone_take_inuse(zone);
-
-	/* insert the NSECs */
-	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC)
-			continue;
-		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
-			zone->name)) continue;
-		/* insert NSEC into this zone's tree */
-		neg_insert_data(neg, zone, rep->rrsets[i]);
-	}
-	if(zone->tree.count == 0) {
-		/* remove empty zone if inserts failed */
-		neg_delete_zone(neg, zone);
-	}
-	lock_basic_unlock(&neg->lock);
+	neg_insert_reply(neg, rep, dname, dname_len, rrset_class, 0);
 }
 
 /**
@@ -968,11 +1080,9 @@ static int neg_closest_data(struct val_neg_zone* zone,
 void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 	uint8_t* zone_name)
 {
-	size_t i, need;
 	uint8_t* signer;
 	size_t signer_len;
 	uint16_t dclass;
-	struct val_neg_zone* zone;
 	/* no SOA in this message, find RRSIG over NSEC's signer name.
 	 * note the NSEC records are maybe not validated yet */
 	signer = reply_nsec_signer(rep, &signer_len, &dclass);
@@ -985,39 +1095,7 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 
 	log_nametypeclass(VERB_ALGO, "negcache insert referral ",
 		signer, LDNS_RR_TYPE_NS, dclass);
-	
-	/* ask for enough space to store all of it */
-	need = calc_data_need(rep) + calc_zone_need(signer, signer_len);
-	lock_basic_lock(&neg->lock);
-	neg_make_space(neg, need);
-
-	/* find or create the zone entry */
-	zone = neg_find_zone(neg, signer, signer_len, dclass);
-	if(!zone) {
-		if(!(zone = neg_create_zone(neg, signer, signer_len, 
-			dclass))) {
-			lock_basic_unlock(&neg->lock);
-			log_err("out of memory adding negative zone");
-			return;
-		}
-	}
-	val_neg_zone_take_inuse(zone);
-
-	/* insert the NSECs */
-	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC &&
-			ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC3)
-			continue;
-		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
-			zone->name)) continue;
-		/* insert NSEC into this zone's tree */
-		neg_insert_data(neg, zone, rep->rrsets[i]);
-	}
-	if(zone->tree.count == 0) {
-		/* remove empty zone if inserts failed */
-		neg_delete_zone(neg, zone);
-	}
-	lock_basic_unlock(&neg->lock);
+	neg_insert_reply(neg, rep, signer, signer_len, dclass, 1);
 }
 
 /**
@@ -1116,26 +1194,29 @@ neg_find_nsec(struct val_neg_cache* neg_cache, uint8_t* qname, size_t qname_len,
 	struct ub_packed_rrset_key* nsec;
 
 	labs = dname_count_labels(qname);
-	lock_basic_lock(&neg_cache->lock);
+	lock_rw_rdlock(&neg_cache->lock);
 	zone = neg_closest_zone_parent(neg_cache, qname, qname_len, labs,
 		qclass);
 	while(zone && !zone->in_use)
 		zone = zone->parent;
 	if(!zone) {
-		lock_basic_unlock(&neg_cache->lock);
+		lock_rw_unlock(&neg_cache->lock);
 		return NULL;
 	}
+	lock_rw_rdlock(&zone->lock);
 
 	/* NSEC only for now */
 	if(zone->nsec3_hash) {
-		lock_basic_unlock(&neg_cache->lock);
+		lock_rw_unlock(&zone->lock);
+		lock_rw_unlock(&neg_cache->lock);
 		return NULL;
 	}
 
 	/* ignore return value, don't care if it is an exact or smaller match */
 	(void)neg_closest_data(zone, qname, qname_len, labs, &data);
 	if(!data) {
-		lock_basic_unlock(&neg_cache->lock);
+		lock_rw_unlock(&zone->lock);
+		lock_rw_unlock(&neg_cache->lock);
 		return NULL;
 	}
 
@@ -1144,7 +1225,8 @@ neg_find_nsec(struct val_neg_cache* neg_cache, uint8_t* qname, size_t qname_len,
 	if(!data->in_use) {
 		data = (struct val_neg_data*)rbtree_previous((rbnode_type*)data);
 		if((rbnode_type*)data == RBTREE_NULL || !data->in_use) {
-			lock_basic_unlock(&neg_cache->lock);
+			lock_rw_unlock(&zone->lock);
+			lock_rw_unlock(&neg_cache->lock);
 			return NULL;
 		}
 	}
@@ -1155,7 +1237,8 @@ neg_find_nsec(struct val_neg_cache* neg_cache, uint8_t* qname, size_t qname_len,
 
 	nsec = grab_nsec(rrset_cache, data->name, data->len, LDNS_RR_TYPE_NSEC,
 		zone->dclass, flags, region, 0, 0, now);
-	lock_basic_unlock(&neg_cache->lock);
+	lock_rw_unlock(&zone->lock);
+	lock_rw_unlock(&neg_cache->lock);
 	return nsec;
 }
 
@@ -1415,9 +1498,9 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 		if(addsoa && !add_soa(rrset_cache, now, region, msg, NULL))
 			return NULL;
 
-		lock_basic_lock(&neg->lock);
+		lock_basic_lock(&neg->lru_lock);
 		neg->num_neg_cache_noerror++;
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&neg->lru_lock);
 		return msg;
 	} else if(nsec && val_nsec_proves_name_error(nsec, qinfo->qname)) {
 		if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len, 
@@ -1499,12 +1582,12 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 			return NULL;
 
 		/* Increment statistic counters */
-		lock_basic_lock(&neg->lock);
+		lock_basic_lock(&neg->lru_lock);
 		if(rcode == LDNS_RCODE_NOERROR)
 			neg->num_neg_cache_noerror++;
 		else if(rcode == LDNS_RCODE_NXDOMAIN)
 			neg->num_neg_cache_nxdomain++;
-		lock_basic_unlock(&neg->lock);
+		lock_basic_unlock(&neg->lru_lock);
 
 		FLAGS_SET_RCODE(msg->rep->flags, rcode);
 		return msg;
@@ -1522,7 +1605,7 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 	zname_labs = dname_count_labels(zname);
 
 	/* lookup closest zone */
-	lock_basic_lock(&neg->lock);
+	lock_rw_rdlock(&neg->lock);
 	zone = neg_closest_zone_parent(neg, zname, zname_len, zname_labs, 
 		qinfo->qclass);
 	while(zone && !zone->in_use)
@@ -1534,16 +1617,19 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 			zone = NULL;
 	}
 	if(!zone) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return NULL;
 	}
+	lock_rw_rdlock(&zone->lock);
 
 	msg = neg_nsec3_proof_ds(zone, qinfo->qname, qinfo->qname_len, 
 		zname_labs+1, buf, rrset_cache, region, now, topname);
 	if(msg && addsoa && !add_soa(rrset_cache, now, region, msg, zone)) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&zone->lock);
+		lock_rw_unlock(&neg->lock);
 		return NULL;
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&zone->lock);
+	lock_rw_unlock(&neg->lock);
 	return msg;
 }
@@ -63,13 +63,21 @@ struct ub_packed_rrset_key;
  * from zone content changes.  
  * It contains a tree of zones, every zone has a tree of data elements.
  * The data elements are part of one big LRU list, with one memory counter.
+ *
+ * Locking: lookups, and inserts into a zone that is in use, take the
+ * read lock on the cache and then the lock on the zone, so the threads
+ * can work on different zones at the same time.  Changes to the tree of
+ * zones, and the deletes to make space, take the write lock on the cache,
+ * and then the zone locks are not needed.  The LRU list, the memory
+ * counter and the statistics have their own lock, that is taken last.
  */
 struct val_neg_cache {
-	/** the big lock on the negative cache.  Because we use a rbtree 
-	 * for the data (quick lookup), we need a big lock */
-	lock_basic_type lock;
+	/** lock on the tree of zones, and the structure of the zones */
+	lock_rw_type lock;
 	/** The zone rbtree. contents sorted canonical, type val_neg_zone */
 	rbtree_type tree;
+	/** lock on the LRU list, the memory counter and the statistics */
+	lock_basic_type lru_lock;
 	/** the first in linked list of LRU of val_neg_data */
 	struct val_neg_data* first;
 	/** last in lru (least recently used element) */
@@ -109,6 +117,10 @@ struct val_neg_zone {
 	 * No elements have a count of zero, those are removed. */
 	int count;
 
+	/** lock on the tree of NSEC data, the data elements and the nsec3
+	 * parameters, taken with the read lock on the cache */
+	lock_rw_type lock;
+
 	/** if 0: NSEC zone, else NSEC3 hash algorithm in use */
 	int nsec3_hash;
 	/** nsec3 iteration count in use */
@@ -250,7 +262,8 @@ struct dns_msg* val_neg_getmsg(struct val_neg_cache* neg,
 /**** functions exposed for unit test ****/
 /**
  * Insert data into the data tree of a zone
- * Does not do locking.
+ * Needs the write lock on the cache, or the read lock on the cache and
+ * the write lock on the zone, if the zone is in use.
  * @param neg: negative cache
  * @param zone: zone to insert into
  * @param nsec: record to insert.
@@ -262,7 +275,8 @@ void neg_insert_data(struct val_neg_cache* neg,
  * Delete a data element from the negative cache.
  * May delete other data elements to keep tree coherent, or
  * only mark the element as 'not in use'.
- * Does not do locking.
+ * Needs the write lock on the cache, or the read lock on the cache and
+ * the write lock on the zone, if the zone does not become empty.
  * @param neg: negative cache.
  * @param el: data element to delete.
  */
@@ -270,7 +284,7 @@ void neg_delete_data(struct val_neg_cache* neg, struct val_neg_data* el);
 
 /**
  * Find the given zone, from the SOA owner name and class
- * Does not do locking.
+ * Needs the lock on the cache.
  * @param neg: negative cache
  * @param nm: what to look for.
  * @param len: length of nm
@@ -282,7 +296,7 @@ struct val_neg_zone* neg_find_zone(struct val_neg_cache* neg,
 
 /**
  * Create a new zone.
- * Does not do locking.
+ * Needs the write lock on the cache.
  * @param neg: negative cache
  * @param nm: what to look for.
  * @param nm_len: length of name.
@@ -294,7 +308,7 @@ struct val_neg_zone* neg_create_zone(struct val_neg_cache* neg,
 
 /**
  * take a zone into use. increases counts of parents.
- * Does not do locking.
+ * Needs the write lock on the cache.
  * @param zone: zone to take into use.
  */
 void val_neg_zone_take_inuse(struct val_neg_zone* zone);
@@ -0,0 +1,541 @@
+/*
+ * validator/val_pool.c - signature verify threads for the validator.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the signature verify threads for the validator.
+ */
+#include "config.h"
+#include "validator/val_pool.h"
+#include "validator/val_kentry.h"
+#include "validator/val_sigcrypt.h"
+#include "services/mesh.h"
+#include "util/module.h"
+#include "util/tube.h"
+#include "util/regional.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/fptr_wlist.h"
+#include "sldns/sbuffer.h"
+
+/** copy an rrset into the region of the job */
+static struct ub_packed_rrset_key*
+job_copy_rrset(struct regional* region, struct ub_packed_rrset_key* key)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)
+		key->entry.data;
+	struct ub_packed_rrset_key* ck = regional_alloc(region,
+		sizeof(struct ub_packed_rrset_key));
+	if(!ck)
+		return NULL;
+	ck->id = key->id;
+	memset(&ck->entry, 0, sizeof(ck->entry));
+	ck->entry.hash = key->entry.hash;
+	ck->entry.key = ck;
+	ck->rk = key->rk;
+	ck->rk.dname = regional_alloc_init(region, key->rk.dname,
+		key->rk.dname_len);
+	if(!ck->rk.dname)
+		return NULL;
+	ck->entry.data = regional_alloc_init(region, d,
+		packed_rrset_sizeof(d));
+	if(!ck->entry.data)
+		return NULL;
+	packed_rrset_ptr_fixup((struct packed_rrset_data*)ck->entry.data);
+	return ck;
+}
+
+/** verify the rrsets of a job, on a verify thread */
+static void
+job_verify(struct val_pool_thr* thr, struct val_pool_job* job)
+{
+	size_t i;
+	thr->now = job->now;
+	for(i=0; i<job->num; i++) {
+		char* reason = NULL;
+		/* no qstate, the NSEC owner name replacement that needs it
+		 * is not done here, those rrsets are verified on the query
+		 * thread */
+		job->sec[i] = dnskeyset_verify_rrset(thr->env, job->ve,
+			job->rrsets[i], job->dnskey, job->sigalg, &reason,
+			job->section[i], NULL);
+		if(job->sec[i] != sec_status_secure && reason)
+			job->reason[i] = regional_strdup(job->region, reason);
+		regional_free_all(thr->env->scratch);
+		job->num_done = i+1;
+		if(job->sec[i] != sec_status_secure && job->required[i])
+			break;
+	}
+}
+
+/** put the job in the done list of its connection, with the lock */
+static void
+job_done(struct val_pool_job* job)
+{
+	struct val_pool_conn* conn = job->conn;
+	uint8_t msg = 0;
+	int wake = (conn->done_first == NULL);
+	job->state = val_pool_job_done;
+	job->next = NULL;
+	job->prev = conn->done_last;
+	if(conn->done_last)
+		conn->done_last->next = job;
+	else	conn->done_first = job;
+	conn->done_last = job;
+	/* the thread is woken up once for the list, it takes all jobs */
+	if(wake && !tube_write_msg(conn->tube, &msg, sizeof(msg), 0))
+		log_err("val pool: could not wake up query thread");
+}
+
+/** take the first job from the queue, with the lock */
+static struct val_pool_job*
+queue_pop(struct val_pool* pool)
+{
+	struct val_pool_job* job = pool->queue_first;
+	if(!job)
+		return NULL;
+	pool->queue_first = job->next;
+	if(job->next)
+		job->next->prev = NULL;
+	else	pool->queue_last = NULL;
+	pool->queue_num--;
+	job->next = NULL;
+	job->prev = NULL;
+	return job;
+}
+
+/** the verify thread function */
+static void*
+val_pool_thread(void* arg)
+{
+	struct val_pool_thr* thr = (struct val_pool_thr*)arg;
+	struct val_pool* pool = thr->pool;
+	log_thread_set(&thr->thread_num);
+	ub_thread_blocksigs();
+	verbose(VERB_ALGO, "start signature verify thread");
+	for(;;) {
+		struct val_pool_job* job;
+		uint8_t* msg = NULL;
+		uint32_t len = 0;
+		int r;
+		/* wait for a job, one thread reads the tube at a time */
+		lock_basic_lock(&pool->read_lock);
+		r = tube_read_msg(pool->tube, &msg, &len, 0);
+		lock_basic_unlock(&pool->read_lock);
+		free(msg);
+		lock_basic_lock(&pool->lock);
+		if(!r || pool->quit) {
+			if(!pool->quit)
+				log_err("signature verify thread: could not "
+					"read tube, thread stops");
+			lock_basic_unlock(&pool->lock);
+			break;
+		}
+		/* the job may have been deleted while it was queued */
+		if(!(job = queue_pop(pool))) {
+			lock_basic_unlock(&pool->lock);
+			continue;
+		}
+		job->state = val_pool_job_running;
+		lock_basic_unlock(&pool->lock);
+
+		job_verify(thr, job);
+
+		lock_basic_lock(&pool->lock);
+		if(job->cancelled) {
+			regional_destroy(job->region);
+			free(job);
+		} else	job_done(job);
+		lock_basic_unlock(&pool->lock);
+	}
+	verbose(VERB_ALGO, "stop signature verify thread");
+	return NULL;
+}
+
+/** delete the verify environment of a thread */
+static void
+thr_env_delete(struct module_env* env)
+{
+	if(!env)
+		return;
+	regional_destroy(env->scratch);
+	sldns_buffer_free(env->scratch_buffer);
+	free(env);
+}
+
+/** create the verify environment of a thread */
+static struct module_env*
+thr_env_create(struct config_file* cfg, time_t* now)
+{
+	struct module_env* env = (struct module_env*)calloc(1, sizeof(*env));
+	if(!env)
+		return NULL;
+	env->cfg = cfg;
+	env->now = now;
+	env->scratch = regional_create_custom(cfg->msg_buffer_size);
+	env->scratch_buffer = sldns_buffer_new(cfg->msg_buffer_size);
+	if(!env->scratch || !env->scratch_buffer) {
+		thr_env_delete(env);
+		return NULL;
+	}
+	return env;
+}
+
+struct val_pool*
+val_pool_create(struct config_file* cfg, int num, int thread_num)
+{
+	int i;
+	struct val_pool* pool = (struct val_pool*)calloc(1, sizeof(*pool));
+	if(!pool)
+		return NULL;
+	lock_basic_init(&pool->lock);
+	lock_basic_init(&pool->read_lock);
+	lock_protect(&pool->lock, &pool->queue_first, sizeof(pool->queue_first)
+		+ sizeof(pool->queue_last) + sizeof(pool->queue_num)
+		+ sizeof(pool->quit));
+	pool->tube = tube_create();
+	pool->thr = (struct val_pool_thr*)calloc((size_t)num,
+		sizeof(*pool->thr));
+	if(!pool->tube || !pool->thr) {
+		val_pool_delete(pool);
+		return NULL;
+	}
+	pool->num = num;
+	for(i=0; i<num; i++) {
+		pool->thr[i].pool = pool;
+		pool->thr[i].thread_num = thread_num+i;
+		pool->thr[i].env = thr_env_create(cfg, &pool->thr[i].now);
+		if(!pool->thr[i].env) {
+			val_pool_delete(pool);
+			return NULL;
+		}
+	}
+	for(i=0; i<num; i++) {
+		ub_thread_create(&pool->thr[i].tid, val_pool_thread,
+			&pool->thr[i]);
+		pool->num_started++;
+	}
+	verbose(VERB_ALGO, "started %d signature verify threads", num);
+	return pool;
+}
+
+void
+val_pool_delete(struct val_pool* pool)
+{
+	int i;
+	struct val_pool_job* job;
+	if(!pool)
+		return;
+	if(pool->num_started > 0) {
+		uint8_t msg = 0;
+		lock_basic_lock(&pool->lock);
+		pool->quit = 1;
+		for(i=0; i<pool->num_started; i++) {
+			if(!tube_write_msg(pool->tube, &msg, sizeof(msg), 0))
+				log_err("val pool: could not stop thread");
+		}
+		lock_basic_unlock(&pool->lock);
+		for(i=0; i<pool->num_started; i++)
+			ub_thread_join(pool->thr[i].tid);
+	}
+	/* the queries of the jobs are gone, with their connections */
+	lock_basic_lock(&pool->lock);
+	while((job = queue_pop(pool)) != NULL) {
+		regional_destroy(job->region);
+		free(job);
+	}
+	lock_basic_unlock(&pool->lock);
+	if(pool->thr) {
+		for(i=0; i<pool->num; i++)
+			thr_env_delete(pool->thr[i].env);
+		free(pool->thr);
+	}
+	tube_delete(pool->tube);
+	lock_basic_destroy(&pool->lock);
+	lock_basic_destroy(&pool->read_lock);
+	free(pool);
+}
+
+struct val_pool_conn*
+val_pool_conn_create(struct val_pool* pool, struct comm_base* base)
+{
+	struct val_pool_conn* conn = (struct val_pool_conn*)calloc(1,
+		sizeof(*conn));
+	if(!conn)
+		return NULL;
+	conn->pool = pool;
+	conn->tube = tube_create();
+	if(!conn->tube) {
+		free(conn);
+		return NULL;
+	}
+	if(!tube_setup_bg_listen(conn->tube, base, &val_pool_conn_handle,
+		conn)) {
+		tube_delete(conn->tube);
+		free(conn);
+		return NULL;
+	}
+	return conn;
+}
+
+void
+val_pool_conn_delete(struct val_pool_conn* conn)
+{
+	struct val_pool_job* job;
+	if(!conn)
+		return;
+	/* jobs that are left have no query any more */
+	lock_basic_lock(&conn->pool->lock);
+	while((job = conn->done_first) != NULL) {
+		conn->done_first = job->next;
+		regional_destroy(job->region);
+		free(job);
+	}
+	conn->done_last = NULL;
+	lock_basic_unlock(&conn->pool->lock);
+	tube_delete(conn->tube);
+	free(conn);
+}
+
+struct val_pool_job*
+val_pool_job_create(struct val_pool_conn* conn, struct module_qstate* qstate,
+	struct val_env* ve, struct key_entry_key* kkey, size_t max)
+{
+	struct key_entry_data* kd = (struct key_entry_data*)kkey->entry.data;
+	struct val_pool_job* job = (struct val_pool_job*)calloc(1,
+		sizeof(*job));
+	struct packed_rrset_data* d;
+	if(!job)
+		return NULL;
+	job->conn = conn;
+	job->qstate = qstate;
+	job->ve = ve;
+	job->now = *qstate->env->now;
+	job->region = regional_create();
+	if(!job->region) {
+		free(job);
+		return NULL;
+	}
+	/* the DNSKEY rrset, like val_verify_rrset_entry makes it */
+	job->dnskey = (struct ub_packed_rrset_key*)regional_alloc_zero(
+		job->region, sizeof(*job->dnskey));
+	d = (struct packed_rrset_data*)regional_alloc_init(job->region,
+		kd->rrset_data, packed_rrset_sizeof(kd->rrset_data));
+	if(!job->dnskey || !d)
+		goto fail;
+	packed_rrset_ptr_fixup(d);
+	job->dnskey->rk.type = htons(kd->rrset_type);
+	job->dnskey->rk.rrset_class = htons(kkey->key_class);
+	job->dnskey->rk.dname = regional_alloc_init(job->region, kkey->name,
+		kkey->namelen);
+	job->dnskey->rk.dname_len = kkey->namelen;
+	job->dnskey->entry.key = job->dnskey;
+	job->dnskey->entry.data = d;
+	if(!job->dnskey->rk.dname)
+		goto fail;
+	if(kd->algo) {
+		job->sigalg = (uint8_t*)regional_strdup(job->region,
+			(char*)kd->algo);
+		if(!job->sigalg)
+			goto fail;
+	}
+	job->orig = regional_alloc_zero(job->region, sizeof(*job->orig)*max);
+	job->rrsets = regional_alloc_zero(job->region,
+		sizeof(*job->rrsets)*max);
+	job->section = regional_alloc_zero(job->region,
+		sizeof(*job->section)*max);
+	job->required = regional_alloc_zero(job->region,
+		sizeof(*job->required)*max);
+	job->sec = regional_alloc_zero(job->region, sizeof(*job->sec)*max);
+	job->reason = regional_alloc_zero(job->region,
+		sizeof(*job->reason)*max);
+	if(!job->orig || !job->rrsets || !job->section || !job->required ||
+		!job->sec || !job->reason)
+		goto fail;
+	return job;
+fail:
+	regional_destroy(job->region);
+	free(job);
+	return NULL;
+}
+
+int
+val_pool_job_add(struct val_pool_job* job, struct ub_packed_rrset_key* rrset,
+	sldns_pkt_section section, int required)
+{
+	struct ub_packed_rrset_key* ck = job_copy_rrset(job->region, rrset);
+	if(!ck)
+		return 0;
+	job->orig[job->num] = rrset;
+	job->rrsets[job->num] = ck;
+	job->section[job->num] = section;
+	job->required[job->num] = (uint8_t)required;
+	job->num++;
+	return 1;
+}
+
+int
+val_pool_job_submit(struct val_pool_job* job)
+{
+	struct val_pool* pool = job->conn->pool;
+	uint8_t msg = 0;
+	lock_basic_lock(&pool->lock);
+	if(pool->queue_num >= VAL_POOL_QUEUE_MAX) {
+		lock_basic_unlock(&pool->lock);
+		return 0;
+	}
+	job->state = val_pool_job_queued;
+	job->next = NULL;
+	job->prev = pool->queue_last;
+	if(pool->queue_last)
+		pool->queue_last->next = job;
+	else	pool->queue_first = job;
+	pool->queue_last = job;
+	pool->queue_num++;
+	if(!tube_write_msg(pool->tube, &msg, sizeof(msg), 0))
+		log_err("val pool: could not wake up verify thread");
+	lock_basic_unlock(&pool->lock);
+	return 1;
+}
+
+int
+val_pool_job_is_done(struct val_pool_job* job)
+{
+	/* set by the query thread itself, no lock needed */
+	return job->state == val_pool_job_taken;
+}
+
+int
+val_pool_job_result(struct val_pool_job* job,
+	struct ub_packed_rrset_key* rrset, enum sec_status* sec,
+	char** reason)
+{
+	size_t i;
+	for(i=0; i<job->num_done; i++) {
+		if(job->orig[i] == rrset) {
+			struct packed_rrset_data* d = (struct packed_rrset_data*)
+				rrset->entry.data;
+			struct packed_rrset_data* cd = (struct
+				packed_rrset_data*)job->rrsets[i]->entry.data;
+			/* the verification lowers the TTL to the signature
+			 * original TTL and expiration */
+			if(cd->ttl < d->ttl)
+				d->ttl = cd->ttl;
+			*sec = job->sec[i];
+			if(job->reason[i])
+				*reason = job->reason[i];
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void
+val_pool_job_delete(struct val_pool_job* job)
+{
+	struct val_pool* pool;
+	if(!job)
+		return;
+	pool = job->conn->pool;
+	lock_basic_lock(&pool->lock);
+	switch(job->state) {
+	case val_pool_job_queued:
+		if(job->prev)
+			job->prev->next = job->next;
+		else	pool->queue_first = job->next;
+		if(job->next)
+			job->next->prev = job->prev;
+		else	pool->queue_last = job->prev;
+		pool->queue_num--;
+		break;
+	case val_pool_job_running:
+		/* the verify thread deletes it when it is done */
+		job->cancelled = 1;
+		lock_basic_unlock(&pool->lock);
+		return;
+	case val_pool_job_done:
+		if(job->prev)
+			job->prev->next = job->next;
+		else	job->conn->done_first = job->next;
+		if(job->next)
+			job->next->prev = job->prev;
+		else	job->conn->done_last = job->prev;
+		break;
+	case val_pool_job_new:
+	case val_pool_job_taken:
+	default:
+		break;
+	}
+	lock_basic_unlock(&pool->lock);
+	regional_destroy(job->region);
+	free(job);
+}
+
+struct val_pool_job*
+val_pool_conn_take(struct val_pool_conn* conn)
+{
+	struct val_pool_job* job;
+	lock_basic_lock(&conn->pool->lock);
+	job = conn->done_first;
+	if(job) {
+		conn->done_first = job->next;
+		if(job->next)
+			job->next->prev = NULL;
+		else	conn->done_last = NULL;
+		job->next = NULL;
+		job->prev = NULL;
+		job->state = val_pool_job_taken;
+	}
+	lock_basic_unlock(&conn->pool->lock);
+	return job;
+}
+
+void
+val_pool_conn_handle(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct val_pool_conn* conn = (struct val_pool_conn*)arg;
+	struct val_pool_job* job;
+	free(msg);
+	if(error != 0)
+		return;
+	/* wake up the queries one by one, a query that runs can delete
+	 * the jobs of other queries */
+	while((job = val_pool_conn_take(conn)) != NULL) {
+		mesh_run(job->qstate->env->mesh, job->qstate->mesh_info,
+			module_event_pass, NULL);
+	}
+}
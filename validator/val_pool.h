@@ -0,0 +1,294 @@
+/*
+ * validator/val_pool.h - signature verify threads for the validator.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the signature verify threads for the validator.
+ * The validator can hand the signatures of a response to these threads.
+ * The query then waits, and the thread that handles queries continues
+ * with other work.  When the signatures are verified, the query is woken
+ * up on its own thread with the results.
+ *
+ * The job has its own copy of the rrsets and keys, so that a query can
+ * be deleted while the verification is busy.
+ */
+
+#ifndef VALIDATOR_VAL_POOL_H
+#define VALIDATOR_VAL_POOL_H
+#include "util/locks.h"
+#include "util/data/packed_rrset.h"
+#include "sldns/pkthdr.h"
+struct config_file;
+struct module_env;
+struct comm_base;
+struct module_qstate;
+struct key_entry_key;
+struct val_env;
+struct tube;
+struct regional;
+struct sldns_buffer;
+struct val_pool;
+struct val_pool_conn;
+
+/** maximum number of jobs waiting in the queue, more are verified
+ * on the query thread */
+#define VAL_POOL_QUEUE_MAX 1024
+
+/** state of a verify job */
+enum val_pool_job_state {
+	/** created, not submitted yet */
+	val_pool_job_new = 0,
+	/** in the queue of the pool */
+	val_pool_job_queued,
+	/** a verify thread is working on it */
+	val_pool_job_running,
+	/** verified, in the done list of the connection */
+	val_pool_job_done,
+	/** taken from the done list by the query thread */
+	val_pool_job_taken
+};
+
+/**
+ * A job for the verify threads: the rrsets of a response to verify with
+ * one key entry.
+ */
+struct val_pool_job {
+	/** next in the queue or done list */
+	struct val_pool_job* next;
+	/** previous in the queue or done list */
+	struct val_pool_job* prev;
+	/** state, protected by the pool lock */
+	enum val_pool_job_state state;
+	/** the query is gone, the verify thread deletes the job */
+	int cancelled;
+	/** the connection of the query thread that made the job */
+	struct val_pool_conn* conn;
+	/** the query that waits for the job, only used on its own thread */
+	struct module_qstate* qstate;
+	/** validator environment with the verification settings */
+	struct val_env* ve;
+	/** region with the copies of the rrsets and key, and the results */
+	struct regional* region;
+	/** the time to verify the signatures at */
+	time_t now;
+	/** the DNSKEY rrset, copy */
+	struct ub_packed_rrset_key* dnskey;
+	/** the algorithms that need signatures, copy, or NULL */
+	uint8_t* sigalg;
+	/** number of rrsets in the job */
+	size_t num;
+	/** number of rrsets that have been verified, the others are
+	 * skipped because an earlier required rrset failed */
+	size_t num_done;
+	/** the rrsets of the query, used to find the result */
+	struct ub_packed_rrset_key** orig;
+	/** the copies of the rrsets that are verified */
+	struct ub_packed_rrset_key** rrsets;
+	/** the section of each rrset */
+	sldns_pkt_section* section;
+	/** if the rrset must be secure, the job stops when it is not */
+	uint8_t* required;
+	/** the results, the security status of each rrset */
+	enum sec_status* sec;
+	/** the reasons for failure, or NULL */
+	char** reason;
+};
+
+/**
+ * The connection of a query thread to the verify threads.  Verified
+ * jobs are put in its done list, and the thread is woken up.
+ */
+struct val_pool_conn {
+	/** the pool */
+	struct val_pool* pool;
+	/** tube that wakes up the query thread */
+	struct tube* tube;
+	/** list of verified jobs, protected by the pool lock */
+	struct val_pool_job* done_first;
+	/** last of the list of verified jobs */
+	struct val_pool_job* done_last;
+};
+
+/**
+ * A verify thread.
+ */
+struct val_pool_thr {
+	/** the pool */
+	struct val_pool* pool;
+	/** thread number for the log */
+	int thread_num;
+	/** the thread */
+	ub_thread_type tid;
+	/** environment for the verification, with scratch buffers */
+	struct module_env* env;
+	/** the time, the env points to it */
+	time_t now;
+};
+
+/**
+ * The verify threads, shared by the query threads.
+ */
+struct val_pool {
+	/** lock on the queue, the done lists and the job states */
+	lock_basic_type lock;
+	/** lock that the threads hold while they wait on the tube */
+	lock_basic_type read_lock;
+	/** tube with one message for every queued job, the threads
+	 * block on it */
+	struct tube* tube;
+	/** queue of jobs */
+	struct val_pool_job* queue_first;
+	/** last in the queue */
+	struct val_pool_job* queue_last;
+	/** number of jobs in the queue */
+	size_t queue_num;
+	/** the threads must stop */
+	int quit;
+	/** number of threads */
+	int num;
+	/** number of threads that have been started */
+	int num_started;
+	/** the threads, array of num */
+	struct val_pool_thr* thr;
+};
+
+/**
+ * Create the verify threads and start them.
+ * @param cfg: config file, for the scratch buffer size.
+ * @param num: number of threads.
+ * @param thread_num: the number of the first thread, for the log.
+ * @return new pool or NULL on failure.
+ */
+struct val_pool* val_pool_create(struct config_file* cfg, int num,
+	int thread_num);
+
+/**
+ * Stop the verify threads and delete the pool.  The connections must have
+ * been deleted.
+ * @param pool: the pool.
+ */
+void val_pool_delete(struct val_pool* pool);
+
+/**
+ * Create the connection of a query thread, on that thread.
+ * @param pool: the pool.
+ * @param base: the event base of the query thread.
+ * @return new connection or NULL on failure.
+ */
+struct val_pool_conn* val_pool_conn_create(struct val_pool* pool,
+	struct comm_base* base);
+
+/**
+ * Delete the connection of a query thread.  The jobs of the thread must
+ * have been deleted, this happens when its queries are deleted.
+ * @param conn: the connection.
+ */
+void val_pool_conn_delete(struct val_pool_conn* conn);
+
+/**
+ * Create a job to verify rrsets of a response.
+ * @param conn: the connection of the query thread.
+ * @param qstate: the query, it is woken up with module_event_pass.
+ * @param ve: validator environment.
+ * @param kkey: the key entry to verify with, it is copied.
+ * @param max: the maximum number of rrsets that are added.
+ * @return new job or NULL on failure.
+ */
+struct val_pool_job* val_pool_job_create(struct val_pool_conn* conn,
+	struct module_qstate* qstate, struct val_env* ve,
+	struct key_entry_key* kkey, size_t max);
+
+/**
+ * Add an rrset to the job, it is copied.
+ * @param job: the job, not submitted yet.
+ * @param rrset: the rrset to verify.
+ * @param section: the section the rrset is in.
+ * @param required: if the rrset must be secure.  If not, the job stops,
+ *	like the validator stops at a bad rrset.
+ * @return false on malloc failure.
+ */
+int val_pool_job_add(struct val_pool_job* job,
+	struct ub_packed_rrset_key* rrset, sldns_pkt_section section,
+	int required);
+
+/**
+ * Submit the job to the verify threads.
+ * @param job: the job.
+ * @return false if the queue is full, the job is not submitted.
+ */
+int val_pool_job_submit(struct val_pool_job* job);
+
+/**
+ * Check if the job is verified and given back to the query thread.
+ * @param job: the job.
+ * @return true if the results can be used.
+ */
+int val_pool_job_is_done(struct val_pool_job* job);
+
+/**
+ * Get the verify result for an rrset.  It also lowers the TTL of the rrset
+ * like the verification would, for the signature dates.
+ * @param job: the job, it is done.
+ * @param rrset: the rrset of the query.
+ * @param sec: returns the security status.
+ * @param reason: returns the reason of failure, allocated in the job.
+ * @return false if the job has no result for the rrset.
+ */
+int val_pool_job_result(struct val_pool_job* job,
+	struct ub_packed_rrset_key* rrset, enum sec_status* sec,
+	char** reason);
+
+/**
+ * Delete a job.  If a verify thread is busy with it, the thread deletes it
+ * when it is done.
+ * @param job: the job.
+ */
+void val_pool_job_delete(struct val_pool_job* job);
+
+/**
+ * Take the first verified job from the done list of the connection, on
+ * the query thread.  The job is then done for val_pool_job_is_done.
+ * @param conn: the connection.
+ * @return the job or NULL if the done list is empty.
+ */
+struct val_pool_job* val_pool_conn_take(struct val_pool_conn* conn);
+
+/** callback for the tube of a connection, wakes up the queries of
+ * verified jobs */
+void val_pool_conn_handle(struct tube* tube, uint8_t* msg, size_t len,
+	int error, void* arg);
+
+#endif /* VALIDATOR_VAL_POOL_H */
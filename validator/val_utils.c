@@ -362,7 +362,15 @@ val_verify_rrset(struct module_env* env, struct val_env* ve,
 		section, qstate);
 	verbose(VERB_ALGO, "verify result: %s", sec_status_to_string(sec));
 	regional_free_all(env->scratch);
+	return val_verify_rrset_result(env, ve, rrset, sec);
+}
 
+enum sec_status
+val_verify_rrset_result(struct module_env* env, struct val_env* ve,
+	struct ub_packed_rrset_key* rrset, enum sec_status sec)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)rrset->
+		entry.data;
 	/* update rrset security status 
 	 * only improves security status 
 	 * and bogus is set only once, even if we rechecked the status */
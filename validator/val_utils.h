@@ -131,6 +131,22 @@ enum sec_status val_verify_rrset(struct module_env* env, struct val_env* ve,
 	uint8_t* sigalg, char** reason, sldns_pkt_section section,
 	struct module_qstate* qstate);
 
+/**
+ * Set the security status of an RRset after its signatures have been
+ * verified, the last step of val_verify_rrset.  It is used for the
+ * results of the signature verify threads.  The status is only improved,
+ * a bogus rrset gets the bogus TTL, and the status is stored in the
+ * rrset cache.
+ * @param env: module environment (rrset cache, time)
+ * @param ve: validator environment (bogus TTL, statistics)
+ * @param rrset: the rrset that was verified.
+ * @param sec: the result of the signature verification.
+ * @return security status of verification.
+ */
+enum sec_status val_verify_rrset_result(struct module_env* env,
+	struct val_env* ve, struct ub_packed_rrset_key* rrset,
+	enum sec_status sec);
+
 /**
  * Verify RRset with keys from a keyset.
  * @param env: module environment (scratch buffer)
@@ -51,6 +51,7 @@
 #include "validator/val_neg.h"
 #include "validator/val_sigcrypt.h"
 #include "validator/autotrust.h"
+#include "validator/val_pool.h"
 #include "services/cache/dns.h"
 #include "services/cache/rrset.h"
 #include "util/data/dname.h"
@@ -130,6 +131,8 @@ val_apply_cfg(struct module_env* env, struct val_env* val_env,
 		return 0;
 	}
 	env->key_cache = val_env->kcache;
+	slabhash_set_policy(val_env->kcache->slab,
+		lruhash_policy_from_str(cfg->key_cache_policy));
 	if(!anchors_apply_cfg(env->anchors, cfg)) {
 		log_err("validator: error in trustanchors config");
 		return 0;
@@ -560,6 +563,112 @@ prime_trust_anchor(struct module_qstate* qstate, struct val_qstate* vq,
 	return 1;
 }
 
+/**
+ * Verify an rrset with the key entry, or use the result that the
+ * signature verify threads have for it.
+ * @param qstate: query state.
+ * @param env: module env for verify.
+ * @param ve: validator env for verify.
+ * @param job: the job of the verify threads, or NULL.
+ * @param s: the rrset.
+ * @param key_entry: the key entry.
+ * @param reason: reason of failure.
+ * @param section: section of the rrset.
+ * @return security status of verification.
+ */
+static enum sec_status
+validate_rrset_sigs(struct module_qstate* qstate, struct module_env* env,
+	struct val_env* ve, struct val_pool_job* job,
+	struct ub_packed_rrset_key* s, struct key_entry_key* key_entry,
+	char** reason, sldns_pkt_section section)
+{
+	enum sec_status sec;
+	if(job && val_pool_job_result(job, s, &sec, reason))
+		return val_verify_rrset_result(env, ve, s, sec);
+	return val_verify_rrset_entry(env, ve, s, key_entry, reason, section,
+		qstate);
+}
+
+/**
+ * Give the signatures of the message to the signature verify threads.
+ * The rrsets are picked like validate_msg_signatures verifies them,
+ * apart from the ones that are already secure, and the NSEC rrsets in
+ * the authority section, whose owner name is replaced in the query region
+ * by the verification.  Those are verified on this thread.
+ * 
+ * @param qstate: query state.
+ * @param env: module env, with the connection to the verify threads.
+ * @param ve: validator env for verify.
+ * @param qchase: query that was made.
+ * @param chase_reply: answer to validate.
+ * @param key_entry: the key entry to verify with.
+ * @return the submitted job, or NULL if there is nothing to verify, or
+ * 	on failure, then the signatures are verified on this thread.
+ */
+static struct val_pool_job*
+validate_msg_signatures_submit(struct module_qstate* qstate,
+	struct module_env* env, struct val_env* ve, struct query_info* qchase,
+	struct reply_info* chase_reply, struct key_entry_key* key_entry)
+{
+	struct val_pool_job* job;
+	struct ub_packed_rrset_key* s;
+	struct packed_rrset_data* d;
+	sldns_pkt_section section;
+	uint8_t* sname;
+	size_t i, slen;
+	int dname_seen = 0;
+
+	job = val_pool_job_create(env->val_pool, qstate, ve, key_entry,
+		chase_reply->rrset_count);
+	if(!job)
+		return NULL;
+	for(i=0; i<chase_reply->rrset_count; i++) {
+		s = chase_reply->rrsets[i];
+		if(i < chase_reply->an_numrrsets) {
+			section = LDNS_SECTION_ANSWER;
+			/* the CNAME following a DNAME is not verified */
+			if(dname_seen && ntohs(s->rk.type) ==
+				LDNS_RR_TYPE_CNAME) {
+				dname_seen = 0;
+				continue;
+			}
+			if(qchase->qtype != LDNS_RR_TYPE_DNAME && 
+				ntohs(s->rk.type) == LDNS_RR_TYPE_DNAME)
+				dname_seen = 1;
+		} else if(i < chase_reply->an_numrrsets+
+			chase_reply->ns_numrrsets) {
+			section = LDNS_SECTION_AUTHORITY;
+			if(ntohs(s->rk.type) == LDNS_RR_TYPE_NSEC)
+				continue;
+		} else {
+			section = LDNS_SECTION_ADDITIONAL;
+			if(!env->cfg->val_clean_additional)
+				break;
+			val_find_rrset_signer(s, &sname, &slen);
+			if(!sname || query_dname_compare(sname,
+				key_entry->name) != 0)
+				continue;
+		}
+		/* skip rrsets that are already verified */
+		d = (struct packed_rrset_data*)s->entry.data;
+		if(d->security != sec_status_secure)
+			rrset_check_sec_status(env->rrset_cache, s, *env->now);
+		if(d->security == sec_status_secure)
+			continue;
+		if(!val_pool_job_add(job, s, section,
+			section != LDNS_SECTION_ADDITIONAL)) {
+			log_err("validator: malloc failure for verify job");
+			val_pool_job_delete(job);
+			return NULL;
+		}
+	}
+	if(job->num == 0 || !val_pool_job_submit(job)) {
+		val_pool_job_delete(job);
+		return NULL;
+	}
+	return job;
+}
+
 /**
  * Validate if the ANSWER and AUTHORITY sections contain valid rrsets.
  * They must be validly signed with the given key.
@@ -577,13 +686,16 @@ prime_trust_anchor(struct module_qstate* qstate, struct val_qstate* vq,
  * @param chase_reply: answer to validate.
  * @param key_entry: the key entry, which is trusted, and which matches
  * 	the signer of the answer. The key entry isgood().
+ * @param job: the verify job with results from the signature verify
+ * 	threads, or NULL.
  * @return false if any of the rrsets in the an or ns sections of the message 
  * 	fail to verify. The message is then set to bogus.
  */
 static int
 validate_msg_signatures(struct module_qstate* qstate, struct module_env* env,
 	struct val_env* ve, struct query_info* qchase,
-	struct reply_info* chase_reply, struct key_entry_key* key_entry)
+	struct reply_info* chase_reply, struct key_entry_key* key_entry,
+	struct val_pool_job* job)
 {
 	uint8_t* sname;
 	size_t i, slen;
@@ -611,8 +723,8 @@ validate_msg_signatures(struct module_qstate* qstate, struct module_env* env,
 		}
 
 		/* Verify the answer rrset */
-		sec = val_verify_rrset_entry(env, ve, s, key_entry, &reason,
-			LDNS_SECTION_ANSWER, qstate);
+		sec = validate_rrset_sigs(qstate, env, ve, job, s, key_entry,
+			&reason, LDNS_SECTION_ANSWER);
 		/* If the (answer) rrset failed to validate, then this 
 		 * message is BAD. */
 		if(sec != sec_status_secure) {
@@ -641,8 +753,8 @@ validate_msg_signatures(struct module_qstate* qstate, struct module_env* env,
 	for(i=chase_reply->an_numrrsets; i<chase_reply->an_numrrsets+
 		chase_reply->ns_numrrsets; i++) {
 		s = chase_reply->rrsets[i];
-		sec = val_verify_rrset_entry(env, ve, s, key_entry, &reason,
-			LDNS_SECTION_AUTHORITY, qstate);
+		sec = validate_rrset_sigs(qstate, env, ve, job, s, key_entry,
+			&reason, LDNS_SECTION_AUTHORITY);
 		/* If anything in the authority section fails to be secure, 
 		 * we have a bad message. */
 		if(sec != sec_status_secure) {
@@ -669,8 +781,8 @@ validate_msg_signatures(struct module_qstate* qstate, struct module_env* env,
 		/* leave others unchecked, those get removed later on too */
 		val_find_rrset_signer(s, &sname, &slen);
 		if(sname && query_dname_compare(sname, key_entry->name)==0)
-			(void)val_verify_rrset_entry(env, ve, s, key_entry,
-				&reason, LDNS_SECTION_ADDITIONAL, qstate);
+			(void)validate_rrset_sigs(qstate, env, ve, job, s,
+				key_entry, &reason, LDNS_SECTION_ADDITIONAL);
 		/* the additional section can fail to be secure, 
 		 * it is optional, check signature in case we need
 		 * to clean the additional section later. */
@@ -1821,7 +1933,7 @@ processValidate(struct module_qstate* qstate, struct val_qstate* vq,
 	struct val_env* ve, int id)
 {
 	enum val_classification subtype;
-	int rcode;
+	int rcode, sigok;
 
 	if(!vq->key_entry) {
 		verbose(VERB_ALGO, "validate: no key entry, failed");
@@ -1870,10 +1982,26 @@ processValidate(struct module_qstate* qstate, struct val_qstate* vq,
 	if(subtype != VAL_CLASS_REFERRAL)
 		remove_spurious_authority(vq->chase_reply, vq->orig_msg->rep);
 
+	/* with signature verify threads, they check the signatures and
+	 * the query waits, this is entered again when they are done */
+	if(qstate->env->val_pool && !vq->vjob)
+		vq->vjob = validate_msg_signatures_submit(qstate, qstate->env,
+			ve, &vq->qchase, vq->chase_reply, vq->key_entry);
+	if(vq->vjob && !val_pool_job_is_done(vq->vjob)) {
+		verbose(VERB_ALGO, "validate: wait for signature verify "
+			"threads");
+		vq->state = VAL_VALIDATE_STATE;
+		qstate->ext_state[id] = module_wait_reply;
+		return 0;
+	}
+
 	/* check signatures in the message; 
 	 * answer and authority must be valid, additional is only checked. */
-	if(!validate_msg_signatures(qstate, qstate->env, ve, &vq->qchase, 
-		vq->chase_reply, vq->key_entry)) {
+	sigok = validate_msg_signatures(qstate, qstate->env, ve, &vq->qchase,
+		vq->chase_reply, vq->key_entry, vq->vjob);
+	val_pool_job_delete(vq->vjob);
+	vq->vjob = NULL;
+	if(!sigok) {
 		/* workaround bad recursor out there that truncates (even
 		 * with EDNS4k) to 512 by removing RRSIG from auth section
 		 * for positive replies*/
@@ -2873,8 +3001,15 @@ val_inform_super(struct module_qstate* qstate, int id,
 void
 val_clear(struct module_qstate* qstate, int id)
 {
+	struct val_qstate* vq;
 	if(!qstate)
 		return;
+	vq = (struct val_qstate*)qstate->minfo[id];
+	/* the verify job is not in the region */
+	if(vq && vq->vjob) {
+		val_pool_job_delete(vq->vjob);
+		vq->vjob = NULL;
+	}
 	/* everything is allocated in the region, so assign NULL */
 	qstate->minfo[id] = NULL;
 }
@@ -50,6 +50,7 @@ struct key_cache;
 struct key_entry_key;
 struct val_neg_cache;
 struct config_strlist;
+struct val_pool_job;
 
 /**
  * This is the TTL to use when a trust anchor fails to prime. A trust anchor
@@ -215,6 +216,9 @@ struct val_qstate {
 
 	/** true if this state is waiting to prime a trust anchor */
 	int wait_prime_ta;
+
+	/** the signatures that the verify threads check, or NULL */
+	struct val_pool_job* vjob;
 };
 
 /**